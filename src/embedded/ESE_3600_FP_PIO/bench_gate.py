@@ -0,0 +1,147 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+# Performance gate for the pipeline stages (see src/utils/bench/bench.h).
+# Runs the "bench" console command on the host build, or reads a serial capture of it from the
+# device, and compares each stage's fastest time per call with bench_baseline.json. The fastest repeat is
+# the one least disturbed by interrupts, BLE and (on the host) other processes, so it is the steadiest figure.
+# Stages are compared relative to the "calibrate" stage, a fixed loop measured in the same run, so the host
+# baseline holds on another machine or at another clock speed. A platform's baseline can widen the
+# tolerance of single stages ("tolerance" in bench_baseline.json) that are too short to time steadily.
+# Exits 1 if any stage is slower than its baseline by more than the tolerance.
+#
+# test/test_bench runs the same stages under pio test -e native, with a wider margin.
+
+DEFAULT_PROGRAM = os.path.join(".pio", "build", "native", "program")
+DEFAULT_BASELINE = "bench_baseline.json"
+CALIBRATE = "calibrate"
+
+
+def parse_bench(lines):
+    """Platform name and {stage: result} from the last START_BENCH / END_BENCH block"""
+    platform, results, inside = None, None, False
+    for line in lines:
+        line = line.strip()
+        if line == "START_BENCH":
+            platform, results, inside = None, {}, True
+        elif line == "END_BENCH":
+            inside = False
+        elif inside and line.startswith("{"):
+            entry = json.loads(line)
+            if "platform" in entry:
+                platform = entry["platform"]
+            elif not entry.get("skipped"):
+                results[entry["stage"]] = entry
+    if results is None:
+        raise ValueError("No bench output found")
+    return platform, results
+
+
+def run_host(program, runs):
+    """Fastest result per stage over several runs, the host shares its CPU with everything else"""
+    best = {}
+    with tempfile.TemporaryDirectory() as scratch:
+        command_path = os.path.join(scratch, "commands")
+        with open(command_path, "w") as f:
+            f.write("bench\n")
+        for run in range(runs):
+            if run:
+                time.sleep(0.2)  # Spread the runs out so one busy spell does not hit all of them
+            # Commands come from a file so they are there before the first console poll
+            with open(command_path) as commands:
+                output = subprocess.run(
+                    [program, "--fs", os.path.join(scratch, "fs"), "--duration", "1000"],
+                    stdin=commands, capture_output=True, text=True, check=True,
+                ).stdout
+            platform, results = parse_bench(output.splitlines())
+            for stage, result in results.items():
+                if stage not in best or result["min_us"] < best[stage]["min_us"]:
+                    best[stage] = result
+    return platform, best
+
+
+def compare(baseline, results, tolerance, floor_us):
+    """Prints the comparison table, returns the stages that regressed"""
+    stages, tolerances = baseline["stages"], baseline.get("tolerance", {})
+    if CALIBRATE not in results or CALIBRATE not in stages:
+        sys.exit(f"No {CALIBRATE} stage to compare against, the firmware or the baseline predates it")
+    # Baseline times scaled to this run's speed
+    scale = results[CALIBRATE]["min_us"] / stages[CALIBRATE]
+    print(f"{CALIBRATE} {results[CALIBRATE]['min_us']:.3f} us against {stages[CALIBRATE]:.3f} us, "
+          f"baseline scaled by {scale:.2f}")
+    regressed = []
+    print(f"{'stage':<16} {'baseline us':>12} {'current us':>12} {'change':>8}  status")
+    for stage, result in results.items():
+        if stage == CALIBRATE:
+            continue
+        current = result["min_us"]
+        if stage not in stages:
+            print(f"{stage:<16} {'-':>12} {current:>12.3f} {'-':>8}  new")
+            continue
+        base = stages[stage] * scale
+        allowed = tolerances.get(stage, tolerance)
+        change = (current - base) / base if base > 0 else 0.0
+        # Two ticks of the microsecond timer spread over the batch is within measurement noise
+        noise_us = max(floor_us, 2.0 / result["calls"])
+        slower = current > base * (1 + allowed) and current - base > noise_us
+        status = "REGRESSED" if slower else ("faster" if change < -allowed else "ok")
+        if slower:
+            regressed.append(stage)
+        print(f"{stage:<16} {base:>12.3f} {current:>12.3f} {change:>+8.1%}  {status}")
+    for stage in stages:
+        if stage not in results:
+            print(f"{stage:<16} {stages[stage] * scale:>12.3f} {'-':>12} {'-':>8}  missing")
+    return regressed
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Fail when a pipeline stage is slower than its stored baseline")
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument("--program", default=DEFAULT_PROGRAM, help="host build of the firmware")
+    source.add_argument("--capture", help="serial capture of the device's \"bench\" command")
+    parser.add_argument("--baseline", default=DEFAULT_BASELINE)
+    parser.add_argument("--runs", type=int, default=5, help="host: runs to take the best median from")
+    parser.add_argument("--tolerance", type=float, default=0.25,
+                        help="allowed slowdown relative to calibrate, 0.25 = 25%%")
+    parser.add_argument("--floor-us", type=float, default=0.0, help="also ignore slowdowns smaller than this")
+    parser.add_argument("--update", action="store_true", help="store these results as the new baseline")
+    args = parser.parse_args()
+
+    if args.capture:
+        with open(args.capture, errors="replace") as f:
+            platform, results = parse_bench(f)
+    else:
+        if not os.path.exists(args.program):
+            sys.exit(f"{args.program} not found, build it with: pio run -e native")
+        platform, results = run_host(args.program, args.runs)
+
+    baselines = {}
+    if os.path.exists(args.baseline):
+        with open(args.baseline) as f:
+            baselines = json.load(f)
+
+    if args.update:
+        # Stage tolerances are kept, they are set by hand
+        previous = baselines.get(platform, {})
+        baselines[platform] = {"stages": {stage: round(r["min_us"], 3) for stage, r in results.items()}}
+        if previous.get("tolerance"):
+            baselines[platform]["tolerance"] = previous["tolerance"]
+        with open(args.baseline, "w") as f:
+            json.dump(baselines, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"Stored {len(results)} {platform} stages in {args.baseline}")
+        sys.exit(0)
+
+    if platform not in baselines:
+        sys.exit(f"No {platform} baseline in {args.baseline}, record one with --update")
+
+    regressed = compare(baselines[platform], results, args.tolerance, args.floor_us)
+    if regressed:
+        print(f"\n{len(regressed)} stage(s) regressed beyond their tolerance: {', '.join(regressed)}")
+        sys.exit(1)
+    print(f"\nAll {platform} stages within their tolerance of the baseline")
@@ -0,0 +1,82 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+import model_pack
+
+# Accuracy bound for the result cache (src/utils/tflite/result_cache.h).
+# Replays the recordings through the host build with --inputs, which writes every model input window
+# and, for the windows the cache answered, the window whose result was reused. The host build's model
+# is a stand-in, so the real model (model_pack.py's interpreter on model.cpp) is run here on both
+# windows of every hit: a hit is wrong when the reused result predicts another class than the model
+# would have for the window itself. Exits 1 if more hits than --max-changes change the class.
+
+DEFAULT_PROGRAM = os.path.join(".pio", "build", "native", "program")
+
+
+def run_host(program, pipeline, replay):
+    """The --inputs records of one replay"""
+    with tempfile.TemporaryDirectory() as scratch:
+        inputs_path = os.path.join(scratch, "inputs.jsonl")
+        subprocess.run(
+            [program, "--replay", replay, "--pipeline", pipeline, "--fs", os.path.join(scratch, "fs"),
+             "--inputs", inputs_path],
+            stdin=subprocess.DEVNULL, capture_output=True, check=True,
+        )
+        if not os.path.exists(inputs_path):
+            return []
+        with open(inputs_path) as f:
+            return [json.loads(line) for line in f]
+
+
+def check(interpreter, records):
+    """(hits, class changes, largest probability difference) over the cache hits"""
+    outputs = {}
+
+    def output(window):
+        if window not in outputs:
+            outputs[window] = interpreter.run(records[window]["input"])
+        return outputs[window]
+
+    hits, changed, worst = 0, 0, 0.0
+    for record in records:
+        if record["cached_from"] < 0:
+            continue
+        hits += 1
+        p, q = output(record["window"]), output(record["cached_from"])
+        if p.index(max(p)) != q.index(max(q)):
+            changed += 1
+            print(f"  window {record['window']} at {record['ms']:.0f} ms: {model_pack.LABELS[p.index(max(p))]} "
+                  f"-> {model_pack.LABELS[q.index(max(q))]} (cached from window {record['cached_from']})")
+        worst = max(worst, max(abs(x - y) for x, y in zip(p, q)))
+    return hits, changed, worst
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Bound the result cache's accuracy loss on the replay corpus")
+    parser.add_argument("--program", default=DEFAULT_PROGRAM, help="host build of the firmware")
+    parser.add_argument("--model", default=model_pack.DEFAULT_MODEL, help="model.cpp or a .tflite file")
+    parser.add_argument("--replay", default="data", help="recording or directory of recordings")
+    parser.add_argument("--pipelines", default="scheduled,reps", help="comma separated --pipeline modes")
+    parser.add_argument("--max-changes", type=int, default=0, help="class changes allowed per pipeline")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.program):
+        sys.exit(f"{args.program} not found, build it with: pio run -e native")
+    interpreter = model_pack.Interpreter(model_pack.read_model(args.model))
+
+    failed = []
+    print(f"{'pipeline':<10} {'windows':>8} {'hits':>6} {'hit rate':>9} {'changes':>8} {'max diff':>9}")
+    for pipeline in args.pipelines.split(","):
+        records = run_host(args.program, pipeline, args.replay)
+        hits, changed, worst = check(interpreter, records)
+        if changed > args.max_changes:
+            failed.append(pipeline)
+        rate = 100.0 * hits / len(records) if records else 0.0
+        print(f"{pipeline:<10} {len(records):>8} {hits:>6} {rate:>8.1f}% {changed:>8} {worst:>9.4f}")
+    if failed:
+        print(f"\nResult cache changes the class beyond --max-changes: {', '.join(failed)}")
+        sys.exit(1)
@@ -4,6 +4,8 @@ import time
 import glob
 from datetime import datetime
 
+from decompress_files import decompress_tree
+
 
 def find_serial_port():
     """Find the correct serial port for XIAO ESP32S3 on macOS"""
@@ -117,6 +119,9 @@ def copy_files():
         ser.close()
         print(f"\nAll files copied to: {base_path}")
 
+        # Expand compressed recordings into the usual JSON layout
+        decompress_tree(base_path, remove_source=True)
+
     except Exception as e:
         print(f"Error: {str(e)}")
         if "ser" in locals():
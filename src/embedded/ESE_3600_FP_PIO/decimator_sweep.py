@@ -0,0 +1,85 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+import model_pack
+from bench_gate import run_host
+
+# Compares the decimator filters (src/utils/tflite/decimator.h) on the host build: classification
+# accuracy over the recorded sessions, one scheduled-pipeline replay per filter, next to each filter's
+# cost from the "bench" console command.
+# The host build's model is a stand-in, so every model input window the replay writes with --inputs is
+# run through the real model (model_pack.py's interpreter on model.cpp) and scored against the class
+# recorded for the session its result fell in, as simulate.py does.
+
+FILTERS = ["boxcar", "sinc", "cic"]
+DEFAULT_PROGRAM = os.path.join(".pio", "build", "native", "program")
+
+
+def run_filter(program, decimator, replay, pipeline, interpreter, extra_args):
+    with tempfile.TemporaryDirectory() as scratch:
+        report_path = os.path.join(scratch, "report.json")
+        inputs_path = os.path.join(scratch, "inputs.jsonl")
+        command = [
+            program,
+            "--pipeline", pipeline,
+            "--decimator", decimator,
+            "--replay", replay,
+            "--fs", os.path.join(scratch, "fs"),
+            "--ble-log", os.path.join(scratch, "ble.bin"),
+            "--report", report_path,
+            "--inputs", inputs_path,
+        ] + extra_args
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        with open(report_path) as f:
+            report = json.load(f)
+        records = []
+        if os.path.exists(inputs_path):
+            with open(inputs_path) as f:
+                records = [json.loads(line) for line in f]
+        report["model"] = model_pack.score(interpreter, records, report["classification"]["expected"])
+        return report
+
+
+def bench_costs(program):
+    """{filter: fastest us per window} from the "bench" console command"""
+    _, results = run_host(program, 1)
+    return {name: results[f"decimate_{name}"]["min_us"] for name in FILTERS if f"decimate_{name}" in results}
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compare decimator filters on the host build")
+    parser.add_argument("--program", default=DEFAULT_PROGRAM, help="host build of the firmware")
+    parser.add_argument("--replay", default="data", help="recording or directory of recordings to replay")
+    parser.add_argument("--filters", nargs="+", default=FILTERS, choices=FILTERS)
+    parser.add_argument("--pipeline", default="scheduled", help="pipeline mode to replay with")
+    parser.add_argument("--model", default=model_pack.DEFAULT_MODEL, help="model.cpp or a .tflite file to score with")
+    parser.add_argument("--json", help="also write the reports to this file")
+    args, extra = parser.parse_known_args()
+
+    if not os.path.exists(args.program):
+        sys.exit(f"{args.program} not found, build it with: pio run -e native")
+
+    costs = bench_costs(args.program)
+    interpreter = model_pack.Interpreter(model_pack.read_model(args.model))
+    reports = {
+        name: run_filter(args.program, name, args.replay, args.pipeline, interpreter, extra) for name in args.filters
+    }
+
+    header = f"{'filter':<8} {'us/window':>10} {'results':>8} {'in session':>11} {'correct':>8} {'accuracy':>9}"
+    print(header)
+    print("-" * len(header))
+    for name, report in reports.items():
+        c = report["model"]
+        cost = costs.get(name)
+        cost_text = f"{cost:>10.2f}" if cost is not None else f"{'-':>10}"
+        print(
+            f"{name:<8} {cost_text} {report['classification']['results']:>8} {c['in_session']:>11} "
+            f"{c['correct']:>8} {c['accuracy']:>9.1%}"
+        )
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump({"costs": costs, "reports": reports}, f, indent=2)
@@ -0,0 +1,112 @@
+import os
+import sys
+
+# Host-side decoder for the delta + zigzag varint .rmc recordings written by
+# compressed_operations.cpp. Produces the same JSON layout as json_operations.cpp.
+
+MAGIC = b"RMC"
+VERSION = 1
+CHANNELS = ["aX", "aY", "aZ", "gX", "gY", "gZ"]
+
+
+def read_varint(data, pos):
+    """Read an unsigned LEB128 varint, returns (value, new_pos) or (None, pos) if truncated"""
+    result = 0
+    shift = 0
+    while pos < len(data) and shift < 35:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7F) << shift
+        if not byte & 0x80:
+            return result, pos
+        shift += 7
+    return None, pos
+
+
+def zigzag_decode(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def decode_rmc(data):
+    """Decode an .rmc byte string into (lift_name, lift_classification, samples)"""
+    if data[:3] != MAGIC or data[3] != VERSION:
+        raise ValueError("Not an RMC v1 file")
+    scale = data[4] | (data[5] << 8)
+
+    pos = 6
+    strings = []
+    for _ in range(2):
+        length = data[pos]
+        strings.append(data[pos + 1 : pos + 1 + length].decode())
+        pos += 1 + length
+
+    samples = []
+    prev_t = 0
+    prev = [0] * len(CHANNELS)
+    while pos < len(data):
+        dt, pos = read_varint(data, pos)
+        if dt is None:
+            break
+        values = []
+        for c in range(len(CHANNELS)):
+            raw, pos = read_varint(data, pos)
+            if raw is None:
+                break
+            prev[c] += zigzag_decode(raw)
+            values.append(prev[c] / scale)
+        if len(values) != len(CHANNELS):
+            break  # Truncated final sample (e.g. power loss mid-write)
+        prev_t += dt
+        samples.append((prev_t, values))
+
+    return strings[0], strings[1], samples
+
+
+def to_json(lift_name, lift_classification, samples):
+    """Format samples exactly like json_operations.cpp does on the device"""
+    lines = ["{", f'  "lN": "{lift_name}",', f'  "lC": "{lift_classification}",', '  "tSD": [']
+    rows = []
+    for t, v in samples:
+        rows.append(
+            '    {"t": %.1f, "aX": %.3f, "aY": %.3f, "aZ": %.3f, "gX": %.3f, "gY": %.3f, "gZ": %.3f}'
+            % (t, *v)
+        )
+    body = ",\n".join(rows)
+    return "\n".join(lines) + "\n" + body + "\n  ]\n}\n"
+
+
+def decompress_file(src_path, remove_source=False):
+    """Convert one .rmc file to .json next to it, returns (compressed_bytes, json_bytes)"""
+    with open(src_path, "rb") as f:
+        data = f.read()
+    lift_name, lift_classification, samples = decode_rmc(data)
+    text = to_json(lift_name, lift_classification, samples)
+
+    dest_path = os.path.splitext(src_path)[0] + ".json"
+    with open(dest_path, "w") as f:
+        f.write(text)
+    if remove_source:
+        os.remove(src_path)
+    return len(data), len(text.encode())
+
+
+def decompress_tree(root, remove_source=False):
+    total_compressed = 0
+    total_json = 0
+    for dirpath, _, filenames in os.walk(root):
+        for name in sorted(filenames):
+            if not name.endswith(".rmc"):
+                continue
+            path = os.path.join(dirpath, name)
+            compressed, expanded = decompress_file(path, remove_source)
+            total_compressed += compressed
+            total_json += expanded
+            print(f"✓ {path}: {compressed} -> {expanded} bytes")
+
+    if total_compressed:
+        print(f"\nCompression ratio: {total_json / total_compressed:.2f}x")
+    return total_compressed, total_json
+
+
+if __name__ == "__main__":
+    decompress_tree(sys.argv[1] if len(sys.argv) > 1 else "data")
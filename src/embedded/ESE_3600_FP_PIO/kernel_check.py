@@ -0,0 +1,81 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+# Equivalence check for the float kernels (see src/utils/kernels/kernels.h).
+# Runs the "kernels" console command on the host build, or reads a serial capture of it from the
+# device, and checks each kernel's largest difference from the portable reference in ULP. Every
+# implementation (reference, SSE2, AVX, ESP32-S3) has to match bit for bit, which holds as long as the
+# build does not fuse multiply-adds (-ffp-contract=off, platformio.ini). The exp row is the polynomial
+# against libm. test/test_kernels makes the same checks under pio test -e native.
+# Exits 1 if any kernel is further off than allowed.
+
+DEFAULT_PROGRAM = os.path.join(".pio", "build", "native", "program")
+
+
+def parse_kernels(lines):
+    """Implementation name and the rows of the last START_KERNELS / END_KERNELS block"""
+    impl, checks, inside = None, None, False
+    for line in lines:
+        line = line.strip()
+        if line == "START_KERNELS":
+            impl, checks, inside = None, [], True
+        elif line == "END_KERNELS":
+            inside = False
+        elif inside and line.startswith("{"):
+            entry = json.loads(line)
+            if "impl" in entry:
+                impl = entry["impl"]
+            else:
+                checks.append(entry)
+    if checks is None:
+        raise ValueError("No kernels output found")
+    return impl, checks
+
+
+def run_host(program):
+    with tempfile.TemporaryDirectory() as scratch:
+        command_path = os.path.join(scratch, "commands")
+        with open(command_path, "w") as f:
+            f.write("kernels\n")
+        with open(command_path) as commands:
+            output = subprocess.run(
+                [program, "--fs", os.path.join(scratch, "fs"), "--duration", "1000"],
+                stdin=commands, capture_output=True, text=True, check=True,
+            ).stdout
+    return parse_kernels(output.splitlines())
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Check the build's kernels against the reference")
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument("--program", default=DEFAULT_PROGRAM, help="host build of the firmware")
+    source.add_argument("--capture", help="serial capture of the device's \"kernels\" command")
+    parser.add_argument("--tolerance", type=int, default=0, help="ULP allowed against the reference")
+    parser.add_argument("--exp-tolerance", type=int, default=2, help="ULP allowed for exp against libm")
+    args = parser.parse_args()
+
+    if args.capture:
+        with open(args.capture, errors="replace") as f:
+            impl, checks = parse_kernels(f)
+    else:
+        if not os.path.exists(args.program):
+            sys.exit(f"{args.program} not found, build it with: pio run -e native")
+        impl, checks = run_host(args.program)
+
+    failed = []
+    print(f"{impl} kernels")
+    print(f"{'kernel':<12} {'against':<10} {'values':>8} {'max ulp':>8}  status")
+    for check in checks:
+        allowed = args.exp_tolerance if check["against"] == "libm" else args.tolerance
+        ok = check["max_ulp"] <= allowed
+        if not ok:
+            failed.append(check["kernel"])
+        print(f"{check['kernel']:<12} {check['against']:<10} {check['values']:>8} {check['max_ulp']:>8}  "
+              f"{'ok' if ok else 'DIFFERENT'}")
+    if failed:
+        print(f"\n{len(failed)} kernel(s) beyond the tolerance: {', '.join(failed)}")
+        sys.exit(1)
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Adafruit_Sensor.h>
+#include <Wire.h>
+
+#define MPU6050_I2CADDR_DEFAULT 0x68
+
+typedef enum
+{
+  MPU6050_RANGE_2_G = 0,
+  MPU6050_RANGE_4_G = 1,
+  MPU6050_RANGE_8_G = 2,
+  MPU6050_RANGE_16_G = 3,
+} mpu6050_accel_range_t;
+
+typedef enum
+{
+  MPU6050_RANGE_250_DEG,
+  MPU6050_RANGE_500_DEG,
+  MPU6050_RANGE_1000_DEG,
+  MPU6050_RANGE_2000_DEG,
+} mpu6050_gyro_range_t;
+
+typedef enum
+{
+  MPU6050_BAND_260_HZ,
+  MPU6050_BAND_184_HZ,
+  MPU6050_BAND_94_HZ,
+  MPU6050_BAND_44_HZ,
+  MPU6050_BAND_21_HZ,
+  MPU6050_BAND_10_HZ,
+  MPU6050_BAND_5_HZ,
+} mpu6050_bandwidth_t;
+
+typedef enum
+{
+  MPU6050_HIGHPASS_DISABLE,
+  MPU6050_HIGHPASS_5_HZ,
+  MPU6050_HIGHPASS_2_5_HZ,
+  MPU6050_HIGHPASS_1_25_HZ,
+  MPU6050_HIGHPASS_0_63_HZ,
+  MPU6050_HIGHPASS_UNUSED,
+  MPU6050_HIGHPASS_HOLD,
+} mpu6050_highpass_t;
+
+// Replays recorded sessions (host_runtime.h) instead of talking to the chip.
+// Readings are clipped to the configured full-scale range like the real sensor, and only change once
+// per sample period: 1 kHz (the DLPF is always on here) divided by 1 + the sample rate divisor.
+// The motion detector runs on the replay at 1 kHz whenever it is asked about (hostMpuInterruptLine()),
+// with the high-pass filter as a one-pole filter at its corner frequency.
+class Adafruit_MPU6050
+{
+public:
+  bool begin(uint8_t i2c_address = MPU6050_I2CADDR_DEFAULT, TwoWire *wire = &Wire, int32_t sensor_id = 0);
+
+  void setAccelerometerRange(mpu6050_accel_range_t range) { accel_range = range; }
+  mpu6050_accel_range_t getAccelerometerRange() { return accel_range; }
+  void setGyroRange(mpu6050_gyro_range_t range) { gyro_range = range; }
+  mpu6050_gyro_range_t getGyroRange() { return gyro_range; }
+  void setFilterBandwidth(mpu6050_bandwidth_t bandwidth) { filter_bandwidth = bandwidth; }
+  mpu6050_bandwidth_t getFilterBandwidth() { return filter_bandwidth; }
+  void setSampleRateDivisor(uint8_t divisor) { sample_rate_divisor = divisor; }
+  uint8_t getSampleRateDivisor() { return sample_rate_divisor; }
+
+  void setHighPassFilter(mpu6050_highpass_t bandwidth) { highpass = bandwidth; }
+  mpu6050_highpass_t getHighPassFilter() { return highpass; }
+  void setMotionInterrupt(bool active);
+  bool getMotionInterruptEnabled() { return motion_interrupt; }
+  void setMotionDetectionThreshold(uint8_t threshold) { motion_threshold = threshold; }
+  uint8_t getMotionDetectionThreshold() { return motion_threshold; }
+  void setMotionDetectionDuration(uint8_t duration) { motion_duration = duration; }
+  uint8_t getMotionDetectionDuration() { return motion_duration; }
+  void setInterruptPinLatch(bool held) { interrupt_latch = held; }
+  bool getInterruptPinLatch() { return interrupt_latch; }
+  void setInterruptPinPolarity(bool active_low) { interrupt_active_low = active_low; }
+  bool getInterruptPinPolarity() { return interrupt_active_low; }
+
+  // Reads (and so clears) the motion bit of INT_STATUS
+  bool getMotionInterruptStatus();
+
+  bool getEvent(sensors_event_t *accel, sensors_event_t *gyro, sensors_event_t *temp);
+
+private:
+  mpu6050_highpass_t highpass = MPU6050_HIGHPASS_DISABLE;
+  bool motion_interrupt = false;
+  uint8_t motion_threshold = 0;
+  uint8_t motion_duration = 0;
+  bool interrupt_latch = false;
+  bool interrupt_active_low = false;
+
+  mpu6050_accel_range_t accel_range = MPU6050_RANGE_2_G;
+  mpu6050_gyro_range_t gyro_range = MPU6050_RANGE_250_DEG;
+  mpu6050_bandwidth_t filter_bandwidth = MPU6050_BAND_260_HZ;
+  uint8_t sample_rate_divisor = 0;
+};
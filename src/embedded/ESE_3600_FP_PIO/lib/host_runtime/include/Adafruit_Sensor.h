@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+
+#define SENSORS_GRAVITY_STANDARD (9.80665F)
+#define SENSORS_DPS_TO_RADS (0.017453293F)
+
+typedef struct
+{
+  float x;
+  float y;
+  float z;
+} sensors_vec_t;
+
+typedef struct
+{
+  int32_t version;
+  int32_t sensor_id;
+  int32_t type;
+  int32_t reserved0;
+  int32_t timestamp;
+  sensors_vec_t acceleration; // m/s^2
+  sensors_vec_t gyro;         // rad/s
+  float temperature;          // degrees C
+} sensors_event_t;
@@ -0,0 +1,57 @@
+#pragma once
+
+// Host stand-in for the ESP32 Arduino core, only what the firmware uses.
+// Time comes from the virtual clock in host_runtime.h.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+#include "WString.h"
+#include "Print.h"
+#include "HardwareSerial.h"
+#include "host_runtime.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::max;
+using std::min;
+
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+#define PULLDOWN 0x08
+#define INPUT_PULLDOWN 0x09
+
+// Seeed XIAO ESP32S3 pin map
+static const uint8_t D0 = 1;
+static const uint8_t D1 = 2;
+static const uint8_t D2 = 3;
+static const uint8_t D3 = 4;
+static const uint8_t D4 = 5;
+static const uint8_t D5 = 6;
+static const uint8_t D6 = 43;
+static const uint8_t D7 = 44;
+static const uint8_t D8 = 7;
+static const uint8_t D9 = 8;
+static const uint8_t D10 = 9;
+static const uint8_t LED_BUILTIN = 21;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
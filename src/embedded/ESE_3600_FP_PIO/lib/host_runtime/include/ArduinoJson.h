@@ -0,0 +1,3 @@
+#pragma once
+
+// Included by the recording code, which formats its JSON by hand; nothing to provide
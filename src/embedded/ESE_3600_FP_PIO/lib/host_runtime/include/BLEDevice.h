@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+// Types ble.h refers to; the host implementation of the ble.h API lives in ble_host.cpp
+class BLEUUID
+{
+public:
+  BLEUUID(const char *uuid) : uuid(uuid) {}
+  std::string toString() const { return uuid; }
+
+private:
+  std::string uuid;
+};
+
+class BLERemoteCharacteristic;
+class BLEAdvertisedDevice;
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include "Print.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+  struct FileImpl;
+
+  // Handle to a file or directory under the LittleFS root; copies share the open file
+  class File : public Print
+  {
+  public:
+    File() {}
+    explicit File(std::shared_ptr<FileImpl> impl) : impl(impl) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    using Print::write;
+    void flush() override;
+
+    int available();
+    int read();
+    size_t read(uint8_t *buffer, size_t size);
+    bool seek(uint32_t position);
+    size_t position() const;
+    size_t size() const;
+    void close();
+
+    const char *path() const;
+    const char *name() const;
+    bool isDirectory() const;
+    File openNextFile(const char *mode = FILE_READ);
+    void rewindDirectory();
+
+    operator bool() const;
+
+  private:
+    std::shared_ptr<FileImpl> impl;
+  };
+}
+
+using fs::File;
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include "Print.h"
+
+// Serial on the host: stdout/stdin, or a pseudo terminal (REPMATE_SERIAL=pty) that
+// host tools such as copy_files.py can open like the board's USB port
+class HardwareSerial : public Print
+{
+public:
+  void begin(unsigned long baud);
+  void end() {}
+  void setTimeout(unsigned long timeout_ms) { timeout = timeout_ms; }
+
+  int available();
+  int read();
+  int peek();
+  String readString();
+  String readStringUntil(char terminator);
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override;
+
+  operator bool() const { return true; }
+
+  // Bytes written since startup
+  uint64_t bytesWritten() const { return written; }
+
+private:
+  void pump();
+
+  int fd_out = -1;
+  int fd_in = -1;
+  std::string input;
+  unsigned long timeout = 1000;
+  uint64_t written = 0;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "FS.h"
+
+// LittleFS backed by a host directory (REPMATE_FS_ROOT). The partition size is enforced,
+// writes that would not fit on the device fail the same way.
+class LittleFSFS
+{
+public:
+  bool begin(bool format_on_fail = false, const char *base_path = "/littlefs", uint8_t max_open_files = 10,
+             const char *partition_label = "spiffs");
+  void end() { mounted = false; }
+  bool format();
+
+  File open(const char *path, const char *mode = FILE_READ, bool create = false);
+  File open(const String &path, const char *mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool rmdir(const char *path);
+
+  size_t totalBytes() { return total_bytes; }
+  size_t usedBytes() { return used_bytes; }
+
+  // Called by File as data is written, false if the partition is full
+  bool reserve(size_t bytes);
+  void release(size_t bytes);
+
+private:
+  bool mounted = false;
+  size_t total_bytes = 0;
+  size_t used_bytes = 0;
+};
+
+extern LittleFSFS LittleFS;
@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for the TFLite Micro port, see tensorflow/lite/micro/micro_interpreter.h
+#include "tensorflow/lite/c/common.h"
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+#include <string>
+
+// Arduino String on top of std::string, the subset the firmware uses
+class String
+{
+public:
+  String() {}
+  String(const char *value) : text(value ? value : "") {}
+  String(const std::string &value) : text(value) {}
+  explicit String(char value) : text(1, value) {}
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimals = 2);
+  explicit String(double value, unsigned int decimals = 2);
+
+  const char *c_str() const { return text.c_str(); }
+  unsigned int length() const { return text.length(); }
+  bool isEmpty() const { return text.empty(); }
+
+  char charAt(unsigned int index) const { return index < text.length() ? text[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+
+  bool startsWith(const String &prefix) const { return text.compare(0, prefix.text.length(), prefix.text) == 0; }
+  bool endsWith(const String &suffix) const;
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String &s, unsigned int from = 0) const;
+  String substring(unsigned int from) const;
+  String substring(unsigned int from, unsigned int to) const;
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  long toInt() const;
+  float toFloat() const;
+
+  String &operator+=(const String &rhs)
+  {
+    text += rhs.text;
+    return *this;
+  }
+  String &operator+=(const char *rhs)
+  {
+    text += rhs;
+    return *this;
+  }
+  String &operator+=(char rhs)
+  {
+    text += rhs;
+    return *this;
+  }
+
+  bool operator==(const String &rhs) const { return text == rhs.text; }
+  bool operator==(const char *rhs) const { return text == rhs; }
+  bool operator!=(const String &rhs) const { return text != rhs.text; }
+  bool operator!=(const char *rhs) const { return text != rhs; }
+  bool operator<(const String &rhs) const { return text < rhs.text; }
+
+  const std::string &str() const { return text; }
+
+private:
+  std::string text;
+};
+
+inline String operator+(const String &lhs, const String &rhs) { return String(lhs.str() + rhs.str()); }
+inline String operator+(const String &lhs, const char *rhs) { return String(lhs.str() + rhs); }
+inline String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs.str()); }
+inline String operator+(const String &lhs, char rhs) { return String(lhs.str() + rhs); }
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Register reads are answered by the replayed devices (hostI2cRead), writes are ignored
+class TwoWire
+{
+public:
+  bool begin() { return true; }
+  bool begin(int sda, int scl, uint32_t frequency = 0) { return true; }
+  bool setClock(uint32_t frequency) { return true; }
+
+  void beginTransmission(uint8_t address);
+  size_t write(uint8_t data);
+  uint8_t endTransmission(bool send_stop = true);
+  uint8_t requestFrom(uint8_t address, uint8_t quantity);
+  int available();
+  int read();
+
+private:
+  uint8_t address = 0;
+  uint8_t reg = 0;
+  bool reg_written = false;
+  uint8_t rx[32];
+  uint8_t rx_length = 0;
+  uint8_t rx_next = 0;
+};
+
+extern TwoWire Wire;
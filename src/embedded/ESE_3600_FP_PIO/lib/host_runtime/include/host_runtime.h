@@ -0,0 +1,179 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string>
+
+// Linux runtime for the firmware (env:native).
+// Time is virtual: delay() and friends advance a clock instead of sleeping, so setup()/loop()
+// from main.cpp run unmodified and as fast as the host CPU allows.
+//
+// Configured from the environment (or the matching command line flag):
+//   REPMATE_REPLAY       --replay PATH     recorded session (.json) or a directory of them to feed the IMU
+//   REPMATE_REPLAY_GAP   --gap MS          rest time before each replayed session (default 2000)
+//   REPMATE_DURATION     --duration MS     virtual run time (default: end of replay + 5 s, else 60 s)
+//   REPMATE_FS_ROOT      --fs DIR          directory backing LittleFS (default .pio/host_fs)
+//   REPMATE_SERIAL       --serial MODE     "stdio" (default) or "pty" to expose Serial on a pseudo terminal
+//   REPMATE_REALTIME     --realtime        keep virtual time in step with the wall clock
+//   REPMATE_BLE_LOG      --ble-log FILE    pretend a server is in range and log every write to FILE
+//   REPMATE_PIPELINE     --pipeline MODE   inference pipeline: "scheduled" (default), "sleep", "blocking" or "reps"
+//   REPMATE_DECIMATOR    --decimator NAME  model input filter: "boxcar", "sinc" or "cic" (default: the build's)
+//   REPMATE_IMU_PROFILE  --imu-profile P   window acquisition: "oversample" (default) or "model" (imu_provider.h)
+//   REPMATE_IDLE_TIMEOUT --idle-timeout MS no motion for this long puts the device to sleep, 0 never (default: the firmware's)
+//   REPMATE_REPORT       --report FILE     write the simulator report (see below) as JSON
+//   REPMATE_INPUTS       --inputs FILE     write every model input window to FILE, one JSON line each (cache_check.py)
+//
+// Cost model, all default to 0 (free) unless a profile is selected:
+//   REPMATE_PROFILE      --profile NAME    "esp32s3": measured device costs for the three below
+//   REPMATE_IMU_READ_US  --imu-read-us US  virtual time charged per IMU read
+//   REPMATE_INVOKE_US    --invoke-us US    virtual time charged per model Invoke()
+//   REPMATE_SERIAL_BAUD  --serial-baud B   charge Serial and printf output at this UART rate
+
+struct HostConfig
+{
+  std::string replay_path;
+  uint32_t replay_gap_ms;
+  uint32_t duration_ms; // 0 until resolved by hostRuntimeInit()
+  std::string fs_root;
+  bool serial_pty;
+  bool realtime;
+  std::string ble_log;
+  std::string pipeline;
+  std::string decimator;
+  std::string imu_profile;
+  std::string idle_timeout;
+  std::string report_path;
+  std::string inputs_path;
+  uint32_t imu_read_us;
+  uint32_t invoke_us;
+  uint32_t serial_baud;
+};
+
+const HostConfig &hostConfig();
+
+// Reads the configuration and loads the replay; called by the runtime's main()
+void hostRuntimeInit(int argc, char **argv);
+
+// Prints the run summary to stderr and exits; called when virtual time runs out
+[[noreturn]] void hostRuntimeExit();
+
+// Virtual clock
+uint64_t hostMicros();
+void hostSetMicros(uint64_t us);
+void hostAdvanceMicros(uint64_t us);
+
+// What virtual time was spent on. Everything but waiting and light sleep counts as CPU busy.
+enum HostTime
+{
+  HOST_TIME_WAIT,        // delay() and scheduler idle, awake but not running
+  HOST_TIME_LIGHT_SLEEP, // halSleep() with light sleep
+  HOST_TIME_IMU_READ,    // I2C transfers
+  HOST_TIME_INFERENCE,   // Invoke()
+  HOST_TIME_SERIAL,      // Serial/printf bytes on the UART
+  HOST_TIME_LOOP,        // loop() calls that did not advance time themselves
+  HOST_TIME_CATEGORIES
+};
+
+void hostCharge(HostTime category, uint64_t us);
+uint64_t hostSerialMicros(size_t bytes); // UART time for bytes at the configured rate
+uint64_t hostTimeSpent(HostTime category);
+const char *hostTimeName(HostTime category);
+
+// Outputs the simulator measures feedback latency against
+enum HostEvent
+{
+  HOST_EVENT_PIN_WRITE, // digitalWrite() to an output pin (the feedback LEDs)
+  HOST_EVENT_BLE_WRITE, // Packet handed to the BLE server
+  HOST_EVENT_INVOKE,    // MicroInterpreter::Invoke(), counted in the report
+  HOST_EVENT_COUNT
+};
+
+void hostNoteEvent(HostEvent event);
+
+// Reps found by the firmware's segmenter (virtual ms), matched against the replayed sessions in the report
+void hostNoteRep(uint32_t start_ms, uint32_t end_ms);
+
+// A classification of the samples around sample_ms, scored against the class of the session it falls in.
+// Each follows the hostNoteInput() of its window.
+void hostNoteResult(const char *label, uint32_t sample_ms);
+
+// A model input window of count floats, written to --inputs. cached_from is the number of the earlier
+// window whose result the firmware's result cache reused, -1 if Invoke() ran on this one.
+void hostNoteInput(const float *input, size_t count, long cached_from);
+
+// The firmware's power state machine entered state (power.h), the report totals time in each state
+void hostNotePowerState(const char *state);
+
+// GPIO state, outputs written by the firmware and inputs driven by the host
+bool hostPinLevel(uint8_t pin);
+void hostSetPinInput(uint8_t pin, bool high);
+
+// Wires an input pin to a simulated device: digitalRead() returns source() from then on
+typedef bool (*HostPinSource)();
+void hostSetPinSource(uint8_t pin, HostPinSource source);
+
+const int HOST_PIN_COUNT = 64;
+
+// IMU replay, readings in m/s^2 and rad/s as the Adafruit driver reports them
+struct HostReplaySession
+{
+  std::string path;
+  std::string lift;
+  std::string lift_class;
+  uint32_t start_ms; // Virtual time of the first sample
+  uint32_t end_ms;   // Virtual time of the last sample
+};
+
+bool hostReplayLoad(const std::string &path);
+size_t hostReplaySessionCount();
+const HostReplaySession &hostReplaySession(size_t index);
+uint32_t hostReplayEndMs();
+
+// Zero-order hold of the replay at now_ms; a device lying flat outside of sessions
+void hostImuRead(uint32_t now_ms, float accel[3], float gyro[3]);
+
+// The same without counting as a read, for the sensor's own motion detector
+void hostImuPeek(uint32_t now_ms, float accel[3], float gyro[3]);
+
+// Level of the MPU6050's INT pin, driven by its motion detector (Adafruit_MPU6050.h)
+bool hostMpuInterruptLine();
+
+// Register read from an I2C device: length bytes from reg on. Only the MPU6050's data registers
+// (0x3B-0x48) hold anything, encoded at the ranges set through Adafruit_MPU6050. With length 0 it
+// only checks that a device answers at address.
+bool hostI2cRead(uint8_t address, uint8_t reg, uint8_t *data, size_t length);
+
+// Replay coverage: samples in all sessions, distinct samples read, and reads that returned
+// a sample that had already been read. transfers counts every read, rest gaps included, one
+// I2C transaction each.
+struct HostReplayCoverage
+{
+  uint64_t samples;
+  uint64_t read;
+  uint64_t duplicates;
+  uint64_t transfers;
+};
+
+HostReplayCoverage hostReplayCoverage();
+
+// Heap use by the firmware, counted by replacing operator new/delete and measured from the start of
+// setup() so the runtime's own replay data is left out. Free space is reported against
+// HOST_HEAP_BUDGET, roughly the internal heap an ESP32-S3 has left once the firmware's statics are placed.
+const uint32_t HOST_HEAP_BUDGET = 280 * 1024;
+
+struct HostHeapStats
+{
+  uint32_t budget;
+  uint32_t live;        // Bytes allocated since the baseline and not yet freed
+  uint32_t peak;        // Highest live since the baseline
+  uint64_t allocations; // Every operator new call, including the runtime's own
+};
+
+void hostHeapMarkBaseline();
+HostHeapStats hostHeapStats();
+
+// Simulator report: feedback latency after each replayed session ends, where the time went,
+// and how much of the replay the firmware actually sampled. Printed to stderr at exit and
+// written to --report as JSON.
+void hostWriteReport(FILE *out, bool json);
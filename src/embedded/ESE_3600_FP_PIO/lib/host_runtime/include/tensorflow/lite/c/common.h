@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum
+{
+  kTfLiteOk = 0,
+  kTfLiteError = 1,
+} TfLiteStatus;
+
+typedef enum
+{
+  kTfLiteNoType = 0,
+  kTfLiteFloat32 = 1,
+  kTfLiteInt32 = 2,
+  kTfLiteUInt8 = 3,
+  kTfLiteInt64 = 4,
+  kTfLiteString = 5,
+  kTfLiteBool = 6,
+  kTfLiteInt16 = 7,
+  kTfLiteComplex64 = 8,
+  kTfLiteInt8 = 9,
+} TfLiteType;
+
+const int kTfLiteMaxDims = 8;
+
+typedef struct
+{
+  int size;
+  int data[kTfLiteMaxDims];
+} TfLiteIntArray;
+
+typedef struct
+{
+  float scale;
+  int32_t zero_point;
+} TfLiteQuantizationParams;
+
+typedef union
+{
+  int32_t *i32;
+  int64_t *i64;
+  float *f;
+  char *raw;
+  uint8_t *uint8;
+  int16_t *i16;
+  int8_t *int8;
+  void *data;
+} TfLitePtrUnion;
+
+typedef struct
+{
+  TfLiteType type;
+  TfLitePtrUnion data;
+  TfLiteIntArray *dims;
+  TfLiteQuantizationParams params;
+  size_t bytes;
+} TfLiteTensor;
@@ -0,0 +1,9 @@
+#pragma once
+
+namespace tflite
+{
+  // The host interpreter does not execute operators, nothing to register
+  class AllOpsResolver
+  {
+  };
+}
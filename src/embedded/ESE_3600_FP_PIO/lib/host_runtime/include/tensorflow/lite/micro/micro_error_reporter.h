@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdarg.h>
+
+namespace tflite
+{
+  class ErrorReporter
+  {
+  public:
+    virtual ~ErrorReporter() {}
+    virtual int Report(const char *format, va_list args) = 0;
+    int Report(const char *format, ...);
+  };
+
+  class MicroErrorReporter : public ErrorReporter
+  {
+  public:
+    int Report(const char *format, va_list args) override;
+    using ErrorReporter::Report;
+  };
+}
+
+#define TF_LITE_REPORT_ERROR(reporter, ...) (reporter)->Report(__VA_ARGS__)
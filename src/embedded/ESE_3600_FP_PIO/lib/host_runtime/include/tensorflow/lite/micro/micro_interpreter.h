@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tensorflow/lite/c/common.h"
+#include "tensorflow/lite/micro/all_ops_resolver.h"
+#include "tensorflow/lite/micro/micro_error_reporter.h"
+#include "tensorflow/lite/schema/schema_generated.h"
+
+namespace tflite
+{
+  const int kHostMaxIoTensors = 4;
+
+  class TensorIndexList
+  {
+  public:
+    size_t size() const { return count; }
+    int operator[](size_t i) const { return indices[i]; }
+
+    int indices[kHostMaxIoTensors];
+    size_t count = 0;
+  };
+
+  // Host interpreter. Input/output tensors are read from the model flatbuffer and placed in
+  // the arena like the real one does, but the graph is not executed: Invoke() scores the input
+  // against the reference windows in data.cpp (nearest class wins) and charges
+  // REPMATE_INVOKE_US of virtual time. Good enough to drive the pipeline, not for accuracy.
+  class MicroInterpreter
+  {
+  public:
+    MicroInterpreter(const Model *model, const AllOpsResolver &resolver, uint8_t *tensor_arena,
+                     size_t tensor_arena_size, ErrorReporter *error_reporter);
+
+    TfLiteStatus AllocateTensors();
+    TfLiteStatus Invoke();
+
+    TfLiteTensor *input(size_t index);
+    TfLiteTensor *output(size_t index);
+    const TensorIndexList &inputs() const { return input_list; }
+    const TensorIndexList &outputs() const { return output_list; }
+    size_t arena_used_bytes() const { return arena_used; }
+
+  private:
+    const Model *model;
+    uint8_t *arena;
+    size_t arena_size;
+    size_t arena_used = 0;
+    ErrorReporter *error_reporter;
+
+    TensorIndexList input_list;
+    TensorIndexList output_list;
+    TfLiteTensor tensors[2 * kHostMaxIoTensors];
+    TfLiteIntArray dims[2 * kHostMaxIoTensors];
+  };
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace tflite
+{
+  inline void InitializeTarget() {}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#define TFLITE_SCHEMA_VERSION (3)
+
+#include <stdint.h>
+
+namespace tflite
+{
+  // Read-only view of a .tflite flatbuffer
+  class Model
+  {
+  public:
+    uint32_t version() const;
+  };
+
+  const Model *GetModel(const void *buffer);
+}
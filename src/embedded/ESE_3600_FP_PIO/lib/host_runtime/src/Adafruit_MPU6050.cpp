@@ -0,0 +1,177 @@
+#include <Adafruit_MPU6050.h>
+#include <Arduino.h>
+
+// Full-scale limits, the sensor saturates instead of reporting larger values
+static const float accel_limits[4] = {2 * SENSORS_GRAVITY_STANDARD, 4 * SENSORS_GRAVITY_STANDARD,
+                                      8 * SENSORS_GRAVITY_STANDARD, 16 * SENSORS_GRAVITY_STANDARD};
+static const float gyro_limits_dps[4] = {250, 500, 1000, 2000};
+
+// Counts per g and per deg/s for the raw registers
+static const float accel_counts_per_g[4] = {16384, 8192, 4096, 2048};
+static const float gyro_counts_per_dps[4] = {131, 65.5f, 32.8f, 16.4f};
+
+static const uint8_t ACCEL_XOUT_H = 0x3B;
+static const uint8_t DATA_REGISTERS = 14;
+
+// Corner frequencies of the high-pass settings the motion detector sees, 0 for none
+static const float highpass_hz[7] = {0, 5, 2.5f, 1.25f, 0.63f, 0, 0};
+static const float MOTION_G_PER_LSB = 0.002f; // MOT_THR
+
+// The sensor whose registers hostI2cRead() serves
+static Adafruit_MPU6050 *active = nullptr;
+
+// Motion detector state, stepped one 1 kHz sample at a time up to the present when asked
+struct MotionDetector
+{
+  bool primed;
+  uint32_t next_ms; // First sample not yet looked at
+  float baseline[3]; // What the high-pass filter takes away
+  uint32_t run_ms;   // Samples above the threshold in a row
+  bool detected;     // INT_STATUS MOT_INT
+};
+
+static MotionDetector motion = {};
+
+bool Adafruit_MPU6050::begin(uint8_t i2c_address, TwoWire *wire, int32_t sensor_id)
+{
+  (void)i2c_address;
+  (void)wire;
+  (void)sensor_id;
+  active = this;
+  return true;
+}
+
+// The chip's latest sample, clipped to the full-scale ranges, in m/s^2 and rad/s
+static void latestSample(Adafruit_MPU6050 *sensor, float a[3], float g[3])
+{
+  // The data registers only change once per sample period
+  uint32_t period_ms = 1 + sensor->getSampleRateDivisor();
+  uint32_t now_ms = millis();
+  hostImuRead(now_ms - now_ms % period_ms, a, g);
+
+  float accel_limit = accel_limits[sensor->getAccelerometerRange()];
+  float gyro_limit = gyro_limits_dps[sensor->getGyroRange()] * (float)M_PI / 180.0f;
+  for (int i = 0; i < 3; i++)
+  {
+    a[i] = std::max(-accel_limit, std::min(accel_limit, a[i]));
+    g[i] = std::max(-gyro_limit, std::min(gyro_limit, g[i]));
+  }
+}
+
+static void updateMotion(Adafruit_MPU6050 *sensor)
+{
+  if (!sensor->getMotionInterruptEnabled())
+    return;
+  uint32_t now_ms = millis();
+  float a[3], g[3];
+  if (!motion.primed)
+  {
+    hostImuPeek(now_ms, a, g);
+    memcpy(motion.baseline, a, sizeof(a));
+    motion.next_ms = now_ms;
+    motion.run_ms = 0;
+    motion.primed = true;
+  }
+
+  mpu6050_highpass_t highpass = sensor->getHighPassFilter();
+  float corner_hz = highpass_hz[highpass];
+  float alpha = corner_hz > 0 ? 1.0f / (1.0f + 1000.0f / (2.0f * (float)M_PI * corner_hz)) : 0.0f; // One 1 ms step
+  float threshold = sensor->getMotionDetectionThreshold() * MOTION_G_PER_LSB * SENSORS_GRAVITY_STANDARD;
+  uint32_t duration = std::max<uint32_t>(1, sensor->getMotionDetectionDuration());
+  for (; (int32_t)(now_ms - motion.next_ms) >= 0; motion.next_ms++)
+  {
+    hostImuPeek(motion.next_ms, a, g);
+    bool above = false;
+    for (int i = 0; i < 3; i++)
+    {
+      float reference = highpass == MPU6050_HIGHPASS_DISABLE ? 0.0f : motion.baseline[i];
+      above |= fabsf(a[i] - reference) > threshold;
+      motion.baseline[i] += (a[i] - motion.baseline[i]) * alpha; // Stays put in HOLD
+    }
+    motion.run_ms = above ? motion.run_ms + 1 : 0;
+    if (motion.run_ms >= duration)
+      motion.detected = true;
+    else if (!sensor->getInterruptPinLatch())
+      motion.detected = false;
+  }
+}
+
+void Adafruit_MPU6050::setMotionInterrupt(bool active)
+{
+  motion_interrupt = active;
+  motion = {};
+}
+
+bool Adafruit_MPU6050::getMotionInterruptStatus()
+{
+  updateMotion(this);
+  bool detected = motion.detected;
+  if (interrupt_latch)
+    motion.detected = false; // Reading INT_STATUS clears the latched line
+  // A one-byte register read, about a quarter of the 14-byte data burst
+  hostCharge(HOST_TIME_IMU_READ, hostConfig().imu_read_us / 4);
+  return detected;
+}
+
+bool hostMpuInterruptLine()
+{
+  if (active == nullptr)
+    return false;
+  updateMotion(active);
+  return motion.detected != active->getInterruptPinPolarity();
+}
+
+bool Adafruit_MPU6050::getEvent(sensors_event_t *accel, sensors_event_t *gyro, sensors_event_t *temp)
+{
+  float a[3], g[3];
+  latestSample(this, a, g);
+
+  int32_t timestamp = millis();
+  *accel = {};
+  accel->timestamp = timestamp;
+  accel->acceleration = {a[0], a[1], a[2]};
+  *gyro = {};
+  gyro->timestamp = timestamp;
+  gyro->gyro = {g[0], g[1], g[2]};
+  *temp = {};
+  temp->timestamp = timestamp;
+  temp->temperature = 25.0f;
+
+  // Time the I2C transfer would take on the device
+  hostCharge(HOST_TIME_IMU_READ, hostConfig().imu_read_us);
+  return true;
+}
+
+static int16_t toCounts(float value, float counts_per_unit)
+{
+  float counts = roundf(value * counts_per_unit);
+  return (int16_t)std::max(-32768.0f, std::min(32767.0f, counts));
+}
+
+bool hostI2cRead(uint8_t address, uint8_t reg, uint8_t *data, size_t length)
+{
+  if (address != MPU6050_I2CADDR_DEFAULT || active == nullptr)
+    return false;
+  if (length == 0)
+    return true;
+
+  float a[3], g[3];
+  latestSample(active, a, g);
+  int16_t words[DATA_REGISTERS / 2];
+  for (int i = 0; i < 3; i++)
+  {
+    words[i] = toCounts(a[i], accel_counts_per_g[active->getAccelerometerRange()] / SENSORS_GRAVITY_STANDARD);
+    words[4 + i] = toCounts(g[i], gyro_counts_per_dps[active->getGyroRange()] / SENSORS_DPS_TO_RADS);
+  }
+  words[3] = toCounts(25.0f - 36.53f, 340); // Datasheet: degrees C = counts / 340 + 36.53
+
+  for (size_t i = 0; i < length; i++)
+  {
+    int offset = reg - ACCEL_XOUT_H + (int)i;
+    uint16_t word = offset >= 0 && offset < DATA_REGISTERS ? (uint16_t)words[offset / 2] : 0;
+    data[i] = offset % 2 == 0 ? word >> 8 : word & 0xFF;
+  }
+
+  hostCharge(HOST_TIME_IMU_READ, hostConfig().imu_read_us);
+  return true;
+}
@@ -0,0 +1,137 @@
+#include <Arduino.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long baud)
+{
+  (void)baud;
+  if (fd_out >= 0)
+    return;
+
+  if (!hostConfig().serial_pty)
+  {
+    fd_out = STDOUT_FILENO;
+    fd_in = STDIN_FILENO;
+    return;
+  }
+
+  int master = posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+  {
+    fprintf(stderr, "host: could not open a pty for Serial (%s), using stdio\n", strerror(errno));
+    fd_out = STDOUT_FILENO;
+    fd_in = STDIN_FILENO;
+    return;
+  }
+
+  // Raw bytes both ways, like the USB CDC port
+  struct termios attributes;
+  if (tcgetattr(master, &attributes) == 0)
+  {
+    cfmakeraw(&attributes);
+    tcsetattr(master, TCSANOW, &attributes);
+  }
+  fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+  fd_out = fd_in = master;
+  fprintf(stderr, "host: Serial is on %s\n", ptsname(master));
+}
+
+// Moves whatever the other side has sent into the input buffer, never blocks
+void HardwareSerial::pump()
+{
+  if (fd_in < 0)
+    begin(115200);
+
+  struct pollfd pending = {fd_in, POLLIN, 0};
+  while (poll(&pending, 1, 0) > 0 && (pending.revents & POLLIN))
+  {
+    char buffer[256];
+    ssize_t n = ::read(fd_in, buffer, sizeof(buffer));
+    if (n <= 0)
+      break;
+    input.append(buffer, n);
+  }
+}
+
+int HardwareSerial::available()
+{
+  pump();
+  return input.size();
+}
+
+int HardwareSerial::read()
+{
+  pump();
+  if (input.empty())
+    return -1;
+  int c = (uint8_t)input[0];
+  input.erase(0, 1);
+  return c;
+}
+
+int HardwareSerial::peek()
+{
+  pump();
+  return input.empty() ? -1 : (uint8_t)input[0];
+}
+
+String HardwareSerial::readString()
+{
+  return readStringUntil('\0');
+}
+
+// Like Stream::readStringUntil, gives up after the timeout (virtual time)
+String HardwareSerial::readStringUntil(char terminator)
+{
+  unsigned long start = millis();
+  size_t end;
+  while ((end = input.find(terminator)) == std::string::npos && millis() - start < timeout)
+  {
+    pump();
+    if (input.find(terminator) == std::string::npos)
+      delay(1);
+  }
+  end = input.find(terminator);
+  String line(input.substr(0, end));
+  input.erase(0, end == std::string::npos ? input.size() : end + 1);
+  return line;
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+  if (fd_out < 0)
+    begin(115200);
+
+  // printf() from the firmware shares stdout, keep the two in order
+  if (fd_out == STDOUT_FILENO)
+    fflush(stdout);
+
+  size_t sent = 0;
+  while (sent < size)
+  {
+    ssize_t n = ::write(fd_out, buffer + sent, size - sent);
+    if (n < 0 && errno == EAGAIN)
+    {
+      // Nobody reading the pty yet, the device would drop the bytes too
+      break;
+    }
+    if (n <= 0)
+      break;
+    sent += n;
+  }
+  written += size;
+  hostCharge(HOST_TIME_SERIAL, hostSerialMicros(size));
+  return size;
+}
+
+void HardwareSerial::flush()
+{
+  if (fd_out == STDOUT_FILENO)
+    fflush(stdout);
+}
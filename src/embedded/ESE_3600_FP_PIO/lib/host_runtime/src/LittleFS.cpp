@@ -0,0 +1,273 @@
+#include <LittleFS.h>
+#include <Arduino.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <stdio.h>
+#include <vector>
+
+namespace stdfs = std::filesystem;
+
+LittleFSFS LittleFS;
+
+// Default partition table of the XIAO ESP32S3 (spiffs partition at 0x290000)
+const size_t HOST_FS_DEFAULT_BYTES = 0x160000;
+
+namespace fs
+{
+  struct FileImpl
+  {
+    std::string path; // Path on the device, "/p_f/d0.json"
+    std::string name;
+    FILE *file = nullptr;
+    bool directory = false;
+    std::vector<std::string> entries; // Sorted, as LittleFS lists them
+    size_t next_entry = 0;
+
+    ~FileImpl()
+    {
+      if (file)
+        fclose(file);
+    }
+  };
+}
+
+static stdfs::path hostPath(const char *path)
+{
+  std::string relative = path ? path : "";
+  while (!relative.empty() && relative[0] == '/')
+    relative.erase(0, 1);
+  return stdfs::path(hostConfig().fs_root) / relative;
+}
+
+static size_t fileSize(const stdfs::path &path)
+{
+  std::error_code error;
+  return stdfs::is_regular_file(path, error) ? (size_t)stdfs::file_size(path, error) : 0;
+}
+
+bool LittleFSFS::begin(bool format_on_fail, const char *base_path, uint8_t max_open_files, const char *partition_label)
+{
+  (void)format_on_fail;
+  (void)base_path;
+  (void)max_open_files;
+  (void)partition_label;
+
+  std::error_code error;
+  stdfs::create_directories(hostConfig().fs_root, error);
+  if (error)
+  {
+    fprintf(stderr, "host: cannot create LittleFS root %s: %s\n", hostConfig().fs_root.c_str(), error.message().c_str());
+    return false;
+  }
+
+  total_bytes = HOST_FS_DEFAULT_BYTES;
+  used_bytes = 0;
+  for (const auto &entry : stdfs::recursive_directory_iterator(hostConfig().fs_root, error))
+  {
+    if (entry.is_regular_file())
+      used_bytes += entry.file_size();
+  }
+  mounted = true;
+  return true;
+}
+
+bool LittleFSFS::format()
+{
+  std::error_code error;
+  stdfs::remove_all(hostConfig().fs_root, error);
+  stdfs::create_directories(hostConfig().fs_root, error);
+  used_bytes = 0;
+  mounted = false;
+  return !error;
+}
+
+bool LittleFSFS::reserve(size_t bytes)
+{
+  if (used_bytes + bytes > total_bytes)
+    return false;
+  used_bytes += bytes;
+  return true;
+}
+
+void LittleFSFS::release(size_t bytes)
+{
+  used_bytes -= std::min(bytes, used_bytes);
+}
+
+File LittleFSFS::open(const char *path, const char *mode, bool create)
+{
+  if (!mounted || path == nullptr || path[0] != '/')
+    return File();
+
+  stdfs::path host = hostPath(path);
+  auto impl = std::make_shared<fs::FileImpl>();
+  impl->path = path;
+  impl->name = stdfs::path(path).filename().string();
+
+  std::error_code error;
+  if (stdfs::is_directory(host, error))
+  {
+    impl->directory = true;
+    for (const auto &entry : stdfs::directory_iterator(host, error))
+      impl->entries.push_back(entry.path().filename().string());
+    std::sort(impl->entries.begin(), impl->entries.end());
+    return File(impl);
+  }
+
+  bool writing = mode[0] == 'w' || mode[0] == 'a';
+  if (!writing && !stdfs::exists(host, error))
+    return File();
+
+  if (writing && create)
+    stdfs::create_directories(host.parent_path(), error);
+  if (mode[0] == 'w')
+    release(fileSize(host));
+
+  std::string fopen_mode = std::string(mode[0] == 'w' ? "w" : mode[0] == 'a' ? "a" : "r") + "b" + (strchr(mode, '+') ? "+" : "");
+  impl->file = fopen(host.c_str(), fopen_mode.c_str());
+  if (impl->file == nullptr)
+    return File();
+  return File(impl);
+}
+
+bool LittleFSFS::exists(const char *path)
+{
+  std::error_code error;
+  return mounted && stdfs::exists(hostPath(path), error);
+}
+
+bool LittleFSFS::mkdir(const char *path)
+{
+  std::error_code error;
+  if (!mounted)
+    return false;
+  stdfs::create_directory(hostPath(path), error);
+  return !error;
+}
+
+bool LittleFSFS::remove(const char *path)
+{
+  std::error_code error;
+  stdfs::path host = hostPath(path);
+  size_t size = fileSize(host);
+  if (!mounted || !stdfs::remove(host, error))
+    return false;
+  release(size);
+  return true;
+}
+
+bool LittleFSFS::rename(const char *from, const char *to)
+{
+  std::error_code error;
+  if (!mounted)
+    return false;
+  stdfs::rename(hostPath(from), hostPath(to), error);
+  return !error;
+}
+
+bool LittleFSFS::rmdir(const char *path)
+{
+  std::error_code error;
+  stdfs::path host = hostPath(path);
+  return mounted && stdfs::is_directory(host, error) && stdfs::is_empty(host, error) && stdfs::remove(host, error);
+}
+
+namespace fs
+{
+  size_t File::write(const uint8_t *buffer, size_t size)
+  {
+    if (!impl || !impl->file || !LittleFS.reserve(size))
+      return 0;
+    return fwrite(buffer, 1, size, impl->file);
+  }
+
+  void File::flush()
+  {
+    if (impl && impl->file)
+      fflush(impl->file);
+  }
+
+  int File::available()
+  {
+    if (!impl || !impl->file)
+      return 0;
+    return (int)(size() - position());
+  }
+
+  int File::read()
+  {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+
+  size_t File::read(uint8_t *buffer, size_t size)
+  {
+    if (!impl || !impl->file)
+      return 0;
+    return fread(buffer, 1, size, impl->file);
+  }
+
+  bool File::seek(uint32_t position)
+  {
+    return impl && impl->file && fseek(impl->file, position, SEEK_SET) == 0;
+  }
+
+  size_t File::position() const
+  {
+    if (!impl || !impl->file)
+      return 0;
+    long position = ftell(impl->file);
+    return position < 0 ? 0 : (size_t)position;
+  }
+
+  size_t File::size() const
+  {
+    if (!impl || !impl->file)
+      return 0;
+    fflush(impl->file);
+    return fileSize(hostPath(impl->path.c_str()));
+  }
+
+  void File::close()
+  {
+    impl.reset();
+  }
+
+  const char *File::path() const
+  {
+    return impl ? impl->path.c_str() : nullptr;
+  }
+
+  const char *File::name() const
+  {
+    return impl ? impl->name.c_str() : nullptr;
+  }
+
+  bool File::isDirectory() const
+  {
+    return impl && impl->directory;
+  }
+
+  File File::openNextFile(const char *mode)
+  {
+    if (!impl || !impl->directory || impl->next_entry >= impl->entries.size())
+      return File();
+    std::string child = impl->path;
+    if (child.empty() || child.back() != '/')
+      child += '/';
+    child += impl->entries[impl->next_entry++];
+    return LittleFS.open(child.c_str(), mode);
+  }
+
+  void File::rewindDirectory()
+  {
+    if (impl)
+      impl->next_entry = 0;
+  }
+
+  File::operator bool() const
+  {
+    return impl && (impl->directory || impl->file);
+  }
+}
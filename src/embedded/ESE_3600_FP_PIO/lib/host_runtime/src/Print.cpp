@@ -0,0 +1,62 @@
+#include "Print.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--)
+  {
+    if (!write(*buffer++))
+      break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::write(const char *text)
+{
+  return text ? write((const uint8_t *)text, strlen(text)) : 0;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+  char stack_buffer[128];
+  va_list args;
+  va_start(args, format);
+  va_list copy;
+  va_copy(copy, args);
+  int length = vsnprintf(stack_buffer, sizeof(stack_buffer), format, copy);
+  va_end(copy);
+  if (length < 0)
+  {
+    va_end(args);
+    return 0;
+  }
+  if ((size_t)length < sizeof(stack_buffer))
+  {
+    va_end(args);
+    return write((const uint8_t *)stack_buffer, length);
+  }
+  std::vector<char> buffer(length + 1);
+  vsnprintf(buffer.data(), buffer.size(), format, args);
+  va_end(args);
+  return write((const uint8_t *)buffer.data(), length);
+}
+
+size_t Print::print(long value, int base)
+{
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long value, int base)
+{
+  return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(double value, int digits)
+{
+  return print(String(value, (unsigned int)digits));
+}
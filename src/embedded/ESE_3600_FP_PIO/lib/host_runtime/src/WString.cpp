@@ -0,0 +1,102 @@
+#include "WString.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static std::string formatInteger(unsigned long value, unsigned char base, bool negative)
+{
+  if (base < 2 || base > 36)
+    base = 10;
+  std::string digits;
+  do
+  {
+    int digit = value % base;
+    digits.insert(digits.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+    value /= base;
+  } while (value);
+  return negative ? "-" + digits : digits;
+}
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base)
+    : text(base == 10 && value < 0 ? formatInteger(-(unsigned long)value, base, true) : formatInteger((unsigned long)value, base, false))
+{
+}
+
+String::String(unsigned long value, unsigned char base) : text(formatInteger(value, base, false)) {}
+
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned int decimals)
+{
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, value);
+  text = buffer;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+  return text.length() >= suffix.text.length() &&
+         text.compare(text.length() - suffix.text.length(), suffix.text.length(), suffix.text) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+  size_t found = text.find(c, from);
+  return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::indexOf(const String &s, unsigned int from) const
+{
+  size_t found = text.find(s.text, from);
+  return found == std::string::npos ? -1 : (int)found;
+}
+
+String String::substring(unsigned int from) const
+{
+  return from >= text.length() ? String() : String(text.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to)
+    std::swap(from, to);
+  if (from >= text.length())
+    return String();
+  return String(text.substr(from, to - from));
+}
+
+void String::trim()
+{
+  size_t start = 0;
+  while (start < text.length() && isspace((unsigned char)text[start]))
+    start++;
+  size_t end = text.length();
+  while (end > start && isspace((unsigned char)text[end - 1]))
+    end--;
+  text = text.substr(start, end - start);
+}
+
+void String::toLowerCase()
+{
+  for (char &c : text)
+    c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+  for (char &c : text)
+    c = toupper((unsigned char)c);
+}
+
+long String::toInt() const
+{
+  return strtol(text.c_str(), nullptr, 10);
+}
+
+float String::toFloat() const
+{
+  return strtof(text.c_str(), nullptr);
+}
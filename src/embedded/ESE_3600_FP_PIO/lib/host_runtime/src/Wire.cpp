@@ -0,0 +1,44 @@
+#include <Wire.h>
+#include "host_runtime.h"
+
+void TwoWire::beginTransmission(uint8_t target)
+{
+  address = target;
+  reg_written = false;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+  // The first byte selects the register, the rest would be written to it
+  if (!reg_written)
+  {
+    reg = data;
+    reg_written = true;
+  }
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool send_stop)
+{
+  (void)send_stop;
+  return hostI2cRead(address, reg, nullptr, 0) ? 0 : 2; // 2: address NACK
+}
+
+uint8_t TwoWire::requestFrom(uint8_t target, uint8_t quantity)
+{
+  if (quantity > sizeof(rx))
+    quantity = sizeof(rx);
+  rx_next = 0;
+  rx_length = hostI2cRead(target, reg, rx, quantity) ? quantity : 0;
+  return rx_length;
+}
+
+int TwoWire::available()
+{
+  return rx_length - rx_next;
+}
+
+int TwoWire::read()
+{
+  return rx_next < rx_length ? rx[rx_next++] : -1;
+}
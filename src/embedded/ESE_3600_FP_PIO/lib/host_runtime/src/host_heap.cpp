@@ -0,0 +1,73 @@
+#include "host_runtime.h"
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <atomic>
+#include <new>
+
+// Heap accounting through the replaceable operator new/delete. Everything the firmware allocates goes
+// through them (String, new[], the BLE and filesystem objects); plain malloc() is not counted.
+
+static std::atomic<uint64_t> live(0);
+static std::atomic<uint64_t> peak(0);
+static std::atomic<uint64_t> allocations(0);
+static uint64_t baseline = 0;
+
+static void *allocate(size_t size)
+{
+  void *block = malloc(size ? size : 1);
+  if (block == nullptr)
+    throw std::bad_alloc();
+  uint64_t now = live += malloc_usable_size(block);
+  allocations++;
+  uint64_t seen = peak.load();
+  while (now > seen && !peak.compare_exchange_weak(seen, now))
+  {
+  }
+  return block;
+}
+
+static void release(void *block)
+{
+  if (block == nullptr)
+    return;
+  live -= malloc_usable_size(block);
+  free(block);
+}
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+  try
+  {
+    return allocate(size);
+  }
+  catch (const std::bad_alloc &)
+  {
+    return nullptr;
+  }
+}
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept { return operator new(size, tag); }
+void operator delete(void *block) noexcept { release(block); }
+void operator delete[](void *block) noexcept { release(block); }
+void operator delete(void *block, size_t) noexcept { release(block); }
+void operator delete[](void *block, size_t) noexcept { release(block); }
+
+void hostHeapMarkBaseline()
+{
+  baseline = live.load();
+  peak.store(baseline);
+}
+
+HostHeapStats hostHeapStats()
+{
+  uint64_t now = live.load();
+  uint64_t high = peak.load();
+  HostHeapStats stats;
+  stats.budget = HOST_HEAP_BUDGET;
+  stats.live = now > baseline ? now - baseline : 0;
+  stats.peak = high > baseline ? high - baseline : 0;
+  stats.allocations = allocations.load();
+  return stats;
+}
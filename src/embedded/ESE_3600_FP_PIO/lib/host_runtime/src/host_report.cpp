@@ -0,0 +1,337 @@
+#include "host_runtime.h"
+
+#include <algorithm>
+#include <stdlib.h>
+#include <vector>
+
+static std::vector<uint64_t> event_times[HOST_EVENT_COUNT];
+static std::vector<std::pair<uint32_t, uint32_t>> rep_spans;
+static std::vector<std::pair<std::string, uint32_t>> results;
+static std::vector<std::pair<std::string, uint64_t>> power_states; // State entered, virtual us
+
+void hostNoteEvent(HostEvent event)
+{
+  event_times[event].push_back(hostMicros());
+}
+
+void hostNoteRep(uint32_t start_ms, uint32_t end_ms)
+{
+  rep_spans.push_back({start_ms, end_ms});
+}
+
+void hostNoteResult(const char *label, uint32_t sample_ms)
+{
+  results.push_back({label, sample_ms});
+}
+
+void hostNoteInput(const float *input, size_t count, long cached_from)
+{
+  static FILE *inputs = nullptr;
+  static long windows = 0;
+  const std::string &path = hostConfig().inputs_path;
+  if (path.empty())
+    return;
+  if (inputs == nullptr && (inputs = fopen(path.c_str(), "w")) == nullptr)
+  {
+    fprintf(stderr, "host: cannot write %s\n", path.c_str());
+    exit(1);
+  }
+  // %.9g round-trips a float exactly; exit() flushes the stream
+  fprintf(inputs, "{\"window\": %ld, \"ms\": %.3f, \"cached_from\": %ld, \"input\": [", windows++,
+          hostMicros() / 1000.0, cached_from);
+  for (size_t i = 0; i < count; i++)
+    fprintf(inputs, i ? ", %.9g" : "%.9g", input[i]);
+  fprintf(inputs, "]}\n");
+}
+
+void hostNotePowerState(const char *state)
+{
+  power_states.push_back({state, hostMicros()});
+}
+
+// Replayed session whose samples span ms, -1 for the rest gaps
+static long sessionAt(uint32_t ms)
+{
+  size_t i = 0;
+  while (i < hostReplaySessionCount() && hostReplaySession(i).end_ms < ms)
+    i++;
+  if (i < hostReplaySessionCount() && hostReplaySession(i).start_ms <= ms)
+    return (long)i;
+  return -1;
+}
+
+struct ClassificationSummary
+{
+  size_t results;
+  size_t in_session; // Results whose samples were inside a session
+  size_t correct;    // ... that matched the session's recorded class
+};
+
+static ClassificationSummary classificationSummary()
+{
+  ClassificationSummary summary = {results.size(), 0, 0};
+  for (const auto &result : results)
+  {
+    long session = sessionAt(result.second);
+    if (session < 0)
+      continue;
+    summary.in_session++;
+    if (result.first == hostReplaySession(session).lift_class)
+      summary.correct++;
+  }
+  return summary;
+}
+
+struct RepSummary
+{
+  size_t detected;
+  size_t sessions_none; // Replayed sessions without a rep
+  size_t sessions_one;
+  size_t sessions_more;
+  size_t outside; // Reps centred in a rest gap
+};
+
+// Each rep belongs to the session its midpoint falls in, a recording holds about one rep
+static RepSummary repSummary()
+{
+  std::vector<size_t> per_session(hostReplaySessionCount(), 0);
+  RepSummary summary = {rep_spans.size(), 0, 0, 0, 0};
+  for (const auto &span : rep_spans)
+  {
+    long session = sessionAt(span.first + (span.second - span.first) / 2);
+    if (session >= 0)
+      per_session[session]++;
+    else
+      summary.outside++;
+  }
+  for (size_t count : per_session)
+  {
+    if (count == 0)
+      summary.sessions_none++;
+    else if (count == 1)
+      summary.sessions_one++;
+    else
+      summary.sessions_more++;
+  }
+  return summary;
+}
+
+struct LatencySummary
+{
+  size_t sessions; // Sessions that got feedback before the run ended
+  size_t missing;  // Sessions that did not
+  double p50_ms;
+  double p90_ms;
+  double p99_ms;
+  double max_ms;
+};
+
+static double percentile(const std::vector<double> &sorted, double p)
+{
+  if (sorted.empty())
+    return 0;
+  size_t rank = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[std::min(rank, sorted.size() - 1)];
+}
+
+// Time from the end of each replayed session to the first event of this kind at or after it
+static LatencySummary feedbackLatency(HostEvent event)
+{
+  const std::vector<uint64_t> &times = event_times[event];
+  std::vector<double> latencies;
+  LatencySummary summary = {0, 0, 0, 0, 0, 0};
+  for (size_t i = 0; i < hostReplaySessionCount(); i++)
+  {
+    uint64_t end_us = (uint64_t)hostReplaySession(i).end_ms * 1000;
+    auto next = std::lower_bound(times.begin(), times.end(), end_us);
+    if (next == times.end())
+    {
+      summary.missing++;
+      continue;
+    }
+    latencies.push_back((*next - end_us) / 1000.0);
+  }
+  std::sort(latencies.begin(), latencies.end());
+  summary.sessions = latencies.size();
+  summary.p50_ms = percentile(latencies, 50);
+  summary.p90_ms = percentile(latencies, 90);
+  summary.p99_ms = percentile(latencies, 99);
+  summary.max_ms = latencies.empty() ? 0 : latencies.back();
+  return summary;
+}
+
+struct PowerStateTime
+{
+  std::string state;
+  uint64_t us;
+  size_t entered;
+};
+
+struct PowerSummary
+{
+  std::vector<PowerStateTime> states; // In the order they first appeared
+  size_t sessions_asleep;             // Replayed sessions that started while the device slept
+  double wake_p50_ms;                 // From the start of those sessions to the wakeup
+  double wake_max_ms;
+};
+
+static PowerSummary powerSummary()
+{
+  PowerSummary summary = {{}, 0, 0, 0};
+  for (size_t i = 0; i < power_states.size(); i++)
+  {
+    uint64_t until = i + 1 < power_states.size() ? power_states[i + 1].second : hostMicros();
+    auto state = std::find_if(summary.states.begin(), summary.states.end(),
+                              [&](const PowerStateTime &s) { return s.state == power_states[i].first; });
+    if (state == summary.states.end())
+      state = summary.states.insert(summary.states.end(), {power_states[i].first, 0, 0});
+    state->us += until - power_states[i].second;
+    state->entered++;
+  }
+
+  std::vector<double> wake_ms;
+  for (size_t i = 0; i < hostReplaySessionCount(); i++)
+  {
+    uint64_t start_us = (uint64_t)hostReplaySession(i).start_ms * 1000;
+    auto next = std::upper_bound(power_states.begin(), power_states.end(), start_us,
+                                 [](uint64_t us, const std::pair<std::string, uint64_t> &s) { return us < s.second; });
+    if (next == power_states.begin() || (next - 1)->first != "sleep")
+      continue;
+    summary.sessions_asleep++;
+    if (next != power_states.end())
+      wake_ms.push_back((next->second - start_us) / 1000.0);
+  }
+  std::sort(wake_ms.begin(), wake_ms.end());
+  summary.wake_p50_ms = percentile(wake_ms, 50);
+  summary.wake_max_ms = wake_ms.empty() ? 0 : wake_ms.back();
+  return summary;
+}
+
+static void writeLatency(FILE *out, bool json, const char *name, const LatencySummary &l)
+{
+  if (json)
+  {
+    fprintf(out, "  \"%s\": {\"sessions\": %zu, \"missing\": %zu, \"p50_ms\": %.3f, \"p90_ms\": %.3f, \"p99_ms\": %.3f, \"max_ms\": %.3f},\n",
+            name, l.sessions, l.missing, l.p50_ms, l.p90_ms, l.p99_ms, l.max_ms);
+  }
+  else
+  {
+    fprintf(out, "host: %s latency p50 %.1f ms, p90 %.1f ms, p99 %.1f ms, max %.1f ms (%zu sessions, %zu without feedback)\n",
+            name, l.p50_ms, l.p90_ms, l.p99_ms, l.max_ms, l.sessions, l.missing);
+  }
+}
+
+void hostWriteReport(FILE *out, bool json)
+{
+  uint64_t total_us = std::max<uint64_t>(hostMicros(), 1);
+  uint64_t busy_us = 0;
+  for (int i = 0; i < HOST_TIME_CATEGORIES; i++)
+  {
+    if (i != HOST_TIME_WAIT && i != HOST_TIME_LIGHT_SLEEP)
+      busy_us += hostTimeSpent((HostTime)i);
+  }
+  double awake = 1.0 - (double)hostTimeSpent(HOST_TIME_LIGHT_SLEEP) / total_us;
+  HostReplayCoverage coverage = hostReplayCoverage();
+  uint64_t missed = coverage.samples - coverage.read;
+  HostHeapStats heap = hostHeapStats();
+  RepSummary reps = repSummary();
+  ClassificationSummary classification = classificationSummary();
+  PowerSummary power = powerSummary();
+  double accuracy = classification.in_session ? (double)classification.correct / classification.in_session : 0.0;
+
+  if (json)
+  {
+    fprintf(out, "{\n");
+    fprintf(out, "  \"pipeline\": \"%s\",\n", hostConfig().pipeline.c_str());
+    fprintf(out, "  \"virtual_ms\": %.3f,\n", hostMicros() / 1000.0);
+    fprintf(out, "  \"sessions\": %zu,\n", hostReplaySessionCount());
+    fprintf(out, "  \"results\": %zu,\n", event_times[HOST_EVENT_BLE_WRITE].size());
+    fprintf(out, "  \"invokes\": %zu,\n", event_times[HOST_EVENT_INVOKE].size());
+  }
+  writeLatency(out, json, "led_latency", feedbackLatency(HOST_EVENT_PIN_WRITE));
+  writeLatency(out, json, "ble_latency", feedbackLatency(HOST_EVENT_BLE_WRITE));
+
+  if (json)
+  {
+    fprintf(out, "  \"duty_cycle\": %.6f,\n", awake);
+    fprintf(out, "  \"cpu_busy\": %.6f,\n", (double)busy_us / total_us);
+    fprintf(out, "  \"time_fraction\": {");
+    for (int i = 0; i < HOST_TIME_CATEGORIES; i++)
+    {
+      fprintf(out, "%s\"%s\": %.6f", i ? ", " : "", hostTimeName((HostTime)i), (double)hostTimeSpent((HostTime)i) / total_us);
+    }
+    fprintf(out, "},\n");
+    fprintf(out, "  \"samples\": {\"replayed\": %llu, \"read\": %llu, \"missed\": %llu, \"duplicates\": %llu, \"transfers\": %llu},\n",
+            (unsigned long long)coverage.samples, (unsigned long long)coverage.read, (unsigned long long)missed,
+            (unsigned long long)coverage.duplicates, (unsigned long long)coverage.transfers);
+    fprintf(out, "  \"heap\": {\"live\": %u, \"peak\": %u, \"allocations\": %llu},\n", heap.live, heap.peak,
+            (unsigned long long)heap.allocations);
+    fprintf(out, "  \"reps\": {\"detected\": %zu, \"sessions_none\": %zu, \"sessions_one\": %zu, \"sessions_more\": %zu, \"outside\": %zu},\n",
+            reps.detected, reps.sessions_none, reps.sessions_one, reps.sessions_more, reps.outside);
+    fprintf(out, "  \"power\": {\"time_fraction\": {");
+    for (size_t i = 0; i < power.states.size(); i++)
+      fprintf(out, "%s\"%s\": %.6f", i ? ", " : "", power.states[i].state.c_str(), (double)power.states[i].us / total_us);
+    fprintf(out, "}, \"entered\": {");
+    for (size_t i = 0; i < power.states.size(); i++)
+      fprintf(out, "%s\"%s\": %zu", i ? ", " : "", power.states[i].state.c_str(), power.states[i].entered);
+    fprintf(out, "}, \"sessions_asleep\": %zu, \"wake_p50_ms\": %.3f, \"wake_max_ms\": %.3f},\n",
+            power.sessions_asleep, power.wake_p50_ms, power.wake_max_ms);
+    fprintf(out, "  \"classification\": {\"results\": %zu, \"in_session\": %zu, \"correct\": %zu, \"accuracy\": %.4f, ",
+            classification.results, classification.in_session, classification.correct, accuracy);
+    // Recorded class of each result's session, null in the rest gaps. One per --inputs window, in order,
+    // so the real model can be scored on them (simulate.py)
+    fprintf(out, "\"expected\": [");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+      long session = sessionAt(results[i].second);
+      if (session < 0)
+        fprintf(out, i ? ", null" : "null");
+      else
+        fprintf(out, i ? ", \"%s\"" : "\"%s\"", hostReplaySession(session).lift_class.c_str());
+    }
+    fprintf(out, "]}\n");
+    fprintf(out, "}\n");
+    return;
+  }
+
+  fprintf(out, "host: duty cycle %.1f%%, CPU busy %.1f%% (", 100.0 * awake, 100.0 * busy_us / total_us);
+  for (int i = 0; i < HOST_TIME_CATEGORIES; i++)
+  {
+    fprintf(out, "%s%s %.1f%%", i ? ", " : "", hostTimeName((HostTime)i), 100.0 * hostTimeSpent((HostTime)i) / total_us);
+  }
+  fprintf(out, ")\n");
+  fprintf(out, "host: heap peak %u bytes, %u live at exit, %llu allocations\n", heap.peak, heap.live,
+          (unsigned long long)heap.allocations);
+  if (reps.detected)
+  {
+    fprintf(out, "host: %zu reps, %zu sessions with one, %zu with none, %zu with more, %zu in rest gaps\n",
+            reps.detected, reps.sessions_one, reps.sessions_none, reps.sessions_more, reps.outside);
+  }
+  if (!power.states.empty())
+  {
+    fprintf(out, "host: power");
+    for (size_t i = 0; i < power.states.size(); i++)
+    {
+      fprintf(out, "%s %s %.1f%% (%zux)", i ? "," : "", power.states[i].state.c_str(),
+              100.0 * power.states[i].us / total_us, power.states[i].entered);
+    }
+    fprintf(out, "; %zu sessions started asleep, woke after p50 %.0f ms, max %.0f ms\n", power.sessions_asleep,
+            power.wake_p50_ms, power.wake_max_ms);
+  }
+  if (classification.results)
+  {
+    fprintf(out, "host: %zu Invoke() calls for %zu results\n", event_times[HOST_EVENT_INVOKE].size(),
+            classification.results);
+  }
+  if (classification.in_session)
+  {
+    fprintf(out, "host: %zu of %zu results on replayed samples match the recorded class (%.1f%%)\n",
+            classification.correct, classification.in_session, 100.0 * accuracy);
+  }
+  if (coverage.samples)
+  {
+    fprintf(out, "host: read %llu of %llu replayed samples, %llu missed, %llu duplicate reads, %llu I2C reads in all\n",
+            (unsigned long long)coverage.read, (unsigned long long)coverage.samples, (unsigned long long)missed,
+            (unsigned long long)coverage.duplicates, (unsigned long long)coverage.transfers);
+  }
+}
@@ -0,0 +1,315 @@
+#include "host_runtime.h"
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <chrono>
+#include <signal.h>
+#include <thread>
+#include <unistd.h>
+
+// Firmware entry points from main.cpp
+void setup();
+void loop();
+
+TwoWire Wire;
+
+static HostConfig config = {"", 2000, 0, ".pio/host_fs", false, false, "", "scheduled", "", "", "", "", "", 0, 0, 0};
+
+// Device costs for --profile esp32s3
+const uint32_t ESP32S3_IMU_READ_US = 1600;  // 14-byte burst read from the MPU6050 over 100 kHz I2C
+const uint32_t ESP32S3_INVOKE_US = 74000;   // Measured Invoke() time of the float model
+const uint32_t ESP32S3_SERIAL_BAUD = 115200; // Console UART
+
+static uint64_t now_us = 0;
+static uint64_t spent_us[HOST_TIME_CATEGORIES] = {0};
+static uint64_t loop_calls = 0;
+static std::chrono::steady_clock::time_point wall_start;
+static volatile sig_atomic_t interrupted = 0;
+
+static uint8_t pin_modes[HOST_PIN_COUNT] = {0};
+static bool pin_levels[HOST_PIN_COUNT] = {false};
+static HostPinSource pin_sources[HOST_PIN_COUNT] = {nullptr};
+
+const HostConfig &hostConfig()
+{
+  return config;
+}
+
+static uint64_t wallMicros()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wall_start).count();
+}
+
+// Option names double as environment variables, e.g. --ble-log and REPMATE_BLE_LOG
+static const char *option(int argc, char **argv, const char *flag, const char *env, bool is_switch = false)
+{
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], flag) == 0)
+      return is_switch ? "1" : (i + 1 < argc ? argv[i + 1] : nullptr);
+  }
+  return getenv(env);
+}
+
+static void onInterrupt(int)
+{
+  interrupted = 1;
+}
+
+// printf() goes through this stream so UART time is charged for it like for Serial
+static ssize_t chargedStdoutWrite(void *, const char *buffer, size_t size)
+{
+  hostCharge(HOST_TIME_SERIAL, hostSerialMicros(size));
+  return write(STDOUT_FILENO, buffer, size);
+}
+
+static void chargeStdout()
+{
+  cookie_io_functions_t functions = {nullptr, chargedStdoutWrite, nullptr, nullptr};
+  FILE *charged = fopencookie(nullptr, "w", functions);
+  if (charged == nullptr)
+    return;
+  fflush(stdout);
+  setvbuf(charged, nullptr, _IOLBF, BUFSIZ);
+  stdout = charged;
+}
+
+void hostRuntimeInit(int argc, char **argv)
+{
+  const char *value;
+  if ((value = option(argc, argv, "--profile", "REPMATE_PROFILE")))
+  {
+    if (strcmp(value, "esp32s3") != 0)
+    {
+      fprintf(stderr, "host: unknown profile %s\n", value);
+      exit(1);
+    }
+    config.imu_read_us = ESP32S3_IMU_READ_US;
+    config.invoke_us = ESP32S3_INVOKE_US;
+    config.serial_baud = ESP32S3_SERIAL_BAUD;
+  }
+  if ((value = option(argc, argv, "--replay", "REPMATE_REPLAY")))
+    config.replay_path = value;
+  if ((value = option(argc, argv, "--gap", "REPMATE_REPLAY_GAP")))
+    config.replay_gap_ms = strtoul(value, nullptr, 10);
+  if ((value = option(argc, argv, "--duration", "REPMATE_DURATION")))
+    config.duration_ms = strtoul(value, nullptr, 10);
+  if ((value = option(argc, argv, "--fs", "REPMATE_FS_ROOT")))
+    config.fs_root = value;
+  if ((value = option(argc, argv, "--serial", "REPMATE_SERIAL")))
+    config.serial_pty = strcmp(value, "pty") == 0;
+  if ((value = option(argc, argv, "--realtime", "REPMATE_REALTIME", true)))
+    config.realtime = strcmp(value, "0") != 0;
+  if ((value = option(argc, argv, "--ble-log", "REPMATE_BLE_LOG")))
+    config.ble_log = value;
+  if ((value = option(argc, argv, "--imu-read-us", "REPMATE_IMU_READ_US")))
+    config.imu_read_us = strtoul(value, nullptr, 10);
+  if ((value = option(argc, argv, "--invoke-us", "REPMATE_INVOKE_US")))
+    config.invoke_us = strtoul(value, nullptr, 10);
+  if ((value = option(argc, argv, "--serial-baud", "REPMATE_SERIAL_BAUD")))
+    config.serial_baud = strtoul(value, nullptr, 10);
+  if ((value = option(argc, argv, "--pipeline", "REPMATE_PIPELINE")))
+    config.pipeline = value;
+  if ((value = option(argc, argv, "--decimator", "REPMATE_DECIMATOR")))
+    config.decimator = value;
+  if ((value = option(argc, argv, "--imu-profile", "REPMATE_IMU_PROFILE")))
+    config.imu_profile = value;
+  if ((value = option(argc, argv, "--idle-timeout", "REPMATE_IDLE_TIMEOUT")))
+    config.idle_timeout = value;
+  if ((value = option(argc, argv, "--report", "REPMATE_REPORT")))
+    config.report_path = value;
+  if ((value = option(argc, argv, "--inputs", "REPMATE_INPUTS")))
+    config.inputs_path = value;
+
+  if (!config.replay_path.empty() && !hostReplayLoad(config.replay_path))
+  {
+    fprintf(stderr, "host: nothing to replay in %s\n", config.replay_path.c_str());
+    exit(1);
+  }
+  if (config.duration_ms == 0)
+  {
+    config.duration_ms = hostReplaySessionCount() > 0 ? hostReplayEndMs() + 5000 : 60000;
+  }
+
+  if (config.serial_baud)
+    chargeStdout();
+
+  signal(SIGINT, onInterrupt);
+  wall_start = std::chrono::steady_clock::now();
+}
+
+void hostRuntimeExit()
+{
+  fflush(stdout);
+  double wall_s = wallMicros() / 1e6;
+  double virtual_s = now_us / 1e6;
+  fprintf(stderr, "host: %.3f s virtual in %.3f s wall (%.0fx), %llu loop() calls, %zu replayed sessions\n",
+          virtual_s, wall_s, wall_s > 0 ? virtual_s / wall_s : 0.0, (unsigned long long)loop_calls,
+          hostReplaySessionCount());
+  hostWriteReport(stderr, false);
+
+  if (!config.report_path.empty())
+  {
+    FILE *report = fopen(config.report_path.c_str(), "w");
+    if (report == nullptr)
+    {
+      fprintf(stderr, "host: cannot write report %s\n", config.report_path.c_str());
+      exit(1);
+    }
+    hostWriteReport(report, true);
+    fclose(report);
+  }
+  exit(0);
+}
+
+static bool timeUp()
+{
+  return interrupted || now_us >= (uint64_t)config.duration_ms * 1000;
+}
+
+uint64_t hostMicros()
+{
+  return now_us;
+}
+
+void hostSetMicros(uint64_t us)
+{
+  now_us = us;
+}
+
+void hostAdvanceMicros(uint64_t us)
+{
+  hostCharge(HOST_TIME_WAIT, us);
+}
+
+uint64_t hostSerialMicros(size_t bytes)
+{
+  // 8N1 framing, 10 bits per byte
+  return config.serial_baud ? (uint64_t)bytes * 10 * 1000000 / config.serial_baud : 0;
+}
+
+uint64_t hostTimeSpent(HostTime category)
+{
+  return spent_us[category];
+}
+
+const char *hostTimeName(HostTime category)
+{
+  static const char *names[HOST_TIME_CATEGORIES] = {"wait", "light_sleep", "imu_read", "inference", "serial", "loop"};
+  return names[category];
+}
+
+void hostCharge(HostTime category, uint64_t us)
+{
+  now_us += us;
+  spent_us[category] += us;
+
+  // UART time is charged from inside stdio writes, it must not end the run from there
+  if (category == HOST_TIME_SERIAL)
+    return;
+
+  if (config.realtime)
+  {
+    uint64_t wall = wallMicros();
+    if (now_us > wall)
+      std::this_thread::sleep_for(std::chrono::microseconds(now_us - wall));
+  }
+  // Firmware that waits in delay() forever (e.g. a halt after a failed mount) still ends the run
+  if (timeUp())
+    hostRuntimeExit();
+}
+
+bool hostPinLevel(uint8_t pin)
+{
+  if (pin < HOST_PIN_COUNT && pin_sources[pin])
+    return pin_sources[pin]();
+  return pin < HOST_PIN_COUNT && pin_levels[pin];
+}
+
+void hostSetPinInput(uint8_t pin, bool high)
+{
+  if (pin < HOST_PIN_COUNT)
+    pin_levels[pin] = high;
+}
+
+void hostSetPinSource(uint8_t pin, HostPinSource source)
+{
+  if (pin < HOST_PIN_COUNT)
+    pin_sources[pin] = source;
+}
+
+unsigned long millis()
+{
+  return (unsigned long)(uint32_t)(now_us / 1000);
+}
+
+unsigned long micros()
+{
+  return (unsigned long)(uint32_t)now_us;
+}
+
+void delay(uint32_t ms)
+{
+  hostAdvanceMicros((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  hostAdvanceMicros(us);
+}
+
+void yield()
+{
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  if (pin < HOST_PIN_COUNT)
+    pin_modes[pin] = mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+  if (pin < HOST_PIN_COUNT && pin_modes[pin] == OUTPUT)
+  {
+    pin_levels[pin] = value != LOW;
+    hostNoteEvent(HOST_EVENT_PIN_WRITE);
+  }
+}
+
+int digitalRead(uint8_t pin)
+{
+  return hostPinLevel(pin) ? HIGH : LOW;
+}
+
+// pio test builds the firmware with each test's own main() (test/)
+#ifndef UNIT_TEST
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  hostHeapMarkBaseline();
+  setup();
+  while (!timeUp())
+  {
+    uint64_t before = now_us;
+    loop();
+    loop_calls++;
+    if (now_us != before)
+      continue;
+
+    // A loop() that never delays must still move time forward
+    if (config.realtime)
+    {
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+      uint64_t wall = wallMicros();
+      if (wall > now_us)
+        hostCharge(HOST_TIME_LOOP, wall - now_us);
+    }
+    else
+    {
+      hostCharge(HOST_TIME_LOOP, 1);
+    }
+  }
+  hostRuntimeExit();
+}
+#endif
@@ -0,0 +1,219 @@
+#include "host_runtime.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+namespace stdfs = std::filesystem;
+
+const float HOST_GRAVITY = 9.80665f;
+
+struct ReplaySample
+{
+  float t; // ms from the start of the recording
+  float accel[3];
+  float gyro[3];
+};
+
+struct LoadedSession
+{
+  HostReplaySession info;
+  std::vector<ReplaySample> samples;
+  long last_read = -1; // Index of the sample the previous read returned
+};
+
+static std::vector<LoadedSession> sessions;
+static uint64_t samples_read = 0;
+static uint64_t duplicate_reads = 0;
+static uint64_t transfers = 0;
+
+// "key": "value" from the recording header
+static std::string stringField(const std::string &text, const char *key)
+{
+  size_t at = text.find(std::string("\"") + key + "\"");
+  if (at == std::string::npos)
+    return "";
+  size_t open = text.find('"', text.find(':', at) + 1);
+  size_t close = text.find('"', open + 1);
+  return open == std::string::npos || close == std::string::npos ? "" : text.substr(open + 1, close - open - 1);
+}
+
+static bool numberField(const std::string &text, size_t from, size_t to, const char *key, float *value)
+{
+  size_t at = text.find(std::string("\"") + key + "\"", from);
+  if (at == std::string::npos || at >= to)
+    return false;
+  size_t colon = text.find(':', at);
+  char *end;
+  *value = strtof(text.c_str() + colon + 1, &end);
+  return end != text.c_str() + colon + 1;
+}
+
+// Reads the tSD samples of a recording written by json_operations.cpp (or copy_files.py).
+// Parsing stops at the end of the array, so trailing transfer noise is ignored.
+static bool loadSession(const stdfs::path &path, LoadedSession *session)
+{
+  std::ifstream in(path);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  std::string text = contents.str();
+
+  size_t data = text.find("\"tSD\"");
+  if (data == std::string::npos)
+    return false;
+  size_t open = text.find('[', data);
+  size_t close = text.find(']', open);
+  if (open == std::string::npos || close == std::string::npos)
+    return false;
+
+  session->info.path = path.string();
+  session->info.lift = stringField(text, "lN");
+  session->info.lift_class = stringField(text, "lC");
+
+  static const char *keys[7] = {"t", "aX", "aY", "aZ", "gX", "gY", "gZ"};
+  size_t at = open;
+  while ((at = text.find('{', at)) < close)
+  {
+    size_t end = text.find('}', at);
+    if (end == std::string::npos || end > close)
+      return false;
+    float values[7];
+    for (int i = 0; i < 7; i++)
+    {
+      if (!numberField(text, at, end, keys[i], &values[i]))
+        return false;
+    }
+    ReplaySample sample = {values[0], {values[1], values[2], values[3]}, {values[4], values[5], values[6]}};
+    if (!session->samples.empty() && sample.t < session->samples.back().t)
+      return false;
+    session->samples.push_back(sample);
+    at = end;
+  }
+  return !session->samples.empty();
+}
+
+bool hostReplayLoad(const std::string &path)
+{
+  std::vector<stdfs::path> files;
+  std::error_code error;
+  if (stdfs::is_directory(path, error))
+  {
+    for (const auto &entry : stdfs::recursive_directory_iterator(path, error))
+    {
+      if (entry.is_regular_file() && entry.path().extension() == ".json")
+        files.push_back(entry.path());
+    }
+    std::sort(files.begin(), files.end());
+  }
+  else
+  {
+    files.push_back(path);
+  }
+
+  // Sessions play back to back, each after a rest gap
+  uint32_t start_ms = 0;
+  for (const auto &file : files)
+  {
+    LoadedSession session;
+    if (!loadSession(file, &session))
+    {
+      fprintf(stderr, "host: skipping unreadable recording %s\n", file.c_str());
+      continue;
+    }
+    start_ms += hostConfig().replay_gap_ms;
+    session.info.start_ms = start_ms;
+    session.info.end_ms = start_ms + (uint32_t)(session.samples.back().t - session.samples.front().t);
+    start_ms = session.info.end_ms;
+    sessions.push_back(session);
+  }
+  return !sessions.empty();
+}
+
+size_t hostReplaySessionCount()
+{
+  return sessions.size();
+}
+
+const HostReplaySession &hostReplaySession(size_t index)
+{
+  return sessions[index].info;
+}
+
+uint32_t hostReplayEndMs()
+{
+  return sessions.empty() ? 0 : sessions.back().info.end_ms;
+}
+
+static void copySample(const ReplaySample &sample, float accel[3], float gyro[3])
+{
+  memcpy(accel, sample.accel, sizeof(sample.accel));
+  memcpy(gyro, sample.gyro, sizeof(sample.gyro));
+}
+
+// Replay at now_ms, counted as a read of the sample if count is set
+static void replayAt(uint32_t now_ms, float accel[3], float gyro[3], bool count)
+{
+  // First session that has not ended yet
+  auto session = std::lower_bound(sessions.begin(), sessions.end(), now_ms,
+                                   [](const LoadedSession &s, uint32_t ms) { return s.info.end_ms < ms; });
+  if (session == sessions.end())
+  {
+    if (sessions.empty())
+    {
+      const float flat[3] = {0, 0, HOST_GRAVITY};
+      memcpy(accel, flat, sizeof(flat));
+      memset(gyro, 0, 3 * sizeof(float));
+      return;
+    }
+    // Replay over, hold the last reading
+    copySample(sessions.back().samples.back(), accel, gyro);
+    return;
+  }
+
+  // During the rest gap the sensor holds still in the pose the next session starts from
+  if (now_ms < session->info.start_ms)
+  {
+    copySample(session->samples.front(), accel, gyro);
+    memset(gyro, 0, 3 * sizeof(float));
+    return;
+  }
+
+  float t = session->samples.front().t + (now_ms - session->info.start_ms);
+  auto next = std::upper_bound(session->samples.begin(), session->samples.end(), t,
+                               [](float value, const ReplaySample &s) { return value < s.t; });
+  long index = (next - 1) - session->samples.begin();
+  if (count && index == session->last_read)
+  {
+    duplicate_reads++;
+  }
+  else if (count)
+  {
+    samples_read++;
+    session->last_read = index;
+  }
+  copySample(session->samples[index], accel, gyro);
+}
+
+void hostImuRead(uint32_t now_ms, float accel[3], float gyro[3])
+{
+  transfers++;
+  replayAt(now_ms, accel, gyro, true);
+}
+
+void hostImuPeek(uint32_t now_ms, float accel[3], float gyro[3])
+{
+  replayAt(now_ms, accel, gyro, false);
+}
+
+HostReplayCoverage hostReplayCoverage()
+{
+  HostReplayCoverage coverage = {0, samples_read, duplicate_reads, transfers};
+  for (const auto &session : sessions)
+    coverage.samples += session.samples.size();
+  return coverage;
+}
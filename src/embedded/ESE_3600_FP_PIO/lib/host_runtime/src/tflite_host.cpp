@@ -0,0 +1,239 @@
+#include <Arduino.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+
+#include <stdarg.h>
+
+// Reference windows from the firmware (src/utils/tflite/data.cpp), in label order
+extern float data_2d_lift_instability[200][6];
+extern float data_2d_no_lift[200][6];
+extern float data_2d_off_axis[200][6];
+extern float data_2d_perfect_form[200][6];
+extern float data_2d_partial_motion[200][6];
+extern float data_2d_swinging_weight[200][6];
+
+static float (*const reference_windows[])[6] = {data_2d_lift_instability, data_2d_no_lift, data_2d_off_axis,
+                                                 data_2d_perfect_form, data_2d_partial_motion, data_2d_swinging_weight};
+const int HOST_REFERENCE_CLASSES = 6;
+const int HOST_REFERENCE_VALUES = 200 * 6;
+
+// Logit = -scale * mean squared distance to the reference window
+const float HOST_DISTANCE_SCALE = 200.0f;
+
+// Minimal flatbuffer reader, enough to walk Model -> subgraphs[0] -> tensors
+namespace
+{
+  const uint8_t *at(const uint8_t *base, uint32_t offset) { return base + offset; }
+  uint32_t u32(const uint8_t *p) { return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24; }
+  uint16_t u16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+  // Address of field `index` in a table, nullptr if absent
+  const uint8_t *field(const uint8_t *table, int index)
+  {
+    const uint8_t *vtable = table - (int32_t)u32(table);
+    uint16_t vtable_size = u16(vtable);
+    if (4 + 2 * index >= vtable_size)
+      return nullptr;
+    uint16_t offset = u16(vtable + 4 + 2 * index);
+    return offset ? table + offset : nullptr;
+  }
+
+  const uint8_t *table(const uint8_t *table_field) { return at(table_field, u32(table_field)); }
+
+  // Vector of offsets or scalars: returns the element count and the first element
+  const uint8_t *vector(const uint8_t *vector_field, uint32_t *length)
+  {
+    const uint8_t *v = at(vector_field, u32(vector_field));
+    *length = u32(v);
+    return v + 4;
+  }
+
+  TfLiteType tensorType(int8_t schema_type)
+  {
+    switch (schema_type)
+    {
+    case 0:
+      return kTfLiteFloat32;
+    case 2:
+      return kTfLiteInt32;
+    case 3:
+      return kTfLiteUInt8;
+    case 4:
+      return kTfLiteInt64;
+    case 7:
+      return kTfLiteInt16;
+    case 9:
+      return kTfLiteInt8;
+    default:
+      return kTfLiteNoType;
+    }
+  }
+
+  size_t typeSize(TfLiteType type)
+  {
+    switch (type)
+    {
+    case kTfLiteInt64:
+      return 8;
+    case kTfLiteFloat32:
+    case kTfLiteInt32:
+      return 4;
+    case kTfLiteInt16:
+      return 2;
+    default:
+      return 1;
+    }
+  }
+}
+
+namespace tflite
+{
+  int ErrorReporter::Report(const char *format, ...)
+  {
+    va_list args;
+    va_start(args, format);
+    int result = Report(format, args);
+    va_end(args);
+    return result;
+  }
+
+  int MicroErrorReporter::Report(const char *format, va_list args)
+  {
+    int result = vprintf(format, args);
+    printf("\n");
+    return result;
+  }
+
+  uint32_t Model::version() const
+  {
+    const uint8_t *root = table((const uint8_t *)this);
+    const uint8_t *version = field(root, 0);
+    return version ? u32(version) : 0;
+  }
+
+  const Model *GetModel(const void *buffer)
+  {
+    return (const Model *)buffer;
+  }
+
+  MicroInterpreter::MicroInterpreter(const Model *model, const AllOpsResolver &resolver, uint8_t *tensor_arena,
+                                     size_t tensor_arena_size, ErrorReporter *error_reporter)
+      : model(model), arena(tensor_arena), arena_size(tensor_arena_size), error_reporter(error_reporter)
+  {
+    (void)resolver;
+  }
+
+  TfLiteStatus MicroInterpreter::AllocateTensors()
+  {
+    const uint8_t *root = table((const uint8_t *)model);
+    const uint8_t *subgraphs_field = field(root, 2);
+    if (!subgraphs_field)
+      return kTfLiteError;
+    uint32_t subgraph_count;
+    const uint8_t *subgraphs = vector(subgraphs_field, &subgraph_count);
+    if (subgraph_count == 0)
+      return kTfLiteError;
+    const uint8_t *subgraph = table(subgraphs);
+
+    uint32_t tensor_count;
+    const uint8_t *tensor_table = vector(field(subgraph, 0), &tensor_count);
+
+    arena_used = 0;
+    TensorIndexList *lists[2] = {&input_list, &output_list};
+    int slot = 0;
+    for (int io = 0; io < 2; io++)
+    {
+      uint32_t count;
+      const uint8_t *indices = vector(field(subgraph, 1 + io), &count);
+      lists[io]->count = 0;
+      for (uint32_t i = 0; i < count && i < (uint32_t)kHostMaxIoTensors; i++)
+      {
+        int index = (int32_t)u32(indices + 4 * i);
+        if (index < 0 || (uint32_t)index >= tensor_count)
+          return kTfLiteError;
+        const uint8_t *tensor = table(tensor_table + 4 * index);
+
+        TfLiteIntArray &shape = dims[slot];
+        uint32_t rank = 0;
+        const uint8_t *shape_field = field(tensor, 0);
+        const uint8_t *shape_data = shape_field ? vector(shape_field, &rank) : nullptr;
+        shape.size = std::min<int>(rank, kTfLiteMaxDims);
+        size_t elements = 1;
+        for (int d = 0; d < shape.size; d++)
+        {
+          shape.data[d] = (int32_t)u32(shape_data + 4 * d);
+          elements *= shape.data[d];
+        }
+
+        const uint8_t *type_field = field(tensor, 1);
+        TfLiteTensor &t = tensors[slot];
+        t = {};
+        t.type = tensorType(type_field ? (int8_t)*type_field : 0);
+        t.dims = &shape;
+        t.bytes = elements * typeSize(t.type);
+
+        // 16-byte aligned slots from the start of the arena
+        size_t offset = (arena_used + 15) & ~(size_t)15;
+        if (offset + t.bytes > arena_size)
+        {
+          TF_LITE_REPORT_ERROR(error_reporter, "Arena size is too small for all buffers. Needed %u but only %u was available.",
+                               (unsigned)(offset + t.bytes), (unsigned)arena_size);
+          return kTfLiteError;
+        }
+        t.data.raw = (char *)arena + offset;
+        memset(t.data.raw, 0, t.bytes);
+        arena_used = offset + t.bytes;
+
+        lists[io]->indices[lists[io]->count++] = slot;
+        slot++;
+      }
+    }
+    return kTfLiteOk;
+  }
+
+  TfLiteStatus MicroInterpreter::Invoke()
+  {
+    TfLiteTensor *in = input(0);
+    if (!in || !output(0) || in->type != kTfLiteFloat32)
+      return kTfLiteError;
+
+    // Every output head gets the same distance logits, cut to its class count
+    size_t values = std::min<size_t>(in->bytes / sizeof(float), HOST_REFERENCE_VALUES);
+    for (size_t o = 0; o < output_list.count; o++)
+    {
+      TfLiteTensor *out = output(o);
+      if (out->type != kTfLiteFloat32)
+        return kTfLiteError;
+      size_t classes = out->bytes / sizeof(float);
+      for (size_t c = 0; c < classes; c++)
+      {
+        if ((int)c >= HOST_REFERENCE_CLASSES || values == 0)
+        {
+          out->data.f[c] = -HOST_DISTANCE_SCALE;
+          continue;
+        }
+        const float *reference = &reference_windows[c][0][0];
+        float distance = 0;
+        for (size_t i = 0; i < values; i++)
+        {
+          float d = in->data.f[i] - reference[i];
+          distance += d * d;
+        }
+        out->data.f[c] = -HOST_DISTANCE_SCALE * distance / values;
+      }
+    }
+
+    hostNoteEvent(HOST_EVENT_INVOKE);
+    hostCharge(HOST_TIME_INFERENCE, hostConfig().invoke_us);
+    return kTfLiteOk;
+  }
+
+  TfLiteTensor *MicroInterpreter::input(size_t index)
+  {
+    return index < input_list.count ? &tensors[input_list.indices[index]] : nullptr;
+  }
+
+  TfLiteTensor *MicroInterpreter::output(size_t index)
+  {
+    return index < output_list.count ? &tensors[output_list.indices[index]] : nullptr;
+  }
+}
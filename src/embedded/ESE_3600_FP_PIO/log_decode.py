@@ -0,0 +1,96 @@
+import argparse
+import re
+import struct
+import sys
+
+# Formats binary log dumps (see src/utils/log/log.h) captured from the serial port.
+
+VERSION = 1
+HEADER = struct.Struct("<3sBIHI")
+RECORD = struct.Struct("<HBBI")
+LEVELS = {1: "E", 2: "W", 3: "I", 4: "D"}
+
+# printf conversion: flags, width, precision, length modifier, type
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(hh|h|ll|l|z|j|t|L)?([diuxXofeEgGcsp%])")
+
+
+def dumps_from_serial(path):
+    """Hex dumps between START_LOG / END_LOG lines of a serial capture"""
+    dumps, current = [], None
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line == "START_LOG":
+                current = bytearray()
+            elif line == "END_LOG" and current is not None:
+                dumps.append(bytes(current))
+                current = None
+            elif current is not None:
+                current += bytes.fromhex(line)
+    return dumps
+
+
+def format_record(fmt, args):
+    """Applies a C format to the raw argument bytes the device stored"""
+    pos = 0
+
+    def convert(match):
+        nonlocal pos
+        flags, _, kind = match.groups()
+        if kind == "%":
+            return "%"
+        if kind == "s":
+            length = args[pos]
+            text = args[pos + 1 : pos + 1 + length].decode(errors="replace")
+            pos += 1 + length
+            return ("%" + flags + "s") % text
+        (word,) = struct.unpack_from("<I", args, pos)
+        pos += 4
+        if kind in "feEgG":
+            return ("%" + flags + kind) % struct.unpack("<f", struct.pack("<I", word))[0]
+        if kind in "di":
+            return ("%" + flags + "d") % (word - (1 << 32) if word & 0x80000000 else word)
+        if kind == "c":
+            return chr(word & 0xFF)
+        if kind == "p":
+            return "0x%08x" % word
+        return ("%" + flags + ("d" if kind == "u" else kind)) % word
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def decode(data):
+    magic, version, dropped, format_count, record_bytes = HEADER.unpack_from(data)
+    if magic != b"RML" or version != VERSION:
+        raise ValueError(f"Not a version {VERSION} log dump")
+    pos = HEADER.size
+    formats = []
+    for _ in range(format_count):
+        (length,) = struct.unpack_from("<H", data, pos)
+        formats.append(data[pos + 2 : pos + 2 + length].decode(errors="replace"))
+        pos += 2 + length
+
+    lines = []
+    end = min(len(data), pos + record_bytes)
+    while pos + RECORD.size <= end:
+        format_id, level, arg_bytes, micros = RECORD.unpack_from(data, pos)
+        args = data[pos + RECORD.size : pos + RECORD.size + arg_bytes]
+        pos += RECORD.size + arg_bytes
+        fmt = formats[format_id] if format_id < len(formats) else f"<unknown format {format_id}>"
+        lines.append(f"{micros / 1e6:12.6f} {LEVELS.get(level, '?')} {format_record(fmt, args)}")
+    return lines, dropped
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Decode RepMate binary log dumps")
+    parser.add_argument("capture", help="serial capture containing START_LOG / END_LOG blocks")
+    args = parser.parse_args()
+
+    dumps = dumps_from_serial(args.capture)
+    if not dumps:
+        sys.exit("No log dump found")
+    for data in dumps:
+        lines, dropped = decode(data)
+        print("\n".join(lines))
+        if dropped:
+            print(f"({dropped} records did not fit in the log buffer)", file=sys.stderr)
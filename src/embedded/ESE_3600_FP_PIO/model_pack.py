@@ -0,0 +1,451 @@
+import argparse
+import glob
+import json
+import math
+import operator
+import os
+import re
+import struct
+import sys
+
+# Packs the TFLite model for MODEL_PACKED builds (src/utils/tflite/model_pack.h).
+# Reads src/utils/tflite/model.cpp (or a .tflite file), stores the float32 weight buffers as half
+# floats, runs of zeros as their length and the rest as is, and writes src/utils/tflite/model_packed.cpp.
+# The packed stream is decoded back here and compared with the model, weights rounded to half precision,
+# byte for byte.
+#
+# --check runs the original and the decoded model (a small float interpreter for the ops this model
+# uses) on the reference windows in data.cpp and on windows cut from the recordings, and reports how
+# often the predicted class changes and the largest probability difference. Exits 1 if a class changes.
+
+MAGIC = b"RMM"
+VERSION = 1
+COPY, HALF, ZERO = 0, 1, 2
+CODEC_NAMES = {COPY: "copy", HALF: "half", ZERO: "zero"}
+
+TFLITE_FLOAT32 = 0
+HALF_MAX = 65504.0
+
+DEFAULT_MODEL = os.path.join("src", "utils", "tflite", "model.cpp")
+DEFAULT_OUTPUT = os.path.join("src", "utils", "tflite", "model_packed.cpp")
+DATA_CPP = os.path.join("src", "utils", "tflite", "data.cpp")
+
+LABELS = ["l_i", "n_l", "o_a", "p_f", "p_m", "s_w"]
+WINDOW = 200  # OUTPUT_SEQUENCE_LENGTH
+CHANNELS = ["aX", "aY", "aZ", "gX", "gY", "gZ"]
+# normalize_value() ranges, the truncated int constants of imu_provider.cpp
+CHANNEL_MIN = [-25, -25, -25, -8, -8, -8]
+CHANNEL_MAX = [30, 30, 30, 7, 7, 7]
+
+
+def read_model(path):
+    """Flatbuffer bytes from a .tflite file or the C array in model.cpp"""
+    if not path.endswith(".cpp"):
+        with open(path, "rb") as f:
+            return f.read()
+    with open(path) as f:
+        source = f.read()
+    body = source[source.index("{") + 1 : source.index("}")]
+    return bytes(int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]{2}", body))
+
+
+class Flatbuffer:
+    """Just enough of the TFLite schema to find the weights and run the model"""
+
+    def __init__(self, data):
+        self.data = data
+
+    def u8(self, pos):
+        return self.data[pos]
+
+    def i32(self, pos):
+        return struct.unpack_from("<i", self.data, pos)[0]
+
+    def u32(self, pos):
+        return struct.unpack_from("<I", self.data, pos)[0]
+
+    def f32(self, pos):
+        return struct.unpack_from("<f", self.data, pos)[0]
+
+    def field(self, table, index):
+        """Position of a table's field, None if absent"""
+        vtable = table - self.i32(table)
+        if 4 + 2 * index >= struct.unpack_from("<H", self.data, vtable)[0]:
+            return None
+        offset = struct.unpack_from("<H", self.data, vtable + 4 + 2 * index)[0]
+        return table + offset if offset else None
+
+    def table(self, pos):
+        return pos + self.u32(pos)
+
+    def vector(self, pos):
+        """(length, position of the first element)"""
+        start = pos + self.u32(pos)
+        return self.u32(start), start + 4
+
+    def tables(self, pos):
+        if pos is None:
+            return []
+        count, start = self.vector(pos)
+        return [self.table(start + 4 * i) for i in range(count)]
+
+    def ints(self, pos):
+        if pos is None:
+            return []
+        count, start = self.vector(pos)
+        return [self.i32(start + 4 * i) for i in range(count)]
+
+
+def read_graph(fb):
+    """Tensors (shape, type, buffer position, buffer bytes), operators and the graph's inputs and outputs"""
+    root = fb.table(0)
+    opcodes = []
+    for code in fb.tables(fb.field(root, 1)):
+        deprecated, builtin = fb.field(code, 0), fb.field(code, 3)
+        opcodes.append(max(fb.u8(deprecated) if deprecated else 0, fb.i32(builtin) if builtin else 0))
+    subgraph = fb.tables(fb.field(root, 2))[0]
+    buffers = fb.tables(fb.field(root, 4))
+
+    tensors = []
+    for tensor in fb.tables(fb.field(subgraph, 0)):
+        type_field, buffer_field = fb.field(tensor, 1), fb.field(tensor, 2)
+        buffer = buffers[fb.u32(buffer_field) if buffer_field else 0]
+        data_field = fb.field(buffer, 0)
+        start, size = (fb.vector(data_field)[1], fb.vector(data_field)[0]) if data_field else (0, 0)
+        tensors.append({
+            "shape": fb.ints(fb.field(tensor, 0)),
+            "type": fb.u8(type_field) if type_field else 0,
+            "start": start,
+            "size": size,
+        })
+
+    operators = []
+    for op in fb.tables(fb.field(subgraph, 3)):
+        index, options = fb.field(op, 0), fb.field(op, 4)
+        operators.append({
+            "code": opcodes[fb.u32(index) if index else 0],
+            "inputs": fb.ints(fb.field(op, 1)),
+            "outputs": fb.ints(fb.field(op, 2)),
+            "options": fb.table(options) if options else None,
+        })
+    return tensors, operators, fb.ints(fb.field(subgraph, 1)), fb.ints(fb.field(subgraph, 2))
+
+
+def half_ranges(model, min_bytes):
+    """Sorted, distinct (start, size) of the float32 buffers worth storing as half floats"""
+    tensors = read_graph(Flatbuffer(model))[0]
+    ranges = set()
+    for tensor in tensors:
+        if tensor["type"] != TFLITE_FLOAT32 or tensor["size"] < min_bytes or tensor["size"] % 4:
+            continue
+        values = struct.unpack_from(f"<{tensor['size'] // 4}f", model, tensor["start"])
+        if all(math.isfinite(v) and abs(v) <= HALF_MAX for v in values):
+            ranges.add((tensor["start"], tensor["size"]))
+    return sorted(ranges)
+
+
+def plan_chunks(model, min_bytes, min_zero_run):
+    """(codec, start, size) covering the whole model"""
+    chunks = []
+
+    def add_plain(start, end):
+        # Zero runs inside the stretch between two weight buffers, copies around them
+        pos = start
+        for run in re.finditer(b"\x00{%d,}" % min_zero_run, model[start:end]):
+            if run.start() + start > pos:
+                chunks.append((COPY, pos, run.start() + start - pos))
+            chunks.append((ZERO, run.start() + start, run.end() - run.start()))
+            pos = run.end() + start
+        if end > pos:
+            chunks.append((COPY, pos, end - pos))
+
+    pos = 0
+    for start, size in half_ranges(model, min_bytes):
+        add_plain(pos, start)
+        chunks.append((HALF, start, size))
+        pos = start + size
+    add_plain(pos, len(model))
+    return chunks
+
+
+def to_half(payload):
+    values = struct.unpack(f"<{len(payload) // 4}f", payload)
+    return struct.pack(f"<{len(values)}e", *values)
+
+
+def pack(model, chunks):
+    out = bytearray(MAGIC + bytes([VERSION]) + struct.pack("<IH", len(model), len(chunks)))
+    for codec, start, size in chunks:
+        out += struct.pack("<BI", codec, size)
+        if codec == COPY:
+            out += model[start : start + size]
+        elif codec == HALF:
+            out += to_half(model[start : start + size])
+    return bytes(out)
+
+
+def unpack(packed):
+    """Python twin of modelUnpack()"""
+    if packed[:3] != MAGIC or packed[3] != VERSION:
+        raise ValueError("Not an RMM v1 stream")
+    model_bytes, chunk_count = struct.unpack_from("<IH", packed, 4)
+    pos, out = 10, bytearray()
+    for _ in range(chunk_count):
+        codec, size = struct.unpack_from("<BI", packed, pos)
+        pos += 5
+        if codec == COPY:
+            out += packed[pos : pos + size]
+            pos += size
+        elif codec == HALF:
+            values = struct.unpack_from(f"<{size // 4}e", packed, pos)
+            out += struct.pack(f"<{len(values)}f", *values)
+            pos += size // 2
+        elif codec == ZERO:
+            out += bytes(size)
+        else:
+            raise ValueError(f"Unknown codec {codec}")
+    if len(out) != model_bytes or pos != len(packed):
+        raise ValueError("Stream does not decode to the model size")
+    return bytes(out)
+
+
+def rounded_model(model, chunks):
+    """The model with its half-float buffers rounded, what unpack() has to give back"""
+    out = bytearray(model)
+    for codec, start, size in chunks:
+        if codec == HALF:
+            values = struct.unpack(f"<{size // 4}e", to_half(model[start : start + size]))
+            out[start : start + size] = struct.pack(f"<{len(values)}f", *values)
+    return bytes(out)
+
+
+def write_cpp(packed, path, source, symbol):
+    lines = [
+        f"// Generated by model_pack.py from {source}, do not edit.",
+        "// Packed model container, see model_pack.h.",
+        '#include "model.h"',
+        "",
+        f"alignas(4) const unsigned char {symbol}_packed[] = {{",
+    ]
+    for i in range(0, len(packed), 12):
+        row = ", ".join(f"0x{b:02x}" for b in packed[i : i + 12])
+        lines.append(f"    {row}{',' if i + 12 < len(packed) else '};'}")
+    lines.append(f"const unsigned int {symbol}_packed_len = {len(packed)};")
+    with open(path, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+class Interpreter:
+    """Float reference for the builtin ops in this model: batch 1, NHWC, SAME/VALID padding"""
+
+    EXPAND_DIMS, RESHAPE, ADD, MUL = 70, 22, 0, 18
+    CONV_2D, MAX_POOL_2D, MEAN, FULLY_CONNECTED, SOFTMAX = 3, 17, 40, 9, 25
+
+    def __init__(self, model):
+        self.fb = Flatbuffer(model)
+        self.tensors, self.operators, self.inputs, self.outputs = read_graph(self.fb)
+        self.constants = {}
+        for index, tensor in enumerate(self.tensors):
+            if tensor["size"] and tensor["type"] == TFLITE_FLOAT32:
+                self.constants[index] = list(struct.unpack_from(f"<{tensor['size'] // 4}f", model, tensor["start"]))
+
+    def option(self, options, index, kind, default):
+        pos = self.fb.field(options, index) if options is not None else None
+        if pos is None:
+            return default
+        return {"u8": self.fb.u8, "i32": self.fb.i32, "f32": self.fb.f32}[kind](pos)
+
+    @staticmethod
+    def activation(values, kind):
+        if kind == 1:  # RELU
+            return [v if v > 0 else 0.0 for v in values]
+        if kind == 3:  # RELU6
+            return [min(max(v, 0.0), 6.0) for v in values]
+        return values
+
+    @staticmethod
+    def padding(same, out, stride, kernel, size):
+        return max((out - 1) * stride + kernel - size, 0) // 2 if same else 0
+
+    def conv(self, x, op, out_shape):
+        _, height, width, depth = self.tensors[op["inputs"][0]]["shape"]
+        count, kh, kw, _ = self.tensors[op["inputs"][1]]["shape"]
+        weights, bias = self.constants[op["inputs"][1]], self.constants[op["inputs"][2]]
+        options = op["options"]
+        same = self.option(options, 0, "u8", 0) == 0
+        sw, sh = self.option(options, 1, "i32", 1), self.option(options, 2, "i32", 1)
+        out_h, out_w = out_shape[1], out_shape[2]
+        ph, pw = self.padding(same, out_h, sh, kh, height), self.padding(same, out_w, sw, kw, width)
+        rows = [weights[o * kh * kw * depth : (o + 1) * kh * kw * depth] for o in range(count)]
+        out = []
+        for oy in range(out_h):
+            for ox in range(out_w):
+                patch = []
+                for ky in range(kh):
+                    for kx in range(kw):
+                        iy, ix = oy * sh + ky - ph, ox * sw + kx - pw
+                        inside = 0 <= iy < height and 0 <= ix < width
+                        patch += x[(iy * width + ix) * depth :][:depth] if inside else [0.0] * depth
+                out += [sum(map(operator.mul, patch, rows[o])) + bias[o] for o in range(count)]
+        return self.activation(out, self.option(options, 3, "u8", 0))
+
+    def max_pool(self, x, op, out_shape):
+        _, height, width, depth = self.tensors[op["inputs"][0]]["shape"]
+        options = op["options"]
+        same = self.option(options, 0, "u8", 0) == 0
+        sw, sh = self.option(options, 1, "i32", 1), self.option(options, 2, "i32", 1)
+        fw, fh = self.option(options, 3, "i32", 1), self.option(options, 4, "i32", 1)
+        out_h, out_w = out_shape[1], out_shape[2]
+        ph, pw = self.padding(same, out_h, sh, fh, height), self.padding(same, out_w, sw, fw, width)
+        out = []
+        for oy in range(out_h):
+            for ox in range(out_w):
+                cells = [(oy * sh + ky - ph, ox * sw + kx - pw) for ky in range(fh) for kx in range(fw)]
+                cells = [(iy * width + ix) * depth for iy, ix in cells if 0 <= iy < height and 0 <= ix < width]
+                out += [max(x[cell + c] for cell in cells) for c in range(depth)]
+        return self.activation(out, self.option(options, 5, "u8", 0))
+
+    def run(self, window):
+        values = {self.inputs[0]: list(window)}
+        value = lambda index: values[index] if index in values else self.constants[index]
+        for op in self.operators:
+            code, inputs = op["code"], op["inputs"]
+            out_shape = self.tensors[op["outputs"][0]]["shape"]
+            if code in (self.EXPAND_DIMS, self.RESHAPE):
+                out = value(inputs[0])
+            elif code in (self.ADD, self.MUL):
+                # The second operand is a scalar or broadcast along the last dimension
+                a, b = value(inputs[0]), value(inputs[1])
+                combine = operator.add if code == self.ADD else operator.mul
+                out = [combine(v, b[i % len(b)]) for i, v in enumerate(a)]
+                out = self.activation(out, self.option(op["options"], 0, "u8", 0))
+            elif code == self.CONV_2D:
+                out = self.conv(value(inputs[0]), op, out_shape)
+            elif code == self.MAX_POOL_2D:
+                out = self.max_pool(value(inputs[0]), op, out_shape)
+            elif code == self.MEAN:
+                # Over the time axis of [1, T, C]
+                x = value(inputs[0])
+                steps, depth = self.tensors[inputs[0]]["shape"][1:3]
+                out = [sum(x[t * depth + c] for t in range(steps)) / steps for c in range(depth)]
+            elif code == self.FULLY_CONNECTED:
+                x, weights = value(inputs[0]), self.constants[inputs[1]]
+                count, depth = self.tensors[inputs[1]]["shape"]
+                bias = self.constants[inputs[2]] if len(inputs) > 2 and inputs[2] >= 0 else [0.0] * count
+                out = [sum(map(operator.mul, x, weights[o * depth : (o + 1) * depth])) + bias[o] for o in range(count)]
+                out = self.activation(out, self.option(op["options"], 0, "u8", 0))
+            elif code == self.SOFTMAX:
+                x, beta = value(inputs[0]), self.option(op["options"], 0, "f32", 1.0)
+                top = max(x)
+                exps = [math.exp((v - top) * beta) for v in x]
+                out = [e / sum(exps) for e in exps]
+            else:
+                raise ValueError(f"Builtin op {code} not supported by the checker")
+            values[op["outputs"][0]] = out
+        return values[self.outputs[0]]
+
+
+def reference_windows():
+    """The data_2d_* windows of data.cpp"""
+    with open(DATA_CPP) as f:
+        source = f.read()
+    windows = []
+    for match in re.finditer(r"data_2d_(\w+)\s*\[[^=]*=\s*\{", source):
+        body = source[match.end() : source.index("};", match.end())]
+        values = [float(v) for v in re.findall(r"-?\d+\.\d+(?:[eE][-+]?\d+)?", body)]
+        if len(values) == WINDOW * len(CHANNELS):
+            windows.append((match.group(1), values))
+    return windows
+
+
+def recording_windows(directory, limit):
+    """Back-to-back windows of WINDOW samples from the JSON recordings, normalized as on the device"""
+    windows = []
+    for path in sorted(glob.glob(os.path.join(directory, "**", "*.json"), recursive=True)):
+        try:
+            with open(path) as f:
+                samples = json.load(f)["tSD"]
+        except (ValueError, KeyError):
+            continue
+        for start in range(0, len(samples) - WINDOW + 1, WINDOW):
+            window = []
+            for sample in samples[start : start + WINDOW]:
+                for c, channel in enumerate(CHANNELS):
+                    scaled = (sample[channel] - CHANNEL_MIN[c]) / (CHANNEL_MAX[c] - CHANNEL_MIN[c])
+                    window.append(min(max(scaled, 0.0), 1.0))
+            windows.append((os.path.relpath(path, directory), window))
+    # Spread over all recordings rather than the first few
+    step = max(1, len(windows) // limit)
+    return windows[::step][:limit]
+
+
+def check(original, decoded, windows):
+    """(class changes, largest probability difference), printed per reference window"""
+    a, b = Interpreter(original), Interpreter(decoded)
+    changed, worst = 0, 0.0
+    for name, window in windows:
+        p, q = a.run(window), b.run(window)
+        if p.index(max(p)) != q.index(max(q)):
+            changed += 1
+            print(f"  {name}: {LABELS[p.index(max(p))]} -> {LABELS[q.index(max(q))]}")
+        worst = max(worst, max(abs(x - y) for x, y in zip(p, q)))
+    return changed, worst
+
+
+def score(interpreter, records, expected):
+    """The real model on a host replay: records are its --inputs windows, expected the report's
+    classification.expected (one per window, None in the rest gaps). A window the result cache answered
+    gets the class of the window it reused, as on the device. Returns in_session, correct, accuracy and
+    a count of each predicted class."""
+    if len(records) != len(expected):
+        raise ValueError(f"{len(records)} input windows for {len(expected)} results")
+    outputs = {}
+    summary = {"in_session": 0, "correct": 0, "predicted": {label: 0 for label in LABELS}}
+    for record, label in zip(records, expected):
+        if label is None:
+            continue
+        window = record["cached_from"] if record["cached_from"] >= 0 else record["window"]
+        if window not in outputs:
+            outputs[window] = interpreter.run(records[window]["input"])
+        p = outputs[window]
+        predicted = LABELS[p.index(max(p))]
+        summary["in_session"] += 1
+        summary["correct"] += predicted == label
+        summary["predicted"][predicted] += 1
+    summary["accuracy"] = summary["correct"] / summary["in_session"] if summary["in_session"] else 0.0
+    return summary
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Pack the TFLite model for MODEL_PACKED builds")
+    parser.add_argument("--model", default=DEFAULT_MODEL, help="model.cpp or a .tflite file")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="generated source")
+    parser.add_argument("--symbol", default="g_rep_mate_model",
+                        help="array name prefix, <symbol>_packed and <symbol>_packed_len (model_registry.cpp)")
+    parser.add_argument("--min-bytes", type=int, default=1024, help="smallest float32 buffer stored as half floats")
+    parser.add_argument("--min-zero-run", type=int, default=16, help="shortest run of zeros stored as its length")
+    parser.add_argument("--check", action="store_true", help="compare the decoded model's predictions")
+    parser.add_argument("--recordings", default="data", help="directory of JSON recordings for --check")
+    parser.add_argument("--windows", type=int, default=150, help="recording windows for --check")
+    args = parser.parse_args()
+
+    model = read_model(args.model)
+    chunks = plan_chunks(model, args.min_bytes, args.min_zero_run)
+    packed = pack(model, chunks)
+    decoded = unpack(packed)
+    if decoded != rounded_model(model, chunks):
+        sys.exit("Packed model does not decode back to the rounded model")
+
+    for codec in (HALF, ZERO, COPY):
+        sizes = [size for c, _, size in chunks if c == codec]
+        print(f"{CODEC_NAMES[codec]:<5} {len(sizes):>4} chunks {sum(sizes):>7} bytes")
+    print(f"{len(model)} -> {len(packed)} bytes ({len(model) / len(packed):.2f}x)")
+    write_cpp(packed, args.output, args.model, args.symbol)
+    print(f"Wrote {args.output}")
+
+    if args.check:
+        windows = reference_windows() + recording_windows(args.recordings, args.windows)
+        changed, worst = check(model, decoded, windows)
+        print(f"{len(windows)} windows: {changed} class changes, largest probability difference {worst:.4f}")
+        if changed:
+            sys.exit(1)
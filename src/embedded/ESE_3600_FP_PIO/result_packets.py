@@ -0,0 +1,90 @@
+import struct
+import sys
+
+# Host-side decoder for the binary classification results sent over BLE
+# (see src/utils/hardware/result_packet.h for the layout).
+
+VERSION = 3
+HEADER = struct.Struct("<BBB")
+LABELS = ["l_i", "n_l", "o_a", "p_f", "p_m", "s_w"]
+LIFT_LABELS = ["dC", "bP", "dF"]
+PHASE_LABELS = ["rest", "lowering", "lifting"]
+NO_HEAD = 0xFF
+
+
+def head_label(labels, idx):
+    """Label of a secondary head's class, None if the model has no such head"""
+    if idx == NO_HEAD:
+        return None
+    return labels[idx] if idx < len(labels) else str(idx)
+
+
+def decode_batch(packet):
+    """Decode one BLE write into a list of result dicts"""
+    if len(packet) < HEADER.size:
+        raise ValueError("Packet shorter than header")
+    version, class_count, record_count = HEADER.unpack_from(packet)
+    if version != VERSION:
+        raise ValueError(f"Unsupported result packet version {version}")
+
+    record = struct.Struct(f"<HB{class_count}BIHHHHBB")
+    if len(packet) != HEADER.size + record_count * record.size:
+        raise ValueError("Packet length does not match record count")
+
+    results = []
+    for i in range(record_count):
+        fields = record.unpack_from(packet, HEADER.size + i * record.size)
+        seq, class_idx = fields[0], fields[1]
+        probabilities = [p / 255 for p in fields[2 : 2 + class_count]]
+        inference_us, rep_count, concentric_ms, eccentric_ms, rom_deg, lift_idx, phase_idx = fields[2 + class_count :]
+        results.append(
+            {
+                "seq": seq,
+                "class_idx": class_idx,
+                "label": LABELS[class_idx] if class_idx < len(LABELS) else str(class_idx),
+                "probabilities": probabilities,
+                "inference_us": inference_us,
+                "rep_count": rep_count,
+                "concentric_ms": concentric_ms,
+                "eccentric_ms": eccentric_ms,
+                "rom_deg": rom_deg,
+                "lift": head_label(LIFT_LABELS, lift_idx),
+                "phase": head_label(PHASE_LABELS, phase_idx),
+            }
+        )
+    return results
+
+
+class SequenceTracker:
+    """Counts results lost between packets using the 16-bit sequence number"""
+
+    def __init__(self):
+        self.expected = None
+        self.received = 0
+        self.lost = 0
+
+    def update(self, seq):
+        if self.expected is not None:
+            self.lost += (seq - self.expected) & 0xFFFF
+        self.expected = (seq + 1) & 0xFFFF
+        self.received += 1
+
+
+if __name__ == "__main__":
+    # Decode hex-encoded packets, one per line (e.g. copied from a BLE sniffer or app log)
+    tracker = SequenceTracker()
+    for line in sys.stdin:
+        line = line.strip()
+        if not line:
+            continue
+        for result in decode_batch(bytes.fromhex(line)):
+            tracker.update(result["seq"])
+            probs = " ".join(f"{p:.2f}" for p in result["probabilities"])
+            heads = "".join(f", {name} {result[name]}" for name in ("lift", "phase") if result[name] is not None)
+            print(
+                f"#{result['seq']} {result['label']} [{probs}] "
+                f"{result['inference_us']} us, reps {result['rep_count']}, "
+                f"ecc {result['eccentric_ms']} ms / con {result['concentric_ms']} ms, ROM {result['rom_deg']} deg"
+                f"{heads}"
+            )
+    print(f"received {tracker.received}, lost {tracker.lost}")
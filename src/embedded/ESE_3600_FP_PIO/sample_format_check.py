@@ -0,0 +1,104 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+from result_packets import VERSION, decode_batch
+from stream_receiver import read_packet_log
+
+# Equivalence check for the int16 sample path (SAMPLE_INT16, src/utils/tflite/imu_provider.h).
+# Replays the recordings through the float host build (pio run -e native) and the int16 one
+# (pio run -e native_int16) and compares, one window at a time, the preprocessed float model inputs
+# (--inputs) within --input-tolerance, then the BLE result records: the same class and probabilities
+# within --tolerance. Both builds run on the same virtual time, so the nth window or result of one
+# covers the same samples as the nth of the other.
+# The input tolerance is Q15 storage (1 / 32767 of the 0..1 range, rounded once per read) plus the
+# integer normalization's rounding, a few Q15 steps at most: the model-rate profile, with no decimator
+# to average them down, is about 4.6e-5 apart on the current recordings.
+# Exits 1 on any difference beyond the tolerances.
+
+DEFAULT_FLOAT = os.path.join(".pio", "build", "native", "program")
+DEFAULT_INT16 = os.path.join(".pio", "build", "native_int16", "program")
+PIPELINES = ["scheduled", "reps"]
+IMU_PROFILES = ["oversample", "model"]
+
+
+def run_program(program, pipeline, imu_profile, replay):
+    """(model input windows, result records sent over BLE) of one replay"""
+    with tempfile.TemporaryDirectory() as scratch:
+        ble_log = os.path.join(scratch, "ble.bin")
+        inputs_path = os.path.join(scratch, "inputs.jsonl")
+        command = [
+            program,
+            "--pipeline", pipeline,
+            "--imu-profile", imu_profile,
+            "--replay", replay,
+            "--fs", os.path.join(scratch, "fs"),
+            "--ble-log", ble_log,
+            "--inputs", inputs_path,
+        ]
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        inputs = []
+        if os.path.exists(inputs_path):
+            with open(inputs_path) as f:
+                inputs = [json.loads(line)["input"] for line in f]
+        results = []
+        for packet in read_packet_log(ble_log):
+            if packet and packet[0] == VERSION:
+                results.extend(decode_batch(packet))
+        return inputs, results
+
+
+def compare_inputs(float_inputs, int16_inputs):
+    """Largest difference between any two model input values of the same window"""
+    worst = 0.0
+    for a, b in zip(float_inputs, int16_inputs):
+        worst = max(worst, max(abs(x - y) for x, y in zip(a, b)))
+    return worst
+
+
+def compare(float_results, int16_results):
+    """(mismatched classes, worst probability difference, compared count)"""
+    mismatched, worst = 0, 0.0
+    for a, b in zip(float_results, int16_results):
+        if a["class_idx"] != b["class_idx"]:
+            mismatched += 1
+        worst = max(worst, max(abs(p - q) for p, q in zip(a["probabilities"], b["probabilities"])))
+    return mismatched, worst, min(len(float_results), len(int16_results))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Check the int16 sample path against the float one")
+    parser.add_argument("--float-program", default=DEFAULT_FLOAT, help="host build without SAMPLE_INT16")
+    parser.add_argument("--int16-program", default=DEFAULT_INT16, help="host build with SAMPLE_INT16=1")
+    parser.add_argument("--replay", default="data", help="recording or directory of recordings to replay")
+    parser.add_argument("--pipelines", nargs="+", default=PIPELINES, choices=PIPELINES)
+    parser.add_argument("--imu-profiles", nargs="+", default=IMU_PROFILES, choices=IMU_PROFILES)
+    parser.add_argument("--tolerance", type=float, default=2 / 255, help="largest allowed probability difference")
+    parser.add_argument("--input-tolerance", type=float, default=1e-4, help="largest allowed model input difference")
+    args = parser.parse_args()
+
+    for program, env in ((args.float_program, "native"), (args.int16_program, "native_int16")):
+        if not os.path.exists(program):
+            sys.exit(f"{program} not found, build it with: pio run -e {env}")
+
+    failed = False
+    print(f"{'run':<22} {'windows':>8} {'max input diff':>15} {'results':>8} {'class diff':>11} {'max prob diff':>14}  status")
+    for pipeline in args.pipelines:
+        # The reps pipeline samples at its own rate whatever the profile
+        for imu_profile in args.imu_profiles if pipeline != "reps" else IMU_PROFILES[:1]:
+            float_inputs, float_results = run_program(args.float_program, pipeline, imu_profile, args.replay)
+            int16_inputs, int16_results = run_program(args.int16_program, pipeline, imu_profile, args.replay)
+            input_worst = compare_inputs(float_inputs, int16_inputs)
+            mismatched, worst, count = compare(float_results, int16_results)
+            ok = (input_worst <= args.input_tolerance and len(float_inputs) == len(int16_inputs)
+                  and mismatched == 0 and worst <= args.tolerance and len(float_results) == len(int16_results))
+            failed |= not ok
+            name = pipeline if pipeline == "reps" else f"{pipeline}/{imu_profile}"
+            windows = f"{len(float_inputs)}" if len(float_inputs) == len(int16_inputs) else f"{len(float_inputs)}/{len(int16_inputs)}"
+            results = f"{count}" if len(float_results) == len(int16_results) else f"{len(float_results)}/{len(int16_results)}"
+            print(f"{name:<22} {windows:>8} {input_worst:>15.2e} {results:>8} {mismatched:>11} {worst:>14.4f}  "
+                  f"{'ok' if ok else 'DIFFERENT'}")
+    sys.exit(1 if failed else 0)
@@ -0,0 +1,130 @@
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+import model_pack
+
+# Runs the host build (pio run -e native) over recorded sessions under virtual time, once per
+# pipeline mode, and compares feedback latency, duty cycle, CPU time and sample coverage.
+# Everything is driven by virtual time and the cost model, so runs are deterministic.
+# The reps mode is also scored on how well its segmenter finds the one rep each recording holds.
+# With --imu-profiles each windowed mode runs once per IMU acquisition profile (imu_provider.h), so the
+# 1 kHz oversample+decimate path can be compared with the model-rate one on accuracy, I2C reads and
+# awake time.
+# The host build's model is a stand-in, so accuracy is scored here by running the real model
+# (model_pack.py's interpreter on model.cpp) on every window the host wrote with --inputs, against the
+# class recorded for the session the result fell in.
+# Every report also carries the time spent in each power state (src/utils/power/power.h). The default 2 s
+# rest gap never reaches the idle timeout, pass e.g. --gap 60000 to see the device sleep between sessions
+# (--idle-timeout MS changes the timeout, 0 turns sleeping off).
+
+MODES = ["blocking", "scheduled", "sleep", "reps"]
+IMU_PROFILES = ["oversample", "model"]
+DEFAULT_PROGRAM = os.path.join(".pio", "build", "native", "program")
+
+
+def run_mode(program, mode, imu_profile, replay, profile, interpreter, extra_args):
+    with tempfile.TemporaryDirectory() as scratch:
+        report_path = os.path.join(scratch, "report.json")
+        inputs_path = os.path.join(scratch, "inputs.jsonl")
+        command = [
+            program,
+            "--pipeline", mode,
+            "--imu-profile", imu_profile,
+            "--replay", replay,
+            "--profile", profile,
+            "--fs", os.path.join(scratch, "fs"),
+            "--ble-log", os.path.join(scratch, "ble.bin"),
+            "--report", report_path,
+            "--inputs", inputs_path,
+        ] + extra_args
+        subprocess.run(command, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        with open(report_path) as f:
+            report = json.load(f)
+        records = []
+        if os.path.exists(inputs_path):
+            with open(inputs_path) as f:
+                records = [json.loads(line) for line in f]
+        report["imu_profile"] = imu_profile
+        report["model"] = model_pack.score(interpreter, records, report["classification"]["expected"])
+        return report
+
+
+def print_table(reports):
+    header = (
+        f"{'mode':<21} {'LED p50/p90/p99 ms':>22} {'BLE p50/p90/p99 ms':>22} "
+        f"{'duty':>6} {'busy':>6} {'imu':>6} {'infer':>6} {'serial':>6} {'missed':>8} {'results':>7} {'invokes':>7} "
+        f"{'I2C/s':>6} {'correct':>8}"
+    )
+    print(header)
+    print("-" * len(header))
+    for r in reports:
+        led, ble, t = r["led_latency"], r["ble_latency"], r["time_fraction"]
+        samples = r["samples"]
+        missed = samples["missed"] / samples["replayed"] if samples["replayed"] else 0
+        transfers_per_s = samples["transfers"] / (r["virtual_ms"] / 1000) if r["virtual_ms"] else 0
+        name = r["pipeline"] if r["pipeline"] == "reps" else f"{r['pipeline']}/{r['imu_profile']}"
+        print(
+            f"{name:<21} "
+            f"{led['p50_ms']:>8.0f}/{led['p90_ms']:.0f}/{led['p99_ms']:<6.0f} "
+            f"{ble['p50_ms']:>8.0f}/{ble['p90_ms']:.0f}/{ble['p99_ms']:<6.0f} "
+            f"{r['duty_cycle']:>6.1%} {r['cpu_busy']:>6.1%} {t['imu_read']:>6.1%} {t['inference']:>6.1%} "
+            f"{t['serial']:>6.1%} {missed:>8.1%} {r['results']:>7} {r.get('invokes', 0):>7} "
+            f"{transfers_per_s:>6.0f} {r['model']['accuracy']:>8.1%}"
+        )
+    print()
+    for r in reports:
+        name = r["pipeline"] if r["pipeline"] == "reps" else f"{r['pipeline']}/{r['imu_profile']}"
+        model = r["model"]
+        predicted = sorted(model["predicted"].items(), key=lambda item: -item[1])
+        shares = ", ".join(f"{label} {count / model['in_session']:.0%}" for label, count in predicted if count)
+        print(f"{name}: model {model['correct']} of {model['in_session']} correct, predicts {shares or 'nothing'}")
+    print()
+    for r in reports:
+        power = r.get("power", {})
+        fractions = power.get("time_fraction", {})
+        name = r["pipeline"] if r["pipeline"] == "reps" else f"{r['pipeline']}/{r['imu_profile']}"
+        states = ", ".join(f"{state} {fraction:.1%}" for state, fraction in fractions.items())
+        line = f"{name}: power {states or 'not reported'}"
+        if power.get("sessions_asleep"):
+            line += (
+                f"; {power['entered'].get('sleep', 0)} sleeps, {power['sessions_asleep']} sessions started asleep, "
+                f"woke after p50 {power['wake_p50_ms']:.0f} ms, max {power['wake_max_ms']:.0f} ms"
+            )
+        print(line)
+    for r in reports:
+        reps = r.get("reps", {})
+        if reps.get("detected"):
+            print(
+                f"\n{r['pipeline']}: {reps['detected']} reps over {r['sessions']} sessions, "
+                f"{reps['sessions_one']} with exactly one, {reps['sessions_none']} missed, "
+                f"{reps['sessions_more']} split, {reps['outside']} found in rest gaps"
+            )
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compare inference pipeline modes on the host build")
+    parser.add_argument("--program", default=DEFAULT_PROGRAM, help="host build of the firmware")
+    parser.add_argument("--replay", default="data", help="recording or directory of recordings to replay")
+    parser.add_argument("--modes", nargs="+", default=MODES, choices=MODES)
+    parser.add_argument("--imu-profiles", nargs="+", default=IMU_PROFILES[:1], choices=IMU_PROFILES,
+                        help="acquisition profiles to run each windowed mode with")
+    parser.add_argument("--profile", default="esp32s3", help="device cost profile")
+    parser.add_argument("--model", default=model_pack.DEFAULT_MODEL, help="model.cpp or a .tflite file to score with")
+    parser.add_argument("--json", help="also write all reports to this file")
+    args, extra = parser.parse_known_args()
+
+    if not os.path.exists(args.program):
+        sys.exit(f"{args.program} not found, build it with: pio run -e native")
+
+    # The reps mode samples at its own rate whatever the profile
+    runs = [(mode, imu) for mode in args.modes for imu in (args.imu_profiles if mode != "reps" else IMU_PROFILES[:1])]
+    interpreter = model_pack.Interpreter(model_pack.read_model(args.model))
+    reports = [run_mode(args.program, mode, imu, args.replay, args.profile, interpreter, extra) for mode, imu in runs]
+    print_table(reports)
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(reports, f, indent=2)
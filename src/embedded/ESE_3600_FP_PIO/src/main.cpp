@@ -7,7 +7,16 @@ const bool run_inference = true;         // If true, inference is run on the dat
 const bool force_reformat = !copy_files; // If true, the file system will be reformatted during data collection setup
 const bool ble_enabled = true;           // If true, BLE is enabled
 const bool buzzer_enabled = true;        // If true, buzzer is enabled
+#ifdef ARDUINO
+const bool power_save_enabled = false;   // If true, light sleeps between sets until the MPU reports motion, needs INT wired to D9
+#else
+const bool power_save_enabled = true;    // The host runtime wires the replayed MPU's INT
+#endif
+const uint32_t motion_sleep_check_ms = 60000; // Longest single light sleep waiting for motion
+const uint32_t motion_sleep_retry_ms = 100;    // Awake pause after a wakeup that was neither motion nor timer
 const uint8_t LEDpins[5] = {D0, D1, D2, D3, D6};
+const uint8_t IMU_INT_PIN = D9; // MPU6050 INT, an RTC GPIO so it can also wake the chip
+PipelineMode pipeline_mode = PIPELINE_SCHEDULED; // Host builds can pick another with --pipeline
 
 // Data Collection Constants
 const String lift_names[3] = {"dC", "bP", "dF"}; // dumbbell curl, bench press, dumbbell flys
@@ -19,113 +28,657 @@ int current_lift_idx = 1; // {"l_i", "n_l", "o_a", "p_f", "p_m", "s_w"}
 const char *current_lift_name = getCurrentLiftName(current_lift_idx);
 
 // Define the buffer using the selected type
-extern float dataBuffer[];
+extern sample_t dataBuffer[];
 
-void setup()
+// Inference pipeline timing
+const uint16_t countdown_step_ms = 100; // Length of each countdown tone
+const int countdown_steps = 10;         // Alternating 100 Hz / 1000 Hz tones
+const uint16_t rest_ms = 2000;          // Pause between feedback and the next countdown
+const uint32_t cue_update_ms = 5;       // How often the cue queues are advanced
+const uint32_t console_poll_ms = 50;    // How often Serial is checked for console commands
+const uint32_t rep_sample_interval_ms = 5; // Rate of the training recordings, dataBuffer holds 5 s
+const uint32_t power_poll_ms = 250;     // How often the motion latch is read while awake
+const uint16_t motion_threshold_mg = 40; // Motion interrupt: high-passed acceleration on any axis...
+const uint8_t motion_duration_ms = 20;   // ... above the threshold for this long
+uint32_t idle_timeout_ms = 20000;        // No motion for this long and the device sleeps, "power idle MS" changes it
+
+// LED shown for each class {"l_i", "n_l", "o_a", "p_f", "p_m", "s_w"}, -1 for none
+const int8_t class_led_index[6] = {1, -1, 2, 0, 3, 4};
+
+// Inference pipeline tasks
+int sample_task = -1;
+SampleResampler window_resampler; // Puts each window's reads on a uniform grid in dataBuffer
+sample_t latest_sample[NUM_FEATURES]; // A failed read repeats the previous one
+uint32_t window_start_ms = 0;
+uint32_t window_end_ms = 0;
+
+// Rep pipeline: dataBuffer is a ring, rep_sample_count counts every sample written to it
+RepMetrics rep_metrics;
+RepSpan pending_rep;
+uint32_t rep_sample_count = 0;
+
+// Active / idle / asleep, see utils/power/power.h
+PowerManager power;
+
+// Binary results queued for BLE
+BleTransport ble_transport;
+ResultBatcher result_batcher;
+uint16_t result_seq = 0;
+
+// Serial console line being typed
+char console_line[32];
+size_t console_length = 0;
+
+// Queues the countdown tones, EVENT_CUE_FINISHED starts sampling when the last one ends
+void queueCountdown(uint16_t delay_ms)
 {
-  if (copy_files)
+  if (delay_ms > 0)
   {
-    copy_files_setup();
+    cueTone(0, delay_ms);
   }
-  else if (collect_data)
+  for (int i = 0; i < countdown_steps; i++)
   {
-    data_collection_setup();
+    uint16_t frequency = buzzer_enabled ? (i % 2 == 0 ? 100 : 1000) : 0;
+    cueTone(frequency, countdown_step_ms, i == countdown_steps - 1);
   }
-  else if (run_inference)
+}
+
+void cueFinished()
+{
+  traceInstant(TRACE_CUE_FINISHED);
+  schedulerPost(EVENT_CUE_FINISHED);
+}
+
+void cueTask()
+{
+  cuesUpdate();
+}
+
+void notePowerState()
+{
+  traceInstant(TRACE_POWER, power.state);
+#ifndef ARDUINO
+  hostNotePowerState(powerStateName(power.state));
+#endif
+}
+
+// Reads the motion latch, and moves to IDLE once the idle timeout has passed without motion
+void pollMotion()
+{
+  PowerState before = power.state;
+  if (mpuMotionSeen())
   {
-    // Setup IMU
-    imuSetup();
+    powerNoteMotion(&power, millis());
+  }
+  powerUpdate(&power, millis());
+  if (power.state != before)
+  {
+    notePowerState();
+  }
+}
 
-    // Setup TFLite
-    setupModel(false);
+// Light sleep until the motion interrupt. Blocks, so only called where no window or rep is in flight.
+void sleepUntilMotion()
+{
+  LOG_INFO("No motion for %u ms, sleeping", (unsigned)(millis() - power.last_motion_ms));
+  outputLights(-1);
+  cuesUpdate(); // LEDs off before the clock stops
+  powerEnterSleep(&power, millis());
+  notePowerState();
+
+  uint32_t asleep_ms = millis();
+  // Motion is the only way out. Each call lasts until motion or the timer, in light sleep or polling the
+  // pin awake if the chip refuses (halSleepUntilPin() logs that). A wakeup from anything else returns
+  // early, so wait a little before sleeping again rather than spin.
+  for (;;)
+  {
+    uint32_t slept_from = millis();
+    if (halSleepUntilPin(IMU_INT_PIN, true, motion_sleep_check_ms))
+      break;
+    // The latch is also read over I2C, so motion still wakes the device at the next timer wakeup if
+    // the INT line is not connected
+    if (mpuMotionSeen())
+      break;
+    if (millis() - slept_from < motion_sleep_retry_ms)
+      halDelay(motion_sleep_retry_ms);
   }
-  if (ble_enabled)
+  traceWake(millis() - asleep_ms);
+  mpuMotionSeen(); // Clears the latch
+
+  powerWake(&power, millis());
+  notePowerState();
+  // A new set starts: the last window before the sleep is not the previous window of the first one after,
+  // whatever the cache's window count says
+  resultCacheClear();
+  LOG_INFO("Motion, awake after %u ms", (unsigned)(millis() - asleep_ms));
+}
+
+void powerTask()
+{
+  pollMotion();
+  // The rep pipeline has no window boundary, a rep cannot be in flight after the idle timeout
+  if (pipeline_mode == PIPELINE_REPS && power.state == POWER_IDLE)
   {
-    BLEsetup();
+    sleepUntilMotion();
   }
-  if (buzzer_enabled)
+}
+
+// Starts a fresh window once the countdown cue has finished, or sleeps first if the lifter has stopped
+void startSamplingTask()
+{
+  if (power_save_enabled)
   {
-    buzzerSetup();
-    for (int i = 0; i < 5; i++)
+    pollMotion();
+    if (power.state == POWER_IDLE)
     {
-      pinMode(LEDpins[i], OUTPUT);
+      sleepUntilMotion();
+      queueCountdown(0); // Counts the lifter back in before the first window
+      return;
     }
   }
+
+  LOG_INFO("Starting Data Collection");
+  if (imuBeginWindow())
+  {
+    // A requested profile switch lands here, between windows: new read period and window length
+    LOG_INFO("IMU profile: %s", imuProfileName(imu_profile));
+    schedulerSetPeriod(sample_task, imuSampleIntervalMs());
+  }
+  traceBegin(TRACE_SAMPLING);
+  window_start_ms = millis();
+  SampleBuffer window{dataBuffer, BUFFER_LEN};
+  resamplerReset(&window_resampler, window, imuWindowSamples(), imuSampleIntervalMs() * 1000,
+                 preprocess_stream_window(window));
+  schedulerStart(sample_task);
 }
 
-void loop()
+// Failed IMU reads since the last call, once per window or rep rather than once per read
+void logReadFailures()
 {
-  if (copy_files)
+  static uint32_t reported = 0;
+  uint32_t failures = imuReadFailures();
+  if (failures != reported)
   {
-    handle_serial_commands();
+    LOG_WARN("%u IMU reads failed, each repeated the previous sample", (unsigned)(failures - reported));
+    reported = failures;
   }
-  else if (collect_data)
+}
+
+void logJitter(const SampleJitter &jitter)
+{
+  LOG_INFO("Sampling: %u reads, interval %.0f us (sd %.0f, %u-%u), %u late", (unsigned)jitter.intervals + 1,
+           jitter.mean_us, jitterStddevUs(&jitter), (unsigned)jitter.min_us, (unsigned)jitter.max_us,
+           (unsigned)jitter.late);
+  logReadFailures();
+}
+
+// Reads one sample per period until the resampled window is full
+void sampleTask()
+{
+  uint32_t now_us = micros();
+  imuCollectSample(latest_sample);
+  schedulerPost(EVENT_SAMPLE_READY);
+
+  if (!resamplerPush(&window_resampler, now_us, latest_sample))
   {
-    data_collection_loop();
+    return;
   }
-  else if (run_inference)
+
+  schedulerStop(sample_task);
+  window_end_ms = millis();
+  traceEnd(TRACE_SAMPLING, resamplerReads(&window_resampler));
+  logJitter(window_resampler.jitter);
+  if (buzzer_enabled)
   {
+    cueTone(1000, 100); // Plays while inference runs
+  }
+  LOG_INFO("Collected Data");
+  schedulerPost(EVENT_WINDOW_READY);
+}
+
+// Host builds score each result against the replayed session its samples came from
+void noteResult(uint32_t first_ms, uint32_t last_ms)
+{
+#ifndef ARDUINO
+  hostNoteResult(labels[current_lift_idx], first_ms + (last_ms - first_ms) / 2);
+#endif
+}
 
-    printf("Starting Data Collection\n");
+void inferenceTask()
+{
+  traceBegin(TRACE_INFERENCE);
+  doInference(); // This updates the current_lift_idx
+  traceEnd(TRACE_INFERENCE, current_lift_idx);
+  noteResult(window_start_ms, window_end_ms);
+  schedulerPost(EVENT_INFERENCE_DONE);
+}
 
-    if (buzzer_enabled)
+// Samples into the ring and feeds the segmenter and tempo metrics, EVENT_REP_READY once a rep has finished.
+// A rep is at most REP_MAX_MS + REP_REST_MS old when it finishes, which still fits in the ring.
+void repSampleTask()
+{
+  static float gyro[3] = {}; // Repeats too if a read fails
+  imuCollectSample(latest_sample, gyro);
+  SampleBuffer{dataBuffer, BUFFER_LEN}.write(rep_sample_count % BUFFER_LEN, latest_sample);
+  RepSpan rep;
+  if (repMetricsAdd(&rep_metrics, millis(), gyro, &rep))
+  {
+    pending_rep = rep;
+    traceInstant(TRACE_REP, rep.end_ms - rep.start_ms);
+    schedulerPost(EVENT_REP_READY);
+  }
+  rep_sample_count++;
+}
+
+void repInferenceTask()
+{
+  uint32_t count = pending_rep.last_sample - pending_rep.first_sample + 1;
+  LOG_INFO("Rep %u: %u-%u ms, %u samples", (unsigned)rep_metrics.segmenter.reps, (unsigned)pending_rep.start_ms,
+           (unsigned)pending_rep.end_ms, (unsigned)count);
+  LOG_INFO("Set %u rep %u: eccentric %u ms, concentric %u ms, ROM %.0f deg", (unsigned)rep_metrics.set_count,
+           (unsigned)rep_metrics.set_reps, (unsigned)rep_metrics.last.eccentric_ms,
+           (unsigned)rep_metrics.last.concentric_ms, rep_metrics.last.rom_deg);
+  logReadFailures();
+#ifndef ARDUINO
+  hostNoteRep(pending_rep.start_ms, pending_rep.end_ms);
+#endif
+
+  traceBegin(TRACE_INFERENCE);
+  doRepInference(pending_rep.first_sample, count);
+  traceEnd(TRACE_INFERENCE, current_lift_idx);
+  noteResult(pending_rep.start_ms, pending_rep.end_ms);
+  schedulerPost(EVENT_INFERENCE_DONE);
+}
+
+// Class of one of the model's other heads for the result record, RESULT_NO_HEAD if it does not have it
+static uint8_t headClass(const InferenceResult &result, ModelHead head)
+{
+  return result.heads[head].present ? (uint8_t)result.heads[head].class_idx : RESULT_NO_HEAD;
+}
+
+// Shows the result on the LEDs and queues it for BLE, with the lift and phase heads if the model has them
+static void showInferenceResult(const InferenceResult &result)
+{
+  traceBegin(TRACE_FEEDBACK, current_lift_idx);
+  // Light the pin that corresponds to the current lift, the rest go low
+  LOG_INFO("Current lift index: %d", current_lift_idx);
+  outputLights(class_led_index[current_lift_idx]);
+
+  if (ble_enabled && result.valid)
+  {
+    ResultRecord record;
+    makeResultRecord(&record, result_seq++, last_probabilities, label_count, current_lift_idx,
+                     last_inference_us);
+    record.lift_idx = headClass(result, HEAD_LIFT);
+    record.phase_idx = headClass(result, HEAD_PHASE);
+    if (pipeline_mode == PIPELINE_REPS)
     {
-      for (int i = 0; i < 5; i++)
-      {
-        buzz(100, 100);
-        buzz(1000, 100);
-      }
+      record.rep_count = rep_metrics.set_reps;
+      record.concentric_ms = (uint16_t)rep_metrics.last.concentric_ms; // Reps are at most REP_MAX_MS
+      record.eccentric_ms = (uint16_t)rep_metrics.last.eccentric_ms;
+      record.rom_deg = (uint16_t)(rep_metrics.last.rom_deg + 0.5f);
     }
-    // Collect data
-    imuCollect(dataBuffer);
+    // Each result is a finished window or rep, send it now; the batch only collects what piles up while
+    // the link is down, up to the MTU
+    resultBatcherAdd(&result_batcher, record, millis());
+    resultBatcherFlush(&result_batcher, ble_transport, millis(), true);
+  }
+  traceEnd(TRACE_FEEDBACK, current_lift_idx);
+}
 
-    if (buzzer_enabled)
+// Event task: the result inferenceTask() or repInferenceTask() left in last_result
+void showResult()
+{
+  showInferenceResult(last_result);
+}
+
+void feedbackTask()
+{
+  showResult();
+  queueCountdown(rest_ms);
+}
+
+// Advances the BLE scan/connect state machine and sends batched results, never blocks
+void bleTask()
+{
+  BLEloop();
+  resultBatcherFlush(&result_batcher, ble_transport, millis());
+}
+
+void bleStateChanged(BleState state)
+{
+  traceInstant(TRACE_BLE_STATE, state);
+  if (state == BLE_READY)
+  {
+    schedulerPost(EVENT_BLE_CONNECTED);
+  }
+}
+
+// Runs one console command: "trace", "trace ble", "trace clear", "log", "mem", "model [reload]", "lift [NAME]",
+// "cache", "bench", "kernels", "jitter", "imu [oversample|model]" or "power [idle MS]"
+void runConsoleCommand(const String &cmd)
+{
+  if (cmd == "trace")
+  {
+    traceDump(Serial);
+  }
+  else if (cmd == "trace ble")
+  {
+    Serial.println(traceDumpPackets(ble_transport) ? "Trace sent over BLE" : "BLE not ready, trace not sent");
+  }
+  else if (cmd == "trace clear")
+  {
+    traceClear();
+    Serial.println("Trace cleared");
+  }
+  else if (cmd == "mem")
+  {
+    memoryReport(Serial, tensorArenaUsedBytes(), tensorArenaSize());
+  }
+  else if (cmd == "model" || cmd == "model reload")
+  {
+    // A reload times a full switch: decode, interpreter and tensor allocation
+    if (cmd == "model reload" && !selectLiftModel(current_lift.c_str(), true))
+      Serial.println("Model reload failed");
+    modelLoadReport(Serial, tensorArenaSize());
+  }
+  else if (cmd == "lift" || cmd.startsWith("lift "))
+  {
+    String name = cmd.substring(4);
+    name.trim();
+    if (name.length() > 0)
     {
-      buzz(1000, 100);
+      // On failure the report shows the model that stayed resident
+      if (selectLiftModel(name.c_str(), false))
+        current_lift = name;
+      else
+        Serial.printf("No model loaded for lift %s\n", name.c_str());
     }
+    modelLoadReport(Serial, tensorArenaSize());
+  }
+  else if (cmd == "cache")
+  {
+    resultCacheReport(Serial);
+  }
+  else if (cmd == "bench")
+  {
+    benchReport(Serial);
+  }
+  else if (cmd == "kernels")
+  {
+    kernelCheckReport(Serial);
+  }
+  else if (cmd == "jitter")
+  {
+    const SampleJitter &jitter = window_resampler.jitter;
+    Serial.printf("Last window: %u reads onto %d points every %u us\n", (unsigned)resamplerReads(&window_resampler),
+                  window_resampler.written, (unsigned)window_resampler.period_us);
+    Serial.printf("IMU read failures since boot: %u\n", (unsigned)imuReadFailures());
+    if (jitter.intervals > 0)
+      Serial.printf("Interval: mean %.1f us, sd %.1f us, min %u us, max %u us, %u late\n", jitter.mean_us,
+                    jitterStddevUs(&jitter), (unsigned)jitter.min_us, (unsigned)jitter.max_us, (unsigned)jitter.late);
+  }
+  else if (cmd == "imu" || cmd.startsWith("imu "))
+  {
+    String name = cmd.substring(3);
+    name.trim();
+    int profile = name.length() > 0 ? imuProfileFromName(name.c_str()) : (int)imuPendingProfile();
+    if (profile < 0)
+    {
+      Serial.printf("Unknown IMU profile: %s\n", name.c_str());
+      return;
+    }
+    imuRequestProfile((ImuProfile)profile);
+    Serial.printf("IMU profile: %s, %d samples every %u ms per window\n", imuProfileName(imu_profile),
+                  imuWindowSamples(), (unsigned)imuSampleIntervalMs());
+    if (imuPendingProfile() != imu_profile)
+      Serial.printf("Switching to %s from the next window\n", imuProfileName(imuPendingProfile()));
+  }
+  else if (cmd == "power" || cmd.startsWith("power idle "))
+  {
+    if (cmd.startsWith("power idle "))
+    {
+      idle_timeout_ms = strtoul(cmd.substring(11).c_str(), nullptr, 10);
+      power.idle_timeout_ms = idle_timeout_ms;
+    }
+    uint32_t now = millis();
+    Serial.printf("Power: %s, sleeps after %u ms without motion%s\n", powerStateName(power.state),
+                  (unsigned)power.idle_timeout_ms, power_save_enabled && power.idle_timeout_ms ? "" : " (off)");
+    for (int state = 0; state < POWER_STATE_COUNT; state++)
+    {
+      Serial.printf("  %-6s %lu ms\n", powerStateName((PowerState)state),
+                    (unsigned long)powerTimeInState(&power, (PowerState)state, now));
+    }
+    Serial.printf("  %u sleeps, light sleep refused %u times\n", (unsigned)power.sleeps,
+                  (unsigned)halSleepRejections());
+  }
+  else if (cmd == "log")
+  {
+    if (LOG_BINARY)
+      logDump(Serial);
+    else
+      Serial.println("Binary logging is off (build with -DLOG_BINARY=1)");
+  }
+  else if (cmd.length() > 0)
+  {
+    Serial.printf("Unknown command: %s\n", cmd.c_str());
+  }
+}
 
-    printf("Collected Data\n");
+// Collects console input without blocking, a command runs once its newline arrives
+void consoleTask()
+{
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    if (c == '\n' || c == '\r')
+    {
+      console_line[console_length] = '\0';
+      console_length = 0;
+      String cmd = console_line;
+      cmd.trim();
+      runConsoleCommand(cmd);
+    }
+    else if (console_length < sizeof(console_line) - 1)
+    {
+      console_line[console_length++] = c;
+    }
+  }
+}
 
-    // Run inference
-    doInference(); // This updates the current_lift_idx
+void setupInferenceTasks()
+{
+  schedulerStart(schedulerAddTimedTask("cues", cueTask, cue_update_ms));
+  if (pipeline_mode == PIPELINE_REPS)
+  {
+    // No countdown, the lifter just lifts and each rep gets its own result
+    repMetricsReset(&rep_metrics, current_lift != "dC"); // Curls start at the bottom, presses and flys at the top
+    schedulerStart(schedulerAddTimedTask("rep_sample", repSampleTask, rep_sample_interval_ms));
+    schedulerAddEventTask("rep_inference", repInferenceTask, EVENT_REP_READY);
+    schedulerAddEventTask("feedback", showResult, EVENT_INFERENCE_DONE);
+  }
+  else
+  {
+    sample_task = schedulerAddTimedTask("sample", sampleTask, imuSampleIntervalMs());
+    schedulerAddEventTask("start_sampling", startSamplingTask, EVENT_CUE_FINISHED);
+    schedulerAddEventTask("inference", inferenceTask, EVENT_WINDOW_READY);
+    schedulerAddEventTask("feedback", feedbackTask, EVENT_INFERENCE_DONE);
+  }
+  schedulerStart(schedulerAddTimedTask("console", consoleTask, console_poll_ms));
+  if (power_save_enabled)
+  {
+    schedulerStart(schedulerAddTimedTask("power", powerTask, power_poll_ms));
+  }
 
-    // Get the current lift name
-    const char *current_lift_name = getCurrentLiftName(current_lift_idx);
+  if (ble_enabled)
+  {
+    BLEsetStateCallback(bleStateChanged);
+    schedulerStart(schedulerAddTimedTask("ble", bleTask, 100));
+  }
 
-    // Set all the pins to low
-    for (int i = 0; i < 5; i++)
+  if (pipeline_mode != PIPELINE_REPS)
+  {
+    cueSetFinishedCallback(cueFinished);
+    queueCountdown(0);
+  }
+}
+
+// One pass of the original blocking pipeline, nothing else runs until it returns.
+// Kept as a baseline the scheduled pipeline is measured against (simulate.py).
+void runBlockingCycle()
+{
+  if (power_save_enabled)
+  {
+    pollMotion();
+    if (power.state == POWER_IDLE)
     {
-      digitalWrite(LEDpins[i], LOW);
+      sleepUntilMotion();
     }
+  }
 
-    // Set the pin that corresponds to the current lift high and the rest low
-    printf("Current lift index: %d\n", current_lift_idx);
-    switch (current_lift_idx)
+  LOG_INFO("Starting Data Collection");
+  if (buzzer_enabled)
+  {
+    for (int i = 0; i < countdown_steps; i++)
     {
-    case 0:
-      digitalWrite(LEDpins[1], HIGH);
-      break;
-    case 2:
-      digitalWrite(LEDpins[2], HIGH);
-      break;
-    case 3:
-      digitalWrite(LEDpins[0], HIGH);
-      break;
-    case 4:
-      digitalWrite(LEDpins[3], HIGH);
-      break;
-    case 5:
-      digitalWrite(LEDpins[4], HIGH);
-      break;
-    default:
-      break;
+      buzz(i % 2 == 0 ? 100 : 1000, countdown_step_ms);
     }
+  }
 
-    if (ble_enabled)
+  if (imuBeginWindow())
+  {
+    LOG_INFO("IMU profile: %s", imuProfileName(imu_profile));
+  }
+  traceBegin(TRACE_SAMPLING);
+  window_start_ms = millis();
+  SampleBuffer window{dataBuffer, BUFFER_LEN};
+  resamplerReset(&window_resampler, window, imuWindowSamples(), imuSampleIntervalMs() * 1000,
+                 preprocess_stream_window(window));
+  imuCollect(&window_resampler);
+  window_end_ms = millis();
+  traceEnd(TRACE_SAMPLING, resamplerReads(&window_resampler));
+  logJitter(window_resampler.jitter);
+  if (buzzer_enabled)
+  {
+    buzz(1000, 100);
+  }
+  LOG_INFO("Collected Data");
+
+  traceBegin(TRACE_INFERENCE);
+  const InferenceResult &result = doInference();
+  traceEnd(TRACE_INFERENCE, current_lift_idx);
+  noteResult(window_start_ms, window_end_ms);
+  showInferenceResult(result);
+  cuesUpdate(); // Apply the LED pattern now, nothing else will call it
+
+  if (ble_enabled)
+  {
+    BLEloop();
+  }
+  consoleTask();
+  delay(rest_ms);
+}
+
+#ifndef ARDUINO
+static PipelineMode pipelineModeFromName(const std::string &name)
+{
+  if (name == "blocking")
+    return PIPELINE_BLOCKING;
+  if (name == "sleep")
+    return PIPELINE_SCHEDULED_SLEEP;
+  if (name == "reps")
+    return PIPELINE_REPS;
+  return PIPELINE_SCHEDULED;
+}
+#endif
+
+void setup()
+{
+#ifndef ARDUINO
+  pipeline_mode = pipelineModeFromName(hostConfig().pipeline);
+  if (!hostConfig().decimator.empty())
+  {
+    int filter = decimatorFromName(hostConfig().decimator.c_str());
+    if (filter < 0)
+      printf("Unknown decimator %s, keeping %s\n", hostConfig().decimator.c_str(), decimatorName(decimator_filter));
+    else
+      decimator_filter = filter;
+  }
+  if (!hostConfig().imu_profile.empty())
+  {
+    int profile = imuProfileFromName(hostConfig().imu_profile.c_str());
+    if (profile < 0)
+      printf("Unknown IMU profile %s, keeping %s\n", hostConfig().imu_profile.c_str(), imuProfileName(imu_profile));
+    else
+      imuRequestProfile((ImuProfile)profile);
+  }
+  if (!hostConfig().idle_timeout.empty())
+  {
+    idle_timeout_ms = strtoul(hostConfig().idle_timeout.c_str(), nullptr, 10);
+  }
+#endif
+  scheduler_light_sleep = pipeline_mode == PIPELINE_SCHEDULED_SLEEP;
+
+  if (copy_files)
+  {
+    copy_files_setup();
+  }
+  else if (collect_data)
+  {
+    data_collection_setup();
+  }
+  else if (run_inference)
+  {
+    Serial.begin(115200); // Console commands, see runConsoleCommand()
+    traceClear();
+
+    // Setup IMU
+    imuSetup();
+    powerReset(&power, power_save_enabled ? idle_timeout_ms : 0, millis());
+    if (power_save_enabled)
     {
-      // printf("BLE loop\n\n");
-      BLEloop(String("Lift was classified as: ") + current_lift_name);
+      mpuEnableMotionInterrupt(IMU_INT_PIN, motion_threshold_mg, motion_duration_ms);
+      notePowerState();
     }
-    delay(2000);
+
+    // Setup TFLite
+    setupModel(false);
+  }
+  if (ble_enabled)
+  {
+    resultBatcherReset(&result_batcher);
+    BLEsetup();
+  }
+  if (buzzer_enabled)
+  {
+    cuesSetup(BUZZER_PIN, LEDpins); // LEDC buzzer and LED pins, driven by the cue queues
+  }
+  if (run_inference && !copy_files && !collect_data && pipeline_mode != PIPELINE_BLOCKING)
+  {
+    setupInferenceTasks();
+  }
+  if (run_inference && !copy_files && !collect_data)
+  {
+    memoryReport(Serial, tensorArenaUsedBytes(), tensorArenaSize()); // Headroom once everything is allocated
+  }
+}
+
+void loop()
+{
+  if (copy_files)
+  {
+    handle_serial_commands();
   }
-}
\ No newline at end of file
+  else if (collect_data)
+  {
+    data_collection_loop();
+  }
+  else if (run_inference && pipeline_mode == PIPELINE_BLOCKING)
+  {
+    runBlockingCycle();
+  }
+  else if (run_inference)
+  {
+    schedulerRunOnce();
+  }
+}
@@ -4,16 +4,43 @@
 #include "utils/data_ops/data_collection.h"
 #include "utils/data_ops/copy_files.h"
 #include "utils/tflite/inference.h"
+#include "utils/tflite/model_pack.h"
+#include "utils/tflite/result_cache.h"
 #include "utils/tflite/imu_provider.h"
 #include "utils/hardware/ble.h"
+#include "utils/hardware/result_packet.h"
 #include "utils/hardware/buzzer.h"
+#include "utils/hardware/cues.h"
+#include "utils/scheduler/scheduler.h"
+#include "utils/trace/trace.h"
+#include "utils/log/log.h"
+#include "utils/memory/memory_stats.h"
+#include "utils/bench/bench.h"
+#include "utils/kernels/kernel_check.h"
+#include "utils/reps/rep_metrics.h"
+#include "utils/power/power.h"
+#include "utils/hardware/mpu.h"
+#include "utils/hal/hal.h"
 
 #include "utils/tflite/pre_process.h"
+#include "utils/tflite/decimator.h"
+#include "utils/tflite/resampler.h"
 
 // Setup Flags
 extern const bool copy_files;
 extern const bool force_reformat;
 
+// How the inference pipeline runs
+enum PipelineMode
+{
+  PIPELINE_SCHEDULED,       // Cooperative scheduler, idle time in vTaskDelay
+  PIPELINE_SCHEDULED_SLEEP, // Cooperative scheduler, idle time in light sleep
+  PIPELINE_BLOCKING,        // Original loop: countdown, collect, infer and rest back to back
+  PIPELINE_REPS             // Samples continuously, classifies each rep the segmenter finds
+};
+
+extern PipelineMode pipeline_mode;
+
 // Data Collection Constants
 extern const String lift_names[3];
 extern String current_lift;
@@ -22,8 +49,14 @@ extern String current_lift;
 extern const char buffer_type;
 
 // Define the buffer using the selected type
-extern float dataBuffer[];
+extern sample_t dataBuffer[];
+
+// MPU6050 motion interrupt, wakes the chip from light sleep
+extern const uint8_t IMU_INT_PIN;
 
 // Setup and Loop functions
 void setup();
 void loop();
+
+// Light sleep until the motion interrupt, then a fresh session: results from before it are not reused
+void sleepUntilMotion();
@@ -0,0 +1,376 @@
+#include "bench.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <algorithm>
+#include "../hal/hal.h"
+#include "../data_ops/imu_codec.h"
+#include "../tflite/inference.h"
+#include "../reps/rep_metrics.h"
+#include "../tflite/decimator.h"
+#include "../tflite/resampler.h"
+#include "../tflite/sample_store.h"
+#include "../kernels/kernels.h"
+
+#ifdef ARDUINO
+static const char *const platform_name = "esp32s3";
+#else
+static const char *const platform_name = "host";
+#endif
+
+static const char *const bench_file = "/bench.rmc";
+
+// Scratch for the duration of one run, allocated so the benchmark costs no static RAM
+static sample_t *window = nullptr; // BUFFER_LEN samples
+static sample_t *resampled = nullptr; // BUFFER_LEN samples
+static float *averaged = nullptr; // Model input sized
+static float *readings = nullptr; // BUFFER_LEN raw float readings
+static float *probabilities = nullptr;
+static float *gyro_trace = nullptr; // BUFFER_LEN gyro readings at 5 ms, a rep and its rest
+static RepMetrics *rep_metrics_state = nullptr;
+static uint32_t rep_metrics_ms = 0; // Keeps advancing across repeats
+static File record_file;
+static uint8_t record_block[512];
+static volatile float sink; // Keeps results alive so calls are not optimised away
+
+// Fixed float work that no pipeline change touches. bench_gate.py compares every stage relative to it,
+// so a baseline carries over between machines and clock speeds.
+static __attribute__((noinline)) void benchCalibrate(int call)
+{
+  float acc = (float)call;
+  for (int i = 0; i < BENCH_CALIBRATE_STEPS; i++)
+    acc = acc * 0.999f + readings[i];
+  sink = acc;
+}
+
+// One window's worth of whichever normalization the build stores samples with
+static const float bench_min[NUM_FEATURES] = {-25.0f, -25.0f, -25.0f, -8.0f, -8.0f, -8.0f};
+static const float bench_inv_range[NUM_FEATURES] = {1 / 55.0f, 1 / 55.0f, 1 / 55.0f, 1 / 15.0f, 1 / 15.0f, 1 / 15.0f};
+
+static void benchNormalize(int call)
+{
+#if SAMPLE_INT16
+  int32_t sum = 0;
+  for (int i = 0; i < BUFFER_LEN; i++)
+  {
+    for (int channel = 0; channel < NUM_FEATURES; channel++)
+      sum += imuNormalizeRaw(channel, (int16_t)(window[i * NUM_FEATURES + channel] * 2 - SAMPLE_ONE));
+  }
+  sink = sum;
+#else
+  kernelNormalize(readings, resampled, BUFFER_LEN * NUM_FEATURES, bench_min, bench_inv_range);
+  sink = resampled[call % BUFFER_LEN];
+#endif
+}
+
+// The *_ref stages run the portable reference of each kernel (kernels.h) on the same data, for the
+// speedup of the build's implementation
+static void benchNormalizeRef(int call)
+{
+  kernelNormalizeReference(readings, averaged, OUTPUT_SEQUENCE_LENGTH * NUM_FEATURES, bench_min, bench_inv_range);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+static void benchNormalizeKernel(int call)
+{
+  kernelNormalize(readings, averaged, OUTPUT_SEQUENCE_LENGTH * NUM_FEATURES, bench_min, bench_inv_range);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+// A window of sinc outputs over float rows, as decimate() gathers them
+static void benchFir(void (*fir)(const float *const *, const float *, int, float, float, float *), int call)
+{
+  const DecimatorTaps *taps = decimatorTaps(DECIMATOR_SINC);
+  const float *rows[DECIMATOR_MAX_TAPS];
+  for (size_t i = 0; i < OUTPUT_SEQUENCE_LENGTH; i++)
+  {
+    for (int r = 0; r < taps->length; r++)
+      rows[r] = readings + ((i * DECIMATION_FACTOR + r) % BUFFER_LEN) * NUM_FEATURES;
+    fir(rows, taps->taps, taps->length, taps->gain, 1.0f, averaged + i * NUM_FEATURES);
+  }
+  sink = averaged[call % NUM_FEATURES];
+}
+
+static void benchFirRef(int call)
+{
+  benchFir(kernelFir6Reference, call);
+}
+
+static void benchFirKernel(int call)
+{
+  benchFir(kernelFir6, call);
+}
+
+static void benchImuSample(int call)
+{
+  sample_t sample[NUM_FEATURES];
+  imuCollectSample(sample);
+  SampleBuffer{window, BUFFER_LEN}.write(call % BUFFER_LEN, sample);
+}
+
+static void benchWindowAvg(int call)
+{
+  preprocess_buffer_to_input(SampleBuffer{window, BUFFER_LEN}, averaged);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+// One window through each decimation filter, window_avg above uses the selected one
+static void benchDecimate(int filter, int call)
+{
+#if SAMPLE_LAYOUT == SAMPLE_LAYOUT_CHANNEL_MAJOR
+  decimateChannelMajor(decimatorTaps(filter), window, BUFFER_LEN, BUFFER_LEN, averaged, OUTPUT_SEQUENCE_LENGTH,
+                       SAMPLE_TO_FLOAT);
+#else
+  decimate(decimatorTaps(filter), window, BUFFER_LEN, averaged, OUTPUT_SEQUENCE_LENGTH, SAMPLE_TO_FLOAT);
+#endif
+  sink = averaged[call % NUM_FEATURES];
+}
+
+static void benchDecimateBoxcar(int call)
+{
+  benchDecimate(DECIMATOR_BOXCAR, call);
+}
+
+static void benchDecimateSinc(int call)
+{
+  benchDecimate(DECIMATOR_SINC, call);
+}
+
+static void benchDecimateCic(int call)
+{
+  benchDecimate(DECIMATOR_CIC, call);
+}
+
+// The same window pushed a read at a time through the selected filter, as the resampler streams it
+static void benchDecimateStream(int call)
+{
+  Decimator<sample_t> decimator;
+  decimatorReset(&decimator, decimatorTaps(decimator_filter), averaged, OUTPUT_SEQUENCE_LENGTH, SAMPLE_TO_FLOAT);
+  for (int i = 0; i < BUFFER_LEN; i++)
+    decimatorPush(&decimator, window + i * NUM_FEATURES);
+  decimatorFinish(&decimator);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+// Both layouts in every build, whichever SAMPLE_LAYOUT picked. Store: a window written a read at a time
+template <int Layout>
+static void benchStore(int call)
+{
+  SampleStore<Layout> store{resampled, BUFFER_LEN};
+  for (int i = 0; i < BUFFER_LEN; i++)
+    store.write(i, window + i * NUM_FEATURES);
+  sink = resampled[call % BUFFER_LEN];
+}
+
+// A model-rate window to model input
+template <int Layout>
+static void benchToInput(int call)
+{
+  storeToInput(SampleStore<Layout>{window, BUFFER_LEN}, OUTPUT_SEQUENCE_LENGTH, averaged);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+// A 1 kHz window box-averaged to model input
+template <int Layout>
+static void benchBoxcar(int call)
+{
+  storeBoxcar(SampleStore<Layout>{window, BUFFER_LEN}, BUFFER_LEN, DECIMATION_FACTOR, averaged);
+  sink = averaged[call % NUM_FEATURES];
+}
+
+// One window of reads, each up to 400 us late, onto the 1 ms grid
+static void benchResample(int call)
+{
+  SampleResampler resampler;
+  resamplerReset(&resampler, SampleBuffer{resampled, BUFFER_LEN}, BUFFER_LEN, 1000);
+  for (int i = 0; i < BUFFER_LEN; i++)
+    resamplerPush(&resampler, i * 1000 + ((i * 37) % 101) * 4, window + i * NUM_FEATURES);
+  sink = resampled[call % BUFFER_LEN];
+}
+
+static void benchSoftmax(int call)
+{
+  float logits[6] = {-2.3f, -0.1f, -3.9f, -2.1f, -3.9f, (float)(call % 7) * -0.5f};
+  applySoftmax(logits, label_count, probabilities);
+  sink = probabilities[0];
+}
+
+static void benchSoftmaxRef(int call)
+{
+  float logits[6] = {-2.3f, -0.1f, -3.9f, -2.1f, -3.9f, (float)(call % 7) * -0.5f};
+  kernelSoftmaxReference(logits, probabilities, label_count);
+  sink = probabilities[0];
+}
+
+#ifdef ARDUINO
+static void benchInvoke(int call)
+{
+  (void)call;
+  invokeModel();
+}
+#endif
+
+// A full model switch: decode, interpreter rebuilt in the shared arena, tensors allocated
+static void benchModelReload(int call)
+{
+  (void)call;
+  selectLiftModel(current_lift.c_str(), true);
+}
+
+static void benchRecordEncode(int call)
+{
+  (void)call; // Encodes the same window every call
+  ImuEncoder encoder;
+  imuEncoderReset(&encoder);
+  size_t length = 0;
+  for (int i = 0; i < BUFFER_LEN; i++)
+  {
+    if (length + IMU_CODEC_MAX_SAMPLE_BYTES > sizeof(record_block))
+      length = 0;
+#if SAMPLE_INT16
+    float sample[NUM_FEATURES]; // Recordings stay float
+    for (int channel = 0; channel < NUM_FEATURES; channel++)
+      sample[channel] = window[i * NUM_FEATURES + channel] * SAMPLE_TO_FLOAT;
+#else
+    const float *sample = window + i * NUM_FEATURES;
+#endif
+    length += imuEncodeSample(&encoder, i * 5, sample, record_block + length);
+  }
+  sink = length;
+}
+
+// One sample through the segmenter and tempo metrics, the sampler's per-sample overhead
+static void benchRepMetrics(int call)
+{
+  RepSpan rep;
+  int i = call % BUFFER_LEN;
+  rep_metrics_ms += 5;
+  sink = repMetricsAdd(rep_metrics_state, rep_metrics_ms, gyro_trace + i * 3, &rep);
+}
+
+static void benchRecordWrite(int call)
+{
+  (void)call;
+  record_file.write(record_block, sizeof(record_block));
+  record_file.flush();
+}
+
+// Times calls x function per repeat, results per call
+static BenchResult measure(const char *stage, void (*function)(int), uint32_t calls)
+{
+  float per_call[BENCH_REPEATS];
+  for (int repeat = 0; repeat < BENCH_REPEATS; repeat++)
+  {
+    uint32_t start = halCpuMicros();
+    for (uint32_t call = 0; call < calls; call++)
+      function(call);
+    per_call[repeat] = (float)(halCpuMicros() - start) / calls;
+  }
+  std::sort(per_call, per_call + BENCH_REPEATS);
+  return {stage, calls, per_call[BENCH_REPEATS / 2], per_call[0]};
+}
+
+int benchRun(BenchResult *out, int max)
+{
+  window = new sample_t[BUFFER_LEN * NUM_FEATURES];
+  resampled = new sample_t[BUFFER_LEN * NUM_FEATURES];
+  averaged = new float[OUTPUT_SEQUENCE_LENGTH * NUM_FEATURES];
+  probabilities = new float[label_count];
+  gyro_trace = new float[BUFFER_LEN * 3];
+  rep_metrics_state = new RepMetrics;
+  for (int i = 0; i < BUFFER_LEN * NUM_FEATURES; i++)
+    window[i] = (sample_t)((float)((i * 37) % 101) / 100.0f * SAMPLE_ONE); // Deterministic, already normalized
+  readings = new float[BUFFER_LEN * NUM_FEATURES];
+  for (int i = 0; i < BUFFER_LEN * NUM_FEATURES; i++)
+    readings[i] = window[i] * SAMPLE_TO_FLOAT * 40.0f - 20.0f;
+  for (int i = 0; i < BUFFER_LEN; i++)
+  {
+    // 2 s of a rep about one axis, then 3 s at rest
+    float rate = i < 400 ? 2.0f * sinf(i * 3.14159f / 200.0f) : 0.0f;
+    gyro_trace[i * 3] = 0.05f * rate;
+    gyro_trace[i * 3 + 1] = rate;
+    gyro_trace[i * 3 + 2] = 0.01f;
+  }
+  repMetricsReset(rep_metrics_state, true);
+  rep_metrics_ms = 0;
+
+  int count = 0;
+  auto add = [&](const BenchResult &result) {
+    if (count < max)
+      out[count++] = result;
+  };
+
+  add(measure("calibrate", benchCalibrate, 50));
+  add(measure("normalize", benchNormalize, 20));
+  add(measure("resample", benchResample, 20));
+  add(measure("window_avg", benchWindowAvg, 50));
+  add(measure("decimate_boxcar", benchDecimateBoxcar, 50));
+  add(measure("decimate_sinc", benchDecimateSinc, 50));
+  add(measure("decimate_cic", benchDecimateCic, 50));
+  add(measure("decimate_stream", benchDecimateStream, 50));
+  add(measure("store_aos", benchStore<SAMPLE_LAYOUT_INTERLEAVED>, 20));
+  add(measure("store_soa", benchStore<SAMPLE_LAYOUT_CHANNEL_MAJOR>, 20));
+  add(measure("to_input_aos", benchToInput<SAMPLE_LAYOUT_INTERLEAVED>, 50));
+  add(measure("to_input_soa", benchToInput<SAMPLE_LAYOUT_CHANNEL_MAJOR>, 50));
+  add(measure("boxcar_aos", benchBoxcar<SAMPLE_LAYOUT_INTERLEAVED>, 50));
+  add(measure("boxcar_soa", benchBoxcar<SAMPLE_LAYOUT_CHANNEL_MAJOR>, 50));
+  add(measure("softmax", benchSoftmax, 10000));
+  add(measure("softmax_ref", benchSoftmaxRef, 10000));
+  add(measure("normalize_kernel", benchNormalizeKernel, 50));
+  add(measure("normalize_ref", benchNormalizeRef, 50));
+  add(measure("fir6_kernel", benchFirKernel, 50));
+  add(measure("fir6_ref", benchFirRef, 50));
+  add(measure("record_encode", benchRecordEncode, 20));
+#ifdef ARDUINO
+  add(measure("invoke", benchInvoke, 5));
+#else
+  add({"invoke", 0, 0, 0}); // The host's Invoke() is the stand-in scorer (tflite_host.cpp), not TFLM
+#endif
+  add(measure("model_reload", benchModelReload, 5));
+  add(measure("imu_sample", benchImuSample, 100));
+  add(measure("rep_metrics", benchRepMetrics, BUFFER_LEN));
+
+  // Only if LittleFS is already usable, never formats
+  record_file = LittleFS.begin(false) ? LittleFS.open(bench_file, "w") : File();
+  if (record_file)
+  {
+    add(measure("record_write", benchRecordWrite, 8));
+    record_file.close();
+    LittleFS.remove(bench_file);
+  }
+  else
+  {
+    add({"record_write", 0, 0, 0});
+  }
+
+  delete[] window;
+  delete[] readings;
+  readings = nullptr;
+  delete[] resampled;
+  delete[] averaged;
+  delete[] probabilities;
+  delete[] gyro_trace;
+  delete rep_metrics_state;
+  window = resampled = nullptr;
+  averaged = probabilities = gyro_trace = nullptr;
+  rep_metrics_state = nullptr;
+  return count;
+}
+
+void benchReport(Print &out)
+{
+  BenchResult results[32];
+  int count = benchRun(results, 32);
+
+  out.println("START_BENCH");
+  out.printf("{\"platform\": \"%s\"}\n", platform_name);
+  for (int i = 0; i < count; i++)
+  {
+    if (results[i].calls == 0)
+      out.printf("{\"stage\": \"%s\", \"skipped\": true}\n", results[i].stage);
+    else
+      out.printf("{\"stage\": \"%s\", \"calls\": %lu, \"median_us\": %.3f, \"min_us\": %.3f}\n", results[i].stage,
+                 (unsigned long)results[i].calls, results[i].median_us, results[i].min_us);
+  }
+  out.println("END_BENCH");
+  out.flush();
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Stage micro-benchmarks for the performance gate (bench_gate.py).
+// Each stage runs BENCH_REPEATS times over a batch of calls and reports the median and fastest time
+// per call in microseconds, measured with halCpuMicros(). The "bench" console command prints:
+//
+//   START_BENCH
+//   {"platform": "esp32s3"}
+//   {"stage": "window_avg", "calls": 50, "median_us": 812.5, "min_us": 805.1}
+//   ...
+//   END_BENCH
+//
+// The first stage, "calibrate", is a fixed loop the gate divides every other stage by.
+// Running it pauses the pipeline for a few seconds on the device (Invoke alone is ~2.6 s).
+
+class Print;
+
+const int BENCH_REPEATS = 7;
+const int BENCH_CALIBRATE_STEPS = 1024; // Dependent multiply-adds per calibrate call
+
+struct BenchResult
+{
+  const char *stage;
+  uint32_t calls; // Calls per repeat, 0 if the stage was skipped
+  float median_us;
+  float min_us;
+};
+
+// Runs every stage, returns how many results were written
+int benchRun(BenchResult *out, int max);
+
+void benchReport(Print &out);
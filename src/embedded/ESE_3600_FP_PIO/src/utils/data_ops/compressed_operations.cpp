@@ -0,0 +1,87 @@
+#include "compressed_operations.h"
+
+File compressed_file;
+
+// Samples are staged in RAM and written in blocks so LittleFS sees few, larger writes
+static uint8_t stage_buffer[512];
+static size_t stage_len = 0;
+static ImuEncoder encoder;
+
+static void flushStage()
+{
+  if (stage_len == 0)
+    return;
+
+  if (compressed_file.write(stage_buffer, stage_len) != stage_len)
+  {
+    Serial.println("Failed to write compressed block");
+  }
+  stage_len = 0;
+}
+
+void setupCompressed(const int pin)
+{
+  if (recording)
+  {
+    return;
+  }
+
+  for (int i = 0; i < numPins; i++)
+  {
+    if (!setup_folder_structure(pins[i]))
+    {
+      Serial.printf("Failed to setup folder structure for pin %u\n", pins[i]);
+      return;
+    }
+  }
+
+  // Create the file
+  String file_path = add_file_to_folder(pin, "d", ".rmc");
+  if (file_path.isEmpty())
+  {
+    return;
+  }
+  compressed_file = LittleFS.open(file_path, "w");
+  if (!compressed_file)
+  {
+    Serial.printf("Failed to create file for pin %u\n", pin);
+    return;
+  }
+}
+
+void createCompressedHeading(String lift_name, String lift_classification)
+{
+  if (!compressed_file)
+    return;
+
+  recording = true;
+  imuEncoderReset(&encoder);
+  stage_len = imuEncodeHeader(lift_name.c_str(), lift_classification.c_str(), stage_buffer);
+  flushStage();
+}
+
+void addCompressedDataPoint(float timestamp, float accel_x, float accel_y, float accel_z, float gyro_x, float gyro_y, float gyro_z)
+{
+  if (!compressed_file)
+    return;
+
+  if (stage_len + IMU_CODEC_MAX_SAMPLE_BYTES > sizeof(stage_buffer))
+  {
+    flushStage();
+  }
+
+  const float values[IMU_CODEC_CHANNELS] = {accel_x, accel_y, accel_z, gyro_x, gyro_y, gyro_z};
+  stage_len += imuEncodeSample(&encoder, (uint32_t)timestamp, values, stage_buffer + stage_len);
+}
+
+void closeCompressedFile()
+{
+  if (!compressed_file)
+  {
+    return;
+  }
+  flushStage();
+  compressed_file.flush();
+  compressed_file.close();
+  recording = false;
+}
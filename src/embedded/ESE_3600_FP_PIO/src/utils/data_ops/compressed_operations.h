@@ -0,0 +1,15 @@
+#pragma once
+
+#include "file_system.h"
+#include "data_collection.h"
+#include "imu_codec.h"
+
+// Compressed (.rmc) recording path, mirrors json_operations
+
+void setupCompressed(const int pin);
+
+void createCompressedHeading(String lift_name, String lift_classification);
+
+void addCompressedDataPoint(float timestamp, float accel_x, float accel_y, float accel_z, float gyro_x, float gyro_y, float gyro_z);
+
+void closeCompressedFile();
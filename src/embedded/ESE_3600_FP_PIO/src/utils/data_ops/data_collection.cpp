@@ -1,9 +1,14 @@
 #include "data_collection.h"
 #include "../hardware/mpu.h"
 
+BleTransport stream_transport;
+ImuStream imu_stream;
+
 // Configuration Parameters
 const uint8_t pins[5] = {D0, D1, D2, D3, D6};
 bool output_to_json = true;
+bool compress_recordings = true; // Record delta/varint compressed .rmc files instead of .json
+bool stream_over_ble = false;    // Stream raw int16 frames to the BLE server instead of recording to flash
 const unsigned long duration = 5000;
 const unsigned long sampling_rate = 1; // Note there is a +3 ms delay in the loop.
 
@@ -44,7 +49,7 @@ void data_collection_setup()
   }
 
   // Add file system initialization
-  if (!file_system_setup())
+  if (!stream_over_ble && !file_system_setup())
   {
     Serial.println("Failed to initialize file system");
     while (1)
@@ -66,6 +71,10 @@ void data_collection_loop()
     }
   }
   high_pin_loops++;
+  if (stream_over_ble)
+  {
+    BLEloop();
+  }
   delay(10);
 }
 
@@ -73,7 +82,19 @@ void recordData(int triggeredPin, bool to_json)
 {
   Serial.println("Recording data...");
   Serial.println(high_pin_loops);
-  if (to_json)
+  if (stream_over_ble)
+  {
+    if (!imuStreamBegin(&imu_stream, stream_transport, current_lift.c_str(), lift_classification_map.find(triggeredPin)->second.c_str()))
+    {
+      Serial.printf("BLE stream not ready (%s), frames are dropped until it connects\n", BLEstateName(BLEstate()));
+    }
+  }
+  else if (to_json && compress_recordings)
+  {
+    setupCompressed(triggeredPin);
+    createCompressedHeading(current_lift, lift_classification_map.find(triggeredPin)->second);
+  }
+  else if (to_json)
   {
     setupJSON(triggeredPin);
     createJSONHeading(current_lift, lift_classification_map.find(triggeredPin)->second);
@@ -85,7 +106,19 @@ void recordData(int triggeredPin, bool to_json)
     mpu.getEvent(&a, &g, &temp);
 
     // Print data as a comma-separated list
-    if (to_json)
+    if (stream_over_ble)
+    {
+      BLEloop(); // Keep connecting mid-session, the stream starts once the link is ready
+      const int16_t frame[IMU_STREAM_CHANNELS] = {
+          imuStreamAccelToRaw(a.acceleration.x), imuStreamAccelToRaw(a.acceleration.y), imuStreamAccelToRaw(a.acceleration.z),
+          imuStreamGyroToRaw(g.gyro.x), imuStreamGyroToRaw(g.gyro.y), imuStreamGyroToRaw(g.gyro.z)};
+      imuStreamAdd(&imu_stream, millis() - startTime, frame);
+    }
+    else if (to_json && compress_recordings)
+    {
+      addCompressedDataPoint(millis() - startTime, a.acceleration.x, a.acceleration.y, a.acceleration.z, g.gyro.x, g.gyro.y, g.gyro.z);
+    }
+    else if (to_json)
     {
       addDataPoint(millis() - startTime, a.acceleration.x, a.acceleration.y, a.acceleration.z, g.gyro.x, g.gyro.y, g.gyro.z);
     }
@@ -95,7 +128,16 @@ void recordData(int triggeredPin, bool to_json)
     }
     delay(sampling_rate); // Adjust sampling rate as needed
   }
-  if (to_json)
+  if (stream_over_ble)
+  {
+    imuStreamEnd(&imu_stream);
+    Serial.printf("Streamed %lu frames, %lu dropped\n", (unsigned long)imu_stream.next_sample, (unsigned long)imu_stream.dropped_frames);
+  }
+  else if (to_json && compress_recordings)
+  {
+    closeCompressedFile();
+  }
+  else if (to_json)
   {
     closeJSONArray();
     closeDataFile();
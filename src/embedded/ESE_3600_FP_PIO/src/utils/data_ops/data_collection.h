@@ -8,6 +8,9 @@
 
 #include "file_system.h"
 #include "json_operations.h"
+#include "compressed_operations.h"
+#include "imu_stream.h"
+#include "../hardware/ble.h"
 #include "main.h"
 
 
@@ -17,6 +20,8 @@ extern const uint8_t pins[5];
 
 // Output to JSON
 extern bool output_to_json;
+extern bool compress_recordings;
+extern bool stream_over_ble;
 
 // Lift Names
 extern const String lift_names[3];
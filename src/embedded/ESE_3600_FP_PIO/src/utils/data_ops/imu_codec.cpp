@@ -0,0 +1,156 @@
+#include "imu_codec.h"
+#include <math.h>
+#include <string.h>
+
+static const uint8_t kMagic[3] = {'R', 'M', 'C'};
+
+static inline uint32_t zigzag_encode(int32_t value)
+{
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t zigzag_decode(uint32_t value)
+{
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static inline size_t write_varint(uint32_t value, uint8_t *out)
+{
+  size_t n = 0;
+  while (value >= 0x80)
+  {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+// Returns the number of bytes consumed, or 0 if the varint runs past the input
+static inline size_t read_varint(const uint8_t *in, size_t len, uint32_t *value)
+{
+  uint32_t result = 0;
+  for (size_t i = 0; i < len && i < 5; i++)
+  {
+    result |= (uint32_t)(in[i] & 0x7F) << (7 * i);
+    if (!(in[i] & 0x80))
+    {
+      *value = result;
+      return i + 1;
+    }
+  }
+  return 0;
+}
+
+static inline int32_t quantize(float value)
+{
+  return (int32_t)lroundf(value * IMU_CODEC_SCALE);
+}
+
+void imuEncoderReset(ImuEncoder *encoder)
+{
+  memset(encoder, 0, sizeof(*encoder));
+}
+
+void imuDecoderReset(ImuDecoder *decoder)
+{
+  memset(decoder, 0, sizeof(*decoder));
+}
+
+size_t imuEncodeHeader(const char *lift_name, const char *lift_classification, uint8_t *out)
+{
+  size_t n = 0;
+  memcpy(out, kMagic, sizeof(kMagic));
+  n += sizeof(kMagic);
+  out[n++] = IMU_CODEC_VERSION;
+  out[n++] = (uint8_t)(IMU_CODEC_SCALE & 0xFF);
+  out[n++] = (uint8_t)(IMU_CODEC_SCALE >> 8);
+
+  const char *strings[2] = {lift_name, lift_classification};
+  for (int i = 0; i < 2; i++)
+  {
+    size_t str_len = strlen(strings[i]);
+    if (str_len > IMU_CODEC_MAX_NAME_LEN)
+      str_len = IMU_CODEC_MAX_NAME_LEN;
+    out[n++] = (uint8_t)str_len;
+    memcpy(out + n, strings[i], str_len);
+    n += str_len;
+  }
+  return n;
+}
+
+size_t imuDecodeHeader(const uint8_t *in, size_t len,
+                       char *lift_name, size_t lift_name_size,
+                       char *lift_classification, size_t lift_classification_size)
+{
+  if (len < 6 || memcmp(in, kMagic, sizeof(kMagic)) != 0 || in[3] != IMU_CODEC_VERSION)
+    return 0;
+
+  uint16_t scale = (uint16_t)(in[4] | (in[5] << 8));
+  if (scale != IMU_CODEC_SCALE)
+    return 0;
+
+  size_t n = 6;
+  char *strings[2] = {lift_name, lift_classification};
+  size_t sizes[2] = {lift_name_size, lift_classification_size};
+  for (int i = 0; i < 2; i++)
+  {
+    if (n >= len || n + 1 + in[n] > len || sizes[i] == 0)
+      return 0;
+    size_t str_len = in[n++];
+    size_t copy_len = str_len < sizes[i] - 1 ? str_len : sizes[i] - 1;
+    memcpy(strings[i], in + n, copy_len);
+    strings[i][copy_len] = '\0';
+    n += str_len;
+  }
+  return n;
+}
+
+size_t imuEncodeSample(ImuEncoder *encoder, uint32_t timestamp, const float values[IMU_CODEC_CHANNELS], uint8_t *out)
+{
+  size_t n = 0;
+
+  // The first sample is stored as a delta against zero, so it needs no special casing on decode
+  n += write_varint(timestamp - encoder->prev_t, out + n);
+  encoder->prev_t = timestamp;
+
+  for (int c = 0; c < IMU_CODEC_CHANNELS; c++)
+  {
+    int32_t q = quantize(values[c]);
+    n += write_varint(zigzag_encode(q - encoder->prev[c]), out + n);
+    encoder->prev[c] = q;
+  }
+  return n;
+}
+
+size_t imuDecodeSample(ImuDecoder *decoder, const uint8_t *in, size_t len, uint32_t *timestamp, float values[IMU_CODEC_CHANNELS])
+{
+  size_t n = 0;
+  uint32_t raw;
+
+  size_t used = read_varint(in, len, &raw);
+  if (!used)
+    return 0;
+  n += used;
+  uint32_t t = decoder->prev_t + raw;
+
+  int32_t q[IMU_CODEC_CHANNELS];
+  for (int c = 0; c < IMU_CODEC_CHANNELS; c++)
+  {
+    used = read_varint(in + n, len - n, &raw);
+    if (!used)
+      return 0;
+    n += used;
+    q[c] = decoder->prev[c] + zigzag_decode(raw);
+  }
+
+  // Only commit state once the whole sample is available
+  decoder->prev_t = t;
+  *timestamp = t;
+  for (int c = 0; c < IMU_CODEC_CHANNELS; c++)
+  {
+    decoder->prev[c] = q[c];
+    values[c] = (float)q[c] / IMU_CODEC_SCALE;
+  }
+  return n;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming delta + zigzag varint codec for recorded IMU samples.
+// Values are quantized to the same 3 decimal places the JSON recordings use,
+// so a compressed file decodes to exactly the JSON we would have written.
+
+const int IMU_CODEC_CHANNELS = 6;
+const int32_t IMU_CODEC_SCALE = 1000;
+const uint8_t IMU_CODEC_VERSION = 1;
+
+// Worst case: 1 timestamp varint + 6 channel varints, 5 bytes each
+const size_t IMU_CODEC_MAX_SAMPLE_BYTES = 5 * (1 + IMU_CODEC_CHANNELS);
+
+// Header: "RMC" + version + scale (u16) + two length-prefixed strings
+const size_t IMU_CODEC_MAX_NAME_LEN = 32;
+const size_t IMU_CODEC_MAX_HEADER_BYTES = 3 + 1 + 2 + 2 * (1 + IMU_CODEC_MAX_NAME_LEN);
+
+struct ImuEncoder
+{
+  uint32_t prev_t;
+  int32_t prev[IMU_CODEC_CHANNELS];
+};
+
+struct ImuDecoder
+{
+  uint32_t prev_t;
+  int32_t prev[IMU_CODEC_CHANNELS];
+};
+
+void imuEncoderReset(ImuEncoder *encoder);
+void imuDecoderReset(ImuDecoder *decoder);
+
+// Writes the file header, returns the number of bytes written
+size_t imuEncodeHeader(const char *lift_name, const char *lift_classification, uint8_t *out);
+
+// Parses the file header, returns the number of bytes consumed or 0 if invalid/incomplete
+size_t imuDecodeHeader(const uint8_t *in, size_t len,
+                       char *lift_name, size_t lift_name_size,
+                       char *lift_classification, size_t lift_classification_size);
+
+// Encodes one sample (timestamp in ms), returns the number of bytes written
+size_t imuEncodeSample(ImuEncoder *encoder, uint32_t timestamp, const float values[IMU_CODEC_CHANNELS], uint8_t *out);
+
+// Decodes one sample, returns the number of bytes consumed or 0 if the input is incomplete
+size_t imuDecodeSample(ImuDecoder *decoder, const uint8_t *in, size_t len, uint32_t *timestamp, float values[IMU_CODEC_CHANNELS]);
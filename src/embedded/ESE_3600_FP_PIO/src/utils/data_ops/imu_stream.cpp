@@ -0,0 +1,182 @@
+#include "imu_stream.h"
+#include <math.h>
+#include <string.h>
+
+static inline void put_u16(uint8_t *out, uint16_t value)
+{
+  out[0] = (uint8_t)value;
+  out[1] = (uint8_t)(value >> 8);
+}
+
+static inline void put_u32(uint8_t *out, uint32_t value)
+{
+  put_u16(out, (uint16_t)value);
+  put_u16(out + 2, (uint16_t)(value >> 16));
+}
+
+static inline int16_t to_raw(float value, float lsb)
+{
+  float raw = roundf(value * lsb);
+  if (raw > 32767.0f)
+    return 32767;
+  if (raw < -32768.0f)
+    return -32768;
+  return (int16_t)raw;
+}
+
+int16_t imuStreamAccelToRaw(float accel)
+{
+  return to_raw(accel, IMU_STREAM_ACCEL_LSB);
+}
+
+int16_t imuStreamGyroToRaw(float gyro)
+{
+  return to_raw(gyro, IMU_STREAM_GYRO_LSB);
+}
+
+static size_t writeHeader(ImuStream *stream, uint8_t type)
+{
+  stream->packet[0] = type;
+  stream->packet[1] = IMU_STREAM_VERSION;
+  put_u16(stream->packet + 2, stream->seq++);
+  return 4;
+}
+
+static bool sendPacket(ImuStream *stream)
+{
+  bool sent = stream->transport->send(stream->packet, stream->length);
+  stream->length = 0;
+  return sent;
+}
+
+static void flushData(ImuStream *stream)
+{
+  if (stream->frame_count == 0)
+    return;
+
+  stream->packet[IMU_STREAM_DATA_HEADER_BYTES - 1] = stream->frame_count;
+  if (!stream->transport->ready() || !sendPacket(stream))
+  {
+    stream->dropped_frames += stream->frame_count;
+  }
+  stream->length = 0;
+  stream->frame_count = 0;
+}
+
+// Frames per DATA packet at the transport's current payload, 0 while the link cannot carry one
+static size_t frameLimit(ImuStream *stream)
+{
+  if (!stream->transport->ready())
+    return 0;
+  size_t payload = stream->transport->maxPayload();
+  if (payload > IMU_STREAM_MAX_PACKET)
+    payload = IMU_STREAM_MAX_PACKET;
+  size_t frames = payload > IMU_STREAM_DATA_HEADER_BYTES ? (payload - IMU_STREAM_DATA_HEADER_BYTES) / IMU_STREAM_FRAME_BYTES : 0;
+  return frames > 255 ? 255 : frames;
+}
+
+// Sends START once the link is up and the MTU fits a frame
+static bool sendStart(ImuStream *stream)
+{
+  if (stream->started)
+    return true;
+  if (frameLimit(stream) == 0)
+    return false;
+
+  size_t n = writeHeader(stream, IMU_STREAM_START);
+  memcpy(stream->packet + n, &IMU_STREAM_ACCEL_LSB, 4);
+  memcpy(stream->packet + n + 4, &IMU_STREAM_GYRO_LSB, 4);
+  n += 8;
+
+  const char *strings[2] = {stream->lift_name, stream->lift_classification};
+  for (int i = 0; i < 2; i++)
+  {
+    size_t str_len = strlen(strings[i]);
+    stream->packet[n++] = (uint8_t)str_len;
+    memcpy(stream->packet + n, strings[i], str_len);
+    n += str_len;
+  }
+  stream->length = n;
+  if (sendPacket(stream))
+  {
+    stream->started = true;
+  }
+  else
+  {
+    stream->seq--; // Resend with the same sequence number
+  }
+  return stream->started;
+}
+
+static void copyName(char *out, const char *name)
+{
+  strncpy(out, name, IMU_STREAM_MAX_NAME);
+  out[IMU_STREAM_MAX_NAME] = '\0';
+}
+
+bool imuStreamBegin(ImuStream *stream, PacketTransport &transport, const char *lift_name, const char *lift_classification)
+{
+  stream->transport = &transport;
+  stream->seq = 0;
+  stream->next_sample = 0;
+  stream->last_t = 0;
+  stream->length = 0;
+  stream->frame_count = 0;
+  stream->max_frames = 0;
+  stream->dropped_frames = 0;
+  stream->started = false;
+  copyName(stream->lift_name, lift_name);
+  copyName(stream->lift_classification, lift_classification);
+  return sendStart(stream);
+}
+
+void imuStreamAdd(ImuStream *stream, uint32_t timestamp_ms, const int16_t frame[IMU_STREAM_CHANNELS])
+{
+  if (stream->frame_count == 0)
+  {
+    // The MTU can change mid-session (negotiated late, or a reconnect), so size each packet afresh
+    stream->max_frames = sendStart(stream) ? frameLimit(stream) : 0;
+    if (stream->max_frames == 0)
+    {
+      stream->dropped_frames++;
+      stream->next_sample++;
+      return;
+    }
+
+    size_t n = writeHeader(stream, IMU_STREAM_DATA);
+    put_u32(stream->packet + n, stream->next_sample);
+    put_u32(stream->packet + n + 4, timestamp_ms);
+    stream->length = IMU_STREAM_DATA_HEADER_BYTES;
+    stream->last_t = timestamp_ms;
+  }
+
+  uint32_t dt = timestamp_ms - stream->last_t;
+  uint8_t *p = stream->packet + stream->length;
+  p[0] = (uint8_t)(dt > 255 ? 255 : dt);
+  for (int c = 0; c < IMU_STREAM_CHANNELS; c++)
+  {
+    put_u16(p + 1 + 2 * c, (uint16_t)frame[c]);
+  }
+  stream->length += IMU_STREAM_FRAME_BYTES;
+  stream->last_t = timestamp_ms;
+  stream->frame_count++;
+  stream->next_sample++;
+
+  if (stream->frame_count >= stream->max_frames)
+  {
+    flushData(stream);
+  }
+}
+
+bool imuStreamEnd(ImuStream *stream)
+{
+  flushData(stream);
+  if (!sendStart(stream))
+    return false;
+
+  size_t n = writeHeader(stream, IMU_STREAM_END);
+  put_u32(stream->packet + n, stream->next_sample);
+  put_u32(stream->packet + n + 4, stream->dropped_frames);
+  stream->length = n + 8;
+  return stream->transport->ready() && sendPacket(stream);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../hardware/packet_transport.h"
+
+// Packs IMU samples into MTU-sized packets for wireless data collection.
+//
+// Every packet: type (u8) | version (u8) | packet_seq (u16)
+// START:  accel_lsb_per_unit (f32) | gyro_lsb_per_unit (f32) | lift name, classification (u8 length + chars)
+// DATA:   first_sample (u32) | t0_ms (u32) | frame_count (u8) | frames...
+//         frame = dt_ms since previous frame (u8) | aX aY aZ gX gY gZ (i16)
+// END:    total_frames (u32) | dropped_frames (u32)
+// All multi-byte fields are little-endian. stream_receiver.py is the host side.
+//
+// The device is the BLE central, so packets go out as GATT writes to the receiver's characteristic
+// (BleTransport), not as notifications. START waits until the link is ready and the negotiated MTU
+// fits a frame; samples before that are counted as dropped and show up as a first_sample gap.
+
+const uint8_t IMU_STREAM_VERSION = 1;
+const uint8_t IMU_STREAM_START = 1;
+const uint8_t IMU_STREAM_DATA = 2;
+const uint8_t IMU_STREAM_END = 3;
+
+const int IMU_STREAM_CHANNELS = 6;
+const size_t IMU_STREAM_DATA_HEADER_BYTES = 4 + 4 + 4 + 1;
+const size_t IMU_STREAM_FRAME_BYTES = 1 + 2 * IMU_STREAM_CHANNELS;
+const size_t IMU_STREAM_MAX_PACKET = 512;
+const size_t IMU_STREAM_MAX_NAME = 32;
+
+// Raw MPU6050 sensitivity at the ranges we configure (+-8 g, +-500 deg/s)
+const float IMU_STREAM_ACCEL_LSB = 4096.0f / 9.80665f;         // LSB per m/s^2
+const float IMU_STREAM_GYRO_LSB = 65.5f * 180.0f / 3.14159265f; // LSB per rad/s
+
+struct ImuStream
+{
+  PacketTransport *transport;
+  uint8_t packet[IMU_STREAM_MAX_PACKET];
+  size_t length;
+  size_t max_frames;
+  uint8_t frame_count;
+  uint16_t seq;
+  uint32_t next_sample;
+  uint32_t last_t;
+  uint32_t dropped_frames;
+  bool started; // START sent
+  char lift_name[IMU_STREAM_MAX_NAME + 1];
+  char lift_classification[IMU_STREAM_MAX_NAME + 1];
+};
+
+// Converts the Adafruit float readings back to raw register units
+int16_t imuStreamAccelToRaw(float accel);
+int16_t imuStreamGyroToRaw(float gyro);
+
+// Starts a session and sends START, returns false if the link is not up yet (START then goes with
+// the first frame that can be sent)
+bool imuStreamBegin(ImuStream *stream, PacketTransport &transport, const char *lift_name, const char *lift_classification);
+
+// Appends one frame, sending the packet once it is full. Each packet is sized for the current MTU.
+void imuStreamAdd(ImuStream *stream, uint32_t timestamp_ms, const int16_t frame[IMU_STREAM_CHANNELS]);
+
+// Flushes the partial packet and sends the END packet with the loss counters
+bool imuStreamEnd(ImuStream *stream);
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Thin hardware abstraction layer.
+// hal_esp32.cpp implements it on the device, hal_host.cpp on top of the Linux host runtime
+// (lib/host_runtime) so the firmware can run under virtual time.
+
+const uint8_t HAL_INPUT = 0;
+const uint8_t HAL_OUTPUT = 1;
+const uint8_t HAL_INPUT_PULLDOWN = 2; // Reads low while nothing drives the pin
+
+// Time
+uint32_t halMillis();
+uint32_t halMicros();
+void halDelay(uint32_t ms);
+
+// CPU cycle counter (CCOUNT on the ESP32), wraps every 2^32 cycles and stops in light sleep
+uint32_t halCycleCount();
+uint32_t halCpuMhz();
+
+// Time spent running code, for benchmarks: micros() on the device, the thread's CPU clock on the
+// host (where virtual time does not move while code runs)
+uint32_t halCpuMicros();
+
+// Idles for ms, in light sleep if requested (timer wakeup only). If the chip refuses to light sleep
+// it idles awake for the same time instead.
+void halSleep(uint32_t ms, bool light_sleep);
+
+// Light sleep until pin reads level or max_ms pass, true if the pin woke it. If light sleep is refused
+// the pin is polled awake for up to max_ms, so it never returns early without the pin.
+bool halSleepUntilPin(uint8_t pin, bool level, uint32_t max_ms);
+
+// Times light sleep was refused and idled awake instead
+uint32_t halSleepRejections();
+
+// Memory for the rest of the run, never freed: alignment must be a power of two. external asks for PSRAM,
+// nullptr if there is none (the host never has any) or it is full.
+void *halAllocStatic(size_t bytes, size_t alignment, bool external);
+
+// GPIO
+void halPinMode(uint8_t pin, uint8_t mode);
+void halDigitalWrite(uint8_t pin, bool high);
+bool halDigitalRead(uint8_t pin);
+
+// Tone generator (LEDC PWM on the ESP32), frequency 0 silences the output
+void halToneAttach(uint8_t pin);
+void halTone(uint32_t frequency);
@@ -0,0 +1,135 @@
+#ifdef ARDUINO
+
+#include "hal.h"
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp_heap_caps.h>
+#include <driver/gpio.h>
+#include "../log/log.h"
+
+// LEDC channel reserved for the buzzer
+const uint8_t TONE_LEDC_CHANNEL = 0;
+const uint8_t TONE_LEDC_RESOLUTION = 10;
+
+uint32_t halMillis()
+{
+  return millis();
+}
+
+uint32_t halMicros()
+{
+  return micros();
+}
+
+void halDelay(uint32_t ms)
+{
+  delay(ms);
+}
+
+uint32_t halCycleCount()
+{
+  return ESP.getCycleCount();
+}
+
+uint32_t halCpuMhz()
+{
+  return ESP.getCpuFreqMHz();
+}
+
+uint32_t halCpuMicros()
+{
+  return micros();
+}
+
+// Poll period while waiting for a pin awake, after light sleep was refused
+const uint32_t PIN_POLL_MS = 10;
+
+static uint32_t sleep_rejections = 0;
+
+// esp_light_sleep_start() refuses to sleep (ESP_ERR_SLEEP_REJECT) if a wakeup source is already
+// pending or a peripheral holds the clock. The first refusal is logged, the rest only counted.
+static void noteSleepRejected(esp_err_t err)
+{
+  if (sleep_rejections++ == 0)
+    LOG_WARN("Light sleep refused (%s), idling awake instead", esp_err_to_name(err));
+}
+
+void halSleep(uint32_t ms, bool light_sleep)
+{
+  if (light_sleep)
+  {
+    esp_sleep_enable_timer_wakeup((uint64_t)ms * 1000);
+    esp_err_t err = esp_light_sleep_start();
+    if (err == ESP_OK)
+      return;
+    noteSleepRejected(err);
+  }
+  // vTaskDelay underneath, so the FreeRTOS idle task really gets the CPU
+  delay(ms);
+}
+
+bool halSleepUntilPin(uint8_t pin, bool level, uint32_t max_ms)
+{
+  if (halDigitalRead(pin) == level)
+    return true;
+  gpio_wakeup_enable((gpio_num_t)pin, level ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup((uint64_t)max_ms * 1000);
+  esp_err_t err = esp_light_sleep_start();
+  // halSleep() only expects the timer
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  gpio_wakeup_disable((gpio_num_t)pin);
+  if (err != ESP_OK)
+  {
+    // Did not sleep at all: wait out max_ms awake, watching the pin, so callers never spin
+    noteSleepRejected(err);
+    for (uint32_t waited = 0; waited < max_ms; waited += PIN_POLL_MS)
+    {
+      if (halDigitalRead(pin) == level)
+        return true;
+      delay(PIN_POLL_MS);
+    }
+  }
+  return halDigitalRead(pin) == level;
+}
+
+uint32_t halSleepRejections()
+{
+  return sleep_rejections;
+}
+
+void *halAllocStatic(size_t bytes, size_t alignment, bool external)
+{
+  // MALLOC_CAP_SPIRAM only finds memory if the board's PSRAM is enabled (BOARD_HAS_PSRAM)
+  return heap_caps_aligned_alloc(alignment, bytes, external ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void halPinMode(uint8_t pin, uint8_t mode)
+{
+  pinMode(pin, mode == HAL_OUTPUT ? OUTPUT : mode == HAL_INPUT_PULLDOWN ? INPUT_PULLDOWN : INPUT);
+}
+
+void halDigitalWrite(uint8_t pin, bool high)
+{
+  digitalWrite(pin, high ? HIGH : LOW);
+}
+
+bool halDigitalRead(uint8_t pin)
+{
+  return digitalRead(pin) == HIGH;
+}
+
+void halToneAttach(uint8_t pin)
+{
+  ledcSetup(TONE_LEDC_CHANNEL, 1000, TONE_LEDC_RESOLUTION);
+  ledcAttachPin(pin, TONE_LEDC_CHANNEL);
+  ledcWrite(TONE_LEDC_CHANNEL, 0);
+}
+
+void halTone(uint32_t frequency)
+{
+  // ledcWriteTone sets a 50% duty square wave; 0 Hz turns the output off
+  ledcWriteTone(TONE_LEDC_CHANNEL, frequency);
+}
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef ARDUINO
+
+#include "hal_host.h"
+#include <Arduino.h>
+#include <stdint.h>
+#include <time.h>
+#include <new>
+
+// Cycle counter derived from virtual time at the ESP32-S3 default clock
+const uint32_t HOST_CPU_MHZ = 240;
+
+static uint32_t tone_frequency = 0;
+static uint32_t tone_changes = 0;
+
+void halHostSetMillis(uint32_t ms)
+{
+  hostSetMicros((uint64_t)ms * 1000);
+}
+
+void halHostAdvanceMillis(uint32_t ms)
+{
+  hostAdvanceMicros((uint64_t)ms * 1000);
+}
+
+bool halHostPinState(uint8_t pin)
+{
+  return hostPinLevel(pin);
+}
+
+uint32_t halHostToneFrequency()
+{
+  return tone_frequency;
+}
+
+uint32_t halHostToneChanges()
+{
+  return tone_changes;
+}
+
+uint32_t halMillis()
+{
+  return millis();
+}
+
+uint32_t halMicros()
+{
+  return micros();
+}
+
+void halDelay(uint32_t ms)
+{
+  delay(ms);
+}
+
+uint32_t halCycleCount()
+{
+  return (uint32_t)(hostMicros() * HOST_CPU_MHZ);
+}
+
+uint32_t halCpuMhz()
+{
+  return HOST_CPU_MHZ;
+}
+
+uint32_t halCpuMicros()
+{
+  struct timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000);
+}
+
+void halSleep(uint32_t ms, bool light_sleep)
+{
+  hostCharge(light_sleep ? HOST_TIME_LIGHT_SLEEP : HOST_TIME_WAIT, (uint64_t)ms * 1000);
+}
+
+bool halSleepUntilPin(uint8_t pin, bool level, uint32_t max_ms)
+{
+  // Pins driven by a simulated device only change as virtual time passes, check once per ms
+  for (uint32_t slept = 0; slept < max_ms; slept++)
+  {
+    if (halDigitalRead(pin) == level)
+      return true;
+    hostCharge(HOST_TIME_LIGHT_SLEEP, 1000);
+  }
+  return halDigitalRead(pin) == level;
+}
+
+uint32_t halSleepRejections()
+{
+  return 0; // Virtual light sleep never refuses
+}
+
+void *halAllocStatic(size_t bytes, size_t alignment, bool external)
+{
+  if (external)
+    return nullptr;
+  // Through operator new so the host heap accounting sees it; glibc blocks are 16-byte aligned
+  uint8_t *block = new (std::nothrow) uint8_t[bytes];
+  if (block != nullptr && (uintptr_t)block % alignment != 0)
+  {
+    delete[] block;
+    return nullptr;
+  }
+  return block;
+}
+
+void halPinMode(uint8_t pin, uint8_t mode)
+{
+  pinMode(pin, mode == HAL_OUTPUT ? OUTPUT : mode == HAL_INPUT_PULLDOWN ? INPUT_PULLDOWN : INPUT);
+}
+
+void halDigitalWrite(uint8_t pin, bool high)
+{
+  digitalWrite(pin, high ? HIGH : LOW);
+}
+
+bool halDigitalRead(uint8_t pin)
+{
+  return digitalRead(pin) == HIGH;
+}
+
+void halToneAttach(uint8_t pin)
+{
+  (void)pin;
+  tone_frequency = 0;
+}
+
+void halTone(uint32_t frequency)
+{
+  if (frequency != tone_frequency)
+    tone_changes++;
+  tone_frequency = frequency;
+}
+
+#endif
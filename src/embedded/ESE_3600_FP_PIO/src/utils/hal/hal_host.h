@@ -0,0 +1,15 @@
+#pragma once
+
+#include "hal.h"
+
+// Host-side fake state, lets tests and simulations drive time and inspect outputs.
+// Time and pins are shared with the host runtime's Arduino stand-ins (host_runtime.h).
+
+void halHostSetMillis(uint32_t ms);
+void halHostAdvanceMillis(uint32_t ms);
+
+bool halHostPinState(uint8_t pin);
+uint32_t halHostToneFrequency();
+
+// Number of tone on/off changes since startup
+uint32_t halHostToneChanges();
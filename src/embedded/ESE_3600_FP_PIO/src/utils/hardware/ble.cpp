@@ -1,11 +1,46 @@
 #include "ble.h"
 #include <string>
+#include "../memory/memory_stats.h"
 
 BLEAdvertisedDevice *myDevice = nullptr;
 BLERemoteCharacteristic *pRemoteCharacteristic = nullptr;
-bool doConnect = false;
-bool connected = false;
-bool doScan = false;
+
+const char *BLEstateName(BleState ble_state)
+{
+  switch (ble_state)
+  {
+  case BLE_IDLE:
+    return "idle";
+  case BLE_SCANNING:
+    return "scanning";
+  case BLE_CONNECTING:
+    return "connecting";
+  case BLE_DISCOVERING:
+    return "discovering";
+  case BLE_READY:
+    return "ready";
+  case BLE_BACKOFF:
+    return "backoff";
+  default:
+    return "unknown";
+  }
+}
+
+// Radio implementation, ble_host.cpp stands in for it in host builds
+#ifdef ARDUINO
+
+static BLEClient *pClient = nullptr;
+static volatile BleState state = BLE_IDLE;
+static BleState reported_state = BLE_IDLE;
+static BleStateCallback state_callback = nullptr;
+
+static uint32_t backoff_ms = BLE_BACKOFF_INITIAL_MS;
+static uint32_t retry_at = 0;
+
+// Connecting and discovery block inside the BLE library, so they run on their own task
+const uint32_t CONNECT_TASK_STACK = 4096;
+const UBaseType_t CONNECT_TASK_PRIORITY = 1;
+const BaseType_t CONNECT_TASK_CORE = 0; // Arduino loop() runs on core 1
 
 static void notifyCallback(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify)
 {
@@ -16,30 +51,50 @@ static void notifyCallback(BLERemoteCharacteristic *pBLERemoteCharacteristic, ui
   printf("\n");
 }
 
+// Enters backoff and doubles the wait for next time
+static void enterBackoff()
+{
+  retry_at = millis() + backoff_ms;
+  backoff_ms = min(backoff_ms * 2, BLE_BACKOFF_MAX_MS);
+  state = BLE_BACKOFF;
+}
+
 class MyClientCallback : public BLEClientCallbacks
 {
   void onConnect(BLEClient *pclient) {}
 
   void onDisconnect(BLEClient *pclient)
   {
-    connected = false;
     printf("onDisconnect\n");
+    pRemoteCharacteristic = nullptr;
+    if (state == BLE_READY)
+    {
+      backoff_ms = BLE_BACKOFF_INITIAL_MS;
+      enterBackoff();
+    }
   }
 };
 
-bool connectToServer()
+static bool connectToServer()
 {
   printf("Forming a connection to %s\n", myDevice->getAddress().toString().c_str());
 
-  BLEClient *pClient = BLEDevice::createClient();
-  printf(" - Created client\n");
-
-  pClient->setClientCallbacks(new MyClientCallback());
+  if (pClient == nullptr)
+  {
+    pClient = BLEDevice::createClient();
+    pClient->setClientCallbacks(new MyClientCallback());
+    printf(" - Created client\n");
+  }
 
   // Connect to the remote BLE Server.
-  pClient->connect(myDevice); // if you pass BLEAdvertisedDevice instead of address, it will be recognized type of peer device address (public or private)
+  if (!pClient->connect(myDevice)) // if you pass BLEAdvertisedDevice instead of address, it will be recognized type of peer device address (public or private)
+  {
+    printf("Failed to connect to server\n");
+    return false;
+  }
   printf(" - Connected to server\n");
   pClient->setMTU(517); // set client to request maximum MTU from server (default is 23 otherwise)
+  state = BLE_DISCOVERING;
 
   // Obtain a reference to the service we are after in the remote BLE server.
   BLERemoteService *pRemoteService = pClient->getService(serviceUUID);
@@ -52,8 +107,8 @@ bool connectToServer()
   printf(" - Found our service\n");
 
   // Obtain a reference to the characteristic in the service of the remote BLE server.
-  pRemoteCharacteristic = pRemoteService->getCharacteristic(charUUID);
-  if (pRemoteCharacteristic == nullptr)
+  BLERemoteCharacteristic *characteristic = pRemoteService->getCharacteristic(charUUID);
+  if (characteristic == nullptr)
   {
     printf("Failed to find our characteristic UUID: %s\n", charUUID.toString().c_str());
     pClient->disconnect();
@@ -62,21 +117,36 @@ bool connectToServer()
   printf(" - Found our characteristic\n");
 
   // Read the value of the characteristic.
-  if (pRemoteCharacteristic->canRead())
+  if (characteristic->canRead())
   {
-    std::string value = pRemoteCharacteristic->readValue();
+    std::string value = characteristic->readValue();
     printf("The characteristic value was: %s\n", value.c_str());
   }
 
-  if (pRemoteCharacteristic->canNotify())
+  if (characteristic->canNotify())
   {
-    pRemoteCharacteristic->registerForNotify(notifyCallback);
+    characteristic->registerForNotify(notifyCallback);
   }
 
-  connected = true;
+  pRemoteCharacteristic = characteristic;
   return true;
 }
 
+static void connectTask(void *)
+{
+  if (connectToServer())
+  {
+    backoff_ms = BLE_BACKOFF_INITIAL_MS;
+    state = BLE_READY;
+  }
+  else
+  {
+    enterBackoff();
+  }
+  memoryNoteTaskStack("ble_connect", uxTaskGetStackHighWaterMark(nullptr));
+  vTaskDelete(nullptr);
+}
+
 /**
  * Scan for BLE servers and find the first one that advertises the service we are looking for.
  */
@@ -87,70 +157,115 @@ class MyAdvertisedDeviceCallbacks : public BLEAdvertisedDeviceCallbacks
    */
   void onResult(BLEAdvertisedDevice advertisedDevice)
   {
-    printf("BLE Advertised Device found: %s\n", advertisedDevice.toString().c_str());
+    if (state != BLE_SCANNING)
+      return;
 
-    if (advertisedDevice.haveName() && advertisedDevice.getName() == "RepMate")
-    {
-      printf("Found the correct device by name!\n");
-      BLEDevice::getScan()->stop();
-      myDevice = new BLEAdvertisedDevice(advertisedDevice);
-      doConnect = true;
-    }
-
-    if (advertisedDevice.haveServiceUUID())
-    {
-      printf("Advertised service UUID: %s\n", advertisedDevice.getServiceUUID().toString().c_str());
-    }
+    bool name_match = advertisedDevice.haveName() && advertisedDevice.getName() == "RepMate";
+    bool service_match = advertisedDevice.haveServiceUUID() && advertisedDevice.isAdvertisingService(serviceUUID);
+    if (!name_match && !service_match)
+      return;
 
-    // We have found a device, let us now see if it contains the service we are looking for.
-    if (advertisedDevice.haveServiceUUID() && advertisedDevice.isAdvertisingService(serviceUUID))
-    {
-      BLEDevice::getScan()->stop();
-      printf("Target service UUID found!\n");
-      myDevice = new BLEAdvertisedDevice(advertisedDevice);
-      doConnect = true;
-      doScan = true;
-    }
+    printf("Found RepMate server: %s\n", advertisedDevice.toString().c_str());
+    BLEDevice::getScan()->stop();
+    delete myDevice;
+    myDevice = new BLEAdvertisedDevice(advertisedDevice);
+    state = BLE_CONNECTING;
   }
 };
 
+// Runs when a timed scan ends without finding the server
+static void scanComplete(BLEScanResults results)
+{
+  if (state == BLE_SCANNING)
+  {
+    enterBackoff();
+  }
+}
+
+static void startScan()
+{
+  state = BLE_SCANNING;
+  BLEScan *pBLEScan = BLEDevice::getScan();
+  pBLEScan->clearResults();
+  pBLEScan->start(BLE_SCAN_SECONDS, scanComplete, false); // Non-blocking with a completion callback
+}
+
 void BLEsetup()
 {
   BLEDevice::init("");
 
   // Retrieve a Scanner and set the callback we want to use to be informed when we
-  // have detected a new device.  Specify that we want active scanning and start the
-  // scan to run for 5 seconds.
+  // have detected a new device.  Specify that we want active scanning.
   BLEScan *pBLEScan = BLEDevice::getScan();
   pBLEScan->setAdvertisedDeviceCallbacks(new MyAdvertisedDeviceCallbacks());
   pBLEScan->setInterval(1349);
   pBLEScan->setWindow(449);
   pBLEScan->setActiveScan(true);
-  pBLEScan->start(5, false);
+  startScan();
 }
 
-void BLEloop(String message)
+void BLEloop()
 {
-  if (doConnect == true)
+  BleState current = state;
+
+  if (current == BLE_CONNECTING && reported_state != BLE_CONNECTING)
   {
-    if (connectToServer())
+    // First time we see the connect request, hand it to the worker task
+    if (xTaskCreatePinnedToCore(connectTask, "ble_connect", CONNECT_TASK_STACK, nullptr,
+                                CONNECT_TASK_PRIORITY, nullptr, CONNECT_TASK_CORE) != pdPASS)
     {
-      printf("We are now connected to the BLE Server.\n");
+      printf("Failed to start BLE connect task\n");
+      enterBackoff();
+      current = state;
     }
-    else
-    {
-      printf("We have failed to connect to the server; there is nothing more we will do.\n");
-    }
-    doConnect = false;
+  }
+  else if (current == BLE_BACKOFF && (int32_t)(millis() - retry_at) >= 0)
+  {
+    startScan();
+    current = state;
   }
 
-  if (connected)
+  if (current != reported_state)
   {
-    printf("Sending message to User: \"%s\"\n", message.c_str());
-    pRemoteCharacteristic->writeValue(message.c_str(), message.length());
+    printf("BLE state: %s -> %s\n", BLEstateName(reported_state), BLEstateName(current));
+    reported_state = current;
+    if (state_callback)
+    {
+      state_callback(current);
+    }
   }
-  else if (doScan)
+}
+
+void BLEsetStateCallback(BleStateCallback callback)
+{
+  state_callback = callback;
+}
+
+BleState BLEstate()
+{
+  return state;
+}
+
+bool BLEsendBytes(const uint8_t *data, size_t length)
+{
+  BLERemoteCharacteristic *characteristic = pRemoteCharacteristic;
+  if (state != BLE_READY || characteristic == nullptr)
   {
-    BLEDevice::getScan()->start(0);
+    return false;
   }
-}
\ No newline at end of file
+  characteristic->writeValue(const_cast<uint8_t *>(data), length);
+  return true;
+}
+
+bool BLEsend(const String &message)
+{
+  printf("Sending message to User: \"%s\"\n", message.c_str());
+  return BLEsendBytes((const uint8_t *)message.c_str(), message.length());
+}
+
+uint16_t BLEmtu()
+{
+  return (pClient != nullptr && state == BLE_READY) ? pClient->getMTU() : 23;
+}
+
+#endif
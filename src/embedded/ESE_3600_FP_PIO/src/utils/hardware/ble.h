@@ -6,6 +6,8 @@
 
 #include <BLEDevice.h>
 #include <Arduino.h>
+#include "packet_transport.h"
+#include "../trace/trace.h"
 
 // See the following for generating UUIDs:
 // https://www.uuidgenerator.net/
@@ -15,15 +17,60 @@ static BLEUUID serviceUUID("4fafc201-1fb5-459e-8fcc-c5c9c331914b");
 // The characteristic of the remote service we are interested in.
 static BLEUUID charUUID("beb5483e-36e1-4688-b7f5-ea07361b26a8");
 
-extern bool doConnect;
-extern bool connected;
-extern bool doScan;
+// Connection state machine. Scanning runs in the background, connecting and service
+// discovery run on a separate FreeRTOS task, so nothing here blocks the caller.
+enum BleState
+{
+  BLE_IDLE,        // Not started
+  BLE_SCANNING,    // Background scan for the RepMate server
+  BLE_CONNECTING,  // Server found, connect requested on the worker task
+  BLE_DISCOVERING, // Connected, looking up the service and characteristic
+  BLE_READY,       // Characteristic available, results can be sent
+  BLE_BACKOFF      // Scan or connect failed, waiting before the next scan
+};
+
+typedef void (*BleStateCallback)(BleState state);
+
+// Scan / reconnect timing
+const uint32_t BLE_SCAN_SECONDS = 5;
+const uint32_t BLE_BACKOFF_INITIAL_MS = 1000;
+const uint32_t BLE_BACKOFF_MAX_MS = 30000;
+
 extern BLERemoteCharacteristic *pRemoteCharacteristic;
 extern BLEAdvertisedDevice *myDevice;
 
-static void notifyCallback(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
-bool connectToServer();
 class MyClientCallback;
 class MyAdvertisedDeviceCallbacks;
+
+// Starts the background scan and returns immediately
 void BLEsetup();
-void BLEloop(String message);
\ No newline at end of file
+
+// Advances the state machine, call periodically; never blocks
+void BLEloop();
+
+// Called from BLEloop() whenever the state changes
+void BLEsetStateCallback(BleStateCallback callback);
+
+BleState BLEstate();
+const char *BLEstateName(BleState state);
+
+// Returns false (and drops the data) unless the link is ready
+bool BLEsend(const String &message);
+bool BLEsendBytes(const uint8_t *data, size_t length);
+
+// Negotiated ATT MTU, 23 until a connection has been made
+uint16_t BLEmtu();
+
+// PacketTransport over the remote characteristic, payload sized to the negotiated MTU. We are the
+// client, so packets are GATT writes to the peer, not notifications.
+class BleTransport : public PacketTransport
+{
+public:
+  bool ready() override { return BLEstate() == BLE_READY; }
+  size_t maxPayload() override { return BLEmtu() - 3; } // ATT write header
+  bool send(const uint8_t *data, size_t length) override
+  {
+    traceInstant(TRACE_BLE_SEND, length);
+    return BLEsendBytes(data, length);
+  }
+};
@@ -0,0 +1,115 @@
+#ifndef ARDUINO
+
+#include "ble.h"
+
+// Host stand-in for the radio. With REPMATE_BLE_LOG set a RepMate server is "in range":
+// it is found shortly after a scan starts and every write is appended to the log, prefixed
+// with its u16 length (the capture format stream_receiver.py reads). Without it, scans
+// never find anything and the state machine cycles through backoff like it would on the device.
+
+const uint32_t HOST_BLE_FOUND_MS = 300;
+const uint32_t HOST_BLE_CONNECT_MS = 200;
+const uint16_t HOST_BLE_MTU = 517;
+
+static BleState state = BLE_IDLE;
+static BleState reported_state = BLE_IDLE;
+static BleStateCallback state_callback = nullptr;
+static FILE *server_log = nullptr;
+
+static uint32_t state_since = 0;
+static uint32_t backoff_ms = BLE_BACKOFF_INITIAL_MS;
+
+static void enterState(BleState next)
+{
+  state = next;
+  state_since = millis();
+}
+
+void BLEsetup()
+{
+  const std::string &path = hostConfig().ble_log;
+  if (!path.empty() && server_log == nullptr)
+  {
+    server_log = fopen(path.c_str(), "wb");
+    if (server_log == nullptr)
+      printf("Cannot open BLE log %s\n", path.c_str());
+  }
+  enterState(BLE_SCANNING);
+}
+
+void BLEloop()
+{
+  uint32_t elapsed = millis() - state_since;
+  switch (state)
+  {
+  case BLE_SCANNING:
+    if (server_log && elapsed >= HOST_BLE_FOUND_MS)
+      enterState(BLE_CONNECTING);
+    else if (elapsed >= BLE_SCAN_SECONDS * 1000)
+      enterState(BLE_BACKOFF);
+    break;
+  case BLE_CONNECTING:
+    if (elapsed >= HOST_BLE_CONNECT_MS)
+    {
+      backoff_ms = BLE_BACKOFF_INITIAL_MS;
+      enterState(BLE_READY);
+    }
+    break;
+  case BLE_BACKOFF:
+    if (elapsed >= backoff_ms)
+    {
+      backoff_ms = min(backoff_ms * 2, BLE_BACKOFF_MAX_MS);
+      enterState(BLE_SCANNING);
+    }
+    break;
+  default:
+    break;
+  }
+
+  if (state != reported_state)
+  {
+    printf("BLE state: %s -> %s\n", BLEstateName(reported_state), BLEstateName(state));
+    reported_state = state;
+    if (state_callback)
+    {
+      state_callback(state);
+    }
+  }
+}
+
+void BLEsetStateCallback(BleStateCallback callback)
+{
+  state_callback = callback;
+}
+
+BleState BLEstate()
+{
+  return state;
+}
+
+bool BLEsendBytes(const uint8_t *data, size_t length)
+{
+  if (state != BLE_READY || server_log == nullptr || length > HOST_BLE_MTU - 3)
+  {
+    return false;
+  }
+  uint8_t prefix[2] = {(uint8_t)length, (uint8_t)(length >> 8)};
+  fwrite(prefix, 1, sizeof(prefix), server_log);
+  fwrite(data, 1, length, server_log);
+  fflush(server_log);
+  hostNoteEvent(HOST_EVENT_BLE_WRITE);
+  return true;
+}
+
+bool BLEsend(const String &message)
+{
+  printf("Sending message to User: \"%s\"\n", message.c_str());
+  return BLEsendBytes((const uint8_t *)message.c_str(), message.length());
+}
+
+uint16_t BLEmtu()
+{
+  return state == BLE_READY ? HOST_BLE_MTU : 23;
+}
+
+#endif
@@ -1,28 +1,20 @@
 #include "buzzer.h"
+#include "../hal/hal.h"
 
 void buzzerSetup()
 {
-  pinMode(D8, OUTPUT);   // Set pin D8 as output
-  digitalWrite(D8, LOW); // Initialize the pin to LOW
+  halToneAttach(BUZZER_PIN); // Drive the buzzer from the LEDC PWM peripheral
 }
 
+// Blocking tone, prefer cueTone() from cues.h which plays in the background
 void buzz(int frequency, long duration)
 {
-  int period = 1000000L / frequency;         // Calculate the period of the frequency
-  long cycles = frequency * duration / 1000; // Calculate the number of cycles for the duration
-  for (long i = 0; i < cycles; i++)
-  {
-    digitalWrite(D8, HIGH);        // Set the pin to HIGH
-    delayMicroseconds(period / 2); // Wait for half the period
-    digitalWrite(D8, LOW);         // Set the pin to LOW
-    delayMicroseconds(period / 2); // Wait for half the period
-  }
+  halTone(frequency);
+  halDelay(duration);
+  halTone(0);
 }
 
 void testBuzzer()
 {
-  digitalWrite(D8, HIGH);
-  delay(1);
-  digitalWrite(D8, LOW);
-  delay(1);
-}
\ No newline at end of file
+  buzz(1000, 2);
+}
@@ -1,5 +1,9 @@
+#pragma once
+
 #include <Arduino.h>
 
+const uint8_t BUZZER_PIN = D8;
+
 void buzzerSetup();
 void buzz(int frequency, long duration);
-void testBuzzer();
\ No newline at end of file
+void testBuzzer();
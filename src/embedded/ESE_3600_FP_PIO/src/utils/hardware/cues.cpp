@@ -0,0 +1,148 @@
+#include "cues.h"
+#include "../hal/hal.h"
+
+struct CueStep
+{
+  uint16_t value; // Frequency for tones, LED mask for patterns
+  uint16_t duration_ms;
+  bool notify;
+};
+
+struct CueChannel
+{
+  CueStep steps[CUE_QUEUE_LEN];
+  int head;
+  int count;
+  bool playing;
+  uint32_t step_end;
+};
+
+static CueChannel tone_channel;
+static CueChannel led_channel;
+static uint8_t cue_led_pins[CUE_LED_COUNT];
+static bool leds_attached = false;
+static CueCallback finished_callback = nullptr;
+static uint16_t current_frequency = 0;
+
+static void applyTone(uint16_t frequency)
+{
+  // Reprogramming the LEDC timer restarts the waveform, only touch it on a change
+  if (frequency == current_frequency)
+    return;
+  current_frequency = frequency;
+  halTone(frequency);
+}
+
+static void applyLeds(uint16_t mask)
+{
+  if (!leds_attached)
+    return;
+
+  for (int i = 0; i < CUE_LED_COUNT; i++)
+  {
+    halDigitalWrite(cue_led_pins[i], (mask >> i) & 1);
+  }
+}
+
+static bool push(CueChannel &channel, uint16_t value, uint16_t duration_ms, bool notify)
+{
+  if (channel.count >= CUE_QUEUE_LEN)
+    return false;
+
+  int tail = (channel.head + channel.count) % CUE_QUEUE_LEN;
+  channel.steps[tail] = {value, duration_ms, notify};
+  channel.count++;
+  return true;
+}
+
+static void update(CueChannel &channel, void (*apply)(uint16_t), uint32_t now)
+{
+  while (channel.count > 0)
+  {
+    CueStep &step = channel.steps[channel.head];
+
+    if (!channel.playing)
+    {
+      apply(step.value);
+      channel.playing = true;
+      channel.step_end = now + step.duration_ms;
+    }
+
+    // Held steps end as soon as something else is queued behind them
+    bool held = step.duration_ms == 0;
+    if (held ? channel.count == 1 : (int32_t)(now - channel.step_end) < 0)
+      return;
+
+    bool notify = step.notify;
+    uint32_t end = channel.step_end;
+    channel.head = (channel.head + 1) % CUE_QUEUE_LEN;
+    channel.count--;
+    channel.playing = false;
+
+    if (notify && finished_callback)
+      finished_callback();
+
+    // Chain from the scheduled end, not from now, so late polls don't stretch sequences
+    if (channel.count > 0 && !held)
+    {
+      CueStep &next = channel.steps[channel.head];
+      apply(next.value);
+      channel.playing = true;
+      channel.step_end = end + next.duration_ms;
+    }
+  }
+}
+
+void cuesSetup(uint8_t buzzer_pin, const uint8_t led_pins[CUE_LED_COUNT])
+{
+  halToneAttach(buzzer_pin);
+  for (int i = 0; i < CUE_LED_COUNT; i++)
+  {
+    cue_led_pins[i] = led_pins[i];
+    halPinMode(led_pins[i], HAL_OUTPUT);
+  }
+  leds_attached = true;
+  cuesClear();
+  applyLeds(0);
+}
+
+bool cueTone(uint16_t frequency, uint16_t duration_ms, bool notify)
+{
+  return push(tone_channel, frequency, duration_ms, notify);
+}
+
+bool cueLeds(uint8_t mask, uint16_t duration_ms)
+{
+  return push(led_channel, mask, duration_ms, false);
+}
+
+void cuesClear()
+{
+  tone_channel.head = tone_channel.count = 0;
+  tone_channel.playing = false;
+  led_channel.head = led_channel.count = 0;
+  led_channel.playing = false;
+  current_frequency = 0;
+  halTone(0);
+}
+
+void cuesUpdate()
+{
+  uint32_t now = halMillis();
+  update(tone_channel, applyTone, now);
+  update(led_channel, applyLeds, now);
+
+  // Nothing left to play, make sure the buzzer is quiet
+  if (tone_channel.count == 0)
+    applyTone(0);
+}
+
+bool cuesToneBusy()
+{
+  return tone_channel.count > 0;
+}
+
+void cueSetFinishedCallback(CueCallback callback)
+{
+  finished_callback = callback;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+// Asynchronous buzzer and LED feedback cues.
+// Tones and LED patterns sit in two independent queues that play out in the background
+// as cuesUpdate() is polled, so cues overlap with sampling and inference.
+
+const int CUE_QUEUE_LEN = 24;
+const int CUE_LED_COUNT = 5;
+
+typedef void (*CueCallback)();
+
+void cuesSetup(uint8_t buzzer_pin, const uint8_t led_pins[CUE_LED_COUNT]);
+
+// Queue a tone, frequency 0 is a rest. If notify is set the finished callback fires when it ends.
+// Returns false if the queue is full.
+bool cueTone(uint16_t frequency, uint16_t duration_ms, bool notify = false);
+
+// Queue an LED pattern, bit i drives led_pins[i]. A duration of 0 holds it until the next pattern.
+bool cueLeds(uint8_t mask, uint16_t duration_ms = 0);
+
+// Drops everything queued and silences the buzzer
+void cuesClear();
+
+// Advances both queues, call at least every few milliseconds
+void cuesUpdate();
+
+bool cuesToneBusy();
+
+void cueSetFinishedCallback(CueCallback callback);
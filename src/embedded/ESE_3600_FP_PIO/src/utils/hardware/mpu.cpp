@@ -1,4 +1,69 @@
 #include "mpu.h"
+#include <Arduino.h>
+#include "../hal/hal.h"
 
 // Define the global MPU instance
-Adafruit_MPU6050 mpu;
\ No newline at end of file
+Adafruit_MPU6050 mpu;
+
+static const uint8_t MPU6050_ACCEL_XOUT_H = 0x3B;
+static const uint8_t RAW_FRAME_BYTES = 14;
+static const uint16_t MOTION_THRESHOLD_MG_PER_LSB = 2; // MOT_THR
+
+// Counts per g and per deg/s for each range setting (datasheet table 6.1 / 6.2)
+static const float accel_counts_per_g[4] = {16384, 8192, 4096, 2048};
+static const float gyro_counts_per_dps[4] = {131, 65.5, 32.8, 16.4};
+
+bool mpuReadRaw(MpuRawFrame *frame)
+{
+  Wire.beginTransmission(MPU6050_I2CADDR_DEFAULT);
+  Wire.write(MPU6050_ACCEL_XOUT_H);
+  if (Wire.endTransmission(false) != 0)
+    return false;
+  if (Wire.requestFrom((uint8_t)MPU6050_I2CADDR_DEFAULT, RAW_FRAME_BYTES) != RAW_FRAME_BYTES)
+    return false;
+
+  int16_t words[RAW_FRAME_BYTES / 2];
+  for (int i = 0; i < RAW_FRAME_BYTES / 2; i++)
+  {
+    uint8_t high = Wire.read();
+    uint8_t low = Wire.read();
+    words[i] = (int16_t)(high << 8 | low);
+  }
+  for (int axis = 0; axis < 3; axis++)
+  {
+    frame->accel[axis] = words[axis];
+    frame->gyro[axis] = words[4 + axis];
+  }
+  frame->temperature = words[3];
+  return true;
+}
+
+float mpuAccelPerCount()
+{
+  return SENSORS_GRAVITY_STANDARD / accel_counts_per_g[mpu.getAccelerometerRange()];
+}
+
+float mpuGyroPerCount()
+{
+  return SENSORS_DPS_TO_RADS / gyro_counts_per_dps[mpu.getGyroRange()];
+}
+
+void mpuEnableMotionInterrupt(uint8_t int_pin, uint16_t threshold_mg, uint8_t duration_ms)
+{
+  uint16_t threshold = threshold_mg / MOTION_THRESHOLD_MG_PER_LSB;
+  mpu.setHighPassFilter(MPU6050_HIGHPASS_0_63_HZ);
+  mpu.setMotionDetectionThreshold(threshold > 255 ? 255 : (uint8_t)threshold);
+  mpu.setMotionDetectionDuration(duration_ms);
+  mpu.setInterruptPinLatch(true);
+  mpu.setInterruptPinPolarity(false); // Active high
+  mpu.setMotionInterrupt(true);
+  halPinMode(int_pin, HAL_INPUT_PULLDOWN); // An unconnected INT stays low instead of floating into wakeups
+#ifndef ARDUINO
+  hostSetPinSource(int_pin, hostMpuInterruptLine); // The INT line, as the board wires it
+#endif
+}
+
+bool mpuMotionSeen()
+{
+  return mpu.getMotionInterruptStatus();
+}
@@ -2,4 +2,27 @@
 
 #include <Adafruit_MPU6050.h>
 
-extern Adafruit_MPU6050 mpu;
\ No newline at end of file
+extern Adafruit_MPU6050 mpu;
+
+// One burst read of the data registers, ACCEL_XOUT_H (0x3B) to GYRO_ZOUT_L (0x48), in chip units
+struct MpuRawFrame
+{
+  int16_t accel[3];
+  int16_t temperature;
+  int16_t gyro[3];
+};
+
+// Reads the registers directly instead of through getEvent(), no float conversion
+bool mpuReadRaw(MpuRawFrame *frame);
+
+// Size of one count at the configured ranges: m/s^2 and rad/s, what getEvent() would report
+float mpuAccelPerCount();
+float mpuGyroPerCount();
+
+// Motion detection on INT: accel samples through the 0.63 Hz high-pass filter, compared against
+// threshold_mg on any axis for duration_ms in a row. The pin is active high and latched until
+// mpuMotionSeen() reads the status, so motion between polls is not lost.
+void mpuEnableMotionInterrupt(uint8_t int_pin, uint16_t threshold_mg, uint8_t duration_ms);
+
+// Whether motion was detected since the last call, clears the latch
+bool mpuMotionSeen();
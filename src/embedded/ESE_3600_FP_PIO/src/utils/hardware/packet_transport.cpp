@@ -0,0 +1,13 @@
+#include "packet_transport.h"
+#include <string.h>
+
+bool LoopbackTransport::send(const uint8_t *data, size_t length)
+{
+  if (!is_ready || length > max_payload || length > MAX_PACKET_SIZE || packet_count >= MAX_PACKETS)
+    return false;
+
+  memcpy(packets[packet_count], data, length);
+  lengths[packet_count] = length;
+  packet_count++;
+  return true;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Anything that can carry packets off the device: the BLE link, or a loopback for host tests.
+class PacketTransport
+{
+public:
+  virtual ~PacketTransport() {}
+
+  // True when send() can be expected to succeed
+  virtual bool ready() = 0;
+
+  // Largest payload a single send() may carry (ATT MTU minus header for BLE)
+  virtual size_t maxPayload() = 0;
+
+  virtual bool send(const uint8_t *data, size_t length) = 0;
+};
+
+// Keeps sent packets in RAM so they can be decoded without a radio
+class LoopbackTransport : public PacketTransport
+{
+public:
+  static const int MAX_PACKETS = 16;
+  static const size_t MAX_PACKET_SIZE = 512;
+
+  explicit LoopbackTransport(size_t max_payload = MAX_PACKET_SIZE) : max_payload(max_payload) {}
+
+  bool ready() override { return is_ready; }
+  size_t maxPayload() override { return max_payload; }
+  bool send(const uint8_t *data, size_t length) override;
+
+  void setReady(bool ready) { is_ready = ready; }
+  void setMaxPayload(size_t payload) { max_payload = payload; } // An MTU exchange
+  void clear() { packet_count = 0; }
+
+  int packetCount() const { return packet_count; }
+  const uint8_t *packet(int index) const { return packets[index]; }
+  size_t packetLength(int index) const { return lengths[index]; }
+
+private:
+  size_t max_payload;
+  bool is_ready = true;
+  uint8_t packets[MAX_PACKETS][MAX_PACKET_SIZE];
+  size_t lengths[MAX_PACKETS];
+  int packet_count = 0;
+};
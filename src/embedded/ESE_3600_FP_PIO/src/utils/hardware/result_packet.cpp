@@ -0,0 +1,184 @@
+#include "result_packet.h"
+#include <string.h>
+
+static inline void put_u16(uint8_t *out, uint16_t value)
+{
+  out[0] = (uint8_t)value;
+  out[1] = (uint8_t)(value >> 8);
+}
+
+static inline void put_u32(uint8_t *out, uint32_t value)
+{
+  put_u16(out, (uint16_t)value);
+  put_u16(out + 2, (uint16_t)(value >> 16));
+}
+
+static inline uint16_t get_u16(const uint8_t *in)
+{
+  return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static inline uint32_t get_u32(const uint8_t *in)
+{
+  return get_u16(in) | ((uint32_t)get_u16(in + 2) << 16);
+}
+
+uint8_t quantizeProbability(float probability)
+{
+  if (probability <= 0.0f)
+    return 0;
+  if (probability >= 1.0f)
+    return 255;
+  return (uint8_t)(probability * 255.0f + 0.5f);
+}
+
+void makeResultRecord(ResultRecord *record, uint16_t seq, const float *softmax, int class_count,
+                      int class_idx, uint32_t inference_us)
+{
+  if (class_count > RESULT_MAX_CLASSES)
+    class_count = RESULT_MAX_CLASSES;
+
+  record->seq = seq;
+  record->class_idx = (uint8_t)class_idx;
+  record->class_count = (uint8_t)class_count;
+  for (int i = 0; i < class_count; i++)
+  {
+    record->probabilities[i] = quantizeProbability(softmax[i]);
+  }
+  record->inference_us = inference_us;
+  record->rep_count = 0;
+  record->concentric_ms = 0;
+  record->eccentric_ms = 0;
+  record->rom_deg = 0;
+  record->lift_idx = RESULT_NO_HEAD;
+  record->phase_idx = RESULT_NO_HEAD;
+}
+
+size_t encodeResultBatch(const ResultRecord *records, int count, uint8_t *out, size_t out_size)
+{
+  if (count <= 0 || count > 255)
+    return 0;
+
+  uint8_t class_count = records[0].class_count;
+  size_t total = RESULT_BATCH_HEADER_BYTES + count * resultRecordBytes(class_count);
+  if (total > out_size)
+    return 0;
+
+  out[0] = RESULT_PACKET_VERSION;
+  out[1] = class_count;
+  out[2] = (uint8_t)count;
+
+  uint8_t *p = out + RESULT_BATCH_HEADER_BYTES;
+  for (int r = 0; r < count; r++)
+  {
+    const ResultRecord &record = records[r];
+    put_u16(p, record.seq);
+    p[2] = record.class_idx;
+    memcpy(p + 3, record.probabilities, class_count);
+    p += 3 + class_count;
+    put_u32(p, record.inference_us);
+    put_u16(p + 4, record.rep_count);
+    put_u16(p + 6, record.concentric_ms);
+    put_u16(p + 8, record.eccentric_ms);
+    put_u16(p + 10, record.rom_deg);
+    p[12] = record.lift_idx;
+    p[13] = record.phase_idx;
+    p += 14;
+  }
+  return total;
+}
+
+int decodeResultBatch(const uint8_t *data, size_t length, ResultRecord *records, int max_records)
+{
+  if (length < RESULT_BATCH_HEADER_BYTES || data[0] != RESULT_PACKET_VERSION)
+    return -1;
+
+  uint8_t class_count = data[1];
+  int count = data[2];
+  if (class_count > RESULT_MAX_CLASSES || count > max_records ||
+      length != RESULT_BATCH_HEADER_BYTES + count * resultRecordBytes(class_count))
+    return -1;
+
+  const uint8_t *p = data + RESULT_BATCH_HEADER_BYTES;
+  for (int r = 0; r < count; r++)
+  {
+    ResultRecord &record = records[r];
+    record.seq = get_u16(p);
+    record.class_idx = p[2];
+    record.class_count = class_count;
+    memcpy(record.probabilities, p + 3, class_count);
+    p += 3 + class_count;
+    record.inference_us = get_u32(p);
+    record.rep_count = get_u16(p + 4);
+    record.concentric_ms = get_u16(p + 6);
+    record.eccentric_ms = get_u16(p + 8);
+    record.rom_deg = get_u16(p + 10);
+    record.lift_idx = p[12];
+    record.phase_idx = p[13];
+    p += 14;
+  }
+  return count;
+}
+
+void resultBatcherReset(ResultBatcher *batcher)
+{
+  batcher->count = 0;
+  batcher->oldest_ms = 0;
+  batcher->dropped = 0;
+}
+
+void resultBatcherAdd(ResultBatcher *batcher, const ResultRecord &record, uint32_t now_ms)
+{
+  if (batcher->count == RESULT_BATCH_CAPACITY)
+  {
+    memmove(batcher->records, batcher->records + 1, (RESULT_BATCH_CAPACITY - 1) * sizeof(ResultRecord));
+    batcher->count--;
+    batcher->dropped++;
+  }
+  if (batcher->count == 0)
+    batcher->oldest_ms = now_ms;
+  batcher->records[batcher->count++] = record;
+}
+
+int resultBatcherFlush(ResultBatcher *batcher, PacketTransport &transport, uint32_t now_ms, bool force)
+{
+  if (batcher->count == 0 || !transport.ready())
+    return 0;
+
+  uint8_t packet[512];
+  size_t record_bytes = resultRecordBytes(batcher->records[0].class_count);
+  size_t payload = transport.maxPayload();
+  if (payload > sizeof(packet))
+    payload = sizeof(packet);
+  if (payload < RESULT_BATCH_HEADER_BYTES + record_bytes)
+    return 0;
+
+  int per_packet = (int)((payload - RESULT_BATCH_HEADER_BYTES) / record_bytes);
+  if (per_packet > RESULT_BATCH_CAPACITY)
+    per_packet = RESULT_BATCH_CAPACITY;
+
+  bool full = batcher->count >= per_packet;
+  bool stale = (int32_t)(now_ms - batcher->oldest_ms) >= (int32_t)RESULT_BATCH_MAX_AGE_MS;
+  if (!full && !stale && !force)
+    return 0;
+
+  int sent = 0;
+  while (sent < batcher->count)
+  {
+    int n = batcher->count - sent;
+    if (n > per_packet)
+      n = per_packet;
+
+    size_t length = encodeResultBatch(batcher->records + sent, n, packet, sizeof(packet));
+    if (length == 0 || !transport.send(packet, length))
+      break;
+    sent += n;
+  }
+
+  // Keep whatever didn't go out for the next attempt
+  memmove(batcher->records, batcher->records + sent, (batcher->count - sent) * sizeof(ResultRecord));
+  batcher->count -= sent;
+  if (batcher->count > 0)
+    batcher->oldest_ms = now_ms;
+  return sent;
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "packet_transport.h"
+
+// Compact binary classification results, batched into as few BLE writes as the MTU allows.
+//
+// Batch:  version (u8) | class_count (u8) | record_count (u8) | records...
+// Record: seq (u16) | class_idx (u8) | probabilities (u8 x class_count, softmax * 255)
+//         | inference_us (u32) | rep_count (u16) | concentric_ms (u16) | eccentric_ms (u16) | rom_deg (u16)
+//         | lift_idx (u8) | phase_idx (u8)
+// rep_count counts reps in the current set; the tempo fields describe its latest rep (0 without one).
+// lift_idx and phase_idx are the lift and phase heads' classes, RESULT_NO_HEAD if the model has no such head.
+// All multi-byte fields are little-endian. result_packets.py decodes this on the host.
+
+const uint8_t RESULT_PACKET_VERSION = 3;
+const size_t RESULT_BATCH_HEADER_BYTES = 3;
+const int RESULT_MAX_CLASSES = 8;
+const int RESULT_BATCH_CAPACITY = 32;
+const uint8_t RESULT_NO_HEAD = 0xFF;
+
+// Backstop for results queued while the link was down: the firmware flushes each result as its window
+// or rep finishes, bleTask() sends a partial batch once its oldest result has waited this long
+const uint32_t RESULT_BATCH_MAX_AGE_MS = 2000;
+
+struct ResultRecord
+{
+  uint16_t seq;
+  uint8_t class_idx;
+  uint8_t class_count;
+  uint8_t probabilities[RESULT_MAX_CLASSES];
+  uint32_t inference_us;
+  uint16_t rep_count;
+  uint16_t concentric_ms;
+  uint16_t eccentric_ms;
+  uint16_t rom_deg;
+  uint8_t lift_idx;
+  uint8_t phase_idx;
+};
+
+struct ResultBatcher
+{
+  ResultRecord records[RESULT_BATCH_CAPACITY];
+  int count;
+  uint32_t oldest_ms;
+  uint32_t dropped;
+};
+
+inline size_t resultRecordBytes(uint8_t class_count)
+{
+  return 2 + 1 + class_count + 4 + 2 + 6 + 2;
+}
+
+uint8_t quantizeProbability(float probability);
+
+// Fills a record from a softmax vector, the rep fields start at 0 and the other heads at RESULT_NO_HEAD
+void makeResultRecord(ResultRecord *record, uint16_t seq, const float *softmax, int class_count,
+                      int class_idx, uint32_t inference_us);
+
+// Returns the encoded size, or 0 if out_size is too small. All records must share class_count.
+size_t encodeResultBatch(const ResultRecord *records, int count, uint8_t *out, size_t out_size);
+
+// Returns the number of records decoded, or -1 if the packet is malformed
+int decodeResultBatch(const uint8_t *data, size_t length, ResultRecord *records, int max_records);
+
+void resultBatcherReset(ResultBatcher *batcher);
+
+// Queues a result; when full the oldest one is dropped
+void resultBatcherAdd(ResultBatcher *batcher, const ResultRecord &record, uint32_t now_ms);
+
+// Sends queued results when the batch is full, old enough, or force is set.
+// Each packet is packed up to the transport's payload size. Returns the number of records sent.
+int resultBatcherFlush(ResultBatcher *batcher, PacketTransport &transport, uint32_t now_ms, bool force = false);
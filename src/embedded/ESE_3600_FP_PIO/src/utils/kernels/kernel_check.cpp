@@ -0,0 +1,176 @@
+#include "kernel_check.h"
+#include "kernels.h"
+#include <Arduino.h>
+#include <math.h>
+#include <string.h>
+#include "../tflite/decimator.h"
+
+const int CHECK_SAMPLES = 1000;
+const int CHECK_SOFTMAX_VECTORS = 2000;
+const int CHECK_EXP_POINTS = 100000;
+const float CHECK_FIR_SCALE = 1.0f / 32767; // The int16 build's, so the final multiply is not by 1
+
+// Floats ordered as integers, so neighbours are 1 apart across zero too. Two NaNs match.
+static uint32_t ulpDistance(float a, float b)
+{
+  if (a == b)
+    return 0;
+  if (isnan(a) || isnan(b))
+    return isnan(a) && isnan(b) ? 0 : UINT32_MAX;
+  int32_t ia, ib;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  int64_t oa = ia < 0 ? (int64_t)INT32_MIN - ia : ia;
+  int64_t ob = ib < 0 ? (int64_t)INT32_MIN - ib : ib;
+  int64_t distance = oa > ob ? oa - ob : ob - oa;
+  return distance > UINT32_MAX ? UINT32_MAX : (uint32_t)distance;
+}
+
+static void compare(KernelCheck *check, const float *a, const float *b, size_t count)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    uint32_t ulp = ulpDistance(a[i], b[i]);
+    if (ulp > check->max_ulp)
+      check->max_ulp = ulp;
+  }
+  check->values += count;
+}
+
+// Deterministic inputs, the same on every platform
+static uint32_t lcg_state;
+
+static float randomUniform(float low, float high)
+{
+  lcg_state = lcg_state * 1664525u + 1013904223u;
+  return low + (high - low) * ((lcg_state >> 8) * (1.0f / 16777216.0f));
+}
+
+// Readings around and past the accel and gyro ranges, some exactly on the bounds, a NaN and infinities.
+// The odd count leaves a partial sample for the tail.
+static KernelCheck checkNormalize(float *in, float *a, float *b)
+{
+  const float min[KERNEL_CHANNELS] = {-25.0f, -25.0f, -25.0f, -8.0f, -8.0f, -8.0f};
+  const float max[KERNEL_CHANNELS] = {30.0f, 30.0f, 30.0f, 7.0f, 7.0f, 7.0f};
+  float inv_range[KERNEL_CHANNELS];
+  for (int c = 0; c < KERNEL_CHANNELS; c++)
+    inv_range[c] = 1.0f / (max[c] - min[c]);
+
+  const size_t count = CHECK_SAMPLES * KERNEL_CHANNELS + 3;
+  lcg_state = 1;
+  for (size_t i = 0; i < count; i++)
+  {
+    int c = i % KERNEL_CHANNELS;
+    in[i] = i % 97 == 0 ? min[c] : (i % 89 == 0 ? max[c] : randomUniform(min[c] * 1.5f, max[c] * 1.5f));
+  }
+  in[10] = NAN;
+  in[11] = INFINITY;
+  in[12] = -INFINITY;
+
+  KernelCheck check = {"normalize", "reference", 0, 0};
+  kernelNormalizeReference(in, a, count, min, inv_range);
+  kernelNormalize(in, b, count, min, inv_range);
+  compare(&check, a, b, count);
+  return check;
+}
+
+// Every output of a window through each decimator filter, rows clamped at the ends as decimate() does
+static KernelCheck checkFir6(float *in)
+{
+  lcg_state = 2;
+  for (int i = 0; i < CHECK_SAMPLES * KERNEL_CHANNELS; i++)
+    in[i] = randomUniform(0.0f, 1.0f);
+
+  KernelCheck check = {"fir6", "reference", 0, 0};
+  const int outputs = CHECK_SAMPLES / DECIMATION_FACTOR;
+  for (int filter = 0; filter < DECIMATOR_FILTER_COUNT; filter++)
+  {
+    const DecimatorTaps *taps = decimatorTaps(filter);
+    for (int i = 0; i < outputs; i++)
+    {
+      const float *rows[DECIMATOR_MAX_TAPS];
+      long first = (long)i * DECIMATION_FACTOR + taps->delay - (taps->length - 1);
+      for (int r = 0; r < taps->length; r++)
+      {
+        long n = first + r;
+        n = n < 0 ? 0 : (n >= CHECK_SAMPLES ? CHECK_SAMPLES - 1 : n);
+        rows[r] = in + n * KERNEL_CHANNELS;
+      }
+      float a[KERNEL_CHANNELS], b[KERNEL_CHANNELS];
+      kernelFir6Reference(rows, taps->taps, taps->length, taps->gain, CHECK_FIR_SCALE, a);
+      kernelFir6(rows, taps->taps, taps->length, taps->gain, CHECK_FIR_SCALE, b);
+      compare(&check, a, b, KERNEL_CHANNELS);
+    }
+  }
+  return check;
+}
+
+// 1 to 9 logits (whole vectors and tails), spread like a confident model and far wider
+static KernelCheck checkSoftmax()
+{
+  KernelCheck check = {"softmax", "reference", 0, 0};
+  lcg_state = 3;
+  for (int v = 0; v < CHECK_SOFTMAX_VECTORS; v++)
+  {
+    float logits[9], a[9], b[9];
+    size_t count = 1 + v % 9;
+    float spread = v % 2 ? 200.0f : 20.0f;
+    for (size_t i = 0; i < count; i++)
+      logits[i] = randomUniform(-spread, spread);
+    kernelSoftmaxReference(logits, a, count);
+    kernelSoftmax(logits, b, count);
+    compare(&check, a, b, count);
+  }
+  return check;
+}
+
+// Accuracy of the polynomial itself over the range it covers
+static KernelCheck checkExp()
+{
+  KernelCheck check = {"exp", "libm", 0, 0};
+  const float step = (KERNEL_EXP_MAX - KERNEL_EXP_MIN) / CHECK_EXP_POINTS;
+  for (int i = 0; i < CHECK_EXP_POINTS; i++)
+  {
+    float x = KERNEL_EXP_MIN + step * i;
+    float a = expf(x), b = kernelExp(x);
+    compare(&check, &a, &b, 1);
+  }
+  return check;
+}
+
+int kernelCheckRun(KernelCheck *out, int max)
+{
+  // Scratch for the duration of the check only
+  float *in = new float[CHECK_SAMPLES * KERNEL_CHANNELS + 3];
+  float *a = new float[CHECK_SAMPLES * KERNEL_CHANNELS + 3];
+  float *b = new float[CHECK_SAMPLES * KERNEL_CHANNELS + 3];
+  const KernelCheck checks[KERNEL_CHECK_COUNT] = {checkNormalize(in, a, b), checkFir6(in), checkSoftmax(), checkExp()};
+  delete[] in;
+  delete[] a;
+  delete[] b;
+
+  int count = 0;
+  for (const KernelCheck &check : checks)
+  {
+    if (count < max)
+      out[count++] = check;
+  }
+  return count;
+}
+
+void kernelCheckReport(Print &out)
+{
+  KernelCheck checks[KERNEL_CHECK_COUNT];
+  int count = kernelCheckRun(checks, KERNEL_CHECK_COUNT);
+
+  out.println("START_KERNELS");
+  out.printf("{\"impl\": \"%s\"}\n", kernelImplName());
+  for (int i = 0; i < count; i++)
+  {
+    const KernelCheck &check = checks[i];
+    out.printf("{\"kernel\": \"%s\", \"against\": \"%s\", \"values\": %lu, \"max_ulp\": %lu}\n", check.kernel,
+               check.against, (unsigned long)check.values, (unsigned long)check.max_ulp);
+  }
+  out.println("END_KERNELS");
+  out.flush();
+}
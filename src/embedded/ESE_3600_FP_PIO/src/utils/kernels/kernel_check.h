@@ -0,0 +1,30 @@
+#pragma once
+
+// Checks the build's kernels (kernels.h) against the reference on fixed inputs, for kernel_check.py.
+// The "kernels" console command prints the largest difference per kernel in ULP:
+//
+//   START_KERNELS
+//   {"impl": "x86_sse2"}
+//   {"kernel": "normalize", "against": "reference", "values": 6003, "max_ulp": 0}
+//   ...
+//   {"kernel": "exp", "against": "libm", "values": 100000, "max_ulp": 1}
+//   END_KERNELS
+
+#include <stdint.h>
+
+class Print;
+
+struct KernelCheck
+{
+  const char *kernel;
+  const char *against; // "reference", or "libm" for the exp polynomial
+  uint32_t values;
+  uint32_t max_ulp;
+};
+
+const int KERNEL_CHECK_COUNT = 4;
+
+// Runs every check, returns how many results were written
+int kernelCheckRun(KernelCheck *out, int max);
+
+void kernelCheckReport(Print &out);
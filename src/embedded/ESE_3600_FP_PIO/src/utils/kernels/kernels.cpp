@@ -0,0 +1,99 @@
+#include "kernels.h"
+#include <string.h>
+
+// The comparisons are written so a NaN falls through to the bound, as SSE's max/min do
+static inline float clamp01(float x)
+{
+  x = x > 0.0f ? x : 0.0f;
+  return x < 1.0f ? x : 1.0f;
+}
+
+void kernelNormalizeReference(const float *in, float *out, size_t count, const float *min, const float *inv_range)
+{
+  for (size_t i = 0; i < count; i++)
+  {
+    int channel = i % KERNEL_CHANNELS;
+    out[i] = clamp01((in[i] - min[channel]) * inv_range[channel]);
+  }
+}
+
+void kernelFir6Reference(const float *const *rows, const float *taps, int length, float gain, float scale, float *y)
+{
+  float acc[KERNEL_CHANNELS] = {};
+  for (int k = length - 1, r = 0; k >= 0; k--, r++)
+  {
+    for (int c = 0; c < KERNEL_CHANNELS; c++)
+      acc[c] += taps[k] * rows[r][c];
+  }
+  for (int c = 0; c < KERNEL_CHANNELS; c++)
+    y[c] = acc[c] / gain * scale;
+}
+
+float kernelExp(float x)
+{
+  bool underflow = x < KERNEL_EXP_MIN;
+  x = x > KERNEL_EXP_MIN ? x : KERNEL_EXP_MIN;
+  x = x < KERNEL_EXP_MAX ? x : KERNEL_EXP_MAX;
+
+  // x = n ln2 + r, |r| <= ln2 / 2
+  float t = x * KERNEL_EXP_LOG2E;
+  t = t + KERNEL_EXP_ROUND;
+  float n = t - KERNEL_EXP_ROUND;
+  float r = x - n * KERNEL_EXP_LN2_HI;
+  r = r - n * KERNEL_EXP_LN2_LO;
+
+  // e^r = 1 + r + r^2 P(r)
+  float p = KERNEL_EXP_P[0];
+  for (int k = 1; k < 6; k++)
+    p = p * r + KERNEL_EXP_P[k];
+  float y = p * (r * r) + r + 1.0f;
+
+  // 2^n straight into the exponent bits
+  int32_t bits = ((int32_t)n + 127) << 23;
+  float two_n;
+  memcpy(&two_n, &bits, sizeof(two_n));
+  y = y * two_n;
+  return underflow ? 0.0f : y;
+}
+
+void kernelSoftmaxReference(const float *logits, float *out, size_t count)
+{
+  float max = logits[0];
+  for (size_t i = 1; i < count; i++)
+    max = logits[i] > max ? logits[i] : max;
+
+  float sum = 0.0f;
+  for (size_t i = 0; i < count; i++)
+  {
+    out[i] = kernelExp(logits[i] - max);
+    sum += out[i];
+  }
+  sum = sum > KERNEL_SOFTMAX_MIN_SUM ? sum : KERNEL_SOFTMAX_MIN_SUM;
+
+  for (size_t i = 0; i < count; i++)
+    out[i] = out[i] / sum;
+}
+
+#if KERNELS_IMPL == KERNELS_REFERENCE
+
+const char *kernelImplName()
+{
+  return "reference";
+}
+
+void kernelNormalize(const float *in, float *out, size_t count, const float *min, const float *inv_range)
+{
+  kernelNormalizeReference(in, out, count, min, inv_range);
+}
+
+void kernelFir6(const float *const *rows, const float *taps, int length, float gain, float scale, float *y)
+{
+  kernelFir6Reference(rows, taps, length, gain, scale, y);
+}
+
+void kernelSoftmax(const float *logits, float *out, size_t count)
+{
+  kernelSoftmaxReference(logits, out, count);
+}
+
+#endif
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(ARDUINO) && defined(__XTENSA__)
+#include <sdkconfig.h>
+#endif
+
+// Float kernels for the hot loops of preprocessing and the model output: normalization, one
+// decimator output, softmax.
+//
+// kernels.cpp holds the portable reference, the definition of each kernel. One implementation is
+// picked at build time with -DKERNELS_IMPL=... and has to give the reference's results bit for bit:
+// the same operations in the same order per element, a multiply and an add never fused, and sums
+// that cross lanes done in reference order. The "kernels" console command (kernel_check.py)
+// compares them on fixed inputs.
+
+#define KERNELS_REFERENCE 0 // Plain loops, kernels.cpp
+#define KERNELS_X86 1       // SSE2, AVX where the build enables it (-mavx), kernels_x86.cpp, host benchmarks
+#define KERNELS_ESP32S3 2   // Register-blocked for the LX7 FPU, kernels_esp32s3.cpp
+
+#ifndef KERNELS_IMPL
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+#define KERNELS_IMPL KERNELS_ESP32S3
+#elif defined(__SSE2__)
+#define KERNELS_IMPL KERNELS_X86
+#else
+#define KERNELS_IMPL KERNELS_REFERENCE
+#endif
+#endif
+
+const int KERNEL_CHANNELS = 6; // Interleaved channels of one sample
+
+const char *kernelImplName();
+
+// clamp((in[i] - min[c]) * inv_range[c], 0, 1) for channel c = i % KERNEL_CHANNELS. NaN gives 0.
+void kernelNormalize(const float *in, float *out, size_t count, const float *min, const float *inv_range);
+
+// One decimator output: taps[length - 1 - r] * rows[r][c] summed over r, oldest row first, then
+// divided by gain and multiplied by scale, for the KERNEL_CHANNELS interleaved channels of each row
+void kernelFir6(const float *const *rows, const float *taps, int length, float gain, float scale, float *y);
+
+// exp(logits[i] - max) / sum, the sum floored at 1e-9
+void kernelSoftmax(const float *logits, float *out, size_t count);
+
+// Range-reduced polynomial exp (Cody-Waite, degree 6), within a couple of ULP of expf over
+// [-87.3, 88]; 0 below, exp(88) above. Float throughout, unlike libm exp() on a float.
+float kernelExp(float x);
+
+void kernelNormalizeReference(const float *in, float *out, size_t count, const float *min, const float *inv_range);
+void kernelFir6Reference(const float *const *rows, const float *taps, int length, float gain, float scale, float *y);
+void kernelSoftmaxReference(const float *logits, float *out, size_t count);
+
+// Constants the exp implementations share
+const float KERNEL_EXP_MIN = -87.3365448f; // ln(FLT_MIN), below it the result is 0
+const float KERNEL_EXP_MAX = 88.0f;        // Keeps 2^n finite
+const float KERNEL_EXP_LOG2E = 1.44269504089f;
+const float KERNEL_EXP_ROUND = 12582912.0f; // 1.5 * 2^23, adding and subtracting it rounds to an integer
+const float KERNEL_EXP_LN2_HI = 0.693359375f; // ln 2 split so n * LN2_HI is exact
+const float KERNEL_EXP_LN2_LO = -2.12194440e-4f;
+const float KERNEL_EXP_P[6] = {1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+                               4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f};
+const float KERNEL_SOFTMAX_MIN_SUM = 1e-9f;
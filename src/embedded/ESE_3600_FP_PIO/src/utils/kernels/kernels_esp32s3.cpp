@@ -0,0 +1,72 @@
+#include "kernels.h"
+
+#if KERNELS_IMPL == KERNELS_ESP32S3
+
+// The S3's PIE vector instructions work on 8/16/32-bit integers only, floats still go through the
+// LX7's scalar FPU (madd.s, no divide instruction). So these keep a whole sample's channels and
+// their constants in FPU registers, with no per-value channel index, and leave the vector unit to
+// integer kernels. The envs build with -ffp-contract=off, otherwise GCC would fuse the multiply-adds
+// into madd.s and move results by an ULP from the reference; the "kernels" command checks they don't.
+
+const char *kernelImplName()
+{
+  return "esp32s3";
+}
+
+static inline float clamp01(float x)
+{
+  x = x > 0.0f ? x : 0.0f;
+  return x < 1.0f ? x : 1.0f;
+}
+
+void kernelNormalize(const float *in, float *out, size_t count, const float *min, const float *inv_range)
+{
+  const float m0 = min[0], m1 = min[1], m2 = min[2], m3 = min[3], m4 = min[4], m5 = min[5];
+  const float s0 = inv_range[0], s1 = inv_range[1], s2 = inv_range[2], s3 = inv_range[3], s4 = inv_range[4],
+              s5 = inv_range[5];
+  size_t i = 0;
+  for (; i + KERNEL_CHANNELS <= count; i += KERNEL_CHANNELS)
+  {
+    const float *x = in + i;
+    float *y = out + i;
+    y[0] = clamp01((x[0] - m0) * s0);
+    y[1] = clamp01((x[1] - m1) * s1);
+    y[2] = clamp01((x[2] - m2) * s2);
+    y[3] = clamp01((x[3] - m3) * s3);
+    y[4] = clamp01((x[4] - m4) * s4);
+    y[5] = clamp01((x[5] - m5) * s5);
+  }
+  kernelNormalizeReference(in + i, out + i, count - i, min, inv_range);
+}
+
+void kernelFir6(const float *const *rows, const float *taps, int length, float gain, float scale, float *y)
+{
+  float a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0;
+  for (int k = length - 1, r = 0; k >= 0; k--, r++)
+  {
+    const float *x = rows[r];
+    const float h = taps[k];
+    a0 += h * x[0];
+    a1 += h * x[1];
+    a2 += h * x[2];
+    a3 += h * x[3];
+    a4 += h * x[4];
+    a5 += h * x[5];
+  }
+  // Divided rather than multiplied by 1 / gain, so the box-car mean stays exact
+  y[0] = a0 / gain * scale;
+  y[1] = a1 / gain * scale;
+  y[2] = a2 / gain * scale;
+  y[3] = a3 / gain * scale;
+  y[4] = a4 / gain * scale;
+  y[5] = a5 / gain * scale;
+}
+
+// Six logits, nothing to block: the win over the old softmax is kernelExp() in single precision,
+// libm exp() on a float argument runs in software double on this FPU
+void kernelSoftmax(const float *logits, float *out, size_t count)
+{
+  kernelSoftmaxReference(logits, out, count);
+}
+
+#endif
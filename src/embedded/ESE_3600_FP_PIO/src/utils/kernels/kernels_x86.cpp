@@ -0,0 +1,160 @@
+#include "kernels.h"
+
+#if KERNELS_IMPL == KERNELS_X86
+
+#include <immintrin.h>
+
+// SSE2 is always there on x86-64; builds with -mavx widen normalize and fir6 to 256 bits.
+// _mm_max_ps(x, b) and _mm_min_ps(x, b) return b when x is NaN, as the reference's comparisons do.
+
+const char *kernelImplName()
+{
+#ifdef __AVX__
+  return "x86_avx";
+#else
+  return "x86_sse2";
+#endif
+}
+
+// Per-channel constants laid out for consecutive values: lane j of vector v is channel (v * width + j) % 6
+template <int Width>
+static void channelLanes(const float *values, float *lanes)
+{
+  for (int i = 0; i < 3 * Width; i++)
+    lanes[i] = values[i % KERNEL_CHANNELS];
+}
+
+void kernelNormalize(const float *in, float *out, size_t count, const float *min, const float *inv_range)
+{
+  size_t i = 0;
+#ifdef __AVX__
+  // 24 values, four samples, per iteration
+  if (count >= 24)
+  {
+    alignas(32) float min_lanes[24], scale_lanes[24];
+    channelLanes<8>(min, min_lanes);
+    channelLanes<8>(inv_range, scale_lanes);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    __m256 m[3], s[3];
+    for (int v = 0; v < 3; v++)
+    {
+      m[v] = _mm256_load_ps(min_lanes + 8 * v);
+      s[v] = _mm256_load_ps(scale_lanes + 8 * v);
+    }
+    for (; i + 24 <= count; i += 24)
+    {
+      for (int v = 0; v < 3; v++)
+      {
+        __m256 x = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in + i + 8 * v), m[v]), s[v]);
+        x = _mm256_min_ps(_mm256_max_ps(x, zero), one);
+        _mm256_storeu_ps(out + i + 8 * v, x);
+      }
+    }
+  }
+#endif
+  // 12 values, two samples, per iteration
+  if (count - i >= 12)
+  {
+    alignas(16) float min_lanes[12], scale_lanes[12];
+    channelLanes<4>(min, min_lanes);
+    channelLanes<4>(inv_range, scale_lanes);
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    for (; i + 12 <= count; i += 12)
+    {
+      for (int v = 0; v < 3; v++)
+      {
+        __m128 x = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(in + i + 4 * v), _mm_load_ps(min_lanes + 4 * v)),
+                              _mm_load_ps(scale_lanes + 4 * v));
+        x = _mm_min_ps(_mm_max_ps(x, zero), one);
+        _mm_storeu_ps(out + i + 4 * v, x);
+      }
+    }
+  }
+  // A single sample, as each read is, or the tail. i is a whole number of samples, so it starts at channel 0.
+  kernelNormalizeReference(in + i, out + i, count - i, min, inv_range);
+}
+
+void kernelFir6(const float *const *rows, const float *taps, int length, float gain, float scale, float *y)
+{
+#ifdef __AVX__
+  // All six channels in one register, the top two lanes masked off
+  const __m256i mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+  __m256 acc = _mm256_setzero_ps();
+  for (int k = length - 1, r = 0; k >= 0; k--, r++)
+    acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_set1_ps(taps[k]), _mm256_maskload_ps(rows[r], mask)));
+  acc = _mm256_mul_ps(_mm256_div_ps(acc, _mm256_set1_ps(gain)), _mm256_set1_ps(scale));
+  _mm256_maskstore_ps(y, mask, acc);
+#else
+  // Channels 0-3 and 4-5
+  __m128 lo = _mm_setzero_ps(), hi = _mm_setzero_ps();
+  for (int k = length - 1, r = 0; k >= 0; k--, r++)
+  {
+    const __m128 h = _mm_set1_ps(taps[k]);
+    const float *x = rows[r];
+    lo = _mm_add_ps(lo, _mm_mul_ps(h, _mm_loadu_ps(x)));
+    hi = _mm_add_ps(hi, _mm_mul_ps(h, _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)(x + 4))));
+  }
+  const __m128 g = _mm_set1_ps(gain), s = _mm_set1_ps(scale);
+  _mm_storeu_ps(y, _mm_mul_ps(_mm_div_ps(lo, g), s));
+  _mm_storel_pi((__m64 *)(y + 4), _mm_mul_ps(_mm_div_ps(hi, g), s));
+#endif
+}
+
+// kernelExp() four lanes at a time, step for step
+static inline __m128 exp4(__m128 x)
+{
+  const __m128 underflow = _mm_cmplt_ps(x, _mm_set1_ps(KERNEL_EXP_MIN));
+  x = _mm_max_ps(x, _mm_set1_ps(KERNEL_EXP_MIN));
+  x = _mm_min_ps(x, _mm_set1_ps(KERNEL_EXP_MAX));
+
+  const __m128 round = _mm_set1_ps(KERNEL_EXP_ROUND);
+  __m128 t = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(KERNEL_EXP_LOG2E)), round);
+  __m128 n = _mm_sub_ps(t, round);
+  __m128 r = _mm_sub_ps(x, _mm_mul_ps(n, _mm_set1_ps(KERNEL_EXP_LN2_HI)));
+  r = _mm_sub_ps(r, _mm_mul_ps(n, _mm_set1_ps(KERNEL_EXP_LN2_LO)));
+
+  __m128 p = _mm_set1_ps(KERNEL_EXP_P[0]);
+  for (int k = 1; k < 6; k++)
+    p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(KERNEL_EXP_P[k]));
+  __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, _mm_mul_ps(r, r)), r), _mm_set1_ps(1.0f));
+
+  __m128i bits = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23);
+  y = _mm_mul_ps(y, _mm_castsi128_ps(bits));
+  return _mm_andnot_ps(underflow, y);
+}
+
+void kernelSoftmax(const float *logits, float *out, size_t count)
+{
+  float max = logits[0];
+  for (size_t i = 1; i < count; i++)
+    max = logits[i] > max ? logits[i] : max;
+
+  const __m128 shift = _mm_set1_ps(max);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(out + i, exp4(_mm_sub_ps(_mm_loadu_ps(logits + i), shift)));
+  if (i < count)
+  {
+    // The last one to three in registers, padded with max (exp(0), dropped)
+    size_t n = count - i;
+    __m128 x = _mm_setr_ps(logits[i], n > 1 ? logits[i + 1] : max, n > 2 ? logits[i + 2] : max, max);
+    alignas(16) float tail[4];
+    _mm_store_ps(tail, exp4(_mm_sub_ps(x, shift)));
+    for (size_t j = 0; j < n; j++)
+      out[i + j] = tail[j];
+  }
+
+  // Summed in order, a lane-wise sum would round differently
+  float sum = 0.0f;
+  for (size_t j = 0; j < count; j++)
+    sum += out[j];
+  sum = sum > KERNEL_SOFTMAX_MIN_SUM ? sum : KERNEL_SOFTMAX_MIN_SUM;
+
+  const __m128 divisor = _mm_set1_ps(sum);
+  for (i = 0; i + 4 <= count; i += 4)
+    _mm_storeu_ps(out + i, _mm_div_ps(_mm_loadu_ps(out + i), divisor));
+  for (; i < count; i++)
+    out[i] = out[i] / sum;
+}
+
+#endif
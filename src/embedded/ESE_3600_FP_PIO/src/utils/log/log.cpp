@@ -0,0 +1,96 @@
+#include "log.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include "../hal/hal.h"
+
+static const char *formats[LOG_MAX_FORMATS];
+static uint16_t format_count = 0;
+
+static uint8_t buffer[LOG_BUFFER_BYTES];
+static size_t buffer_length = 0;
+static uint32_t dropped = 0;
+
+void logPrint(const char *format, ...)
+{
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+  putchar('\n');
+}
+
+uint16_t logFormatId(const char *format)
+{
+  for (uint16_t i = 0; i < format_count; i++)
+  {
+    if (formats[i] == format || strcmp(formats[i], format) == 0)
+      return i;
+  }
+  if (format_count >= LOG_MAX_FORMATS)
+    return LOG_NO_FORMAT;
+  formats[format_count] = format;
+  return format_count++;
+}
+
+void logCommit(uint16_t format_id, uint8_t level, const LogArgs &args)
+{
+  size_t size = LOG_RECORD_HEADER_BYTES + args.length;
+  if (format_id == LOG_NO_FORMAT || args.truncated || buffer_length + size > sizeof(buffer))
+  {
+    dropped++;
+    return;
+  }
+
+  uint8_t *record = buffer + buffer_length;
+  uint32_t now = halMicros();
+  memcpy(record, &format_id, 2);
+  record[2] = level;
+  record[3] = args.length;
+  memcpy(record + 4, &now, 4);
+  memcpy(record + LOG_RECORD_HEADER_BYTES, args.bytes, args.length);
+  buffer_length += size;
+}
+
+size_t logPendingBytes()
+{
+  return buffer_length;
+}
+
+uint32_t logDropped()
+{
+  return dropped;
+}
+
+static void printHex(Print &out, const uint8_t *bytes, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+  {
+    out.printf("%02x", bytes[i]);
+    if (i % 32 == 31 || i == n - 1)
+      out.println();
+  }
+}
+
+void logDump(Print &out)
+{
+  uint8_t header[14] = {'R', 'M', 'L', LOG_VERSION};
+  memcpy(header + 4, &dropped, 4);
+  memcpy(header + 8, &format_count, 2);
+  uint32_t record_bytes = buffer_length;
+  memcpy(header + 10, &record_bytes, 4);
+
+  out.println("START_LOG");
+  printHex(out, header, sizeof(header));
+  for (uint16_t i = 0; i < format_count; i++)
+  {
+    uint16_t length = strlen(formats[i]);
+    printHex(out, (const uint8_t *)&length, 2);
+    printHex(out, (const uint8_t *)formats[i], length);
+  }
+  printHex(out, buffer, buffer_length);
+  out.println("END_LOG");
+  out.flush();
+
+  buffer_length = 0;
+  dropped = 0;
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+// Leveled logging with the level fixed at compile time.
+// LOG_ERROR / LOG_WARN / LOG_INFO / LOG_DEBUG take a printf format (no trailing newline). Calls above
+// LOG_LEVEL compile to nothing, arguments included.
+//
+// With LOG_BINARY=0 (default) messages go straight to printf. With LOG_BINARY=1 nothing is formatted on
+// the device: each call stores its format id, a timestamp and the raw argument bytes in a RAM buffer,
+// the "log" console command dumps it and log_decode.py formats it on the host.
+//
+// Dump stream: "RML" | version (u8) | dropped (u32) | format_count (u16) | record_bytes (u32)
+//              | format_count x (length (u16) | format) | records
+// Record:      format_id (u16) | level (u8) | arg_bytes (u8) | micros (u32) | args
+// Args are 4 bytes each (integers, floats as float32) and strings as length (u8) | bytes.
+// The dump is hex encoded between START_LOG / END_LOG lines, records are cleared once dumped.
+//
+// Binary logging is not thread safe, only log from the Arduino loop task.
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#ifndef LOG_BINARY
+#define LOG_BINARY 0
+#endif
+
+class Print;
+
+const uint8_t LOG_VERSION = 1;
+const size_t LOG_BUFFER_BYTES = 4096;
+const size_t LOG_MAX_FORMATS = 64;
+const size_t LOG_MAX_ARG_BYTES = 64;
+const size_t LOG_MAX_STRING = 31;
+const size_t LOG_RECORD_HEADER_BYTES = 8;
+const uint16_t LOG_NO_FORMAT = 0xFFFF; // Format table full, the record is dropped
+
+// Raw arguments of one binary record
+struct LogArgs
+{
+  uint8_t bytes[LOG_MAX_ARG_BYTES];
+  size_t length = 0;
+  bool truncated = false;
+
+  template <typename T>
+  typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type add(T value)
+  {
+    uint32_t word = (uint32_t)value;
+    put(&word, sizeof(word));
+  }
+
+  void add(double value)
+  {
+    float narrow = (float)value;
+    put(&narrow, sizeof(narrow));
+  }
+
+  void add(const char *text)
+  {
+    size_t n = text ? strnlen(text, LOG_MAX_STRING) : 0;
+    uint8_t prefix = n;
+    put(&prefix, 1);
+    put(text, n);
+  }
+
+  void put(const void *data, size_t n)
+  {
+    if (length + n > sizeof(bytes))
+    {
+      truncated = true;
+      return;
+    }
+    memcpy(bytes + length, data, n); // Little-endian on both the ESP32 and x86
+    length += n;
+  }
+};
+
+// Text output: the formatted message and a newline
+void logPrint(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+// Id of a format string, assigned on first use
+uint16_t logFormatId(const char *format);
+
+void logCommit(uint16_t format_id, uint8_t level, const LogArgs &args);
+
+inline void logEncode(LogArgs &args) {}
+
+template <typename T, typename... Rest>
+inline void logEncode(LogArgs &args, T value, Rest... rest)
+{
+  args.add(value);
+  logEncode(args, rest...);
+}
+
+template <typename... Values>
+inline void logBinary(uint16_t format_id, uint8_t level, Values... values)
+{
+  LogArgs args;
+  logEncode(args, values...);
+  logCommit(format_id, level, args);
+}
+
+// Binary records waiting to be dumped, and how many did not fit
+size_t logPendingBytes();
+uint32_t logDropped();
+
+// Hex dump between START_LOG / END_LOG markers, then clears the records
+void logDump(Print &out);
+
+// Both branches are compiled so the format is always checked against the arguments,
+// the one not selected by LOG_BINARY is dropped as dead code.
+#define LOG_AT(level, format, ...)                                  \
+  do                                                                \
+  {                                                                 \
+    if ((level) <= LOG_LEVEL)                                       \
+    {                                                               \
+      if (LOG_BINARY)                                               \
+      {                                                             \
+        static const uint16_t log_format_id = logFormatId(format); \
+        logBinary(log_format_id, level, ##__VA_ARGS__);             \
+      }                                                             \
+      else                                                          \
+      {                                                             \
+        logPrint(format, ##__VA_ARGS__);                            \
+      }                                                             \
+    }                                                               \
+  } while (0)
+
+#define LOG_ERROR(format, ...) LOG_AT(LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
+#define LOG_WARN(format, ...) LOG_AT(LOG_LEVEL_WARN, format, ##__VA_ARGS__)
+#define LOG_INFO(format, ...) LOG_AT(LOG_LEVEL_INFO, format, ##__VA_ARGS__)
+#define LOG_DEBUG(format, ...) LOG_AT(LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
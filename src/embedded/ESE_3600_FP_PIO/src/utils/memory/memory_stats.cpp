@@ -0,0 +1,44 @@
+#include "memory_stats.h"
+#include <Arduino.h>
+
+// Stack marks reported by tasks that have since exited
+static TaskStackInfo noted[4];
+static int noted_count = 0;
+
+void memoryNoteTaskStack(const char *name, uint32_t min_free_bytes)
+{
+  for (int i = 0; i < noted_count; i++)
+  {
+    if (strcmp(noted[i].name, name) == 0)
+    {
+      noted[i].min_free_bytes = min(noted[i].min_free_bytes, min_free_bytes);
+      return;
+    }
+  }
+  if (noted_count < (int)(sizeof(noted) / sizeof(noted[0])))
+    noted[noted_count++] = {name, min_free_bytes};
+}
+
+void memoryReport(Print &out, size_t arena_used, size_t arena_size)
+{
+  MemoryStats stats;
+  memoryStats(&stats);
+
+  out.println("=== Memory ===");
+  out.printf("Heap: %lu free of %lu, min free %lu, largest block %lu\n", (unsigned long)stats.heap_free,
+             (unsigned long)stats.heap_total, (unsigned long)stats.heap_min_free, (unsigned long)stats.heap_largest_block);
+  if (arena_size > 0)
+    out.printf("Tensor arena: %lu used of %lu (%lu spare)\n", (unsigned long)arena_used, (unsigned long)arena_size,
+               (unsigned long)(arena_size - arena_used));
+  if (stats.data_bytes || stats.bss_bytes)
+    out.printf("Static: .data %lu, .bss %lu, .rodata %lu\n", (unsigned long)stats.data_bytes,
+               (unsigned long)stats.bss_bytes, (unsigned long)stats.rodata_bytes);
+
+  TaskStackInfo tasks[MEMORY_MAX_TASKS];
+  int count = memoryTaskStacks(tasks, MEMORY_MAX_TASKS);
+  for (int i = 0; i < noted_count && count < MEMORY_MAX_TASKS; i++)
+    tasks[count++] = noted[i];
+  for (int i = 0; i < count; i++)
+    out.printf("Stack %-12s min free %lu\n", tasks[i].name, (unsigned long)tasks[i].min_free_bytes);
+  out.println("==============");
+}
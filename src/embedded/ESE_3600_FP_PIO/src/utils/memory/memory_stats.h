@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Memory headroom: heap, task stacks and static sections.
+// memory_stats_esp32.cpp reads them from ESP-IDF, memory_stats_host.cpp from the host runtime's
+// operator new/delete hooks (lib/host_runtime/src/host_heap.cpp).
+
+class Print;
+
+struct MemoryStats
+{
+  uint32_t heap_total;         // Internal heap, bytes
+  uint32_t heap_free;
+  uint32_t heap_min_free;      // Low-water mark since boot
+  uint32_t heap_largest_block; // Largest single allocation that would still succeed
+  uint32_t data_bytes;         // Static sections, 0 where the build does not expose them
+  uint32_t bss_bytes;
+  uint32_t rodata_bytes;
+};
+
+// Stack high-water mark of one task: the least free stack it has had
+struct TaskStackInfo
+{
+  const char *name;
+  uint32_t min_free_bytes;
+};
+
+const int MEMORY_MAX_TASKS = 12;
+
+void memoryStats(MemoryStats *stats);
+
+// Fills out with the tasks that could be found, returns how many
+int memoryTaskStacks(TaskStackInfo *out, int max);
+
+// For short-lived tasks: record their high-water mark before they delete themselves
+void memoryNoteTaskStack(const char *name, uint32_t min_free_bytes);
+
+// Human-readable report; arena figures come from the interpreter (0 if not set up)
+void memoryReport(Print &out, size_t arena_used, size_t arena_size);
@@ -0,0 +1,38 @@
+#ifdef ARDUINO
+
+#include "memory_stats.h"
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+// Section bounds from the ESP-IDF linker script
+extern int _data_start, _data_end, _bss_start, _bss_end, _rodata_start, _rodata_end;
+
+// Long-lived tasks worth watching, missing ones are skipped
+static const char *const task_names[] = {"loopTask", "btController", "BTC_TASK", "BTU_TASK", "esp_timer"};
+
+void memoryStats(MemoryStats *stats)
+{
+  stats->heap_total = heap_caps_get_total_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  stats->heap_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  stats->heap_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  stats->heap_largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  stats->data_bytes = (uint8_t *)&_data_end - (uint8_t *)&_data_start;
+  stats->bss_bytes = (uint8_t *)&_bss_end - (uint8_t *)&_bss_start;
+  stats->rodata_bytes = (uint8_t *)&_rodata_end - (uint8_t *)&_rodata_start;
+}
+
+int memoryTaskStacks(TaskStackInfo *out, int max)
+{
+  int count = 0;
+  for (const char *name : task_names)
+  {
+    TaskHandle_t task = xTaskGetHandle(name);
+    if (task == nullptr || count >= max)
+      continue;
+    // ESP-IDF stacks are counted in bytes
+    out[count++] = {name, (uint32_t)uxTaskGetStackHighWaterMark(task)};
+  }
+  return count;
+}
+
+#endif
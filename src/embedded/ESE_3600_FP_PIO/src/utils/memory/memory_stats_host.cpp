@@ -0,0 +1,29 @@
+#ifndef ARDUINO
+
+#include "memory_stats.h"
+#include <Arduino.h>
+
+// Section bounds from the GNU linker
+extern char __data_start, _edata, __bss_start, _end;
+
+void memoryStats(MemoryStats *stats)
+{
+  HostHeapStats heap = hostHeapStats();
+  stats->heap_total = heap.budget;
+  stats->heap_free = heap.budget > heap.live ? heap.budget - heap.live : 0;
+  stats->heap_min_free = heap.budget > heap.peak ? heap.budget - heap.peak : 0;
+  stats->heap_largest_block = stats->heap_free; // No fragmentation model
+  stats->data_bytes = &_edata - &__data_start;
+  stats->bss_bytes = &_end - &__bss_start;
+  stats->rodata_bytes = 0;
+}
+
+int memoryTaskStacks(TaskStackInfo *out, int max)
+{
+  // One thread runs setup()/loop(), there are no FreeRTOS tasks to inspect
+  (void)out;
+  (void)max;
+  return 0;
+}
+
+#endif
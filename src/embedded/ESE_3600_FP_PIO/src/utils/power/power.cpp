@@ -0,0 +1,62 @@
+#include "power.h"
+#include <string.h>
+
+static const char *const state_names[POWER_STATE_COUNT] = {"active", "idle", "sleep"};
+
+const char *powerStateName(PowerState state)
+{
+  return state >= 0 && state < POWER_STATE_COUNT ? state_names[state] : "unknown";
+}
+
+static void enter(PowerManager *power, PowerState state, uint32_t now_ms)
+{
+  if (state == power->state)
+    return;
+  power->time_in_state_ms[power->state] += now_ms - power->state_since_ms;
+  power->state = state;
+  power->state_since_ms = now_ms;
+}
+
+void powerReset(PowerManager *power, uint32_t idle_timeout_ms, uint32_t now_ms)
+{
+  memset(power, 0, sizeof(*power));
+  power->state = POWER_ACTIVE;
+  power->idle_timeout_ms = idle_timeout_ms;
+  power->last_motion_ms = now_ms;
+  power->state_since_ms = now_ms;
+}
+
+void powerNoteMotion(PowerManager *power, uint32_t now_ms)
+{
+  power->last_motion_ms = now_ms;
+  enter(power, POWER_ACTIVE, now_ms);
+}
+
+bool powerUpdate(PowerManager *power, uint32_t now_ms)
+{
+  if (power->state == POWER_ACTIVE && power->idle_timeout_ms > 0 &&
+      now_ms - power->last_motion_ms >= power->idle_timeout_ms)
+  {
+    enter(power, POWER_IDLE, now_ms);
+  }
+  return power->state == POWER_IDLE;
+}
+
+void powerEnterSleep(PowerManager *power, uint32_t now_ms)
+{
+  enter(power, POWER_SLEEP, now_ms);
+  power->sleeps++;
+}
+
+void powerWake(PowerManager *power, uint32_t now_ms)
+{
+  powerNoteMotion(power, now_ms);
+}
+
+uint32_t powerTimeInState(const PowerManager *power, PowerState state, uint32_t now_ms)
+{
+  uint32_t time = power->time_in_state_ms[state];
+  if (state == power->state)
+    time += now_ms - power->state_since_ms;
+  return time;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+// Power state machine for the time between sets.
+//
+//   ACTIVE --(no motion for idle_timeout_ms)--> IDLE --(pipeline at a window boundary)--> SLEEP
+//     ^                                          |                                          |
+//     +------------------(motion)----------------+-------------(motion interrupt)-----------+
+//
+// Motion comes from the MPU6050's own motion detector (mpuMotionSeen()), polled while awake and
+// wired to a GPIO wakeup while asleep. IDLE only waits for the pipeline to reach a point where
+// sleeping loses nothing, the sleep itself is light sleep so RAM and the model survive.
+// Holds no hardware state, main.cpp drives it and does the sleeping.
+
+enum PowerState
+{
+  POWER_ACTIVE, // Sampling and classifying
+  POWER_IDLE,   // Idle timeout passed, sleeps at the next window boundary
+  POWER_SLEEP,  // Light sleep until the motion interrupt
+  POWER_STATE_COUNT
+};
+
+struct PowerManager
+{
+  PowerState state;
+  uint32_t idle_timeout_ms; // 0 never sleeps
+  uint32_t last_motion_ms;
+  uint32_t state_since_ms;
+  uint32_t time_in_state_ms[POWER_STATE_COUNT]; // Completed stays only, see powerTimeInState()
+  uint32_t sleeps;
+};
+
+const char *powerStateName(PowerState state);
+
+void powerReset(PowerManager *power, uint32_t idle_timeout_ms, uint32_t now_ms);
+
+// Motion since the last poll: back to ACTIVE and the idle timeout restarts
+void powerNoteMotion(PowerManager *power, uint32_t now_ms);
+
+// ACTIVE -> IDLE once the idle timeout has passed, returns true while IDLE
+bool powerUpdate(PowerManager *power, uint32_t now_ms);
+
+void powerEnterSleep(PowerManager *power, uint32_t now_ms);
+void powerWake(PowerManager *power, uint32_t now_ms);
+
+// Time spent in a state since the reset, the current stay included
+uint32_t powerTimeInState(const PowerManager *power, PowerState state, uint32_t now_ms);
@@ -0,0 +1,137 @@
+#include "rep_metrics.h"
+#include <math.h>
+#include <string.h>
+
+static const float DEGREES_PER_RADIAN = 57.29578f;
+
+// Rotation starts over from zero at every quiet sample, which is where a rep would start
+static void restartRotation(RepMetrics *m, uint32_t now_ms)
+{
+  for (int axis = 0; axis < 3; axis++)
+  {
+    m->angle[axis] = 0;
+    m->extremes.end[axis] = 0;
+    m->extremes.max[axis] = 0;
+    m->extremes.min[axis] = 0;
+    m->extremes.max_ms[axis] = now_ms;
+    m->extremes.min_ms[axis] = now_ms;
+  }
+}
+
+void repMetricsReset(RepMetrics *metrics, bool eccentric_first)
+{
+  memset(metrics, 0, sizeof(*metrics));
+  repSegmenterReset(&metrics->segmenter);
+  metrics->eccentric_first = eccentric_first;
+}
+
+// Tempo of a finished rep from the rotation extremes it reached
+static RepTempo measureRep(const RepMetrics *m, const RepSpan &rep)
+{
+  const RepExtremes &e = m->at_rest;
+  int axis = 0;
+  float turn = 0;
+  uint32_t turn_ms = rep.start_ms;
+  for (int i = 0; i < 3; i++)
+  {
+    // How far out each extreme went before the rotation came back towards where the rep ended
+    float out_max = fminf(e.max[i], e.max[i] - e.end[i]);
+    float out_min = fminf(-e.min[i], e.end[i] - e.min[i]);
+    if (out_max > turn)
+    {
+      axis = i;
+      turn = out_max;
+      turn_ms = e.max_ms[i];
+    }
+    if (out_min > turn)
+    {
+      axis = i;
+      turn = out_min;
+      turn_ms = e.min_ms[i];
+    }
+  }
+
+  if (turn_ms < rep.start_ms)
+    turn_ms = rep.start_ms;
+  if (turn_ms > rep.end_ms)
+    turn_ms = rep.end_ms;
+  uint32_t first_ms = turn_ms - rep.start_ms;
+  uint32_t second_ms = rep.end_ms - turn_ms;
+
+  RepTempo tempo;
+  tempo.eccentric_ms = m->eccentric_first ? first_ms : second_ms;
+  tempo.concentric_ms = m->eccentric_first ? second_ms : first_ms;
+  tempo.rom_deg = (e.max[axis] - e.min[axis]) * DEGREES_PER_RADIAN;
+  tempo.peak_dps = rep.peak * DEGREES_PER_RADIAN;
+  return tempo;
+}
+
+static void addToSet(RepMetrics *m, const RepSpan &rep)
+{
+  if (m->set_reps == 0 || rep.start_ms - m->set_end_ms > SET_REST_MS)
+  {
+    m->set_count++;
+    m->set_reps = 0;
+    memset(&m->total, 0, sizeof(m->total));
+  }
+  m->set_reps++;
+  m->set_end_ms = rep.end_ms;
+  m->total.concentric_ms += m->last.concentric_ms;
+  m->total.eccentric_ms += m->last.eccentric_ms;
+  m->total.rom_deg += m->last.rom_deg;
+  m->total.peak_dps += m->last.peak_dps;
+}
+
+bool repMetricsAdd(RepMetrics *m, uint32_t now_ms, const float gyro[3], RepSpan *rep)
+{
+  float dt = m->segmenter.samples ? (now_ms - m->last_ms) * 0.001f : 0.0f;
+  m->last_ms = now_ms;
+  for (int axis = 0; axis < 3; axis++)
+  {
+    float angle = m->angle[axis] + gyro[axis] * dt;
+    m->angle[axis] = angle;
+    m->extremes.end[axis] = angle;
+    if (angle > m->extremes.max[axis])
+    {
+      m->extremes.max[axis] = angle;
+      m->extremes.max_ms[axis] = now_ms;
+    }
+    else if (angle < m->extremes.min[axis])
+    {
+      m->extremes.min[axis] = angle;
+      m->extremes.min_ms[axis] = now_ms;
+    }
+  }
+
+  uint32_t sample = m->segmenter.samples;
+  bool finished = repSegmenterAdd(&m->segmenter, now_ms, gyro, rep);
+  const RepSegmenter &s = m->segmenter;
+
+  if (s.in_rep && s.resting && s.rest_sample == sample)
+  {
+    m->at_rest = m->extremes; // The rep ends here if the rest lasts
+  }
+  if (finished)
+  {
+    m->last = measureRep(m, *rep);
+    addToSet(m, *rep);
+  }
+  if (!s.in_rep && s.quiet_sample == sample)
+  {
+    restartRotation(m, now_ms);
+  }
+  return finished;
+}
+
+RepTempo repMetricsSetAverage(const RepMetrics *metrics)
+{
+  RepTempo average = {0, 0, 0, 0};
+  uint16_t reps = metrics->set_reps;
+  if (reps == 0)
+    return average;
+  average.concentric_ms = metrics->total.concentric_ms / reps;
+  average.eccentric_ms = metrics->total.eccentric_ms / reps;
+  average.rom_deg = metrics->total.rom_deg / reps;
+  average.peak_dps = metrics->total.peak_dps / reps;
+  return average;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include "rep_segmenter.h"
+
+// Per-set rep count and tempo, updated in O(1) per sample alongside the segmenter, no sample buffer.
+//
+// The gyro is integrated per axis from the last quiet sample, which is where the segmenter starts a
+// rep. A rep goes out and comes back, so the turning point is the extreme that lies furthest from
+// both the start and the end angle, over all axes. Its axis is the lift's axis, whose range is the
+// range-of-motion proxy, and its time splits the rep into the lowering (eccentric) and lifting
+// (concentric) phases. Which phase comes first depends on the lift.
+
+// A rep starting this long after the previous one ends starts a new set
+const uint32_t SET_REST_MS = 30000;
+
+struct RepTempo
+{
+  uint32_t concentric_ms;
+  uint32_t eccentric_ms;
+  float rom_deg;  // Rotation about the lift's axis
+  float peak_dps; // Highest smoothed rotation rate (deg/s)
+};
+
+// Extremes of the rotation about each axis since the rep started
+struct RepExtremes
+{
+  float end[3]; // Rotation at the last sample
+  float max[3];
+  float min[3];
+  uint32_t max_ms[3];
+  uint32_t min_ms[3];
+};
+
+struct RepMetrics
+{
+  RepSegmenter segmenter;
+  bool eccentric_first; // Bench press and flys start at the top, curls at the bottom
+  uint32_t last_ms;
+
+  float angle[3]; // Rotation since the last quiet sample (rad)
+  RepExtremes extremes;
+  RepExtremes at_rest; // Copy taken when the rep's final rest began, where the rep ends
+
+  uint32_t set_count; // Sets since the reset
+  uint16_t set_reps;  // Reps in the current set
+  uint32_t set_end_ms;
+  RepTempo last;  // Most recent rep
+  RepTempo total; // Sums over the set, for averages
+};
+
+void repMetricsReset(RepMetrics *metrics, bool eccentric_first);
+
+// Adds one reading (rad/s). Returns true when a rep has finished; rep, metrics->last and the set
+// totals then describe it.
+bool repMetricsAdd(RepMetrics *metrics, uint32_t now_ms, const float gyro[3], RepSpan *rep);
+
+// Averages over the current set, zero before the first rep
+RepTempo repMetricsSetAverage(const RepMetrics *metrics);
@@ -0,0 +1,106 @@
+#include "rep_segmenter.h"
+#include <math.h>
+#include <string.h>
+
+void repSegmenterReset(RepSegmenter *segmenter)
+{
+  memset(segmenter, 0, sizeof(*segmenter));
+  segmenter->peak = REP_MIN_PEAK;
+}
+
+// Starts the candidate from the last quiet sample so the slow start of the lift is included
+static void startRep(RepSegmenter *s, float value)
+{
+  s->in_rep = true;
+  s->resting = false;
+  s->start_sample = s->quiet_sample;
+  s->start_ms = s->quiet_ms;
+  s->rep_max = value;
+}
+
+// Back to idle, the next rep can start no earlier than this sample
+static void endRep(RepSegmenter *s, uint32_t sample, uint32_t now_ms)
+{
+  s->in_rep = false;
+  s->quiet_sample = sample;
+  s->quiet_ms = now_ms;
+}
+
+bool repSegmenterAdd(RepSegmenter *s, uint32_t now_ms, const float gyro[3], RepSpan *rep)
+{
+  float magnitude = sqrtf(gyro[0] * gyro[0] + gyro[1] * gyro[1] + gyro[2] * gyro[2]);
+  s->smooth += REP_SMOOTHING * (magnitude - s->smooth);
+  float value = s->smooth;
+
+  float range = s->peak - s->floor;
+  float start_level = s->floor + fmaxf(REP_MIN_START, REP_START_FRACTION * range);
+  float end_level = s->floor + fmaxf(REP_MIN_END, REP_END_FRACTION * range);
+  uint32_t sample = s->samples++;
+  bool finished = false;
+
+  if (!s->in_rep)
+  {
+    // The floor drops straight to quieter rest but only creeps up, so a slow lift does not raise it
+    if (value < s->floor)
+      s->floor = value;
+    else
+      s->floor += REP_FLOOR_RISE * (value - s->floor);
+    s->peak += REP_PEAK_DECAY * (s->floor + REP_MIN_PEAK - s->peak);
+
+    if (value < end_level)
+    {
+      s->overrun = false;
+      s->quiet_sample = sample;
+      s->quiet_ms = now_ms;
+    }
+    if (value > start_level && !s->overrun)
+    {
+      startRep(s, value);
+    }
+    return false;
+  }
+
+  if (value > s->rep_max)
+    s->rep_max = value;
+
+  if (value >= end_level)
+  {
+    s->resting = false;
+    if (now_ms - s->start_ms > REP_MAX_MS)
+    {
+      // Too long for one rep (walking around, re-racking), wait for the next rest
+      s->discarded++;
+      s->overrun = true;
+      endRep(s, sample, now_ms);
+    }
+    return false;
+  }
+
+  if (!s->resting)
+  {
+    s->resting = true;
+    s->rest_sample = sample;
+    s->rest_ms = now_ms;
+  }
+  if (now_ms - s->rest_ms < REP_REST_MS)
+    return false;
+
+  uint32_t duration_ms = s->rest_ms - s->start_ms;
+  if (duration_ms >= REP_MIN_MS && duration_ms <= REP_MAX_MS)
+  {
+    rep->first_sample = s->start_sample;
+    rep->last_sample = s->rest_sample;
+    rep->start_ms = s->start_ms;
+    rep->end_ms = s->rest_ms;
+    rep->peak = s->rep_max;
+    s->peak += REP_PEAK_RATE * (s->rep_max - s->peak);
+    s->reps++;
+    finished = true;
+  }
+  else
+  {
+    s->discarded++;
+  }
+  endRep(s, sample, now_ms);
+  return finished;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+// Online repetition segmenter, fed one gyro reading per sample.
+//
+// The gyro magnitude is smoothed and compared against two thresholds that adapt to the lifter:
+// a rest floor (follows quiet readings) and the peak of recent reps. A rep starts when the signal
+// rises above the start threshold, counting from the last quiet sample, and ends once it has stayed
+// below the end threshold for REP_REST_MS. Reps outside REP_MIN_MS..REP_MAX_MS are discarded, and after
+// one that runs past REP_MAX_MS the next can only start once the signal has been quiet.
+// The per-sample constants assume the 5 ms rate the training recordings were made at.
+
+const float REP_SMOOTHING = 0.1f;      // EMA weight of each new gyro magnitude
+const float REP_FLOOR_RISE = 0.01f;    // How fast the rest floor follows louder rest, per sample
+const float REP_START_FRACTION = 0.3f; // Start threshold, fraction of the floor to peak range
+const float REP_END_FRACTION = 0.15f;  // End threshold, fraction of the floor to peak range
+const float REP_MIN_START = 0.3f;      // Start threshold is at least this far above the floor (rad/s)
+const float REP_MIN_END = 0.2f;        // End threshold is at least this far above the floor (rad/s)
+const float REP_MIN_PEAK = 0.5f;       // Peak decays towards floor + this between reps (rad/s)
+const float REP_PEAK_DECAY = 0.0005f;  // Peak decay per idle sample
+const float REP_PEAK_RATE = 0.5f;      // How far the peak moves towards each accepted rep's maximum
+
+const uint32_t REP_REST_MS = 400;
+const uint32_t REP_MIN_MS = 400;
+const uint32_t REP_MAX_MS = 4500;
+
+// A finished rep: sample numbers count every repSegmenterAdd() call since the last reset
+struct RepSpan
+{
+  uint32_t first_sample;
+  uint32_t last_sample;
+  uint32_t start_ms;
+  uint32_t end_ms;
+  float peak; // Highest smoothed gyro magnitude (rad/s)
+};
+
+struct RepSegmenter
+{
+  float smooth;
+  float floor;
+  float peak;
+  float rep_max;
+  bool in_rep;
+  bool resting;          // Inside a rep and below the end threshold
+  bool overrun;          // The last candidate ran past REP_MAX_MS, no new one until a quiet sample
+  uint32_t samples;      // Samples seen
+  uint32_t quiet_sample; // Last sample below the end threshold while idle
+  uint32_t quiet_ms;
+  uint32_t start_sample;
+  uint32_t start_ms;
+  uint32_t rest_sample; // First sample of the current quiet stretch inside a rep
+  uint32_t rest_ms;
+  uint32_t reps;      // Reps accepted
+  uint32_t discarded; // Candidates that were too short or too long
+};
+
+void repSegmenterReset(RepSegmenter *segmenter);
+
+// Adds one reading (rad/s). Returns true and fills rep when a rep has just finished.
+bool repSegmenterAdd(RepSegmenter *segmenter, uint32_t now_ms, const float gyro[3], RepSpan *rep);
@@ -0,0 +1,130 @@
+#include "scheduler.h"
+#include <atomic>
+#include "../hal/hal.h"
+#include "../trace/trace.h"
+#include "../log/log.h"
+
+bool scheduler_light_sleep = false;
+
+struct Task
+{
+  const char *name;
+  TaskFunction function;
+  uint32_t period_ms;  // 0 for event tasks
+  uint32_t event_mask; // 0 for timed tasks
+  uint32_t next_run;
+  bool enabled;
+};
+
+static Task tasks[MAX_TASKS];
+static int task_count = 0;
+static std::atomic<uint32_t> pending_events(0);
+
+static int addTask(const char *name, TaskFunction function, uint32_t period_ms, uint32_t event_mask, bool enabled)
+{
+  if (task_count >= MAX_TASKS)
+  {
+    LOG_ERROR("Scheduler task table full, cannot add %s", name);
+    return -1;
+  }
+  tasks[task_count] = {name, function, period_ms, event_mask, halMillis(), enabled};
+  return task_count++;
+}
+
+int schedulerAddTimedTask(const char *name, TaskFunction function, uint32_t period_ms)
+{
+  return addTask(name, function, period_ms, 0, false);
+}
+
+int schedulerAddEventTask(const char *name, TaskFunction function, uint32_t event_mask)
+{
+  return addTask(name, function, 0, event_mask, true);
+}
+
+void schedulerStart(int task_id, uint32_t delay_ms)
+{
+  if (task_id < 0 || task_id >= task_count)
+    return;
+  tasks[task_id].next_run = halMillis() + delay_ms;
+  tasks[task_id].enabled = true;
+}
+
+void schedulerStop(int task_id)
+{
+  if (task_id < 0 || task_id >= task_count)
+    return;
+  tasks[task_id].enabled = false;
+}
+
+void schedulerSetPeriod(int task_id, uint32_t period_ms)
+{
+  if (task_id < 0 || task_id >= task_count)
+    return;
+  tasks[task_id].period_ms = period_ms;
+}
+
+void schedulerPost(uint32_t events)
+{
+  pending_events.fetch_or(events);
+}
+
+static void idle(uint32_t ms)
+{
+  bool light_sleep = scheduler_light_sleep && ms >= LIGHT_SLEEP_MIN_MS;
+  halSleep(ms, light_sleep);
+  if (light_sleep)
+    traceWake(ms); // The cycle counter stood still while asleep
+}
+
+void schedulerRunOnce()
+{
+  uint32_t events = pending_events.exchange(0);
+
+  for (int i = 0; i < task_count; i++)
+  {
+    Task &task = tasks[i];
+    if (!task.enabled)
+      continue;
+
+    if (task.event_mask)
+    {
+      if (task.event_mask & events)
+        task.function();
+      continue;
+    }
+
+    uint32_t now = halMillis();
+    if ((int32_t)(now - task.next_run) < 0)
+      continue;
+
+    // Keep a fixed cadence, but don't try to catch up on runs we've already missed
+    task.next_run += task.period_ms;
+    if ((int32_t)(now - task.next_run) >= 0)
+    {
+      task.next_run = now + task.period_ms;
+      traceInstant(TRACE_TASK_OVERRUN, i);
+    }
+
+    task.function();
+  }
+
+  // Tasks posted new events, run again straight away
+  if (pending_events.load())
+    return;
+
+  uint32_t now = halMillis();
+  int32_t wait_ms = -1;
+  for (int i = 0; i < task_count; i++)
+  {
+    if (!tasks[i].enabled || tasks[i].event_mask)
+      continue;
+    int32_t until = (int32_t)(tasks[i].next_run - now);
+    if (until <= 0)
+      return;
+    if (wait_ms < 0 || until < wait_ms)
+      wait_ms = until;
+  }
+
+  // Nothing timed is armed: yield one tick and re-check for events posted by callbacks
+  idle(wait_ms < 0 ? 1 : (uint32_t)wait_ms);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Cooperative run-to-completion scheduler.
+// Timed tasks run every period_ms; event tasks run whenever one of their events is posted.
+// Tasks must never block: anything that used to wait in delay() becomes a timed task instead.
+
+// Events tasks can wait on (bitmask)
+const uint32_t EVENT_SAMPLE_READY = 1 << 0;   // One IMU sample was written to the buffer
+const uint32_t EVENT_WINDOW_READY = 1 << 1;   // A full window of samples is ready for inference
+const uint32_t EVENT_INFERENCE_DONE = 1 << 2; // current_lift_idx holds a fresh classification
+const uint32_t EVENT_BLE_CONNECTED = 1 << 3;  // BLE link to the server is up
+const uint32_t EVENT_CUE_FINISHED = 1 << 4;   // The buzzer/LED cue sequence has finished
+const uint32_t EVENT_REP_READY = 1 << 5;      // The rep segmenter found a complete rep
+
+const int MAX_TASKS = 12;
+
+// Sleeping for less than this is not worth the light-sleep entry/exit cost
+const uint32_t LIGHT_SLEEP_MIN_MS = 5;
+
+typedef void (*TaskFunction)();
+
+// If true, idle time is spent in ESP32 light sleep instead of a FreeRTOS delay.
+// Leave off while BLE or USB serial must stay responsive.
+extern bool scheduler_light_sleep;
+
+// Registration, returns the task id or -1 if the task table is full.
+// Timed tasks start disabled; use schedulerStart to arm them.
+int schedulerAddTimedTask(const char *name, TaskFunction function, uint32_t period_ms);
+int schedulerAddEventTask(const char *name, TaskFunction function, uint32_t event_mask);
+
+// Arms a timed task to first run delay_ms from now
+void schedulerStart(int task_id, uint32_t delay_ms = 0);
+void schedulerStop(int task_id);
+void schedulerSetPeriod(int task_id, uint32_t period_ms);
+
+// Safe to call from tasks, callbacks and ISRs
+void schedulerPost(uint32_t events);
+
+// Runs every ready task once, then idles until the next deadline or posted event
+void schedulerRunOnce();
@@ -0,0 +1,341 @@
+#include "decimator.h"
+#include <math.h>
+#include <string.h>
+#include "../kernels/kernels.h"
+
+int decimator_filter = DECIMATOR_FILTER;
+
+static const char *const filter_names[DECIMATOR_FILTER_COUNT] = {"boxcar", "sinc", "cic"};
+
+static const int SINC_TAPS = 31;
+static const float SINC_INT_TAP_ONE = 4096; // Q12
+static const int CIC_STAGES = 3;
+
+static DecimatorTaps designs[DECIMATOR_FILTER_COUNT];
+static bool designed[DECIMATOR_FILTER_COUNT];
+
+const char *decimatorName(int filter)
+{
+  return filter >= 0 && filter < DECIMATOR_FILTER_COUNT ? filter_names[filter] : "unknown";
+}
+
+int decimatorFromName(const char *name)
+{
+  for (int i = 0; i < DECIMATOR_FILTER_COUNT; i++)
+  {
+    if (strcmp(name, filter_names[i]) == 0)
+      return i;
+  }
+  return -1;
+}
+
+// Fills taps[0..length) for the filter, returns the length
+static int designTaps(int filter, float *taps)
+{
+  if (filter == DECIMATOR_SINC)
+  {
+    const float cutoff = 0.5f / DECIMATION_FACTOR; // Output Nyquist, in cycles per input sample
+    const float centre = (SINC_TAPS - 1) / 2.0f;
+    for (int k = 0; k < SINC_TAPS; k++)
+    {
+      float x = 2.0f * cutoff * (k - centre);
+      float sinc = x == 0.0f ? 1.0f : sinf((float)M_PI * x) / ((float)M_PI * x);
+      float phase = 2.0f * (float)M_PI * k / (SINC_TAPS - 1);
+      float blackman = 0.42f - 0.5f * cosf(phase) + 0.08f * cosf(2.0f * phase);
+      taps[k] = sinc * blackman;
+    }
+    return SINC_TAPS;
+  }
+
+  // Box-car, convolved with itself once per extra CIC stage. Taps stay integers so the box-car
+  // sums exactly what window_avg summed.
+  int stages = filter == DECIMATOR_CIC ? CIC_STAGES : 1;
+  int length = 1;
+  taps[0] = 1.0f;
+  for (int stage = 0; stage < stages; stage++)
+  {
+    float previous[DECIMATOR_MAX_TAPS];
+    memcpy(previous, taps, length * sizeof(float));
+    int next_length = length + DECIMATION_FACTOR - 1;
+    for (int k = 0; k < next_length; k++)
+    {
+      float sum = 0;
+      for (int j = 0; j < DECIMATION_FACTOR; j++)
+      {
+        if (k - j >= 0 && k - j < length)
+          sum += previous[k - j];
+      }
+      taps[k] = sum;
+    }
+    length = next_length;
+  }
+  return length;
+}
+
+const DecimatorTaps *decimatorTaps(int filter)
+{
+  if (filter < 0 || filter >= DECIMATOR_FILTER_COUNT)
+    filter = DECIMATOR_BOXCAR;
+  DecimatorTaps *design = &designs[filter];
+  if (designed[filter])
+    return design;
+
+  float *taps = design->taps;
+  int length = designTaps(filter, taps);
+  design->filter = filter;
+  design->length = length;
+  design->delay = (DECIMATION_FACTOR - 1) / 2 + (length - 1) / 2;
+  design->gain = 0;
+  design->int_gain = 0;
+  float int_tap_one = filter == DECIMATOR_SINC ? SINC_INT_TAP_ONE : 1.0f;
+  for (int k = 0; k < length; k++)
+  {
+    design->gain += taps[k];
+    design->int_taps[k] = (int32_t)lroundf(taps[k] * int_tap_one);
+    design->int_gain += design->int_taps[k]; // Rounded taps, so DC still comes out unchanged
+  }
+  for (int p = 0; p < DECIMATION_FACTOR; p++)
+  {
+    design->phase_length[p] = 0;
+    for (int k = p; k < length; k += DECIMATION_FACTOR)
+    {
+      design->phases[p][design->phase_length[p]] = taps[k];
+      design->int_phases[p][design->phase_length[p]++] = design->int_taps[k];
+    }
+  }
+  designed[filter] = true;
+  return design;
+}
+
+static_assert(DECIMATOR_CHANNELS == 6 && KERNEL_CHANNELS == 6, "gather() keeps one accumulator per channel");
+
+// Float sums divide by the gain, exact for scale 1 so the box-car stays bit-exact. Integer sums are
+// converted with one multiply.
+static inline float finish(float sum, float gain, float scale)
+{
+  return sum / gain * scale;
+}
+
+static inline float finish(int32_t sum, float gain, float scale)
+{
+  return sum * (scale / gain);
+}
+
+// Phase taps and gain the sample type is summed with
+static inline const float *phaseTaps(const DecimatorTaps *t, int p, const float *)
+{
+  return t->phases[p];
+}
+
+static inline const int32_t *phaseTaps(const DecimatorTaps *t, int p, const int16_t *)
+{
+  return t->int_phases[p];
+}
+
+static inline float sumGain(const DecimatorTaps *t, const float *)
+{
+  return t->gain;
+}
+
+static inline float sumGain(const DecimatorTaps *t, const int16_t *)
+{
+  return t->int_gain;
+}
+
+// Input n meets tap p + 5j of output (n + p - delay) / 5 + j, where p = (delay - n) mod 5.
+// Tap 0 is the last one an output needs, so phase 0 finishes one output per 5 inputs.
+template <typename Sample>
+static void pushIndexed(Decimator<Sample> *d, const Sample *sample)
+{
+  typedef typename Decimator<Sample>::Sum Sum;
+  const DecimatorTaps *t = d->taps;
+  int p = d->phase;
+  const auto *phase = phaseTaps(t, p, sample);
+  long i = d->first_output;
+  int slot = d->first_slot;
+
+  for (int j = 0; j < t->phase_length[p]; j++, i++)
+  {
+    if (i >= (long)d->out_count)
+      break;
+    if (i >= 0)
+    {
+      Sum h = phase[j];
+      Sum *acc = d->acc[slot];
+      for (int c = 0; c < DECIMATOR_CHANNELS; c++)
+        acc[c] += h * sample[c];
+    }
+    if (++slot == DECIMATOR_MAX_PENDING)
+      slot = 0;
+  }
+
+  if (p == 0)
+  {
+    // Tap 0 was the first output's last, write it out and move on to the next one
+    if (d->first_output >= 0 && d->first_output < (long)d->out_count)
+    {
+      Sum *acc = d->acc[d->first_slot];
+      float *out = d->out + d->first_output * DECIMATOR_CHANNELS;
+      float gain = sumGain(t, sample);
+      for (int c = 0; c < DECIMATOR_CHANNELS; c++)
+      {
+        out[c] = finish(acc[c], gain, d->scale);
+        acc[c] = 0;
+      }
+    }
+    d->first_output++;
+    if (++d->first_slot == DECIMATOR_MAX_PENDING)
+      d->first_slot = 0;
+    d->phase = DECIMATION_FACTOR - 1;
+  }
+  else
+  {
+    d->phase = p - 1;
+  }
+  d->next_input++;
+}
+
+template <typename Sample>
+void decimatorReset(Decimator<Sample> *d, const DecimatorTaps *taps, float *out, size_t out_count, float scale)
+{
+  d->taps = taps;
+  d->out = out;
+  d->out_count = out_count;
+  d->scale = scale;
+  // Inputs before 0 that the first output's taps reach
+  long first_needed = (long)taps->delay - (taps->length - 1);
+  long n = first_needed < 0 ? first_needed : 0;
+  d->next_input = n;
+  d->phase = (int)(((taps->delay - n) % DECIMATION_FACTOR + DECIMATION_FACTOR) % DECIMATION_FACTOR);
+  d->first_output = (n + d->phase - taps->delay) / DECIMATION_FACTOR;
+  d->first_slot = (int)(((d->first_output % DECIMATOR_MAX_PENDING) + DECIMATOR_MAX_PENDING) % DECIMATOR_MAX_PENDING);
+  memset(d->acc, 0, sizeof(d->acc));
+  memset(d->last, 0, sizeof(d->last));
+}
+
+template <typename Sample>
+void decimatorPush(Decimator<Sample> *d, const Sample *sample)
+{
+  while (d->next_input < 0)
+    pushIndexed(d, sample);
+  pushIndexed(d, sample);
+  memcpy(d->last, sample, sizeof(d->last));
+}
+
+template <typename Sample>
+void decimatorFinish(Decimator<Sample> *d)
+{
+  if (d->out_count == 0)
+    return;
+  long last_needed = (long)(d->out_count - 1) * DECIMATION_FACTOR + d->taps->delay;
+  while (d->next_input <= last_needed)
+    pushIndexed(d, d->last);
+}
+
+template void decimatorReset(Decimator<float> *, const DecimatorTaps *, float *, size_t, float);
+template void decimatorPush(Decimator<float> *, const float *);
+template void decimatorFinish(Decimator<float> *);
+template void decimatorReset(Decimator<int16_t> *, const DecimatorTaps *, float *, size_t, float);
+template void decimatorPush(Decimator<int16_t> *, const int16_t *);
+template void decimatorFinish(Decimator<int16_t> *);
+
+// One output's taps over its inputs, oldest first (the order the streaming path adds them in). The
+// six accumulators are named so they stay in registers. Channels are stride apart in channel-major
+// input, next to each other (a compile-time 1) otherwise.
+template <typename Sample, typename Tap, typename Acc, bool ChannelMajor>
+static inline void gather(const Sample *const *rows, const Tap *taps, int length, float *y, float scale, float gain,
+                          size_t stride)
+{
+  const size_t s = ChannelMajor ? stride : 1;
+  Acc a0 = 0, a1 = 0, a2 = 0, a3 = 0, a4 = 0, a5 = 0;
+  for (int k = length - 1, r = 0; k >= 0; k--, r++)
+  {
+    const Sample *x = rows[r];
+    Tap h = taps[k];
+    a0 += h * x[0];
+    a1 += h * x[s];
+    a2 += h * x[2 * s];
+    a3 += h * x[3 * s];
+    a4 += h * x[4 * s];
+    a5 += h * x[5 * s];
+  }
+  y[0] = finish(a0, gain, scale);
+  y[1] = finish(a1, gain, scale);
+  y[2] = finish(a2, gain, scale);
+  y[3] = finish(a3, gain, scale);
+  y[4] = finish(a4, gain, scale);
+  y[5] = finish(a5, gain, scale);
+}
+
+// Interleaved float rows go through kernelFir6(), the build's vector kernel with the same sums
+template <typename Sample, typename Tap, typename Acc, bool ChannelMajor>
+struct RowFilter
+{
+  static void run(const Sample *const *rows, const Tap *taps, int length, float *y, float scale, float gain,
+                  size_t stride)
+  {
+    gather<Sample, Tap, Acc, ChannelMajor>(rows, taps, length, y, scale, gain, stride);
+  }
+};
+
+template <>
+struct RowFilter<float, float, float, false>
+{
+  static void run(const float *const *rows, const float *taps, int length, float *y, float scale, float gain, size_t)
+  {
+    kernelFir6(rows, taps, length, gain, scale, y);
+  }
+};
+
+template <typename Sample, typename Tap, typename Acc, bool ChannelMajor = false>
+static void decimateWith(const DecimatorTaps *taps, const Tap *tap_values, float gain, const Sample *input,
+                         size_t input_count, float *out, size_t out_count, float scale, size_t capacity = 0)
+{
+  if (input_count == 0)
+    return;
+  const int length = taps->length;
+  const long last_input = (long)input_count - 1;
+  const Sample *rows[DECIMATOR_MAX_TAPS];
+
+  for (size_t i = 0; i < out_count; i++)
+  {
+    long first = (long)i * DECIMATION_FACTOR + taps->delay - (length - 1);
+    // Near the ends, taps outside the buffer see the first or last sample
+    for (int r = 0; r < length; r++)
+    {
+      long n = first + r;
+      n = n < 0 ? 0 : (n > last_input ? last_input : n);
+      rows[r] = input + n * (ChannelMajor ? 1 : DECIMATOR_CHANNELS);
+    }
+    RowFilter<Sample, Tap, Acc, ChannelMajor>::run(rows, tap_values, length, out + i * DECIMATOR_CHANNELS, scale,
+                                                   gain, capacity);
+  }
+}
+
+void decimate(const DecimatorTaps *taps, const float *input, size_t input_count, float *out, size_t out_count,
+              float scale)
+{
+  decimateWith<float, float, float>(taps, taps->taps, taps->gain, input, input_count, out, out_count, scale);
+}
+
+// Summed in int32 with the integer taps, converted once per output
+void decimate(const DecimatorTaps *taps, const int16_t *input, size_t input_count, float *out, size_t out_count,
+              float scale)
+{
+  decimateWith<int16_t, int32_t, int32_t>(taps, taps->int_taps, taps->int_gain, input, input_count, out, out_count,
+                                          scale);
+}
+
+void decimateChannelMajor(const DecimatorTaps *taps, const float *input, size_t capacity, size_t input_count,
+                          float *out, size_t out_count, float scale)
+{
+  decimateWith<float, float, float, true>(taps, taps->taps, taps->gain, input, input_count, out, out_count, scale,
+                                          capacity);
+}
+
+void decimateChannelMajor(const DecimatorTaps *taps, const int16_t *input, size_t capacity, size_t input_count,
+                          float *out, size_t out_count, float scale)
+{
+  decimateWith<int16_t, int32_t, int32_t, true>(taps, taps->int_taps, taps->int_gain, input, input_count, out,
+                                                out_count, scale, capacity);
+}
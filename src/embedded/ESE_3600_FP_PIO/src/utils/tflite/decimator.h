@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Decimation by DECIMATION_FACTOR for the model input (GRAB_LEN -> OUTPUT_SEQUENCE_LENGTH).
+//
+// Decimating FIR, run two ways with the same sums. Streaming (Decimator, fed by the resampler as the
+// window is read) is polyphase: each input sample, all channels at once, is multiplied only into the
+// few outputs whose taps cover it, so nothing is kept but DECIMATOR_MAX_PENDING partial sums. Whole
+// window (decimate()) computes only every fifth output, each gathered straight from the buffer.
+// Output i is centred on input 5i + 2, the middle of the box window_avg has always averaged. Taps that
+// reach past either end of the input see the first or last sample repeated.
+//
+// The filter is picked at build time with -DDECIMATOR_FILTER=...; host builds can override it
+// with --decimator.
+
+#define DECIMATOR_BOXCAR 0 // Mean of each 5 samples, bit-exact with the original window_avg
+#define DECIMATOR_SINC 1   // 31-tap Blackman-windowed sinc, cut off at the output Nyquist rate
+#define DECIMATOR_CIC 2    // 3-stage CIC response (box-car cascaded three times), run as an FIR
+#define DECIMATOR_FILTER_COUNT 3
+
+#ifndef DECIMATOR_FILTER
+#define DECIMATOR_FILTER DECIMATOR_BOXCAR
+#endif
+
+const int DECIMATION_FACTOR = 5;
+const int DECIMATOR_CHANNELS = 6;
+const int DECIMATOR_MAX_TAPS = 31;
+const int DECIMATOR_MAX_PHASE_TAPS = (DECIMATOR_MAX_TAPS + DECIMATION_FACTOR - 1) / DECIMATION_FACTOR;
+const int DECIMATOR_MAX_PENDING = DECIMATOR_MAX_PHASE_TAPS;
+
+// Taps, also split into DECIMATION_FACTOR phases: phase p holds taps p, p + 5, p + 10, ...
+struct DecimatorTaps
+{
+  int filter;
+  int length;
+  int delay; // Output i is complete once input 5i + delay has arrived
+  float gain;
+  float taps[DECIMATOR_MAX_TAPS];
+  // For int16 input, summed in int32: the box-car and CIC taps as they are, the sinc's in Q12.
+  // The sum of their magnitudes stays under 65536, so no sum of int16 samples can overflow.
+  int32_t int_taps[DECIMATOR_MAX_TAPS];
+  float int_gain;
+  int phase_length[DECIMATION_FACTOR];
+  float phases[DECIMATION_FACTOR][DECIMATOR_MAX_PHASE_TAPS];
+  int32_t int_phases[DECIMATION_FACTOR][DECIMATOR_MAX_PHASE_TAPS];
+};
+
+// Float samples are summed in float, int16 ones in int32 with the integer taps, as decimate() does
+template <typename Sample>
+struct DecimatorSum
+{
+  typedef float type;
+};
+
+template <>
+struct DecimatorSum<int16_t>
+{
+  typedef int32_t type;
+};
+
+template <typename Sample>
+struct Decimator
+{
+  typedef typename DecimatorSum<Sample>::type Sum;
+
+  const DecimatorTaps *taps;
+  float *out; // out_count x DECIMATOR_CHANNELS
+  size_t out_count;
+  float scale;
+  long next_input;   // Index of the next input, negative while the start is being padded
+  int phase;         // Taps phase of the next input, counts down 4..0
+  long first_output; // First output the next input contributes to
+  int first_slot;    // first_output % DECIMATOR_MAX_PENDING
+  Sum acc[DECIMATOR_MAX_PENDING][DECIMATOR_CHANNELS];
+  Sample last[DECIMATOR_CHANNELS];
+};
+
+// Filter the pipeline uses, DECIMATOR_FILTER unless overridden
+extern int decimator_filter;
+
+const char *decimatorName(int filter);
+int decimatorFromName(const char *name); // -1 if unknown
+
+// Taps for a filter, designed on first use
+const DecimatorTaps *decimatorTaps(int filter);
+
+// Streaming: out_count outputs, each multiplied by scale, written as soon as their last input arrives
+template <typename Sample>
+void decimatorReset(Decimator<Sample> *decimator, const DecimatorTaps *taps, float *out, size_t out_count,
+                    float scale = 1.0f);
+template <typename Sample>
+void decimatorPush(Decimator<Sample> *decimator, const Sample *sample);
+
+// Pads with the last sample until every output has been written
+template <typename Sample>
+void decimatorFinish(Decimator<Sample> *decimator);
+
+template <typename Sample>
+inline bool decimatorDone(const Decimator<Sample> *decimator)
+{
+  return decimator->first_output >= (long)decimator->out_count;
+}
+
+// Whole buffer at once: input_count samples in, out_count samples out, each multiplied by scale.
+// Same sums in the same order as pushing the samples one by one, but each output is gathered straight
+// from the buffer with its accumulators in registers. The int16 version reads fixed-point samples and
+// only converts them as they are filtered.
+void decimate(const DecimatorTaps *taps, const float *input, size_t input_count, float *out, size_t out_count,
+              float scale = 1.0f);
+void decimate(const DecimatorTaps *taps, const int16_t *input, size_t input_count, float *out, size_t out_count,
+              float scale);
+
+// The same over channel-major input (sample_store.h): channel c of input n at input[c * capacity + n]
+void decimateChannelMajor(const DecimatorTaps *taps, const float *input, size_t capacity, size_t input_count,
+                          float *out, size_t out_count, float scale = 1.0f);
+void decimateChannelMajor(const DecimatorTaps *taps, const int16_t *input, size_t capacity, size_t input_count,
+                          float *out, size_t out_count, float scale);
@@ -1,51 +1,185 @@
 #include "imu_provider.h"
+#include "resampler.h"
+#include <math.h>
+#include <string.h>
 #include "../hardware/mpu.h"
+#include "../hal/hal.h"
+#include "../kernels/kernels.h"
 
-const int sampling_interval_ms = 1; // Interval between samples
+ImuProfile imu_profile = IMU_PROFILE_OVERSAMPLE;
+static ImuProfile pending_profile = IMU_PROFILE_OVERSAMPLE;
+
+static const char *const profile_names[IMU_PROFILE_COUNT] = {"oversample", "model"};
 
 const int ACCEL_MIN = -25.09375;
 const int ACCEL_MAX = 30.8825;
 const int GYRO_MIN = -8.54875;
 const int GYRO_MAX = 7.995;
 
+#if !SAMPLE_INT16
+// The ranges per channel, in the order of a sample
+static const float channel_min[NUM_FEATURES] = {ACCEL_MIN, ACCEL_MIN, ACCEL_MIN, GYRO_MIN, GYRO_MIN, GYRO_MIN};
+static const float channel_inv_range[NUM_FEATURES] = {
+    1.0f / (ACCEL_MAX - ACCEL_MIN), 1.0f / (ACCEL_MAX - ACCEL_MIN), 1.0f / (ACCEL_MAX - ACCEL_MIN),
+    1.0f / (GYRO_MAX - GYRO_MIN),   1.0f / (GYRO_MAX - GYRO_MIN),   1.0f / (GYRO_MAX - GYRO_MIN)};
+#endif
+
+const char *imuProfileName(ImuProfile profile)
+{
+  return profile >= 0 && profile < IMU_PROFILE_COUNT ? profile_names[profile] : "unknown";
+}
+
+int imuProfileFromName(const char *name)
+{
+  for (int i = 0; i < IMU_PROFILE_COUNT; i++)
+  {
+    if (strcmp(name, profile_names[i]) == 0)
+      return i;
+  }
+  return -1;
+}
+
+static uint8_t sampleRateDivisor()
+{
+  return imu_profile == IMU_PROFILE_MODEL_RATE ? IMU_MODEL_RATE_DIVISOR : 0;
+}
+
+void imuRequestProfile(ImuProfile profile)
+{
+  pending_profile = profile;
+}
+
+ImuProfile imuPendingProfile()
+{
+  return pending_profile;
+}
+
+bool imuBeginWindow()
+{
+  if (pending_profile == imu_profile)
+    return false;
+  imu_profile = pending_profile;
+  mpu.setSampleRateDivisor(sampleRateDivisor());
+  return true;
+}
+
+uint32_t imuSampleIntervalMs()
+{
+  return 1 + sampleRateDivisor();
+}
+
+int imuWindowSamples()
+{
+  return BUFFER_LEN / (1 + sampleRateDivisor());
+}
+
+#if SAMPLE_INT16
+int32_t imu_raw_scale[NUM_FEATURES];
+int32_t imu_raw_offset[NUM_FEATURES];
+
+// normalize_value() as scale and offset on the register counts, in Q15 with IMU_RAW_SHIFT fraction bits
+static void setRawScales()
+{
+  for (int channel = 0; channel < NUM_FEATURES; channel++)
+  {
+    bool accel = channel < 3;
+    float per_count = accel ? mpuAccelPerCount() : mpuGyroPerCount();
+    float min = accel ? ACCEL_MIN : GYRO_MIN;
+    float max = accel ? ACCEL_MAX : GYRO_MAX;
+    float one = (float)SAMPLE_ONE * (1 << IMU_RAW_SHIFT) / (max - min);
+    imu_raw_scale[channel] = (int32_t)lroundf(per_count * one);
+    imu_raw_offset[channel] = (int32_t)lroundf(-min * one) + (1 << (IMU_RAW_SHIFT - 1)); // Rounds the shift
+  }
+}
+#endif
+
 void imuSetup()
 {
   // Initialize MPU6050
   while (!mpu.begin())
   {
-    delay(500);
+    halDelay(500);
   }
 
   mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
   mpu.setGyroRange(MPU6050_RANGE_500_DEG);
   mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
+  mpu.setSampleRateDivisor(sampleRateDivisor());
+#if SAMPLE_INT16
+  setRawScales();
+#endif
+}
+
+static uint32_t read_failures = 0;
+
+uint32_t imuReadFailures()
+{
+  return read_failures;
 }
 
-// Collect into a flattened buffer (simple float array)
-void imuCollect(float *buffer)
+bool imuCollectSample(sample_t sample[NUM_FEATURES], float gyro_raw[3])
 {
-  for (int i = 0; i < BUFFER_LEN; ++i)
+#if SAMPLE_INT16
+  MpuRawFrame frame;
+  if (!mpuReadRaw(&frame))
+  {
+    read_failures++;
+    return false;
+  }
+  for (int axis = 0; axis < 3; axis++)
+  {
+    sample[axis] = imuNormalizeRaw(axis, frame.accel[axis]);
+    sample[3 + axis] = imuNormalizeRaw(3 + axis, frame.gyro[axis]);
+  }
+
+  if (gyro_raw)
   {
-    // Fetch IMU data
-    sensors_event_t accel, gyro, temp;
-    mpu.getEvent(&accel, &gyro, &temp);
+    float per_count = mpuGyroPerCount();
+    for (int axis = 0; axis < 3; axis++)
+      gyro_raw[axis] = frame.gyro[axis] * per_count;
+  }
+#else
+  // Fetch IMU data
+  sensors_event_t accel, gyro, temp;
+  if (!mpu.getEvent(&accel, &gyro, &temp))
+  {
+    read_failures++;
+    return false;
+  }
 
-    buffer[i * NUM_FEATURES] = normalize_value(accel.acceleration.x, ACCEL_MIN, ACCEL_MAX);
-    buffer[i * NUM_FEATURES + 1] = normalize_value(accel.acceleration.y, ACCEL_MIN, ACCEL_MAX);
-    buffer[i * NUM_FEATURES + 2] = normalize_value(accel.acceleration.z, ACCEL_MIN, ACCEL_MAX);
-    buffer[i * NUM_FEATURES + 3] = normalize_value(gyro.gyro.x, GYRO_MIN, GYRO_MAX);
-    buffer[i * NUM_FEATURES + 4] = normalize_value(gyro.gyro.y, GYRO_MIN, GYRO_MAX);
-    buffer[i * NUM_FEATURES + 5] = normalize_value(gyro.gyro.z, GYRO_MIN, GYRO_MAX);
+  const float reading[NUM_FEATURES] = {accel.acceleration.x, accel.acceleration.y, accel.acceleration.z,
+                                       gyro.gyro.x,          gyro.gyro.y,          gyro.gyro.z};
+  kernelNormalize(reading, sample, NUM_FEATURES, channel_min, channel_inv_range);
 
-    delay(sampling_interval_ms);
+  if (gyro_raw)
+  {
+    gyro_raw[0] = gyro.gyro.x;
+    gyro_raw[1] = gyro.gyro.y;
+    gyro_raw[2] = gyro.gyro.z;
+  }
+#endif
+  return true;
+}
+
+void imuCollect(SampleResampler *resampler)
+{
+  uint32_t interval_ms = imuSampleIntervalMs();
+  sample_t sample[NUM_FEATURES] = {}; // A failed read repeats the previous one
+  for (;;)
+  {
+    uint32_t now_us = halMicros();
+    imuCollectSample(sample);
+    if (resamplerPush(resampler, now_us, sample))
+      return;
+    halDelay(interval_ms);
   }
 }
 
+// One value through the same kernel, clamped to 0-1
 float normalize_value(float value, float min, float max)
 {
-  float normalized = (value - min) / (max - min);
-  // Clamp to 0-1
-  normalized = (normalized < 0) ? 0 : (normalized > 1) ? 1
-                                                       : normalized;
+  float inv_range = 1.0f / (max - min);
+  float normalized;
+  kernelNormalize(&value, &normalized, 1, &min, &inv_range);
   return normalized;
 }
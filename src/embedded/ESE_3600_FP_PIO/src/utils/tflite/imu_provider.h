@@ -5,7 +5,77 @@
 const int NUM_FEATURES = 6;
 const int BUFFER_LEN = 1000;
 
+// Sample storage, picked at build time. -DSAMPLE_INT16=1 reads the raw registers and keeps each
+// normalized value as Q15 (0..SAMPLE_ONE for 0..1), halving dataBuffer. The normalization is a
+// per-channel integer scale and offset, and samples only become floats at the model input.
+#ifndef SAMPLE_INT16
+#define SAMPLE_INT16 0
+#endif
+
+#if SAMPLE_INT16
+typedef int16_t sample_t;
+const int16_t SAMPLE_ONE = 32767;
+#else
+typedef float sample_t;
+const float SAMPLE_ONE = 1.0f;
+#endif
+
+// Multiplies a stored sample back to the 0..1 the model was trained on
+const float SAMPLE_TO_FLOAT = 1.0f / SAMPLE_ONE;
+
+// How a one-second window is acquired. The DLPF (21 Hz) is on in both, so the chip's output rate is
+// 1 kHz / (1 + SMPLRT_DIV).
+enum ImuProfile
+{
+  IMU_PROFILE_OVERSAMPLE, // SMPLRT_DIV 0: BUFFER_LEN reads at 1 kHz, decimated by 5 in software
+  IMU_PROFILE_MODEL_RATE  // SMPLRT_DIV 4: the chip delivers the model's 200 Hz, one read per model step
+};
+
+struct SampleResampler;
+
+const int IMU_PROFILE_COUNT = 2;
+const uint8_t IMU_MODEL_RATE_DIVISOR = 4;
+
+// Profile of the window being collected (or last collected), latched by imuBeginWindow(). The window in
+// dataBuffer and its preprocessing always go with this one.
+extern ImuProfile imu_profile;
+
+const char *imuProfileName(ImuProfile profile);
+int imuProfileFromName(const char *name); // -1 if unknown
+
+// Asks for a profile switch. Nothing changes mid-window: the next imuBeginWindow() applies it.
+void imuRequestProfile(ImuProfile profile);
+ImuProfile imuPendingProfile();
+
+// Window boundary: applies a requested profile (reprograms the sample rate) and latches it for the
+// window about to start. True if the profile changed.
+bool imuBeginWindow();
+
+uint32_t imuSampleIntervalMs(); // Between reads for the latched profile
+int imuWindowSamples();         // Reads per window for the latched profile
+
 void imuSetup();
 
-void imuCollect(float *buffer);
-float normalize_value(float value, float min, float max);
\ No newline at end of file
+// Reads until the resampler's grid is full (resamplerReset() first), blocks for the whole window
+void imuCollect(SampleResampler *resampler);
+// Reads one sample, its channels in model order. gyro_raw, if given, also receives the raw rates in rad/s.
+// A failed read leaves sample (and gyro_raw) as they were, so the previous sample repeats, and returns false.
+bool imuCollectSample(sample_t sample[NUM_FEATURES], float gyro_raw[3] = nullptr);
+
+// Failed reads since boot
+uint32_t imuReadFailures();
+float normalize_value(float value, float min, float max);
+
+#if SAMPLE_INT16
+// Q15 = (counts * imu_raw_scale + imu_raw_offset) >> IMU_RAW_SHIFT, set by imuSetup() for the ranges.
+// The sum fits an int32 at every range setting, it peaks at about 1.8e9 with 16 g.
+const int IMU_RAW_SHIFT = 14;
+extern int32_t imu_raw_scale[NUM_FEATURES];
+extern int32_t imu_raw_offset[NUM_FEATURES];
+
+inline int16_t imuNormalizeRaw(int channel, int16_t counts)
+{
+  int32_t value = (counts * imu_raw_scale[channel] + imu_raw_offset[channel]) >> IMU_RAW_SHIFT;
+  return value < 0 ? 0 : (value > SAMPLE_ONE ? SAMPLE_ONE : (int16_t)value);
+}
+#endif
\ No newline at end of file
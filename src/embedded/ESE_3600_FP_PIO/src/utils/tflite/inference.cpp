@@ -1,4 +1,13 @@
 #include "inference.h"
+#include "../trace/trace.h"
+#include "../log/log.h"
+#include "../kernels/kernels.h"
+#include "../hal/hal.h"
+#include "model_pack.h"
+#include "model_registry.h"
+#include "result_cache.h"
+#include <new>
+#include <string.h>
 
 
 // Define the label variables that were declared extern in the header
@@ -6,10 +15,23 @@ const int label_count = 6;
 const char *labels[label_count] = {"l_i", "n_l", "o_a", "p_f", "p_m", "s_w"};
 const char *full_label_classes[label_count] = {"Lift Instability", "No Lift", "Off-Axis", "Perfect Form", "Partial Motion", "Swinging Weight"};
 
-const bool DEBUG_OUTPUT = true;
+static const char *const lift_labels[] = {"dC", "bP", "dF"};
+static const char *const phase_labels[] = {"rest", "lowering", "lifting"};
 
-// Buffer to store IMU data - update to use template type selection
-float dataBuffer[NUM_FEATURES * BUFFER_LEN];
+const HeadSpec head_specs[MODEL_HEAD_COUNT] = {
+    {"form", label_count, labels},
+    {"lift", 3, lift_labels},
+    {"phase", 3, phase_labels},
+};
+
+InferenceResult last_result = {};
+
+// Softmax and timing of the most recent doInference() call
+float last_probabilities[label_count];
+unsigned long last_inference_us = 0;
+
+// Buffer to store IMU data, float or Q15 int16 depending on SAMPLE_INT16
+sample_t dataBuffer[NUM_FEATURES * BUFFER_LEN];
 
 // TensorFlow Lite globals
 namespace
@@ -18,6 +40,14 @@ namespace
   const tflite::Model *model = nullptr;
   tflite::MicroInterpreter *interpreter = nullptr;
 
+  // The resident model's interpreter, rebuilt in place whenever another model is loaded
+  alignas(tflite::MicroInterpreter) uint8_t interpreter_storage[sizeof(tflite::MicroInterpreter)];
+  const ModelEntry *resident_model = nullptr;
+
+  // Decode target shared by every packed model
+  uint8_t *model_buffer = nullptr;
+  size_t model_buffer_size = 0;
+
   // All Ops Resolver
   tflite::AllOpsResolver resolver;
 
@@ -27,66 +57,245 @@ namespace
   uint8_t tensor_arena[kTensorArenaSize];
 }
 
-void setupModel(bool verbose)
+#if MODEL_PACKED
+// One buffer for the largest registered model, allocated at the first load and kept
+static bool allocateModelBuffer()
 {
-  // Initialize the error reporter
-  static tflite::MicroErrorReporter micro_error_reporter;
-  error_reporter = &micro_error_reporter;
+  if (model_buffer != nullptr)
+    return true;
+  for (int i = 0; i < model_registry_count; i++)
+  {
+    size_t size = modelPackedSize(model_registry[i].data, model_registry[i].length);
+    model_buffer_size = size > model_buffer_size ? size : model_buffer_size;
+  }
+  ModelLoadStats &stats = model_load_stats;
+  stats.external = MODEL_PSRAM;
+  model_buffer = (uint8_t *)halAllocStatic(model_buffer_size, MODEL_ALIGNMENT, stats.external);
+  if (model_buffer == nullptr && stats.external)
+  {
+    stats.external = false;
+    model_buffer = (uint8_t *)halAllocStatic(model_buffer_size, MODEL_ALIGNMENT, false);
+  }
+  if (model_buffer == nullptr)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "No memory to decode a %u byte model.", (unsigned)model_buffer_size);
+    return false;
+  }
+  stats.buffer_bytes = model_buffer_size;
+  return true;
+}
+#endif
+
+// The flatbuffer to run: the entry's array itself, or its packed container decoded into the model buffer.
+// nullptr if it cannot be decoded.
+static const uint8_t *loadModelData(const ModelEntry &entry)
+{
+  ModelLoadStats &stats = model_load_stats;
+  stats.packed = MODEL_PACKED;
+#if !MODEL_PACKED
+  stats.stored_bytes = stats.model_bytes = entry.length;
+  return entry.data;
+#else
+  // Only referenced through the registry here, so the linker drops model.cpp's array (85 KB of
+  // initialized RAM) from packed builds
+  if (!allocateModelBuffer())
+    return nullptr;
+  size_t size = modelPackedSize(entry.data, entry.length);
+  uint32_t start = halCpuMicros();
+  bool ok = size > 0 && size <= model_buffer_size && modelUnpack(entry.data, entry.length, model_buffer, size);
+  stats.decode_us = halCpuMicros() - start;
+  if (!ok)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "Packed model for %s is corrupt.", entry.lift);
+    return nullptr;
+  }
+  stats.stored_bytes = entry.length;
+  stats.model_bytes = size;
+  return model_buffer;
+#endif
+}
+
+// Tears down the resident model and sets up entry's in its place: decode, interpreter and tensors in the
+// shared arena, then the input and output shapes the pipeline expects. No model is resident on failure.
+static bool replaceModel(const ModelEntry &entry)
+{
+  uint32_t load_start = halCpuMicros();
+  if (interpreter != nullptr)
+    interpreter->~MicroInterpreter();
+  interpreter = nullptr;
+  resident_model = nullptr;
 
   // Map the model
-  model = tflite::GetModel(g_rep_mate_model_data);
+  const uint8_t *model_data = loadModelData(entry);
+  if (model_data == nullptr)
+    return false;
+  model = tflite::GetModel(model_data);
   if (model->version() != TFLITE_SCHEMA_VERSION)
   {
     TF_LITE_REPORT_ERROR(error_reporter,
                          "Model provided is schema version %d not equal "
                          "to supported version %d.",
                          model->version(), TFLITE_SCHEMA_VERSION);
-    return;
+    return false;
   }
 
   // Set up the interpreter
-  static tflite::MicroInterpreter static_interpreter(
+  tflite::MicroInterpreter *candidate = new (interpreter_storage) tflite::MicroInterpreter(
       model, resolver, tensor_arena, kTensorArenaSize, error_reporter);
-  interpreter = &static_interpreter;
 
-  // Allocate memory for the model's tensors
-  if (interpreter->AllocateTensors() != kTfLiteOk)
+  // Allocate memory for the model's tensors, then check the model's inputs and outputs
+  ModelLoadStats &stats = model_load_stats;
+  uint32_t allocate_start = halCpuMicros();
+  TfLiteStatus allocate_status = candidate->AllocateTensors();
+  stats.allocate_us = halCpuMicros() - allocate_start;
+  bool ok = false;
+  if (allocate_status != kTfLiteOk)
   {
     TF_LITE_REPORT_ERROR(error_reporter, "Failed to allocate tensors.");
-    return;
   }
-
-  // Check the model's inputs and outputs
-  if (interpreter->inputs().size() != 1)
+  else if (candidate->inputs().size() != 1)
   {
-    TF_LITE_REPORT_ERROR(error_reporter, "Model expects 1 input tensor, but got %zu.", interpreter->inputs().size());
-    return;
+    TF_LITE_REPORT_ERROR(error_reporter, "Model expects 1 input tensor, but got %zu.", candidate->inputs().size());
   }
-
-  // Check input dimensions
-  if (interpreter->input(0)->dims->data[1] != OUTPUT_SEQUENCE_LENGTH)
+  else if (candidate->input(0)->dims->data[1] != OUTPUT_SEQUENCE_LENGTH)
   {
     TF_LITE_REPORT_ERROR(error_reporter,
                          "Input tensor expects %d samples, but got %d.",
                          OUTPUT_SEQUENCE_LENGTH,
-                         interpreter->input(0)->dims->data[1]);
-    return;
+                         candidate->input(0)->dims->data[1]);
   }
-
-  if (interpreter->input(0)->dims->data[2] != NUM_FEATURES)
+  else if (candidate->input(0)->dims->data[2] != NUM_FEATURES)
   {
     TF_LITE_REPORT_ERROR(error_reporter,
                          "Input tensor expects %d features per sample, but got %d.",
                          NUM_FEATURES,
-                         interpreter->input(0)->dims->data[2]);
-    return;
+                         candidate->input(0)->dims->data[2]);
+  }
+  else if (candidate->outputs().size() != (size_t)entry.head_count)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "Model has %zu output tensors, but %d heads are registered.",
+                         candidate->outputs().size(), entry.head_count);
+  }
+  else
+  {
+    // One output per head, its last dimension the head's classes
+    ok = true;
+    for (int i = 0; i < entry.head_count && ok; i++)
+    {
+      const HeadSpec &spec = head_specs[entry.heads[i]];
+      TfLiteTensor *output = candidate->output(i);
+      int classes = output->dims->size > 0 ? output->dims->data[output->dims->size - 1] : 0; // 0 for a scalar
+      if (output->type != kTfLiteFloat32 || classes != spec.classes)
+      {
+        TF_LITE_REPORT_ERROR(error_reporter, "Output tensor %d expects %d %s labels, but got %d.", i, spec.classes,
+                             spec.name, classes);
+        ok = false;
+      }
+    }
   }
+  if (!ok)
+  {
+    candidate->~MicroInterpreter();
+    return false;
+  }
+  interpreter = candidate;
+  resident_model = &entry;
+  resultCacheClear(); // Results of the previous model
+
+  stats.load_us = halCpuMicros() - load_start;
+  stats.max_load_us = stats.load_us > stats.max_load_us ? stats.load_us : stats.max_load_us;
+  stats.loads++;
+  uint32_t arena_used = interpreter->arena_used_bytes();
+  stats.arena_peak = arena_used > stats.arena_peak ? arena_used : stats.arena_peak;
+  LOG_INFO("Model for %s loaded in %u us: decode %u us, AllocateTensors %u us", entry.lift,
+           (unsigned)stats.load_us, (unsigned)stats.decode_us, (unsigned)stats.allocate_us);
+  return true;
+}
 
-  if (interpreter->output(0)->dims->data[1] != label_count)
+// Each head at most once: HeadResult has one slot per kind
+static bool checkHeads(const ModelEntry &entry)
+{
+  if (entry.head_count < 1 || entry.head_count > MODEL_HEAD_COUNT)
   {
-    TF_LITE_REPORT_ERROR(error_reporter, "Output tensor expects %d labels, but got %d.", label_count, interpreter->output(0)->dims->data[1]);
-    return;
+    TF_LITE_REPORT_ERROR(error_reporter, "Model for %s has %d heads.", entry.lift, entry.head_count);
+    return false;
+  }
+  bool seen[MODEL_HEAD_COUNT] = {};
+  for (int i = 0; i < entry.head_count; i++)
+  {
+    ModelHead head = entry.heads[i];
+    if (head < 0 || head >= MODEL_HEAD_COUNT || seen[head])
+    {
+      TF_LITE_REPORT_ERROR(error_reporter, "Model for %s lists head %d twice or out of range.", entry.lift, head);
+      return false;
+    }
+    seen[head] = true;
+  }
+  return true;
+}
+
+// replaceModel(), putting the previous model back if entry's fails: the decode buffer and the arena only
+// hold one model, so entry's cannot be checked before the resident one is torn down.
+static bool loadModel(const ModelEntry &entry)
+{
+  if (!checkHeads(entry))
+    return false;
+#if MODEL_PACKED
+  // A container that cannot fit the decode buffer fails before anything is torn down
+  size_t size = modelPackedSize(entry.data, entry.length);
+  if (!allocateModelBuffer() || size == 0 || size > model_buffer_size)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "Packed model for %s is corrupt.", entry.lift);
+    return false;
+  }
+#endif
+  const ModelEntry *previous = resident_model;
+  if (replaceModel(entry))
+    return true;
+  if (previous != nullptr && previous != &entry && replaceModel(*previous))
+  {
+    LOG_WARN("Model for %s failed to load, kept %s", entry.lift, previous->lift);
+    return false;
+  }
+  model_load_stats.lift = nullptr; // Nothing resident
+  return false;
+}
+
+bool selectModel(const ModelEntry &entry, bool reload)
+{
+  // Lifts sharing the resident model only change the name
+  bool shared = !reload && resident_model != nullptr && resident_model->data == entry.data;
+  if (shared)
+    resident_model = &entry;
+  else if (!loadModel(entry))
+    return false;
+
+  ModelLoadStats &stats = model_load_stats;
+  if (stats.lift != nullptr && strcmp(stats.lift, entry.lift) != 0)
+    stats.switches++;
+  stats.lift = entry.lift;
+  return true;
+}
+
+bool selectLiftModel(const char *lift, bool reload)
+{
+  const ModelEntry *entry = modelRegistryFind(lift);
+  if (entry == nullptr)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "No model registered for lift %s.", lift);
+    return false;
   }
+  return selectModel(*entry, reload);
+}
+
+void setupModel(bool verbose)
+{
+  // Initialize the error reporter
+  static tflite::MicroErrorReporter micro_error_reporter;
+  error_reporter = &micro_error_reporter;
+
+  if (!selectLiftModel(current_lift.c_str(), false))
+    return;
 
   // Print model details if verbose mode is enabled
   printModelDetails(verbose);
@@ -96,108 +305,183 @@ void setupModel(bool verbose)
   setupOutputLights();
 }
 
-void doInference()
+size_t tensorArenaUsedBytes()
 {
-  TfLiteTensor *input = interpreter->input(0);
-  TfLiteTensor *output = interpreter->output(0);
+  return interpreter ? interpreter->arena_used_bytes() : 0;
+}
 
-  if (!input || !output)
+size_t tensorArenaSize()
+{
+  return kTensorArenaSize;
+}
+
+bool invokeModel()
+{
+  return interpreter && interpreter->Invoke() == kTfLiteOk;
+}
+
+// The form head feeds current_lift_idx and last_probabilities, which the LEDs, cues and BLE records read
+static void publishFormHead(const InferenceResult &result)
+{
+  const HeadResult &form = result.heads[HEAD_FORM];
+  if (form.present)
   {
-    TF_LITE_REPORT_ERROR(error_reporter, "Failed to get input/output tensors");
-    return;
+    memcpy(last_probabilities, form.probabilities, sizeof(last_probabilities));
+    current_lift_idx = form.class_idx;
   }
+}
 
-  // Debug quantization parameters
-  if (DEBUG_OUTPUT && false)
+// Runs the model on the input tensor once and fills last_result with every head. The form head also
+// updates current_lift_idx and last_probabilities.
+static const InferenceResult &classifyInput()
+{
+  LOG_DEBUG("Invoking inference");
+  InferenceResult &result = last_result;
+  result.valid = false;
+
+  // Run inference
+  traceBegin(TRACE_INVOKE);
+  unsigned long start_time = micros();
+  TfLiteStatus invoke_status = interpreter->Invoke();
+  last_inference_us = micros() - start_time;
+  traceEnd(TRACE_INVOKE);
+
+  if (invoke_status != kTfLiteOk)
   {
-    printf("Input quantization - scale: %f, zero_point: %d\n",
-           input->params.scale, input->params.zero_point);
-    printf("Output quantization - scale: %f, zero_point: %d\n",
-           output->params.scale, output->params.zero_point);
+    TF_LITE_REPORT_ERROR(error_reporter,
+                         "Inference failed with status: %d", invoke_status);
+    return result;
   }
+  result.valid = true;
+  result.invoke_us = last_inference_us;
 
-  try
+  for (HeadResult &head : result.heads)
+    head.present = false;
+  for (int i = 0; i < resident_model->head_count; i++)
   {
-    if (DEBUG_OUTPUT)
+    ModelHead kind = resident_model->heads[i];
+    const HeadSpec &spec = head_specs[kind];
+    const float *logits = interpreter->output(i)->data.f;
+    HeadResult &head = result.heads[kind];
+    head.present = true;
+    head.class_count = spec.classes;
+    applySoftmax(logits, spec.classes, head.probabilities);
+
+    // Find max probability and corresponding class
+    head.class_idx = 0;
+    for (int c = 1; c < spec.classes; c++)
     {
-      printf("Preprocessing data\n");
-    }
-
-    // Preprocess input
-    preprocess_buffer_to_input(dataBuffer, input->data.f);
-
-    if (DEBUG_OUTPUT)
-    {
-      printf("Invoking inference\n");
+      if (head.probabilities[c] > head.probabilities[head.class_idx])
+      {
+        head.class_idx = c;
+      }
     }
 
-    // Run inference
-    unsigned long start_time = millis();
-    TfLiteStatus invoke_status = interpreter->Invoke();
-    unsigned long inference_time = millis() - start_time;
-
-    if (invoke_status != kTfLiteOk)
+    for (int c = 0; c < spec.classes; c++)
     {
-      TF_LITE_REPORT_ERROR(error_reporter,
-                           "Inference failed with status: %d", invoke_status);
-      return;
+      LOG_DEBUG("%s %s: logit %f, probability %.4f", spec.name, spec.labels[c], logits[c], head.probabilities[c]);
     }
+  }
 
-    if (DEBUG_OUTPUT)
-    {
-      printf("Inference completed in %lu ms\n", inference_time);
-
-      // Print raw logits
-      printf("Raw logits: ");
-      for (int i = 0; i < label_count; i++)
-      {
-        printf("%f ", output->data.f[i]);
-      }
-      printf("\n");
+  publishFormHead(result);
 
-      float softmax[label_count];
-      applySoftmax(output->data.f, label_count, softmax);
+  LOG_DEBUG("Inference completed in %lu us", last_inference_us);
+  for (int i = 0; i < resident_model->head_count; i++)
+  {
+    const HeadSpec &spec = head_specs[resident_model->heads[i]];
+    const HeadResult &head = result.heads[resident_model->heads[i]];
+    LOG_INFO("Predicted %s: %s (confidence: %.2f%%)", spec.name, spec.labels[head.class_idx],
+             head.probabilities[head.class_idx] * 100);
+  }
+  return result;
+}
 
-      // Find max probability and corresponding class
-      int max_idx = 0;
-      float max_prob = softmax[0];
+// The cached result for a window like this one (result_cache.h), or the model's, which is then cached
+static const InferenceResult &classifyWindow(const WindowSignature &signature)
+{
+  uint32_t stored_window = 0;
+  const InferenceResult *cached = RESULT_CACHE ? resultCacheLookup(signature, &stored_window) : nullptr;
+#ifndef ARDUINO
+  hostNoteInput(interpreter->input(0)->data.f, OUTPUT_SEQUENCE_LENGTH * NUM_FEATURES,
+                cached ? (long)stored_window : -1);
+#endif
+  if (cached != nullptr)
+  {
+    LOG_DEBUG("Result cache hit, Invoke() skipped");
+    last_result = *cached;
+    last_result.invoke_us = 0;
+    last_inference_us = 0;
+    publishFormHead(last_result);
+    return last_result;
+  }
+  classifyInput();
+  if (RESULT_CACHE)
+    resultCacheStore(signature, last_result);
+  return last_result;
+}
 
-      // Normalize softmax and find max
-      printf("Class probabilities:\n");
-      for (int i = 0; i < label_count; i++)
-      {
-        printf("%s: %.4f\n", labels[i], softmax[i]);
-        if (softmax[i] > max_prob)
-        {
-          max_prob = softmax[i];
-          max_idx = i;
-        }
-      }
+const InferenceResult &doInference()
+{
+  last_result.valid = false;
+  if (interpreter == nullptr)
+    return last_result;
+  TfLiteTensor *input = interpreter->input(0);
 
-      current_lift_idx = max_idx;
+  if (!input)
+  {
+    TF_LITE_REPORT_ERROR(error_reporter, "Failed to get the input tensor");
+    return last_result;
+  }
 
-      // Print final prediction
-      printf("\nPredicted class: %s (confidence: %.2f%%)\n",
-             labels[max_idx], max_prob * 100);
+  try
+  {
+    LOG_DEBUG("Preprocessing data");
 
-      printf("----------------------------------\n");
-    }
+    // Preprocess input
+    traceBegin(TRACE_PREPROCESS);
+    preprocess_buffer_to_input(SampleBuffer{dataBuffer, BUFFER_LEN}, input->data.f);
+    WindowSignature signature;
+    if (RESULT_CACHE)
+      windowSignature(input->data.f, OUTPUT_SEQUENCE_LENGTH, &signature);
+    traceEnd(TRACE_PREPROCESS);
+
+    classifyWindow(signature);
   }
   catch (const std::exception &e)
   {
-    printf("Exception during inference: %s\n", e.what());
+    LOG_ERROR("Exception during inference: %s", e.what());
     TF_LITE_REPORT_ERROR(error_reporter, "Exception during inference: %s", e.what());
   }
+  return last_result;
 }
 
-void getInferenceResult()
+const InferenceResult &doRepInference(size_t first_sample, size_t sample_count)
 {
-  TfLiteTensor *output = interpreter->output(0);
-  if (DEBUG_OUTPUT)
+  last_result.valid = false;
+  if (interpreter == nullptr)
+    return last_result;
+  TfLiteTensor *input = interpreter->input(0);
+
+  if (!input)
   {
-    printf("Inference output: ");
+    TF_LITE_REPORT_ERROR(error_reporter, "Failed to get the input tensor");
+    return last_result;
   }
 
+  traceBegin(TRACE_PREPROCESS);
+  resample_ring_to_input(SampleBuffer{dataBuffer, BUFFER_LEN}, first_sample % BUFFER_LEN, sample_count, input->data.f);
+  WindowSignature signature;
+  if (RESULT_CACHE)
+    windowSignature(input->data.f, OUTPUT_SEQUENCE_LENGTH, &signature);
+  traceEnd(TRACE_PREPROCESS);
+
+  return classifyWindow(signature);
+}
+
+void getInferenceResult()
+{
+  TfLiteTensor *output = interpreter->output(0);
+
   int max_index = 0;
   float max_value = output->data.f[0];
 
@@ -206,10 +490,6 @@ void getInferenceResult()
   for (int i = 0; i < label_count; ++i)
   {
     output_values[i] = output->data.f[i];
-    if (DEBUG_OUTPUT)
-    {
-      printf("%f ", output_values[i]);
-    }
     if (output_values[i] > max_value)
     {
       max_value = output_values[i];
@@ -221,58 +501,17 @@ void getInferenceResult()
   float softmax_values[label_count];
   applySoftmax(output_values, label_count, softmax_values);
 
-  printf("\n");
-  printf("Inference result: %s with confidence %.2f\n", labels[max_index], softmax_values[max_index]);
-  printf("\n");
-
-  if (DEBUG_OUTPUT)
+  LOG_INFO("Inference result: %s with confidence %.2f", labels[max_index], softmax_values[max_index]);
+  for (int i = 0; i < label_count; ++i)
   {
-    printf("\nRaw logits: ");
-    for (int i = 0; i < label_count; ++i)
-    {
-      printf("%d ", output_values[i]);
-    }
-    printf("\nSoftmax probabilities: ");
-    for (int i = 0; i < label_count; ++i)
-    {
-      printf("%.4f ", softmax_values[i]);
-    }
-    printf("\n");
+    LOG_DEBUG("%s: logit %f, probability %.4f", labels[i], output_values[i], softmax_values[i]);
   }
 }
 
+// Float exp() and, where the build has them, vector kernels (kernels.h)
 void applySoftmax(const float *output_values, size_t label_count, float *softmax_values)
 {
-  // Find maximum for numerical stability
-  float max_val = output_values[0];
-  for (size_t i = 0; i < label_count; i++)
-  {
-    if (output_values[i] > max_val)
-    {
-      max_val = output_values[i];
-    }
-  }
-
-  // Calculate exp() for each value and sum
-  float sum = 0.0f;
-  const float kMaxExponent = 88.0f; // ln(FLT_MAX) ≈ 88.72
-
-  for (size_t i = 0; i < label_count; i++)
-  {
-    // Prevent overflow by capping the exponent
-    float val = std::min(output_values[i] - max_val, kMaxExponent);
-    softmax_values[i] = exp(val);
-    sum += softmax_values[i];
-  }
-
-  // Prevent division by zero
-  sum = std::max(sum, 1e-9f);
-
-  // Normalize
-  for (size_t i = 0; i < label_count; i++)
-  {
-    softmax_values[i] /= sum;
-  }
+  kernelSoftmax(output_values, softmax_values, label_count);
 }
 
 /////////////////////////
@@ -352,14 +591,10 @@ void setupOutputLights()
   }
 }
 
+// Queues the LED pattern so it is applied by cuesUpdate() without blocking
 void outputLights(int index)
 {
-  uint8_t pins[7] = {D0, D1, D2, D3, D6, D7, D8};
-  for (int i = 0; i < 7; i++)
-  {
-    digitalWrite(pins[i], LOW);
-  }
-  digitalWrite(pins[index], HIGH);
+  cueLeds(index >= 0 && index < CUE_LED_COUNT ? 1 << index : 0);
 }
 
 
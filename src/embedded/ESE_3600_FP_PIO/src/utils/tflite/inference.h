@@ -4,8 +4,10 @@
 #define INFERENCE_H_
 
 #include "model.h"
+#include "model_registry.h"
 #include "pre_process.h"
 #include "main.h"
+#include "../hardware/cues.h"
 
 #include <TensorFlowLite_ESP32.h>
 #include <tensorflow/lite/micro/all_ops_resolver.h>
@@ -24,15 +26,66 @@ extern const char *full_label_classes[];
 
 extern int current_lift_idx;
 
-// Debug control
-extern const bool DEBUG_OUTPUT;
+// One head's softmax and class, absent when the resident model does not have that head
+struct HeadResult
+{
+  bool present;
+  int class_idx;
+  int class_count;
+  float probabilities[HEAD_MAX_CLASSES];
+};
 
-// Buffer to store IMU data - update to use template type selection
-extern float dataBuffer[];
+// Every head of the resident model from a single Invoke()
+struct InferenceResult
+{
+  bool valid; // false if no model is loaded or Invoke() failed, the heads then hold the previous result
+  unsigned long invoke_us;
+  HeadResult heads[MODEL_HEAD_COUNT];
+};
+
+// Name, class count and class labels of each head, indexed by ModelHead
+struct HeadSpec
+{
+  const char *name;
+  int classes;
+  const char *const *labels;
+};
+
+extern const HeadSpec head_specs[MODEL_HEAD_COUNT];
+
+// The most recent doInference() / doRepInference() result
+extern InferenceResult last_result;
+
+// Softmax and timing of the most recent doInference() call, the form head's (current_lift_idx is its class)
+extern float last_probabilities[];
+extern unsigned long last_inference_us;
+
+// Buffer to store IMU data, float or Q15 int16 depending on SAMPLE_INT16
+extern sample_t dataBuffer[];
 
 // Core inference functions
+// Loads current_lift's model (model_registry.h) and sets up the output lights
 void setupModel(bool verbose);
-void doInference();
+
+// Makes lift's model the resident one, replacing the previous model in the shared arena. A lift whose
+// model is already resident only becomes the active lift, unless reload. false if lift has no model or
+// its model fails to load, leaving the resident one (reloaded if it had been torn down).
+bool selectLiftModel(const char *lift, bool reload);
+
+// selectLiftModel() for an entry that need not be in the registry, e.g. a test fixture. entry must outlive
+// its time as the resident model.
+bool selectModel(const ModelEntry &entry, bool reload);
+const InferenceResult &doInference();
+
+// Classifies one rep: sample_count samples of dataBuffer, used as a ring, from first_sample on
+const InferenceResult &doRepInference(size_t first_sample, size_t sample_count);
+
+// Runs the interpreter on whatever the input tensor holds, for benchmarks
+bool invokeModel();
+
+// Tensor arena use after AllocateTensors(), 0 before the model is set up
+size_t tensorArenaUsedBytes();
+size_t tensorArenaSize();
 void getInferenceResult();
 
 // Data processing functions
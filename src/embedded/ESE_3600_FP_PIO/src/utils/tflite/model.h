@@ -1,8 +1,22 @@
 #ifndef MODEL_H_
 #define MODEL_H_
 
+// 1: setupModel() decodes model_packed.cpp (model_pack.h, generated by model_pack.py) into RAM once at
+// boot. 0: the interpreter maps model.cpp's array directly.
+#ifndef MODEL_PACKED
+#define MODEL_PACKED 1
+#endif
+
+// 1: decode the packed model into PSRAM, freeing its internal RAM at the cost of reading the weights
+// through the cache. Falls back to internal RAM without PSRAM.
+#ifndef MODEL_PSRAM
+#define MODEL_PSRAM 0
+#endif
+
 extern const unsigned char g_rep_mate_model_data[];
 extern const int g_rep_mate_model_data_len;
 
+extern const unsigned char g_rep_mate_model_packed[];
+extern const unsigned int g_rep_mate_model_packed_len;
+
 #endif // MODEL_H_
-  
\ No newline at end of file
@@ -0,0 +1,124 @@
+#include "model_pack.h"
+#include <Arduino.h>
+#include <string.h>
+
+static const uint8_t kMagic[3] = {'R', 'M', 'M'};
+
+ModelLoadStats model_load_stats = {};
+
+static inline uint32_t read_u32(const uint8_t *in)
+{
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+float halfToFloat(uint16_t half)
+{
+  uint32_t sign = (uint32_t)(half & 0x8000) << 16;
+  uint32_t exponent = (half >> 10) & 0x1F;
+  uint32_t mantissa = half & 0x3FF;
+  uint32_t bits;
+  if (exponent == 0x1F)
+  {
+    bits = sign | 0x7F800000 | (mantissa << 13); // Infinity, NaN keeps its payload
+  }
+  else if (exponent != 0)
+  {
+    bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+  }
+  else if (mantissa == 0)
+  {
+    bits = sign;
+  }
+  else
+  {
+    // Subnormal: normalize the mantissa, every binary16 subnormal is a normal float32
+    exponent = 127 - 15 + 1;
+    while (!(mantissa & 0x400))
+    {
+      mantissa <<= 1;
+      exponent--;
+    }
+    bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+  }
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+size_t modelPackedSize(const uint8_t *packed, size_t packed_len)
+{
+  if (packed_len < MODEL_PACK_HEADER_BYTES || memcmp(packed, kMagic, sizeof(kMagic)) != 0 ||
+      packed[3] != MODEL_PACK_VERSION)
+    return 0;
+  return read_u32(packed + 4);
+}
+
+bool modelUnpack(const uint8_t *packed, size_t packed_len, uint8_t *out, size_t out_len)
+{
+  if (modelPackedSize(packed, packed_len) != out_len || out_len == 0)
+    return false;
+  uint16_t chunk_count = packed[8] | (packed[9] << 8);
+
+  size_t in = MODEL_PACK_HEADER_BYTES, written = 0;
+  for (uint16_t chunk = 0; chunk < chunk_count; chunk++)
+  {
+    if (packed_len - in < MODEL_PACK_CHUNK_HEADER_BYTES)
+      return false;
+    uint8_t codec = packed[in];
+    uint32_t length = read_u32(packed + in + 1);
+    in += MODEL_PACK_CHUNK_HEADER_BYTES;
+    if (length > out_len - written)
+      return false;
+
+    uint8_t *dst = out + written;
+    if (codec == MODEL_CHUNK_COPY)
+    {
+      if (packed_len - in < length)
+        return false;
+      memcpy(dst, packed + in, length);
+      in += length;
+    }
+    else if (codec == MODEL_CHUNK_HALF)
+    {
+      if (length % 4 != 0 || packed_len - in < length / 2)
+        return false;
+      for (uint32_t i = 0; i < length / 4; i++, in += 2)
+      {
+        float value = halfToFloat(packed[in] | (packed[in + 1] << 8));
+        memcpy(dst + 4 * i, &value, sizeof(value)); // Flatbuffers are little-endian, as both targets are
+      }
+    }
+    else if (codec == MODEL_CHUNK_ZERO)
+    {
+      memset(dst, 0, length);
+    }
+    else
+    {
+      return false;
+    }
+    written += length;
+  }
+  return written == out_len && in == packed_len;
+}
+
+void modelLoadReport(Print &out, size_t arena_size)
+{
+  const ModelLoadStats &stats = model_load_stats;
+  if (stats.lift == nullptr)
+  {
+    out.println("Model not loaded");
+    return;
+  }
+  if (stats.packed)
+    out.printf("Model: %s, packed, %lu bytes stored, %lu decoded (%.2fx) into %s in %lu us\n", stats.lift,
+               (unsigned long)stats.stored_bytes, (unsigned long)stats.model_bytes,
+               (double)stats.model_bytes / stats.stored_bytes, stats.external ? "PSRAM" : "internal RAM",
+               (unsigned long)stats.decode_us);
+  else
+    out.printf("Model: %s, raw, %lu bytes mapped from model.cpp\n", stats.lift, (unsigned long)stats.model_bytes);
+  out.printf("Loads: %lu, last %lu us (decode %lu us, AllocateTensors %lu us), max %lu us; %lu lift switches\n",
+             (unsigned long)stats.loads, (unsigned long)stats.load_us, (unsigned long)stats.decode_us,
+             (unsigned long)stats.allocate_us, (unsigned long)stats.max_load_us, (unsigned long)stats.switches);
+  out.printf("Resident: %lu byte model buffer, arena peak %lu of %lu bytes\n", (unsigned long)stats.buffer_bytes,
+             (unsigned long)stats.arena_peak, (unsigned long)arena_size);
+}
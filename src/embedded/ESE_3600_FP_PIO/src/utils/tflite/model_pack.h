@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Packed model container, written by model_pack.py and decoded once by setupModel().
+// The float32 weight buffers are stored as IEEE half floats, runs of zeros (padding, zero biases) as
+// their length and everything else, the flatbuffer structure, as is. Decoding gives back a flatbuffer
+// with every offset unchanged, only the weights rounded to half precision.
+//
+// Stream: "RMM" | version (u8) | model_bytes (u32) | chunk_count (u16) | chunks
+// Chunk:  codec (u8) | decoded_bytes (u32) | payload
+// Payload: COPY decoded_bytes bytes, HALF decoded_bytes / 2 bytes (little-endian binary16), ZERO none.
+
+class Print;
+
+const uint8_t MODEL_PACK_VERSION = 1;
+const size_t MODEL_PACK_HEADER_BYTES = 3 + 1 + 4 + 2;
+const size_t MODEL_PACK_CHUNK_HEADER_BYTES = 1 + 4;
+
+// TFLite Micro wants the model buffer aligned for its widest tensor type
+const size_t MODEL_ALIGNMENT = 16;
+
+enum ModelChunkCodec : uint8_t
+{
+  MODEL_CHUNK_COPY = 0,
+  MODEL_CHUNK_HALF = 1,
+  MODEL_CHUNK_ZERO = 2,
+};
+
+// Decoded size from the header, 0 if packed is not a version 1 container
+size_t modelPackedSize(const uint8_t *packed, size_t packed_len);
+
+// Decodes packed into out (modelPackedSize() bytes), false if the stream is corrupt or does not fill
+// out exactly
+bool modelUnpack(const uint8_t *packed, size_t packed_len, uint8_t *out, size_t out_len);
+
+// Binary16 to float32, exact for every input including subnormals, infinities and NaN
+float halfToFloat(uint16_t half);
+
+// How the resident model was loaded, for the "model" console command
+struct ModelLoadStats
+{
+  const char *lift;       // Active lift, nullptr before setupModel() or while no model is resident
+  bool packed;            // Decoded from the packed container, or mapped from model.cpp
+  bool external;          // Decoded into PSRAM
+  uint32_t stored_bytes;  // In flash
+  uint32_t model_bytes;   // The flatbuffer the interpreter runs
+  uint32_t buffer_bytes;  // Shared decode buffer, sized for the largest registered model (0 unpacked)
+  uint32_t decode_us;     // Last modelUnpack() alone
+  uint32_t allocate_us;   // Last AllocateTensors() alone
+  uint32_t load_us;       // Last load: decode, interpreter and AllocateTensors()
+  uint32_t max_load_us;
+  uint32_t loads;         // Models set up since boot, the first by setupModel()
+  uint32_t switches;      // Lift changes, with or without a load
+  uint32_t arena_peak;    // Most of tensor_arena any loaded model used
+};
+
+extern ModelLoadStats model_load_stats;
+
+void modelLoadReport(Print &out, size_t arena_size);
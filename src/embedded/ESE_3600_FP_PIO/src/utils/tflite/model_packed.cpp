@@ -0,0 +1,4014 @@
+// Generated by model_pack.py from src/utils/tflite/model.cpp, do not edit.
+// Packed model container, see model_pack.h.
+#include "model.h"
+
+alignas(4) const unsigned char g_rep_mate_model_packed[] = {
+    0x52, 0x4d, 0x4d, 0x01, 0x48, 0x4d, 0x01, 0x00, 0x11, 0x00, 0x00, 0x18,
+    0x09, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14,
+    0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x0c,
+    0x2d, 0x01, 0x00, 0x1c, 0x2d, 0x01, 0x00, 0x78, 0x4c, 0x01, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x92,
+    0xcd, 0xfe, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69,
+    0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0x35,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f,
+    0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x82, 0xd2, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x72, 0x61, 0x73,
+    0x5f, 0x74, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc,
+    0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f,
+    0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x37,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d,
+    0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76,
+    0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00, 0x39, 0x00, 0x00, 0x00, 0x24,
+    0x2c, 0x01, 0x00, 0x1c, 0x2c, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0xe4,
+    0x2b, 0x01, 0x00, 0xc8, 0x2b, 0x01, 0x00, 0xac, 0x2b, 0x01, 0x00, 0x90,
+    0x2b, 0x01, 0x00, 0x80, 0x0b, 0x01, 0x00, 0x30, 0x0b, 0x01, 0x00, 0x20,
+    0x4b, 0x00, 0x00, 0x90, 0x4a, 0x00, 0x00, 0x80, 0x1a, 0x00, 0x00, 0x70,
+    0x19, 0x00, 0x00, 0xe0, 0x17, 0x00, 0x00, 0xd0, 0x0f, 0x00, 0x00, 0xc0,
+    0x07, 0x00, 0x00, 0x98, 0x07, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0xb8,
+    0x06, 0x00, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x50,
+    0x03, 0x00, 0x00, 0xc0, 0x02, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x60,
+    0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x48,
+    0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x30,
+    0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x18,
+    0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe8,
+    0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xd0,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xa0,
+    0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x88,
+    0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe2,
+    0xd3, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x36, 0x2e, 0x32, 0x00, 0x00, 0x42,
+    0xd4, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31,
+    0x2e, 0x31, 0x30, 0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xb5, 0xfe, 0xff, 0x64, 0xb5, 0xfe, 0xff, 0x68,
+    0xb5, 0xfe, 0xff, 0x6c, 0xb5, 0xfe, 0xff, 0x70, 0xb5, 0xfe, 0xff, 0x74,
+    0xb5, 0xfe, 0xff, 0x78, 0xb5, 0xfe, 0xff, 0x7c, 0xb5, 0xfe, 0xff, 0x80,
+    0xb5, 0xfe, 0xff, 0x84, 0xb5, 0xfe, 0xff, 0x88, 0xb5, 0xfe, 0xff, 0x8c,
+    0xb5, 0xfe, 0xff, 0x90, 0xb5, 0xfe, 0xff, 0x94, 0xb5, 0xfe, 0xff, 0x98,
+    0xb5, 0xfe, 0xff, 0x9c, 0xb5, 0xfe, 0xff, 0xa0, 0xb5, 0xfe, 0xff, 0xa4,
+    0xb5, 0xfe, 0xff, 0xa8, 0xb5, 0xfe, 0xff, 0xac, 0xb5, 0xfe, 0xff, 0xb0,
+    0xb5, 0xfe, 0xff, 0xb4, 0xb5, 0xfe, 0xff, 0xb8, 0xb5, 0xfe, 0xff, 0xbc,
+    0xb5, 0xfe, 0xff, 0xc0, 0xb5, 0xfe, 0xff, 0xc4, 0xb5, 0xfe, 0xff, 0xc8,
+    0xb5, 0xfe, 0xff, 0xca, 0xd4, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xc9, 0xbe, 0xa4, 0x3c, 0x17, 0x2d, 0x10, 0x3e, 0x94,
+    0xad, 0x55, 0x3d, 0x44, 0x04, 0xed, 0x3b, 0xc9, 0xd0, 0x73, 0x3d, 0x6f,
+    0x60, 0x07, 0x3e, 0x38, 0x06, 0x46, 0x3d, 0x38, 0xe1, 0xc4, 0x3d, 0xc3,
+    0x41, 0xa4, 0x3c, 0xf4, 0x19, 0xda, 0xbd, 0xda, 0xe2, 0x99, 0x3c, 0x39,
+    0x09, 0x1a, 0xbd, 0x72, 0x7f, 0xe8, 0x3d, 0xb7, 0x54, 0x03, 0xbe, 0x67,
+    0x3d, 0x8c, 0x3d, 0xe5, 0xa6, 0xb4, 0x3d, 0x16, 0xd5, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x65, 0xb9, 0x46, 0xbc, 0x4f,
+    0x15, 0x87, 0xbc, 0x88, 0x17, 0x36, 0xbd, 0xf2, 0x08, 0xd7, 0xbc, 0x00,
+    0x00, 0x00, 0x00, 0x9a, 0xce, 0xd4, 0xbb, 0x94, 0xa4, 0xa3, 0xba, 0x24,
+    0x79, 0xf4, 0x39, 0xf1, 0xf9, 0x21, 0xbd, 0xee, 0x53, 0xed, 0x38, 0x84,
+    0x28, 0x0c, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2c, 0xf2, 0x3d, 0xfd,
+    0xb5, 0xd7, 0xbc, 0x35, 0xd0, 0x72, 0xbc, 0xad, 0x5b, 0xd8, 0xbb, 0x1b,
+    0x23, 0xdd, 0x3d, 0xa6, 0x63, 0xb3, 0x3a, 0x0a, 0x49, 0xb2, 0xbd, 0xeb,
+    0x97, 0xa1, 0x3c, 0x19, 0x26, 0x32, 0xbc, 0x6b, 0x39, 0x84, 0xbc, 0x00,
+    0x00, 0x00, 0x00, 0x4d, 0x58, 0xf5, 0xbb, 0x54, 0x2c, 0x4b, 0x3c, 0xdf,
+    0x67, 0xc3, 0xbc, 0xd8, 0x15, 0x25, 0xbb, 0x95, 0x74, 0x4b, 0x3d, 0x37,
+    0x20, 0x9b, 0xbc, 0x37, 0x2a, 0x6b, 0xbd, 0x0d, 0xe0, 0x0e, 0xbc, 0x08,
+    0x04, 0x8a, 0xba, 0x2f, 0x4c, 0x76, 0x3d, 0x7c, 0xa8, 0x0c, 0x3e, 0xbb,
+    0x20, 0x15, 0xbd, 0x72, 0x04, 0x4d, 0xbb, 0x82, 0x05, 0x59, 0xbc, 0x00,
+    0x00, 0x00, 0x00, 0x89, 0x58, 0x19, 0xbc, 0x0b, 0xa2, 0xe0, 0xbc, 0x74,
+    0xe3, 0x11, 0xbc, 0x82, 0x8a, 0x4a, 0xbb, 0xbd, 0x50, 0xe0, 0xbc, 0x6e,
+    0x1c, 0xbf, 0x3a, 0x65, 0x8b, 0xa5, 0xbb, 0xe5, 0xda, 0x19, 0x3d, 0x52,
+    0xa7, 0xc6, 0xbc, 0xfa, 0xbe, 0x2f, 0xbb, 0x11, 0xdd, 0xf4, 0xbd, 0x00,
+    0x00, 0x00, 0x00, 0xe7, 0xfb, 0x42, 0x3d, 0x7f, 0x0c, 0x84, 0x3d, 0x4b,
+    0xc1, 0xac, 0xbd, 0xc3, 0xfd, 0x0a, 0xbc, 0x2c, 0xf8, 0x13, 0xbc, 0xa5,
+    0xc3, 0x08, 0xbb, 0x9c, 0x62, 0x4b, 0xbc, 0x5f, 0xa0, 0x9a, 0x3d, 0x00,
+    0x00, 0x00, 0x00, 0x53, 0xa2, 0x8b, 0x3c, 0x8d, 0xcd, 0x03, 0x3d, 0x03,
+    0xd7, 0xf8, 0xbc, 0x07, 0x83, 0x46, 0x3c, 0xc7, 0xe6, 0x2d, 0xbc, 0x22,
+    0xd6, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x93,
+    0x2d, 0xd5, 0xbc, 0xba, 0x8f, 0x87, 0xbd, 0xc7, 0xe8, 0xf3, 0xbc, 0xc5,
+    0x27, 0xd9, 0xbd, 0x3d, 0x80, 0xcd, 0xbb, 0xd8, 0x9a, 0x03, 0x3e, 0x93,
+    0xe0, 0x82, 0x3d, 0xc2, 0xe6, 0x05, 0x3d, 0xd8, 0x31, 0xbb, 0xbd, 0xec,
+    0x3b, 0x34, 0x3d, 0x4a, 0x5d, 0x40, 0x3d, 0x1a, 0x95, 0xc8, 0xbd, 0x7a,
+    0xe1, 0x9b, 0xbd, 0xd6, 0xad, 0xc2, 0xbd, 0x9d, 0xf6, 0x0f, 0xbd, 0x8e,
+    0x56, 0x11, 0x3d, 0xf1, 0xce, 0x37, 0xbc, 0xc2, 0x98, 0x8b, 0xbe, 0x69,
+    0xfd, 0x3e, 0xbe, 0x69, 0x05, 0x33, 0xbd, 0x8e, 0x6e, 0xdd, 0xbd, 0x59,
+    0x66, 0x50, 0xbe, 0x0a, 0xdb, 0x10, 0xbd, 0xeb, 0xe1, 0xbe, 0xbd, 0xf3,
+    0x0f, 0x7d, 0xbd, 0x12, 0x74, 0xca, 0xbd, 0x80, 0xd2, 0x8e, 0x3d, 0x7f,
+    0x2c, 0x65, 0xbe, 0xca, 0x5e, 0x3b, 0xbe, 0xd2, 0x7f, 0x5a, 0xbd, 0x62,
+    0x27, 0x15, 0xbd, 0x6f, 0x3c, 0x98, 0xbc, 0xae, 0xd6, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xac, 0xf5, 0xd5, 0x3d, 0xe1,
+    0x7e, 0x78, 0xbd, 0xd4, 0xa1, 0xfd, 0xc0, 0x4f, 0x4c, 0x55, 0x3b, 0xa2,
+    0x68, 0xbf, 0xbd, 0x5d, 0x1f, 0x66, 0xc1, 0x58, 0xe0, 0x32, 0x3d, 0xe0,
+    0xce, 0xc0, 0xbd, 0x04, 0xc5, 0x42, 0xc1, 0xfa, 0xd4, 0x0c, 0xbd, 0xf2,
+    0x3f, 0xef, 0x3d, 0xe1, 0x59, 0x86, 0xbd, 0x48, 0xf0, 0x94, 0xc0, 0x94,
+    0x63, 0xab, 0xbd, 0x1d, 0x44, 0x1a, 0xc1, 0x99, 0x9e, 0xf6, 0x3d, 0x25,
+    0x1a, 0x43, 0xc0, 0x10, 0x1c, 0x06, 0x39, 0x9f, 0x2f, 0xf6, 0xbd, 0x74,
+    0xf9, 0xb6, 0x3b, 0x29, 0xa8, 0x10, 0x3e, 0xdc, 0xde, 0x9f, 0x3d, 0xf3,
+    0x82, 0xc2, 0x3d, 0xa3, 0x8d, 0x8f, 0x3d, 0x91, 0xfa, 0x1b, 0xc1, 0x14,
+    0x82, 0x1d, 0x3c, 0x31, 0xef, 0xab, 0xbd, 0xad, 0xd5, 0x81, 0xc0, 0x7a,
+    0x96, 0x53, 0x3c, 0xd5, 0x9a, 0x55, 0xc1, 0x1a, 0x15, 0xef, 0xbc, 0x6c,
+    0x1c, 0x30, 0xc0, 0xde, 0x87, 0x35, 0xc0, 0x2d, 0x3e, 0x97, 0xc0, 0x8a,
+    0x0a, 0x3b, 0xbd, 0xe7, 0x55, 0x94, 0x3d, 0x0d, 0x5a, 0x6a, 0xbd, 0x46,
+    0xa1, 0x45, 0x3c, 0x62, 0x4b, 0xa8, 0xc0, 0x20, 0x30, 0x49, 0x3d, 0xdf,
+    0x3d, 0x0a, 0xbe, 0xc5, 0x55, 0xb1, 0xbd, 0x97, 0x80, 0x85, 0x3c, 0x94,
+    0xbf, 0xf2, 0x3b, 0x11, 0xeb, 0xc1, 0x3d, 0x3d, 0x53, 0x8a, 0xc0, 0x7d,
+    0xa0, 0xd9, 0x3b, 0x6d, 0x83, 0x23, 0x3d, 0xa9, 0x38, 0x0f, 0xbf, 0x6d,
+    0x3a, 0xeb, 0x3d, 0x1d, 0x5d, 0x93, 0xc0, 0x73, 0x88, 0xba, 0xc0, 0x3e,
+    0xd8, 0x8d, 0x3d, 0xd5, 0x7f, 0x28, 0xbd, 0x3a, 0xde, 0x6f, 0xbb, 0x5e,
+    0x34, 0x81, 0xc1, 0x21, 0xfb, 0x74, 0xbd, 0x3f, 0x48, 0x27, 0xc0, 0x35,
+    0xc6, 0xf8, 0x3d, 0xae, 0xe3, 0x9d, 0xc0, 0x3c, 0xf5, 0x68, 0xc0, 0x43,
+    0x9f, 0x71, 0x3c, 0xc0, 0xb5, 0x1d, 0xc0, 0x2d, 0xbf, 0x15, 0xc1, 0xba,
+    0xd7, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x57,
+    0x1f, 0xfa, 0x41, 0x84, 0x48, 0x04, 0x42, 0xdd, 0x62, 0x55, 0x41, 0x3a,
+    0x5c, 0x09, 0x42, 0xb2, 0xfa, 0xfb, 0x41, 0xe7, 0x8d, 0x0b, 0x41, 0xff,
+    0x57, 0xfb, 0x41, 0xba, 0x80, 0xb4, 0x41, 0xca, 0xef, 0x26, 0x41, 0x9f,
+    0x13, 0xf8, 0x41, 0x0c, 0x41, 0xfa, 0x41, 0xb2, 0xfa, 0xfb, 0x41, 0xc3,
+    0xb2, 0x70, 0x41, 0x90, 0xa7, 0xf8, 0x41, 0x57, 0x57, 0x79, 0x41, 0xb5,
+    0x5a, 0xfa, 0x41, 0x99, 0xc1, 0x22, 0x41, 0x2d, 0x64, 0xf6, 0x41, 0x0d,
+    0xd3, 0xfc, 0x41, 0xcd, 0x43, 0x03, 0x42, 0x05, 0x83, 0xfa, 0x41, 0x4e,
+    0x5f, 0xfa, 0x41, 0xb2, 0xfa, 0xfb, 0x41, 0xac, 0xb1, 0xf9, 0x41, 0x45,
+    0xfc, 0x58, 0x41, 0x7c, 0xb0, 0xe2, 0x41, 0xb2, 0xa1, 0xfd, 0x41, 0x7d,
+    0xd9, 0x07, 0x41, 0xb4, 0xc8, 0xf2, 0x41, 0x2d, 0x33, 0x27, 0x41, 0x73,
+    0x1f, 0xfa, 0x41, 0x2e, 0x2c, 0x39, 0x41, 0xec, 0xd3, 0x20, 0x41, 0x83,
+    0xd2, 0x59, 0x41, 0x34, 0x78, 0xf8, 0x41, 0x8b, 0x9c, 0xf8, 0x41, 0xba,
+    0x37, 0xf9, 0x41, 0xb2, 0xfa, 0xfb, 0x41, 0x5c, 0xdb, 0x6a, 0x41, 0x50,
+    0x78, 0xf6, 0x41, 0x41, 0xf0, 0x06, 0x42, 0xe2, 0xcb, 0xf9, 0x41, 0xc8,
+    0xf0, 0x01, 0x42, 0x25, 0x58, 0x13, 0x42, 0x76, 0xdd, 0xfa, 0x41, 0xbf,
+    0xd3, 0x23, 0x41, 0xd3, 0x44, 0x05, 0x42, 0x59, 0xf1, 0xfa, 0x41, 0x17,
+    0x31, 0x5c, 0x41, 0xb2, 0xfa, 0xfb, 0x41, 0xa6, 0xc8, 0x37, 0x41, 0x44,
+    0x4b, 0x2c, 0x41, 0x2d, 0x95, 0xe4, 0x41, 0xf1, 0xe1, 0xf6, 0x41, 0xcd,
+    0x19, 0xf9, 0x41, 0x06, 0xb6, 0x38, 0x41, 0xe8, 0x2a, 0x01, 0x42, 0xa3,
+    0x87, 0xc3, 0x40, 0xb2, 0xfa, 0xfb, 0x41, 0xe0, 0x22, 0x77, 0x41, 0x92,
+    0x22, 0x28, 0x41, 0x2c, 0xbf, 0xee, 0x41, 0xe7, 0x8a, 0x1f, 0x41, 0x32,
+    0x41, 0x2a, 0x41, 0xc6, 0xd8, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0x00, 0x00, 0x20, 0x13, 0x96, 0xbf, 0x40, 0xed, 0x82, 0xbf, 0x79,
+    0x28, 0xce, 0xbf, 0xc2, 0x80, 0x45, 0xbf, 0xd6, 0x3e, 0x7b, 0xbf, 0x51,
+    0xff, 0xae, 0xbf, 0x46, 0x10, 0xaf, 0xbf, 0xf5, 0x7c, 0xa5, 0xbf, 0xaa,
+    0x36, 0x70, 0xbf, 0x35, 0x20, 0xae, 0xbf, 0x36, 0x04, 0x88, 0xbf, 0xfb,
+    0xdf, 0x5a, 0xbf, 0x94, 0x6d, 0x6b, 0xbf, 0xf8, 0x41, 0x82, 0xbf, 0xc2,
+    0x92, 0x82, 0xbf, 0x8e, 0x32, 0x5c, 0xbf, 0x21, 0x19, 0xa9, 0xbf, 0x54,
+    0xd7, 0x3d, 0xbf, 0xa2, 0x1d, 0x38, 0xbf, 0xf2, 0x0f, 0x81, 0xbf, 0x0d,
+    0xed, 0x3f, 0xbf, 0x4e, 0x5f, 0x45, 0xbf, 0xc6, 0x3a, 0x48, 0xbf, 0x7b,
+    0x09, 0x5f, 0xbf, 0x90, 0xdf, 0x31, 0xbf, 0x85, 0x1e, 0x56, 0xbf, 0x7c,
+    0xaf, 0xa8, 0xbf, 0x3b, 0x33, 0x44, 0xbf, 0x05, 0xaf, 0x5e, 0xbf, 0xb2,
+    0x66, 0x86, 0xbf, 0x7e, 0x7b, 0x3c, 0xbf, 0x2d, 0x2d, 0xa1, 0xbf, 0x52,
+    0xd9, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xcf,
+    0xee, 0x27, 0x3f, 0xb6, 0x19, 0x40, 0x3f, 0x97, 0xd0, 0x33, 0x3f, 0x46,
+    0x41, 0x35, 0x3f, 0x55, 0xe0, 0x1d, 0x3f, 0x4d, 0x33, 0x2b, 0x3f, 0x47,
+    0x67, 0x54, 0x3f, 0xf0, 0x86, 0x4d, 0x3f, 0x8d, 0xc6, 0x6a, 0x3f, 0x3c,
+    0xaf, 0x27, 0x3f, 0xc5, 0x6a, 0x1d, 0x3f, 0x33, 0xba, 0x4b, 0x3f, 0x2c,
+    0x66, 0x1d, 0x3f, 0xcf, 0x3f, 0x32, 0x3f, 0x93, 0xfc, 0x1c, 0x3f, 0xa2,
+    0xe4, 0x04, 0x3f, 0xae, 0x5b, 0x52, 0x3f, 0x00, 0xe6, 0xa4, 0x3f, 0xb5,
+    0x3b, 0x6a, 0x3f, 0x33, 0xfa, 0x53, 0x3f, 0x28, 0x70, 0x1f, 0x3f, 0x22,
+    0x24, 0x6b, 0x3f, 0xa0, 0xb1, 0x06, 0x3f, 0xaa, 0xdc, 0x4d, 0x3f, 0xbb,
+    0xda, 0x31, 0x3f, 0xb3, 0xf3, 0x31, 0x3f, 0x53, 0x0e, 0x36, 0x3f, 0x6c,
+    0x15, 0x55, 0x3f, 0x70, 0xe8, 0xd1, 0x3f, 0x43, 0xf5, 0x56, 0x3f, 0x9f,
+    0xd9, 0x24, 0x3f, 0x7e, 0xa1, 0x44, 0x3f, 0xde, 0xd9, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xee,
+    0xd9, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xfd,
+    0xff, 0xff, 0xff, 0xfe, 0xd9, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x47, 0x0f, 0xf2, 0x3c, 0xce, 0x2f, 0x06, 0xbe, 0x68,
+    0xf5, 0xae, 0x3d, 0xa7, 0x01, 0xe8, 0x3d, 0x4c, 0x61, 0x79, 0x3c, 0x5b,
+    0xc6, 0xd5, 0x3d, 0x70, 0xed, 0x81, 0x3c, 0xd0, 0x96, 0x1a, 0xbe, 0x85,
+    0x4c, 0xa5, 0xbd, 0x12, 0x41, 0xb0, 0xbd, 0xc5, 0xbf, 0x26, 0x3e, 0xcf,
+    0xa0, 0x68, 0xbb, 0x32, 0x7e, 0x8b, 0xbc, 0x5d, 0xea, 0xda, 0x3c, 0xcf,
+    0xae, 0x04, 0xbe, 0xf6, 0x10, 0xad, 0xbc, 0x4a, 0xda, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0xcd, 0x95, 0x4e, 0x3c, 0x04,
+    0xd2, 0xe8, 0xbd, 0xfc, 0xe2, 0xc1, 0x3b, 0xbd, 0xf3, 0x36, 0x3d, 0x09,
+    0x60, 0x41, 0x3c, 0x81, 0x16, 0xa2, 0xbd, 0x55, 0x63, 0xa1, 0xbd, 0xad,
+    0x14, 0x9c, 0x3b, 0xdd, 0xca, 0x79, 0x3d, 0xa6, 0x26, 0xee, 0xbc, 0x23,
+    0xb8, 0x40, 0x3d, 0xea, 0x6a, 0x27, 0xbd, 0x89, 0xa8, 0xdf, 0x3d, 0x6d,
+    0xff, 0xe1, 0xbc, 0x01, 0xf5, 0x07, 0x3e, 0xce, 0x89, 0xba, 0xbd, 0x80,
+    0x5d, 0xc9, 0xbc, 0x41, 0xd5, 0x99, 0x3d, 0x86, 0x40, 0xb7, 0x3d, 0x0f,
+    0xf9, 0x0a, 0x3e, 0x02, 0x28, 0x74, 0x3d, 0x74, 0x5e, 0x91, 0x3d, 0xf1,
+    0x15, 0x2e, 0x3d, 0x65, 0x33, 0x19, 0xbd, 0xec, 0x31, 0x5f, 0xbc, 0x80,
+    0xed, 0xf0, 0x3c, 0xa0, 0x11, 0xd5, 0x3d, 0x0f, 0x59, 0xce, 0x3d, 0xaa,
+    0xe3, 0x36, 0x3c, 0x5b, 0xf7, 0x58, 0xbd, 0xc5, 0xaa, 0x76, 0xbd, 0xfc,
+    0x2f, 0xd4, 0xbc, 0xd6, 0xda, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0xd8, 0x6a, 0xaf, 0xbf, 0xc0, 0x84, 0x4c, 0xbf, 0x0e,
+    0x49, 0x21, 0x3e, 0x64, 0x6c, 0xea, 0x3e, 0xa7, 0x33, 0x07, 0x3f, 0x98,
+    0x51, 0xe4, 0x3e, 0xfa, 0xda, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0xbd, 0x37, 0x79, 0x1a,
+    0x10, 0x2c, 0xf6, 0xb5, 0x78, 0x2a, 0x3c, 0x2b, 0x6c, 0xaf, 0xa6, 0x32,
+    0xd2, 0x2d, 0x75, 0xb4, 0x93, 0xb4, 0x1c, 0x38, 0x71, 0x2d, 0x2d, 0xa2,
+    0xac, 0xb3, 0xbb, 0xb8, 0x89, 0x38, 0x51, 0xb8, 0xd0, 0xaf, 0x56, 0xa9,
+    0x49, 0x2d, 0xbe, 0xb4, 0xcb, 0x36, 0x9e, 0xae, 0xfc, 0xaf, 0x59, 0xb2,
+    0xc9, 0xb7, 0xf7, 0x26, 0x7b, 0x29, 0x1e, 0x38, 0xad, 0x31, 0x47, 0xb4,
+    0xb1, 0xa4, 0x4e, 0x30, 0x83, 0x2c, 0x8f, 0xb9, 0xd5, 0xaf, 0x56, 0x31,
+    0x08, 0xb4, 0x52, 0x37, 0xae, 0x36, 0x9c, 0xb8, 0xd5, 0x29, 0x4c, 0x32,
+    0x19, 0xad, 0x25, 0x33, 0x5a, 0x35, 0xf9, 0xb5, 0x79, 0xaa, 0x30, 0x35,
+    0xe4, 0xb5, 0x32, 0xb2, 0x3a, 0x38, 0xd2, 0x9d, 0x9f, 0x20, 0xf0, 0x27,
+    0x0b, 0x34, 0x4c, 0xb5, 0x6b, 0xad, 0x8a, 0x34, 0xac, 0x30, 0x02, 0x25,
+    0x8e, 0x2c, 0xae, 0xa9, 0x21, 0x31, 0xc7, 0x35, 0xd8, 0x30, 0x1d, 0xb9,
+    0x0c, 0x31, 0x9f, 0x27, 0x20, 0xb5, 0x1f, 0x35, 0x12, 0x36, 0x37, 0x36,
+    0xfc, 0x2e, 0xe2, 0xa5, 0x81, 0x35, 0x85, 0x31, 0xef, 0x29, 0x12, 0xac,
+    0x23, 0x33, 0xa0, 0x34, 0xe9, 0xb0, 0xb6, 0xbb, 0x81, 0xb1, 0x89, 0xb5,
+    0x8b, 0xb9, 0xfe, 0x34, 0x3f, 0x2c, 0xdf, 0xb3, 0xc6, 0xb8, 0x3e, 0x36,
+    0xc5, 0x9f, 0xd5, 0xb4, 0x8b, 0xb8, 0xcb, 0xaa, 0xb1, 0xb5, 0xec, 0xae,
+    0x73, 0x28, 0x99, 0xb3, 0x9b, 0x30, 0xe8, 0xb5, 0x1b, 0xb5, 0x0a, 0xb5,
+    0x3a, 0x32, 0x23, 0xb5, 0x13, 0xb5, 0x0a, 0x31, 0x5d, 0xa4, 0x86, 0xb2,
+    0xc6, 0xae, 0x44, 0x30, 0x18, 0x29, 0x13, 0xb7, 0x2d, 0xa9, 0x4f, 0x37,
+    0x7a, 0x1e, 0xbc, 0x32, 0x6f, 0x37, 0x6b, 0xb7, 0x65, 0xb4, 0xb5, 0xae,
+    0x8f, 0xac, 0xa1, 0x2e, 0x32, 0x36, 0xeb, 0xb1, 0x83, 0xb4, 0xd9, 0x34,
+    0xbf, 0xb4, 0x9a, 0x33, 0x41, 0x35, 0xd9, 0x30, 0x79, 0x2d, 0x49, 0xac,
+    0x45, 0xb4, 0xa9, 0x30, 0x71, 0xac, 0x3b, 0xac, 0x1a, 0xac, 0xc7, 0x31,
+    0x58, 0x2f, 0x5d, 0xae, 0x64, 0x2b, 0x72, 0x32, 0x6c, 0x2d, 0x3d, 0xb5,
+    0xfa, 0xb5, 0xe2, 0x2d, 0xca, 0x25, 0x73, 0x2f, 0xb5, 0x25, 0x2a, 0xa6,
+    0xcc, 0x36, 0x86, 0x36, 0xb5, 0xb1, 0x74, 0x32, 0x20, 0xb7, 0x00, 0x31,
+    0xa0, 0x2f, 0x0b, 0x2c, 0xbb, 0xb1, 0xcd, 0xb3, 0x90, 0xb4, 0xcf, 0x33,
+    0x0b, 0x3a, 0x1c, 0xb4, 0x8b, 0xb3, 0xa0, 0xb7, 0xb6, 0xb2, 0xa9, 0xb3,
+    0x28, 0x31, 0x6b, 0x27, 0x31, 0x34, 0x93, 0xb4, 0xb4, 0x14, 0x03, 0x2b,
+    0x10, 0x33, 0xc5, 0xb1, 0x06, 0xb2, 0x2c, 0x36, 0xbd, 0xb4, 0x12, 0xb6,
+    0xf2, 0x37, 0x2a, 0xb0, 0xc0, 0xb5, 0x89, 0x9c, 0xfb, 0xaf, 0xba, 0xb6,
+    0x35, 0xb0, 0x34, 0x36, 0x18, 0x31, 0xfd, 0xb0, 0xf5, 0x33, 0x01, 0xb4,
+    0xc6, 0x27, 0x5b, 0x32, 0x93, 0x35, 0x56, 0xb2, 0x44, 0x26, 0x9a, 0xb1,
+    0x23, 0x35, 0x38, 0x38, 0x86, 0x2e, 0x2e, 0xb3, 0xce, 0xab, 0x87, 0x34,
+    0x01, 0xaa, 0x2c, 0xb2, 0xf4, 0x32, 0x7d, 0x33, 0xc4, 0x33, 0x57, 0x2c,
+    0xf7, 0x26, 0xee, 0xa3, 0xd3, 0xb6, 0x61, 0xb4, 0x70, 0x35, 0x07, 0x39,
+    0xb8, 0x30, 0x48, 0x30, 0xbf, 0xb5, 0xad, 0xae, 0x97, 0xb1, 0x34, 0xb4,
+    0xa4, 0xb5, 0x6f, 0x34, 0xfe, 0x36, 0x41, 0x9a, 0x9a, 0x33, 0xf2, 0x34,
+    0xd0, 0x34, 0x50, 0x24, 0xfa, 0xb2, 0x55, 0xb5, 0x10, 0x25, 0xaf, 0xb5,
+    0x95, 0x35, 0x2d, 0x25, 0xb2, 0x2a, 0x87, 0x36, 0x19, 0x36, 0xb2, 0x35,
+    0xd6, 0xab, 0xba, 0xb9, 0xe5, 0xb5, 0x28, 0xb1, 0x27, 0xb9, 0xcc, 0xb2,
+    0x1e, 0x35, 0xf8, 0xac, 0x39, 0xb5, 0x0e, 0x36, 0x75, 0x30, 0x00, 0xb0,
+    0x57, 0xba, 0xa8, 0xb5, 0x6a, 0xb0, 0x32, 0xb1, 0x18, 0x37, 0x6b, 0x37,
+    0x5b, 0xb8, 0xfc, 0xaf, 0xa1, 0x34, 0x85, 0xad, 0x1f, 0xb2, 0xd6, 0xb5,
+    0xf4, 0xb5, 0xd8, 0xa7, 0x90, 0xa8, 0xe4, 0x29, 0x72, 0xa4, 0xcd, 0x38,
+    0x54, 0xac, 0xfb, 0xb0, 0x2b, 0xb3, 0x91, 0x34, 0x60, 0x35, 0xeb, 0xb4,
+    0xe2, 0xb4, 0x08, 0xb7, 0x7a, 0xa6, 0xf9, 0x95, 0x1a, 0x36, 0x8c, 0x34,
+    0x59, 0xb0, 0x13, 0x30, 0x6c, 0xb4, 0x0d, 0xae, 0x1a, 0xb1, 0xaa, 0xb3,
+    0x60, 0xb6, 0x18, 0x30, 0x2a, 0x39, 0x94, 0xb5, 0x22, 0xb3, 0xc5, 0xb6,
+    0x56, 0xa4, 0x06, 0xaa, 0x4c, 0x34, 0xd7, 0xac, 0xb9, 0x28, 0x43, 0x24,
+    0x2a, 0xb6, 0x4c, 0x32, 0x4d, 0xb0, 0x08, 0x37, 0xf3, 0xb4, 0x2b, 0xb4,
+    0x85, 0xb0, 0x6d, 0xb0, 0x4c, 0x35, 0x22, 0x34, 0x73, 0xb3, 0xd4, 0xb3,
+    0x94, 0x2e, 0x4d, 0x9a, 0x24, 0x30, 0x48, 0x34, 0xc5, 0x29, 0xc7, 0x32,
+    0x49, 0x2d, 0xb7, 0x34, 0xd4, 0xb4, 0x04, 0xae, 0xd5, 0xad, 0x10, 0xb2,
+    0x64, 0xae, 0xf7, 0xaa, 0x32, 0x31, 0xd2, 0xab, 0x75, 0x32, 0x3f, 0x30,
+    0x60, 0x35, 0x23, 0x38, 0x44, 0x34, 0x1d, 0xb7, 0x1f, 0xb3, 0x63, 0x2c,
+    0x53, 0x22, 0x70, 0xb1, 0x81, 0x35, 0xc4, 0x34, 0x2f, 0xb0, 0x8c, 0x28,
+    0xea, 0x2b, 0x5e, 0x2f, 0x4f, 0x31, 0x0d, 0x32, 0x79, 0x1c, 0x5b, 0x2c,
+    0xaf, 0xaa, 0xe9, 0x31, 0x5b, 0x2a, 0x74, 0x2e, 0x7c, 0x35, 0x47, 0xb4,
+    0x66, 0x33, 0xe6, 0xae, 0xb5, 0x22, 0x70, 0xaf, 0x9a, 0x35, 0x07, 0x38,
+    0x50, 0x21, 0x0b, 0xa3, 0xd0, 0xac, 0xf4, 0x2b, 0x2f, 0xb5, 0xd1, 0xab,
+    0xbc, 0x2e, 0xbc, 0x31, 0x8f, 0x21, 0xd7, 0xa5, 0x01, 0xb4, 0x8b, 0xb5,
+    0x30, 0x31, 0x97, 0x37, 0x48, 0x31, 0xec, 0x2d, 0x31, 0x36, 0x36, 0xad,
+    0x7f, 0xaa, 0x9e, 0x35, 0x28, 0xac, 0x15, 0x32, 0x8e, 0x33, 0x97, 0xb6,
+    0xe0, 0xae, 0x90, 0x2f, 0x50, 0x35, 0xb7, 0x2c, 0xf3, 0xb3, 0x34, 0x2d,
+    0x4a, 0xaf, 0x00, 0x39, 0xd9, 0xaa, 0x1b, 0x33, 0x3c, 0xb5, 0xce, 0xa6,
+    0xe0, 0xab, 0xa8, 0xa1, 0x81, 0x98, 0xb5, 0x13, 0x26, 0x36, 0x20, 0x31,
+    0x6a, 0x2b, 0x66, 0x36, 0xfd, 0xb0, 0x37, 0xb4, 0x05, 0x22, 0xc7, 0x32,
+    0x9c, 0x31, 0xaa, 0xb5, 0x90, 0xb2, 0xd3, 0xb2, 0x6f, 0x33, 0xe9, 0xaf,
+    0x38, 0xb0, 0x1d, 0xaf, 0xa0, 0x34, 0x1f, 0x37, 0x5c, 0x35, 0x0e, 0x2e,
+    0xbe, 0x37, 0x00, 0xb8, 0x29, 0xb8, 0x2e, 0xb5, 0x7c, 0xb2, 0x12, 0xb6,
+    0xd4, 0x36, 0x13, 0xb4, 0x0b, 0x30, 0x08, 0x34, 0x93, 0xb2, 0xff, 0x35,
+    0x78, 0x37, 0x29, 0x2a, 0xca, 0xb3, 0x11, 0x35, 0x29, 0xb3, 0x4f, 0xb4,
+    0xe4, 0x35, 0xa7, 0x35, 0x8e, 0x37, 0xb8, 0xad, 0xe1, 0x34, 0xd4, 0xb4,
+    0xc4, 0xb1, 0xce, 0x30, 0x3b, 0xb3, 0x1e, 0x34, 0x00, 0x33, 0x83, 0xae,
+    0x36, 0xb1, 0x4c, 0x35, 0xfa, 0xaf, 0x90, 0x34, 0xb4, 0xad, 0x1a, 0xb6,
+    0x4a, 0x2d, 0x39, 0xa6, 0x5c, 0xa2, 0x79, 0xb4, 0xb3, 0x32, 0x81, 0xb1,
+    0x29, 0xb3, 0x49, 0xb2, 0x85, 0xb4, 0xfa, 0x33, 0x81, 0x38, 0x6b, 0xb0,
+    0x05, 0xaf, 0x39, 0xb4, 0x05, 0xa4, 0x28, 0x30, 0xfa, 0xae, 0xda, 0xac,
+    0x98, 0xb3, 0xc7, 0xb6, 0x8a, 0x22, 0x94, 0xad, 0xa0, 0x35, 0xf6, 0x2c,
+    0x70, 0xaf, 0xdc, 0xb7, 0x71, 0xb0, 0xd2, 0xb5, 0x7b, 0xb3, 0x34, 0x37,
+    0xca, 0x30, 0x5c, 0xb4, 0x8d, 0xb8, 0xde, 0x34, 0xea, 0x2f, 0x25, 0xb6,
+    0xe9, 0xb8, 0x15, 0xb0, 0x02, 0x30, 0x11, 0x9a, 0x04, 0x29, 0x30, 0xb3,
+    0x3b, 0x35, 0x2d, 0x27, 0x63, 0xb4, 0x2e, 0xb3, 0x95, 0x32, 0xa4, 0x38,
+    0x86, 0x35, 0xe0, 0xac, 0xf7, 0xb6, 0x5c, 0xa8, 0xf8, 0xa0, 0x13, 0xa3,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x06, 0xe3, 0xfe, 0xff, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x00, 0x37, 0xb8,
+    0x69, 0x38, 0x5a, 0x35, 0x48, 0x35, 0x5d, 0x36, 0x48, 0xb8, 0xc1, 0x33,
+    0xd2, 0x2d, 0x6d, 0xb1, 0xa0, 0xa9, 0x68, 0xa6, 0x16, 0x32, 0x3f, 0x2f,
+    0x36, 0xb9, 0x4c, 0x22, 0x5a, 0xb9, 0x8c, 0xa7, 0x88, 0x2d, 0x60, 0xb1,
+    0xbe, 0x31, 0xde, 0x34, 0x0f, 0xb4, 0xfc, 0xad, 0xe5, 0x33, 0x79, 0x91,
+    0x80, 0xb1, 0x94, 0xb5, 0x40, 0xb5, 0x38, 0x34, 0x47, 0xb4, 0x63, 0xb0,
+    0x0f, 0xb4, 0xee, 0x28, 0xe5, 0x2c, 0x7f, 0x32, 0xc9, 0x35, 0xd5, 0xb0,
+    0x23, 0x35, 0x6b, 0xae, 0x7a, 0x36, 0x76, 0xad, 0x13, 0xb1, 0x71, 0x3b,
+    0x1c, 0xb4, 0x10, 0x32, 0x64, 0xb4, 0x69, 0xb4, 0xe9, 0x27, 0x1d, 0xb6,
+    0x6b, 0x33, 0x73, 0x39, 0xbb, 0x1f, 0xa9, 0xb5, 0x55, 0x30, 0x26, 0x33,
+    0xa5, 0xb7, 0xe9, 0x31, 0xbe, 0xb6, 0xc2, 0x2e, 0xe5, 0xb3, 0xc7, 0x2a,
+    0x48, 0xae, 0x72, 0x37, 0xcf, 0xb6, 0x10, 0x34, 0xe3, 0x35, 0x20, 0x2b,
+    0x0b, 0xb3, 0xd2, 0xb1, 0x87, 0xb3, 0x52, 0x30, 0xe3, 0x36, 0xed, 0x33,
+    0xb6, 0xb6, 0x5e, 0xb6, 0x77, 0x36, 0x45, 0xaf, 0xd4, 0xb3, 0x4c, 0x32,
+    0x96, 0xb5, 0x1b, 0x3a, 0xee, 0xb4, 0x7b, 0xb1, 0x16, 0x37, 0x61, 0x2a,
+    0x9e, 0xb0, 0x13, 0xb1, 0x8b, 0xac, 0x8f, 0xb9, 0x2f, 0xb0, 0x00, 0x36,
+    0x9d, 0x35, 0x3b, 0x35, 0x4e, 0xb4, 0x2a, 0x28, 0x56, 0xb0, 0x85, 0xb4,
+    0x14, 0xb8, 0x2e, 0xb3, 0xf0, 0x2d, 0x7e, 0xac, 0xc9, 0xb4, 0xb8, 0xb4,
+    0xf8, 0x34, 0x3e, 0x2e, 0x69, 0xb9, 0x6a, 0x39, 0x71, 0xb4, 0xad, 0xb1,
+    0xff, 0xb3, 0xcc, 0x34, 0x9d, 0x2d, 0xef, 0xab, 0x0d, 0x32, 0x30, 0x39,
+    0xa8, 0xb2, 0xf2, 0xb3, 0x80, 0x30, 0x40, 0x36, 0xb9, 0xb5, 0x0a, 0xa6,
+    0x1b, 0x33, 0xec, 0x33, 0x32, 0xa8, 0x64, 0x34, 0x53, 0x33, 0x10, 0x30,
+    0x3e, 0xb0, 0x88, 0x28, 0x0e, 0xb6, 0x26, 0xb9, 0x06, 0xb9, 0x1a, 0x2a,
+    0x93, 0x2e, 0x78, 0x30, 0x5b, 0x31, 0xa1, 0x35, 0xbb, 0x33, 0x38, 0xb6,
+    0xbd, 0xb4, 0xa7, 0xaf, 0xdc, 0x34, 0x33, 0x2a, 0x27, 0xb5, 0x6c, 0x2e,
+    0x4a, 0xb0, 0x1f, 0xb9, 0x4a, 0x2b, 0x74, 0xb1, 0x88, 0xb0, 0xad, 0x36,
+    0xb6, 0xb0, 0xa7, 0x24, 0xd1, 0x34, 0xf3, 0xae, 0x36, 0x35, 0x9a, 0xae,
+    0xd7, 0x27, 0x16, 0xb0, 0xe8, 0x35, 0x6b, 0xb7, 0x77, 0x36, 0xa1, 0xb1,
+    0x6f, 0x37, 0xfa, 0xb6, 0x70, 0x2d, 0x13, 0x37, 0x8d, 0x36, 0x4d, 0x31,
+    0xd1, 0xae, 0xed, 0x38, 0x81, 0x35, 0x43, 0x37, 0xc6, 0xb5, 0xd3, 0xb1,
+    0x86, 0xa6, 0xb5, 0xb1, 0x90, 0x38, 0x54, 0x3b, 0x2f, 0x1c, 0x5b, 0x37,
+    0x83, 0x1f, 0x33, 0x2f, 0x4b, 0xb4, 0x21, 0xb0, 0x3c, 0xb6, 0xb3, 0xac,
+    0x22, 0xb8, 0xac, 0xaf, 0x94, 0x36, 0x82, 0xb0, 0xe0, 0x31, 0x73, 0x34,
+    0xbe, 0xb4, 0x26, 0x3a, 0x7a, 0x36, 0x97, 0x32, 0xe5, 0x3c, 0xd0, 0xb3,
+    0xf8, 0x2c, 0x20, 0x32, 0x94, 0xb6, 0xc9, 0x34, 0x75, 0xb4, 0x5a, 0xa3,
+    0xb5, 0xb7, 0x3f, 0xa4, 0x38, 0x39, 0xb0, 0xaf, 0x7e, 0x35, 0x7c, 0x38,
+    0xa8, 0xa8, 0x9d, 0xad, 0x1c, 0x35, 0xc3, 0x30, 0x94, 0xab, 0x84, 0xa9,
+    0x8a, 0x31, 0x4d, 0x36, 0x39, 0xaf, 0xcb, 0x34, 0xcb, 0x34, 0xaa, 0x3b,
+    0x75, 0xb9, 0x15, 0x33, 0xea, 0x34, 0xe8, 0x27, 0xf2, 0xaf, 0x74, 0x2d,
+    0xff, 0x36, 0x77, 0xac, 0xe5, 0xa9, 0x80, 0xb2, 0xd7, 0xaa, 0xeb, 0x34,
+    0xc8, 0x9e, 0x29, 0x30, 0x9e, 0x28, 0xde, 0xb5, 0x58, 0x35, 0x2d, 0x34,
+    0xf0, 0x23, 0x08, 0xb5, 0x2e, 0xb6, 0xfe, 0xae, 0xc3, 0xb6, 0x51, 0x32,
+    0x7a, 0xaf, 0x16, 0xab, 0x69, 0xa3, 0x6c, 0xb4, 0x87, 0x1c, 0x93, 0xb1,
+    0x95, 0x30, 0x39, 0x34, 0x32, 0xa8, 0x9f, 0x34, 0xbe, 0x38, 0xd7, 0x3a,
+    0x2f, 0x2c, 0x1f, 0x35, 0xef, 0x3b, 0xf9, 0x33, 0x79, 0x33, 0x36, 0x15,
+    0x46, 0xaf, 0xff, 0xa9, 0x82, 0x22, 0x7e, 0xb2, 0x03, 0xb3, 0x32, 0xb4,
+    0xd6, 0x3c, 0x49, 0xb5, 0x6c, 0xa6, 0x4d, 0x36, 0x83, 0x35, 0x84, 0x38,
+    0xeb, 0xb4, 0xad, 0xb7, 0xc7, 0x35, 0xed, 0xb4, 0x11, 0xb1, 0x8b, 0x2d,
+    0x78, 0xb4, 0x3a, 0x2d, 0x76, 0x35, 0x08, 0x3c, 0xf2, 0xac, 0x37, 0xb0,
+    0x5d, 0xaa, 0x45, 0x29, 0x2a, 0xb5, 0xdd, 0x32, 0x44, 0x35, 0x25, 0xb4,
+    0x32, 0xa8, 0xa3, 0xb5, 0xaf, 0x37, 0xf0, 0xb8, 0x30, 0xb2, 0xea, 0x36,
+    0x63, 0x33, 0xe0, 0xb8, 0x61, 0x36, 0xfd, 0x99, 0x5b, 0xb7, 0xd1, 0xb2,
+    0x0b, 0xb2, 0x03, 0xa4, 0x99, 0x31, 0x11, 0x35, 0x47, 0xb5, 0xe8, 0x38,
+    0x28, 0x36, 0xc7, 0xb4, 0x81, 0x23, 0x6d, 0xa0, 0x44, 0xb6, 0x87, 0x31,
+    0x7d, 0x2a, 0xd8, 0x2c, 0xc5, 0xb6, 0x66, 0x24, 0x5e, 0xb5, 0xa7, 0x34,
+    0x6e, 0xb8, 0x17, 0xac, 0x4a, 0xb1, 0x21, 0x36, 0xf6, 0xb2, 0x7f, 0xb8,
+    0xd3, 0xac, 0xf8, 0xaa, 0xad, 0x38, 0x29, 0xae, 0x55, 0xb8, 0x86, 0x1f,
+    0x7d, 0xb1, 0x5e, 0xb5, 0x41, 0x35, 0x2a, 0xb0, 0x4e, 0x36, 0xe8, 0x37,
+    0xef, 0xb2, 0xa0, 0xa7, 0xe1, 0x38, 0x0c, 0xac, 0x24, 0x38, 0x44, 0x23,
+    0xa3, 0xb5, 0x96, 0xb5, 0x84, 0x2c, 0xeb, 0xa8, 0x93, 0x35, 0x11, 0x31,
+    0xee, 0xb3, 0x75, 0xb5, 0xef, 0x37, 0x39, 0xa5, 0x92, 0x33, 0x2f, 0xae,
+    0xc8, 0x27, 0xca, 0xb5, 0xa6, 0x38, 0xc8, 0x33, 0xef, 0x32, 0x23, 0x35,
+    0x38, 0x39, 0x92, 0x36, 0x7e, 0xa8, 0xd5, 0xb6, 0x32, 0xa9, 0xc4, 0xb4,
+    0x6f, 0xb7, 0x51, 0xb6, 0x17, 0x34, 0xc2, 0x2b, 0x6b, 0xb1, 0x12, 0x31,
+    0xe0, 0xb4, 0x4d, 0x30, 0x73, 0xb8, 0x60, 0x32, 0xfb, 0xb5, 0x5d, 0x31,
+    0x09, 0x34, 0x82, 0xac, 0x14, 0xb2, 0x3e, 0xb4, 0xdd, 0x2f, 0x21, 0xb4,
+    0xa0, 0x36, 0x71, 0x30, 0x8e, 0x2b, 0xfc, 0xb0, 0x46, 0x39, 0xcb, 0xb4,
+    0xc2, 0x33, 0x6c, 0x37, 0xe2, 0x33, 0x7b, 0x38, 0x38, 0x31, 0x7e, 0x30,
+    0xcb, 0xb1, 0x53, 0xb5, 0xf7, 0x2f, 0x42, 0x2e, 0x91, 0xb0, 0x7d, 0xb1,
+    0xd1, 0xb5, 0xb9, 0x39, 0x8f, 0xb5, 0x0e, 0x35, 0xb6, 0x2f, 0x23, 0xb3,
+    0x97, 0xab, 0xc8, 0xb3, 0x5e, 0xb4, 0xf2, 0x31, 0x9c, 0x24, 0x6b, 0x37,
+    0x88, 0xb7, 0x53, 0x29, 0x6b, 0xa0, 0xb0, 0xaa, 0x3c, 0x37, 0x2e, 0x33,
+    0xa0, 0xb7, 0x77, 0x36, 0x1e, 0x2d, 0xb0, 0xb2, 0x48, 0xb6, 0x23, 0xb5,
+    0x63, 0xa8, 0x9d, 0xa3, 0x7e, 0xa3, 0x13, 0x32, 0x9c, 0xa5, 0x63, 0x35,
+    0x09, 0xb0, 0x70, 0x37, 0xda, 0x34, 0xf6, 0xb7, 0x54, 0x34, 0xe5, 0xa2,
+    0x7e, 0x32, 0x91, 0xb8, 0x80, 0x3a, 0x4d, 0xb4, 0x52, 0x38, 0x79, 0xa7,
+    0x60, 0x35, 0x26, 0xb7, 0x56, 0x36, 0x98, 0x35, 0xa7, 0xb2, 0xea, 0x30,
+    0x4a, 0x34, 0x41, 0x3b, 0x40, 0x34, 0x45, 0x39, 0x7b, 0x38, 0x7d, 0xb7,
+    0x6c, 0x34, 0xe0, 0xab, 0xa2, 0x38, 0xf1, 0x3d, 0x3e, 0x35, 0x8b, 0xb5,
+    0x44, 0x34, 0xd1, 0x30, 0x3c, 0x31, 0x20, 0x38, 0x3f, 0xb3, 0xec, 0x31,
+    0x3c, 0xb7, 0x7d, 0x29, 0x2f, 0x3b, 0x18, 0xaa, 0x23, 0x3a, 0xd7, 0x35,
+    0x5a, 0xb0, 0x7c, 0x3a, 0x7f, 0x35, 0x6e, 0x31, 0x83, 0xb2, 0x44, 0x24,
+    0x33, 0xb4, 0xa2, 0x33, 0xfd, 0x2c, 0x15, 0xac, 0xc5, 0xb6, 0x4b, 0xb3,
+    0x87, 0x2e, 0x85, 0x2b, 0xcb, 0xb1, 0x6d, 0xb8, 0x77, 0x34, 0xb7, 0xb4,
+    0x87, 0x32, 0x2f, 0x35, 0xa1, 0x32, 0x80, 0x2e, 0xa5, 0x25, 0x9a, 0x2c,
+    0x0e, 0x35, 0xa2, 0xb8, 0x14, 0xb3, 0x2f, 0x37, 0xef, 0x28, 0x7a, 0xb5,
+    0x6d, 0xb2, 0x00, 0x96, 0x01, 0x00, 0x00, 0x12, 0xeb, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x0a, 0x9a, 0x25, 0xbf, 0x39,
+    0x83, 0x13, 0x3f, 0xa1, 0x2a, 0x56, 0xbf, 0x70, 0x1a, 0x1b, 0x3f, 0x2a,
+    0x85, 0x3d, 0xbf, 0xc4, 0xa7, 0x12, 0x3f, 0x3b, 0x71, 0x15, 0x3e, 0xd1,
+    0xa8, 0x53, 0xbf, 0x9f, 0xfd, 0xc0, 0xbe, 0xc2, 0x4d, 0xd7, 0xbe, 0xee,
+    0xd7, 0x6c, 0xbf, 0x08, 0xeb, 0x69, 0xbf, 0x4f, 0x0c, 0xa9, 0x3e, 0xfe,
+    0xf9, 0xeb, 0x3e, 0xdd, 0x73, 0x38, 0x3e, 0xcd, 0x00, 0x9b, 0xbf, 0x1b,
+    0xee, 0x1a, 0xbe, 0x27, 0x4b, 0xeb, 0x3e, 0x8b, 0xd2, 0x82, 0xbf, 0xf3,
+    0x02, 0x62, 0xbf, 0x45, 0xc2, 0x41, 0xbf, 0x90, 0xe2, 0x92, 0xbf, 0x15,
+    0xbf, 0x45, 0x3e, 0x26, 0x49, 0x38, 0x3f, 0x86, 0x69, 0x75, 0x3e, 0x10,
+    0x01, 0x08, 0x3f, 0x71, 0x1c, 0x3b, 0xbf, 0xbf, 0x33, 0x8b, 0x3e, 0xf8,
+    0x2b, 0xff, 0xbe, 0x3b, 0x62, 0xfa, 0xbe, 0x4b, 0x07, 0x0c, 0xbd, 0x98,
+    0xe6, 0xf9, 0x3e, 0xdc, 0x10, 0x1c, 0x3f, 0x41, 0xba, 0x6a, 0xbf, 0x57,
+    0x1f, 0xd5, 0x3e, 0xa8, 0x0f, 0x5b, 0xbf, 0x31, 0x19, 0x68, 0xbf, 0xb6,
+    0xdb, 0xee, 0x3e, 0xf0, 0x73, 0xdf, 0xbf, 0xdb, 0x7a, 0xfd, 0xbe, 0x3a,
+    0x71, 0xde, 0x3d, 0x5a, 0xff, 0xe0, 0xbe, 0x60, 0x37, 0x88, 0xbf, 0x8f,
+    0x65, 0xec, 0x3e, 0x7e, 0xbc, 0xf3, 0x3e, 0x5c, 0xc9, 0x44, 0xbf, 0x15,
+    0xb9, 0xb5, 0x3d, 0xb3, 0xd3, 0x08, 0xbf, 0x03, 0xb0, 0xf2, 0xbe, 0x2e,
+    0x09, 0x25, 0xbf, 0xe9, 0xf2, 0xd9, 0x3e, 0xa2, 0xf5, 0xf3, 0x3e, 0x99,
+    0x77, 0xde, 0x3e, 0x2a, 0xef, 0x5a, 0xbf, 0x1a, 0x05, 0x5c, 0xbd, 0xd5,
+    0xdd, 0xda, 0xbe, 0x65, 0xc1, 0x99, 0xbf, 0xb7, 0xaa, 0x3f, 0xbf, 0xc4,
+    0x6a, 0xa5, 0x3e, 0xd8, 0x39, 0xd1, 0x3e, 0x64, 0xf3, 0xf3, 0x3e, 0x00,
+    0x4d, 0x49, 0xbf, 0x62, 0xbd, 0x8b, 0xbf, 0xfa, 0x51, 0x3c, 0xbf, 0x73,
+    0x0f, 0x2c, 0x3f, 0x41, 0xde, 0x1b, 0xbf, 0xd1, 0xc4, 0x7a, 0x3e, 0xee,
+    0x23, 0x19, 0xbf, 0x25, 0xf1, 0x3d, 0xbf, 0xef, 0xbf, 0xc9, 0xbe, 0xa3,
+    0xb3, 0x06, 0x3e, 0x09, 0x99, 0xd9, 0xbe, 0x3c, 0x29, 0x58, 0x3e, 0x54,
+    0xb7, 0xb0, 0xbe, 0x6c, 0x24, 0xa4, 0x3e, 0x89, 0x63, 0x3c, 0xbf, 0x2c,
+    0x8f, 0xaa, 0xbe, 0x0b, 0x28, 0xad, 0x3e, 0x61, 0x7c, 0x94, 0xbf, 0x5b,
+    0x9b, 0x0d, 0x3f, 0xc4, 0x40, 0x81, 0xbe, 0x42, 0xad, 0x4b, 0xbf, 0xd0,
+    0xda, 0x88, 0xbf, 0x6a, 0x34, 0x32, 0xbf, 0x10, 0xd4, 0x0e, 0x3f, 0xb4,
+    0x6d, 0x53, 0xbe, 0x8e, 0x81, 0xa8, 0xbf, 0xaf, 0xaf, 0xeb, 0xbe, 0x37,
+    0xe5, 0x3c, 0xbf, 0x61, 0x02, 0x2c, 0x3f, 0x64, 0x3a, 0xf3, 0x3e, 0xff,
+    0x16, 0x45, 0xbf, 0xf3, 0x8e, 0x31, 0xbf, 0x0e, 0x81, 0xfa, 0x3e, 0xb0,
+    0x92, 0x11, 0x3e, 0x65, 0x18, 0x85, 0x3e, 0x9e, 0xec, 0xfe, 0xff, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xaa, 0xed, 0xfe, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x00, 0x00, 0x01, 0x00, 0x30, 0x00, 0x00, 0xdf, 0xa9, 0xda, 0xa9,
+    0x94, 0xa5, 0x3e, 0x2d, 0x89, 0xa7, 0x5a, 0xae, 0xce, 0xad, 0x4a, 0x2b,
+    0x7f, 0x29, 0x3a, 0x27, 0x28, 0xae, 0x1d, 0x2c, 0x1a, 0xaa, 0x0f, 0xa9,
+    0xe0, 0x20, 0x31, 0xad, 0x19, 0xac, 0xfc, 0x2c, 0x19, 0xa5, 0x26, 0xa4,
+    0xd3, 0xa6, 0xac, 0x2c, 0xad, 0x1e, 0x62, 0x2c, 0x72, 0xad, 0xae, 0x26,
+    0xd2, 0xa9, 0xf8, 0x2d, 0x6c, 0xad, 0x11, 0xae, 0x7a, 0x2a, 0xd2, 0xaa,
+    0x10, 0x2c, 0x8b, 0xa5, 0x43, 0xad, 0x4c, 0xad, 0xe5, 0x2c, 0xb5, 0x2b,
+    0x1b, 0xae, 0x77, 0x11, 0xeb, 0xad, 0x22, 0x2b, 0x10, 0xaf, 0xf4, 0xa8,
+    0x27, 0x2d, 0x6f, 0xa5, 0xe7, 0x2d, 0xa0, 0xad, 0x67, 0xb0, 0xce, 0xad,
+    0x78, 0xaa, 0xf9, 0xa5, 0x61, 0xa3, 0x48, 0xa6, 0x58, 0xb0, 0x7f, 0xa4,
+    0x28, 0xac, 0x7d, 0xae, 0xdc, 0x24, 0xd7, 0x1d, 0x8d, 0xae, 0xc9, 0x24,
+    0xa9, 0x21, 0xb1, 0x2a, 0x37, 0x25, 0x8f, 0xa1, 0x31, 0xad, 0xa4, 0x2d,
+    0x46, 0xaa, 0x92, 0xa8, 0x3b, 0xac, 0x44, 0xaf, 0x4d, 0xb0, 0x5a, 0x2c,
+    0xe7, 0x9e, 0xa2, 0x29, 0xaf, 0x1e, 0x55, 0x2c, 0x88, 0xb0, 0x0d, 0xa9,
+    0x60, 0x2d, 0x64, 0x2d, 0x8e, 0x26, 0x84, 0xaa, 0x29, 0xac, 0xa5, 0x2e,
+    0xbe, 0xad, 0x33, 0xac, 0xf9, 0x27, 0x30, 0xaa, 0x6f, 0xb0, 0xe8, 0x2d,
+    0x10, 0xaf, 0x37, 0x2e, 0xd0, 0x9c, 0x60, 0x2c, 0x8d, 0x2f, 0x30, 0x21,
+    0xc2, 0x2f, 0x40, 0x30, 0xc8, 0x23, 0x41, 0xb3, 0x96, 0x2e, 0xc8, 0x22,
+    0x71, 0xac, 0x37, 0x34, 0x89, 0x1f, 0x34, 0xa1, 0x3b, 0x27, 0x5f, 0x2b,
+    0x62, 0x25, 0x16, 0x30, 0xac, 0xa8, 0xcd, 0xaf, 0x26, 0xab, 0x04, 0xa8,
+    0xfd, 0x30, 0xf4, 0x31, 0x5f, 0x8e, 0x36, 0x2c, 0x6e, 0x2a, 0x61, 0xad,
+    0x2c, 0x06, 0x42, 0x29, 0x87, 0xad, 0x3a, 0x29, 0x1d, 0xaa, 0x6e, 0x2e,
+    0x80, 0x31, 0x77, 0x31, 0x2c, 0xa2, 0x2f, 0x31, 0x89, 0xad, 0xb1, 0x2c,
+    0x07, 0x30, 0x33, 0x31, 0x8d, 0xaf, 0xe7, 0x2b, 0x2c, 0xb0, 0x21, 0xad,
+    0xc0, 0x2b, 0x21, 0x22, 0xdf, 0xae, 0xe7, 0xad, 0x99, 0x2c, 0xe1, 0xa7,
+    0x04, 0xac, 0x6c, 0x13, 0x8c, 0xab, 0x54, 0x29, 0x9e, 0xa8, 0x23, 0xa8,
+    0xf7, 0x24, 0x4e, 0x27, 0x45, 0x24, 0x11, 0x2e, 0x14, 0xac, 0xa4, 0xaa,
+    0x3f, 0x1e, 0x33, 0x29, 0xe2, 0xa8, 0x4e, 0x2c, 0xae, 0xae, 0xc3, 0x20,
+    0xf1, 0xa5, 0x7d, 0xac, 0xec, 0x1a, 0x54, 0xa5, 0x48, 0xaf, 0x1a, 0xab,
+    0x24, 0xb0, 0xc4, 0x1d, 0x5a, 0xad, 0x38, 0x2a, 0x0e, 0xae, 0x65, 0x2a,
+    0x3a, 0xac, 0x82, 0x20, 0x10, 0x29, 0xf7, 0x9e, 0x5b, 0x2c, 0x5f, 0xa6,
+    0x36, 0x9d, 0x73, 0xac, 0x25, 0x29, 0x1f, 0x2f, 0xf3, 0xae, 0xf0, 0x27,
+    0x1a, 0xb0, 0xb9, 0xad, 0xba, 0x28, 0x49, 0x2b, 0xcd, 0xa7, 0x55, 0x2e,
+    0x54, 0xae, 0x28, 0xae, 0x03, 0xae, 0x29, 0x2e, 0xef, 0x29, 0xf9, 0xad,
+    0xff, 0xaa, 0x40, 0xac, 0x08, 0x28, 0x56, 0xa1, 0x3b, 0xa6, 0xc0, 0x25,
+    0x71, 0x1f, 0x49, 0xaa, 0x0f, 0x25, 0x7e, 0x2a, 0x3c, 0xad, 0xba, 0xac,
+    0x6a, 0xaa, 0x07, 0xa5, 0x80, 0xad, 0xee, 0xa4, 0x51, 0xab, 0xcc, 0x96,
+    0x41, 0xaa, 0xc7, 0xac, 0x0e, 0xa8, 0x6d, 0xad, 0x09, 0xaa, 0x71, 0x2c,
+    0xd3, 0x2d, 0x50, 0x28, 0xd9, 0x2d, 0xec, 0xaa, 0x53, 0x25, 0x1f, 0x2b,
+    0x36, 0x22, 0x51, 0xa8, 0x48, 0xad, 0xc8, 0x27, 0x8e, 0x29, 0xa6, 0xaa,
+    0xf5, 0x2d, 0xc5, 0xad, 0xf8, 0xa9, 0x11, 0x2b, 0xc5, 0xa9, 0xc8, 0x2e,
+    0x1c, 0x2b, 0x97, 0x2c, 0x8c, 0x03, 0x3d, 0xa9, 0x11, 0x24, 0x25, 0x2d,
+    0xcd, 0x27, 0x9e, 0xa3, 0x0b, 0x2a, 0x9e, 0x29, 0x51, 0x2f, 0xc6, 0x16,
+    0x7c, 0x33, 0xa4, 0x31, 0xdb, 0xa3, 0x8e, 0xa9, 0x71, 0xa2, 0x07, 0x2b,
+    0xe6, 0x31, 0xb1, 0x2d, 0x71, 0x28, 0x62, 0x8a, 0xf8, 0xac, 0x9a, 0x24,
+    0x62, 0x30, 0x17, 0x2d, 0xc2, 0x2c, 0x5e, 0x2f, 0x02, 0x25, 0xa2, 0xa8,
+    0x0b, 0x34, 0x23, 0x32, 0x53, 0xa8, 0x82, 0x30, 0x8b, 0xac, 0xd1, 0x2e,
+    0xa2, 0x34, 0x75, 0x31, 0xae, 0x2e, 0x5f, 0x27, 0xb7, 0x2e, 0x35, 0x2f,
+    0xfa, 0x2f, 0x7f, 0x2b, 0x75, 0x30, 0x5a, 0x2b, 0xef, 0x2c, 0x03, 0x2e,
+    0x9e, 0x28, 0x18, 0xae, 0xc0, 0xa6, 0xd4, 0x28, 0xf9, 0x29, 0x22, 0xad,
+    0xf5, 0x2a, 0x78, 0x2e, 0x1c, 0xae, 0x17, 0x2a, 0xc1, 0xab, 0x1c, 0xab,
+    0x29, 0xae, 0x0f, 0x2d, 0x74, 0xae, 0x42, 0x29, 0x08, 0xa9, 0x77, 0xae,
+    0x55, 0xa9, 0xd9, 0xac, 0x6c, 0x2c, 0x72, 0x29, 0xe2, 0x9d, 0x18, 0xae,
+    0xcb, 0xad, 0xe8, 0xa9, 0xea, 0x28, 0x2e, 0x2e, 0x2a, 0x2a, 0x89, 0x28,
+    0x01, 0xae, 0xa7, 0xab, 0x2d, 0xab, 0x23, 0x9e, 0xe4, 0x24, 0x99, 0x98,
+    0x40, 0x28, 0x58, 0xac, 0x63, 0xaa, 0xcb, 0x99, 0xf9, 0x2a, 0x5a, 0x2d,
+    0xa0, 0xa7, 0xb8, 0x2d, 0x62, 0xac, 0x63, 0xae, 0x9a, 0x30, 0xf4, 0xac,
+    0xc3, 0x24, 0xde, 0xa4, 0x32, 0xae, 0x7b, 0x2e, 0xde, 0x2d, 0x5c, 0x27,
+    0x8c, 0xad, 0x5c, 0xa9, 0x1f, 0xa8, 0x83, 0xa9, 0xd6, 0x2a, 0x36, 0x29,
+    0x07, 0x29, 0x8c, 0xad, 0x55, 0xa9, 0xec, 0x2d, 0x5f, 0x2f, 0xfb, 0x20,
+    0xb8, 0x2d, 0x3c, 0x96, 0xc7, 0x29, 0x9b, 0xa9, 0x60, 0xb1, 0x16, 0xb1,
+    0xed, 0xb0, 0xac, 0xae, 0x34, 0xaa, 0x9c, 0xb0, 0xf5, 0x8f, 0x7c, 0xae,
+    0x9c, 0x26, 0x39, 0xaf, 0x07, 0xad, 0xed, 0xa3, 0xac, 0xad, 0x0c, 0xb1,
+    0x88, 0xb0, 0xe2, 0xae, 0x20, 0x14, 0x32, 0xa8, 0x0a, 0xb1, 0xb4, 0x9c,
+    0xed, 0xa8, 0xf0, 0xad, 0x5b, 0xa0, 0xaf, 0x28, 0xe3, 0x2c, 0x26, 0x22,
+    0xe8, 0xad, 0xf3, 0xa6, 0x46, 0xaf, 0x52, 0x30, 0x0d, 0x2b, 0xb2, 0x1d,
+    0x24, 0x2d, 0x58, 0x2f, 0xf6, 0xad, 0x76, 0x31, 0xa6, 0x28, 0x82, 0xac,
+    0x61, 0x2e, 0xb6, 0x2d, 0x09, 0x30, 0x64, 0x2c, 0xd0, 0x2d, 0xe2, 0x2a,
+    0x95, 0x30, 0x60, 0x2d, 0x67, 0x30, 0x1d, 0xaa, 0xf7, 0x28, 0x5b, 0x25,
+    0x50, 0xa8, 0x3d, 0x34, 0x4a, 0x32, 0xc5, 0xb0, 0xbd, 0x21, 0x25, 0xaa,
+    0x48, 0x1c, 0x05, 0x30, 0x68, 0x34, 0xe5, 0xab, 0x07, 0xaf, 0xe8, 0x25,
+    0x24, 0x28, 0xba, 0x2f, 0xf2, 0x34, 0x16, 0x28, 0x70, 0xac, 0x61, 0x25,
+    0x80, 0x25, 0xc8, 0x30, 0xef, 0x32, 0x96, 0xb0, 0x77, 0xa8, 0x57, 0xaa,
+    0x12, 0xaa, 0xc8, 0xae, 0x48, 0xa3, 0x85, 0x2a, 0x81, 0x27, 0x81, 0xa1,
+    0x9e, 0xae, 0x9f, 0xab, 0x98, 0xae, 0x4c, 0x28, 0x3c, 0x21, 0xcf, 0xae,
+    0x5f, 0xa8, 0x3f, 0x27, 0xed, 0x28, 0x74, 0xad, 0xf5, 0x2b, 0xbd, 0x2c,
+    0xf6, 0xad, 0xc5, 0xa6, 0x77, 0x2e, 0x7d, 0x22, 0xa2, 0x2d, 0xff, 0x2d,
+    0xd4, 0xa8, 0x33, 0xaa, 0xc3, 0x26, 0x3c, 0x2d, 0x0f, 0xad, 0xce, 0xae,
+    0x5d, 0xa0, 0x65, 0x27, 0x63, 0x26, 0x7a, 0xa3, 0x98, 0x21, 0x3c, 0xa8,
+    0x1e, 0xaa, 0x3c, 0xad, 0xdb, 0x2d, 0x3c, 0xac, 0x83, 0xa9, 0x86, 0x21,
+    0x1e, 0x24, 0x13, 0xaa, 0x21, 0xa8, 0x6c, 0xa5, 0x4e, 0xab, 0x58, 0x9e,
+    0xc2, 0x23, 0xf1, 0x21, 0x24, 0xad, 0xbe, 0x25, 0xda, 0x2d, 0x17, 0xa7,
+    0x19, 0xac, 0x29, 0xae, 0xe5, 0xac, 0x17, 0x2d, 0xf2, 0xad, 0x56, 0xae,
+    0xca, 0xa3, 0xc6, 0xaa, 0x23, 0xa4, 0x87, 0x1f, 0x25, 0x2d, 0xca, 0xae,
+    0x77, 0x21, 0xe3, 0xad, 0x28, 0xae, 0x3e, 0xab, 0x25, 0x2d, 0xb0, 0xa1,
+    0xc1, 0x2b, 0x70, 0x29, 0x96, 0x24, 0x7f, 0xae, 0x2f, 0x22, 0x1e, 0x2a,
+    0x73, 0x2d, 0x0d, 0xad, 0x90, 0x2d, 0xa6, 0x19, 0x56, 0xa6, 0xd8, 0xad,
+    0xa7, 0x2c, 0xa9, 0xa1, 0x2a, 0xad, 0xf8, 0xac, 0x56, 0xae, 0x0a, 0x2d,
+    0x76, 0x2d, 0x17, 0x2c, 0x7d, 0xa9, 0x32, 0x2c, 0x2a, 0x2d, 0xe0, 0x1f,
+    0x08, 0xad, 0xe9, 0x27, 0x93, 0x2c, 0xb7, 0xab, 0x1d, 0x2d, 0x01, 0xa8,
+    0x3a, 0xab, 0xaf, 0x25, 0x4d, 0xac, 0x4b, 0x2b, 0x13, 0xae, 0x6f, 0x18,
+    0x12, 0x24, 0x47, 0x24, 0x02, 0x2e, 0x02, 0xa6, 0xdb, 0xa8, 0x26, 0xac,
+    0x1b, 0x2c, 0xed, 0xad, 0x5a, 0x28, 0x4a, 0xac, 0xb5, 0xa2, 0xbc, 0xa4,
+    0x8f, 0xa4, 0xbb, 0xaa, 0xc6, 0x25, 0x77, 0xac, 0xcc, 0xa9, 0x5f, 0x25,
+    0x36, 0xac, 0xee, 0xa4, 0x56, 0xab, 0xbc, 0x2d, 0x10, 0x2a, 0x6d, 0x29,
+    0x4b, 0xae, 0x5b, 0xac, 0x24, 0x2e, 0x82, 0x26, 0x26, 0x1f, 0x86, 0x2a,
+    0x5e, 0x2e, 0x31, 0xa6, 0x68, 0xa8, 0x01, 0xad, 0xe6, 0xab, 0x9c, 0x28,
+    0xc5, 0xae, 0xc3, 0xa7, 0x92, 0xaa, 0xf1, 0xa8, 0x9d, 0x27, 0x42, 0x2e,
+    0x7a, 0xb0, 0xb8, 0x32, 0x7d, 0xb0, 0xbf, 0x28, 0xab, 0xac, 0xb2, 0x2c,
+    0x7f, 0xb0, 0xb1, 0x30, 0x85, 0xa9, 0x27, 0x28, 0x4b, 0x2b, 0x92, 0xa6,
+    0xa4, 0xb2, 0x98, 0xa6, 0x1c, 0xa8, 0x7f, 0xac, 0xa9, 0xa8, 0x10, 0x29,
+    0x0e, 0xa9, 0x56, 0xac, 0x49, 0x30, 0xd3, 0x29, 0xd3, 0xac, 0x62, 0x21,
+    0x63, 0xb2, 0x97, 0x2e, 0x3c, 0x35, 0x74, 0xa5, 0x3a, 0xa6, 0x97, 0xaf,
+    0xe2, 0xa4, 0x87, 0x31, 0x60, 0x34, 0xdc, 0x30, 0x83, 0x29, 0x22, 0xb1,
+    0x43, 0x9e, 0x32, 0x30, 0x00, 0x2e, 0x4c, 0xa1, 0x2a, 0xb0, 0x4c, 0xad,
+    0x4b, 0xae, 0xfe, 0xa9, 0xb6, 0x29, 0x9a, 0xac, 0xcd, 0x24, 0xd8, 0x24,
+    0x70, 0xa9, 0xd6, 0xa8, 0xdd, 0x17, 0xfc, 0x29, 0x70, 0xaa, 0x23, 0x2b,
+    0x40, 0x2a, 0x54, 0xac, 0x57, 0x2e, 0xc3, 0x2c, 0x49, 0xac, 0x45, 0xae,
+    0x6a, 0x24, 0x8a, 0xab, 0x70, 0x2c, 0x44, 0xa7, 0x9f, 0xaa, 0x7b, 0x2c,
+    0x9d, 0xac, 0xba, 0x26, 0x77, 0xa9, 0x6a, 0x2d, 0x77, 0xac, 0x34, 0x25,
+    0xd9, 0xac, 0x5e, 0x9d, 0x7a, 0xaa, 0x79, 0x2b, 0x22, 0x28, 0x55, 0xa4,
+    0x48, 0x2d, 0xe8, 0x29, 0x87, 0xa4, 0x82, 0xae, 0x40, 0xad, 0x9e, 0x1e,
+    0xe3, 0xa8, 0xb4, 0x28, 0xda, 0xa4, 0x83, 0x2d, 0x25, 0x28, 0x9d, 0xb3,
+    0x3c, 0xae, 0xa1, 0xa8, 0x12, 0x2c, 0xd2, 0x2e, 0xaa, 0x2c, 0x65, 0xb0,
+    0xa6, 0xa2, 0x84, 0x91, 0xaa, 0x31, 0xb2, 0x2c, 0x82, 0x2e, 0x1d, 0xaa,
+    0x93, 0xa7, 0xbc, 0x2d, 0xbc, 0x2a, 0xa4, 0x2a, 0xb3, 0x21, 0x92, 0x2b,
+    0x21, 0xac, 0xe9, 0x2d, 0xc2, 0x31, 0xc1, 0x24, 0x05, 0xad, 0x1c, 0x2f,
+    0x57, 0xad, 0xbd, 0x2f, 0x30, 0x2f, 0x77, 0x25, 0x5e, 0xac, 0x6a, 0x30,
+    0x7c, 0x2c, 0x6d, 0xad, 0x1f, 0x33, 0xac, 0x2c, 0x63, 0x25, 0xc0, 0x30,
+    0xb1, 0xad, 0x3c, 0xb0, 0xd8, 0x2c, 0xd2, 0x29, 0x7c, 0xa6, 0x4e, 0x2d,
+    0xde, 0x28, 0x99, 0xb1, 0x54, 0x2e, 0x30, 0x2b, 0x5f, 0xac, 0x0e, 0x2d,
+    0xcd, 0x2a, 0xc1, 0xae, 0x0e, 0x2b, 0xaf, 0xae, 0x66, 0x20, 0xca, 0xab,
+    0xcc, 0x2c, 0x97, 0xa6, 0x3a, 0xac, 0x1f, 0x28, 0x63, 0xa7, 0x86, 0xad,
+    0x7a, 0xaa, 0xea, 0xa6, 0x5e, 0x2d, 0x1e, 0x2d, 0x25, 0xae, 0x3a, 0x29,
+    0xd9, 0xad, 0xc0, 0xa8, 0x4a, 0xa3, 0x1e, 0xae, 0xe2, 0x27, 0x1a, 0x22,
+    0xa8, 0x24, 0xc0, 0xae, 0x25, 0xac, 0x21, 0x2a, 0x6a, 0xa0, 0x76, 0x2c,
+    0xc9, 0x2d, 0xbe, 0xae, 0xea, 0x2d, 0xb9, 0xaa, 0xa7, 0xac, 0x29, 0xac,
+    0xd8, 0xa2, 0x91, 0x2d, 0xed, 0x2c, 0xff, 0xa8, 0xff, 0xae, 0xe9, 0xa7,
+    0x73, 0xae, 0x99, 0x28, 0x52, 0x24, 0x25, 0x9c, 0xbd, 0xa0, 0x9e, 0x31,
+    0x3e, 0x2e, 0x3a, 0x2f, 0x1d, 0xae, 0x0d, 0x97, 0x68, 0xaa, 0x83, 0x33,
+    0xaf, 0xa6, 0x03, 0x20, 0x09, 0xb1, 0x84, 0xaa, 0xc2, 0x22, 0x87, 0x32,
+    0xbe, 0x2f, 0x8c, 0x2c, 0xd6, 0xaf, 0x6a, 0xac, 0x4d, 0x29, 0xbc, 0x2c,
+    0x5d, 0x2a, 0x7d, 0xad, 0x79, 0xb0, 0xcb, 0x93, 0x40, 0x2f, 0xfa, 0x2c,
+    0x13, 0xac, 0x8f, 0xa9, 0x57, 0xb0, 0x5e, 0xa6, 0x52, 0xa9, 0xdd, 0x29,
+    0xc0, 0x2b, 0x53, 0x2d, 0x50, 0xb2, 0x52, 0x2f, 0x6f, 0x24, 0x1e, 0xaa,
+    0xd6, 0xa2, 0xa3, 0xac, 0x09, 0xac, 0xe2, 0x2c, 0xf3, 0x30, 0x54, 0xb0,
+    0x4c, 0x21, 0xd5, 0x2f, 0x98, 0xb0, 0xbb, 0x30, 0x51, 0x2f, 0x61, 0x2a,
+    0x71, 0x30, 0x2b, 0xad, 0x61, 0xac, 0x8a, 0x28, 0x4c, 0xa3, 0xa7, 0x2c,
+    0x18, 0x2e, 0xe6, 0xa6, 0x9a, 0xae, 0x4d, 0xa2, 0xf9, 0xaa, 0x13, 0x1e,
+    0xfe, 0x2e, 0xd2, 0xaa, 0x22, 0xaf, 0xea, 0xad, 0xc1, 0xac, 0xa1, 0x2a,
+    0x18, 0x31, 0xbe, 0xa8, 0x39, 0xb0, 0x9f, 0xa9, 0x9a, 0xac, 0x17, 0xac,
+    0xcf, 0x29, 0x2f, 0xae, 0xf9, 0x9f, 0x74, 0xaa, 0x41, 0x2e, 0x97, 0x28,
+    0x27, 0x30, 0x49, 0xa9, 0x2b, 0xb0, 0xc2, 0xb1, 0xdb, 0x1f, 0xf1, 0x28,
+    0xc6, 0x2e, 0x13, 0xaf, 0x24, 0x28, 0xd5, 0xb0, 0x1c, 0xa2, 0x1c, 0x1c,
+    0x8b, 0x2d, 0x10, 0xaf, 0xa0, 0xae, 0x9d, 0xb3, 0x7d, 0x9c, 0x0e, 0x29,
+    0x3f, 0x24, 0xca, 0x19, 0x45, 0xaf, 0x1d, 0xa9, 0xac, 0xb1, 0x8d, 0x2a,
+    0x3e, 0x2e, 0xe5, 0xa3, 0x4e, 0xae, 0xfa, 0x1d, 0xc6, 0xad, 0x8f, 0xb0,
+    0x20, 0x28, 0x03, 0xa8, 0x02, 0xb1, 0xae, 0x2c, 0xa8, 0xb0, 0xe0, 0x19,
+    0xa9, 0x28, 0x9a, 0xa9, 0xea, 0xad, 0xda, 0x2b, 0xd2, 0xa8, 0xa2, 0xaf,
+    0xda, 0xa1, 0x11, 0xaf, 0x85, 0xad, 0x96, 0x2c, 0xe6, 0x24, 0x8d, 0xac,
+    0xfb, 0x2d, 0x09, 0xaf, 0x75, 0xab, 0xa4, 0x25, 0xbd, 0x20, 0xc2, 0xac,
+    0x31, 0xa9, 0xc1, 0xa4, 0x4e, 0xb0, 0x79, 0x27, 0x54, 0xae, 0xdf, 0xae,
+    0x9c, 0x30, 0x34, 0xa6, 0x34, 0xb0, 0x87, 0x1b, 0xb2, 0x22, 0x85, 0xa8,
+    0x7b, 0xa6, 0x7f, 0x30, 0x23, 0x2f, 0xd8, 0xad, 0x4c, 0x29, 0xc9, 0xa2,
+    0xc5, 0xb0, 0x5f, 0x30, 0x67, 0xa3, 0xfb, 0xb0, 0x02, 0x25, 0xc6, 0xa4,
+    0x86, 0xb0, 0x0b, 0xa6, 0x9b, 0x2a, 0x67, 0xa7, 0xc2, 0xab, 0x1d, 0x2a,
+    0x48, 0xaa, 0xe5, 0x18, 0x3b, 0x2c, 0xa9, 0xb2, 0xed, 0xad, 0x08, 0x93,
+    0x4c, 0x28, 0x70, 0xa9, 0x6d, 0xaa, 0xbe, 0xb0, 0xaf, 0x26, 0x61, 0xa9,
+    0xb3, 0x29, 0xfe, 0xaa, 0x25, 0x20, 0x23, 0x28, 0x35, 0xac, 0x49, 0xa9,
+    0xfc, 0xa9, 0xca, 0xa9, 0x4e, 0xaa, 0xa7, 0xac, 0x3c, 0xa7, 0x49, 0x2d,
+    0xf5, 0x2d, 0x0e, 0xb0, 0x38, 0xb1, 0xa6, 0x26, 0xd8, 0xa8, 0x85, 0xaa,
+    0xa7, 0xae, 0x9c, 0xa6, 0x46, 0xa6, 0xc7, 0x22, 0x6d, 0xaa, 0x67, 0x2c,
+    0x88, 0x2a, 0x08, 0x25, 0x0d, 0xa9, 0xa3, 0xad, 0xa7, 0xa4, 0xff, 0xae,
+    0x43, 0x27, 0x02, 0x24, 0x00, 0x21, 0xa3, 0xa8, 0xc2, 0xaa, 0xed, 0x27,
+    0x2c, 0x20, 0x32, 0x29, 0x0d, 0x2a, 0xaf, 0xad, 0x38, 0x2a, 0xd6, 0xa7,
+    0x7d, 0xad, 0xe5, 0xa1, 0xd8, 0x2d, 0x37, 0xac, 0x5f, 0xa8, 0x94, 0xa9,
+    0x25, 0x2a, 0xdb, 0xad, 0xa5, 0x2b, 0x9b, 0xae, 0xe4, 0xae, 0x6d, 0x28,
+    0x91, 0x25, 0x5c, 0xa4, 0x2d, 0xaf, 0x9e, 0x24, 0x6d, 0xae, 0xc3, 0x26,
+    0x26, 0x2d, 0xa8, 0x2d, 0x5c, 0x28, 0x9a, 0xab, 0xd5, 0x9b, 0x9e, 0xa9,
+    0x87, 0xa7, 0x55, 0x29, 0xd4, 0x25, 0x56, 0x2a, 0x54, 0xa9, 0xbc, 0xa5,
+    0x12, 0x1c, 0x44, 0x27, 0xf5, 0x1b, 0xdd, 0xa6, 0xb5, 0xac, 0x52, 0xa8,
+    0x21, 0x2a, 0x9b, 0xa6, 0x38, 0xac, 0xaa, 0x1c, 0xf4, 0x2d, 0x23, 0x9b,
+    0xc2, 0x1a, 0x4a, 0xab, 0xd2, 0x2c, 0x8b, 0xac, 0x1e, 0xae, 0x7f, 0xa1,
+    0x1c, 0xa6, 0x57, 0x29, 0x93, 0x21, 0xbb, 0xae, 0xf1, 0x2e, 0x2d, 0xac,
+    0x68, 0xad, 0x8c, 0x2d, 0x74, 0xae, 0xce, 0x28, 0x6a, 0xab, 0x56, 0xa9,
+    0x95, 0x2a, 0x11, 0x24, 0x0f, 0x21, 0x10, 0x2c, 0xce, 0x2a, 0x49, 0x11,
+    0xc2, 0xac, 0x13, 0x29, 0x39, 0xac, 0x7f, 0x22, 0xe5, 0x9f, 0x9e, 0x2c,
+    0xd9, 0x2c, 0x34, 0x29, 0xd0, 0xac, 0xca, 0xad, 0x85, 0x28, 0xcd, 0xa1,
+    0xaf, 0xac, 0x22, 0x2a, 0xdd, 0x28, 0xdf, 0x9b, 0x30, 0xa6, 0x18, 0xac,
+    0x87, 0xae, 0xc1, 0x21, 0xcd, 0x24, 0x9c, 0x21, 0xea, 0xaa, 0x29, 0x2c,
+    0xf3, 0x16, 0x94, 0xa3, 0xd5, 0x29, 0x65, 0xae, 0xa1, 0xa3, 0xe2, 0x28,
+    0x4d, 0x2c, 0xa8, 0xad, 0x80, 0xa4, 0x16, 0xa8, 0x50, 0x9d, 0x06, 0x24,
+    0x65, 0x22, 0x00, 0x9f, 0xe4, 0xa8, 0x31, 0x2d, 0x11, 0x25, 0x2a, 0xad,
+    0x52, 0xa0, 0x43, 0x2a, 0x3c, 0x25, 0x23, 0x16, 0xbe, 0x2b, 0x0c, 0xa8,
+    0x46, 0xad, 0x54, 0xab, 0x41, 0xad, 0x10, 0x23, 0xed, 0x27, 0x94, 0x27,
+    0x58, 0xac, 0x9d, 0xab, 0x9f, 0xad, 0x6b, 0x2d, 0x90, 0x2c, 0x6f, 0x29,
+    0xc5, 0x24, 0xa0, 0xa4, 0x97, 0x24, 0x27, 0xa1, 0x4c, 0xac, 0xeb, 0x28,
+    0xea, 0xac, 0x66, 0xaa, 0xc6, 0x2a, 0x9f, 0xa6, 0x9f, 0xab, 0xde, 0xa4,
+    0x74, 0xab, 0x54, 0xaa, 0x4f, 0xae, 0xd9, 0xaa, 0xa7, 0x2d, 0xb6, 0x2a,
+    0x75, 0x28, 0x64, 0xae, 0x59, 0x22, 0x10, 0x24, 0x1a, 0x2a, 0x66, 0x2d,
+    0x27, 0x25, 0xe5, 0xa4, 0x13, 0x29, 0xf3, 0xa9, 0x53, 0x2d, 0x19, 0xa3,
+    0x8c, 0xa6, 0xd4, 0x28, 0x64, 0xae, 0x72, 0x2a, 0x67, 0xa1, 0x5c, 0xac,
+    0xe1, 0x2a, 0x05, 0x2c, 0xab, 0xa4, 0x08, 0xae, 0xd7, 0x2e, 0x06, 0xb0,
+    0xa4, 0xa9, 0x16, 0xb1, 0x80, 0xad, 0x18, 0x31, 0x29, 0x2c, 0x6c, 0xaf,
+    0xcb, 0xab, 0xd0, 0xa8, 0xf5, 0x2d, 0x83, 0x2f, 0xfc, 0x2e, 0xfd, 0xa5,
+    0xaa, 0xaf, 0x23, 0x30, 0x98, 0x28, 0x03, 0x97, 0x3b, 0x2c, 0x6b, 0x28,
+    0x33, 0xb0, 0xe1, 0x2b, 0x7b, 0x28, 0x60, 0x2c, 0xe8, 0xad, 0x5e, 0xad,
+    0x9e, 0xad, 0xb4, 0x32, 0x2a, 0x31, 0xd7, 0x26, 0xb3, 0xa4, 0xc6, 0x2d,
+    0xd1, 0xac, 0x07, 0x34, 0x67, 0x31, 0xef, 0x2d, 0x75, 0xad, 0xb2, 0x30,
+    0xd4, 0xa8, 0x36, 0x30, 0xa6, 0x30, 0x2f, 0x31, 0xf1, 0xae, 0xac, 0x2f,
+    0x20, 0xae, 0x33, 0x09, 0x2a, 0x2c, 0x80, 0x2d, 0x26, 0x2a, 0x5a, 0xae,
+    0x1c, 0xb0, 0xe5, 0xad, 0x0e, 0xb2, 0x62, 0x2d, 0x95, 0xad, 0x16, 0xa2,
+    0x37, 0x2a, 0xad, 0x2e, 0xe0, 0xb0, 0xd6, 0x2c, 0x6d, 0xad, 0xd9, 0xa7,
+    0x7d, 0x27, 0x8b, 0xac, 0x81, 0x1d, 0xed, 0xa8, 0xd4, 0x99, 0x21, 0x95,
+    0xe3, 0xaf, 0xda, 0x2d, 0x3e, 0xa4, 0xb4, 0x2a, 0xda, 0xac, 0x01, 0xa9,
+    0xb3, 0xaf, 0xc3, 0x2c, 0x62, 0xb0, 0x04, 0x28, 0x99, 0x2b, 0x72, 0xab,
+    0xa8, 0xae, 0x67, 0x30, 0x59, 0xa8, 0xf7, 0x26, 0xd8, 0xae, 0xf8, 0x26,
+    0xfb, 0xa3, 0x32, 0x25, 0xf5, 0x28, 0xd1, 0xa4, 0x40, 0x2d, 0x94, 0xa9,
+    0x89, 0x21, 0xab, 0x2a, 0x07, 0x2d, 0x7f, 0xaa, 0x3c, 0xae, 0x73, 0x29,
+    0xff, 0xad, 0x12, 0x2d, 0x82, 0x28, 0x3f, 0xad, 0xe7, 0xae, 0x3b, 0x2c,
+    0xae, 0xad, 0x45, 0x26, 0x95, 0x2e, 0xa8, 0xa6, 0xa3, 0x17, 0x83, 0xa9,
+    0xf2, 0x2d, 0x47, 0x29, 0xc9, 0xad, 0x9d, 0x2d, 0x6b, 0xab, 0x82, 0xac,
+    0x3c, 0x27, 0xa3, 0xa1, 0xdd, 0xad, 0xa8, 0xac, 0x57, 0x2a, 0x4a, 0x28,
+    0x24, 0xa6, 0x4e, 0xac, 0x9d, 0xac, 0xb8, 0xa8, 0xbe, 0xae, 0x37, 0x2c,
+    0x04, 0x2e, 0x84, 0xa6, 0x15, 0x28, 0x0a, 0x2c, 0x0a, 0xab, 0x2b, 0xa9,
+    0x35, 0x2e, 0xb7, 0xa8, 0x09, 0x25, 0x02, 0xac, 0x9f, 0xa9, 0x46, 0x1f,
+    0x80, 0xaa, 0xe3, 0x28, 0x09, 0x12, 0x3a, 0x2e, 0x51, 0x28, 0x22, 0x29,
+    0x9a, 0xad, 0x64, 0x2a, 0x67, 0xa6, 0x71, 0x2c, 0xd4, 0x2a, 0x19, 0x28,
+    0xef, 0xad, 0x02, 0x32, 0xd7, 0x2f, 0x4a, 0x30, 0x35, 0x2b, 0x0a, 0x1a,
+    0x18, 0xb2, 0x41, 0x31, 0x73, 0x30, 0x50, 0x31, 0x69, 0x2f, 0x32, 0xa0,
+    0x92, 0xb0, 0x13, 0x2b, 0x23, 0xa2, 0x04, 0x34, 0x70, 0x2b, 0xbc, 0x2d,
+    0x56, 0xb2, 0x52, 0xaa, 0x60, 0x28, 0xe1, 0x30, 0x41, 0x2f, 0x5a, 0xa2,
+    0x2c, 0xb1, 0xd0, 0xa2, 0xbe, 0xa7, 0x23, 0x31, 0xcd, 0xa9, 0xa2, 0xa4,
+    0x06, 0xb3, 0x3a, 0x1d, 0xee, 0xab, 0xd2, 0x2e, 0x3a, 0xae, 0xf6, 0x2c,
+    0xd0, 0xb1, 0x36, 0xa2, 0x98, 0xac, 0x00, 0x29, 0xea, 0xac, 0x29, 0x2d,
+    0x7d, 0x2b, 0x3d, 0xa4, 0xad, 0xb0, 0xfe, 0xaf, 0xa0, 0x2b, 0x93, 0xac,
+    0x88, 0x2a, 0x64, 0x9d, 0x01, 0xa1, 0x81, 0xa3, 0x06, 0x2d, 0xe3, 0xac,
+    0xfb, 0xb0, 0xd5, 0xa7, 0xf3, 0x1d, 0xc2, 0x29, 0xdf, 0x23, 0x10, 0x22,
+    0xdd, 0xad, 0xb0, 0xa9, 0x83, 0xb0, 0xdd, 0x2c, 0x33, 0x28, 0x66, 0xa8,
+    0x87, 0xb0, 0xb3, 0x2c, 0x2d, 0xa8, 0x0b, 0xa8, 0xff, 0x2a, 0xc7, 0xab,
+    0x47, 0xb0, 0xd1, 0x9d, 0xda, 0xaf, 0xfd, 0xae, 0xde, 0xaf, 0x2b, 0x2c,
+    0xf5, 0xaf, 0xa5, 0x2c, 0x40, 0xa1, 0x41, 0xac, 0x66, 0x9d, 0xeb, 0x27,
+    0x2e, 0x26, 0xae, 0x2e, 0x73, 0xa6, 0x7e, 0xa8, 0x60, 0xa6, 0x3a, 0x26,
+    0x66, 0x32, 0x01, 0xb0, 0x28, 0x27, 0x42, 0x2d, 0xf4, 0xaa, 0x38, 0x2c,
+    0xc5, 0x31, 0x02, 0xa6, 0x58, 0x2a, 0x33, 0x30, 0x6b, 0xa2, 0x7b, 0xad,
+    0x53, 0x32, 0x6e, 0x2e, 0x1c, 0x30, 0x4d, 0x25, 0x2d, 0xad, 0x6e, 0xa8,
+    0x1b, 0x31, 0xe9, 0x24, 0x0d, 0x32, 0xda, 0xa1, 0x8a, 0x24, 0x1c, 0xa8,
+    0x4e, 0x34, 0xa9, 0x2e, 0xef, 0x2f, 0x55, 0xa6, 0x0e, 0x1f, 0xd6, 0x29,
+    0x75, 0x33, 0x79, 0xa7, 0x37, 0x31, 0x6c, 0x1f, 0x07, 0xac, 0x34, 0xae,
+    0x79, 0x32, 0x6a, 0x2c, 0x71, 0x32, 0x35, 0x23, 0x4e, 0x16, 0xb9, 0xa8,
+    0x0f, 0x34, 0x2a, 0x2f, 0xc2, 0x2c, 0x0f, 0xb0, 0x4d, 0xa3, 0x62, 0x2a,
+    0x97, 0x29, 0xcf, 0x2c, 0xfd, 0x29, 0xff, 0xac, 0x5b, 0xae, 0xda, 0x27,
+    0xdd, 0x2d, 0xb6, 0x2b, 0x1d, 0xad, 0x53, 0xa9, 0xe8, 0x9c, 0x4c, 0x1d,
+    0xe7, 0xab, 0xc3, 0xa9, 0x5c, 0xa8, 0x2e, 0xa1, 0xb8, 0x28, 0x40, 0xa1,
+    0x22, 0xa4, 0x14, 0xa9, 0x1f, 0x2d, 0x32, 0xac, 0xb7, 0xad, 0x24, 0xae,
+    0x4e, 0x26, 0x41, 0xa2, 0x21, 0xac, 0x68, 0xa9, 0xa1, 0x26, 0xa9, 0xa9,
+    0x94, 0xab, 0xaf, 0x2b, 0x18, 0xa9, 0x1e, 0xaa, 0x44, 0x28, 0x2e, 0x29,
+    0x94, 0x26, 0x97, 0xac, 0xa7, 0xad, 0x39, 0xa1, 0xaa, 0xa6, 0xc1, 0xa9,
+    0x17, 0xad, 0x5c, 0x25, 0x9b, 0xac, 0xe2, 0x2c, 0x24, 0xad, 0x28, 0xac,
+    0xa3, 0x26, 0x12, 0xab, 0xb4, 0xa4, 0x2f, 0x1e, 0x3d, 0xad, 0x7c, 0xa6,
+    0x18, 0xab, 0xf9, 0xa8, 0xde, 0xaa, 0x89, 0x30, 0xc2, 0x29, 0xb3, 0x2e,
+    0xb8, 0x29, 0xe0, 0x2a, 0x7a, 0xa6, 0x8b, 0x30, 0xe5, 0x2a, 0x15, 0x26,
+    0x00, 0xaf, 0xd8, 0x25, 0x61, 0x2e, 0x05, 0x2f, 0x71, 0xa8, 0x9f, 0x23,
+    0xfc, 0x29, 0x42, 0xad, 0x73, 0xac, 0x0a, 0x29, 0x78, 0x1a, 0x18, 0x20,
+    0x13, 0xaf, 0x37, 0xa6, 0xfb, 0xa9, 0xe6, 0x30, 0x42, 0xac, 0xcb, 0x20,
+    0x14, 0x2b, 0x2b, 0xaa, 0x88, 0x1e, 0x9e, 0x2f, 0x01, 0x1a, 0xe9, 0x2f,
+    0x15, 0x2a, 0xac, 0xab, 0xca, 0xab, 0x9c, 0x31, 0x35, 0xac, 0x2e, 0x31,
+    0xd5, 0x1f, 0x45, 0xaa, 0x2d, 0xa7, 0x6f, 0xb0, 0x87, 0x22, 0x93, 0x2f,
+    0x7b, 0xaa, 0x2f, 0xac, 0xce, 0xa8, 0x63, 0xb2, 0x15, 0xa4, 0x04, 0xab,
+    0x17, 0x2b, 0x68, 0x29, 0xf7, 0xb0, 0xd2, 0xaf, 0x7c, 0xa8, 0xdd, 0x2c,
+    0x9d, 0x2e, 0x1f, 0x33, 0x73, 0x29, 0x7d, 0xa9, 0x8f, 0xad, 0x24, 0xb0,
+    0xaf, 0x2d, 0x60, 0x2b, 0x08, 0xae, 0x0a, 0xae, 0x23, 0x2c, 0x77, 0xa8,
+    0x7c, 0x2c, 0x8b, 0x2a, 0x5a, 0x24, 0x2e, 0x2c, 0x5a, 0xac, 0x00, 0xa5,
+    0x11, 0x31, 0xd7, 0x32, 0x01, 0x1a, 0xe4, 0x1c, 0x0d, 0x2e, 0xf8, 0xa2,
+    0x5e, 0x33, 0xa8, 0x31, 0x38, 0x28, 0x0a, 0xb1, 0x4e, 0xae, 0x02, 0x19,
+    0x99, 0xb1, 0x84, 0x29, 0xf2, 0x2d, 0xe6, 0x2d, 0xf1, 0xad, 0x88, 0x2a,
+    0x67, 0xad, 0xbf, 0xad, 0x57, 0x30, 0x49, 0x99, 0xf3, 0xa6, 0x7c, 0xae,
+    0x6c, 0xa3, 0x37, 0xb2, 0x92, 0x2a, 0xe2, 0x30, 0xf3, 0xa7, 0x3a, 0x2c,
+    0x7a, 0xb2, 0x25, 0xb1, 0xf3, 0xa4, 0xfd, 0x20, 0x07, 0xa6, 0x9c, 0xa8,
+    0xbd, 0xac, 0xb1, 0x2d, 0x3b, 0xa0, 0x6d, 0x2a, 0x4a, 0x2d, 0xee, 0xac,
+    0x2b, 0xab, 0x69, 0x35, 0xcb, 0xb1, 0x19, 0x31, 0xc8, 0x2d, 0x4a, 0xa7,
+    0xed, 0xae, 0x37, 0x36, 0xf3, 0xac, 0x2d, 0x31, 0xa0, 0x29, 0x79, 0x29,
+    0x96, 0xb1, 0xf2, 0x32, 0xcd, 0x30, 0x62, 0xa5, 0x79, 0xb0, 0x1b, 0xb0,
+    0xc7, 0xaf, 0x7e, 0x22, 0x80, 0xaf, 0xdd, 0xaf, 0xd4, 0x24, 0x83, 0x2b,
+    0xdb, 0x24, 0x87, 0x2d, 0x6e, 0xa3, 0x16, 0x24, 0xe9, 0xa9, 0x79, 0x2d,
+    0x40, 0xb0, 0x39, 0xab, 0x66, 0xae, 0x88, 0x2f, 0xf1, 0xac, 0x9e, 0xae,
+    0x57, 0xa9, 0x02, 0xa2, 0xca, 0xa8, 0x0d, 0xa1, 0xc4, 0x2a, 0xf1, 0xa7,
+    0x33, 0xaa, 0x26, 0xad, 0x12, 0x2a, 0xd0, 0x27, 0x8c, 0x2d, 0xbc, 0xaf,
+    0xad, 0xae, 0x2b, 0xa3, 0x24, 0xa5, 0xc5, 0xa6, 0x5c, 0x28, 0x3f, 0x29,
+    0x3b, 0xae, 0x82, 0x28, 0xc1, 0xaa, 0x2b, 0x2f, 0x31, 0xad, 0x04, 0x2a,
+    0x78, 0xac, 0x59, 0x29, 0x25, 0x28, 0xb4, 0x2f, 0x23, 0xad, 0x20, 0xad,
+    0x71, 0xb1, 0x92, 0xa5, 0x3b, 0xa0, 0x15, 0x2c, 0xf1, 0x22, 0xc8, 0xa8,
+    0x96, 0xac, 0xa4, 0x2c, 0x69, 0x28, 0x9b, 0x2d, 0xdf, 0x16, 0xd5, 0xac,
+    0x7d, 0xa8, 0xe9, 0x2b, 0x8a, 0xac, 0x53, 0x9f, 0x88, 0x2c, 0xba, 0x26,
+    0xa4, 0xb0, 0x9f, 0xa6, 0x02, 0x28, 0x19, 0xad, 0x75, 0xac, 0x1b, 0x20,
+    0xa9, 0xae, 0x3e, 0xa8, 0x10, 0xa1, 0x47, 0x9c, 0x46, 0x2c, 0x5f, 0x2e,
+    0x57, 0x2a, 0x31, 0x2c, 0xb2, 0x2c, 0xb2, 0x2b, 0x97, 0xa9, 0x02, 0x28,
+    0xa6, 0xad, 0x89, 0x25, 0xcf, 0x30, 0xa6, 0xae, 0xc8, 0x2a, 0x50, 0xad,
+    0x1e, 0x13, 0x8f, 0xb1, 0x93, 0x28, 0xea, 0xac, 0x7f, 0x26, 0x37, 0x2b,
+    0xa2, 0x2a, 0x51, 0xaf, 0x2d, 0xaf, 0x4d, 0x2d, 0x80, 0xa4, 0x94, 0x2b,
+    0xae, 0xa5, 0x0e, 0x2b, 0x97, 0x28, 0xe9, 0xab, 0xc2, 0xae, 0x9e, 0xa5,
+    0xbc, 0xae, 0x49, 0xa8, 0x02, 0x2a, 0x9a, 0x29, 0xc7, 0xa8, 0x0f, 0x2d,
+    0x1c, 0x98, 0x14, 0x2c, 0x64, 0xab, 0x47, 0x20, 0x5c, 0xac, 0xb0, 0xaa,
+    0x30, 0xa4, 0x85, 0x2d, 0x7e, 0xa9, 0xca, 0xa9, 0xb3, 0x2a, 0x8a, 0xac,
+    0x89, 0xad, 0x73, 0xae, 0x54, 0x28, 0xe6, 0x28, 0xd8, 0x27, 0xe6, 0xad,
+    0x7e, 0xac, 0xfb, 0x2d, 0x49, 0xae, 0x6d, 0xa9, 0x13, 0xa6, 0x3b, 0xad,
+    0xd6, 0xa4, 0x4b, 0xa5, 0xe3, 0xaa, 0x5d, 0x2a, 0x2f, 0xa9, 0xaf, 0xad,
+    0x6b, 0xad, 0x83, 0x2d, 0x1b, 0x28, 0xce, 0x2a, 0xfc, 0xa4, 0x22, 0x29,
+    0xe2, 0xaa, 0xc4, 0xa8, 0xdb, 0xa6, 0xa8, 0x9c, 0x04, 0xab, 0x7e, 0x2d,
+    0x03, 0x25, 0xeb, 0xa1, 0x00, 0xab, 0x2e, 0xab, 0x00, 0x24, 0x31, 0x22,
+    0x2e, 0x22, 0x71, 0xad, 0x0b, 0xad, 0xa9, 0xa7, 0x23, 0xaa, 0x62, 0xac,
+    0x2f, 0xac, 0x6b, 0x2e, 0x4b, 0x2d, 0xba, 0x2d, 0x39, 0xa1, 0x30, 0xa9,
+    0x3f, 0x2d, 0xea, 0xa4, 0x47, 0xae, 0x67, 0x2e, 0xa6, 0xad, 0x13, 0xa5,
+    0x4c, 0xac, 0x3c, 0x27, 0x6b, 0xa5, 0xab, 0x29, 0x50, 0xa7, 0x96, 0xa0,
+    0xef, 0xa2, 0x24, 0xad, 0x40, 0xad, 0xb9, 0x24, 0xcf, 0x20, 0x70, 0xa9,
+    0xa2, 0x29, 0x7d, 0xb0, 0x03, 0x21, 0xe3, 0x20, 0x04, 0x2f, 0x17, 0xad,
+    0x08, 0xb0, 0x46, 0x29, 0x22, 0x2e, 0x35, 0x30, 0x35, 0x2e, 0xa0, 0x26,
+    0x64, 0xaa, 0xa6, 0x2c, 0xac, 0x30, 0xd6, 0xad, 0x48, 0xab, 0x54, 0xac,
+    0xe9, 0x2c, 0x6c, 0x32, 0xd8, 0x33, 0xc4, 0xb0, 0x69, 0xac, 0x99, 0x2b,
+    0x3f, 0x2f, 0x13, 0x31, 0x2a, 0x21, 0xeb, 0xa0, 0xcc, 0xaf, 0x57, 0x2e,
+    0xc6, 0x24, 0x5a, 0x2f, 0x86, 0x28, 0xca, 0xa7, 0x69, 0xb0, 0xc1, 0x2f,
+    0x20, 0xa5, 0xa8, 0xa5, 0x30, 0xa4, 0xaa, 0x25, 0xef, 0xae, 0x1a, 0x2c,
+    0xb8, 0xac, 0xa8, 0xb0, 0x94, 0xa9, 0x49, 0x31, 0x47, 0xaa, 0xa4, 0xac,
+    0x60, 0x2a, 0x7d, 0xaf, 0xdc, 0xad, 0x4c, 0x28, 0x58, 0x28, 0xa0, 0xa1,
+    0xf0, 0x26, 0xd0, 0xb0, 0x19, 0x9b, 0x12, 0x0f, 0x21, 0x18, 0x8e, 0xa5,
+    0x6c, 0xb0, 0xb8, 0xb1, 0x28, 0xaf, 0x5d, 0x2b, 0x9c, 0xaa, 0x9d, 0x27,
+    0x1a, 0xae, 0xfa, 0xb0, 0x9a, 0xaa, 0x51, 0x2e, 0x5a, 0xa9, 0x9a, 0x22,
+    0xa9, 0xb1, 0xc3, 0xac, 0xe1, 0x29, 0xfb, 0x2d, 0x9c, 0xa9, 0x0f, 0xab,
+    0x75, 0xb2, 0x9d, 0xaf, 0xe6, 0x30, 0x7d, 0x2d, 0xa6, 0x2d, 0x7d, 0x28,
+    0x38, 0xa3, 0xa3, 0x19, 0xc6, 0x31, 0xda, 0xa8, 0x16, 0xad, 0x66, 0xa8,
+    0x44, 0xb1, 0x04, 0x2c, 0x7a, 0x30, 0xb8, 0x2a, 0x21, 0xb1, 0x37, 0x24,
+    0xc9, 0xab, 0x90, 0x19, 0x0f, 0x26, 0xfb, 0xab, 0xa9, 0xb0, 0xbb, 0x2d,
+    0xd8, 0x2d, 0x6c, 0x2a, 0x97, 0xaa, 0xb8, 0xaf, 0x54, 0x21, 0x46, 0xaa,
+    0x35, 0x9c, 0x14, 0x2e, 0x2a, 0x1e, 0xc0, 0xa8, 0x70, 0xa5, 0x17, 0x2a,
+    0xb8, 0xa1, 0xaa, 0xa2, 0x4a, 0x24, 0xc8, 0xaa, 0x65, 0xb0, 0x1e, 0x2d,
+    0x3c, 0x2d, 0xd8, 0x18, 0x32, 0xae, 0x17, 0xaf, 0xfa, 0xad, 0x68, 0xa8,
+    0x15, 0x2a, 0x3e, 0x2a, 0xcc, 0xaf, 0x68, 0xaf, 0x14, 0xb1, 0x62, 0x28,
+    0xb9, 0xad, 0x01, 0x2c, 0x1b, 0xa3, 0xb5, 0x29, 0x7b, 0xa9, 0x2b, 0x2d,
+    0x78, 0x28, 0xdf, 0x1c, 0x43, 0xaf, 0x4f, 0x23, 0x9d, 0xac, 0xe3, 0xa8,
+    0x8f, 0xad, 0xe7, 0xa8, 0x88, 0xab, 0xc2, 0x21, 0x41, 0x2e, 0x28, 0x21,
+    0x9d, 0xa4, 0xdd, 0xad, 0xdc, 0xac, 0xb3, 0x2d, 0xb5, 0x2a, 0xa8, 0xa8,
+    0x9d, 0x2c, 0x61, 0x1c, 0x32, 0xaa, 0x41, 0xac, 0xed, 0x2d, 0xb4, 0xac,
+    0x5f, 0xa9, 0x31, 0xac, 0xd7, 0xad, 0x26, 0x29, 0xaf, 0xa6, 0x41, 0xab,
+    0x23, 0x1d, 0xfd, 0x25, 0x21, 0x98, 0x7d, 0xae, 0x6c, 0x0d, 0x9b, 0x29,
+    0xcf, 0x2a, 0x30, 0x2c, 0x23, 0xa6, 0x7f, 0x2d, 0x07, 0x25, 0xa5, 0xac,
+    0x9b, 0x26, 0x62, 0xaa, 0xb8, 0xae, 0x52, 0x2c, 0x2f, 0xaa, 0xef, 0xac,
+    0x6d, 0x2b, 0x5b, 0x2d, 0x96, 0x28, 0xdc, 0xac, 0xc2, 0xae, 0x48, 0xa8,
+    0x60, 0x2b, 0x18, 0x28, 0x13, 0xac, 0x95, 0x9f, 0x96, 0xad, 0x2b, 0x8b,
+    0xf0, 0xae, 0x6b, 0x24, 0x1e, 0xae, 0xe8, 0x2a, 0x8e, 0x94, 0x18, 0xac,
+    0x11, 0xb0, 0xbf, 0x2c, 0x26, 0xad, 0x15, 0x2e, 0x52, 0xae, 0xe4, 0xa8,
+    0xb1, 0xa4, 0xc5, 0xa9, 0x7e, 0xac, 0x4c, 0x2f, 0x80, 0xa1, 0xfd, 0x2b,
+    0x21, 0x27, 0x0f, 0x2c, 0xaa, 0x2d, 0x4a, 0x2c, 0xf0, 0xa9, 0x42, 0xa7,
+    0x3e, 0xaf, 0x93, 0xa5, 0x24, 0xab, 0xa2, 0x27, 0xae, 0xa0, 0x23, 0xa8,
+    0xc6, 0x29, 0x79, 0x29, 0x05, 0xad, 0xf5, 0x2b, 0x7f, 0xac, 0x28, 0x2c,
+    0x76, 0xa9, 0x16, 0xae, 0xab, 0x2d, 0xfe, 0x26, 0xec, 0xa6, 0x6d, 0xac,
+    0x7d, 0xa8, 0xf4, 0xae, 0xa4, 0x2e, 0x43, 0xb0, 0x41, 0x27, 0x88, 0xae,
+    0x52, 0x23, 0x26, 0xa0, 0xa5, 0x2d, 0x20, 0xb0, 0x49, 0xad, 0xff, 0xa4,
+    0x12, 0x2c, 0x59, 0xac, 0x45, 0xad, 0x82, 0xb0, 0x87, 0xad, 0x16, 0xaa,
+    0x19, 0xa9, 0x99, 0x1d, 0xac, 0xab, 0xe8, 0xb0, 0x78, 0x27, 0x95, 0x27,
+    0xf8, 0x2c, 0xd1, 0x17, 0x8c, 0x2b, 0x39, 0xb0, 0xb9, 0xb0, 0x51, 0x26,
+    0x19, 0xaf, 0x2b, 0x2d, 0x43, 0x2c, 0x7a, 0xa3, 0x12, 0xb1, 0xb1, 0x28,
+    0xa0, 0xab, 0x34, 0xaf, 0x80, 0x2b, 0x92, 0xa7, 0x68, 0xb0, 0x9f, 0xa8,
+    0xc7, 0xa8, 0xe2, 0xa0, 0xc7, 0x2c, 0x61, 0x23, 0xee, 0xad, 0xf5, 0x2d,
+    0xd2, 0xac, 0x07, 0x17, 0x93, 0xac, 0x60, 0xa5, 0xa4, 0xad, 0x94, 0xab,
+    0xda, 0x25, 0x48, 0xae, 0x27, 0x2c, 0xf4, 0x2a, 0x7f, 0x24, 0x2a, 0x2b,
+    0x03, 0x2d, 0x02, 0x2a, 0x5e, 0x94, 0xd5, 0xad, 0x14, 0x26, 0x7e, 0xaa,
+    0xcc, 0xa8, 0xce, 0xa5, 0x73, 0xad, 0xa0, 0xaa, 0x19, 0xae, 0xb5, 0xa4,
+    0x27, 0x26, 0xf5, 0x29, 0x3f, 0xa4, 0x6b, 0xa7, 0x5d, 0xad, 0x8c, 0xa7,
+    0x57, 0x9d, 0x81, 0x27, 0x46, 0x2c, 0xf6, 0x21, 0xf3, 0x29, 0x4c, 0xaa,
+    0x27, 0x2b, 0xff, 0xaa, 0x7b, 0xa8, 0x7e, 0x2d, 0x98, 0x23, 0xd9, 0xa7,
+    0xb3, 0x2b, 0x44, 0x2c, 0x0b, 0xab, 0xc0, 0xae, 0x41, 0x21, 0xe2, 0xae,
+    0x5c, 0x2d, 0x96, 0xab, 0x8b, 0xaf, 0xf3, 0xac, 0xec, 0x2b, 0x65, 0xad,
+    0x5a, 0x2d, 0x79, 0xaa, 0x2f, 0xaf, 0xce, 0xad, 0x0a, 0x28, 0x70, 0xa2,
+    0xef, 0xac, 0xd4, 0x2b, 0x69, 0xac, 0xd7, 0xaf, 0xb0, 0xa4, 0xc5, 0xa5,
+    0xfe, 0xa9, 0x84, 0x2a, 0x45, 0x2e, 0x4d, 0x2b, 0xe7, 0x2a, 0x89, 0xac,
+    0x5d, 0x2c, 0x2d, 0x2d, 0xde, 0xac, 0xc4, 0x2d, 0xb0, 0xac, 0x7c, 0xac,
+    0x64, 0x2f, 0x99, 0x34, 0xe8, 0x2b, 0xf2, 0xa7, 0x05, 0x2d, 0x22, 0x29,
+    0xd0, 0x24, 0x2d, 0x35, 0x3e, 0x28, 0x83, 0xa8, 0xaf, 0xab, 0x67, 0x2e,
+    0x1b, 0x17, 0xfd, 0x32, 0x79, 0x22, 0x21, 0x2e, 0xd1, 0xa7, 0xdd, 0xae,
+    0xd5, 0xab, 0xc9, 0x1c, 0x1c, 0x2c, 0xc1, 0xa9, 0x01, 0x26, 0x96, 0xb0,
+    0x90, 0xae, 0xe8, 0x2a, 0xa6, 0xa5, 0x00, 0x1f, 0x93, 0x2c, 0x63, 0xab,
+    0x66, 0xad, 0xad, 0x20, 0x83, 0xab, 0x52, 0xaa, 0x27, 0x1b, 0x63, 0xa4,
+    0xc3, 0xab, 0xfe, 0xab, 0x98, 0xad, 0x9a, 0xaa, 0x4f, 0x2d, 0x95, 0xb0,
+    0x6c, 0xad, 0x9b, 0xaa, 0x4d, 0x2b, 0xcc, 0x2b, 0xef, 0xa5, 0x71, 0xb1,
+    0x2f, 0x24, 0x37, 0xaa, 0xf9, 0x2a, 0x64, 0x2b, 0xcf, 0x9f, 0xb3, 0xb1,
+    0xc1, 0xac, 0xd4, 0x29, 0xc6, 0x27, 0xd7, 0x23, 0x33, 0x29, 0xc9, 0xae,
+    0x57, 0x27, 0xaa, 0x28, 0x6c, 0xad, 0x8e, 0x2c, 0x46, 0x29, 0x93, 0xa9,
+    0xa1, 0x2d, 0x9f, 0xad, 0xd9, 0x2b, 0xeb, 0xa5, 0x98, 0xa7, 0x85, 0x20,
+    0xb5, 0xad, 0x78, 0xae, 0xe9, 0x2a, 0x21, 0xa8, 0x51, 0x29, 0x42, 0x29,
+    0x57, 0x2e, 0xb9, 0x24, 0xd6, 0x29, 0x09, 0xac, 0x17, 0xa7, 0xd1, 0xad,
+    0x90, 0xa7, 0x5b, 0x2a, 0x77, 0xae, 0xe1, 0xa9, 0xb2, 0xac, 0x01, 0x2e,
+    0xb7, 0x1c, 0x53, 0xa6, 0x1f, 0xac, 0xf5, 0x29, 0x2d, 0x2e, 0x3c, 0x2c,
+    0x5a, 0xad, 0x1e, 0x20, 0xda, 0xa6, 0xa4, 0x24, 0x50, 0x15, 0xb7, 0x29,
+    0x68, 0x22, 0xb0, 0xac, 0xbc, 0xa8, 0x7f, 0x2e, 0x27, 0xac, 0xbd, 0x2b,
+    0x66, 0xac, 0xe1, 0xae, 0x9c, 0xae, 0x32, 0x2c, 0x50, 0x2e, 0xbf, 0xac,
+    0x38, 0x2e, 0x39, 0x29, 0x64, 0x2a, 0xe9, 0xb2, 0xd4, 0x29, 0xc7, 0x2c,
+    0x66, 0x2f, 0xd4, 0x30, 0x65, 0x29, 0xbb, 0xb2, 0x89, 0xaa, 0x8c, 0xa9,
+    0xe5, 0x2c, 0xb9, 0x2d, 0x62, 0x25, 0xe9, 0xb3, 0xdd, 0x1d, 0x75, 0xa1,
+    0xaf, 0xa5, 0x35, 0x30, 0xa5, 0x2f, 0xc0, 0xb3, 0xf0, 0x2c, 0x1f, 0xa9,
+    0x37, 0x2e, 0x83, 0x30, 0x59, 0x1f, 0x20, 0xb3, 0xcb, 0xad, 0xae, 0x23,
+    0xdd, 0x2e, 0x59, 0x1f, 0x73, 0xaa, 0x54, 0xab, 0xd6, 0x2a, 0x8c, 0x1d,
+    0xfc, 0xa9, 0x73, 0x21, 0x4d, 0xa5, 0xf1, 0xae, 0x24, 0x23, 0xe9, 0x2c,
+    0x51, 0x2f, 0x5c, 0x2d, 0x10, 0x28, 0x97, 0xaf, 0xc9, 0x2b, 0x01, 0x2d,
+    0x0d, 0x28, 0x9c, 0x9a, 0x0b, 0x1d, 0xaa, 0x14, 0x4d, 0x9f, 0xd1, 0xac,
+    0x82, 0x20, 0x08, 0xa2, 0x98, 0x2d, 0xa0, 0xac, 0x9a, 0xa7, 0xde, 0x94,
+    0x99, 0xac, 0xb9, 0x2a, 0xf4, 0x2c, 0x0c, 0xad, 0xa7, 0x24, 0x49, 0xa1,
+    0xe1, 0xad, 0xfc, 0xa4, 0x08, 0xa9, 0x58, 0xa9, 0x03, 0xae, 0x96, 0x2d,
+    0x30, 0xad, 0x12, 0x2d, 0x43, 0x26, 0xb6, 0x16, 0x95, 0xae, 0x48, 0x29,
+    0x8e, 0xae, 0x74, 0xac, 0x26, 0xa7, 0x48, 0x9f, 0xa2, 0x28, 0xde, 0x2d,
+    0x6d, 0x2e, 0x2b, 0xae, 0x6d, 0xa4, 0xa4, 0x18, 0x30, 0xa2, 0xb5, 0x9a,
+    0x5c, 0x26, 0x64, 0x2d, 0xe4, 0xab, 0x47, 0xad, 0x09, 0x28, 0x17, 0x25,
+    0x77, 0xa8, 0x7a, 0x32, 0x39, 0x26, 0x54, 0xad, 0x1c, 0x1b, 0x2a, 0x2c,
+    0xbf, 0xb1, 0x07, 0x2e, 0x75, 0x2c, 0xa5, 0xaa, 0xf8, 0x2a, 0x9a, 0x1e,
+    0x37, 0xb0, 0x36, 0x30, 0xe5, 0x31, 0xa9, 0xa2, 0x7d, 0x2b, 0x35, 0x25,
+    0xdc, 0x20, 0xc9, 0x2a, 0xf3, 0x28, 0x5e, 0x27, 0x26, 0x26, 0x5c, 0xae,
+    0xa5, 0x2a, 0x63, 0x33, 0x31, 0x30, 0xc3, 0xac, 0x47, 0xad, 0x7a, 0x2c,
+    0x10, 0x9e, 0xce, 0x31, 0xa2, 0x2c, 0xe1, 0xb1, 0x62, 0x29, 0x4a, 0x29,
+    0x4c, 0x2b, 0xe4, 0xab, 0x39, 0x28, 0x85, 0xac, 0x0a, 0xac, 0xe3, 0x29,
+    0x7f, 0x2d, 0xfd, 0x28, 0xba, 0xb0, 0x41, 0xb2, 0x23, 0xab, 0x16, 0x2c,
+    0x5f, 0x2a, 0x42, 0xb3, 0x91, 0xb3, 0x97, 0x2f, 0x9e, 0xa0, 0x34, 0xad,
+    0xca, 0x96, 0x9c, 0xb1, 0xff, 0xb0, 0x23, 0x2a, 0xec, 0xae, 0xa6, 0xa5,
+    0x7f, 0x28, 0xc8, 0x26, 0x9b, 0xae, 0x49, 0x32, 0xcf, 0x2c, 0xc2, 0x23,
+    0x16, 0x2c, 0x17, 0xac, 0x03, 0xb1, 0x78, 0x30, 0x30, 0x2d, 0x40, 0xac,
+    0xf1, 0x24, 0x04, 0xa5, 0x9f, 0x25, 0xc8, 0x24, 0x99, 0x2e, 0x28, 0x9f,
+    0x90, 0x32, 0x29, 0x31, 0x8c, 0xa4, 0x92, 0x2c, 0x0a, 0xad, 0x37, 0xa9,
+    0x2c, 0x31, 0x5a, 0x34, 0x07, 0x2e, 0xd8, 0x2f, 0x0d, 0x92, 0x19, 0x2d,
+    0x42, 0x96, 0xcb, 0x31, 0xc5, 0x2f, 0x65, 0xa7, 0xb8, 0xae, 0x4d, 0xac,
+    0x03, 0xb0, 0x55, 0xa0, 0x12, 0xa7, 0x9b, 0xa1, 0x61, 0xa6, 0x5d, 0xab,
+    0x37, 0xac, 0x02, 0xb0, 0xac, 0x2d, 0xea, 0x2e, 0xf3, 0xae, 0x7e, 0xa6,
+    0xc0, 0xae, 0x02, 0x25, 0xc6, 0x2c, 0x41, 0xad, 0x47, 0xa9, 0x12, 0x2d,
+    0xc2, 0xa8, 0xc2, 0xb0, 0xdb, 0x2c, 0x02, 0x2d, 0x68, 0xac, 0x7f, 0x24,
+    0x4a, 0xad, 0x48, 0xae, 0xf5, 0xaa, 0xf7, 0x1c, 0x6e, 0x2f, 0x92, 0xa7,
+    0x7f, 0xa8, 0x20, 0xb0, 0x3d, 0xa5, 0x55, 0x2f, 0x23, 0xaa, 0x3a, 0x1f,
+    0x7c, 0xae, 0x29, 0xa7, 0x2f, 0xad, 0x40, 0x21, 0x6c, 0xa0, 0x05, 0xb0,
+    0x25, 0xb1, 0x04, 0xac, 0x28, 0x9d, 0x08, 0x31, 0x86, 0xad, 0x1a, 0x2b,
+    0xb4, 0x20, 0xa0, 0x2b, 0x25, 0xa9, 0x9c, 0xa8, 0x45, 0xa6, 0x22, 0x2e,
+    0x0e, 0x21, 0x20, 0x29, 0x3d, 0xae, 0x3a, 0xaa, 0xcc, 0xa7, 0x72, 0x2c,
+    0x20, 0xad, 0xeb, 0xac, 0x62, 0x2c, 0x02, 0xae, 0x07, 0x2b, 0x79, 0x29,
+    0xc3, 0x2d, 0x72, 0xaa, 0x97, 0xae, 0xde, 0x2c, 0xb7, 0x9b, 0xab, 0x96,
+    0xdc, 0xa9, 0xf8, 0x29, 0xa3, 0xa9, 0x14, 0x29, 0x69, 0xab, 0x4b, 0xad,
+    0x49, 0xac, 0xc2, 0x2c, 0x16, 0x1e, 0x52, 0x2b, 0x74, 0xad, 0xd0, 0x28,
+    0xc8, 0x24, 0x96, 0xa4, 0x01, 0xac, 0x90, 0xac, 0xdd, 0xad, 0x02, 0x23,
+    0xb8, 0xa8, 0x53, 0xad, 0x0e, 0xaf, 0x9d, 0x27, 0xba, 0x2b, 0xb1, 0x21,
+    0x5b, 0x2d, 0xd6, 0x2a, 0xd1, 0x28, 0x89, 0x28, 0x02, 0x24, 0x7c, 0xa8,
+    0xa1, 0x29, 0x3a, 0x28, 0x7c, 0xad, 0xfc, 0xac, 0xa8, 0x2a, 0xf2, 0x24,
+    0x55, 0xa2, 0xf4, 0xaa, 0x28, 0x2a, 0xa2, 0x28, 0x32, 0xaf, 0x96, 0x28,
+    0x6a, 0x2d, 0x9f, 0xae, 0x54, 0xae, 0xf3, 0xad, 0xc5, 0xa5, 0x1b, 0x2a,
+    0x60, 0x29, 0xa4, 0xa8, 0x62, 0xaf, 0xe0, 0xa6, 0xd8, 0xa8, 0x4c, 0xa8,
+    0xad, 0xa1, 0x93, 0xab, 0x65, 0xad, 0x2c, 0x2c, 0x22, 0x27, 0x70, 0xa0,
+    0x2a, 0xa9, 0xc4, 0xad, 0x89, 0x1c, 0x12, 0xa2, 0x0b, 0x24, 0x4d, 0xab,
+    0x99, 0xac, 0xb7, 0x2b, 0x55, 0xaf, 0xcc, 0xa8, 0x0b, 0xa8, 0xb0, 0xa3,
+    0xdb, 0x34, 0x16, 0x28, 0x99, 0xa5, 0x61, 0x26, 0x1c, 0xae, 0x5f, 0x21,
+    0xf7, 0x33, 0x6c, 0xad, 0x0a, 0x11, 0x6f, 0x27, 0xbc, 0x2c, 0x34, 0x30,
+    0x7c, 0x2c, 0x16, 0x25, 0x03, 0x19, 0xe9, 0x26, 0x14, 0x2d, 0x1e, 0x2c,
+    0x81, 0x32, 0x95, 0xa9, 0xe5, 0x31, 0xaa, 0x2d, 0x31, 0xa9, 0x1f, 0x27,
+    0x5e, 0x30, 0x26, 0xa8, 0x6e, 0x2d, 0x94, 0x30, 0xe2, 0xa3, 0x28, 0xa6,
+    0xa5, 0x2c, 0x3a, 0x32, 0x8f, 0x30, 0xf3, 0x2c, 0xc1, 0x2b, 0x7c, 0x2e,
+    0x97, 0x29, 0xe0, 0x2d, 0x2d, 0x31, 0xe3, 0xac, 0xbf, 0xaa, 0x1a, 0x2c,
+    0x9f, 0x2e, 0x3f, 0x31, 0x42, 0x9e, 0x87, 0x2a, 0x9c, 0x2a, 0x88, 0xaa,
+    0xb5, 0xa6, 0x6b, 0xae, 0xf0, 0xad, 0xdc, 0x29, 0x83, 0x2d, 0x16, 0x2b,
+    0x9d, 0xab, 0x73, 0xac, 0x28, 0xa7, 0x9d, 0x23, 0xda, 0x24, 0xa4, 0xa5,
+    0xf1, 0xa0, 0xa5, 0xac, 0x8d, 0xa9, 0xbd, 0x2c, 0x53, 0xa9, 0xf1, 0xa2,
+    0x16, 0x2d, 0xe6, 0xa8, 0xc8, 0xad, 0x16, 0xad, 0xf8, 0xad, 0x8f, 0xae,
+    0x75, 0xa0, 0x8b, 0xac, 0x0e, 0xad, 0x92, 0x2d, 0x3a, 0xaa, 0xcd, 0x24,
+    0xe7, 0xa6, 0x9a, 0xac, 0x4e, 0x2d, 0x89, 0x2d, 0xdd, 0xa6, 0x7e, 0xa2,
+    0x15, 0x2d, 0xa3, 0xac, 0xf9, 0x1c, 0xb1, 0x2b, 0x3c, 0xab, 0x72, 0x2c,
+    0xc6, 0x2d, 0xf6, 0xac, 0x2c, 0x27, 0x1e, 0x29, 0x18, 0x30, 0x52, 0x2e,
+    0x73, 0x30, 0x4d, 0x29, 0xb2, 0x1f, 0x2d, 0x2c, 0xfd, 0x2e, 0x21, 0xae,
+    0xb0, 0xab, 0x9d, 0x2f, 0xb1, 0x2a, 0xbc, 0x9b, 0x43, 0x2e, 0x13, 0x2c,
+    0x61, 0x2b, 0x68, 0xa6, 0xeb, 0x15, 0x32, 0xad, 0x65, 0x33, 0xfa, 0xad,
+    0x1c, 0x2c, 0x6b, 0x2c, 0xf7, 0x2b, 0x09, 0x24, 0x34, 0x30, 0x3e, 0xb0,
+    0x3a, 0xa4, 0x50, 0xac, 0x68, 0x9c, 0x27, 0xac, 0x1b, 0x30, 0x62, 0xb0,
+    0x3f, 0x9d, 0x1b, 0xac, 0xa1, 0x2b, 0xd3, 0xaf, 0xac, 0x30, 0x09, 0x20,
+    0x23, 0xb0, 0x93, 0xad, 0x8d, 0x27, 0x96, 0xad, 0x49, 0x9f, 0x7e, 0xa5,
+    0x4d, 0xa4, 0x5f, 0x2a, 0x3a, 0x2f, 0x9f, 0x22, 0xd9, 0xa9, 0xcc, 0x2a,
+    0x55, 0x2d, 0x88, 0x2c, 0x7a, 0x20, 0xee, 0xa7, 0x50, 0x2b, 0xd2, 0x2b,
+    0x06, 0xae, 0x84, 0x27, 0xa5, 0x28, 0xbf, 0xa4, 0x08, 0x26, 0x03, 0xa9,
+    0x89, 0xad, 0x6c, 0xaa, 0x93, 0xae, 0xac, 0xa8, 0x81, 0xae, 0x34, 0x10,
+    0x67, 0xa8, 0xb9, 0x2c, 0x6c, 0xad, 0x77, 0x9e, 0x9d, 0x1d, 0x0a, 0xad,
+    0x04, 0xad, 0x5e, 0xa7, 0xc9, 0x2d, 0x14, 0xa0, 0x5f, 0xa8, 0x5f, 0x2d,
+    0x71, 0xac, 0x01, 0xab, 0xb1, 0xa2, 0xfd, 0xa8, 0xba, 0x2c, 0x75, 0x24,
+    0x06, 0x9f, 0x2f, 0xad, 0xbc, 0x29, 0xcb, 0x1e, 0x38, 0x2b, 0x91, 0x2a,
+    0x00, 0x2c, 0x62, 0xae, 0xdf, 0xa0, 0xec, 0x2c, 0x14, 0xaa, 0x18, 0x29,
+    0xd7, 0x2b, 0x83, 0x2e, 0x2d, 0x34, 0xca, 0x30, 0x2d, 0xab, 0xe4, 0xa3,
+    0x20, 0xac, 0xcd, 0x29, 0x83, 0x32, 0xdf, 0x2b, 0x75, 0x28, 0xe1, 0x2a,
+    0xa4, 0xad, 0x26, 0xb0, 0x35, 0x2e, 0xb2, 0xab, 0x5e, 0xac, 0x7a, 0xae,
+    0x05, 0x24, 0x88, 0xae, 0x36, 0x32, 0x94, 0x2a, 0xea, 0xaa, 0x7d, 0xa8,
+    0xb2, 0xaf, 0x24, 0x26, 0x7d, 0x2f, 0x87, 0x2b, 0x23, 0x2e, 0x10, 0xa7,
+    0x00, 0xaf, 0xca, 0xb0, 0x24, 0x30, 0xac, 0xab, 0x59, 0x2c, 0xb3, 0xab,
+    0x85, 0xae, 0x32, 0xb0, 0x0a, 0x30, 0x25, 0xab, 0x67, 0x2b, 0x0e, 0x28,
+    0x10, 0x2c, 0xe4, 0xb0, 0x13, 0x31, 0x9f, 0x26, 0x08, 0xaf, 0x41, 0x2d,
+    0x93, 0x31, 0xbf, 0x26, 0x21, 0xa7, 0x8b, 0x31, 0x78, 0xa5, 0x93, 0x2c,
+    0x4e, 0x2b, 0x0d, 0xaa, 0x7c, 0xa7, 0x5f, 0x31, 0x1e, 0x29, 0xf3, 0x25,
+    0x01, 0x2c, 0x5e, 0x2d, 0x26, 0xa6, 0x24, 0x1d, 0xb3, 0xaa, 0xe5, 0xad,
+    0xd9, 0x25, 0x4a, 0x28, 0x59, 0xad, 0xf5, 0x29, 0x59, 0x28, 0x78, 0xaa,
+    0x2f, 0x24, 0x83, 0x26, 0x0d, 0xa9, 0x1b, 0x30, 0xea, 0x29, 0xc3, 0xaf,
+    0x66, 0xae, 0x01, 0xaf, 0xf3, 0x15, 0x3a, 0x2d, 0xb4, 0x2d, 0xdb, 0xaa,
+    0xf6, 0xad, 0xd8, 0xac, 0x9c, 0xaf, 0x2a, 0x33, 0x86, 0xaa, 0x9f, 0x27,
+    0x1b, 0xac, 0x7e, 0x28, 0xb5, 0xae, 0x7a, 0x34, 0x98, 0x2a, 0x50, 0x2c,
+    0xec, 0x2a, 0xee, 0xb1, 0x1b, 0xb1, 0x51, 0x1c, 0x9d, 0xae, 0x45, 0xa4,
+    0x65, 0x29, 0x26, 0xb2, 0xa9, 0xad, 0x7b, 0x2d, 0xe7, 0x98, 0xd7, 0xa7,
+    0xfc, 0x28, 0xcf, 0xad, 0x84, 0xb1, 0x9e, 0x2f, 0xc6, 0x98, 0x27, 0x28,
+    0x10, 0x1b, 0xe5, 0xb0, 0x46, 0xb1, 0xe5, 0x2c, 0x29, 0xab, 0x93, 0x2c,
+    0xfe, 0x26, 0x7e, 0xac, 0x20, 0xb0, 0xbd, 0xa8, 0xef, 0x1e, 0x83, 0xa9,
+    0x6f, 0x2b, 0xf9, 0xac, 0x63, 0xa4, 0x7f, 0x30, 0x6d, 0x2b, 0x09, 0x2d,
+    0x21, 0x28, 0xb4, 0x2c, 0x38, 0xac, 0xc1, 0x2b, 0xa8, 0xa7, 0xb9, 0xac,
+    0xf8, 0xad, 0xc3, 0x2d, 0x5f, 0xae, 0xbd, 0x30, 0xa6, 0xb0, 0x8d, 0xaf,
+    0xa6, 0x1d, 0xa6, 0x29, 0xad, 0xb2, 0x9a, 0x2e, 0xc0, 0x22, 0x67, 0xb0,
+    0x0d, 0x2b, 0x68, 0x28, 0xd9, 0xb1, 0x93, 0xa5, 0xdc, 0xa9, 0x7e, 0xa9,
+    0x44, 0x31, 0xbf, 0xa5, 0xcd, 0xac, 0x22, 0x28, 0xb6, 0x94, 0xf7, 0xad,
+    0x39, 0xa1, 0x82, 0x2d, 0xfe, 0xaf, 0x7f, 0x1c, 0x37, 0x24, 0x7a, 0xa2,
+    0xab, 0x30, 0x2c, 0x2c, 0xbb, 0x17, 0x7d, 0x30, 0x08, 0x2d, 0xb9, 0x1b,
+    0x57, 0x24, 0xcf, 0x13, 0x87, 0xa0, 0x3f, 0x30, 0x3d, 0x1f, 0x95, 0xab,
+    0x96, 0x2e, 0x4e, 0x31, 0x04, 0x21, 0xa9, 0x2d, 0xea, 0x2c, 0xba, 0xac,
+    0x6a, 0xa3, 0x66, 0x2d, 0x22, 0x2d, 0xee, 0x2c, 0x85, 0x9c, 0xd2, 0x2d,
+    0x35, 0x2a, 0x74, 0x32, 0x64, 0xb1, 0x41, 0x31, 0x21, 0x29, 0x50, 0x2d,
+    0xaa, 0x2a, 0xaf, 0x32, 0x8d, 0x23, 0xc8, 0x27, 0x4d, 0xab, 0x9a, 0x20,
+    0x51, 0x94, 0xd0, 0x33, 0xd4, 0xac, 0x6c, 0x1c, 0x00, 0xa5, 0x89, 0xab,
+    0xe0, 0x31, 0x1a, 0x33, 0x37, 0x2d, 0x5c, 0x20, 0x15, 0x29, 0x86, 0xa3,
+    0x16, 0x30, 0x2c, 0x33, 0x24, 0xa9, 0xf9, 0xb1, 0x20, 0xac, 0x60, 0xa8,
+    0xc2, 0x29, 0x85, 0x2f, 0x76, 0xa5, 0x7e, 0xa6, 0xa9, 0x28, 0xa9, 0xaa,
+    0xd9, 0x31, 0xab, 0x33, 0x37, 0x28, 0x7f, 0xb2, 0x93, 0x29, 0xcb, 0xa9,
+    0x7d, 0x31, 0x4c, 0x2c, 0x01, 0xa9, 0x30, 0xb0, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0xb6, 0x1d, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x02, 0x83,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x42, 0x1e, 0xff, 0xff,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x01, 0x00, 0xc0, 0x00,
+    0x00, 0x03, 0xb0, 0xf0, 0xaa, 0x66, 0xb0, 0x0d, 0xae, 0x25, 0x30, 0x33,
+    0xa8, 0xcc, 0xb1, 0xb4, 0xa5, 0x25, 0xa1, 0xe5, 0x2c, 0xb1, 0xb1, 0x04,
+    0x2f, 0x30, 0xad, 0x27, 0x2a, 0x4e, 0x28, 0x08, 0x2f, 0x45, 0x30, 0xee,
+    0xa6, 0x8f, 0xb2, 0x9d, 0xb0, 0x8b, 0x29, 0x58, 0xab, 0x07, 0xac, 0x0b,
+    0xa0, 0xd6, 0xa9, 0x5d, 0xac, 0x43, 0x21, 0xaf, 0x2c, 0x52, 0xac, 0x10,
+    0xb1, 0x45, 0xad, 0xc2, 0x2c, 0x7b, 0xb0, 0x91, 0xad, 0xbf, 0xb1, 0x97,
+    0xa3, 0xa0, 0x27, 0x0d, 0x30, 0xbb, 0xac, 0x13, 0x1f, 0xbc, 0xaf, 0x29,
+    0x31, 0xf0, 0xad, 0xef, 0xaf, 0xbf, 0xae, 0xe9, 0x2a, 0x9b, 0xac, 0xd1,
+    0xb0, 0x93, 0xaf, 0x01, 0x23, 0xe4, 0xb2, 0xea, 0x28, 0x26, 0xaa, 0xda,
+    0xa8, 0x6f, 0x29, 0xd2, 0xac, 0xba, 0x25, 0xb8, 0x2c, 0xdb, 0x99, 0x01,
+    0xaa, 0xf0, 0xac, 0xaa, 0x33, 0x6a, 0xae, 0x3e, 0xb2, 0xe9, 0xa7, 0x2e,
+    0x99, 0x81, 0xa6, 0x98, 0xac, 0xea, 0x25, 0x28, 0x30, 0x59, 0x28, 0xef,
+    0x2e, 0x32, 0xa5, 0xbd, 0x28, 0x30, 0x1c, 0x62, 0x2e, 0x45, 0x10, 0xf2,
+    0x2f, 0x22, 0x25, 0xb2, 0xaf, 0xb1, 0x32, 0x15, 0x2b, 0x62, 0xaa, 0xde,
+    0x9d, 0x7a, 0xb1, 0x16, 0x2d, 0x15, 0xad, 0xb8, 0xac, 0x77, 0x1f, 0xfd,
+    0x1f, 0x59, 0x2c, 0x8a, 0x31, 0x0c, 0x27, 0xe9, 0xb0, 0x65, 0x2e, 0x79,
+    0x99, 0x3f, 0xab, 0xa5, 0xac, 0x9d, 0x9a, 0x91, 0xaa, 0xc2, 0x30, 0xe9,
+    0x2c, 0xe8, 0x25, 0x10, 0x29, 0x39, 0x27, 0x28, 0x2f, 0x50, 0xad, 0x75,
+    0xa0, 0x53, 0x2c, 0x01, 0xab, 0x7b, 0x22, 0x14, 0xac, 0x63, 0xb0, 0x8c,
+    0x29, 0x42, 0xad, 0x14, 0x27, 0xb4, 0x1d, 0x3b, 0x25, 0xc2, 0x2a, 0x32,
+    0x27, 0x60, 0xa9, 0x5a, 0x24, 0x2c, 0x9f, 0xed, 0xa8, 0x80, 0x2d, 0x0d,
+    0x27, 0x29, 0xac, 0x18, 0xaf, 0x6a, 0x2b, 0xee, 0x2f, 0x78, 0x24, 0x11,
+    0x28, 0x4f, 0x2c, 0xf7, 0x31, 0x14, 0x29, 0xcd, 0x28, 0x38, 0xa5, 0x3b,
+    0xae, 0xf3, 0xac, 0x25, 0xa9, 0xea, 0x87, 0x3b, 0x2c, 0x8e, 0x20, 0xe1,
+    0x1e, 0x08, 0x35, 0x50, 0xab, 0xc9, 0x9c, 0x45, 0x25, 0x75, 0xab, 0xa6,
+    0xad, 0xee, 0xa1, 0xa9, 0xac, 0x68, 0x20, 0xa2, 0xae, 0x78, 0xaf, 0xa3,
+    0x30, 0x77, 0x2c, 0x04, 0xb1, 0x98, 0x1f, 0xff, 0xa4, 0x66, 0xad, 0x17,
+    0xac, 0x18, 0x2d, 0xc3, 0x29, 0xd8, 0x2d, 0x11, 0xaa, 0x21, 0x27, 0x57,
+    0x2b, 0x1f, 0xa7, 0xa7, 0xa3, 0x82, 0x2c, 0x7b, 0x27, 0x35, 0x2e, 0xe8,
+    0xa8, 0xea, 0xa5, 0x3c, 0x25, 0xad, 0xb2, 0x1c, 0xac, 0x01, 0xaa, 0x9c,
+    0x2c, 0xb7, 0x23, 0xfc, 0x25, 0xbd, 0x2d, 0x9a, 0x2c, 0x37, 0x19, 0x82,
+    0xa8, 0x1a, 0xae, 0xb1, 0xa9, 0x16, 0x2a, 0x80, 0x2e, 0x3a, 0xad, 0x1f,
+    0xa0, 0x5e, 0x29, 0x45, 0xaa, 0xae, 0x26, 0x03, 0x2e, 0xcb, 0x2d, 0xc8,
+    0x30, 0x1e, 0x29, 0xcb, 0x2b, 0x2c, 0x2a, 0x1d, 0x30, 0x6c, 0xa8, 0x40,
+    0x2e, 0x98, 0x1c, 0x47, 0x14, 0x8c, 0x1f, 0xb5, 0x28, 0x04, 0x32, 0xe1,
+    0x25, 0xca, 0x28, 0xaf, 0x25, 0x87, 0xae, 0xd8, 0x2b, 0x03, 0x26, 0x71,
+    0x28, 0x98, 0x2c, 0xbb, 0xa9, 0x47, 0x2e, 0xe0, 0x31, 0xd9, 0x2a, 0x84,
+    0xac, 0x2b, 0x1e, 0x28, 0xac, 0xae, 0xa8, 0x0a, 0xa8, 0xfc, 0x29, 0x8b,
+    0xac, 0xe5, 0x1c, 0x04, 0x28, 0x70, 0xac, 0x68, 0xa0, 0x4e, 0xaa, 0xe9,
+    0xaa, 0x02, 0xa7, 0xe3, 0x29, 0x0c, 0xac, 0x2c, 0xb0, 0x32, 0x27, 0xef,
+    0x2d, 0xc5, 0xaf, 0x2a, 0xa4, 0xf6, 0xa8, 0x62, 0x30, 0x47, 0x21, 0x6b,
+    0x25, 0xca, 0x83, 0x19, 0x2e, 0x7a, 0x2d, 0x0f, 0xa2, 0xb5, 0xa9, 0x3a,
+    0xab, 0x37, 0x2c, 0x88, 0x30, 0xc4, 0x96, 0x3d, 0x23, 0xde, 0xb0, 0x89,
+    0x2d, 0x0b, 0x2c, 0x00, 0x25, 0x8d, 0x29, 0x22, 0x2a, 0x15, 0xad, 0xc1,
+    0x2f, 0xde, 0x9f, 0x1b, 0x2e, 0x72, 0x28, 0xd8, 0x2d, 0xd5, 0xaf, 0xe5,
+    0x28, 0x7b, 0x22, 0xf4, 0xad, 0x06, 0x32, 0x1f, 0x2b, 0x81, 0xa6, 0x96,
+    0x9b, 0xac, 0x2c, 0x33, 0xa5, 0xec, 0xab, 0x2f, 0x31, 0x23, 0x2a, 0x0b,
+    0xae, 0x64, 0x2b, 0x71, 0x2f, 0xea, 0x2d, 0x51, 0xa6, 0xe2, 0x2d, 0x8b,
+    0xa6, 0xd8, 0xaf, 0x35, 0xaf, 0x90, 0x2d, 0xf7, 0xa6, 0x4d, 0xa7, 0x0c,
+    0xaa, 0x1c, 0x2f, 0xe6, 0x24, 0x11, 0xb0, 0x63, 0x29, 0x61, 0xae, 0x18,
+    0xad, 0xbb, 0x30, 0x10, 0xaf, 0xda, 0xa8, 0x26, 0xaa, 0xcd, 0xa9, 0x77,
+    0xa9, 0x7f, 0x26, 0x65, 0x2e, 0xce, 0xa9, 0xc8, 0x2d, 0x85, 0xab, 0xd0,
+    0x2e, 0x01, 0xa7, 0x92, 0x2a, 0xf1, 0x2c, 0x1e, 0xae, 0xde, 0x2d, 0x8f,
+    0x31, 0x9d, 0xad, 0x07, 0xac, 0x78, 0xae, 0x6f, 0xac, 0x98, 0x2e, 0xf9,
+    0x28, 0x96, 0x30, 0xa3, 0x34, 0x0a, 0x2b, 0x51, 0x31, 0xe8, 0x1f, 0x35,
+    0xa7, 0xbc, 0xb0, 0xd5, 0x30, 0x8d, 0xac, 0x25, 0x9f, 0x6c, 0x2a, 0xb6,
+    0xb0, 0x05, 0x36, 0x6d, 0xa0, 0xfb, 0x29, 0x03, 0xad, 0x49, 0x9e, 0x8f,
+    0xa4, 0xcc, 0xaf, 0x56, 0xad, 0x21, 0x23, 0x33, 0xb0, 0xcc, 0x2c, 0x0c,
+    0x32, 0x9c, 0x2f, 0x00, 0xa8, 0x73, 0xa7, 0xcd, 0x30, 0x4c, 0xa5, 0x24,
+    0x1c, 0xe4, 0xa3, 0x9a, 0xaf, 0x8a, 0x2d, 0xd6, 0x29, 0x44, 0xad, 0x52,
+    0x24, 0x25, 0x24, 0x46, 0x33, 0xeb, 0xaf, 0xe1, 0x21, 0x3b, 0x24, 0x83,
+    0x26, 0x1a, 0xa7, 0x14, 0x1f, 0x94, 0xac, 0xd9, 0xad, 0xf7, 0xab, 0x7d,
+    0x2e, 0x9f, 0xa2, 0x0c, 0xaa, 0xe1, 0xad, 0x78, 0x31, 0x17, 0xad, 0x5e,
+    0x9e, 0x98, 0x26, 0xd4, 0xad, 0x5d, 0x31, 0x02, 0x35, 0xa0, 0x29, 0x75,
+    0xab, 0x33, 0x1e, 0xc6, 0x20, 0x5d, 0xb2, 0x05, 0x9b, 0x34, 0x30, 0x63,
+    0x2f, 0x90, 0xa5, 0xed, 0x22, 0x73, 0xac, 0xb4, 0xb0, 0x38, 0xaa, 0x57,
+    0xb1, 0x79, 0xac, 0x67, 0xa4, 0x4b, 0xaa, 0x07, 0xb1, 0xf9, 0x2e, 0x50,
+    0x31, 0x1b, 0x29, 0xfc, 0xae, 0x66, 0x29, 0xee, 0x29, 0xb1, 0xa8, 0x80,
+    0x26, 0x07, 0xac, 0xc4, 0xac, 0x78, 0x2f, 0x65, 0xa9, 0x54, 0xad, 0x38,
+    0x31, 0x2e, 0xa3, 0x44, 0xaa, 0xb6, 0x26, 0x6f, 0xaf, 0x2c, 0xa2, 0x23,
+    0xaf, 0x92, 0x2c, 0x57, 0xb1, 0xe7, 0x2d, 0x57, 0x31, 0x6c, 0x2d, 0x83,
+    0xac, 0x1e, 0x2e, 0x3d, 0x2f, 0xba, 0xac, 0x0d, 0xb2, 0x5c, 0xb1, 0x6a,
+    0xa8, 0x05, 0xad, 0xe6, 0xad, 0x22, 0xad, 0xb7, 0x2e, 0xed, 0x2c, 0xae,
+    0xa7, 0x18, 0xac, 0xe1, 0x2d, 0x10, 0xab, 0xe9, 0xb1, 0x87, 0x2d, 0xd1,
+    0x2e, 0xad, 0x91, 0xf7, 0x31, 0xc8, 0xad, 0xb1, 0xb2, 0x09, 0x28, 0xfc,
+    0xa8, 0x35, 0xb1, 0xfe, 0x30, 0x96, 0x29, 0xc1, 0x2c, 0xc3, 0x9c, 0xc5,
+    0x2c, 0x01, 0xa6, 0x76, 0xa2, 0x7d, 0x2a, 0x1c, 0x2f, 0x01, 0xa8, 0x10,
+    0x2c, 0xcf, 0xb0, 0x7d, 0x20, 0x09, 0x21, 0x83, 0x2a, 0x4b, 0x29, 0x94,
+    0x8f, 0xa0, 0x1b, 0xe1, 0x20, 0x51, 0xa6, 0x02, 0x2d, 0x3a, 0xa7, 0xfc,
+    0xaa, 0x11, 0x2d, 0x0a, 0xa2, 0xde, 0xab, 0x31, 0x2b, 0x52, 0xae, 0xdb,
+    0xa9, 0x82, 0xa6, 0x5a, 0xac, 0xf6, 0xa5, 0xc6, 0xad, 0x83, 0xa9, 0x37,
+    0xa9, 0x52, 0xaa, 0x79, 0x2a, 0xea, 0x2c, 0x19, 0x29, 0xe5, 0x15, 0xc4,
+    0x23, 0x2c, 0xa7, 0x6b, 0xaf, 0x13, 0xaf, 0x5e, 0xa7, 0xd5, 0xab, 0x29,
+    0xaf, 0xcf, 0xac, 0x37, 0xa5, 0x80, 0xa6, 0x60, 0x31, 0xfd, 0xa8, 0xc4,
+    0x2e, 0x4a, 0x2c, 0xe4, 0x18, 0x65, 0x9d, 0xc7, 0x2d, 0xbe, 0x2b, 0xdb,
+    0x28, 0xad, 0xb1, 0x78, 0xb0, 0x1b, 0xac, 0x1f, 0x2c, 0xcc, 0xb4, 0x87,
+    0x2a, 0x82, 0xa9, 0xd9, 0x27, 0xb0, 0x2d, 0x4a, 0x1a, 0x35, 0xad, 0x2c,
+    0xa6, 0x87, 0x9e, 0x93, 0xb0, 0x88, 0x2c, 0xa0, 0xae, 0x94, 0x96, 0x1a,
+    0x2d, 0xe0, 0x2b, 0x86, 0x2d, 0x8d, 0x1b, 0x6b, 0xa6, 0x0c, 0x2b, 0x03,
+    0x2a, 0xcb, 0x31, 0x06, 0xaf, 0x2a, 0x2a, 0x18, 0xa5, 0xc9, 0x24, 0x71,
+    0xaa, 0x90, 0x24, 0xc9, 0x24, 0xa6, 0x2d, 0xbe, 0xae, 0x7d, 0xb0, 0x21,
+    0xab, 0x73, 0xaa, 0xb6, 0xa2, 0x61, 0x30, 0xde, 0x2c, 0x97, 0x24, 0xad,
+    0x21, 0xe4, 0x30, 0x42, 0x24, 0xee, 0x27, 0xb7, 0x27, 0x6a, 0xae, 0x19,
+    0xb3, 0xe6, 0x28, 0xc8, 0x29, 0x5c, 0xb0, 0x10, 0x1d, 0x14, 0xa6, 0xa3,
+    0xab, 0xe5, 0xaa, 0x39, 0x2b, 0xbf, 0x28, 0xcb, 0xaf, 0xf3, 0xa4, 0x1d,
+    0xac, 0xc8, 0x1d, 0x76, 0x2d, 0xe1, 0xa5, 0x9b, 0x1e, 0xe0, 0x2b, 0x5f,
+    0xaf, 0x24, 0x2c, 0xb9, 0x2c, 0xe1, 0xb1, 0x0b, 0x1a, 0x0d, 0xad, 0x3b,
+    0xb1, 0x9a, 0x23, 0xf6, 0x31, 0x3a, 0xab, 0x94, 0x29, 0x6d, 0xb0, 0x28,
+    0x2c, 0x26, 0x2b, 0x2d, 0x2f, 0x72, 0xa6, 0xe0, 0xa1, 0xfa, 0xac, 0x2f,
+    0x25, 0xac, 0xa4, 0x96, 0xa7, 0xf1, 0xa5, 0x37, 0x2c, 0x1c, 0x2f, 0xbc,
+    0xad, 0x52, 0xad, 0x93, 0xa4, 0x0c, 0x2a, 0x28, 0xad, 0xcd, 0xa1, 0x44,
+    0x28, 0x9c, 0x9f, 0x3b, 0xae, 0x1a, 0xab, 0x57, 0x1f, 0x47, 0x2d, 0x47,
+    0x20, 0x7c, 0xaf, 0xfd, 0xad, 0x5d, 0xab, 0x33, 0xa2, 0x95, 0x32, 0x82,
+    0x2e, 0x82, 0x2c, 0x5a, 0x2c, 0x05, 0x28, 0xf3, 0xaa, 0x1b, 0x28, 0xae,
+    0xae, 0xf5, 0x9e, 0x0c, 0xad, 0xec, 0x90, 0x18, 0x24, 0x68, 0xa5, 0xf7,
+    0x9a, 0xa0, 0xa7, 0xea, 0xac, 0xd8, 0x2d, 0x8a, 0x29, 0xa5, 0xae, 0x8a,
+    0x2a, 0xb0, 0x29, 0x4d, 0xa1, 0xaa, 0xac, 0x6d, 0xaa, 0xed, 0x1e, 0x59,
+    0x30, 0x5b, 0x25, 0x12, 0x2f, 0x02, 0xb0, 0x77, 0xae, 0x69, 0x2c, 0xf7,
+    0x2a, 0x3e, 0xb1, 0x86, 0xa8, 0x42, 0xaf, 0x1f, 0xa8, 0xe8, 0xa6, 0x62,
+    0xa6, 0xa7, 0xaf, 0x87, 0xac, 0x0b, 0xae, 0x2d, 0x2c, 0xb4, 0x1c, 0xa1,
+    0x2d, 0xe8, 0xa9, 0x3d, 0x2a, 0xe8, 0x28, 0xde, 0x2c, 0x04, 0xaa, 0x20,
+    0xad, 0x9a, 0xaa, 0x58, 0x2a, 0x81, 0x97, 0xa6, 0xab, 0xbe, 0xad, 0x2f,
+    0xac, 0x93, 0xaf, 0xf1, 0xad, 0x74, 0xab, 0x35, 0x2f, 0xe8, 0x2d, 0x86,
+    0x2f, 0x0b, 0xad, 0x68, 0x24, 0x91, 0x2c, 0x48, 0xa8, 0x7b, 0x2d, 0x9d,
+    0x2d, 0xd9, 0xa8, 0x64, 0xae, 0x71, 0xac, 0xde, 0xa3, 0x5a, 0xa9, 0x24,
+    0x2c, 0x35, 0x2e, 0xb7, 0xae, 0x66, 0x2c, 0x77, 0x2e, 0xc6, 0xad, 0xdc,
+    0xb0, 0xb7, 0x31, 0x8e, 0x28, 0x10, 0xa8, 0x14, 0x25, 0x39, 0xac, 0xec,
+    0xa8, 0x7e, 0xad, 0x16, 0xb1, 0x3c, 0xb1, 0xe8, 0xa8, 0xd8, 0xb5, 0xdd,
+    0x2f, 0x04, 0x2f, 0x72, 0xb2, 0x83, 0xab, 0xb0, 0xb0, 0x51, 0xb3, 0xc9,
+    0x20, 0xf1, 0xac, 0x12, 0x2f, 0x2d, 0xad, 0xc9, 0x2d, 0xa3, 0x19, 0xe9,
+    0xb0, 0x08, 0xa8, 0x0b, 0xa5, 0x75, 0xa4, 0x24, 0x24, 0x61, 0xb2, 0x1d,
+    0x25, 0x3a, 0xad, 0x27, 0x10, 0x0d, 0xb4, 0xb2, 0xa8, 0xdc, 0x32, 0x95,
+    0xac, 0x9c, 0xae, 0x58, 0xb0, 0x1d, 0x1c, 0x29, 0x2a, 0x55, 0xa6, 0xb1,
+    0xb0, 0x6d, 0x2d, 0x5e, 0xa5, 0xe3, 0x2f, 0x8c, 0x30, 0xc0, 0xac, 0xb9,
+    0xa6, 0xb7, 0x28, 0x72, 0x30, 0xfb, 0x09, 0xed, 0xa6, 0xf6, 0xac, 0x2e,
+    0xb0, 0xbf, 0xa8, 0x6c, 0xac, 0x3b, 0x23, 0x09, 0xac, 0xeb, 0xad, 0xfd,
+    0xaa, 0x45, 0x28, 0x09, 0xaa, 0x02, 0xb0, 0x25, 0xb3, 0x8f, 0x17, 0x12,
+    0xa8, 0x5b, 0x28, 0xf5, 0x32, 0xe8, 0x23, 0xcb, 0xad, 0x8f, 0xa5, 0x79,
+    0xb3, 0x8c, 0xae, 0x14, 0x2e, 0x71, 0xb0, 0x2f, 0x2c, 0x74, 0x95, 0xb6,
+    0x2d, 0x61, 0xb1, 0xcd, 0x26, 0xb8, 0xad, 0x0b, 0x2e, 0xbf, 0x2b, 0x4e,
+    0xa8, 0xda, 0x26, 0x29, 0x19, 0x7e, 0x2e, 0x8d, 0x26, 0x08, 0xad, 0x49,
+    0xa8, 0x63, 0x2a, 0x5a, 0xb4, 0x0c, 0xab, 0x62, 0x28, 0xda, 0x2b, 0xb5,
+    0x28, 0x7d, 0x30, 0x9c, 0x26, 0x3a, 0x2d, 0x24, 0x2a, 0x3e, 0xa9, 0x69,
+    0x29, 0x68, 0xac, 0xab, 0x2f, 0xfe, 0x95, 0xd0, 0x29, 0x62, 0x23, 0xf3,
+    0x25, 0xa9, 0xa7, 0xf1, 0x1a, 0x52, 0xab, 0x9b, 0x2a, 0x80, 0xb0, 0xf7,
+    0x27, 0xc6, 0x2c, 0xc8, 0xac, 0x30, 0x87, 0x9c, 0x2c, 0xb4, 0xae, 0x90,
+    0xb1, 0xb4, 0xb4, 0x50, 0x24, 0xe5, 0xb1, 0xef, 0x30, 0x5c, 0x2c, 0xc3,
+    0x2c, 0xce, 0x2e, 0x10, 0xa6, 0x13, 0x28, 0x66, 0xad, 0x21, 0x23, 0xa0,
+    0xac, 0xd2, 0x30, 0x96, 0x30, 0x62, 0x2e, 0x25, 0x9d, 0xea, 0x99, 0x61,
+    0xab, 0x87, 0xb0, 0xf3, 0x2d, 0x4c, 0x2e, 0x14, 0x25, 0x36, 0xb1, 0x85,
+    0x2a, 0x45, 0xad, 0x39, 0x30, 0x58, 0x2b, 0x05, 0xb0, 0x6a, 0x2b, 0xf4,
+    0x2e, 0x60, 0x27, 0x25, 0x9d, 0xbe, 0xaf, 0xbd, 0xac, 0xfd, 0x2e, 0x73,
+    0xb1, 0x7c, 0x99, 0xea, 0x2d, 0xde, 0x2c, 0xf2, 0xaf, 0x7b, 0x28, 0x27,
+    0xa6, 0xfa, 0xac, 0x84, 0x2f, 0xaf, 0x22, 0x32, 0x22, 0x6a, 0x2c, 0x2e,
+    0x1d, 0x5f, 0xb3, 0x99, 0x2f, 0xbe, 0x20, 0xdb, 0xa8, 0x24, 0xa9, 0x39,
+    0xac, 0xad, 0xab, 0x24, 0x2d, 0x47, 0xb2, 0x6e, 0x2e, 0x57, 0x2d, 0x09,
+    0x2b, 0x3b, 0xae, 0x7b, 0xac, 0xe6, 0xb0, 0xff, 0xac, 0x27, 0xb1, 0x23,
+    0xb0, 0x69, 0xa9, 0x25, 0x2f, 0xa1, 0x30, 0x39, 0xb1, 0x07, 0xac, 0x57,
+    0x1d, 0x53, 0xb1, 0x5a, 0xae, 0x8a, 0x2c, 0x92, 0x1a, 0x93, 0x2f, 0x49,
+    0x2c, 0x48, 0x2e, 0xc7, 0xa2, 0x0b, 0xb1, 0x53, 0xab, 0x71, 0x23, 0xc4,
+    0xa2, 0x35, 0x2f, 0xe7, 0x2d, 0xc2, 0xab, 0x91, 0x29, 0xb9, 0xac, 0x2f,
+    0x2c, 0x8c, 0xa2, 0xe8, 0x2c, 0x5d, 0x9f, 0xf8, 0xae, 0x57, 0xa8, 0xba,
+    0x9e, 0x3a, 0xac, 0x7d, 0xb1, 0xc2, 0x2e, 0x0b, 0xad, 0x55, 0xb1, 0xb3,
+    0xa8, 0x0d, 0xaf, 0xd6, 0xaf, 0x0e, 0xa4, 0x5e, 0xa9, 0x79, 0x30, 0x35,
+    0xad, 0xd3, 0xac, 0xb0, 0xad, 0xb9, 0x2b, 0x06, 0xaa, 0x22, 0xb0, 0x03,
+    0x30, 0x41, 0x2b, 0x54, 0xad, 0xac, 0x9c, 0x7d, 0xa9, 0x8a, 0xa9, 0x10,
+    0x2e, 0x96, 0xb2, 0x43, 0x2a, 0x9e, 0xad, 0xb6, 0xab, 0x96, 0xa9, 0x04,
+    0xa7, 0x57, 0xaa, 0x47, 0xaf, 0x91, 0xb0, 0x12, 0xa0, 0xf4, 0xb1, 0x3d,
+    0x30, 0xeb, 0x27, 0x62, 0x2f, 0x4e, 0x30, 0xe0, 0x2a, 0x14, 0x21, 0xbd,
+    0xa9, 0xcc, 0xa6, 0xdf, 0xae, 0xa4, 0x2a, 0xaf, 0x27, 0x03, 0x2b, 0x10,
+    0xaf, 0x94, 0x2a, 0x50, 0xa8, 0x92, 0xad, 0x93, 0x30, 0x57, 0xa5, 0x54,
+    0x18, 0xc5, 0xaf, 0xd5, 0x2a, 0xe3, 0xb0, 0x4f, 0x2e, 0x05, 0xae, 0x70,
+    0xa5, 0xd4, 0xae, 0x56, 0x32, 0x81, 0x22, 0xbb, 0x23, 0xfd, 0xa1, 0x77,
+    0xaa, 0x5f, 0x2f, 0x10, 0xb0, 0x86, 0xad, 0xc1, 0xa8, 0xc1, 0x23, 0x0b,
+    0x27, 0xe5, 0x2c, 0x05, 0xa8, 0xa8, 0xac, 0x13, 0x33, 0x05, 0x2c, 0x8c,
+    0xa9, 0xc0, 0xac, 0x04, 0x9d, 0xd8, 0xb1, 0xe6, 0x2d, 0x92, 0x30, 0x33,
+    0xa1, 0xd6, 0x24, 0x4a, 0xab, 0x6b, 0xad, 0xab, 0x2a, 0xf8, 0xb0, 0xb2,
+    0x2d, 0xc9, 0x1e, 0x6e, 0x9f, 0x5e, 0xa8, 0x3e, 0xaa, 0xd3, 0xac, 0x2f,
+    0xae, 0x01, 0xaf, 0xff, 0xad, 0x55, 0xb0, 0x6c, 0x2c, 0x77, 0x30, 0x24,
+    0xab, 0xc7, 0x2e, 0xff, 0x24, 0xa1, 0x28, 0x1c, 0x25, 0x65, 0x29, 0xf2,
+    0xaf, 0xc3, 0x2e, 0xdf, 0x2c, 0xcc, 0x30, 0x24, 0xa2, 0x54, 0xb2, 0x63,
+    0xad, 0x4f, 0x2a, 0xce, 0x2c, 0xbd, 0x2d, 0x83, 0xa9, 0xc8, 0x22, 0x96,
+    0x2c, 0xb9, 0xaa, 0x07, 0xaa, 0xb7, 0xaf, 0x04, 0xaa, 0xb2, 0xa3, 0x19,
+    0xac, 0x1e, 0xa3, 0x34, 0xaf, 0xeb, 0x21, 0x58, 0x2c, 0x84, 0xa2, 0x7d,
+    0x9b, 0x27, 0x30, 0xaa, 0xac, 0x8e, 0xaf, 0x1c, 0x2f, 0x80, 0x2d, 0xcf,
+    0xb0, 0xed, 0xb1, 0xb2, 0x30, 0xfd, 0x2b, 0xdc, 0xb0, 0x22, 0x2a, 0xd0,
+    0x30, 0x8f, 0xaf, 0xe1, 0xa4, 0xb7, 0x8f, 0x2e, 0x27, 0xac, 0x23, 0xd7,
+    0xb0, 0x30, 0x19, 0x3f, 0x2c, 0x34, 0xb2, 0x1a, 0x2f, 0x74, 0x2e, 0xca,
+    0x21, 0x57, 0x1f, 0x87, 0xb0, 0x56, 0xae, 0xbb, 0x29, 0x29, 0xaf, 0x31,
+    0xaf, 0x20, 0xaf, 0x2d, 0xa4, 0xe4, 0x2a, 0xa2, 0x29, 0x1d, 0x2c, 0x4e,
+    0x24, 0x94, 0xae, 0x1d, 0x2b, 0x9f, 0xb0, 0x73, 0x9d, 0x9e, 0xa4, 0x7c,
+    0x20, 0xbf, 0x94, 0x02, 0x98, 0xc9, 0xa8, 0x40, 0xa0, 0xee, 0xa7, 0xf2,
+    0x2c, 0x76, 0x33, 0xa1, 0x12, 0x22, 0xa8, 0x4b, 0x29, 0x4f, 0xad, 0x3e,
+    0x2b, 0x35, 0xa9, 0xc6, 0x27, 0xc9, 0xab, 0xfb, 0x2e, 0x5c, 0x30, 0x2f,
+    0xb2, 0x25, 0x2d, 0x90, 0xac, 0x36, 0x2e, 0x05, 0xa3, 0xf0, 0xac, 0x79,
+    0xab, 0x2f, 0x28, 0x20, 0x94, 0xd5, 0x2a, 0xa8, 0x24, 0x07, 0xa9, 0xba,
+    0x1e, 0xb7, 0xae, 0xfa, 0x9c, 0x8e, 0x27, 0xee, 0x31, 0x1f, 0xad, 0xf4,
+    0xaf, 0xc2, 0x2e, 0x82, 0xa8, 0x97, 0x2d, 0x32, 0xb1, 0xa5, 0x26, 0x9d,
+    0x2a, 0x65, 0xb2, 0xdf, 0x2f, 0x79, 0x9d, 0xed, 0x23, 0x05, 0x9e, 0xb1,
+    0xa9, 0x10, 0xb2, 0x97, 0xb0, 0xdf, 0x1f, 0x26, 0x2e, 0xbf, 0xa5, 0x31,
+    0xa8, 0x77, 0x2e, 0x3f, 0xa8, 0x3d, 0xa8, 0xc4, 0xa7, 0x78, 0x25, 0x09,
+    0xa8, 0x68, 0xb2, 0xc8, 0xa5, 0x1a, 0x2a, 0x8e, 0x2d, 0x02, 0xb1, 0xf5,
+    0xb1, 0xd5, 0xa9, 0xb8, 0xa9, 0x90, 0x31, 0x15, 0xad, 0x11, 0x32, 0x1c,
+    0xaa, 0x2a, 0xb0, 0x1d, 0x32, 0x62, 0x2a, 0x9e, 0xa8, 0x4d, 0xad, 0x09,
+    0x30, 0xcc, 0x30, 0xd3, 0x24, 0x47, 0x2b, 0x50, 0xae, 0xee, 0xae, 0x62,
+    0xad, 0x36, 0xb0, 0x11, 0x25, 0xde, 0xb3, 0x2f, 0xaf, 0x65, 0xb0, 0xc0,
+    0xb0, 0x4c, 0x26, 0x59, 0xad, 0x53, 0x34, 0x91, 0x9f, 0x15, 0x2d, 0x2d,
+    0xad, 0x36, 0x32, 0x3b, 0x2d, 0x3b, 0x2c, 0x1c, 0xa4, 0x71, 0x2d, 0x95,
+    0xae, 0x03, 0xab, 0x49, 0xa8, 0x27, 0x2e, 0x06, 0xb1, 0x6d, 0x33, 0x01,
+    0x33, 0x50, 0xa4, 0xef, 0xa1, 0x43, 0xb1, 0xeb, 0x29, 0xbe, 0x28, 0x6d,
+    0xa5, 0x49, 0x27, 0xc9, 0xac, 0xec, 0x30, 0xf2, 0xb2, 0xac, 0xa9, 0x5b,
+    0x32, 0x90, 0xb1, 0xfe, 0x17, 0xd6, 0x2c, 0xe9, 0x20, 0x97, 0xa9, 0xf1,
+    0x2e, 0x81, 0xac, 0xd4, 0xaf, 0x86, 0x9d, 0x30, 0x33, 0xbc, 0xad, 0x9d,
+    0xa7, 0x47, 0x2c, 0x0c, 0x2d, 0xb2, 0x30, 0x4d, 0x2a, 0x29, 0xb2, 0x35,
+    0x2d, 0xc6, 0xab, 0xea, 0x30, 0x51, 0xb2, 0x3d, 0x2f, 0xf6, 0x2c, 0xed,
+    0xac, 0xc4, 0xa5, 0x0b, 0xb2, 0x7a, 0x2c, 0xe6, 0x26, 0x12, 0x1c, 0x28,
+    0x2e, 0xb3, 0xb2, 0x2a, 0x2f, 0x05, 0xad, 0x4a, 0xb1, 0xd6, 0x2b, 0x2b,
+    0xac, 0x96, 0x33, 0xa3, 0x2d, 0x2e, 0x9b, 0x2e, 0xa9, 0xda, 0x2e, 0xed,
+    0xb0, 0x24, 0x33, 0x16, 0x2f, 0xda, 0x23, 0x46, 0x24, 0xbe, 0x2b, 0xc9,
+    0x2a, 0xe5, 0x2b, 0x4e, 0xb1, 0xdc, 0x2a, 0x4f, 0x31, 0x12, 0xa9, 0xd6,
+    0xa2, 0x24, 0xa5, 0x84, 0x94, 0x56, 0xab, 0x02, 0x19, 0x83, 0x27, 0x21,
+    0xa9, 0x4e, 0x33, 0x6a, 0xae, 0xde, 0x99, 0x80, 0xa6, 0x69, 0xac, 0x96,
+    0x24, 0xed, 0x2d, 0x12, 0xa8, 0x0e, 0xb1, 0x1f, 0xad, 0x7b, 0xa5, 0x14,
+    0xae, 0xb4, 0xac, 0xc1, 0x30, 0x7c, 0xa8, 0xab, 0xaa, 0xb2, 0x31, 0x1f,
+    0xa4, 0x15, 0x2e, 0x9f, 0xa8, 0xcf, 0xac, 0x15, 0x2d, 0x01, 0x26, 0xe5,
+    0x29, 0x70, 0xb2, 0x67, 0x2d, 0x07, 0x31, 0x63, 0xad, 0x3c, 0xad, 0xe3,
+    0xaf, 0x26, 0xab, 0x90, 0xae, 0xdd, 0x25, 0xa5, 0x2c, 0x50, 0xa6, 0x64,
+    0xb0, 0x3e, 0xa0, 0xd6, 0xa5, 0x47, 0x2d, 0xd4, 0x2c, 0x90, 0xa9, 0x3f,
+    0x28, 0x4e, 0x2b, 0xf4, 0xa4, 0xb1, 0x2c, 0xf8, 0xa1, 0x70, 0x31, 0x38,
+    0x2c, 0x59, 0x29, 0x09, 0xad, 0x2e, 0xa6, 0x51, 0x2b, 0xa2, 0x2d, 0x0a,
+    0xa8, 0x2e, 0x2e, 0xcc, 0xa3, 0xf4, 0x10, 0x2a, 0xad, 0x42, 0xae, 0x62,
+    0x9c, 0x21, 0xab, 0xa9, 0xae, 0x5d, 0xa6, 0x27, 0xa7, 0x2f, 0x29, 0x90,
+    0x2d, 0x0a, 0x2b, 0xf7, 0xa4, 0x41, 0x2b, 0xa2, 0xad, 0xcb, 0xa6, 0x4a,
+    0xa9, 0xe5, 0xad, 0xdb, 0x24, 0x78, 0xab, 0xcb, 0xae, 0xb6, 0xa0, 0x94,
+    0x2e, 0x93, 0xb0, 0xcf, 0x1f, 0x9a, 0x2e, 0x14, 0x1c, 0x3d, 0xb1, 0xd8,
+    0xaa, 0x18, 0xa8, 0x1c, 0x34, 0x1e, 0xa8, 0xf6, 0x2f, 0x8f, 0xa6, 0xd0,
+    0x24, 0x53, 0x2d, 0xdd, 0x31, 0xcd, 0xa4, 0x1a, 0xab, 0x7d, 0xaa, 0x23,
+    0xac, 0x54, 0x2e, 0x4d, 0x2c, 0x05, 0xae, 0x23, 0xa8, 0x3a, 0xab, 0xa7,
+    0xaa, 0xc4, 0xa7, 0xc7, 0x28, 0x89, 0x30, 0xdd, 0xa9, 0x2d, 0x20, 0x89,
+    0x27, 0x41, 0x97, 0x52, 0xb0, 0xd6, 0x2d, 0x2e, 0x28, 0xea, 0xae, 0x65,
+    0xa8, 0x0f, 0x2f, 0x7d, 0xa0, 0x91, 0xa1, 0xef, 0x9d, 0xfb, 0xa3, 0x49,
+    0x34, 0x75, 0xa4, 0x85, 0xaf, 0x4c, 0xa2, 0x05, 0x25, 0xc2, 0x99, 0xa0,
+    0x28, 0x48, 0xb0, 0xe8, 0xb1, 0xbb, 0x2c, 0xa7, 0xb0, 0x91, 0xae, 0x75,
+    0x2d, 0xb8, 0x2d, 0xfa, 0x22, 0x1d, 0xa9, 0x1c, 0x9e, 0x08, 0xae, 0x91,
+    0xb0, 0x29, 0xa9, 0xf4, 0xae, 0xef, 0x28, 0xf1, 0x30, 0xae, 0xae, 0x41,
+    0x20, 0x2e, 0xab, 0xeb, 0x28, 0x9f, 0x30, 0x66, 0x2e, 0x0b, 0xab, 0x74,
+    0xa3, 0xe5, 0x2d, 0x08, 0xab, 0xb1, 0xad, 0xbb, 0x31, 0x13, 0x22, 0xd4,
+    0x2c, 0xc6, 0xaf, 0x14, 0xad, 0x32, 0xa5, 0x9f, 0x1e, 0xa6, 0x29, 0xef,
+    0xa0, 0x1f, 0xb1, 0xa1, 0x26, 0xc6, 0x27, 0x2b, 0x29, 0x40, 0xaf, 0xe8,
+    0xa5, 0x7d, 0x2d, 0x9a, 0xad, 0x2c, 0xad, 0x1d, 0x2f, 0xa9, 0x0f, 0x3a,
+    0xaf, 0x86, 0x2e, 0xb7, 0xb0, 0xb8, 0xaf, 0x07, 0xa5, 0xb5, 0x22, 0x2c,
+    0xa9, 0x13, 0xa9, 0xa7, 0xae, 0x62, 0xac, 0x78, 0xa7, 0xb0, 0x20, 0x97,
+    0xaa, 0x7f, 0xb1, 0xbf, 0x30, 0x25, 0x1c, 0x72, 0xb0, 0xf1, 0x20, 0x61,
+    0xab, 0x87, 0xae, 0xe7, 0x1f, 0x5a, 0xad, 0xfd, 0x26, 0xe3, 0xad, 0xc8,
+    0xac, 0x6f, 0x2d, 0x87, 0x1d, 0xc9, 0x27, 0x12, 0xa9, 0x41, 0x30, 0x6e,
+    0x1e, 0x42, 0x30, 0xf5, 0x31, 0x47, 0x27, 0xb0, 0xad, 0x9e, 0xa6, 0x63,
+    0x29, 0x1e, 0x9f, 0xfa, 0xab, 0xa8, 0x2a, 0x9d, 0x1d, 0x74, 0x30, 0x44,
+    0x2a, 0x8e, 0xb2, 0xea, 0xa0, 0xc6, 0xad, 0x3d, 0x2f, 0x52, 0xb0, 0xbb,
+    0xb0, 0x2d, 0xaf, 0xf2, 0x2f, 0x85, 0x25, 0x6c, 0xae, 0xe5, 0x29, 0xe8,
+    0x2c, 0x1d, 0xa8, 0x50, 0xb0, 0x6c, 0xb1, 0x41, 0x2a, 0x0e, 0x2c, 0xf5,
+    0xb3, 0xe5, 0x15, 0x17, 0x31, 0x23, 0xad, 0x24, 0xac, 0x7a, 0x33, 0x1d,
+    0xad, 0xc7, 0xac, 0x8f, 0x05, 0x12, 0xac, 0x27, 0x2b, 0x59, 0xaf, 0x4a,
+    0xa9, 0x46, 0xac, 0x9c, 0x2c, 0xe6, 0xae, 0x8e, 0xb0, 0xdd, 0xb1, 0x9f,
+    0x32, 0xf1, 0x29, 0xe6, 0xa9, 0xc8, 0x30, 0xfa, 0xac, 0x03, 0x2b, 0xce,
+    0x2f, 0x7b, 0xaf, 0xb2, 0xa1, 0xb4, 0x9c, 0x0d, 0x2f, 0xa6, 0x30, 0x74,
+    0xa7, 0x67, 0x26, 0x8a, 0x98, 0xf3, 0xad, 0xad, 0xb0, 0x43, 0x32, 0x1c,
+    0x30, 0x4b, 0xac, 0x35, 0xae, 0x6f, 0xb2, 0x36, 0x9e, 0x35, 0xa7, 0xaa,
+    0xac, 0x4f, 0x23, 0xce, 0x2d, 0xfd, 0xab, 0xd6, 0xae, 0x88, 0xaf, 0x3b,
+    0x2c, 0x35, 0x1d, 0xd2, 0xa2, 0xb0, 0xac, 0x48, 0xac, 0x4b, 0x2d, 0xe2,
+    0xa8, 0x81, 0x27, 0x48, 0xad, 0x6b, 0xb1, 0x18, 0xae, 0x04, 0x29, 0xae,
+    0xae, 0xbd, 0xa2, 0xa3, 0x20, 0x2d, 0x29, 0x40, 0xb0, 0x0d, 0xab, 0x7e,
+    0x2c, 0x40, 0x19, 0x28, 0xa8, 0x6c, 0xa0, 0xb1, 0x2f, 0x71, 0x1f, 0xbe,
+    0xa7, 0x8b, 0xa0, 0x1c, 0x26, 0x23, 0x21, 0x73, 0x2e, 0x59, 0xae, 0x8a,
+    0x2d, 0x0d, 0xa7, 0x21, 0xa4, 0x7c, 0xac, 0xc9, 0xa6, 0x70, 0x23, 0x30,
+    0x26, 0x51, 0xb0, 0x10, 0xad, 0x32, 0xb1, 0xcb, 0x1e, 0x01, 0x28, 0xa2,
+    0x2e, 0xaf, 0x21, 0x94, 0xad, 0xfd, 0xa9, 0x36, 0xa6, 0x81, 0x29, 0x04,
+    0x34, 0x23, 0x99, 0x29, 0xa3, 0x58, 0xa1, 0xb8, 0xb1, 0x8a, 0x2c, 0x8a,
+    0xaa, 0xe9, 0xb0, 0x33, 0xb0, 0xa7, 0xa6, 0x07, 0xae, 0x16, 0xaa, 0x35,
+    0xab, 0x35, 0xae, 0x99, 0xaa, 0x1f, 0xae, 0xb2, 0x25, 0x30, 0x28, 0x3d,
+    0x2a, 0xe2, 0xad, 0x55, 0x2e, 0xd5, 0xb4, 0x41, 0xad, 0x71, 0x2d, 0x92,
+    0xac, 0xf0, 0xac, 0xc9, 0x29, 0x1d, 0x2a, 0xa4, 0x1a, 0x80, 0x2e, 0xf3,
+    0xa0, 0x7d, 0x31, 0x80, 0xa9, 0x8a, 0xad, 0x76, 0x29, 0x90, 0xa9, 0x08,
+    0xab, 0x0d, 0x2d, 0xa9, 0x32, 0x27, 0x29, 0x91, 0x2a, 0x4d, 0xa5, 0xe0,
+    0xaa, 0x8e, 0x29, 0x7e, 0x2d, 0xd8, 0xac, 0x75, 0xb0, 0xd4, 0x25, 0x42,
+    0xa2, 0xb7, 0xa3, 0x64, 0x2d, 0x29, 0x2d, 0x04, 0xb0, 0xb7, 0xac, 0x3a,
+    0x1a, 0x81, 0xad, 0x44, 0x2b, 0xfe, 0x29, 0xca, 0x25, 0xda, 0x9a, 0x5f,
+    0xab, 0xe0, 0x2b, 0xe9, 0xa2, 0xca, 0x2e, 0xde, 0x2a, 0x5b, 0x21, 0x5e,
+    0x9e, 0x93, 0x2e, 0x07, 0xad, 0x65, 0x27, 0xfc, 0xaf, 0xcb, 0x18, 0x69,
+    0x2a, 0xf9, 0x26, 0x78, 0xaf, 0x59, 0xae, 0x93, 0xac, 0xbd, 0xad, 0x5a,
+    0x24, 0xcb, 0x9e, 0x02, 0x2d, 0x16, 0x2e, 0xb2, 0x2d, 0x4f, 0x2c, 0x47,
+    0x1c, 0x73, 0x2b, 0xad, 0xac, 0xf5, 0x2a, 0xb1, 0xac, 0xe6, 0xaf, 0x1f,
+    0xab, 0x22, 0xaf, 0x11, 0xa0, 0x16, 0x2b, 0x64, 0x28, 0xf1, 0xa7, 0x7e,
+    0x24, 0x5f, 0x29, 0xe5, 0xa7, 0x87, 0x2c, 0x26, 0x23, 0x54, 0x9c, 0xfb,
+    0x34, 0x25, 0x2e, 0x74, 0x2c, 0xbc, 0xad, 0x4a, 0x28, 0x27, 0x2c, 0x75,
+    0x2c, 0xae, 0xad, 0xec, 0xa5, 0x5a, 0x28, 0x49, 0x25, 0x67, 0xa8, 0xaa,
+    0x2f, 0xff, 0xa3, 0xf0, 0xa8, 0x2d, 0xb0, 0x32, 0xab, 0x4f, 0xa1, 0x40,
+    0x2e, 0x65, 0x2e, 0x67, 0xb0, 0x45, 0xad, 0x18, 0xae, 0x21, 0x24, 0xb3,
+    0x1d, 0x44, 0x29, 0x99, 0x31, 0x77, 0x2c, 0x30, 0xad, 0xa2, 0x2a, 0x24,
+    0x2c, 0xb4, 0xaa, 0x71, 0xb1, 0xb3, 0xb0, 0x48, 0xac, 0x6e, 0x99, 0x0c,
+    0xac, 0x33, 0xa7, 0xd0, 0xa8, 0x11, 0xad, 0x6c, 0xa0, 0x3c, 0xa9, 0x4d,
+    0xae, 0x43, 0x31, 0x17, 0xa2, 0x98, 0x2d, 0xcd, 0xa9, 0x3e, 0x9d, 0x87,
+    0xac, 0x03, 0x26, 0x67, 0x23, 0xb8, 0xb1, 0xc3, 0x2d, 0xfb, 0x2a, 0x56,
+    0xa8, 0x71, 0x20, 0x1d, 0x25, 0x75, 0x25, 0x6f, 0x20, 0x4b, 0x28, 0xee,
+    0xaa, 0x2d, 0x30, 0x1f, 0xa8, 0xba, 0xaa, 0x86, 0x2b, 0xbb, 0x24, 0x99,
+    0x2d, 0xa4, 0xa9, 0x83, 0xac, 0xbe, 0x12, 0x10, 0x2c, 0x46, 0xb0, 0x46,
+    0x28, 0xbd, 0xa8, 0x93, 0x09, 0x90, 0x2a, 0x0d, 0xaf, 0x19, 0x2b, 0x15,
+    0x27, 0xbe, 0xad, 0x1d, 0x19, 0x90, 0xa6, 0x7e, 0xa4, 0xfc, 0x29, 0x92,
+    0xa8, 0xc6, 0x25, 0xc7, 0xad, 0x3f, 0x2c, 0xb6, 0xa1, 0xd4, 0xa7, 0x2b,
+    0x27, 0x38, 0x26, 0x00, 0xa5, 0xc0, 0x2b, 0x52, 0x27, 0x74, 0xa9, 0xb3,
+    0xb0, 0x19, 0xab, 0xef, 0xac, 0x2c, 0x2b, 0x27, 0xb0, 0x2d, 0xac, 0x39,
+    0x2b, 0xb2, 0xa9, 0x36, 0xae, 0x8e, 0xac, 0xd9, 0xa8, 0x49, 0x1f, 0x87,
+    0xa5, 0xf8, 0xa6, 0x1f, 0xa7, 0x03, 0xb5, 0xd5, 0x28, 0xb5, 0x1c, 0x71,
+    0x23, 0xbc, 0x29, 0x45, 0xac, 0xe0, 0x29, 0xa3, 0x29, 0xbd, 0xa9, 0x90,
+    0xa2, 0xce, 0xad, 0x4a, 0xad, 0x18, 0x19, 0x15, 0x20, 0xc4, 0xa5, 0xfa,
+    0xab, 0xf7, 0xae, 0xa8, 0xac, 0x67, 0xa3, 0x2e, 0xa0, 0x46, 0xad, 0x3d,
+    0xaf, 0xfb, 0x2e, 0xa8, 0xa3, 0x45, 0xae, 0x45, 0xa9, 0xa1, 0xad, 0xd0,
+    0x27, 0xa7, 0x2c, 0x9a, 0xa7, 0x31, 0x25, 0x80, 0x9a, 0x91, 0xab, 0x79,
+    0xb1, 0x92, 0x2e, 0xcf, 0xa8, 0x37, 0x26, 0x8e, 0x24, 0xdf, 0xae, 0xc1,
+    0xae, 0x17, 0x28, 0x4c, 0x27, 0x14, 0x2c, 0x5c, 0x34, 0x9d, 0xad, 0x92,
+    0x8b, 0x15, 0xac, 0x7e, 0xab, 0x89, 0x28, 0x98, 0xae, 0xef, 0xb0, 0xfb,
+    0xa0, 0x54, 0x31, 0x6a, 0xad, 0x0f, 0xb1, 0x0b, 0x2a, 0x90, 0xaf, 0xd1,
+    0xab, 0xd2, 0xa1, 0xc3, 0x32, 0x3d, 0x2c, 0x20, 0x24, 0x90, 0x0f, 0x1c,
+    0xab, 0x4d, 0xb0, 0xf1, 0xa8, 0x2a, 0x29, 0x04, 0x1f, 0xdb, 0xaa, 0x4d,
+    0x2d, 0x26, 0xa6, 0xee, 0x82, 0xbb, 0xa8, 0x84, 0x1f, 0xf5, 0x2c, 0xe8,
+    0xad, 0x54, 0x2c, 0xbf, 0xa8, 0x92, 0x99, 0x78, 0xab, 0xf6, 0xa4, 0x99,
+    0x27, 0x03, 0x19, 0x24, 0xb0, 0x1a, 0x26, 0x8b, 0xa5, 0x64, 0x2f, 0x5a,
+    0x19, 0xa1, 0x29, 0xce, 0x28, 0x6b, 0xae, 0x56, 0xad, 0xaf, 0xad, 0x2b,
+    0xb0, 0xe6, 0xaa, 0x2b, 0x2c, 0xea, 0x23, 0xdb, 0x2d, 0xba, 0x0c, 0x61,
+    0xab, 0x3e, 0x9e, 0xf0, 0x2f, 0x5d, 0x96, 0x69, 0xb0, 0xa7, 0xab, 0x09,
+    0xae, 0x97, 0xa5, 0x3d, 0x29, 0x4e, 0xad, 0x77, 0xac, 0x18, 0xa2, 0x6d,
+    0xaf, 0x42, 0x2c, 0x53, 0xb3, 0xf7, 0xaf, 0x21, 0xad, 0x5b, 0x30, 0x5d,
+    0xaf, 0x97, 0xae, 0x85, 0x30, 0x27, 0xb1, 0x81, 0x27, 0x2d, 0xae, 0xb3,
+    0x2c, 0xac, 0x2e, 0x52, 0xb0, 0x12, 0xb5, 0x0e, 0x24, 0x08, 0x30, 0x5e,
+    0xa8, 0x63, 0x2c, 0x68, 0xad, 0x23, 0x26, 0x9c, 0x28, 0xb4, 0x2a, 0x0b,
+    0x27, 0x25, 0xa5, 0x2e, 0xaf, 0x8b, 0x28, 0x55, 0x2d, 0xc6, 0x22, 0xd6,
+    0xac, 0x33, 0x30, 0x85, 0x22, 0x3d, 0x24, 0xda, 0x2d, 0xef, 0x26, 0xf3,
+    0xa9, 0xb8, 0x26, 0x80, 0xac, 0x35, 0x9c, 0x31, 0xa5, 0x41, 0x19, 0xb9,
+    0x31, 0x73, 0x26, 0xa0, 0xa7, 0x40, 0xac, 0x96, 0xac, 0x2a, 0xa7, 0xa2,
+    0xac, 0xc4, 0x29, 0xf6, 0xac, 0xcd, 0xa4, 0x77, 0x2e, 0x17, 0xad, 0x51,
+    0x29, 0x5f, 0xa7, 0xd3, 0xb0, 0xce, 0xa6, 0xcc, 0xb0, 0x57, 0xb1, 0x69,
+    0xa1, 0x51, 0x25, 0x40, 0xa9, 0x78, 0xae, 0xbb, 0xab, 0xe2, 0xad, 0x86,
+    0x24, 0xaf, 0xb4, 0x11, 0x2c, 0x2d, 0xa8, 0x8b, 0xae, 0xa0, 0xb1, 0x8a,
+    0x31, 0x81, 0xae, 0x69, 0x99, 0x15, 0xb0, 0x9b, 0x2c, 0x4a, 0x2f, 0x2c,
+    0x2e, 0x53, 0xad, 0xef, 0x2d, 0xd5, 0xa5, 0x8c, 0xac, 0x71, 0x2a, 0xc9,
+    0xa0, 0x02, 0x0a, 0xd4, 0x9d, 0x5d, 0x29, 0x27, 0xaa, 0xd4, 0xb2, 0xd0,
+    0xa3, 0x78, 0x22, 0x35, 0x24, 0x55, 0xa8, 0x5c, 0xb0, 0xde, 0x27, 0x31,
+    0xad, 0x5b, 0xad, 0x13, 0x26, 0x41, 0x9d, 0x7e, 0x27, 0xf9, 0x2c, 0xe7,
+    0x2c, 0x1f, 0xad, 0xe5, 0xac, 0xe1, 0x26, 0x71, 0x21, 0x39, 0xb0, 0xb6,
+    0xa9, 0x70, 0xa7, 0x0c, 0xb0, 0x6f, 0x2b, 0x7c, 0x2a, 0xb0, 0xad, 0x2f,
+    0x2b, 0x8f, 0x29, 0x7c, 0xac, 0x42, 0xa3, 0x3f, 0xb0, 0x65, 0x24, 0x46,
+    0xb3, 0x84, 0x2d, 0x9e, 0xae, 0x30, 0x25, 0x60, 0xa8, 0xf3, 0xa5, 0xf0,
+    0xa4, 0xc9, 0xa5, 0x41, 0xae, 0x45, 0x2d, 0x39, 0x2e, 0xb3, 0xae, 0x32,
+    0x2a, 0x94, 0xac, 0x6f, 0xb0, 0x6a, 0xac, 0x26, 0x21, 0x28, 0xac, 0x88,
+    0x30, 0x1b, 0x2d, 0xa6, 0x2c, 0x7c, 0x2f, 0x80, 0x23, 0xf4, 0x24, 0xba,
+    0x1e, 0xbd, 0x28, 0xdc, 0xa5, 0x4a, 0xa7, 0xb9, 0xab, 0xcf, 0x2a, 0x8f,
+    0x2f, 0xfe, 0x30, 0x47, 0x2e, 0x7b, 0xab, 0x7c, 0x2d, 0xf1, 0x2b, 0xe3,
+    0x1c, 0xfc, 0x25, 0x1e, 0xab, 0xe4, 0xaa, 0xd5, 0xa9, 0x39, 0x2d, 0xad,
+    0x2e, 0xda, 0x2e, 0x91, 0x2f, 0xda, 0xa8, 0xb1, 0x27, 0x4c, 0xa8, 0x80,
+    0x2c, 0x8a, 0x2c, 0xcf, 0x2c, 0x95, 0x2d, 0xa9, 0xa6, 0x61, 0x28, 0xe1,
+    0x30, 0xd7, 0xae, 0xb9, 0x24, 0x6e, 0xaf, 0x7f, 0x32, 0xe1, 0x2a, 0x9e,
+    0x2a, 0xa5, 0x2a, 0xba, 0xa9, 0x82, 0x24, 0x6c, 0xb1, 0x6d, 0xaa, 0x94,
+    0x2d, 0x16, 0x32, 0x55, 0xa9, 0xaf, 0x1e, 0xad, 0x27, 0x09, 0x2e, 0x74,
+    0x1f, 0xe8, 0xae, 0x0d, 0xb0, 0x48, 0xac, 0x88, 0xaf, 0x0b, 0xa4, 0x1e,
+    0xb1, 0x0a, 0x2e, 0xd5, 0x22, 0xf4, 0xae, 0x3c, 0xa2, 0x6f, 0xaa, 0x66,
+    0xaf, 0xbb, 0xae, 0xae, 0x2c, 0x3c, 0xb0, 0x0d, 0x9f, 0x96, 0xab, 0x1f,
+    0xab, 0x02, 0x99, 0x8a, 0x26, 0x5b, 0x22, 0x88, 0x2e, 0x55, 0x2b, 0x65,
+    0x19, 0x8f, 0x28, 0x6b, 0xa9, 0x16, 0x2c, 0xb2, 0x25, 0x55, 0xa8, 0x36,
+    0xb1, 0xdd, 0xa5, 0x1b, 0xb0, 0xa6, 0x24, 0xe9, 0xa1, 0x5e, 0xa3, 0x97,
+    0xa3, 0xc5, 0xb0, 0xb3, 0x8a, 0x45, 0xb0, 0x9c, 0xad, 0xfd, 0xaf, 0x59,
+    0x2f, 0xb0, 0xb0, 0xb2, 0x22, 0x47, 0x28, 0x3e, 0x14, 0x04, 0xaf, 0x44,
+    0x21, 0x37, 0xa7, 0x98, 0x2e, 0xe6, 0xa6, 0xdf, 0xa8, 0x9c, 0xad, 0x37,
+    0xae, 0x1a, 0xaf, 0xce, 0xb2, 0xef, 0xad, 0x9e, 0x2b, 0x05, 0x23, 0x84,
+    0x28, 0xc5, 0x25, 0x0b, 0xab, 0xc6, 0xad, 0xe9, 0xa9, 0xbf, 0x28, 0xc5,
+    0x23, 0xb0, 0x24, 0xc2, 0xa9, 0xfb, 0x22, 0xc6, 0xb0, 0x59, 0xa4, 0xac,
+    0xb0, 0xc1, 0xad, 0x50, 0x26, 0xb0, 0x2c, 0x27, 0x2e, 0xee, 0xad, 0x48,
+    0x2d, 0x46, 0xa0, 0x37, 0x30, 0x14, 0xae, 0x94, 0x99, 0xb2, 0x26, 0x98,
+    0xa0, 0x3f, 0xaa, 0xd6, 0xab, 0x7a, 0x30, 0x39, 0x2d, 0x11, 0x1b, 0x2d,
+    0xa8, 0xf8, 0x8d, 0xca, 0x24, 0xd2, 0xad, 0xc6, 0xae, 0x41, 0x25, 0xa4,
+    0xaf, 0x62, 0x25, 0x1d, 0xac, 0xf9, 0x98, 0x3b, 0x24, 0x1a, 0xa6, 0x33,
+    0xab, 0xf7, 0xb0, 0x4c, 0xad, 0x27, 0x2b, 0x93, 0x2c, 0x0b, 0xab, 0xc2,
+    0x2c, 0xe3, 0x1e, 0xce, 0xa1, 0x1a, 0xaf, 0xb5, 0xae, 0x65, 0xa9, 0x1e,
+    0x32, 0x33, 0xae, 0x65, 0x91, 0xff, 0x9f, 0xf2, 0x2b, 0x93, 0xaa, 0x40,
+    0xaf, 0x3e, 0x2a, 0x9f, 0x29, 0xfc, 0x32, 0xc1, 0xa9, 0xd0, 0x29, 0x4f,
+    0x9a, 0x77, 0x29, 0xe5, 0xb0, 0x71, 0x33, 0xd9, 0x2b, 0x17, 0xae, 0x79,
+    0x2e, 0x28, 0xa7, 0x4e, 0xa4, 0x70, 0xad, 0x84, 0x27, 0x64, 0xac, 0xc2,
+    0xad, 0xb6, 0xac, 0x06, 0xab, 0x94, 0xb1, 0xa1, 0x25, 0x32, 0xae, 0xa4,
+    0x2c, 0x64, 0xac, 0x0e, 0x2f, 0x1f, 0xac, 0xa2, 0xa5, 0x31, 0x29, 0x04,
+    0x33, 0x7a, 0x2e, 0x50, 0xb0, 0x22, 0xb0, 0x91, 0xab, 0x4b, 0x2a, 0xcf,
+    0xa6, 0x8f, 0x2c, 0x31, 0xae, 0x31, 0xa1, 0x27, 0xac, 0xe8, 0xa4, 0x6c,
+    0xb0, 0x09, 0x20, 0x67, 0xac, 0xb2, 0xa8, 0x39, 0xb0, 0x3e, 0xa7, 0xa4,
+    0xad, 0x2a, 0x28, 0x4a, 0xa4, 0x5f, 0xa2, 0x5f, 0xa6, 0xda, 0xa5, 0x45,
+    0xac, 0x45, 0x29, 0x0a, 0x9f, 0xb1, 0xad, 0x71, 0x27, 0x34, 0xb2, 0xc3,
+    0x9d, 0x1f, 0xaf, 0xdc, 0x2c, 0xd5, 0x2c, 0xcc, 0xb0, 0xb6, 0x28, 0x66,
+    0x32, 0xd3, 0x2d, 0x1f, 0xb1, 0xf6, 0xa3, 0x06, 0x2e, 0x3a, 0x2c, 0xf2,
+    0xb2, 0xb9, 0xab, 0x63, 0xa9, 0x88, 0x32, 0xbd, 0x30, 0x3c, 0xae, 0x01,
+    0xa1, 0x78, 0xad, 0xab, 0xa7, 0x66, 0xb0, 0x11, 0xae, 0x8f, 0x26, 0x58,
+    0xae, 0xc6, 0x32, 0xdb, 0x27, 0xc3, 0x29, 0x7e, 0x2e, 0x2f, 0x27, 0xd1,
+    0xb1, 0x53, 0xad, 0x38, 0xa0, 0xf2, 0x29, 0x31, 0x31, 0x8f, 0x15, 0xc5,
+    0x2d, 0x94, 0xa9, 0x07, 0x2d, 0xd5, 0x30, 0x3e, 0xa3, 0xcf, 0x2e, 0xd4,
+    0xaa, 0x6e, 0x29, 0xeb, 0x2f, 0x04, 0x31, 0x32, 0x2a, 0x86, 0x28, 0x1a,
+    0xae, 0xd7, 0xa0, 0x40, 0xa4, 0x94, 0x30, 0xdd, 0x2a, 0x64, 0x2f, 0xaa,
+    0x2c, 0x5d, 0x27, 0xf2, 0x31, 0xb7, 0x29, 0xd5, 0xa0, 0xd9, 0xa7, 0x73,
+    0x27, 0x70, 0x30, 0xcc, 0x32, 0xee, 0xa3, 0xd4, 0x1f, 0x70, 0x2f, 0xa2,
+    0x2b, 0xd8, 0x24, 0x5f, 0xa4, 0x08, 0xb2, 0x44, 0xad, 0x53, 0x2c, 0xcd,
+    0xb0, 0x88, 0xad, 0xa2, 0x31, 0xf9, 0xa6, 0xb8, 0xa8, 0x2d, 0x30, 0x9d,
+    0xa3, 0x0c, 0xa8, 0x21, 0x32, 0xe3, 0xa0, 0xda, 0xa6, 0xa4, 0xa2, 0x33,
+    0x9c, 0x82, 0xa7, 0x0b, 0xa9, 0xa4, 0xad, 0x91, 0xaf, 0xc0, 0x34, 0xc3,
+    0x2c, 0x7d, 0x2e, 0x8f, 0x1b, 0x9c, 0x2f, 0xf2, 0xae, 0x1d, 0x2c, 0x5a,
+    0xa1, 0x1a, 0x2d, 0x17, 0xa0, 0xc0, 0x30, 0xc7, 0x24, 0x6c, 0x30, 0x7d,
+    0x31, 0x3c, 0x1f, 0x46, 0x2a, 0x9d, 0x26, 0xa1, 0x28, 0x7a, 0xae, 0x94,
+    0x2c, 0xa4, 0x30, 0x5a, 0x34, 0xdb, 0xae, 0xee, 0x24, 0x6a, 0xad, 0x90,
+    0xaf, 0x21, 0x2d, 0x43, 0x29, 0x4d, 0x2c, 0x3c, 0xa2, 0x53, 0xae, 0x78,
+    0x2a, 0xa2, 0x2e, 0xa1, 0x20, 0x06, 0xa1, 0x94, 0x2c, 0xd1, 0x31, 0xdf,
+    0x31, 0xb0, 0x27, 0x05, 0x2d, 0x11, 0xa8, 0xf3, 0xac, 0x23, 0x2b, 0x07,
+    0xa6, 0x1c, 0x2e, 0x9c, 0x1e, 0xfc, 0x24, 0xfc, 0x92, 0x2b, 0x28, 0x47,
+    0xa8, 0x28, 0xa8, 0xa7, 0x2e, 0x4a, 0x9f, 0x52, 0xab, 0x0c, 0x2f, 0x46,
+    0x26, 0x09, 0xa9, 0x1b, 0x29, 0x3b, 0x2a, 0xb2, 0xac, 0x93, 0xa6, 0x97,
+    0x26, 0x72, 0x27, 0x9f, 0x25, 0x02, 0x30, 0xcb, 0x2e, 0x0c, 0x08, 0x1a,
+    0xad, 0xa5, 0xa8, 0x37, 0x22, 0xb2, 0xa0, 0x08, 0x2f, 0x00, 0xa4, 0x2e,
+    0x2d, 0xba, 0x30, 0x7d, 0x27, 0xd3, 0x2c, 0x8a, 0x2d, 0x2f, 0x28, 0x8a,
+    0x31, 0x7a, 0xa9, 0x49, 0x2b, 0xf9, 0x2b, 0x67, 0x32, 0x96, 0x9f, 0x8f,
+    0x30, 0xa5, 0x2f, 0xf9, 0x26, 0x0a, 0xb0, 0x47, 0x28, 0xee, 0xa6, 0xbd,
+    0xab, 0x87, 0x30, 0x78, 0x15, 0xe4, 0x2a, 0x15, 0x30, 0x15, 0xb1, 0xc8,
+    0xa2, 0x3f, 0xb0, 0x82, 0x30, 0x3c, 0xa3, 0x25, 0x2b, 0x86, 0x31, 0xcd,
+    0x22, 0x74, 0x2d, 0xca, 0xab, 0x67, 0x2d, 0x17, 0xae, 0x56, 0xb2, 0xd4,
+    0xae, 0x71, 0xa0, 0x11, 0xb0, 0xe6, 0xa3, 0x32, 0xad, 0xb4, 0x9e, 0x1c,
+    0x30, 0x48, 0x28, 0x60, 0xab, 0x79, 0x1c, 0xd2, 0x2a, 0x1c, 0xae, 0x5d,
+    0xaa, 0x35, 0xac, 0x17, 0xb0, 0x0a, 0x2c, 0xc5, 0xaf, 0x9c, 0xad, 0x9e,
+    0xa9, 0x6a, 0x9c, 0x14, 0x94, 0x1a, 0x2f, 0x0d, 0x9a, 0x69, 0x9c, 0xa7,
+    0x0e, 0x7c, 0x1f, 0xbb, 0x2e, 0xf3, 0x2d, 0xcf, 0x23, 0x73, 0x2b, 0xbc,
+    0x28, 0x69, 0x2f, 0xf6, 0xa4, 0xc7, 0x2a, 0x4f, 0xb0, 0x86, 0xb0, 0x5c,
+    0x2c, 0x01, 0x2c, 0x47, 0xad, 0x3c, 0xac, 0xd2, 0x13, 0x63, 0x13, 0xe8,
+    0xae, 0x57, 0xac, 0x6f, 0xaf, 0x9a, 0x2d, 0x2b, 0xaa, 0xa1, 0x2b, 0xfe,
+    0xa0, 0x69, 0x2a, 0x78, 0x30, 0xc2, 0x2e, 0x2f, 0xab, 0xd5, 0xaf, 0x43,
+    0xa6, 0x74, 0xa0, 0xff, 0xa7, 0x6d, 0x30, 0xb5, 0xb0, 0x12, 0x2f, 0xbf,
+    0xa8, 0x7b, 0xab, 0xd0, 0xae, 0x8f, 0xa7, 0x16, 0xa5, 0xad, 0x9b, 0x31,
+    0x31, 0x41, 0x24, 0xea, 0xaf, 0xd1, 0x25, 0x50, 0x28, 0xf7, 0x9f, 0x55,
+    0xac, 0x91, 0xa8, 0xdf, 0xa4, 0xc2, 0xac, 0xba, 0xb1, 0x62, 0x2d, 0x54,
+    0xa9, 0x2f, 0xa8, 0x0e, 0xae, 0xf2, 0xac, 0x9e, 0xa6, 0xbd, 0x2d, 0xa4,
+    0x2f, 0x27, 0xb2, 0x38, 0x35, 0x70, 0xae, 0x19, 0xac, 0xf5, 0x2c, 0x42,
+    0x2c, 0xc4, 0x27, 0xd3, 0x2e, 0xb2, 0x15, 0x3c, 0x2c, 0x16, 0xb4, 0xf9,
+    0xa7, 0x3c, 0xad, 0x4f, 0x28, 0x8c, 0xad, 0x60, 0x1e, 0x64, 0x2c, 0xc7,
+    0xa0, 0x8e, 0x2c, 0x7d, 0x26, 0xb5, 0xac, 0xf4, 0xac, 0x9f, 0xae, 0x39,
+    0xaa, 0x9f, 0xb1, 0xf8, 0x23, 0xe0, 0xa3, 0x97, 0xab, 0x5f, 0x99, 0x0e,
+    0x29, 0x83, 0x2b, 0x74, 0x9a, 0xdc, 0xb0, 0x33, 0x30, 0x1c, 0x2d, 0x2a,
+    0x2f, 0x19, 0x1c, 0x59, 0x2b, 0x00, 0xad, 0xd1, 0xae, 0xf1, 0x23, 0x68,
+    0xac, 0x5f, 0x31, 0xd3, 0x26, 0xfb, 0x27, 0xac, 0xac, 0x20, 0x2f, 0xaf,
+    0x25, 0xeb, 0x2b, 0xf2, 0xab, 0x6b, 0x2c, 0x42, 0xae, 0x8b, 0x26, 0x22,
+    0x28, 0xd0, 0x2e, 0x7c, 0xa9, 0xa6, 0xa5, 0xcd, 0x28, 0x42, 0x2c, 0x33,
+    0x2f, 0x16, 0x27, 0xd6, 0xae, 0x01, 0x2e, 0xa9, 0xaa, 0x13, 0xb0, 0x7b,
+    0x33, 0x19, 0xa8, 0xbd, 0x1d, 0x0a, 0x2d, 0xbc, 0xa0, 0x6b, 0x2b, 0x3d,
+    0xa8, 0x55, 0x08, 0xb8, 0xab, 0xf4, 0x27, 0x1f, 0x28, 0x59, 0xac, 0xf8,
+    0xab, 0xdc, 0x25, 0xe9, 0x2d, 0x16, 0x23, 0x50, 0xae, 0xbe, 0xab, 0x68,
+    0x32, 0xd4, 0xae, 0x2a, 0xad, 0x28, 0x2b, 0x57, 0xb2, 0x50, 0xa9, 0x2c,
+    0xb0, 0x40, 0xb0, 0xb5, 0x23, 0xe8, 0xad, 0xf3, 0x98, 0xd1, 0x2e, 0x8d,
+    0x2a, 0x28, 0x26, 0xc8, 0x27, 0x20, 0x31, 0x8f, 0x2e, 0xd8, 0xa9, 0x79,
+    0x23, 0x05, 0xae, 0x4f, 0xa8, 0x05, 0xa6, 0x96, 0xa3, 0x2a, 0x20, 0xda,
+    0x2f, 0x02, 0x33, 0xd2, 0xac, 0x17, 0xad, 0x3b, 0x22, 0x1e, 0x31, 0x0a,
+    0xac, 0xdf, 0x2f, 0xa4, 0xaa, 0x7b, 0xa1, 0x71, 0x18, 0x8d, 0xa7, 0x0d,
+    0xb0, 0xee, 0xaf, 0x1d, 0x25, 0x92, 0xac, 0x14, 0x30, 0xa8, 0x26, 0xd0,
+    0xaf, 0x3f, 0xad, 0x4c, 0xad, 0x7a, 0xaf, 0x36, 0x29, 0xce, 0x8d, 0xb0,
+    0xa9, 0x2b, 0xb3, 0xa9, 0x25, 0xdd, 0x2c, 0xea, 0xaf, 0xb9, 0x2a, 0x7d,
+    0xab, 0x7e, 0xb3, 0x0a, 0xb0, 0xfa, 0x9d, 0xee, 0xa8, 0x17, 0xa9, 0x7b,
+    0xaa, 0xff, 0xa1, 0x45, 0xac, 0x57, 0x30, 0x2a, 0xaa, 0x39, 0xae, 0x01,
+    0xb0, 0xa4, 0x29, 0x10, 0xa4, 0x81, 0x23, 0x2b, 0xa9, 0xf3, 0x27, 0xa3,
+    0xa0, 0x1e, 0x2b, 0x3f, 0xab, 0x57, 0x2e, 0xf7, 0x25, 0xca, 0xb0, 0x78,
+    0x26, 0x2d, 0x2d, 0x0d, 0x2c, 0x40, 0x2d, 0x7d, 0xb1, 0xb0, 0xad, 0xa2,
+    0xaa, 0x0f, 0xaf, 0xe8, 0xa6, 0xb9, 0xb1, 0x2f, 0xb2, 0x4c, 0x2f, 0xd9,
+    0xac, 0xa2, 0xb3, 0x52, 0xae, 0x1f, 0xb1, 0x6a, 0xac, 0x29, 0x2c, 0x7a,
+    0x30, 0x8c, 0xac, 0x77, 0xa2, 0x6e, 0x30, 0x06, 0x2d, 0xd2, 0x25, 0xd5,
+    0x24, 0x6e, 0xa7, 0x58, 0x23, 0xb4, 0x24, 0x9e, 0xac, 0xd2, 0x2c, 0xc4,
+    0x2a, 0x0d, 0xb0, 0xfd, 0x30, 0x11, 0xab, 0x60, 0x9c, 0x3b, 0xb0, 0x93,
+    0x29, 0x9f, 0xad, 0x37, 0xac, 0x4c, 0x17, 0x11, 0xa5, 0x37, 0xaa, 0xf9,
+    0xad, 0x48, 0xae, 0x42, 0xa8, 0x06, 0xa7, 0x61, 0xa0, 0x0d, 0xad, 0x2c,
+    0x30, 0x74, 0x27, 0x37, 0xa1, 0x10, 0x2a, 0x47, 0xab, 0xec, 0x2a, 0x87,
+    0xab, 0x89, 0x2c, 0x85, 0xac, 0x37, 0x2c, 0x3c, 0xab, 0xfe, 0x2c, 0xfc,
+    0xac, 0x96, 0xa6, 0xa7, 0xa9, 0xd7, 0xaf, 0xfa, 0xae, 0x2d, 0x28, 0x37,
+    0x2f, 0x21, 0x2d, 0x08, 0xaf, 0x89, 0xa8, 0x08, 0xad, 0x1e, 0x2e, 0xcc,
+    0xad, 0xb4, 0xb0, 0xe1, 0xaf, 0x00, 0x2f, 0xce, 0xa8, 0x8a, 0xb0, 0xa3,
+    0x9d, 0xb8, 0xb1, 0xfa, 0xaa, 0x3a, 0x20, 0xd2, 0xaa, 0x9c, 0x26, 0xb9,
+    0xb0, 0xb4, 0xab, 0xb5, 0xab, 0x63, 0xab, 0xa1, 0xac, 0x7b, 0xad, 0x35,
+    0x29, 0x19, 0xac, 0x8c, 0xae, 0x80, 0x26, 0x14, 0x2d, 0xbd, 0xa9, 0xfc,
+    0x2c, 0x3c, 0x2a, 0xad, 0xad, 0x3d, 0x23, 0x59, 0x99, 0xce, 0x25, 0x68,
+    0x2d, 0x83, 0xa7, 0x5a, 0x98, 0x40, 0x28, 0x80, 0xac, 0x95, 0x2c, 0x6f,
+    0xae, 0x30, 0xab, 0xd0, 0x22, 0x58, 0xad, 0xc4, 0x27, 0x91, 0x29, 0x28,
+    0x2b, 0xb9, 0xa6, 0x1c, 0xae, 0x80, 0x2b, 0x0e, 0xae, 0xb8, 0x2d, 0x1f,
+    0x16, 0xd3, 0xa7, 0xb4, 0xaa, 0xe3, 0xae, 0x04, 0x9d, 0xbd, 0x1b, 0x43,
+    0xae, 0x66, 0xa9, 0x53, 0x2c, 0xc8, 0xa1, 0x35, 0xae, 0x83, 0x9c, 0x3d,
+    0xa4, 0x2c, 0xa0, 0x02, 0x9f, 0xb2, 0xab, 0x49, 0x24, 0x17, 0xb1, 0x7a,
+    0xb1, 0xe5, 0xa6, 0x68, 0xae, 0x16, 0x29, 0x63, 0xa5, 0xd5, 0xae, 0x18,
+    0xab, 0xb3, 0xb0, 0x2c, 0xa8, 0xf5, 0xa6, 0xba, 0xae, 0xb2, 0x30, 0x30,
+    0x21, 0x25, 0xb3, 0xd9, 0x2e, 0x82, 0xa8, 0xb9, 0x2d, 0x5e, 0xaf, 0x93,
+    0xac, 0x84, 0x2d, 0x9b, 0x2a, 0x5d, 0x2a, 0x7f, 0x21, 0x0d, 0x89, 0x0d,
+    0xad, 0xb6, 0x28, 0x5e, 0xa4, 0x83, 0xa0, 0x41, 0xad, 0x43, 0xa8, 0x03,
+    0xac, 0x0d, 0x1e, 0xd2, 0xae, 0xd1, 0x26, 0xd2, 0x2e, 0x23, 0x9e, 0xb6,
+    0x27, 0xed, 0xab, 0x6a, 0x25, 0x3e, 0xac, 0xfb, 0x2e, 0x8e, 0x30, 0x97,
+    0x92, 0x78, 0x2e, 0x0b, 0x2b, 0xa5, 0x2d, 0xbd, 0xa4, 0x3b, 0x24, 0xe0,
+    0xb0, 0x9a, 0xa7, 0x2e, 0xa6, 0x58, 0x22, 0x45, 0xad, 0x39, 0xad, 0xe8,
+    0x2e, 0x13, 0xaf, 0x4c, 0x2b, 0x33, 0xa1, 0xd0, 0x2a, 0xd7, 0x2d, 0xb7,
+    0xac, 0xc5, 0xac, 0x18, 0xa8, 0x82, 0xb0, 0x00, 0xb2, 0xa3, 0x2f, 0x1a,
+    0xa6, 0x25, 0xae, 0x0c, 0x27, 0x71, 0xad, 0x3c, 0xa7, 0xb3, 0x2c, 0x2c,
+    0xb1, 0x24, 0xab, 0x79, 0xae, 0xc6, 0x24, 0x2d, 0x9b, 0x83, 0xab, 0xf4,
+    0x9c, 0xa6, 0xac, 0x23, 0x9d, 0x29, 0x2e, 0x20, 0x25, 0x76, 0x2d, 0xdd,
+    0xa8, 0x87, 0x18, 0xf7, 0x2b, 0xaf, 0x26, 0xd6, 0xa8, 0x94, 0x2b, 0x46,
+    0xa9, 0xb9, 0xaf, 0xe9, 0x18, 0x2c, 0x30, 0x78, 0xac, 0x4a, 0x26, 0xb3,
+    0x28, 0x32, 0xaf, 0xc2, 0x2f, 0x6a, 0xa7, 0x46, 0xa4, 0x01, 0xa8, 0x28,
+    0x30, 0x64, 0xa1, 0x43, 0x2e, 0xe4, 0x2d, 0xaa, 0xa7, 0x84, 0xb1, 0x34,
+    0xad, 0x13, 0x24, 0xc7, 0x2d, 0xaf, 0xac, 0x9a, 0xaf, 0x60, 0xa5, 0xad,
+    0xaf, 0x0b, 0xb0, 0x53, 0xae, 0x89, 0xaa, 0xdf, 0x2d, 0xbb, 0xb1, 0x23,
+    0x2e, 0x7f, 0xb2, 0x66, 0x30, 0x0c, 0x30, 0xbf, 0xaa, 0x61, 0x2f, 0x47,
+    0x25, 0x4a, 0xac, 0xff, 0xb2, 0x1b, 0x28, 0x6f, 0x21, 0x42, 0x28, 0x4b,
+    0x2c, 0xa3, 0xa4, 0x3e, 0xa8, 0x1f, 0x29, 0x16, 0xa7, 0xd9, 0x19, 0x47,
+    0xad, 0x40, 0xa2, 0x15, 0x33, 0xbf, 0x26, 0x62, 0x2c, 0x16, 0xa7, 0xb6,
+    0xa9, 0x17, 0x29, 0x58, 0x2e, 0x70, 0x31, 0x8a, 0xa7, 0xd7, 0x29, 0x11,
+    0x30, 0x26, 0x31, 0x17, 0xad, 0xe8, 0x32, 0x58, 0xae, 0x39, 0x25, 0x05,
+    0x27, 0xfc, 0x1d, 0x3a, 0x2e, 0x98, 0x31, 0x16, 0x28, 0xea, 0xa6, 0x3a,
+    0x24, 0x0d, 0x2d, 0x0a, 0x28, 0x13, 0xac, 0xfd, 0x2b, 0x03, 0xa9, 0x9a,
+    0x31, 0x3f, 0x31, 0x5c, 0x2d, 0x29, 0xa9, 0x69, 0x21, 0xe8, 0x28, 0x49,
+    0x2c, 0xcf, 0xac, 0x52, 0x2d, 0x5e, 0x8d, 0x10, 0xa7, 0xa3, 0x23, 0x83,
+    0x22, 0xaa, 0xa9, 0x78, 0x30, 0xe4, 0xb0, 0x58, 0xac, 0xda, 0xad, 0xc6,
+    0x31, 0x24, 0x2f, 0x10, 0xaf, 0x7e, 0x2c, 0xe4, 0x30, 0xb9, 0xb0, 0x07,
+    0xae, 0x68, 0x28, 0xae, 0xa8, 0x4c, 0x31, 0x83, 0x2b, 0x94, 0x95, 0x39,
+    0xa4, 0x4e, 0x31, 0x6c, 0x2b, 0x56, 0x2e, 0x32, 0x2f, 0xde, 0x2a, 0x29,
+    0x2f, 0x7d, 0xaa, 0xc4, 0x30, 0x39, 0xa4, 0xf9, 0x29, 0x67, 0xac, 0x4c,
+    0x2d, 0xa8, 0xab, 0x16, 0x2e, 0xe6, 0xa4, 0x1f, 0xac, 0xaf, 0x26, 0x93,
+    0x26, 0x0f, 0x2b, 0x30, 0xa6, 0x73, 0xaa, 0x68, 0xb1, 0x0a, 0x2b, 0x93,
+    0xb0, 0xd0, 0x2c, 0xf2, 0x28, 0xb4, 0x2b, 0x63, 0xb4, 0xf0, 0x1a, 0xe9,
+    0x2f, 0x8e, 0x2d, 0xa9, 0xa7, 0x13, 0x30, 0x31, 0xb0, 0x80, 0xa5, 0xd8,
+    0xac, 0x09, 0x28, 0x90, 0x21, 0x10, 0x2e, 0x3f, 0xa2, 0xbb, 0x26, 0x51,
+    0x8c, 0xff, 0x26, 0xfa, 0xa8, 0x7c, 0xa9, 0x95, 0xaa, 0xf2, 0x26, 0xfa,
+    0x30, 0x04, 0x2e, 0x17, 0x2a, 0x3c, 0x2c, 0x6b, 0xab, 0x04, 0x29, 0xb4,
+    0xad, 0x97, 0x18, 0xcf, 0x22, 0xc3, 0x2c, 0xe1, 0x28, 0x77, 0xa4, 0x1c,
+    0x24, 0x02, 0x1a, 0xf6, 0xac, 0xbe, 0x26, 0x4d, 0xa9, 0x4e, 0xb0, 0x12,
+    0x2c, 0xda, 0x30, 0x30, 0x2e, 0x40, 0x2c, 0x4f, 0x2d, 0xd7, 0x21, 0xaf,
+    0x2e, 0x97, 0x29, 0x3a, 0x28, 0xd2, 0x29, 0x84, 0xaa, 0xdb, 0xaa, 0xce,
+    0x2d, 0x14, 0x2b, 0x77, 0x21, 0x36, 0x26, 0x42, 0x2d, 0xae, 0x2c, 0x70,
+    0x2a, 0xe2, 0xab, 0xa2, 0xad, 0x4a, 0x2e, 0xb0, 0x2e, 0xe0, 0xb0, 0x6f,
+    0xad, 0x46, 0x30, 0x77, 0xb2, 0x4a, 0xaa, 0x46, 0x2e, 0x55, 0x30, 0x22,
+    0x2f, 0x25, 0x26, 0xb0, 0x2b, 0xca, 0xa9, 0xa4, 0xae, 0x41, 0x29, 0xca,
+    0x12, 0x66, 0x23, 0xb4, 0x2c, 0x23, 0xa3, 0x40, 0x21, 0xb3, 0xa2, 0x2c,
+    0x2c, 0x8b, 0x2d, 0x92, 0x24, 0x3c, 0x2e, 0x8f, 0x9a, 0x23, 0x35, 0x63,
+    0xac, 0x7b, 0xa8, 0xd7, 0x20, 0x74, 0x28, 0x1a, 0x2d, 0xa8, 0x21, 0x1f,
+    0x16, 0x80, 0x30, 0xb3, 0xab, 0xe8, 0x21, 0xc6, 0xac, 0x28, 0x34, 0x7a,
+    0x2c, 0x7e, 0x28, 0x13, 0xa3, 0xbc, 0xad, 0xc2, 0x2f, 0x00, 0x2e, 0x1a,
+    0x32, 0xee, 0x29, 0x4a, 0x2f, 0x4d, 0x27, 0x84, 0x9d, 0x9f, 0xac, 0xa7,
+    0xac, 0xb1, 0xa7, 0xcd, 0x94, 0xa0, 0xaf, 0x65, 0xa2, 0xd3, 0x2c, 0x79,
+    0x9d, 0x18, 0x27, 0x28, 0x29, 0xcf, 0x2e, 0x9b, 0xaf, 0x67, 0xb1, 0x4d,
+    0xb0, 0x08, 0xab, 0xab, 0xb0, 0x87, 0xa5, 0x9d, 0x2b, 0xfa, 0x2c, 0x1c,
+    0x24, 0x14, 0xa1, 0x26, 0x2c, 0xbc, 0x30, 0xd3, 0x30, 0x32, 0xae, 0x0f,
+    0xb1, 0x84, 0xaf, 0xee, 0xac, 0x62, 0x91, 0x1b, 0x25, 0x91, 0x2a, 0x90,
+    0x2e, 0x64, 0x2e, 0xc9, 0x2e, 0xd4, 0x2c, 0xeb, 0x24, 0x2e, 0xa5, 0x28,
+    0x2b, 0x7d, 0x28, 0x95, 0x26, 0xc8, 0xaa, 0xd0, 0x29, 0x95, 0x2c, 0xe3,
+    0xad, 0x18, 0x30, 0x7a, 0xa6, 0x8e, 0xa7, 0x7f, 0x2b, 0x6e, 0x2d, 0xdf,
+    0xa9, 0xe0, 0x94, 0x67, 0xb0, 0x8e, 0x9d, 0x9f, 0x31, 0x69, 0xa3, 0x9b,
+    0x29, 0xce, 0xab, 0xe6, 0x2c, 0x19, 0x2c, 0x79, 0x2d, 0x1e, 0x25, 0x93,
+    0xa4, 0x84, 0x23, 0x4b, 0x2c, 0x47, 0xa4, 0x21, 0x2d, 0x27, 0xae, 0x91,
+    0xb0, 0x01, 0xb0, 0xee, 0x32, 0x6d, 0xad, 0xb8, 0xaa, 0xb2, 0xa9, 0xae,
+    0xab, 0x3c, 0xb1, 0x98, 0x26, 0x99, 0x27, 0x1a, 0xaf, 0x3a, 0x2e, 0x7d,
+    0x29, 0xd0, 0xa9, 0x4b, 0xa3, 0x14, 0x30, 0x58, 0x2f, 0x5a, 0xa9, 0xb2,
+    0x26, 0x6c, 0x22, 0x3d, 0xa6, 0x9f, 0x2d, 0x44, 0x26, 0xfe, 0x28, 0x54,
+    0xae, 0x6f, 0x2f, 0x38, 0xac, 0x20, 0x1c, 0x5b, 0xaa, 0xcd, 0x2c, 0x8a,
+    0x92, 0xd9, 0x2d, 0xd6, 0x2c, 0xc9, 0xb0, 0x97, 0x2a, 0x73, 0xad, 0x93,
+    0xaa, 0x32, 0x2a, 0x6f, 0x0e, 0x65, 0x25, 0x08, 0xa6, 0x57, 0x9a, 0xde,
+    0x30, 0x46, 0x26, 0x90, 0x2e, 0x87, 0x31, 0xc6, 0x28, 0x94, 0xa6, 0xb0,
+    0x24, 0x8d, 0x2b, 0x06, 0x1c, 0x52, 0x21, 0x21, 0xac, 0x50, 0x0d, 0x3f,
+    0x2d, 0x26, 0xa8, 0x13, 0x2b, 0x29, 0x25, 0x28, 0xa7, 0x86, 0xab, 0x21,
+    0xab, 0x7f, 0xa9, 0x22, 0x2a, 0x5a, 0xad, 0x0a, 0x30, 0xb3, 0xab, 0x4f,
+    0x2f, 0x71, 0x2b, 0x88, 0xa5, 0x91, 0x26, 0x27, 0xa4, 0x72, 0x32, 0x48,
+    0x1b, 0xb6, 0xb2, 0xa0, 0xa0, 0x97, 0xaa, 0xfa, 0x2e, 0x5e, 0x18, 0x4d,
+    0x2d, 0xe0, 0x2c, 0xb7, 0xa5, 0xbe, 0x94, 0x38, 0x30, 0x97, 0x24, 0xd0,
+    0x29, 0xe2, 0x15, 0x68, 0xa9, 0xe9, 0x29, 0xfb, 0xa8, 0xd7, 0xac, 0x71,
+    0x2b, 0x63, 0xab, 0x5b, 0xab, 0x63, 0x2e, 0x0e, 0x30, 0xf2, 0xa9, 0x9f,
+    0x2b, 0xcd, 0x2c, 0x4f, 0xab, 0x13, 0xac, 0x51, 0xaf, 0xd0, 0x2c, 0xd5,
+    0x20, 0xfc, 0xa8, 0xa7, 0xac, 0x24, 0x30, 0x65, 0x18, 0xba, 0x30, 0xea,
+    0x26, 0x1e, 0x2a, 0x07, 0xae, 0xc9, 0xa9, 0xcc, 0xab, 0xa7, 0xb3, 0xf2,
+    0xa8, 0x91, 0x26, 0xf6, 0x2d, 0x61, 0x21, 0x5d, 0xa9, 0x7a, 0xad, 0x19,
+    0x2f, 0x00, 0x2a, 0xdf, 0xaf, 0x97, 0x28, 0x25, 0xad, 0xcf, 0xb0, 0xdb,
+    0x29, 0xc3, 0xb0, 0x4e, 0xae, 0xb1, 0xa5, 0xff, 0x29, 0x43, 0xb0, 0xec,
+    0xa5, 0x7c, 0xa6, 0x52, 0x31, 0x32, 0x20, 0x46, 0xae, 0x41, 0xaa, 0x4c,
+    0xaa, 0x82, 0x21, 0x41, 0xaa, 0xfb, 0xac, 0xf3, 0xa5, 0xc8, 0x2b, 0xdd,
+    0x95, 0x8d, 0xac, 0x66, 0x27, 0x08, 0x1c, 0x34, 0x32, 0x59, 0x23, 0x89,
+    0x24, 0x39, 0xa8, 0x58, 0x9d, 0xf6, 0x2f, 0x7a, 0xac, 0x09, 0xab, 0xc3,
+    0x22, 0xa4, 0xaf, 0xe5, 0x25, 0x6d, 0x2e, 0xe3, 0x29, 0xfd, 0xaf, 0xaf,
+    0xa5, 0xa8, 0xa1, 0xf5, 0xa9, 0xdf, 0x32, 0x54, 0xa9, 0xf8, 0xb4, 0x58,
+    0x31, 0x79, 0xac, 0xf3, 0x2e, 0xfc, 0x2b, 0x08, 0xa8, 0xe9, 0xa0, 0x10,
+    0x28, 0x57, 0xae, 0x38, 0xa9, 0x27, 0x35, 0x6c, 0xaa, 0x33, 0x2f, 0x8c,
+    0xad, 0xca, 0x26, 0xef, 0x30, 0x44, 0x31, 0x50, 0x32, 0x97, 0x1f, 0x7c,
+    0xab, 0x0c, 0xac, 0x50, 0xac, 0x91, 0x2b, 0x43, 0xac, 0x5c, 0x1f, 0x6f,
+    0x22, 0x3d, 0x29, 0xb7, 0xaf, 0x68, 0x2c, 0x3f, 0x1f, 0x25, 0xa7, 0x48,
+    0xb1, 0xe4, 0xaa, 0xa0, 0x2d, 0x1d, 0x9f, 0x61, 0x2d, 0xd6, 0x30, 0x0b,
+    0x2b, 0xb6, 0x29, 0x29, 0x2b, 0x4c, 0x30, 0xd8, 0xaa, 0x90, 0xa1, 0xb0,
+    0x2c, 0x4a, 0x28, 0xc1, 0x30, 0x2f, 0x33, 0x7c, 0x26, 0x8e, 0x29, 0xaf,
+    0x2c, 0x9d, 0x26, 0x4d, 0xb1, 0x61, 0x31, 0x1f, 0x31, 0xbc, 0x23, 0x2e,
+    0xaa, 0x95, 0x2a, 0xeb, 0x31, 0x26, 0x2b, 0xdd, 0x33, 0x6c, 0x25, 0x76,
+    0xa4, 0x72, 0x2c, 0xed, 0x2c, 0x1e, 0x30, 0x83, 0x27, 0x67, 0x2e, 0x1a,
+    0x00, 0x64, 0x88, 0xa9, 0xb0, 0xaa, 0xaf, 0x43, 0xab, 0x8c, 0xb1, 0x8c,
+    0x27, 0x2d, 0xae, 0xab, 0xa2, 0xcc, 0x2f, 0x45, 0x21, 0xcf, 0xab, 0xf9,
+    0x25, 0x24, 0xaa, 0x9c, 0x2b, 0x40, 0xae, 0x79, 0xb0, 0xd6, 0x2b, 0x23,
+    0x2c, 0xae, 0x2d, 0xfa, 0xa5, 0x0b, 0x2a, 0x8b, 0xaf, 0x28, 0x2b, 0x73,
+    0x30, 0xa4, 0xa5, 0x4a, 0x26, 0xa2, 0xa8, 0xcd, 0x21, 0x62, 0x24, 0x7e,
+    0x27, 0x20, 0x90, 0xa9, 0x2d, 0xc8, 0xac, 0x74, 0x20, 0x15, 0x26, 0x12,
+    0x28, 0x62, 0xa3, 0x91, 0x26, 0x64, 0xae, 0xbe, 0x2c, 0xa5, 0x25, 0x6c,
+    0xb0, 0xc9, 0xa8, 0x3b, 0xa5, 0x68, 0xa9, 0x0a, 0xa7, 0x0e, 0xaa, 0x1f,
+    0x2d, 0xe6, 0xad, 0x5d, 0x2e, 0x9f, 0x2e, 0x83, 0x30, 0x5e, 0x23, 0xba,
+    0x2f, 0xeb, 0x31, 0x31, 0xb0, 0xc4, 0x84, 0x53, 0x2b, 0xca, 0x2c, 0x2f,
+    0xae, 0x40, 0x2e, 0x79, 0xaf, 0x6c, 0x2d, 0x4a, 0xa8, 0x59, 0xab, 0x10,
+    0xb0, 0x49, 0xa5, 0x49, 0xa9, 0x9c, 0x23, 0x75, 0xaa, 0x7f, 0x2b, 0x0d,
+    0xb2, 0xc5, 0x28, 0x8a, 0x2a, 0xc6, 0x2d, 0x02, 0xa5, 0x1a, 0xae, 0x28,
+    0x1d, 0xb9, 0xa4, 0x87, 0xae, 0x89, 0x2a, 0x12, 0x2e, 0x22, 0xaf, 0x29,
+    0xa9, 0x61, 0x24, 0x13, 0x27, 0x83, 0xa8, 0xde, 0x26, 0x15, 0xaa, 0xdb,
+    0x2e, 0xb6, 0xac, 0xfe, 0x9d, 0x37, 0x29, 0x7c, 0xae, 0xcd, 0x2a, 0x16,
+    0x2d, 0xc2, 0x30, 0x7c, 0xae, 0xa0, 0xb3, 0x26, 0xac, 0xcc, 0x2d, 0x88,
+    0x9b, 0xe8, 0xab, 0x91, 0xaf, 0xdf, 0xa9, 0xf2, 0x29, 0xf4, 0xa3, 0x68,
+    0x30, 0x40, 0x25, 0x50, 0xb0, 0x46, 0x26, 0x13, 0xa6, 0x23, 0xb3, 0xef,
+    0xaa, 0x69, 0x2a, 0xa7, 0xac, 0xe3, 0xa1, 0x88, 0xaa, 0x0b, 0x2e, 0x98,
+    0xaa, 0x0f, 0xad, 0x3b, 0x27, 0xc3, 0x9d, 0x4b, 0x28, 0x37, 0xb0, 0x37,
+    0x31, 0x8e, 0x2b, 0x7b, 0x2e, 0x62, 0xac, 0x5a, 0xb0, 0x3e, 0xab, 0x4b,
+    0x20, 0x7f, 0x29, 0x04, 0x30, 0x07, 0x31, 0xd9, 0xaa, 0x30, 0x2f, 0x4c,
+    0x29, 0xae, 0xa7, 0x94, 0xad, 0xe3, 0xad, 0xe8, 0x30, 0x20, 0xaf, 0x2a,
+    0xae, 0xee, 0xaa, 0xfd, 0xa7, 0xb2, 0xa9, 0xf8, 0x22, 0x86, 0x2c, 0x2e,
+    0xa0, 0x54, 0xa5, 0x89, 0xaa, 0xbd, 0xb1, 0x7b, 0x29, 0x44, 0xa5, 0x3d,
+    0xa9, 0x20, 0x2f, 0x81, 0xae, 0x61, 0x33, 0x87, 0x32, 0x5f, 0xa6, 0x60,
+    0x29, 0xcc, 0xa8, 0xda, 0x2c, 0x16, 0x29, 0x7c, 0xa6, 0x8b, 0x29, 0xea,
+    0xaf, 0xe7, 0x1c, 0x9a, 0xb2, 0xd1, 0x27, 0xc6, 0x2d, 0x7b, 0xa5, 0x3f,
+    0xab, 0x69, 0xb3, 0xe6, 0x25, 0x36, 0xb2, 0x96, 0x2b, 0xf9, 0xae, 0x30,
+    0xb0, 0x3e, 0xac, 0x87, 0xaf, 0x6c, 0x2c, 0x69, 0x2f, 0xef, 0xa8, 0x54,
+    0x27, 0xe7, 0x0d, 0x57, 0x2a, 0x07, 0xb0, 0xbf, 0x2f, 0x0f, 0x30, 0x7e,
+    0x28, 0x59, 0xa2, 0x6b, 0xaf, 0x44, 0xb0, 0x2d, 0xad, 0xdc, 0x28, 0xd9,
+    0x9f, 0xf6, 0xa9, 0x78, 0x24, 0x48, 0x2d, 0x5c, 0x25, 0x2c, 0x21, 0x6f,
+    0xaa, 0x77, 0xa7, 0xb0, 0xaa, 0x21, 0xac, 0xc6, 0xab, 0x4f, 0x31, 0xde,
+    0xab, 0x40, 0x2d, 0xef, 0xac, 0x72, 0xaf, 0x1c, 0xb1, 0x4f, 0xad, 0x71,
+    0xad, 0x31, 0xac, 0x36, 0x30, 0x2a, 0xb0, 0x92, 0xae, 0x85, 0x29, 0xe3,
+    0xaf, 0xee, 0xa4, 0x3c, 0x2c, 0x52, 0x32, 0x43, 0xab, 0xe9, 0x28, 0xff,
+    0x27, 0x50, 0xa9, 0x68, 0xac, 0x23, 0x9c, 0x3a, 0xa4, 0x1a, 0xa8, 0x11,
+    0x9d, 0x51, 0xad, 0xdd, 0x2c, 0x7b, 0x2c, 0xb3, 0xac, 0xa4, 0xb0, 0x48,
+    0xac, 0x92, 0x1e, 0x5c, 0xad, 0x2a, 0xa8, 0xe8, 0x2c, 0xbc, 0x2e, 0x36,
+    0xae, 0xe6, 0xa6, 0x50, 0x31, 0x11, 0x1e, 0x3e, 0x22, 0x8f, 0x29, 0xfd,
+    0x2f, 0x26, 0xb1, 0xf4, 0x2d, 0xd8, 0x9c, 0x0d, 0xa8, 0x04, 0x24, 0xce,
+    0xac, 0xeb, 0xa9, 0x99, 0xa9, 0xa2, 0x32, 0xce, 0xab, 0x64, 0xa4, 0x28,
+    0x25, 0x33, 0x32, 0x09, 0xae, 0x16, 0x31, 0xfa, 0x2f, 0xdc, 0x34, 0xd2,
+    0x2e, 0x73, 0xae, 0x17, 0xa6, 0x9f, 0x2e, 0xe9, 0x2c, 0x7b, 0x2b, 0x79,
+    0x27, 0xb2, 0x30, 0x88, 0xa9, 0x0a, 0xb0, 0x4f, 0x29, 0xb0, 0xac, 0x2b,
+    0xa5, 0x29, 0x20, 0x9e, 0x28, 0x47, 0x2f, 0x4e, 0x27, 0x52, 0xa9, 0x60,
+    0x2d, 0xdd, 0x2b, 0x9e, 0x2a, 0x11, 0x31, 0x68, 0x2b, 0x0f, 0xb0, 0x6e,
+    0x31, 0x49, 0x2a, 0x4c, 0xae, 0x52, 0x2a, 0xbc, 0xa7, 0xcc, 0x92, 0x2e,
+    0xb2, 0xb1, 0x9c, 0x7c, 0x2e, 0xa2, 0xa8, 0xd4, 0xaf, 0x14, 0x2b, 0x32,
+    0xab, 0xbc, 0xb0, 0x1c, 0xb1, 0xa6, 0x1e, 0x21, 0xaa, 0x8a, 0xab, 0x32,
+    0x29, 0x13, 0xaf, 0x55, 0x2f, 0xc9, 0xa7, 0xa1, 0xa9, 0x2f, 0x25, 0x78,
+    0xab, 0x19, 0x2d, 0x8f, 0xb1, 0xa6, 0x2b, 0x28, 0xaa, 0x80, 0x20, 0x24,
+    0x2d, 0x3e, 0xa0, 0xab, 0xb1, 0x07, 0x24, 0x10, 0x29, 0x7e, 0x2a, 0x14,
+    0xa1, 0x29, 0xa9, 0x6e, 0xad, 0x9b, 0x8f, 0xeb, 0xb1, 0x0f, 0xb0, 0xcd,
+    0x2d, 0x94, 0xa8, 0xde, 0xa9, 0xb4, 0x20, 0x86, 0xab, 0xb5, 0xac, 0x02,
+    0xb0, 0x7b, 0x24, 0x99, 0xaf, 0x82, 0x32, 0x4e, 0x22, 0x12, 0xad, 0x7f,
+    0xa7, 0xab, 0xad, 0x49, 0x9d, 0x06, 0x22, 0x6e, 0xa1, 0x53, 0xae, 0xd2,
+    0x2d, 0x24, 0x32, 0x9a, 0xaa, 0xcb, 0xa1, 0x04, 0x2d, 0x08, 0xa4, 0xcf,
+    0x30, 0x54, 0xb0, 0x01, 0xad, 0x77, 0xad, 0x6f, 0x25, 0x87, 0xab, 0x52,
+    0x20, 0xf3, 0xac, 0x6e, 0xb1, 0x30, 0x2c, 0x04, 0x2d, 0x0a, 0xab, 0x6d,
+    0x2f, 0x21, 0xb1, 0xda, 0x29, 0x0c, 0xaa, 0x37, 0xaf, 0x76, 0xad, 0x64,
+    0x32, 0xfd, 0xab, 0x2c, 0x2c, 0x77, 0x29, 0x27, 0x25, 0xe8, 0xa5, 0x09,
+    0x24, 0xe3, 0xb0, 0xc9, 0x30, 0x95, 0xb1, 0x9c, 0x2f, 0x2f, 0x34, 0xdc,
+    0x33, 0xc0, 0x2b, 0x6e, 0xb0, 0xea, 0xa0, 0x80, 0xb0, 0x9c, 0x2f, 0xd8,
+    0xa0, 0x0c, 0xac, 0x7f, 0xa1, 0xe1, 0x21, 0x96, 0x2c, 0x2b, 0xb0, 0xb2,
+    0x20, 0x08, 0xa4, 0x18, 0x27, 0x0a, 0xa9, 0x5e, 0xaf, 0x91, 0x26, 0x54,
+    0xae, 0xbd, 0x32, 0x7f, 0x27, 0x70, 0x25, 0x12, 0xa5, 0xb9, 0x21, 0xa0,
+    0xac, 0xa6, 0xa1, 0xb9, 0x15, 0x7f, 0x2d, 0xc1, 0xa8, 0x77, 0x2f, 0x5a,
+    0xa4, 0x00, 0xad, 0xd5, 0x2a, 0xf1, 0xaa, 0x2c, 0x30, 0x26, 0xad, 0xcc,
+    0xac, 0xb7, 0xb0, 0xf1, 0x9f, 0xa1, 0xaa, 0x69, 0xab, 0x1b, 0x2f, 0x27,
+    0x28, 0x93, 0x2c, 0x40, 0x28, 0x82, 0xaa, 0xfa, 0x29, 0xbd, 0xad, 0xb9,
+    0x2d, 0x71, 0xa9, 0xcd, 0xa4, 0x3d, 0x28, 0x54, 0xa8, 0x6a, 0xad, 0x4c,
+    0x16, 0x22, 0xb0, 0x1a, 0xae, 0xaf, 0x30, 0x2c, 0xb0, 0x0b, 0x30, 0x7e,
+    0x2f, 0x5b, 0xab, 0xa1, 0x2a, 0xd8, 0x21, 0x85, 0x33, 0x77, 0x2b, 0x42,
+    0x19, 0xac, 0xa9, 0xc5, 0xaf, 0xf8, 0x2c, 0xa0, 0x1b, 0xcf, 0xac, 0x28,
+    0x22, 0xd9, 0x2d, 0x81, 0xa3, 0x49, 0xa1, 0x8e, 0xac, 0x9c, 0x2f, 0x7a,
+    0xa5, 0x1c, 0xb2, 0x55, 0x2f, 0xcb, 0x2b, 0x84, 0xad, 0xee, 0x2d, 0x36,
+    0xa8, 0xc8, 0xb3, 0x54, 0x24, 0xbc, 0xa1, 0x44, 0xad, 0x2c, 0xad, 0x56,
+    0xaf, 0x6e, 0xac, 0xb1, 0xac, 0x90, 0x28, 0x4f, 0xa6, 0xf7, 0xa8, 0x8a,
+    0x24, 0x52, 0xad, 0x79, 0xa9, 0x6a, 0x2a, 0xf9, 0xb0, 0x45, 0xb1, 0x6c,
+    0x2a, 0xbe, 0xa9, 0x11, 0xa5, 0x07, 0xaf, 0x6c, 0x24, 0x83, 0x96, 0x12,
+    0x23, 0x52, 0x2e, 0xe5, 0x30, 0xa8, 0xb0, 0xd3, 0x2f, 0x68, 0xac, 0x36,
+    0xb0, 0x09, 0xa4, 0x76, 0xad, 0x4b, 0xab, 0x78, 0x2c, 0x97, 0x9d, 0x5d,
+    0xaf, 0x51, 0x2a, 0x69, 0xa7, 0x76, 0xaa, 0x14, 0x22, 0xa0, 0x22, 0x7e,
+    0xa4, 0x78, 0xac, 0xa2, 0x34, 0x5c, 0xa7, 0xfc, 0xac, 0x22, 0xad, 0xc2,
+    0xac, 0x91, 0x2a, 0xf6, 0x2b, 0x2c, 0xb0, 0x25, 0xab, 0x86, 0x2e, 0x73,
+    0x22, 0x97, 0xad, 0x08, 0x28, 0xc9, 0x2b, 0x03, 0xb0, 0xa2, 0xac, 0xcf,
+    0xa9, 0x9b, 0x2e, 0x01, 0x2f, 0xbb, 0x31, 0x50, 0x2d, 0xc1, 0xac, 0xee,
+    0xac, 0x59, 0x98, 0xff, 0x26, 0xfc, 0x2a, 0xbf, 0xa3, 0x73, 0x25, 0x7c,
+    0x2a, 0x6c, 0x2c, 0xa3, 0xae, 0x15, 0x1c, 0xa5, 0xac, 0x9a, 0x29, 0x58,
+    0x20, 0x98, 0xac, 0x46, 0x2a, 0xbf, 0xad, 0x2b, 0x28, 0x02, 0xae, 0xfc,
+    0x30, 0xca, 0x2e, 0xfd, 0xac, 0x7e, 0x2b, 0xc0, 0x2b, 0x82, 0x2b, 0x87,
+    0xad, 0xfc, 0xa9, 0xf4, 0x2a, 0x98, 0xa8, 0x1f, 0xae, 0x88, 0xae, 0xf2,
+    0xaa, 0xe4, 0xad, 0x5b, 0x2e, 0xdf, 0x24, 0xa4, 0xab, 0xa8, 0x2e, 0x6e,
+    0xac, 0x29, 0xa9, 0x48, 0xac, 0xc8, 0xac, 0x6c, 0xa9, 0x03, 0xaa, 0x07,
+    0x33, 0xe5, 0xa8, 0x20, 0xb1, 0xb5, 0xac, 0x7d, 0xb0, 0xb6, 0x9a, 0x0b,
+    0xaa, 0xb8, 0xb2, 0x26, 0xa9, 0x4e, 0x2e, 0x88, 0x25, 0xd3, 0xa6, 0xbc,
+    0x2b, 0x6f, 0x30, 0x9f, 0xb0, 0x37, 0xb0, 0x9a, 0xad, 0xbd, 0x2e, 0x17,
+    0x2d, 0x7b, 0x2d, 0x62, 0x2f, 0xbc, 0x27, 0x63, 0xad, 0x58, 0xa5, 0x84,
+    0x29, 0xf5, 0xa8, 0x06, 0xb0, 0x69, 0x1c, 0x7a, 0x28, 0xf8, 0x25, 0xc7,
+    0xa6, 0xd0, 0x2d, 0x78, 0xac, 0xcb, 0xae, 0xe0, 0x2a, 0xcb, 0xa8, 0xb8,
+    0xa5, 0x4a, 0xa9, 0x3f, 0xa4, 0xf9, 0x2b, 0xa3, 0x2e, 0xfd, 0xaf, 0x54,
+    0xa9, 0xb1, 0x2e, 0x11, 0x9f, 0xde, 0xa5, 0x55, 0x13, 0x6e, 0xa6, 0x2a,
+    0x18, 0xcc, 0x2d, 0x2e, 0xa6, 0xaf, 0xb0, 0x0d, 0xaf, 0x65, 0xa6, 0x84,
+    0x91, 0xcc, 0x9d, 0xf9, 0xae, 0x78, 0xa3, 0x3e, 0xa1, 0x4c, 0xac, 0xb1,
+    0x25, 0xd2, 0x27, 0x1b, 0xa6, 0xfb, 0xb0, 0x86, 0x31, 0xa9, 0xac, 0x43,
+    0xa9, 0x60, 0xae, 0x0c, 0xae, 0xf3, 0x26, 0x65, 0xa0, 0x50, 0xb0, 0xbd,
+    0xab, 0x78, 0xab, 0xe8, 0xa1, 0x1b, 0x26, 0x68, 0xa4, 0x9a, 0x2d, 0xe1,
+    0x22, 0xd8, 0xac, 0x43, 0xae, 0x70, 0x2c, 0xcd, 0x1a, 0x03, 0x36, 0x7f,
+    0x20, 0xb7, 0x9a, 0x2e, 0xaf, 0x7b, 0xad, 0x68, 0x2c, 0x86, 0x2b, 0x19,
+    0x2c, 0x3b, 0xaa, 0x61, 0xaa, 0x02, 0x2c, 0xc9, 0xae, 0x8e, 0x2f, 0x4f,
+    0xaf, 0x4a, 0x90, 0x55, 0xac, 0xa9, 0x2f, 0x6a, 0xa2, 0xd1, 0xad, 0xd1,
+    0xa7, 0x3d, 0xa6, 0x59, 0xa0, 0x82, 0xa2, 0x1c, 0x30, 0x7b, 0x27, 0xb5,
+    0x27, 0xe5, 0xa4, 0xe6, 0xab, 0xf9, 0x24, 0x6d, 0xa8, 0x02, 0x2e, 0xba,
+    0xa9, 0xa1, 0xad, 0x4f, 0xac, 0xa8, 0x91, 0x6a, 0xac, 0x4d, 0x2b, 0x4a,
+    0xac, 0xb4, 0xa0, 0x42, 0xa9, 0x41, 0xa8, 0x0b, 0x2d, 0x25, 0xaf, 0x8c,
+    0x24, 0x71, 0xa3, 0x7c, 0x2e, 0x8f, 0xad, 0x7f, 0xaf, 0x49, 0xb0, 0xcb,
+    0xae, 0xd7, 0xb2, 0xaf, 0x28, 0x57, 0x2d, 0x0d, 0x29, 0x8f, 0x2f, 0x9a,
+    0x2d, 0xf2, 0xad, 0x2b, 0x28, 0xdd, 0xae, 0x2e, 0x22, 0xb8, 0x2c, 0x42,
+    0x30, 0x1d, 0x2d, 0xe5, 0x2a, 0x70, 0xaf, 0x59, 0x9e, 0x99, 0x33, 0xf9,
+    0xa7, 0xa2, 0xac, 0xb3, 0x1e, 0xa4, 0xad, 0xd8, 0xab, 0xab, 0xac, 0x0d,
+    0x28, 0x56, 0x29, 0x3a, 0xab, 0x3c, 0x30, 0x27, 0x34, 0xe1, 0x31, 0x12,
+    0xb0, 0x8b, 0x25, 0xd0, 0xa5, 0xed, 0xa5, 0x28, 0x30, 0xc9, 0xa6, 0x9e,
+    0x2a, 0x30, 0x30, 0xa0, 0x30, 0xf3, 0x2c, 0x11, 0xa4, 0x6e, 0x2c, 0xf7,
+    0x2a, 0xfc, 0xa8, 0x1a, 0xac, 0x57, 0xb3, 0x33, 0xa8, 0x0d, 0x26, 0x57,
+    0xb0, 0xe6, 0x1d, 0x6d, 0xb1, 0x41, 0x2c, 0x0f, 0x24, 0x36, 0xa0, 0x85,
+    0xa8, 0x88, 0x2e, 0x9d, 0x25, 0x77, 0xac, 0xb3, 0xa5, 0xf9, 0xad, 0x6d,
+    0xae, 0x3e, 0x30, 0x66, 0x30, 0x5c, 0xa9, 0xda, 0x30, 0x85, 0x20, 0x8e,
+    0x2f, 0xea, 0x2d, 0x7a, 0xb0, 0x82, 0x32, 0x29, 0x2a, 0xbe, 0xae, 0x7a,
+    0xab, 0x31, 0xa8, 0xf2, 0x20, 0x0a, 0x1f, 0x9d, 0x2a, 0xab, 0x2d, 0xa4,
+    0x2f, 0x29, 0xab, 0x86, 0x0f, 0x7e, 0x32, 0x7e, 0xaf, 0xab, 0xa5, 0xe9,
+    0xab, 0x32, 0xae, 0xec, 0xab, 0xb8, 0xa8, 0x25, 0xac, 0x44, 0x30, 0xd1,
+    0x25, 0xdc, 0xac, 0x40, 0x30, 0x4e, 0x2e, 0x54, 0xb2, 0x78, 0x2d, 0x55,
+    0xac, 0x93, 0x2e, 0xca, 0x31, 0x77, 0x2a, 0xa5, 0xad, 0x4b, 0x2b, 0xe8,
+    0x24, 0x41, 0x29, 0xb8, 0x2c, 0xa9, 0x2e, 0xa0, 0xaf, 0x73, 0x9d, 0xfb,
+    0x2c, 0x0e, 0xb0, 0x7b, 0x27, 0xa2, 0x22, 0xf3, 0x2c, 0x0b, 0x24, 0x2c,
+    0xac, 0x84, 0x23, 0x95, 0x30, 0x29, 0xa0, 0x5e, 0x2f, 0x1c, 0x2d, 0x5b,
+    0xa4, 0x97, 0xa8, 0xd6, 0x26, 0x49, 0xb0, 0x61, 0xb2, 0x96, 0x2f, 0x51,
+    0x2a, 0x41, 0xa7, 0xfe, 0x2f, 0x0d, 0xae, 0x41, 0x2d, 0x69, 0x9c, 0xbb,
+    0x23, 0x5f, 0x22, 0x63, 0x25, 0xb1, 0xad, 0x1e, 0xa5, 0x6d, 0x2c, 0xaa,
+    0x2f, 0x86, 0xb0, 0x1a, 0x2e, 0x97, 0x33, 0x28, 0x2b, 0x42, 0x2c, 0x5c,
+    0xab, 0x99, 0x2b, 0x9f, 0xad, 0xdb, 0xaf, 0x45, 0xa7, 0xd6, 0xb1, 0xed,
+    0xab, 0xf8, 0xb4, 0x01, 0x26, 0xca, 0x2f, 0x9e, 0x26, 0x94, 0xa5, 0x66,
+    0x2e, 0x7e, 0x25, 0x12, 0xae, 0x04, 0x28, 0x1c, 0xa9, 0x3b, 0x25, 0x72,
+    0x31, 0xb2, 0xa3, 0x5b, 0xa7, 0x47, 0x32, 0xf7, 0x28, 0xc5, 0xab, 0xe5,
+    0x23, 0x85, 0x31, 0x26, 0x30, 0x1a, 0x27, 0xb2, 0x2a, 0xa1, 0xac, 0x84,
+    0x23, 0xb4, 0x2c, 0xe2, 0x2d, 0x09, 0xa0, 0xe9, 0xb0, 0x91, 0x27, 0xd4,
+    0x2c, 0x1a, 0xa2, 0xe5, 0x28, 0x86, 0x2d, 0xde, 0xab, 0xde, 0xa8, 0x9c,
+    0x2f, 0x58, 0xb1, 0x79, 0xa7, 0x31, 0x30, 0xfc, 0xa5, 0xc1, 0xa7, 0xf1,
+    0x2c, 0x09, 0xa8, 0xb0, 0x2f, 0xa1, 0x27, 0x66, 0x29, 0xc5, 0x2f, 0x0c,
+    0xae, 0x19, 0xaf, 0x9a, 0x2c, 0x05, 0x2f, 0x84, 0x2e, 0xfe, 0x2b, 0xa3,
+    0x2e, 0x9b, 0x34, 0xf6, 0xab, 0x17, 0x28, 0x0e, 0xb2, 0x7b, 0x9d, 0xd1,
+    0xb0, 0x49, 0xa9, 0x74, 0x24, 0x75, 0xb1, 0xc9, 0x2c, 0x25, 0xac, 0x2c,
+    0x22, 0x4c, 0x30, 0xbf, 0x28, 0xdc, 0x9c, 0x16, 0x30, 0x98, 0x2f, 0xc5,
+    0xa8, 0x28, 0x27, 0x12, 0xb0, 0x8a, 0xaa, 0x94, 0x31, 0x45, 0x2b, 0x2f,
+    0x31, 0x93, 0x2d, 0xa8, 0x1a, 0xe2, 0xad, 0x7d, 0x20, 0x2a, 0x2d, 0xdb,
+    0x9a, 0x8b, 0x11, 0xb0, 0xa4, 0x1f, 0xaa, 0x43, 0x2b, 0xbd, 0xa7, 0x94,
+    0x20, 0xc5, 0xaf, 0xe0, 0xaf, 0xae, 0x2d, 0x9e, 0xa3, 0x0e, 0x1c, 0x75,
+    0x2b, 0xbf, 0xa5, 0xa7, 0xa6, 0x14, 0xac, 0xdb, 0x2c, 0xa6, 0xad, 0x33,
+    0x30, 0x00, 0xa4, 0x77, 0xab, 0xd3, 0xaa, 0x56, 0x2c, 0xd5, 0xb4, 0x68,
+    0x30, 0x00, 0xad, 0x07, 0x30, 0xfd, 0x2b, 0x39, 0xb0, 0x04, 0x2b, 0xee,
+    0x27, 0x56, 0x2f, 0x6b, 0x2e, 0x88, 0xa9, 0x0f, 0x30, 0x86, 0x2c, 0x9f,
+    0xac, 0x32, 0x29, 0x74, 0xaf, 0x35, 0xab, 0x73, 0xab, 0x75, 0xb1, 0x3f,
+    0x2c, 0xb0, 0xaf, 0x49, 0xa9, 0x5e, 0xaf, 0xe2, 0x2d, 0xb0, 0xa9, 0xc1,
+    0x2c, 0xf2, 0x2d, 0xd9, 0x29, 0x1a, 0x30, 0x18, 0xa8, 0x0d, 0x2d, 0x8d,
+    0xa8, 0xa2, 0x29, 0x5d, 0x29, 0xa8, 0xaa, 0xc5, 0x28, 0x96, 0x28, 0x4c,
+    0x2b, 0x39, 0xad, 0xb4, 0xac, 0x6f, 0x2d, 0x0f, 0x31, 0x4d, 0xb0, 0xf6,
+    0xa2, 0x1d, 0xa9, 0x4d, 0xa1, 0x51, 0x27, 0x6f, 0xac, 0x44, 0xaf, 0xab,
+    0xb1, 0xcf, 0x30, 0xfe, 0xad, 0xf6, 0xae, 0x0b, 0xae, 0x88, 0x25, 0x04,
+    0xb0, 0x70, 0xb1, 0x89, 0x29, 0xb5, 0xb1, 0xc2, 0x31, 0x39, 0xaa, 0xb2,
+    0xb1, 0xdd, 0xa5, 0x21, 0x28, 0x27, 0xae, 0xe8, 0x20, 0x99, 0x22, 0x63,
+    0xad, 0x8b, 0x2b, 0xf4, 0xa5, 0x84, 0xac, 0x72, 0xa9, 0x0c, 0x2d, 0xc4,
+    0x26, 0x49, 0xa8, 0x41, 0x30, 0xc9, 0x21, 0x5c, 0x2d, 0x6a, 0x24, 0x1b,
+    0xa9, 0xd7, 0xaa, 0x57, 0xae, 0x9a, 0xaf, 0xf3, 0x9a, 0x1d, 0xa9, 0xd9,
+    0xb0, 0x72, 0xad, 0x85, 0xae, 0xa1, 0xac, 0x3a, 0x26, 0x66, 0x2c, 0x04,
+    0x29, 0x0a, 0x30, 0x46, 0xad, 0x6c, 0xa8, 0x1f, 0xaf, 0x4b, 0x23, 0x75,
+    0x29, 0x69, 0x8e, 0x0a, 0xac, 0xa5, 0x29, 0xe4, 0x30, 0x89, 0xa0, 0xd1,
+    0xae, 0x9a, 0x2f, 0x96, 0x2c, 0x90, 0xaf, 0x9c, 0xa7, 0x2a, 0xae, 0x45,
+    0x2e, 0x64, 0xab, 0x53, 0x9d, 0x55, 0xa1, 0xec, 0xaf, 0x8e, 0x30, 0x22,
+    0xb0, 0x49, 0xb2, 0x9b, 0x2a, 0x9e, 0xa2, 0xcf, 0xa6, 0x9d, 0x2c, 0x95,
+    0xa8, 0x82, 0xaf, 0x1e, 0x28, 0xc9, 0xac, 0x3c, 0xb0, 0x4c, 0x26, 0x51,
+    0x2d, 0x4d, 0xad, 0xc0, 0xad, 0xc9, 0x23, 0xa9, 0xaf, 0x30, 0x28, 0x86,
+    0x28, 0x45, 0x29, 0x2d, 0xa9, 0x2a, 0x13, 0x4c, 0x2d, 0x3f, 0xaa, 0x0d,
+    0xa3, 0xba, 0x2c, 0x4a, 0xab, 0xa5, 0x1c, 0x1c, 0xa7, 0x1c, 0x2f, 0xd5,
+    0xa3, 0x17, 0xb0, 0x3e, 0x2d, 0x0a, 0x24, 0x2c, 0xa8, 0x7a, 0xa8, 0x44,
+    0x2f, 0x04, 0xb1, 0x44, 0xb0, 0x07, 0x17, 0x2b, 0x29, 0xe9, 0x28, 0x7a,
+    0xac, 0xa4, 0x21, 0x86, 0xae, 0x85, 0x30, 0x4c, 0xae, 0xf8, 0x28, 0x0f,
+    0xac, 0x0f, 0x28, 0xdc, 0x97, 0x1a, 0x2c, 0xa1, 0x2a, 0x48, 0x2d, 0x63,
+    0x2d, 0x12, 0x2c, 0x4d, 0x2b, 0xa0, 0xa5, 0x87, 0x8c, 0x55, 0xb0, 0xfb,
+    0xaa, 0x10, 0x2d, 0xc8, 0xb0, 0x47, 0xa0, 0x3e, 0xb4, 0x1c, 0xb0, 0x00,
+    0x2b, 0x9b, 0xa8, 0xd9, 0xae, 0xd1, 0x30, 0x60, 0xa8, 0x75, 0xb0, 0x45,
+    0x2b, 0x8f, 0xb2, 0x13, 0xb1, 0x02, 0xb1, 0x7c, 0x2d, 0xb8, 0xad, 0x83,
+    0xae, 0x43, 0x30, 0x05, 0xaf, 0xbe, 0xa3, 0x7c, 0xa7, 0x18, 0x31, 0xf5,
+    0x2f, 0x76, 0x27, 0x2e, 0xaa, 0x54, 0xaa, 0x42, 0xac, 0x4c, 0x2c, 0x93,
+    0xa3, 0xf2, 0x2e, 0x65, 0x24, 0x7f, 0x2a, 0xb6, 0x21, 0xa9, 0xae, 0x3c,
+    0xaa, 0xc4, 0xa2, 0x06, 0x26, 0x83, 0x2b, 0x7a, 0x2d, 0xed, 0xae, 0x6c,
+    0xaf, 0x31, 0xaa, 0x67, 0xa4, 0x03, 0x22, 0x0c, 0xac, 0x5d, 0xa6, 0x55,
+    0xb0, 0x13, 0x2a, 0x3d, 0xa8, 0xed, 0x2e, 0x1e, 0xa8, 0xfb, 0x2b, 0xb7,
+    0xad, 0x49, 0xaa, 0x37, 0xb0, 0xc8, 0xa9, 0xb3, 0x2c, 0x6c, 0x20, 0xc4,
+    0xad, 0xa0, 0xa6, 0x21, 0x26, 0x10, 0xac, 0x54, 0xad, 0xf2, 0xab, 0xac,
+    0xae, 0x51, 0x31, 0xe0, 0xb0, 0x9a, 0x24, 0xa9, 0x28, 0x10, 0x30, 0x20,
+    0x2d, 0x77, 0x2c, 0x20, 0xa7, 0x2c, 0xa6, 0x84, 0xa8, 0x56, 0xab, 0xa7,
+    0x24, 0x0e, 0xb0, 0x8e, 0x2f, 0x98, 0x2a, 0x52, 0xab, 0x13, 0x30, 0x77,
+    0xb0, 0x1c, 0x22, 0x5c, 0x9d, 0xcf, 0x29, 0x70, 0xa5, 0x3b, 0x29, 0x01,
+    0x9a, 0x6e, 0x2e, 0xea, 0x2e, 0xbd, 0x25, 0x4e, 0x2f, 0x44, 0x9f, 0x07,
+    0xa4, 0x41, 0x22, 0xc6, 0xa6, 0x64, 0x18, 0x56, 0x2f, 0x58, 0xa9, 0x78,
+    0xa0, 0x30, 0x2c, 0x32, 0xa4, 0xb9, 0xa6, 0x8d, 0xb1, 0xed, 0x30, 0xcf,
+    0x08, 0xf2, 0xa5, 0xd4, 0xa9, 0x69, 0x31, 0x2b, 0xb1, 0xe1, 0x2e, 0x20,
+    0xad, 0x9a, 0xb1, 0xc9, 0xa5, 0x53, 0xa8, 0xc0, 0xa8, 0x86, 0x25, 0x49,
+    0xb1, 0x33, 0x21, 0xf1, 0x2e, 0x2f, 0x1c, 0x14, 0xa5, 0x4a, 0x1d, 0x04,
+    0x22, 0x74, 0xa5, 0x95, 0xaf, 0x42, 0xac, 0x14, 0xb1, 0x2a, 0x31, 0xec,
+    0xb2, 0x04, 0xaf, 0x47, 0xa7, 0x1a, 0x28, 0x41, 0xa4, 0xb4, 0x2e, 0x6a,
+    0x2a, 0x80, 0xad, 0xd2, 0x2e, 0x6c, 0xad, 0x05, 0xb1, 0xd2, 0xad, 0xc8,
+    0x20, 0x5a, 0x2c, 0xca, 0xa8, 0x92, 0x2c, 0x89, 0xad, 0xf7, 0x1d, 0xee,
+    0xac, 0x92, 0xa8, 0x3e, 0x2d, 0x08, 0xa9, 0xb5, 0x2d, 0x57, 0xaf, 0x61,
+    0x97, 0xe9, 0xa0, 0x2d, 0xa4, 0x25, 0xaa, 0x45, 0xb0, 0x2f, 0x9d, 0x64,
+    0x2e, 0xc0, 0xa8, 0xa6, 0x25, 0x6c, 0xaa, 0xac, 0xb0, 0x43, 0x24, 0x59,
+    0x25, 0xfe, 0xb0, 0xce, 0xb0, 0x8e, 0x2e, 0x3a, 0xaf, 0xe6, 0x21, 0x9d,
+    0xac, 0xaa, 0x2e, 0x08, 0xb1, 0xa6, 0x33, 0x47, 0xb2, 0xcc, 0xa8, 0x5c,
+    0xad, 0xf9, 0xa9, 0xb9, 0x18, 0xa9, 0x30, 0xaf, 0xa8, 0x54, 0x30, 0xca,
+    0x2b, 0x71, 0x2b, 0x29, 0xb0, 0xf5, 0xa9, 0xe8, 0x29, 0x85, 0xa9, 0xc3,
+    0x27, 0x16, 0x28, 0x81, 0xb0, 0xc6, 0x2c, 0x0c, 0xae, 0x79, 0xb1, 0xeb,
+    0x30, 0x9c, 0x2c, 0x48, 0xa6, 0xc2, 0x20, 0x9a, 0x2a, 0xb5, 0x23, 0x75,
+    0xad, 0xc1, 0xac, 0x22, 0xad, 0xb9, 0x95, 0x0e, 0x30, 0xb9, 0x29, 0x16,
+    0x9d, 0xa0, 0x2e, 0x3b, 0xb0, 0xff, 0xa8, 0x1c, 0xae, 0x8b, 0xa6, 0x6e,
+    0x9f, 0x30, 0x2d, 0x01, 0x1f, 0x90, 0xac, 0x90, 0xa9, 0x63, 0xa6, 0x70,
+    0x25, 0x8f, 0x9e, 0x0f, 0x9d, 0xe3, 0xaa, 0x47, 0x2d, 0xaf, 0xa6, 0x1a,
+    0xa8, 0xb8, 0xad, 0xef, 0xa8, 0x54, 0xa4, 0x63, 0xa6, 0xaa, 0xa8, 0xc7,
+    0xaf, 0x49, 0x22, 0x5d, 0xac, 0x7a, 0xa6, 0x3a, 0x2c, 0x50, 0xac, 0x0f,
+    0xa4, 0x5a, 0x28, 0x28, 0xab, 0xde, 0xac, 0x76, 0x9f, 0x89, 0xa6, 0x73,
+    0x2c, 0x02, 0x24, 0xe0, 0xab, 0x22, 0xa8, 0x52, 0x2d, 0x7e, 0xac, 0x32,
+    0xaf, 0xb7, 0xaf, 0x51, 0xa3, 0x86, 0xa5, 0xea, 0xa6, 0xeb, 0xad, 0xcc,
+    0xaf, 0x78, 0x2f, 0x40, 0x2c, 0xaf, 0x24, 0x1b, 0x2d, 0x93, 0xa8, 0x3c,
+    0xa9, 0x69, 0x2b, 0xb8, 0xa9, 0x06, 0xaa, 0xc7, 0xa2, 0x97, 0xb1, 0x37,
+    0xac, 0x1e, 0xac, 0x0b, 0x25, 0x7b, 0x2b, 0x36, 0x2b, 0x14, 0x98, 0x0a,
+    0xa8, 0x08, 0x30, 0x1a, 0x1d, 0x61, 0xae, 0x23, 0x20, 0xb6, 0x2d, 0x1b,
+    0x2a, 0x0b, 0xae, 0x63, 0x30, 0x36, 0xa2, 0x34, 0x2e, 0xe6, 0xb0, 0x2e,
+    0x2a, 0x59, 0xac, 0x97, 0x2e, 0x97, 0xa8, 0xeb, 0x27, 0x4d, 0xa2, 0x5c,
+    0xac, 0x64, 0xa4, 0xe0, 0xa7, 0xa3, 0xb1, 0x5c, 0x1c, 0x77, 0x24, 0x36,
+    0xb4, 0xa8, 0x9e, 0xec, 0x31, 0x80, 0x23, 0x76, 0xb0, 0xeb, 0x30, 0xee,
+    0xab, 0x53, 0xa9, 0x53, 0x12, 0x52, 0xad, 0xf6, 0x13, 0x09, 0x27, 0x6b,
+    0xb1, 0x92, 0x25, 0x29, 0x29, 0x6a, 0x93, 0x34, 0xac, 0x0d, 0xab, 0x6a,
+    0x23, 0x17, 0xa0, 0x34, 0x2c, 0x6d, 0x2d, 0x3c, 0xa8, 0xa3, 0x22, 0x9b,
+    0xb0, 0x49, 0xb0, 0x81, 0x22, 0xa5, 0xac, 0x1a, 0xa7, 0x1f, 0x33, 0x7b,
+    0xad, 0xfa, 0x21, 0x9e, 0x26, 0xe0, 0xb4, 0x77, 0xb1, 0xf7, 0xa9, 0xbf,
+    0x2f, 0x24, 0xb0, 0x2b, 0x28, 0x30, 0xb0, 0xc1, 0xab, 0x2e, 0x2d, 0xfb,
+    0x24, 0xe4, 0xa9, 0x0f, 0xa7, 0x32, 0x2f, 0xde, 0xac, 0x0e, 0xaf, 0x36,
+    0x31, 0x28, 0x2d, 0xa5, 0x2f, 0x60, 0x32, 0xb8, 0x2a, 0xc0, 0xb0, 0x97,
+    0xa7, 0x63, 0x27, 0x83, 0x1c, 0x48, 0xaa, 0x4f, 0xaa, 0x27, 0x2c, 0x93,
+    0x2a, 0xe8, 0x2c, 0x7c, 0x28, 0x8f, 0x1f, 0x13, 0xa8, 0x82, 0xac, 0xc8,
+    0x30, 0xf9, 0x25, 0x97, 0xa7, 0xbe, 0x2b, 0xa8, 0x27, 0x37, 0xa9, 0x30,
+    0xa4, 0x1b, 0xaa, 0x18, 0x2d, 0x46, 0x25, 0x69, 0x34, 0x5d, 0xb1, 0xac,
+    0x2d, 0xe8, 0xac, 0xd3, 0xa7, 0x23, 0x32, 0x25, 0x2f, 0xef, 0x9b, 0xc8,
+    0x25, 0xf9, 0x2d, 0x38, 0xad, 0x42, 0xac, 0x9c, 0x30, 0x26, 0xa4, 0x63,
+    0xa4, 0x12, 0xa7, 0xaa, 0x32, 0x6a, 0x31, 0xcd, 0x99, 0x8f, 0xaa, 0x21,
+    0xa9, 0xfb, 0x2a, 0xc4, 0x28, 0x69, 0x2b, 0x04, 0xab, 0x4d, 0xaf, 0x19,
+    0xb0, 0x70, 0x20, 0x03, 0x21, 0x4e, 0xa0, 0xab, 0x27, 0xaa, 0xaf, 0xe9,
+    0xad, 0xa2, 0x31, 0x53, 0x18, 0x1d, 0x2d, 0x8b, 0x2b, 0xe7, 0x2c, 0x68,
+    0x27, 0x8f, 0x29, 0x2c, 0xa8, 0xaa, 0xac, 0xb3, 0x29, 0x9b, 0x27, 0x95,
+    0x99, 0x20, 0xb0, 0xfd, 0xb0, 0x11, 0xb4, 0x46, 0x28, 0x13, 0x31, 0x4d,
+    0x2c, 0x57, 0x30, 0x7f, 0x94, 0x2f, 0xab, 0xef, 0x2d, 0x0c, 0x2d, 0x65,
+    0x1a, 0x90, 0x28, 0xcc, 0x30, 0xff, 0x28, 0x82, 0x2e, 0xec, 0x31, 0xf7,
+    0xa9, 0xa7, 0x32, 0x50, 0x22, 0xb2, 0xa4, 0xdf, 0x31, 0x48, 0xad, 0xda,
+    0x28, 0x41, 0xac, 0xef, 0x2c, 0x4d, 0xa5, 0xf1, 0x24, 0x6d, 0x2e, 0x5a,
+    0xa2, 0xa3, 0x29, 0x40, 0x29, 0x37, 0x2e, 0xf4, 0x31, 0x20, 0xaf, 0xa7,
+    0x2a, 0xec, 0x27, 0x1d, 0x21, 0xb6, 0xb0, 0xa7, 0x2b, 0xd5, 0xae, 0xa7,
+    0xa8, 0xf3, 0x2a, 0x86, 0x2f, 0xbe, 0x1e, 0xd5, 0x2f, 0xdb, 0x2e, 0xbc,
+    0xab, 0xca, 0xaf, 0x3a, 0xaa, 0xb6, 0x9c, 0x0b, 0x2f, 0x0e, 0x2d, 0x3a,
+    0x9c, 0xa1, 0xa6, 0xdf, 0xb1, 0x47, 0x24, 0x40, 0xad, 0x4c, 0x33, 0xdb,
+    0xb3, 0x82, 0xaa, 0xb3, 0xa6, 0xbf, 0xa1, 0x15, 0x2c, 0x2e, 0xad, 0x63,
+    0x29, 0xd0, 0xa3, 0x50, 0x24, 0x65, 0x2d, 0xf7, 0xac, 0xe8, 0x30, 0xbb,
+    0x2d, 0x2a, 0x1f, 0x83, 0x30, 0xb9, 0xab, 0x76, 0x2d, 0xc7, 0x2c, 0xe0,
+    0x2d, 0x12, 0x28, 0x4e, 0x2c, 0x0b, 0x2c, 0xde, 0xa6, 0xc5, 0x32, 0x96,
+    0xa3, 0x05, 0x95, 0x38, 0x2e, 0x0d, 0x18, 0x37, 0xa6, 0xb9, 0x30, 0xe0,
+    0xab, 0x54, 0xa4, 0x1d, 0x1f, 0x65, 0x33, 0x35, 0xab, 0x09, 0x30, 0x55,
+    0x29, 0x9d, 0x2c, 0x89, 0xab, 0xdd, 0xaa, 0xc0, 0xa8, 0x6c, 0x9d, 0xab,
+    0xa9, 0x23, 0x9f, 0x55, 0x31, 0x12, 0xae, 0xa1, 0xaf, 0x59, 0xad, 0xf1,
+    0xad, 0xf3, 0xb0, 0x9f, 0xae, 0x3c, 0xa9, 0x92, 0xa2, 0x19, 0xab, 0xa8,
+    0xa1, 0xec, 0xa3, 0xb6, 0x2c, 0x0b, 0xb2, 0x20, 0x2b, 0xf2, 0xa9, 0xd1,
+    0xa2, 0xdc, 0xa4, 0xf4, 0x32, 0x8b, 0xac, 0xec, 0xac, 0x3a, 0x2e, 0xee,
+    0x2e, 0x3b, 0x22, 0x5b, 0x30, 0x99, 0xa0, 0xbb, 0x1e, 0x94, 0xb0, 0x66,
+    0x2b, 0xc4, 0xac, 0xbf, 0xaf, 0xe9, 0x2c, 0xd5, 0xa9, 0xc5, 0xaa, 0x86,
+    0xac, 0xa0, 0x27, 0xca, 0x20, 0x82, 0xb1, 0xb7, 0xac, 0x54, 0x28, 0x08,
+    0xad, 0xb5, 0x30, 0x70, 0x24, 0x83, 0xa8, 0x13, 0x2c, 0xf8, 0xa8, 0x39,
+    0xa8, 0x19, 0x2c, 0x1a, 0xa8, 0xcd, 0xa9, 0x3b, 0xb3, 0xfd, 0xad, 0x40,
+    0xa6, 0xd4, 0x98, 0xba, 0x2b, 0xe7, 0xae, 0x2b, 0xad, 0xc3, 0x30, 0xa5,
+    0x2a, 0x41, 0x2d, 0x12, 0xb0, 0x22, 0x29, 0x3d, 0xa1, 0xe3, 0xb0, 0x7c,
+    0x28, 0x75, 0xa7, 0x4b, 0x2e, 0x3f, 0xb0, 0x05, 0xaf, 0x6f, 0x27, 0x88,
+    0xb0, 0x16, 0x27, 0x0f, 0x1e, 0x11, 0xb0, 0x7f, 0xac, 0x20, 0x2e, 0x23,
+    0x2a, 0xdf, 0xb0, 0x67, 0xac, 0xdf, 0x29, 0xdf, 0xaa, 0x2d, 0xaf, 0xe0,
+    0xad, 0x71, 0xb0, 0x3c, 0x31, 0x23, 0x29, 0xcf, 0xa5, 0x07, 0x2a, 0xbd,
+    0xaa, 0x5b, 0xb1, 0x65, 0x26, 0x8f, 0x1a, 0x69, 0xae, 0x2e, 0xaf, 0xb8,
+    0x9e, 0xa6, 0xa7, 0x0e, 0x32, 0x14, 0x2d, 0x0a, 0xaf, 0xd0, 0xaa, 0xd8,
+    0x2a, 0xb4, 0xa8, 0x9a, 0x2f, 0x99, 0xa1, 0xad, 0xa7, 0x1c, 0x29, 0xf1,
+    0x2e, 0x18, 0xa9, 0xf4, 0x20, 0xf9, 0xa9, 0xd4, 0x1a, 0x55, 0xac, 0xb4,
+    0x2a, 0x63, 0x2c, 0xeb, 0x28, 0xcc, 0xa9, 0xaa, 0x1c, 0x9c, 0xad, 0x23,
+    0x24, 0x37, 0xac, 0xb2, 0x2e, 0x32, 0x2e, 0x41, 0xa8, 0x1f, 0x32, 0x29,
+    0xa9, 0xc0, 0x28, 0xa7, 0x2c, 0x78, 0x27, 0x2c, 0x30, 0x7e, 0x2a, 0x3d,
+    0x33, 0x5e, 0x1e, 0x55, 0xb1, 0xa9, 0xa5, 0x77, 0xb0, 0x45, 0x00, 0xfc,
+    0x29, 0x86, 0x30, 0xa8, 0x2b, 0x5d, 0xac, 0xc4, 0x2b, 0x38, 0xaa, 0x9b,
+    0x2f, 0x69, 0xa0, 0xf3, 0xaa, 0x00, 0x25, 0x9c, 0x29, 0x24, 0x30, 0xf3,
+    0x1e, 0x21, 0x23, 0x59, 0xa8, 0xdc, 0x90, 0xd0, 0xb1, 0x62, 0xae, 0x66,
+    0x28, 0xfb, 0xb0, 0x26, 0xb0, 0xe8, 0x29, 0x55, 0xa1, 0xa6, 0xaa, 0xfb,
+    0x28, 0xdd, 0xa8, 0x03, 0x20, 0x96, 0x2f, 0x16, 0x30, 0xaf, 0x28, 0x17,
+    0x2b, 0xcd, 0x1c, 0x28, 0xa9, 0x82, 0xaa, 0x1d, 0xa2, 0x5a, 0x2a, 0xed,
+    0x30, 0xa3, 0xb0, 0xac, 0xa9, 0xc2, 0xa8, 0x10, 0xa9, 0xa3, 0xad, 0x62,
+    0x31, 0xda, 0x94, 0x44, 0xb2, 0x14, 0x2b, 0xfb, 0xaf, 0x65, 0x28, 0xe6,
+    0x31, 0x67, 0xa6, 0xc8, 0x34, 0xe1, 0xae, 0xcc, 0xa4, 0x60, 0x32, 0x96,
+    0x23, 0x88, 0xb2, 0x92, 0x2a, 0x60, 0x31, 0x16, 0x2c, 0x2f, 0x2f, 0xd0,
+    0x2c, 0x9c, 0xad, 0x95, 0xb0, 0xb1, 0xac, 0x5a, 0xaf, 0x0c, 0xa8, 0xae,
+    0xa3, 0xc0, 0x25, 0x08, 0x28, 0x6c, 0xb1, 0x78, 0x31, 0xe0, 0x30, 0xa8,
+    0x23, 0x88, 0xad, 0x3d, 0x2b, 0xdd, 0x1d, 0x4d, 0x2d, 0x7d, 0x33, 0x82,
+    0x32, 0xad, 0x28, 0x6d, 0xa1, 0x2f, 0xa8, 0x66, 0xa4, 0xca, 0xad, 0xf5,
+    0x2b, 0x33, 0xac, 0x8c, 0xae, 0x92, 0x2d, 0x3d, 0xac, 0x8e, 0x28, 0xdf,
+    0x1f, 0x72, 0xae, 0x6b, 0xaa, 0xdb, 0x9d, 0xc4, 0xab, 0xb5, 0x2c, 0xe6,
+    0xaa, 0x59, 0x29, 0x2d, 0xaa, 0x8b, 0xad, 0xc1, 0xab, 0xfe, 0xaf, 0xa2,
+    0xa9, 0x71, 0x9e, 0x35, 0xaf, 0xc3, 0x2b, 0x8f, 0x9c, 0x23, 0xa8, 0x3f,
+    0xa4, 0xc0, 0x28, 0xad, 0x9f, 0xef, 0x2a, 0x79, 0x2e, 0xc7, 0xab, 0x14,
+    0xa7, 0x43, 0x2c, 0x61, 0x2c, 0xda, 0x2e, 0xa7, 0x2d, 0xf4, 0x2d, 0x27,
+    0x30, 0xe6, 0x2b, 0x91, 0x2c, 0x51, 0x2b, 0x69, 0x30, 0xe2, 0x28, 0x7d,
+    0xae, 0xaf, 0x30, 0x3f, 0xa8, 0xeb, 0x28, 0x13, 0x31, 0x83, 0x25, 0xa2,
+    0xb0, 0x4c, 0x25, 0x4a, 0x24, 0xc6, 0xac, 0x8e, 0xaf, 0x98, 0xa9, 0x5b,
+    0xb0, 0x36, 0xa5, 0xc4, 0x2c, 0x81, 0x30, 0x05, 0x33, 0x9f, 0x2b, 0xbd,
+    0x31, 0x13, 0xaa, 0x67, 0x2c, 0x8f, 0x28, 0x98, 0xb0, 0x76, 0x2a, 0xd5,
+    0xab, 0xbd, 0x9e, 0x71, 0xae, 0x37, 0xa5, 0x35, 0x32, 0x3f, 0x2d, 0x83,
+    0xa2, 0xf6, 0xac, 0xb1, 0x9e, 0x23, 0xa8, 0xb2, 0x30, 0x70, 0x9e, 0x20,
+    0x0c, 0xd0, 0xb1, 0x1d, 0x2d, 0x32, 0xab, 0xc5, 0x25, 0x34, 0xac, 0x60,
+    0xb1, 0x6d, 0xaa, 0x37, 0x1e, 0xe1, 0x26, 0x53, 0xad, 0xc3, 0x2a, 0x91,
+    0xa1, 0xc0, 0xac, 0xbc, 0x32, 0xaf, 0x27, 0x8f, 0xac, 0x25, 0x2f, 0x51,
+    0x2f, 0x3d, 0x29, 0x7f, 0x2d, 0xb0, 0x27, 0xa3, 0xac, 0x6f, 0x2b, 0x0d,
+    0x30, 0x12, 0x2f, 0xc1, 0xa9, 0xc7, 0x2a, 0xab, 0xaf, 0xc2, 0x2f, 0x85,
+    0xad, 0xad, 0xa1, 0xee, 0x33, 0xb2, 0xaa, 0xe0, 0xa9, 0x2f, 0x32, 0xda,
+    0x24, 0x3b, 0xaf, 0xb1, 0xad, 0x4e, 0xb1, 0x42, 0x8b, 0xa2, 0x2c, 0xe6,
+    0x99, 0x36, 0xa0, 0x7f, 0x2d, 0x3d, 0x2d, 0xb3, 0xad, 0x4a, 0xa1, 0xe8,
+    0xad, 0x3d, 0x2c, 0x22, 0x21, 0xf6, 0xa5, 0xa1, 0xa2, 0x6a, 0xaa, 0xde,
+    0xa2, 0x37, 0x20, 0x42, 0x35, 0x4f, 0xa6, 0x01, 0xb0, 0x3e, 0x2d, 0xd5,
+    0xa1, 0xe7, 0x2c, 0x99, 0xac, 0x60, 0xac, 0xd5, 0x2d, 0x69, 0x1e, 0xd8,
+    0xa9, 0x99, 0xac, 0x1e, 0x31, 0x1e, 0x20, 0xa0, 0xb0, 0xca, 0xa1, 0x82,
+    0xa9, 0xc6, 0xa6, 0x9a, 0x9d, 0x7e, 0x1c, 0x16, 0xad, 0x2e, 0x2e, 0xd6,
+    0x2e, 0x5e, 0xac, 0x40, 0x29, 0xf9, 0xa5, 0x85, 0x2a, 0x44, 0x31, 0x71,
+    0x2a, 0x96, 0xa6, 0x10, 0xa4, 0x0c, 0x2c, 0x08, 0x2b, 0xfa, 0x2c, 0x94,
+    0x2e, 0xf2, 0xad, 0x61, 0xaf, 0x94, 0x2c, 0xe1, 0xb0, 0x86, 0xa5, 0xe2,
+    0x34, 0x49, 0xaa, 0x27, 0x28, 0x09, 0xa8, 0x4e, 0x9f, 0xbb, 0xa9, 0xdc,
+    0x1d, 0x55, 0xb0, 0xa6, 0xac, 0x7b, 0x27, 0x54, 0xad, 0x30, 0x2c, 0xc9,
+    0x30, 0x4d, 0x2d, 0xd2, 0x2c, 0xd3, 0x2e, 0xce, 0xac, 0x3e, 0xae, 0x06,
+    0x2c, 0x7a, 0x24, 0x3d, 0x2d, 0x9d, 0xaa, 0x22, 0x2b, 0x56, 0x2e, 0xe8,
+    0x94, 0x74, 0x25, 0xdd, 0xac, 0x89, 0x2e, 0x0d, 0xaf, 0xe7, 0xae, 0x06,
+    0x9e, 0x90, 0x28, 0x03, 0xad, 0x09, 0x2c, 0x75, 0xa9, 0x9d, 0x29, 0x68,
+    0x2e, 0x50, 0xae, 0x19, 0xa8, 0x35, 0x29, 0xa3, 0x2f, 0x94, 0xad, 0x0f,
+    0x2c, 0x61, 0x15, 0x79, 0xab, 0x85, 0x30, 0xb0, 0x2a, 0x47, 0xac, 0x71,
+    0xa7, 0x98, 0x2f, 0x89, 0x31, 0x33, 0x30, 0xd1, 0x2a, 0x47, 0xa0, 0xbd,
+    0xad, 0xa2, 0x1d, 0x19, 0x26, 0x77, 0xa4, 0x2d, 0x30, 0x5f, 0xa7, 0x96,
+    0xac, 0x66, 0xa5, 0xf1, 0xa3, 0x4f, 0x2a, 0x8f, 0x2c, 0xe3, 0x2d, 0xa8,
+    0xb0, 0xdd, 0xad, 0xaf, 0x2d, 0xbe, 0xa9, 0x9c, 0xac, 0x0d, 0xae, 0x86,
+    0x28, 0x21, 0x2f, 0x0f, 0x18, 0x58, 0x30, 0x82, 0x2c, 0x69, 0xad, 0x6e,
+    0x2e, 0x4d, 0xa4, 0x37, 0xb1, 0x69, 0x27, 0xd2, 0xa9, 0x4d, 0xb1, 0xd0,
+    0xac, 0x8e, 0xb1, 0xc3, 0xaf, 0x6a, 0xa8, 0xf8, 0x30, 0x71, 0xae, 0x7b,
+    0x9d, 0x10, 0x9a, 0xbf, 0xb1, 0x5a, 0xa9, 0x98, 0x2b, 0x76, 0xac, 0x68,
+    0xac, 0x2a, 0xac, 0x31, 0x21, 0xec, 0x2a, 0x3d, 0x2d, 0x8d, 0x9b, 0x10,
+    0xaa, 0x04, 0x2b, 0xb8, 0xa9, 0x2f, 0x21, 0x5f, 0x31, 0x7a, 0x28, 0xa7,
+    0x26, 0x31, 0x28, 0x9d, 0x26, 0x61, 0x1b, 0x55, 0x29, 0xb4, 0x2c, 0xeb,
+    0x2b, 0xd7, 0x31, 0x2a, 0x25, 0x7b, 0x2c, 0x08, 0xab, 0x25, 0xac, 0x3c,
+    0xaf, 0xde, 0xa0, 0x21, 0x21, 0x04, 0x2e, 0x97, 0xac, 0x38, 0x2b, 0xa4,
+    0x27, 0xd6, 0x28, 0xbe, 0x2c, 0xd0, 0x9e, 0x88, 0x24, 0xc7, 0x1d, 0x91,
+    0xaa, 0x20, 0x1d, 0x11, 0xa5, 0x0c, 0xac, 0xfb, 0x28, 0x7f, 0x1a, 0x64,
+    0xab, 0xf6, 0x2e, 0x50, 0x31, 0x65, 0xa4, 0xbf, 0x25, 0xc0, 0x2d, 0xc6,
+    0x28, 0x0b, 0xad, 0xda, 0x24, 0xbd, 0x2b, 0xbe, 0xad, 0xc5, 0xab, 0x67,
+    0xa6, 0xaa, 0xa4, 0x7c, 0xa3, 0x25, 0xab, 0xeb, 0x9f, 0x87, 0x23, 0x73,
+    0x26, 0x3e, 0xa7, 0x82, 0x28, 0x01, 0xa9, 0x8a, 0xac, 0xf3, 0xa2, 0x3d,
+    0x2c, 0x32, 0xa9, 0x23, 0xae, 0x8a, 0xa8, 0x0a, 0xad, 0x42, 0xa6, 0x5a,
+    0x24, 0xe3, 0xac, 0xb9, 0x22, 0xf2, 0xad, 0x2d, 0xa0, 0xd6, 0xb0, 0x01,
+    0x2c, 0x55, 0xae, 0x44, 0xb1, 0x5b, 0x31, 0x31, 0x33, 0xcd, 0x2d, 0xad,
+    0x90, 0x75, 0x29, 0xd9, 0x15, 0x4c, 0xa7, 0xce, 0x2d, 0xf3, 0x9e, 0xdd,
+    0x16, 0xc8, 0xa8, 0xbe, 0xae, 0x17, 0xa3, 0x02, 0xb1, 0x2d, 0x2c, 0x7f,
+    0x33, 0x10, 0x2a, 0x87, 0xaa, 0x2b, 0x2d, 0x47, 0x24, 0x64, 0xad, 0xe6,
+    0x9d, 0x26, 0x2d, 0xde, 0xa6, 0xc1, 0xad, 0x70, 0x9e, 0x67, 0x30, 0x7d,
+    0x2e, 0x66, 0x26, 0xe2, 0x9c, 0x13, 0xaa, 0xf1, 0xb1, 0x1e, 0x1b, 0x1a,
+    0xa0, 0x3b, 0x25, 0x91, 0xab, 0x78, 0xad, 0x17, 0xad, 0x33, 0x2a, 0x72,
+    0x25, 0xdd, 0x29, 0x45, 0xa5, 0xbb, 0xa7, 0x19, 0x2d, 0x26, 0x2d, 0xde,
+    0x14, 0xc3, 0x9c, 0x24, 0xa5, 0xee, 0x2f, 0x06, 0xad, 0x2c, 0xa6, 0x0d,
+    0x15, 0x9c, 0xb0, 0x11, 0x29, 0x68, 0x2d, 0xad, 0x2d, 0x37, 0xb0, 0x1a,
+    0xac, 0x05, 0xae, 0xce, 0x30, 0x23, 0x2a, 0x23, 0x30, 0xbc, 0xab, 0x1d,
+    0x2e, 0xd8, 0x27, 0x7e, 0x31, 0x9d, 0x2e, 0xe6, 0xad, 0xbe, 0x2d, 0xd6,
+    0x30, 0x45, 0xa0, 0xf1, 0x2a, 0x57, 0x1f, 0x3b, 0x2e, 0xae, 0x2c, 0x51,
+    0xaa, 0x30, 0x2f, 0x08, 0xa8, 0xce, 0xa7, 0xd1, 0x2c, 0x5b, 0x26, 0xa8,
+    0xae, 0xa6, 0x28, 0xf8, 0xac, 0xdc, 0xaa, 0x74, 0xae, 0xf7, 0xa0, 0x1f,
+    0xa0, 0xd7, 0x2e, 0xd0, 0xad, 0x36, 0x25, 0xa0, 0x30, 0x0b, 0xa7, 0xcf,
+    0x2f, 0xe7, 0x31, 0x3b, 0xad, 0xcc, 0x29, 0x6c, 0x27, 0x3f, 0x26, 0x61,
+    0xac, 0x0e, 0x30, 0x12, 0x27, 0xea, 0xa4, 0x05, 0x34, 0xb4, 0xac, 0xee,
+    0xa8, 0xeb, 0x2f, 0x19, 0x23, 0x29, 0xab, 0x64, 0xa9, 0xad, 0x27, 0x00,
+    0xae, 0xb0, 0x8e, 0xda, 0x20, 0x7f, 0x28, 0x1a, 0xa5, 0x43, 0xae, 0x39,
+    0xae, 0x4c, 0x31, 0x5c, 0xaf, 0xa8, 0xb0, 0xad, 0xac, 0xbb, 0xaf, 0xae,
+    0xa9, 0x89, 0x2c, 0xf0, 0x20, 0x82, 0x9e, 0x82, 0x2e, 0xe6, 0x2a, 0xb9,
+    0x32, 0x5f, 0x9f, 0xa8, 0xa0, 0x1b, 0x2a, 0xf3, 0x2f, 0x84, 0xac, 0x7e,
+    0x9c, 0x0f, 0xaf, 0x8f, 0x30, 0xd9, 0x2d, 0x15, 0xb0, 0x77, 0xac, 0x15,
+    0xaf, 0x01, 0xa8, 0x3f, 0x2b, 0xc8, 0xb2, 0xf5, 0x28, 0x97, 0x96, 0x9b,
+    0x98, 0x34, 0x30, 0xe8, 0xad, 0x01, 0x24, 0xae, 0x21, 0x11, 0xac, 0x53,
+    0x2c, 0x7d, 0x2c, 0xf2, 0x20, 0x6a, 0xa5, 0x59, 0x2e, 0x04, 0xab, 0xf4,
+    0x19, 0x2e, 0xaa, 0x55, 0xae, 0xcf, 0xa7, 0xc4, 0xae, 0x13, 0x2d, 0xb0,
+    0xa9, 0x79, 0x26, 0xf9, 0xae, 0xd2, 0x2e, 0x2a, 0xb0, 0x18, 0x2f, 0x83,
+    0xa9, 0xfd, 0xad, 0xc2, 0xaa, 0x51, 0xaf, 0x08, 0x28, 0x70, 0xa9, 0x4c,
+    0x2c, 0x1f, 0xa4, 0xb2, 0x13, 0x31, 0xaf, 0x4e, 0xb1, 0xa3, 0x9c, 0x42,
+    0xac, 0x02, 0xaf, 0x7a, 0xad, 0x1e, 0xa8, 0x32, 0x2c, 0x18, 0x29, 0x6d,
+    0x2c, 0x03, 0xa8, 0xa4, 0xa4, 0x2f, 0x27, 0xa4, 0xa7, 0x4e, 0x90, 0xe6,
+    0xa8, 0x69, 0xa8, 0x33, 0x27, 0x97, 0xaa, 0x4f, 0xa5, 0x9d, 0xac, 0x35,
+    0x29, 0xc9, 0x2b, 0x30, 0x9c, 0x79, 0x9f, 0xbb, 0xac, 0x46, 0xac, 0x64,
+    0x32, 0x6b, 0x2f, 0x6b, 0xab, 0xec, 0x2d, 0x65, 0x24, 0x52, 0xa5, 0xc2,
+    0xa8, 0x25, 0x28, 0x5c, 0xac, 0x5f, 0x2d, 0x8e, 0xa9, 0x03, 0x2f, 0x11,
+    0x9e, 0xa3, 0x24, 0xa9, 0xa8, 0x87, 0x2b, 0x42, 0xae, 0x6c, 0xab, 0xa6,
+    0x19, 0x2f, 0x29, 0xf0, 0xb0, 0xe2, 0xae, 0x79, 0xaf, 0xcd, 0xad, 0xd7,
+    0x2d, 0x0e, 0x28, 0x56, 0xb0, 0x40, 0x2a, 0x09, 0x2a, 0x05, 0x23, 0x57,
+    0xa9, 0xd9, 0xa5, 0x51, 0xb1, 0x91, 0x1f, 0xeb, 0x2b, 0x3f, 0x2c, 0x42,
+    0xac, 0x66, 0xb1, 0xc1, 0xac, 0x0a, 0x2e, 0x49, 0x2e, 0x98, 0xad, 0x6b,
+    0x2c, 0x13, 0xab, 0x3d, 0x30, 0xaa, 0x29, 0x4f, 0x30, 0x68, 0xa1, 0xff,
+    0xa9, 0xa2, 0x2d, 0x6d, 0x2d, 0x08, 0x30, 0x2f, 0x22, 0xc6, 0x2d, 0x31,
+    0xb0, 0x91, 0xa9, 0xc9, 0xa7, 0x53, 0x2b, 0xe4, 0xa8, 0x10, 0xa6, 0x22,
+    0x25, 0x2b, 0x30, 0x09, 0xac, 0x18, 0xa8, 0xf6, 0x33, 0xaa, 0xa4, 0x3a,
+    0x2b, 0x72, 0x2f, 0x63, 0xac, 0x66, 0x2d, 0xf5, 0x26, 0x00, 0x2c, 0x53,
+    0x25, 0xe5, 0xa8, 0x2d, 0x29, 0xfc, 0x2b, 0xb8, 0x24, 0xa9, 0xa9, 0x91,
+    0x28, 0x16, 0x30, 0xe4, 0xae, 0x9c, 0x25, 0x44, 0xac, 0x94, 0x2c, 0x35,
+    0x20, 0x57, 0xa5, 0x2a, 0xae, 0x62, 0x28, 0x52, 0x31, 0xb7, 0xab, 0xcc,
+    0xb2, 0xce, 0x2f, 0x42, 0x30, 0x78, 0xab, 0xdc, 0x1d, 0xa9, 0x2a, 0x11,
+    0xa1, 0x2f, 0x2e, 0x06, 0x9d, 0x8e, 0x28, 0xa8, 0x25, 0x34, 0xac, 0x43,
+    0xa6, 0x36, 0x98, 0xaa, 0x33, 0x55, 0xaf, 0xc4, 0x2d, 0x82, 0xaf, 0xa0,
+    0xad, 0x59, 0x2d, 0x16, 0x2d, 0x52, 0x10, 0xbf, 0xad, 0x72, 0xa5, 0xc7,
+    0x33, 0x0e, 0x2a, 0xd7, 0x27, 0xad, 0xa9, 0x79, 0xac, 0x3c, 0xa9, 0x92,
+    0xac, 0x70, 0x2c, 0xe6, 0x2d, 0x62, 0x30, 0x5f, 0xac, 0x01, 0x2f, 0x09,
+    0xa7, 0x7d, 0xa9, 0xd5, 0x31, 0x87, 0xb0, 0xde, 0xa4, 0x57, 0x30, 0x77,
+    0x26, 0x0b, 0xad, 0xb4, 0x2c, 0x5d, 0x25, 0x8d, 0x2b, 0x0d, 0x32, 0x46,
+    0x27, 0x95, 0xaa, 0xaa, 0x2c, 0xea, 0x29, 0x29, 0x30, 0x16, 0x30, 0x7a,
+    0xa9, 0x8f, 0x2e, 0xf9, 0xab, 0xac, 0x2d, 0xd8, 0xaf, 0xa6, 0xa9, 0x09,
+    0xaf, 0xd2, 0xad, 0x16, 0x35, 0x8d, 0x20, 0x1b, 0xae, 0x09, 0x30, 0x76,
+    0x28, 0x87, 0xae, 0x78, 0xa4, 0x33, 0x1d, 0x8b, 0xae, 0x16, 0x32, 0x2e,
+    0xaa, 0xfd, 0xab, 0xe2, 0xa4, 0x1c, 0xb2, 0x08, 0xb0, 0xcf, 0x2f, 0x26,
+    0x2d, 0x49, 0xaa, 0x60, 0xa5, 0x2e, 0xab, 0x22, 0x2a, 0xd3, 0x32, 0x46,
+    0x1c, 0x25, 0xaf, 0xd1, 0xa7, 0xa5, 0xa6, 0x19, 0x32, 0x93, 0xab, 0x92,
+    0xa9, 0xe0, 0x24, 0x81, 0x2e, 0xd9, 0xaf, 0x91, 0xa6, 0x5a, 0xa9, 0x92,
+    0x32, 0x98, 0xa8, 0xe5, 0x31, 0x35, 0x24, 0x6f, 0xb1, 0x0a, 0x2c, 0x51,
+    0xae, 0x4c, 0xa7, 0xf7, 0xad, 0xcd, 0xab, 0xe4, 0xaa, 0x2f, 0x2b, 0x1c,
+    0x90, 0x8e, 0xac, 0xe8, 0x2c, 0x56, 0xad, 0x33, 0xa4, 0x7e, 0x23, 0x1e,
+    0x1c, 0xdd, 0xa8, 0x04, 0x26, 0xe5, 0x2d, 0xe3, 0xa9, 0xcf, 0xab, 0x53,
+    0x30, 0x6d, 0x2d, 0x7b, 0x2c, 0xfa, 0x29, 0x0c, 0x30, 0x35, 0x31, 0x1a,
+    0xb3, 0x39, 0x24, 0x4c, 0xae, 0xdf, 0x9a, 0x23, 0x28, 0x06, 0xa7, 0x19,
+    0x29, 0xb1, 0xae, 0xd2, 0xa9, 0xe0, 0x18, 0x69, 0xb0, 0x18, 0x22, 0x6a,
+    0xab, 0xc4, 0xa9, 0x74, 0xac, 0x02, 0x2f, 0x9d, 0xa8, 0xae, 0x26, 0x39,
+    0x30, 0xfd, 0x1b, 0x63, 0x31, 0x64, 0x31, 0x17, 0xb2, 0xcd, 0xb0, 0x4a,
+    0xb0, 0xb5, 0x2c, 0x39, 0xb0, 0x36, 0xb0, 0x91, 0x27, 0xac, 0xa8, 0x2c,
+    0xb0, 0xf4, 0xab, 0xc1, 0x9c, 0x9a, 0xa9, 0x5b, 0x2b, 0xe7, 0xaa, 0xec,
+    0x26, 0x9b, 0x98, 0x5a, 0xaf, 0x9c, 0x22, 0xa3, 0xaa, 0x84, 0x2a, 0xc4,
+    0x25, 0xce, 0xa2, 0xcc, 0xa8, 0xb2, 0xab, 0x7b, 0x31, 0x3d, 0xac, 0x59,
+    0xb1, 0x2f, 0xae, 0x88, 0xa8, 0xe6, 0x2f, 0x05, 0xae, 0x58, 0xb2, 0x7f,
+    0x2d, 0x54, 0xa7, 0x8e, 0xae, 0x12, 0x2f, 0x5b, 0xa8, 0x23, 0xad, 0xd1,
+    0xab, 0x92, 0xab, 0x42, 0x2d, 0x55, 0x2d, 0x70, 0xb4, 0x63, 0xac, 0xc3,
+    0xac, 0xa6, 0xa4, 0x51, 0xb2, 0x90, 0xa4, 0xff, 0xad, 0x88, 0x30, 0xda,
+    0xb2, 0x8b, 0x28, 0xfc, 0xa2, 0x15, 0x2c, 0x7f, 0x9a, 0xc7, 0xa8, 0x21,
+    0xaf, 0xe0, 0x2c, 0xd9, 0xa9, 0xfa, 0x2a, 0x3a, 0x29, 0xe4, 0xaa, 0xd5,
+    0x2d, 0x55, 0x29, 0xc9, 0xb3, 0x14, 0xae, 0x58, 0x2c, 0x46, 0xa3, 0x20,
+    0xb4, 0xf9, 0x23, 0x08, 0xad, 0x12, 0x2d, 0x74, 0xb1, 0x33, 0xab, 0x52,
+    0xa1, 0x1c, 0xb2, 0x7a, 0xa1, 0xe7, 0xa1, 0x7a, 0x2d, 0x87, 0xa9, 0x9e,
+    0xa6, 0x46, 0xb1, 0x34, 0xac, 0x43, 0x2c, 0x7d, 0xa7, 0x99, 0xac, 0x4f,
+    0xa7, 0x7c, 0xa6, 0x09, 0x2a, 0x6d, 0x29, 0x5b, 0xaf, 0x4d, 0xad, 0xa4,
+    0x28, 0x93, 0x2f, 0x26, 0x28, 0x70, 0xa6, 0x88, 0x29, 0x50, 0x30, 0x32,
+    0x23, 0xa1, 0x2d, 0x00, 0x2a, 0x8b, 0xa2, 0x9e, 0xb0, 0x24, 0xac, 0x95,
+    0x2c, 0xfa, 0x28, 0x23, 0xb4, 0x88, 0x2b, 0xa1, 0xa4, 0x2e, 0xa9, 0x2a,
+    0xa8, 0xff, 0xa4, 0x76, 0xaf, 0x17, 0x2a, 0xc5, 0xaa, 0x6e, 0xac, 0x4c,
+    0xa9, 0x22, 0x27, 0xa1, 0x28, 0x9a, 0x24, 0xa3, 0x2a, 0xa4, 0x28, 0xa7,
+    0xac, 0x3b, 0x9d, 0x98, 0x20, 0xa2, 0xa1, 0xa4, 0x30, 0x34, 0xa5, 0x27,
+    0xb0, 0x04, 0xab, 0x2d, 0x2c, 0x5d, 0x2c, 0xef, 0xaf, 0xaa, 0xaf, 0x8e,
+    0xae, 0x47, 0xae, 0x97, 0xaf, 0x65, 0xa0, 0x2f, 0x2c, 0xbf, 0xb0, 0x42,
+    0xab, 0x45, 0x29, 0x44, 0x30, 0x0f, 0x2d, 0x8d, 0x29, 0x6e, 0xa8, 0x87,
+    0xa7, 0x52, 0xae, 0x39, 0x2d, 0xa1, 0x2b, 0x83, 0xab, 0xbd, 0xaf, 0x95,
+    0xa4, 0x9d, 0x30, 0x56, 0x2d, 0x3f, 0x2d, 0x8e, 0x20, 0xc8, 0xa6, 0xb5,
+    0x21, 0x0a, 0x24, 0xc0, 0xac, 0x64, 0x28, 0x3c, 0x2a, 0xaf, 0x29, 0x73,
+    0x29, 0x94, 0x30, 0x59, 0xa1, 0x3b, 0x26, 0x97, 0x30, 0x30, 0x2c, 0x0d,
+    0xac, 0x59, 0xa5, 0x68, 0x2d, 0x5f, 0x2a, 0x89, 0x28, 0xaa, 0x2a, 0xbb,
+    0xaa, 0xae, 0x29, 0x75, 0x28, 0x66, 0x31, 0x52, 0x2d, 0x65, 0x2c, 0xb0,
+    0xaf, 0x5a, 0x2d, 0xfd, 0x2e, 0xc0, 0xac, 0x4e, 0xab, 0x2e, 0x2b, 0x2f,
+    0x22, 0x1e, 0xac, 0xce, 0x22, 0xf7, 0x25, 0xbb, 0x30, 0x55, 0x28, 0x79,
+    0xa3, 0xa1, 0xb0, 0x7a, 0xaa, 0x22, 0x29, 0xb4, 0xad, 0x09, 0xa3, 0x7a,
+    0xb0, 0x66, 0x27, 0xac, 0x1f, 0x0f, 0x26, 0xdb, 0xad, 0x83, 0xad, 0x6b,
+    0x2e, 0x36, 0x9d, 0x78, 0xac, 0x3a, 0x1d, 0xb1, 0x31, 0x8b, 0x2c, 0x55,
+    0x1f, 0x09, 0x30, 0x3b, 0xaf, 0xb8, 0x2a, 0x21, 0x2c, 0xa4, 0x31, 0x20,
+    0x2d, 0xb5, 0x31, 0xa5, 0xaa, 0xca, 0x2c, 0xbb, 0xa8, 0x5b, 0xa8, 0x62,
+    0xac, 0x17, 0x2c, 0xe7, 0xad, 0x4e, 0xa3, 0x15, 0x2c, 0x2e, 0x31, 0xe4,
+    0x2e, 0x0d, 0x1e, 0x97, 0xac, 0xdb, 0x2c, 0x3e, 0x26, 0x86, 0xa7, 0xbc,
+    0x2a, 0x00, 0x2c, 0x7d, 0x2b, 0x38, 0x2e, 0x3c, 0x27, 0xa8, 0xad, 0x14,
+    0x27, 0x45, 0x34, 0x76, 0x2e, 0xcb, 0x2f, 0xe7, 0x2a, 0x15, 0x29, 0x54,
+    0x2d, 0x70, 0x2c, 0x44, 0x2b, 0x7a, 0x24, 0x37, 0xb1, 0x83, 0x96, 0xf6,
+    0x2f, 0x0c, 0x30, 0x47, 0x81, 0x1b, 0x21, 0xcb, 0x2a, 0x32, 0xab, 0x2a,
+    0x30, 0x36, 0xa8, 0x44, 0xb0, 0x60, 0x22, 0xc5, 0x19, 0x4c, 0xb1, 0x3c,
+    0x27, 0x30, 0xa3, 0x1e, 0xa0, 0x3c, 0xa8, 0x11, 0x30, 0x19, 0x28, 0x78,
+    0x2b, 0xfc, 0xad, 0x0f, 0x2c, 0x82, 0x2a, 0xaa, 0xb0, 0x1d, 0xa1, 0x99,
+    0xa4, 0xfb, 0x30, 0x0f, 0x31, 0x1b, 0x32, 0xff, 0x2c, 0x36, 0x30, 0xd1,
+    0x1c, 0x8a, 0x30, 0x27, 0xad, 0x87, 0xaa, 0xb1, 0x2c, 0xbd, 0x1d, 0xbf,
+    0x30, 0xdf, 0x20, 0xca, 0x9c, 0x61, 0x2b, 0xa3, 0xae, 0x9e, 0x2b, 0x8e,
+    0x2d, 0x97, 0xae, 0x80, 0x2e, 0x1c, 0xa9, 0x51, 0x2a, 0x57, 0x2e, 0xe3,
+    0xa8, 0x63, 0x8e, 0xc4, 0x2b, 0x80, 0x1d, 0x59, 0xa7, 0xe3, 0x32, 0xc6,
+    0x2d, 0xe7, 0x27, 0xd1, 0x28, 0xb0, 0xac, 0x3f, 0x2c, 0xba, 0xae, 0x4f,
+    0xaf, 0x3e, 0x28, 0x42, 0x1b, 0xd8, 0x2b, 0xcf, 0x29, 0xe0, 0x9c, 0x96,
+    0x21, 0x80, 0xa0, 0xfd, 0xa9, 0xdc, 0x2c, 0x2b, 0x2e, 0xf9, 0xaa, 0x01,
+    0xb4, 0xc2, 0x31, 0xe4, 0x2b, 0xbc, 0xae, 0x3c, 0x2c, 0x1b, 0xad, 0xfb,
+    0xa6, 0xf9, 0xa9, 0x48, 0x28, 0x48, 0x29, 0x83, 0x2b, 0x65, 0x30, 0x6e,
+    0x2d, 0xd4, 0xaf, 0xd7, 0x2e, 0xec, 0x2d, 0x07, 0xa6, 0x46, 0xaf, 0x28,
+    0x32, 0xfc, 0xaf, 0xfb, 0x33, 0x3c, 0x28, 0x09, 0xb1, 0xcd, 0xaf, 0x46,
+    0xa2, 0x3d, 0xa9, 0xb4, 0xa1, 0xfd, 0xae, 0xc8, 0xb0, 0xb2, 0xb5, 0x2c,
+    0xb2, 0x8d, 0x34, 0xc8, 0x30, 0xaf, 0x33, 0x1c, 0x2f, 0x4f, 0x29, 0x9a,
+    0x24, 0xf2, 0xa1, 0x9b, 0x2b, 0x01, 0xac, 0x62, 0x29, 0x14, 0xad, 0x51,
+    0xaa, 0xf2, 0x31, 0x10, 0x9f, 0xc5, 0x2e, 0xa1, 0x2a, 0x82, 0xa9, 0x42,
+    0x31, 0x99, 0x30, 0xeb, 0x2a, 0xe7, 0xb4, 0xd0, 0x2d, 0x03, 0x26, 0x9c,
+    0xad, 0x61, 0x30, 0x90, 0xb1, 0xf4, 0x28, 0x33, 0xac, 0x2a, 0x2c, 0x1e,
+    0x2c, 0x0c, 0xa0, 0x88, 0x30, 0x48, 0x28, 0x82, 0x1d, 0xb1, 0xad, 0x92,
+    0x92, 0x91, 0x2a, 0x0a, 0xa9, 0xa7, 0x30, 0x51, 0x2a, 0x1b, 0xb1, 0x67,
+    0x2c, 0x4c, 0x2a, 0x8e, 0x27, 0xa6, 0x31, 0x72, 0x20, 0xc2, 0xb0, 0xab,
+    0x2c, 0x5b, 0x1f, 0xbd, 0x2f, 0xcf, 0x8e, 0xb7, 0x2e, 0x7e, 0x9f, 0xff,
+    0x25, 0x39, 0x30, 0xf9, 0xad, 0xf1, 0x15, 0x06, 0x27, 0x4c, 0x30, 0x62,
+    0x30, 0xe9, 0xad, 0x6d, 0xb1, 0x54, 0xb0, 0x4c, 0xaf, 0xd5, 0x33, 0x99,
+    0xaa, 0xa4, 0x32, 0xd9, 0x2b, 0x67, 0x27, 0x89, 0x2e, 0x8b, 0x33, 0x30,
+    0xa8, 0xce, 0xa4, 0xae, 0x25, 0x90, 0xac, 0x2d, 0x21, 0x59, 0x30, 0xc6,
+    0x9f, 0xac, 0x30, 0xdd, 0xa8, 0xf1, 0x31, 0x34, 0x32, 0xb8, 0xaa, 0x3a,
+    0x2d, 0x37, 0xb0, 0x9e, 0xa9, 0x40, 0x1d, 0x8a, 0xb3, 0xf2, 0x23, 0x4b,
+    0xb1, 0xff, 0x2f, 0x42, 0x24, 0xa1, 0xac, 0x82, 0x32, 0xb9, 0x1e, 0x73,
+    0xa9, 0xb9, 0x28, 0x8e, 0x9f, 0xe7, 0xb0, 0x5d, 0x25, 0x61, 0x26, 0x57,
+    0xa7, 0x62, 0x29, 0x08, 0x28, 0xfa, 0xb0, 0x91, 0x31, 0x30, 0x24, 0x7d,
+    0x2e, 0x3e, 0x2c, 0xfe, 0xa6, 0xa9, 0xad, 0x04, 0x34, 0xbc, 0xa6, 0xd4,
+    0x2c, 0xb4, 0xac, 0xcc, 0x32, 0x9b, 0xae, 0xed, 0x30, 0x12, 0xab, 0x3e,
+    0xa3, 0x61, 0x2e, 0x9a, 0x2f, 0x70, 0x2a, 0x23, 0x29, 0xfb, 0xb4, 0xcf,
+    0xaa, 0xcd, 0xa9, 0xf9, 0xaf, 0xdf, 0xb4, 0x76, 0x29, 0xcc, 0x2d, 0xb6,
+    0xa6, 0x56, 0x2c, 0xad, 0xa9, 0xed, 0x2c, 0xd2, 0xa8, 0x58, 0x9e, 0x9e,
+    0xad, 0x0e, 0xae, 0xc6, 0xae, 0xe5, 0x33, 0x86, 0x2c, 0xca, 0xa9, 0xd2,
+    0xb0, 0xfd, 0x2e, 0x32, 0x2f, 0x6e, 0x28, 0x6f, 0x2c, 0xff, 0xb2, 0xee,
+    0x29, 0x97, 0xa8, 0x2a, 0xaa, 0x06, 0x2f, 0xe4, 0xb1, 0xe9, 0x9e, 0xfe,
+    0xac, 0x21, 0xa0, 0x7b, 0x20, 0x8e, 0x28, 0x76, 0x27, 0x28, 0x28, 0x5b,
+    0xac, 0x0c, 0xb3, 0x52, 0x26, 0xec, 0xa8, 0x41, 0xa2, 0x4f, 0x20, 0x40,
+    0x2e, 0x3d, 0xb0, 0x5e, 0x30, 0x97, 0xac, 0x35, 0x2b, 0xff, 0x31, 0x52,
+    0xae, 0x40, 0xad, 0x29, 0x28, 0x41, 0xaa, 0x28, 0x30, 0x0c, 0xa6, 0x64,
+    0x32, 0xbb, 0xad, 0x3f, 0x2e, 0x7f, 0xb0, 0x3a, 0xb5, 0x6f, 0x30, 0x18,
+    0x2a, 0x7f, 0x2a, 0xb8, 0x23, 0x22, 0xb0, 0x39, 0xb2, 0xcb, 0xad, 0x64,
+    0xad, 0x8d, 0xa4, 0x13, 0xa6, 0x1f, 0x9a, 0x9a, 0xac, 0xf4, 0x22, 0x62,
+    0xa6, 0xef, 0x2d, 0xa9, 0x2e, 0x99, 0x2c, 0xad, 0x28, 0xd7, 0xab, 0xb4,
+    0xad, 0x07, 0x2f, 0x63, 0x30, 0x80, 0xb0, 0x40, 0x29, 0x57, 0x29, 0x4c,
+    0x30, 0x83, 0x2e, 0x43, 0x2a, 0x54, 0xad, 0x50, 0xa6, 0xc3, 0x98, 0x08,
+    0xae, 0x39, 0x0e, 0x47, 0xb3, 0x16, 0xae, 0xff, 0x31, 0x32, 0xa8, 0xf4,
+    0x2f, 0x67, 0x2a, 0x27, 0xa4, 0x69, 0x28, 0x72, 0x2f, 0x04, 0xb0, 0xb5,
+    0x22, 0xcf, 0xaf, 0x62, 0x1f, 0x08, 0x2f, 0xe6, 0xa8, 0xe9, 0xac, 0xb5,
+    0x2e, 0x55, 0xa1, 0xda, 0x30, 0x37, 0x2c, 0x93, 0xac, 0x13, 0xb0, 0x26,
+    0xab, 0xeb, 0x2e, 0xa3, 0xaf, 0xc6, 0xb2, 0x82, 0x30, 0x1e, 0xab, 0xf5,
+    0x28, 0x08, 0x2a, 0x13, 0xac, 0x6c, 0x27, 0xf9, 0x28, 0x26, 0xae, 0x51,
+    0x1d, 0xa2, 0xb2, 0xae, 0xb1, 0x04, 0xb3, 0xc0, 0xa9, 0x82, 0xb0, 0x90,
+    0x2c, 0xdf, 0x30, 0x94, 0x24, 0x26, 0x2c, 0x1c, 0x94, 0x9d, 0x28, 0x46,
+    0xa8, 0xc0, 0xaa, 0xf2, 0xb0, 0x63, 0x30, 0x0a, 0xaf, 0xc3, 0x9f, 0xaa,
+    0x25, 0x48, 0xae, 0xe2, 0x05, 0xf9, 0x20, 0xa9, 0xa1, 0x54, 0x31, 0x5e,
+    0x2f, 0xe0, 0xb0, 0x15, 0x30, 0xb3, 0x28, 0xe6, 0xa1, 0xbb, 0x21, 0x9e,
+    0xae, 0xef, 0xa6, 0xbf, 0x2a, 0x00, 0xa1, 0x89, 0xa8, 0x1d, 0xa5, 0x1b,
+    0x9b, 0xcb, 0x2d, 0xa2, 0x30, 0x77, 0xb2, 0x88, 0xa2, 0xd5, 0x2e, 0x59,
+    0x2c, 0x36, 0x29, 0x76, 0x26, 0xba, 0xb2, 0x50, 0x30, 0x07, 0xad, 0x90,
+    0x30, 0x28, 0xa5, 0x85, 0xaa, 0x54, 0xac, 0xdb, 0xaa, 0x29, 0x31, 0x32,
+    0x31, 0xca, 0x9e, 0x5d, 0x33, 0x0c, 0xa5, 0x68, 0x31, 0x5c, 0x31, 0x37,
+    0xb2, 0x2c, 0xb0, 0x4b, 0x2f, 0xdb, 0xb1, 0x9f, 0x2d, 0xe4, 0xb1, 0x47,
+    0xad, 0x4c, 0xaa, 0xdb, 0xac, 0xee, 0x27, 0x3f, 0x1f, 0x7b, 0x27, 0xbe,
+    0x28, 0x79, 0x2b, 0xe6, 0x28, 0x89, 0x1a, 0xcc, 0x2e, 0x48, 0x2c, 0x07,
+    0xb4, 0xf0, 0x26, 0x5b, 0xa7, 0x02, 0x2b, 0xf0, 0x29, 0xaa, 0x2d, 0xb7,
+    0x28, 0x42, 0x29, 0x93, 0x2f, 0x27, 0x9e, 0xbc, 0x30, 0x59, 0xb4, 0x1f,
+    0xaf, 0x30, 0x29, 0x62, 0xb2, 0x88, 0x31, 0x6a, 0x9e, 0x39, 0x2b, 0x7b,
+    0x28, 0xa0, 0xb0, 0xe2, 0x30, 0x08, 0x25, 0x2e, 0xa3, 0x53, 0x2e, 0x34,
+    0x32, 0x23, 0xaf, 0x7c, 0x2e, 0xdc, 0xb0, 0x2b, 0xae, 0xc9, 0xaa, 0xa4,
+    0x21, 0xa9, 0xb1, 0xb8, 0x28, 0x34, 0x30, 0xd5, 0xa5, 0x07, 0x35, 0x44,
+    0x01, 0x75, 0xae, 0x2e, 0x30, 0xcc, 0x2d, 0x8f, 0x33, 0x2d, 0xb1, 0x33,
+    0x31, 0x6f, 0x2a, 0x7f, 0x2b, 0xa6, 0x31, 0xa6, 0xb4, 0xa8, 0x0f, 0x1d,
+    0x2d, 0x5a, 0x26, 0xde, 0x2f, 0xfe, 0xb1, 0xe9, 0x24, 0x0d, 0xb5, 0x6e,
+    0xb0, 0x4a, 0x2c, 0x38, 0x10, 0xc4, 0x2e, 0xdd, 0xae, 0x62, 0xad, 0x7b,
+    0x30, 0x51, 0x31, 0x25, 0xaf, 0x22, 0x2c, 0x5d, 0x2c, 0xc3, 0xab, 0x0f,
+    0xab, 0xd8, 0x30, 0x7e, 0xac, 0xa0, 0x32, 0x79, 0xab, 0xdf, 0x33, 0x77,
+    0x31, 0x9f, 0x9c, 0xdd, 0x2d, 0xd0, 0xb1, 0x31, 0x30, 0xdd, 0x2b, 0xb0,
+    0xb3, 0x60, 0x2b, 0xc9, 0xb4, 0x28, 0x32, 0xe6, 0xae, 0x53, 0xa9, 0x19,
+    0x33, 0x66, 0x2c, 0xeb, 0x2f, 0xf8, 0x9e, 0x1d, 0x29, 0xa3, 0xaf, 0xd0,
+    0x2c, 0xa9, 0x29, 0xc2, 0xab, 0xd3, 0xa9, 0xa2, 0x2c, 0x1f, 0x1a, 0x1a,
+    0x30, 0x34, 0x2d, 0x85, 0xad, 0x2b, 0x34, 0xe2, 0x2b, 0xf7, 0xa0, 0x43,
+    0xa0, 0x9c, 0xa5, 0xd0, 0x26, 0x4d, 0xb1, 0x1c, 0x30, 0x7e, 0x32, 0x40,
+    0x31, 0x02, 0x2f, 0x51, 0xb0, 0x2b, 0x2c, 0xf2, 0xad, 0x82, 0x1c, 0x10,
+    0x2f, 0x1a, 0xb3, 0xef, 0x97, 0x5b, 0xb4, 0x62, 0xae, 0x6c, 0xa9, 0x4e,
+    0xa5, 0xbb, 0x31, 0xe5, 0xae, 0xb3, 0x25, 0xd0, 0x26, 0xec, 0x2d, 0x23,
+    0x30, 0x9a, 0x2e, 0x1a, 0xa0, 0x68, 0x2f, 0x92, 0xa6, 0xa4, 0x30, 0x99,
+    0x18, 0x21, 0x34, 0x1d, 0xa2, 0x96, 0x2f, 0xbf, 0x2a, 0x61, 0x2c, 0x7f,
+    0x32, 0x78, 0xad, 0x76, 0x2c, 0xbb, 0xa9, 0x3f, 0x29, 0x80, 0xac, 0xb2,
+    0xa8, 0x6a, 0x2a, 0x92, 0x2c, 0x7c, 0x2c, 0xe2, 0x28, 0x68, 0xa8, 0xc6,
+    0x2e, 0x2d, 0x29, 0x4f, 0xb4, 0xf8, 0xab, 0x3a, 0x2d, 0xe1, 0xab, 0x21,
+    0xa6, 0x42, 0x17, 0x47, 0x28, 0x46, 0xb1, 0xa6, 0xac, 0x29, 0xa0, 0x05,
+    0x2a, 0xaa, 0x2c, 0xf1, 0x2e, 0x6b, 0xb1, 0xd4, 0x32, 0x80, 0xb0, 0xde,
+    0x2a, 0xb5, 0xad, 0x72, 0x31, 0x1f, 0x2b, 0x9c, 0x28, 0x1e, 0xad, 0xa9,
+    0xa5, 0x6d, 0x2d, 0x19, 0xa9, 0x0f, 0x2f, 0x1b, 0xa8, 0x7b, 0xb3, 0xff,
+    0xaf, 0x9c, 0xaa, 0x39, 0x2a, 0x97, 0xab, 0x22, 0x2a, 0x4c, 0x2b, 0x99,
+    0x1c, 0x82, 0xae, 0xe4, 0x29, 0xcc, 0xa7, 0x07, 0xac, 0x3d, 0x27, 0x9b,
+    0x28, 0x54, 0x2c, 0x3a, 0xb0, 0x05, 0x30, 0x49, 0x22, 0x70, 0x22, 0xc1,
+    0x28, 0x62, 0x31, 0x22, 0xad, 0xcc, 0xa7, 0xbd, 0x28, 0xae, 0xb0, 0xf7,
+    0xb2, 0xa9, 0xa9, 0xcc, 0x9e, 0x80, 0xac, 0x8a, 0xaa, 0x2d, 0xab, 0xdf,
+    0xa4, 0xec, 0x29, 0x4a, 0x31, 0xca, 0x29, 0xde, 0x28, 0x33, 0xab, 0x82,
+    0xb1, 0x43, 0xb5, 0xb6, 0xa4, 0x3c, 0x2c, 0x7f, 0x30, 0xfb, 0x2d, 0x70,
+    0x25, 0x68, 0x22, 0xee, 0x2f, 0x8a, 0x14, 0xa7, 0xb0, 0xad, 0x2b, 0xd7,
+    0x2a, 0xd3, 0xaf, 0xf9, 0x30, 0x6f, 0xb3, 0x97, 0x2b, 0x71, 0xb1, 0x33,
+    0x2b, 0x73, 0x2d, 0xff, 0x2a, 0x58, 0xa8, 0x5a, 0xb1, 0x10, 0x2e, 0xad,
+    0xa8, 0x18, 0x2e, 0x61, 0xb1, 0x23, 0xb5, 0x72, 0x1a, 0x2e, 0xaf, 0x92,
+    0xad, 0x87, 0xa7, 0x4e, 0x9b, 0x20, 0x2e, 0x7f, 0xab, 0x7d, 0xa0, 0xe2,
+    0x28, 0x6e, 0x2f, 0x41, 0xa9, 0x7f, 0x2d, 0x39, 0x30, 0x94, 0x2b, 0xc4,
+    0xa9, 0xdc, 0x2d, 0x00, 0xa5, 0x7e, 0xb0, 0x05, 0x2a, 0x7e, 0x9c, 0x3b,
+    0x2a, 0x3b, 0xa4, 0x18, 0xa2, 0xd9, 0xae, 0x15, 0xac, 0x4e, 0x29, 0xfb,
+    0x29, 0xfc, 0xae, 0x01, 0xb4, 0x02, 0xaf, 0x80, 0x31, 0x52, 0x28, 0x79,
+    0x32, 0xea, 0xa9, 0x4d, 0xa4, 0x50, 0x9c, 0x47, 0xad, 0x11, 0xb1, 0xf2,
+    0x20, 0x6b, 0x2f, 0xa0, 0x24, 0x82, 0x2f, 0xf2, 0x25, 0x6f, 0xac, 0xbe,
+    0x2e, 0x60, 0xa5, 0x0d, 0x21, 0xf4, 0xa1, 0x70, 0x2c, 0xe0, 0xae, 0xb3,
+    0x29, 0x3c, 0xa6, 0xa6, 0xac, 0x93, 0xac, 0xd0, 0x2d, 0x65, 0x29, 0x26,
+    0x2f, 0x2b, 0xb0, 0xd0, 0xb2, 0x70, 0xa0, 0x16, 0x29, 0x72, 0x32, 0xde,
+    0xaf, 0x4e, 0x22, 0x4f, 0xae, 0xc2, 0x2a, 0x59, 0xb2, 0xe6, 0x26, 0xc9,
+    0x30, 0xde, 0x2d, 0x19, 0x26, 0x75, 0xad, 0x7b, 0x2b, 0xcb, 0xa7, 0x8d,
+    0x28, 0x6b, 0x2e, 0xb5, 0x2c, 0xd5, 0x2c, 0x4a, 0xa8, 0x40, 0xab, 0xd7,
+    0x1d, 0x9e, 0xb2, 0x32, 0xa8, 0x17, 0x2f, 0xe6, 0x26, 0x1d, 0x28, 0x5b,
+    0xab, 0x5d, 0xb2, 0xb9, 0x2b, 0xa4, 0x25, 0x1c, 0xb1, 0xba, 0xaf, 0x4e,
+    0xac, 0x5b, 0xae, 0xe1, 0x32, 0xce, 0x24, 0x86, 0x2d, 0x8a, 0x26, 0x15,
+    0x2a, 0x65, 0x29, 0x96, 0x97, 0x67, 0x27, 0xf8, 0xad, 0xdb, 0x2e, 0x70,
+    0x26, 0x6f, 0x31, 0x05, 0x2c, 0x63, 0xb3, 0xc4, 0x29, 0xe7, 0x2c, 0x03,
+    0x9c, 0xe2, 0x2f, 0x45, 0xa6, 0x5e, 0xac, 0x36, 0xaf, 0x01, 0x29, 0x1f,
+    0xad, 0x36, 0xb0, 0x4a, 0x32, 0x21, 0xa1, 0x71, 0x22, 0x59, 0xa0, 0x4c,
+    0xac, 0x8c, 0x21, 0xf3, 0xa8, 0x21, 0x2b, 0x7a, 0x24, 0xc2, 0xb1, 0x39,
+    0x25, 0x4f, 0xac, 0x56, 0x2a, 0x52, 0x13, 0x2a, 0x2e, 0x3b, 0x2b, 0x44,
+    0x24, 0x87, 0x20, 0x8f, 0x2f, 0x22, 0x2d, 0x81, 0xa8, 0x7e, 0xad, 0xc4,
+    0xa8, 0x4b, 0x30, 0x00, 0xa4, 0x03, 0x29, 0xb9, 0x30, 0x20, 0x2d, 0x2a,
+    0xab, 0xeb, 0x2d, 0xa9, 0x2a, 0xf8, 0x81, 0x6c, 0x1d, 0x8f, 0xab, 0x7d,
+    0x30, 0x9b, 0x2c, 0xd9, 0x21, 0x6f, 0xac, 0x6f, 0xac, 0x31, 0xb0, 0x97,
+    0x2f, 0x0c, 0x2b, 0x68, 0x2e, 0xe6, 0x2f, 0x0d, 0x30, 0x02, 0x2e, 0x47,
+    0x28, 0xbf, 0xac, 0xb2, 0x26, 0xc2, 0xa4, 0xa0, 0x29, 0x3c, 0x31, 0xd5,
+    0xa8, 0x4b, 0xaa, 0xd2, 0xac, 0x6f, 0x26, 0x7f, 0xae, 0x31, 0x2e, 0xad,
+    0x26, 0xb8, 0xab, 0x0c, 0x23, 0xc7, 0xa9, 0xba, 0xa4, 0xc5, 0x21, 0x3b,
+    0x2a, 0x27, 0x2e, 0x38, 0xae, 0x58, 0x22, 0xbc, 0xa9, 0xec, 0x2b, 0xa5,
+    0xaf, 0xc2, 0xaa, 0x28, 0x25, 0xa3, 0xac, 0x86, 0x28, 0x65, 0xb0, 0x2e,
+    0x2f, 0x3a, 0xa9, 0x3d, 0xa8, 0x4a, 0xac, 0x94, 0x27, 0x4d, 0x2d, 0x03,
+    0xb0, 0x34, 0x15, 0x97, 0xb2, 0x50, 0xac, 0xab, 0x2f, 0x30, 0x2d, 0xe3,
+    0x2b, 0x0f, 0x30, 0x61, 0x9b, 0x2d, 0x90, 0xa7, 0xa8, 0x86, 0xa5, 0xd0,
+    0x2e, 0x1c, 0xb0, 0x35, 0xb0, 0xfd, 0xae, 0x41, 0xaf, 0x9a, 0xb0, 0x2d,
+    0xae, 0x43, 0xaf, 0xd2, 0x1b, 0xc0, 0x2b, 0x59, 0xa8, 0x3d, 0x2b, 0xe9,
+    0xa8, 0x6f, 0xac, 0x3f, 0x26, 0x2c, 0xb0, 0x26, 0xa8, 0xd6, 0x28, 0x08,
+    0x30, 0xce, 0xa9, 0xf0, 0xa4, 0x56, 0xb1, 0x7d, 0x27, 0x5b, 0xae, 0x0d,
+    0xa5, 0x5f, 0xad, 0x40, 0x9d, 0xd1, 0x23, 0x7c, 0xa7, 0xcc, 0xa0, 0xf5,
+    0x2e, 0xf1, 0xa8, 0x8a, 0x2b, 0x46, 0xaa, 0x4d, 0x2c, 0xd3, 0x25, 0x4e,
+    0x29, 0x3d, 0x28, 0xbd, 0xac, 0x63, 0x98, 0x3b, 0xa8, 0xe8, 0xac, 0x1c,
+    0x23, 0x9b, 0xa7, 0xfa, 0xae, 0xf9, 0x9e, 0x03, 0xa7, 0x82, 0xa3, 0xf2,
+    0x25, 0x95, 0x92, 0x24, 0x2d, 0x22, 0xaa, 0x3e, 0xb1, 0xf1, 0x24, 0x41,
+    0xb0, 0xb0, 0xa2, 0x0d, 0xa9, 0x5e, 0x9a, 0x49, 0x2c, 0xf8, 0x9c, 0x97,
+    0x2f, 0x2d, 0x29, 0x03, 0xa4, 0x85, 0xac, 0xa4, 0x2e, 0xd0, 0xa3, 0xd8,
+    0xac, 0x30, 0xa3, 0xa1, 0xad, 0x62, 0xb0, 0x6b, 0xb0, 0x11, 0xab, 0x89,
+    0xb0, 0x7e, 0x30, 0x22, 0xb1, 0xd7, 0x86, 0x28, 0x06, 0x86, 0x28, 0xa7,
+    0xaf, 0xf2, 0xad, 0x3e, 0xab, 0x77, 0x2a, 0x4c, 0x26, 0xbe, 0xae, 0xb5,
+    0xa5, 0x34, 0xaf, 0x37, 0x24, 0x20, 0xb2, 0xf8, 0xa4, 0x8a, 0xb0, 0x6e,
+    0xa8, 0x40, 0x2b, 0x2b, 0xac, 0x89, 0x29, 0x61, 0xa5, 0x70, 0x9b, 0x6a,
+    0x2c, 0xed, 0xaf, 0xa3, 0x2f, 0x36, 0x2c, 0xea, 0xa6, 0x52, 0x24, 0x97,
+    0xae, 0xfb, 0x29, 0x84, 0x1c, 0x8f, 0xa8, 0x5e, 0x2a, 0x90, 0x2d, 0x97,
+    0x2a, 0x87, 0xaf, 0x8b, 0xac, 0x1c, 0xab, 0x12, 0xab, 0x19, 0x2f, 0xda,
+    0x2b, 0x4b, 0xa4, 0x31, 0xaf, 0x63, 0xa1, 0xdc, 0xb0, 0x03, 0x2a, 0x4e,
+    0x28, 0xe0, 0x2c, 0x39, 0x28, 0xfa, 0xab, 0xd2, 0x2e, 0x33, 0xa4, 0xc5,
+    0x25, 0x93, 0xb0, 0x90, 0x26, 0x16, 0xb2, 0x72, 0xb1, 0x10, 0x9e, 0xe5,
+    0xa8, 0xc6, 0xac, 0x6b, 0xa6, 0xd7, 0xaf, 0x6f, 0x2c, 0x49, 0x2c, 0x24,
+    0xae, 0xaf, 0xa9, 0x2a, 0x9f, 0x29, 0xae, 0x6e, 0xb0, 0xc7, 0xae, 0x6f,
+    0xa0, 0x7d, 0xa9, 0xb7, 0xa8, 0x34, 0xb1, 0x1c, 0xac, 0x1f, 0xb0, 0xae,
+    0xad, 0x2d, 0xad, 0x5b, 0xa7, 0x74, 0xa9, 0x2a, 0xae, 0xff, 0x2f, 0xd3,
+    0x2e, 0x76, 0xac, 0xf9, 0xa6, 0xb5, 0xaf, 0xc6, 0x2c, 0x32, 0x2c, 0x3d,
+    0x31, 0x23, 0x2a, 0x9b, 0x33, 0x4c, 0x9d, 0xa0, 0xa4, 0x1d, 0xae, 0x66,
+    0xa9, 0x01, 0xa1, 0xa4, 0xa4, 0xd4, 0x25, 0x57, 0x2d, 0x46, 0x15, 0x47,
+    0xb0, 0x79, 0x2d, 0xb1, 0xae, 0x98, 0xa7, 0x84, 0xac, 0xff, 0xae, 0x53,
+    0xb1, 0xfa, 0x2e, 0x35, 0xae, 0xa6, 0x25, 0x16, 0x27, 0x66, 0x30, 0x36,
+    0xaa, 0xd5, 0x2a, 0xa3, 0x29, 0xc9, 0x31, 0xb6, 0x24, 0x9c, 0xa3, 0xc4,
+    0x2b, 0x60, 0xa9, 0x13, 0xa3, 0x4f, 0xa9, 0x98, 0x25, 0x6f, 0xb0, 0xab,
+    0x2d, 0x94, 0xa6, 0x0b, 0xae, 0xe8, 0x2c, 0xe2, 0xa5, 0xb4, 0xaa, 0xde,
+    0x28, 0xc9, 0x2a, 0xd9, 0xa3, 0x3a, 0xaa, 0x46, 0xa9, 0xa7, 0xb0, 0x96,
+    0xb0, 0x27, 0xaa, 0x5e, 0xae, 0x97, 0xb0, 0x3d, 0xae, 0x3d, 0x1f, 0xc5,
+    0xa3, 0x48, 0x1f, 0x19, 0xa9, 0x93, 0x2d, 0xa3, 0x24, 0x8c, 0x28, 0x91,
+    0xb0, 0x5e, 0xb1, 0xba, 0x2d, 0x54, 0xa6, 0x8c, 0xa8, 0x49, 0x30, 0x0d,
+    0xaa, 0x14, 0x28, 0x33, 0x27, 0x3b, 0x32, 0xed, 0xb0, 0x47, 0x2a, 0x9a,
+    0xa5, 0xa4, 0xae, 0x5f, 0xa4, 0x6f, 0xaf, 0x39, 0x2c, 0x99, 0x30, 0xda,
+    0xab, 0x33, 0xac, 0x02, 0x2a, 0x5e, 0x2c, 0x4d, 0xb1, 0x9f, 0xa5, 0xf2,
+    0x22, 0xed, 0x2d, 0x1b, 0x33, 0x7e, 0x2c, 0xe1, 0xad, 0x8d, 0xa9, 0xe9,
+    0x28, 0x5e, 0x2a, 0x01, 0x8e, 0x8d, 0xad, 0x25, 0x2d, 0x3e, 0x2c, 0x6f,
+    0xac, 0x53, 0xb1, 0x4f, 0x2c, 0x58, 0xac, 0xee, 0x27, 0x0d, 0x22, 0x0a,
+    0x2c, 0xf8, 0xad, 0x65, 0x28, 0x82, 0x22, 0x2c, 0x25, 0xd3, 0x27, 0xf0,
+    0x2c, 0x42, 0xac, 0x90, 0xac, 0x6b, 0xa4, 0x2b, 0xab, 0x61, 0x27, 0x92,
+    0x2f, 0xe8, 0xae, 0xf5, 0xa9, 0x24, 0xa8, 0xcc, 0xa3, 0xc1, 0x2d, 0x0b,
+    0xa5, 0x6c, 0xa9, 0x88, 0x2c, 0xf9, 0x29, 0xfc, 0xad, 0x27, 0xa4, 0x3f,
+    0x24, 0xa9, 0x29, 0xc1, 0x2e, 0x6b, 0x35, 0xe0, 0xad, 0x73, 0x2d, 0x80,
+    0x2c, 0xf9, 0x2b, 0x23, 0xb0, 0x72, 0x29, 0x8d, 0xb0, 0xbe, 0x28, 0x35,
+    0xb2, 0x8d, 0x18, 0xe4, 0x2a, 0xc8, 0x30, 0xe2, 0x2f, 0xf2, 0x2e, 0x5c,
+    0x2e, 0x50, 0x2d, 0xa2, 0xb1, 0x46, 0xaa, 0x41, 0x2c, 0x21, 0xa0, 0xe7,
+    0x35, 0xf4, 0x30, 0xfc, 0x30, 0x2a, 0xa2, 0xdf, 0x16, 0x85, 0x30, 0x1d,
+    0x31, 0x2c, 0x21, 0x44, 0xa5, 0x34, 0xac, 0x8e, 0xb0, 0x6d, 0xa4, 0x13,
+    0xac, 0xa3, 0xa4, 0x7f, 0x2a, 0x78, 0xae, 0xa4, 0xae, 0x27, 0xa0, 0x32,
+    0x30, 0x4b, 0x2a, 0x2e, 0xae, 0x79, 0xac, 0x0a, 0x2b, 0xdb, 0xad, 0x58,
+    0xac, 0x3f, 0xa8, 0x01, 0x28, 0x0e, 0x25, 0x2f, 0x30, 0x71, 0xad, 0xd9,
+    0x25, 0x3e, 0xae, 0xb9, 0xac, 0x2a, 0xac, 0x56, 0xaa, 0xb5, 0x2b, 0x2c,
+    0x25, 0x3b, 0xae, 0xf6, 0x2b, 0x76, 0xb2, 0x5c, 0x2c, 0x2b, 0x2b, 0x98,
+    0xad, 0x78, 0xa5, 0x9a, 0x23, 0xac, 0xb1, 0x22, 0xb0, 0x17, 0x31, 0xa0,
+    0x32, 0xc4, 0xaa, 0x2c, 0xa4, 0xee, 0xad, 0x94, 0xb0, 0xfb, 0x2c, 0xd3,
+    0x2c, 0x75, 0xb5, 0x14, 0xb0, 0x29, 0x2c, 0xbb, 0xb0, 0xa2, 0xac, 0x1e,
+    0xab, 0x75, 0xa2, 0x70, 0x25, 0x94, 0x30, 0xfa, 0xac, 0x10, 0x25, 0x31,
+    0xac, 0x99, 0x1d, 0xcd, 0x28, 0xe5, 0x24, 0x97, 0xa5, 0xb9, 0x25, 0x33,
+    0x2d, 0xc6, 0x1c, 0xc7, 0xae, 0x9a, 0x2c, 0x7a, 0xb0, 0x80, 0xac, 0x7c,
+    0xb1, 0x03, 0x30, 0x90, 0xae, 0x5d, 0xa8, 0xf6, 0xaa, 0xdb, 0xa4, 0x2d,
+    0xac, 0x1f, 0x2c, 0x5c, 0x2b, 0x1c, 0x31, 0x4c, 0xa6, 0x7f, 0xae, 0x28,
+    0xac, 0x7f, 0xae, 0x1c, 0x20, 0x2d, 0xb1, 0xf8, 0xad, 0x7c, 0xab, 0x94,
+    0xb0, 0x5b, 0xaf, 0xb6, 0xac, 0xa9, 0xad, 0x86, 0x27, 0x8f, 0xaf, 0x3a,
+    0x2d, 0x63, 0xad, 0x02, 0x30, 0x73, 0x23, 0xfc, 0x2a, 0x0e, 0x23, 0xff,
+    0x1a, 0x93, 0xb1, 0x10, 0x1b, 0xd9, 0x30, 0x56, 0x30, 0xed, 0x1f, 0x7e,
+    0x22, 0xf2, 0xaf, 0x0c, 0x18, 0x06, 0xb0, 0x4e, 0x9f, 0x5f, 0xb0, 0x2f,
+    0xb2, 0xe6, 0xad, 0xf9, 0x24, 0xaa, 0x9c, 0x73, 0x9f, 0xa3, 0xab, 0xce,
+    0xae, 0x34, 0x2f, 0xf6, 0xa8, 0x1c, 0x2e, 0xbb, 0x29, 0xe9, 0x31, 0xc8,
+    0xa9, 0xd7, 0x29, 0x6b, 0xa5, 0x87, 0xad, 0x9c, 0x29, 0xaa, 0xab, 0x7a,
+    0xac, 0xf4, 0xb0, 0x4c, 0xaf, 0xac, 0xa5, 0xd2, 0xa9, 0x11, 0x29, 0xd4,
+    0xac, 0x0d, 0x95, 0xfb, 0x2e, 0x42, 0xa3, 0x0c, 0xb1, 0x28, 0x30, 0xfa,
+    0xa7, 0x70, 0x2a, 0xc0, 0x9b, 0x42, 0xa5, 0xa2, 0xaa, 0x4c, 0xac, 0xd2,
+    0xa8, 0xfd, 0xb0, 0x4c, 0xa7, 0x08, 0x28, 0x6b, 0xa9, 0x31, 0x1b, 0x66,
+    0xb0, 0xae, 0x2f, 0x6b, 0x1a, 0xbb, 0x9b, 0x41, 0xa3, 0xd8, 0xa7, 0x18,
+    0x2d, 0x79, 0xa2, 0x7f, 0x2c, 0x45, 0xac, 0x81, 0xa9, 0x96, 0xb2, 0x6d,
+    0xb1, 0x2b, 0x29, 0x1d, 0x2e, 0x76, 0xac, 0xd8, 0x2c, 0xbf, 0xac, 0x13,
+    0xae, 0x84, 0xa6, 0x39, 0xa3, 0x5a, 0xad, 0x0c, 0xa4, 0x99, 0x2c, 0x6f,
+    0xb1, 0x55, 0x22, 0xe0, 0x25, 0xeb, 0x2f, 0x3e, 0xb1, 0x01, 0x31, 0xb5,
+    0xb2, 0xad, 0x25, 0x71, 0xac, 0x1b, 0x29, 0x08, 0xb0, 0xfe, 0xae, 0x33,
+    0xb0, 0x1d, 0xa8, 0xb3, 0x20, 0x21, 0x28, 0xd3, 0xad, 0xad, 0xad, 0x25,
+    0xa4, 0x1f, 0xad, 0x4e, 0xac, 0xd6, 0x2a, 0x8f, 0xa6, 0x95, 0xa8, 0x17,
+    0xb2, 0x25, 0xac, 0x4f, 0x2a, 0xa1, 0xab, 0x8c, 0xa8, 0x40, 0x30, 0x5c,
+    0xa6, 0x4c, 0x18, 0x79, 0xab, 0x1b, 0xac, 0xdc, 0x29, 0xc3, 0xaf, 0x68,
+    0x1a, 0x73, 0xaf, 0x94, 0xaa, 0xd5, 0xa9, 0x4d, 0xa7, 0x58, 0x29, 0xcd,
+    0xad, 0x97, 0xa7, 0x7a, 0x2c, 0xf5, 0xab, 0xfa, 0x1f, 0xd7, 0xae, 0x04,
+    0xa9, 0x5f, 0xab, 0x88, 0x2c, 0x57, 0xaf, 0x30, 0xb1, 0xb3, 0x1c, 0x6f,
+    0x29, 0x69, 0x2a, 0xaf, 0x25, 0xfe, 0xab, 0x0f, 0xac, 0xaa, 0x2c, 0x57,
+    0xac, 0x7d, 0xb4, 0x03, 0xad, 0xa7, 0xa4, 0x70, 0xaf, 0x69, 0x26, 0x29,
+    0x2a, 0x24, 0xaa, 0xb0, 0xa9, 0x69, 0x2d, 0xa4, 0xa5, 0x92, 0x2c, 0xcd,
+    0xaf, 0x3a, 0x29, 0x69, 0xaa, 0x03, 0xa9, 0x24, 0xaa, 0x9a, 0xa0, 0xf7,
+    0x2a, 0xe3, 0xac, 0x37, 0xa6, 0xdb, 0xa1, 0x77, 0x24, 0x48, 0x21, 0x78,
+    0xb0, 0xf9, 0xa8, 0x9c, 0xa8, 0x2b, 0xaf, 0x11, 0x2c, 0xf5, 0x9d, 0x8a,
+    0xaf, 0x1a, 0x29, 0xc9, 0x2d, 0xb4, 0x2e, 0xc8, 0x1c, 0xb2, 0xad, 0x22,
+    0xad, 0x2f, 0x30, 0x4b, 0xae, 0x75, 0xaf, 0x7d, 0xa4, 0x14, 0xab, 0x77,
+    0xab, 0x9b, 0xa9, 0x03, 0xb0, 0xd9, 0xa4, 0xba, 0xaa, 0x7f, 0xae, 0x96,
+    0xae, 0x9f, 0xac, 0xc2, 0xa4, 0x2a, 0xb1, 0xdf, 0x2e, 0x20, 0xae, 0xc6,
+    0x26, 0xa6, 0xad, 0xd6, 0xb0, 0xdb, 0xad, 0x2d, 0x30, 0x15, 0x9e, 0x16,
+    0xa4, 0x4c, 0x9f, 0xb1, 0x29, 0xc9, 0x2c, 0xeb, 0x30, 0x28, 0xab, 0xec,
+    0x27, 0x60, 0x2e, 0xa4, 0xae, 0xaa, 0x1e, 0xdc, 0xaa, 0xa0, 0xaa, 0x95,
+    0xa9, 0x8c, 0x2b, 0xee, 0xa6, 0xf3, 0x2b, 0x5b, 0x2d, 0xb9, 0x30, 0xfa,
+    0xab, 0x46, 0xb0, 0x13, 0x21, 0x6f, 0x2e, 0xfa, 0x32, 0x73, 0xa9, 0x98,
+    0xaf, 0xae, 0xaf, 0x64, 0x1a, 0xa6, 0xaf, 0x5f, 0xb0, 0xd7, 0x20, 0x73,
+    0xac, 0x38, 0xae, 0xfb, 0x26, 0xa5, 0xa6, 0xcb, 0x2a, 0x19, 0xad, 0x64,
+    0x28, 0xdb, 0x31, 0xca, 0xa0, 0x15, 0xad, 0x9a, 0x24, 0xa0, 0xb0, 0x8c,
+    0xa4, 0x09, 0xae, 0x37, 0xa9, 0xb4, 0x2e, 0xb9, 0x27, 0x4c, 0xad, 0x96,
+    0xa1, 0x37, 0x9b, 0x7a, 0xab, 0x3a, 0xa7, 0x07, 0xaf, 0x0a, 0xad, 0x97,
+    0x24, 0xba, 0xa7, 0xc4, 0x29, 0x52, 0xad, 0xdd, 0xaa, 0xe3, 0xb1, 0x79,
+    0xb0, 0xdb, 0xa7, 0x1d, 0x28, 0x14, 0xa7, 0xa5, 0xad, 0x59, 0xb2, 0x1f,
+    0xa8, 0x19, 0xa4, 0xf3, 0x23, 0x0a, 0xb2, 0xe2, 0xa0, 0xb7, 0x9d, 0x59,
+    0xad, 0xf9, 0x99, 0xe8, 0x27, 0xdc, 0x2a, 0xf2, 0xaa, 0x5b, 0x2e, 0x43,
+    0xaf, 0x54, 0xad, 0xec, 0xac, 0x19, 0x2f, 0x3b, 0xaa, 0x33, 0xa4, 0x02,
+    0xa9, 0xe0, 0x29, 0x4d, 0x30, 0x7c, 0xa8, 0xf0, 0xac, 0xd4, 0xa1, 0xc5,
+    0x32, 0xab, 0xad, 0xdf, 0xae, 0x6b, 0x30, 0x87, 0xab, 0x4b, 0x34, 0xed,
+    0x22, 0xca, 0xaf, 0xdb, 0x20, 0x9b, 0x1c, 0x70, 0xaf, 0xaa, 0x25, 0x2f,
+    0xad, 0x85, 0xaa, 0xb3, 0xa3, 0x9e, 0xb1, 0x6e, 0xac, 0xc0, 0xa8, 0x4c,
+    0x2c, 0x82, 0xb3, 0xc9, 0x2a, 0xf5, 0xaf, 0xe9, 0x2b, 0x0d, 0x30, 0x9a,
+    0x9f, 0xe9, 0xb0, 0x06, 0x31, 0x05, 0xa8, 0x6b, 0x1a, 0x14, 0xb1, 0x65,
+    0x2d, 0x8c, 0xb3, 0x8e, 0x9a, 0x19, 0x2e, 0x15, 0xae, 0x30, 0xaa, 0x68,
+    0x29, 0xeb, 0x2b, 0xe6, 0xb1, 0xf7, 0xae, 0x59, 0xae, 0xdb, 0xa8, 0x4b,
+    0x2b, 0xa4, 0xa9, 0xb4, 0xa2, 0x13, 0x2e, 0xa1, 0xa2, 0xbc, 0xab, 0x78,
+    0x30, 0x14, 0x1b, 0x98, 0xa9, 0x49, 0xb1, 0xf7, 0xaa, 0xe6, 0x1e, 0x54,
+    0xac, 0x39, 0x31, 0x34, 0x26, 0x60, 0xa0, 0xe4, 0x30, 0xa0, 0xab, 0x3a,
+    0x31, 0xfe, 0xac, 0x29, 0x2d, 0x10, 0xb1, 0x59, 0x30, 0x03, 0xab, 0xa1,
+    0xb2, 0x88, 0xb0, 0xc6, 0xad, 0x75, 0xb1, 0x40, 0x31, 0x34, 0x0c, 0x37,
+    0x29, 0xd5, 0x2c, 0x50, 0x28, 0x1b, 0x26, 0xf7, 0x1d, 0xbe, 0xb0, 0x8c,
+    0xaf, 0x57, 0xa3, 0x2f, 0x2c, 0xa0, 0x2e, 0x2d, 0x28, 0x2e, 0xb0, 0x87,
+    0x2e, 0x06, 0xab, 0xd1, 0x21, 0x4a, 0x31, 0x00, 0x30, 0x2f, 0xac, 0xae,
+    0xac, 0x94, 0x25, 0x93, 0x1a, 0x83, 0xae, 0xff, 0x2c, 0x87, 0xad, 0x44,
+    0x30, 0xae, 0x21, 0x58, 0xac, 0x8d, 0xa6, 0x96, 0x27, 0xeb, 0x2e, 0xaf,
+    0xaf, 0x1d, 0xac, 0xd2, 0xaa, 0x44, 0xb3, 0x61, 0x21, 0x3b, 0x30, 0xc3,
+    0x27, 0x05, 0x32, 0x66, 0x21, 0x0b, 0x20, 0x4a, 0x28, 0x56, 0x30, 0x9c,
+    0xb1, 0x69, 0xaf, 0x6f, 0xb1, 0x54, 0xa9, 0x13, 0xb0, 0x47, 0x2e, 0x26,
+    0x29, 0x6b, 0xae, 0x79, 0xac, 0xbb, 0xb1, 0x4f, 0x30, 0xb8, 0x26, 0x3b,
+    0x29, 0x1e, 0xb0, 0x5f, 0xae, 0x52, 0x28, 0x4f, 0x19, 0x56, 0x29, 0x48,
+    0xae, 0xfa, 0xb1, 0x43, 0x33, 0x34, 0xaa, 0xb9, 0x28, 0x40, 0xa8, 0xdf,
+    0x2d, 0x9c, 0x2a, 0x7e, 0x26, 0x9c, 0xb2, 0x2c, 0x28, 0x2a, 0x25, 0xa6,
+    0x26, 0x42, 0x2e, 0x94, 0xaf, 0x45, 0xb2, 0x2a, 0x02, 0x36, 0x2a, 0xe1,
+    0x2f, 0xd4, 0x31, 0xb6, 0x2d, 0x20, 0x24, 0x11, 0x33, 0x47, 0xaf, 0xee,
+    0x22, 0x57, 0xb0, 0x2e, 0x31, 0x6b, 0xad, 0xf6, 0x2b, 0x3a, 0x20, 0xca,
+    0xb0, 0x42, 0xa6, 0x57, 0x2a, 0x91, 0x29, 0x33, 0xae, 0xa4, 0xaf, 0xfa,
+    0xab, 0xc8, 0xab, 0x8b, 0xb3, 0xde, 0xa8, 0xfc, 0xa3, 0xc0, 0x2c, 0xd2,
+    0x8c, 0x9d, 0xa1, 0xb8, 0x2c, 0xe5, 0xa5, 0x69, 0xaa, 0x09, 0xb2, 0x5a,
+    0x2b, 0xb1, 0xac, 0x95, 0xa7, 0xc0, 0x2f, 0xf9, 0x24, 0xcf, 0x2b, 0x01,
+    0x2a, 0x62, 0xa7, 0xa7, 0x2d, 0x9f, 0x22, 0x8f, 0x23, 0x16, 0xb1, 0xf7,
+    0xab, 0xca, 0x25, 0x7b, 0xa5, 0x87, 0x8a, 0x1d, 0xaa, 0x52, 0xaa, 0xfa,
+    0x23, 0xa0, 0x2c, 0xef, 0x31, 0xbd, 0x92, 0x5f, 0x2e, 0xae, 0x31, 0xae,
+    0xac, 0x53, 0xb0, 0x5a, 0x22, 0x6c, 0x30, 0xdd, 0x32, 0xb9, 0x28, 0x3d,
+    0xb1, 0x8c, 0xb0, 0x1a, 0x28, 0xa6, 0xa5, 0xe2, 0x31, 0x8a, 0x33, 0x30,
+    0x28, 0x12, 0x98, 0xb3, 0x33, 0xbd, 0xae, 0x20, 0x2a, 0x8e, 0xb3, 0x45,
+    0x30, 0x26, 0xa8, 0xf5, 0x2f, 0x0b, 0x18, 0x2e, 0xac, 0xfd, 0x22, 0x78,
+    0xa1, 0x18, 0xa6, 0x3a, 0xa8, 0xe0, 0xb1, 0xc3, 0xae, 0x4f, 0xb1, 0xe5,
+    0xa8, 0xec, 0x24, 0x43, 0xa8, 0x9e, 0x31, 0x8e, 0x9a, 0x37, 0xae, 0x22,
+    0x2b, 0x23, 0x29, 0xb0, 0xac, 0x3b, 0xa8, 0xcf, 0xa9, 0xc4, 0x2d, 0x07,
+    0x28, 0x2b, 0xa9, 0x21, 0xac, 0xe6, 0xac, 0x01, 0x32, 0xfc, 0xae, 0x63,
+    0x30, 0x95, 0x2e, 0x0e, 0x33, 0xac, 0xb2, 0xe8, 0xa4, 0xfe, 0xa4, 0x54,
+    0xae, 0x4b, 0x99, 0x3c, 0xb1, 0x52, 0xb0, 0x0a, 0x30, 0x4c, 0xa5, 0x99,
+    0x2c, 0x01, 0x24, 0xaa, 0x11, 0x95, 0x28, 0x89, 0xa7, 0xd9, 0xb0, 0x3f,
+    0xa7, 0x3f, 0xad, 0xe0, 0x9c, 0x9e, 0x29, 0x11, 0xaf, 0x51, 0xaa, 0xa1,
+    0x2d, 0x2d, 0xad, 0x5d, 0x2b, 0x61, 0x31, 0xcf, 0xac, 0xc7, 0xb0, 0x83,
+    0x29, 0x92, 0xad, 0x55, 0x2c, 0x26, 0xa8, 0x64, 0x2c, 0xb1, 0xac, 0x38,
+    0x2a, 0x3f, 0x32, 0x90, 0xa9, 0xb2, 0x28, 0xb9, 0x24, 0xa2, 0x2c, 0xdb,
+    0xb0, 0xbb, 0xac, 0x4d, 0xaa, 0x74, 0xb2, 0x4d, 0x2e, 0x4d, 0xa0, 0xb0,
+    0xad, 0xea, 0x31, 0xb0, 0xa5, 0x55, 0xa8, 0x98, 0xa6, 0x95, 0x2a, 0x9d,
+    0x28, 0xad, 0xab, 0x1b, 0x28, 0x88, 0x31, 0xd8, 0xaa, 0x22, 0x27, 0x9b,
+    0x2e, 0x8f, 0x2a, 0x80, 0x27, 0x77, 0xab, 0x29, 0xad, 0x90, 0xa4, 0x9d,
+    0xaa, 0xd4, 0xa8, 0x23, 0xad, 0x20, 0xac, 0x02, 0xb0, 0x9b, 0xb0, 0x69,
+    0xae, 0xae, 0xb2, 0xd8, 0x25, 0xcd, 0x2c, 0x7f, 0x32, 0xc0, 0x27, 0x49,
+    0x2c, 0x22, 0xac, 0x56, 0xaa, 0x01, 0xb2, 0x4c, 0xa0, 0xb3, 0x2c, 0xd3,
+    0x2f, 0xa4, 0x20, 0x45, 0xb0, 0x05, 0xb3, 0xa8, 0xa5, 0xe9, 0xac, 0x15,
+    0x2c, 0x8e, 0x28, 0x51, 0x2d, 0x2e, 0xb1, 0x20, 0xac, 0x9c, 0xad, 0xae,
+    0x29, 0xf0, 0xb1, 0x19, 0x2c, 0xf6, 0xa5, 0xe9, 0x2d, 0xd3, 0x30, 0xa9,
+    0xac, 0x9e, 0x30, 0x3e, 0xaf, 0xeb, 0x26, 0xbc, 0xa4, 0xf4, 0xb3, 0x8d,
+    0xae, 0x73, 0xb5, 0x12, 0xa9, 0x77, 0x2d, 0xc6, 0xad, 0xef, 0x2f, 0x5e,
+    0x2e, 0x66, 0x1f, 0xa6, 0xa9, 0x50, 0x31, 0x0b, 0x32, 0x06, 0xb3, 0x21,
+    0xa9, 0x15, 0x30, 0x69, 0x29, 0xa0, 0x29, 0x6b, 0x2f, 0x38, 0x2a, 0x00,
+    0x30, 0xe2, 0xa8, 0x32, 0x32, 0xe7, 0xa7, 0xf5, 0x28, 0xd5, 0xb0, 0xa4,
+    0xb2, 0x27, 0x1e, 0x25, 0xae, 0xbd, 0xb1, 0x87, 0xb2, 0x92, 0xad, 0x21,
+    0x28, 0x70, 0x30, 0xec, 0xac, 0xa8, 0xa4, 0x02, 0x2b, 0x6b, 0x1f, 0x21,
+    0xac, 0xc6, 0xb1, 0xfc, 0x28, 0xee, 0x2c, 0xbf, 0x31, 0xce, 0xac, 0x45,
+    0xb4, 0x8d, 0xac, 0x0b, 0xad, 0xd9, 0x2d, 0x15, 0x26, 0x0f, 0xaa, 0xc1,
+    0x29, 0xed, 0xa7, 0x18, 0x2f, 0xbe, 0xaa, 0x51, 0xac, 0x7e, 0xaa, 0x80,
+    0xa5, 0x45, 0x30, 0xff, 0xa8, 0xe7, 0x9f, 0x8f, 0xad, 0x76, 0x23, 0xde,
+    0x2b, 0x31, 0xa7, 0x13, 0x32, 0x14, 0xad, 0xf0, 0xa9, 0x98, 0xa3, 0x43,
+    0x28, 0x2d, 0xab, 0xd7, 0xac, 0xf0, 0x25, 0xaa, 0xab, 0x95, 0xa8, 0xe5,
+    0x1f, 0x31, 0xa9, 0x63, 0xa0, 0xd6, 0x32, 0x24, 0x25, 0x01, 0x26, 0x03,
+    0x23, 0xf4, 0x95, 0xbe, 0xa7, 0x45, 0x2d, 0xc3, 0xb2, 0x94, 0x31, 0x9d,
+    0xa0, 0xea, 0xab, 0xbe, 0x1f, 0xdb, 0xae, 0xb6, 0xaf, 0xcf, 0x28, 0x6b,
+    0xa8, 0x5f, 0x2a, 0xd9, 0xb0, 0x7a, 0x31, 0x5c, 0xb3, 0xf7, 0xaf, 0x94,
+    0x9d, 0xd3, 0x2a, 0xfc, 0xaf, 0xf3, 0x1e, 0xa3, 0x8c, 0x75, 0xaf, 0x3d,
+    0x16, 0x71, 0xad, 0x23, 0xb1, 0x9d, 0xb1, 0x37, 0x2b, 0x4b, 0xae, 0x94,
+    0xaf, 0x5f, 0x27, 0xbc, 0xa0, 0x7a, 0x27, 0x54, 0xa6, 0xba, 0xae, 0x70,
+    0xad, 0xa2, 0x17, 0x1a, 0x2f, 0x35, 0xad, 0x58, 0x29, 0x8c, 0x2e, 0x1b,
+    0xaa, 0x0b, 0xaf, 0xfc, 0xa8, 0xee, 0x26, 0xea, 0x29, 0x05, 0xac, 0xc2,
+    0x2d, 0x47, 0xaf, 0xe1, 0x13, 0x27, 0x26, 0x8e, 0xa8, 0x6d, 0x2a, 0x32,
+    0x1d, 0xfb, 0xa6, 0xdc, 0xa1, 0x05, 0x28, 0xba, 0x9f, 0x0e, 0x21, 0x15,
+    0x9d, 0x62, 0xa2, 0x3b, 0xa7, 0xc8, 0xaa, 0x63, 0x2a, 0x2e, 0x2c, 0xef,
+    0xa9, 0x4d, 0x2f, 0xf9, 0x2b, 0x76, 0x2d, 0x73, 0x2a, 0xcc, 0x1e, 0x28,
+    0xb0, 0x62, 0xab, 0x82, 0xaa, 0xd2, 0x29, 0xd6, 0xa6, 0x31, 0x9d, 0x75,
+    0x9b, 0x1f, 0x33, 0x5a, 0xb0, 0xca, 0xa8, 0x88, 0xad, 0x27, 0xae, 0xcc,
+    0x29, 0x61, 0xac, 0x99, 0xa4, 0xbe, 0x97, 0x21, 0xab, 0x6d, 0xaf, 0xb7,
+    0xac, 0x91, 0x20, 0xab, 0x9d, 0x2b, 0xa6, 0x3f, 0x9d, 0x98, 0x2a, 0xf4,
+    0x29, 0x50, 0xa9, 0xbc, 0xa0, 0xf3, 0xa5, 0xbd, 0x2b, 0x98, 0x25, 0xb8,
+    0xad, 0xe9, 0xb0, 0x1e, 0xac, 0x96, 0x2d, 0x9c, 0xb0, 0x44, 0xa7, 0x74,
+    0x2c, 0xcf, 0xa4, 0x8a, 0x2b, 0xf7, 0xa5, 0x1c, 0x31, 0x83, 0xac, 0xe4,
+    0xab, 0x2d, 0x9e, 0x8d, 0x24, 0x50, 0xb1, 0x11, 0xa8, 0xe4, 0xa9, 0x07,
+    0xaf, 0x31, 0x2a, 0x92, 0x2b, 0x24, 0x2d, 0xaf, 0xb0, 0x71, 0x34, 0x09,
+    0xac, 0x84, 0xb0, 0x5c, 0xa8, 0x09, 0x29, 0x51, 0x2e, 0x2f, 0x2a, 0x68,
+    0xaf, 0x5e, 0xac, 0xf4, 0x29, 0x8e, 0x29, 0x0a, 0xb2, 0x81, 0x24, 0x92,
+    0x2c, 0x84, 0x2e, 0x15, 0x25, 0xfe, 0x2b, 0xa2, 0xa4, 0x66, 0x32, 0x90,
+    0x2a, 0x95, 0xac, 0xa7, 0xa6, 0xa1, 0x28, 0x99, 0x11, 0x76, 0x2e, 0x2d,
+    0xa1, 0x4b, 0x24, 0xe4, 0xac, 0x6a, 0xa9, 0x03, 0xb0, 0x7a, 0xa2, 0x82,
+    0x30, 0xd7, 0x28, 0x65, 0x2b, 0xed, 0x30, 0x60, 0xab, 0x74, 0xa7, 0xbd,
+    0xa0, 0xfb, 0xad, 0x7a, 0x2d, 0xa3, 0xa8, 0x89, 0x9c, 0xcc, 0x1f, 0x24,
+    0xa2, 0xaf, 0x2a, 0xf8, 0x29, 0xf4, 0xa1, 0x9c, 0x23, 0x46, 0x28, 0xdc,
+    0x29, 0x2d, 0xa2, 0x9f, 0x30, 0xd3, 0xad, 0x19, 0xb0, 0x8b, 0xa1, 0x99,
+    0x2b, 0xe0, 0xb2, 0xc1, 0xa9, 0x14, 0x21, 0x1b, 0x9b, 0xff, 0xad, 0x78,
+    0xaa, 0xd7, 0xaa, 0xc8, 0xac, 0x89, 0x26, 0x8a, 0xae, 0x8c, 0xa4, 0x15,
+    0x2b, 0x27, 0x21, 0x9b, 0xae, 0x6d, 0x2d, 0x6d, 0xaa, 0x87, 0x1f, 0x98,
+    0x26, 0x98, 0xa8, 0x63, 0xac, 0x59, 0x24, 0x6e, 0xa8, 0x28, 0x2c, 0xf3,
+    0xad, 0xa1, 0x31, 0xd7, 0xb1, 0xd0, 0x29, 0x7f, 0xb1, 0x94, 0x9e, 0x5f,
+    0xaf, 0x3c, 0xa9, 0x03, 0xac, 0x56, 0xaa, 0x0a, 0x26, 0x64, 0x1e, 0x13,
+    0xaf, 0x4c, 0x2d, 0x3f, 0xa5, 0x1b, 0x1e, 0x05, 0x2c, 0x9f, 0xae, 0x31,
+    0x29, 0x8a, 0xa6, 0xaa, 0xad, 0x81, 0x26, 0xce, 0x29, 0x13, 0xac, 0xde,
+    0xab, 0x14, 0x2e, 0x90, 0xad, 0x8b, 0xa2, 0xe6, 0x24, 0xd0, 0x24, 0x51,
+    0xad, 0x06, 0x2b, 0x95, 0xa2, 0x57, 0xab, 0xc4, 0x30, 0xb7, 0x26, 0x6a,
+    0xa1, 0x09, 0xa4, 0x82, 0xb0, 0xbc, 0x29, 0xfc, 0x28, 0x4e, 0x2c, 0xa4,
+    0xaa, 0x30, 0x20, 0x9b, 0xaf, 0xae, 0xaf, 0x6e, 0x2e, 0xc7, 0x27, 0xb7,
+    0xb0, 0x50, 0x30, 0x5b, 0xb1, 0xc6, 0x24, 0xe2, 0x26, 0x1d, 0xac, 0x51,
+    0xa9, 0x71, 0x2b, 0x30, 0x23, 0x26, 0xa9, 0x58, 0x9e, 0x3c, 0xac, 0x69,
+    0xb0, 0x0c, 0x25, 0x4c, 0xa4, 0x78, 0x28, 0x83, 0xaa, 0x35, 0x2a, 0x74,
+    0x25, 0x6d, 0x18, 0xde, 0x29, 0x6e, 0xac, 0x15, 0x9e, 0xea, 0xae, 0xab,
+    0x26, 0x0b, 0x28, 0x0b, 0xac, 0x37, 0x2c, 0x5d, 0xab, 0xe4, 0xaa, 0x9a,
+    0xaa, 0x33, 0xab, 0x0e, 0xa0, 0xb8, 0x2d, 0x6b, 0xaa, 0x08, 0x2b, 0xe4,
+    0x2b, 0x3c, 0x33, 0x0c, 0x2e, 0x40, 0xb0, 0x53, 0xaa, 0xfc, 0x2c, 0x43,
+    0xa8, 0x5c, 0x2a, 0xd8, 0xac, 0x15, 0xa8, 0x59, 0x2d, 0x12, 0xa4, 0xb8,
+    0x22, 0xa8, 0xac, 0x31, 0x2d, 0x73, 0xae, 0x65, 0xab, 0x5b, 0xa8, 0x50,
+    0xa0, 0x48, 0x9d, 0x30, 0xa5, 0x4b, 0xb1, 0x64, 0x9e, 0x81, 0x24, 0xef,
+    0xb3, 0x6f, 0xa9, 0x7d, 0x2f, 0x2b, 0xae, 0x5c, 0x9a, 0x93, 0x31, 0xbb,
+    0xaf, 0xbb, 0xab, 0x9b, 0xa5, 0xb3, 0x20, 0x1d, 0xa4, 0x1c, 0x20, 0x0b,
+    0xaf, 0x71, 0x2d, 0xf8, 0x2c, 0x0b, 0x8d, 0x4b, 0xaf, 0x71, 0xa7, 0x88,
+    0x2c, 0x0c, 0x2f, 0xad, 0x28, 0x87, 0xa5, 0x27, 0xae, 0x90, 0x2a, 0xa9,
+    0x21, 0x02, 0xb2, 0x29, 0x2a, 0xed, 0x27, 0xff, 0x26, 0x03, 0xa6, 0x75,
+    0x1d, 0xce, 0x2c, 0x8a, 0xb0, 0x39, 0xb4, 0xf1, 0xad, 0xda, 0x24, 0xd2,
+    0x31, 0x10, 0xaa, 0x89, 0x2e, 0x80, 0x26, 0xf3, 0xa1, 0x5b, 0x2d, 0x56,
+    0xa6, 0xc3, 0xb3, 0x87, 0x31, 0xc7, 0x26, 0xcb, 0x12, 0x14, 0xa1, 0x85,
+    0x34, 0x17, 0x28, 0x70, 0x30, 0x38, 0x31, 0x6f, 0x25, 0x01, 0xb3, 0xd5,
+    0xad, 0xe0, 0x22, 0xc3, 0x2e, 0x40, 0xac, 0x3c, 0x30, 0x35, 0xb3, 0x1b,
+    0xae, 0x8c, 0x30, 0xa7, 0x28, 0x38, 0x32, 0x29, 0xab, 0x5b, 0x27, 0x65,
+    0x28, 0x48, 0x2e, 0x8c, 0xb0, 0x69, 0xab, 0xc4, 0x21, 0x1d, 0xad, 0xf4,
+    0xa8, 0x2a, 0xab, 0xf0, 0x26, 0xbe, 0x2e, 0x76, 0xb1, 0x7a, 0x2f, 0x50,
+    0x2b, 0xdb, 0x29, 0xac, 0x2c, 0xf2, 0xb3, 0x05, 0xa1, 0xc3, 0xa9, 0x06,
+    0xb0, 0x81, 0x2c, 0xbe, 0xa8, 0x72, 0x33, 0x64, 0xb2, 0xfb, 0x9f, 0x2b,
+    0x2f, 0xb8, 0xa7, 0x41, 0xaf, 0xeb, 0xa9, 0x3e, 0xaf, 0x05, 0xac, 0x00,
+    0x2b, 0x88, 0x29, 0x27, 0xb2, 0x02, 0xa3, 0x4c, 0x2f, 0x44, 0xb1, 0xb9,
+    0x2e, 0x33, 0x2c, 0x7a, 0x2f, 0x2e, 0x30, 0x50, 0xb2, 0xd2, 0x29, 0x89,
+    0x32, 0x7d, 0xb2, 0xb1, 0x2c, 0x8d, 0xa3, 0x32, 0x32, 0x87, 0x24, 0x7e,
+    0x2e, 0x78, 0xac, 0xe0, 0xac, 0xf6, 0xaa, 0x63, 0xac, 0xfe, 0xa8, 0x35,
+    0x30, 0x55, 0xa7, 0xd8, 0x2f, 0xdc, 0xa9, 0xfa, 0xa9, 0x76, 0xb2, 0x45,
+    0xaf, 0xbe, 0x2b, 0x65, 0x2d, 0x30, 0xad, 0x84, 0xad, 0x56, 0x27, 0x16,
+    0x2d, 0x2c, 0x2a, 0x44, 0xa9, 0xc4, 0x2b, 0x80, 0xac, 0x10, 0x2d, 0x25,
+    0x20, 0x41, 0x2c, 0x6c, 0xab, 0xa9, 0x30, 0x31, 0x30, 0x23, 0xa9, 0xe0,
+    0x2c, 0x24, 0x30, 0x81, 0x9f, 0xb4, 0xa9, 0x71, 0x24, 0x00, 0x30, 0x95,
+    0xb2, 0x90, 0x29, 0x99, 0xb1, 0x58, 0x30, 0x64, 0x2d, 0x60, 0xad, 0xbb,
+    0xaf, 0x32, 0xa7, 0x16, 0xb0, 0x67, 0xa7, 0x56, 0x2b, 0x42, 0x2a, 0xb5,
+    0xae, 0x81, 0xa7, 0xdd, 0xa8, 0xf7, 0x26, 0xdb, 0x30, 0x63, 0x9e, 0x12,
+    0x2e, 0x07, 0x99, 0x2b, 0x2a, 0x23, 0xab, 0x29, 0x2c, 0xa2, 0xb0, 0x8c,
+    0x2e, 0x8c, 0xac, 0x30, 0x29, 0xcf, 0x18, 0x77, 0x2c, 0x98, 0xb1, 0xab,
+    0xb1, 0x79, 0x13, 0xbb, 0xad, 0x2c, 0x22, 0xeb, 0xa4, 0x19, 0xac, 0x2a,
+    0x26, 0xcc, 0xa8, 0x61, 0x9e, 0x5d, 0xb0, 0x46, 0xa6, 0x1c, 0x27, 0xe7,
+    0xa8, 0x28, 0x14, 0x71, 0xaa, 0x53, 0xa4, 0x52, 0x1d, 0x54, 0x29, 0xbf,
+    0x28, 0x43, 0x2e, 0x76, 0xb0, 0xb7, 0x2f, 0xb0, 0x30, 0x94, 0xb1, 0x8d,
+    0x2c, 0x2f, 0x29, 0xbe, 0xa5, 0xdd, 0x26, 0xb0, 0xa6, 0x26, 0xad, 0xfd,
+    0xa4, 0x8f, 0x24, 0xa1, 0xa9, 0xb8, 0xaf, 0x85, 0xa2, 0x03, 0xb1, 0x3e,
+    0x33, 0x4a, 0xab, 0x23, 0x2d, 0x79, 0x2a, 0x86, 0xb0, 0xaa, 0x2b, 0x21,
+    0xb0, 0xe4, 0xac, 0x4f, 0xac, 0xe3, 0x2a, 0x5b, 0x28, 0x65, 0x2f, 0x6a,
+    0xb2, 0xb9, 0x2c, 0xdf, 0x2d, 0x00, 0xae, 0x77, 0x2f, 0x07, 0xad, 0x2f,
+    0x20, 0xb2, 0xad, 0x15, 0x28, 0xc8, 0x2c, 0xdc, 0xad, 0x1e, 0x2a, 0x8e,
+    0x2b, 0xc5, 0x2b, 0xd3, 0x26, 0x65, 0xaf, 0xb4, 0xb1, 0x4a, 0x2c, 0x5b,
+    0xa3, 0xa4, 0x32, 0x76, 0xad, 0xf9, 0x2f, 0x4c, 0x2a, 0x39, 0xad, 0x02,
+    0xaa, 0x1e, 0x2f, 0x8b, 0x2a, 0x08, 0x11, 0xe5, 0xa8, 0xda, 0xa6, 0xb7,
+    0x21, 0x81, 0xa8, 0x62, 0xaa, 0xe9, 0x2c, 0x36, 0x32, 0xac, 0xa6, 0x8d,
+    0x24, 0x7c, 0x25, 0x73, 0x28, 0xa6, 0xa6, 0xdf, 0x2f, 0xa4, 0xac, 0xcc,
+    0x2c, 0x1c, 0x2b, 0x19, 0x2f, 0x25, 0xa5, 0x35, 0x2a, 0x7d, 0x1e, 0xbd,
+    0xae, 0x37, 0xad, 0x9a, 0x2f, 0x88, 0xaa, 0xd6, 0x30, 0xd6, 0x2d, 0x57,
+    0x21, 0xde, 0xad, 0x9a, 0x2d, 0x40, 0xa3, 0x5c, 0xa9, 0x6d, 0xac, 0x8b,
+    0xb1, 0xda, 0xa8, 0xbf, 0x2c, 0xff, 0x2f, 0x1d, 0xaa, 0x7a, 0x9e, 0xee,
+    0x2d, 0xbc, 0x30, 0xab, 0x26, 0x5e, 0x29, 0xb1, 0x2c, 0xd3, 0xaf, 0x6c,
+    0x2f, 0xb5, 0x2d, 0x02, 0x2a, 0x74, 0xa9, 0x20, 0xa4, 0x84, 0x30, 0x90,
+    0x2d, 0xc7, 0x30, 0xdc, 0xad, 0x23, 0xab, 0x52, 0xa8, 0xbe, 0x30, 0x06,
+    0x26, 0x3f, 0xaa, 0xfc, 0x2d, 0xd3, 0x1c, 0xe3, 0x22, 0x10, 0x2e, 0xbd,
+    0x28, 0x00, 0x33, 0x55, 0x20, 0x0e, 0x2d, 0xe2, 0x30, 0x60, 0x2e, 0xdc,
+    0x20, 0xb6, 0xac, 0xd8, 0x2c, 0xd0, 0xa0, 0xaf, 0xab, 0xe5, 0x25, 0x99,
+    0xa8, 0xc9, 0x2d, 0xec, 0x29, 0xad, 0xa4, 0x59, 0x34, 0xa4, 0x2b, 0x7f,
+    0xa9, 0x8a, 0xab, 0x1d, 0xa5, 0x4b, 0xac, 0x3b, 0xaa, 0xa3, 0x28, 0xd4,
+    0x2c, 0xf2, 0xa9, 0xaf, 0x31, 0x0d, 0x2d, 0x42, 0xa9, 0xed, 0x1a, 0x2b,
+    0x30, 0x54, 0x2c, 0x21, 0xa3, 0xbe, 0x2c, 0xf2, 0xac, 0x2c, 0x29, 0xe6,
+    0x26, 0xb4, 0x30, 0x99, 0x30, 0x7e, 0xa7, 0x39, 0xaf, 0x32, 0x2b, 0x8f,
+    0x21, 0x29, 0x26, 0x8c, 0x2b, 0xb3, 0x99, 0xe0, 0x27, 0x88, 0x2f, 0x85,
+    0x24, 0x14, 0xb0, 0xe6, 0x2f, 0xa1, 0xac, 0x6e, 0xad, 0x7a, 0x2e, 0x8a,
+    0xac, 0x0a, 0xa5, 0x91, 0x25, 0xe5, 0x28, 0xc9, 0x2e, 0x30, 0xb1, 0xac,
+    0xaa, 0xbe, 0xb3, 0x5b, 0xab, 0x4d, 0xaa, 0xe7, 0x27, 0xce, 0xad, 0x82,
+    0xa0, 0x43, 0xab, 0x81, 0x2a, 0xab, 0x25, 0x35, 0x2c, 0x18, 0xae, 0x3b,
+    0xb2, 0x2f, 0xae, 0x3c, 0x27, 0x11, 0xa6, 0x46, 0x2a, 0xc7, 0x30, 0x20,
+    0xa3, 0x79, 0xb3, 0xdb, 0x31, 0x78, 0x28, 0x31, 0x28, 0x14, 0xb0, 0x00,
+    0xad, 0xb0, 0xa1, 0xe4, 0x21, 0x5e, 0x2e, 0xe4, 0xaf, 0x7b, 0x2c, 0x47,
+    0xa3, 0xb9, 0x18, 0xc6, 0x11, 0xc1, 0x2a, 0xdd, 0xa4, 0xfb, 0xa8, 0x90,
+    0x26, 0x72, 0xaf, 0xb1, 0x30, 0x6e, 0x2a, 0x9f, 0x27, 0xf4, 0x28, 0xd1,
+    0xa4, 0x96, 0x29, 0x29, 0x2b, 0x8e, 0x2e, 0x29, 0xa9, 0x73, 0x2c, 0x54,
+    0x2d, 0x09, 0x2c, 0x45, 0x30, 0xa0, 0x29, 0x72, 0x20, 0x34, 0xa9, 0x88,
+    0x31, 0xc7, 0xa8, 0x7b, 0xab, 0xc0, 0xa5, 0x56, 0xaf, 0x82, 0x2d, 0xcd,
+    0x30, 0x5b, 0x2b, 0x3d, 0x21, 0x8b, 0xb1, 0xcb, 0xa4, 0x6b, 0xa8, 0x0f,
+    0x29, 0x1d, 0xa4, 0x3e, 0xac, 0x19, 0xaa, 0x9a, 0xa5, 0x33, 0xae, 0x63,
+    0x2c, 0x11, 0x30, 0x4d, 0xa9, 0xab, 0x29, 0xe7, 0xaa, 0x87, 0xad, 0x5e,
+    0xad, 0xc2, 0xa9, 0xf2, 0x25, 0xe6, 0x2e, 0x2f, 0x26, 0xe4, 0xa0, 0x56,
+    0xac, 0x1f, 0xaa, 0xb8, 0x23, 0x82, 0xad, 0x9d, 0x1f, 0x0c, 0xb0, 0x4b,
+    0xa4, 0x73, 0xac, 0x71, 0xaa, 0x7a, 0xad, 0xf8, 0x28, 0xe7, 0x21, 0x5f,
+    0x2d, 0xa8, 0x2a, 0x3d, 0x2e, 0xf4, 0xaa, 0xb4, 0xad, 0x5a, 0xb1, 0x02,
+    0xaa, 0x51, 0x2b, 0x7a, 0x30, 0x5e, 0xaf, 0xe1, 0x2e, 0xc7, 0xa4, 0xae,
+    0xb0, 0x2b, 0x22, 0xef, 0xa7, 0x1f, 0x30, 0xd7, 0xa7, 0x56, 0xb0, 0xd1,
+    0x28, 0xe2, 0xb1, 0x1a, 0x21, 0xc4, 0xa4, 0xf1, 0x21, 0xa2, 0xaf, 0xe8,
+    0xad, 0x36, 0xb0, 0x4a, 0xb2, 0x72, 0x31, 0x1b, 0x31, 0xea, 0x30, 0x01,
+    0x30, 0x9e, 0xa0, 0x9b, 0xac, 0xc2, 0xa8, 0x46, 0xad, 0x22, 0xb1, 0x8a,
+    0xa5, 0x54, 0x2d, 0x95, 0xac, 0x0d, 0x29, 0xfd, 0xac, 0x29, 0x1a, 0x4c,
+    0xa5, 0xdd, 0xa3, 0x40, 0xb2, 0x9a, 0xac, 0x8c, 0xad, 0x6c, 0x2e, 0x63,
+    0x2c, 0x7e, 0xa5, 0x94, 0xaa, 0x78, 0xab, 0x7a, 0x25, 0x3d, 0x9b, 0x33,
+    0xad, 0x02, 0xb0, 0x1c, 0xb0, 0x5e, 0xac, 0xe8, 0x28, 0x9b, 0xaf, 0xb0,
+    0xa8, 0x1c, 0xa5, 0xa3, 0xaa, 0x4d, 0xab, 0x38, 0x1b, 0x5d, 0xa8, 0xea,
+    0xa4, 0xb0, 0x2d, 0x0f, 0xae, 0x87, 0xb0, 0x9d, 0xab, 0x23, 0x86, 0x11,
+    0x2e, 0xa3, 0xa8, 0xd0, 0xa6, 0xde, 0xa9, 0x88, 0x27, 0x02, 0xaf, 0xd5,
+    0xb1, 0x75, 0x2c, 0xe0, 0xa8, 0x20, 0xb0, 0x7d, 0x25, 0xbf, 0xaf, 0x11,
+    0x31, 0x52, 0xa9, 0x45, 0x2f, 0x61, 0xa7, 0xe3, 0xa9, 0xea, 0xae, 0x5e,
+    0x9f, 0x56, 0x2f, 0x98, 0x29, 0x5a, 0x18, 0x7c, 0xb1, 0xfc, 0x30, 0x7c,
+    0xac, 0xd5, 0x2c, 0xe0, 0xa9, 0xba, 0xac, 0x97, 0x23, 0xa6, 0x2f, 0x5b,
+    0xac, 0xf8, 0xa6, 0xb4, 0xaa, 0x55, 0xa8, 0xfc, 0xad, 0xbf, 0x2c, 0xdd,
+    0x2d, 0xa0, 0x2b, 0x07, 0xae, 0xf2, 0x25, 0xef, 0xa0, 0x16, 0xab, 0x01,
+    0x27, 0xb8, 0xad, 0x02, 0x32, 0x7e, 0xae, 0x2f, 0x28, 0x28, 0xae, 0x0a,
+    0x2a, 0x60, 0xb0, 0x7e, 0xb2, 0x5e, 0xb1, 0x86, 0xa8, 0x0c, 0xb0, 0x15,
+    0x30, 0xe7, 0xa7, 0x32, 0xac, 0x90, 0x30, 0xe6, 0xad, 0x22, 0x2b, 0x04,
+    0xaf, 0x79, 0xac, 0x92, 0xa9, 0x42, 0x2e, 0xa5, 0x30, 0x3a, 0xa1, 0xdb,
+    0xa9, 0x04, 0xae, 0xdd, 0x2d, 0x7a, 0xa0, 0x82, 0xac, 0xbc, 0x30, 0x77,
+    0x22, 0x3f, 0xaf, 0xba, 0x2f, 0x5e, 0x30, 0xeb, 0x2c, 0x2d, 0xb0, 0x8d,
+    0x2b, 0x06, 0x33, 0xb0, 0xa4, 0x7d, 0x23, 0x32, 0xb2, 0x2c, 0x2c, 0x02,
+    0xa7, 0xeb, 0x1a, 0xf1, 0xac, 0xdb, 0xa9, 0x2c, 0xac, 0x5c, 0xac, 0x60,
+    0xb0, 0xe8, 0xa5, 0xe7, 0x27, 0xe7, 0xad, 0xc9, 0xac, 0xea, 0x2b, 0x12,
+    0x2e, 0x0a, 0x2c, 0xca, 0xaf, 0x00, 0x2b, 0x37, 0x2f, 0x16, 0x29, 0xa8,
+    0x2b, 0xfa, 0xae, 0xba, 0x2d, 0x70, 0xa3, 0x54, 0x2f, 0xce, 0xaa, 0xf2,
+    0xa9, 0x36, 0xb0, 0xe5, 0xb2, 0xfc, 0xac, 0x06, 0x2e, 0xf1, 0xaf, 0xa4,
+    0x27, 0xc1, 0xae, 0xe0, 0xaa, 0x69, 0xab, 0x56, 0x2f, 0x48, 0x99, 0x8f,
+    0xa8, 0x9d, 0x2a, 0x00, 0x1c, 0x24, 0x2b, 0xb2, 0xa4, 0x7f, 0x22, 0x42,
+    0xaf, 0xa7, 0xac, 0x2d, 0x23, 0x65, 0x2a, 0x47, 0xaf, 0x21, 0xac, 0x62,
+    0x1d, 0x18, 0x2b, 0x24, 0xad, 0x39, 0x1a, 0xa5, 0x22, 0x75, 0x25, 0x60,
+    0xac, 0x22, 0x2f, 0x9c, 0x2d, 0xdc, 0xa9, 0x84, 0x2d, 0x2b, 0x31, 0x09,
+    0xa5, 0xde, 0x2e, 0x5a, 0xb0, 0xc1, 0xb0, 0x9b, 0xb0, 0x22, 0x27, 0x5c,
+    0x2d, 0xde, 0x23, 0x00, 0x26, 0x7f, 0xad, 0x57, 0xaf, 0xf4, 0x2e, 0x36,
+    0x27, 0x61, 0x2d, 0x2d, 0xad, 0xe0, 0xaa, 0xa2, 0x31, 0x90, 0x26, 0xcf,
+    0xae, 0x9f, 0x30, 0x37, 0x30, 0x73, 0x2a, 0x82, 0x27, 0x42, 0x0c, 0xd4,
+    0xa9, 0x1f, 0x31, 0xee, 0x2c, 0x76, 0x2e, 0x11, 0xa7, 0x8e, 0xb0, 0xf7,
+    0xb0, 0x7b, 0xb1, 0x1d, 0x28, 0xfc, 0xa9, 0x45, 0xaf, 0x1a, 0xab, 0xfa,
+    0x21, 0x7d, 0x2f, 0xbb, 0xa6, 0xbd, 0x22, 0xaa, 0x29, 0x7e, 0x13, 0x6f,
+    0x30, 0xfa, 0x2c, 0x88, 0xa9, 0x32, 0xaf, 0x97, 0x25, 0x20, 0xac, 0x95,
+    0xaa, 0x7f, 0x1e, 0xc8, 0x28, 0x32, 0xa8, 0xeb, 0xa8, 0x7a, 0x2e, 0x04,
+    0xa6, 0x95, 0x2d, 0xa6, 0x30, 0x98, 0xa3, 0x52, 0xaa, 0xd9, 0x26, 0xc3,
+    0x2d, 0xc3, 0xa9, 0x6d, 0x2c, 0xbd, 0x2b, 0xe4, 0x2a, 0xd4, 0x2c, 0xe6,
+    0x28, 0x1c, 0xac, 0xdf, 0xa5, 0xbb, 0x2e, 0xe9, 0x32, 0xd8, 0x28, 0x89,
+    0x2c, 0xa9, 0xaa, 0x9e, 0xb0, 0x6c, 0x29, 0xef, 0x2d, 0xba, 0xaa, 0x8b,
+    0xad, 0x9c, 0x94, 0x04, 0x30, 0x5a, 0x22, 0x55, 0x24, 0xd4, 0x2d, 0x2a,
+    0xa2, 0x8d, 0xa1, 0xb7, 0x2a, 0xf6, 0x28, 0x1c, 0x22, 0xf8, 0x33, 0xcc,
+    0xaf, 0x7f, 0x2d, 0x74, 0xa5, 0xda, 0xa7, 0xe0, 0xa8, 0x89, 0xa5, 0xb4,
+    0xaa, 0xb7, 0xae, 0xa4, 0x2c, 0xfd, 0x28, 0xcd, 0x25, 0xb8, 0x31, 0x3f,
+    0xa8, 0x4b, 0x92, 0x25, 0xaf, 0xcf, 0xad, 0xb4, 0x2d, 0x1a, 0xb0, 0xc9,
+    0xb0, 0xdf, 0x2c, 0x99, 0xa3, 0x7b, 0xa4, 0x8d, 0xac, 0xa4, 0xb0, 0x72,
+    0x2b, 0xc2, 0xa8, 0x79, 0x27, 0x41, 0x2c, 0x27, 0x27, 0x60, 0x30, 0xa2,
+    0x27, 0x8d, 0xac, 0xf0, 0xa9, 0x4b, 0x29, 0x38, 0x2d, 0xed, 0x2a, 0x6d,
+    0xac, 0x5c, 0xb0, 0xfd, 0x12, 0x97, 0x9f, 0x21, 0xb1, 0x8c, 0xa4, 0xee,
+    0x2e, 0xaf, 0xaa, 0xed, 0x30, 0xc2, 0x99, 0x05, 0x23, 0x2d, 0x2a, 0x22,
+    0x29, 0x47, 0xaf, 0x39, 0xaf, 0xd1, 0xaa, 0x55, 0xab, 0x86, 0x2a, 0xe0,
+    0xae, 0xc4, 0x1d, 0x7d, 0xb0, 0x30, 0x1e, 0x7d, 0xb1, 0x8e, 0xad, 0x7e,
+    0xac, 0xfe, 0x21, 0x93, 0x23, 0x83, 0xaa, 0x0a, 0xb1, 0x05, 0x24, 0x9d,
+    0xac, 0x60, 0xa5, 0xa0, 0x9d, 0x9e, 0xb0, 0xae, 0x2c, 0x79, 0x2d, 0xb1,
+    0xaa, 0x36, 0x2f, 0x50, 0xb1, 0xbf, 0x2e, 0xfc, 0xb2, 0x07, 0xb2, 0x1c,
+    0x30, 0x1d, 0xa1, 0x70, 0x2e, 0xbc, 0x2e, 0x6c, 0x9d, 0xef, 0xa5, 0x8e,
+    0xac, 0xfe, 0xb2, 0x9c, 0xae, 0x85, 0x22, 0x35, 0x26, 0xd3, 0x18, 0xd0,
+    0x29, 0x0a, 0xac, 0x7a, 0x2d, 0x1e, 0x2d, 0xbc, 0xa5, 0xd3, 0x9d, 0x15,
+    0x2d, 0x76, 0x25, 0xb8, 0xa0, 0x84, 0xae, 0xdf, 0x30, 0x29, 0xae, 0x5d,
+    0x29, 0x94, 0x29, 0xe0, 0xae, 0x06, 0x26, 0xbe, 0x30, 0x11, 0xb1, 0x09,
+    0xa4, 0xf4, 0xa1, 0x44, 0xb0, 0xe7, 0xa6, 0x85, 0xa4, 0x36, 0xa4, 0xdd,
+    0xb0, 0xeb, 0x2e, 0x03, 0x2d, 0x6f, 0x24, 0x53, 0x1e, 0xe3, 0xa4, 0xa2,
+    0xb0, 0x29, 0x2e, 0x07, 0xb1, 0x3a, 0xae, 0x1b, 0xa7, 0xee, 0xa5, 0xd2,
+    0xae, 0x55, 0x2c, 0xc8, 0xb0, 0xf8, 0x27, 0x8c, 0x30, 0xbb, 0xac, 0xbe,
+    0xa8, 0x1b, 0xb0, 0xb1, 0x24, 0xa1, 0x28, 0x8b, 0xac, 0x82, 0x24, 0x41,
+    0xb0, 0xf9, 0x29, 0x20, 0xb0, 0x4b, 0xad, 0xc7, 0xac, 0x80, 0x29, 0x97,
+    0x2c, 0x09, 0x2e, 0x0a, 0x2a, 0x2e, 0x0d, 0xf8, 0x28, 0x63, 0xa7, 0x1e,
+    0xab, 0x81, 0xaf, 0x5c, 0xac, 0x23, 0xb0, 0x56, 0xad, 0xdc, 0x1b, 0x44,
+    0xa3, 0x97, 0xad, 0x39, 0xa3, 0xb0, 0xa4, 0xe6, 0xae, 0xb2, 0x2d, 0xc8,
+    0xa6, 0xc0, 0xa9, 0x82, 0xac, 0x88, 0xb0, 0x2c, 0x2d, 0x3a, 0xa0, 0x11,
+    0x2a, 0x01, 0xa8, 0xe7, 0x2f, 0x9e, 0xaf, 0x36, 0x30, 0xed, 0xaa, 0xa8,
+    0xa4, 0xca, 0xa1, 0xe7, 0x9c, 0x0b, 0xa4, 0x86, 0xae, 0x39, 0xa7, 0xb4,
+    0x21, 0x1d, 0xa4, 0x1b, 0xa2, 0x39, 0x2a, 0x19, 0x93, 0x35, 0x20, 0xd5,
+    0xad, 0xc1, 0xa9, 0x04, 0x24, 0x3b, 0x28, 0x80, 0xa0, 0x00, 0x22, 0x99,
+    0x9f, 0x44, 0xa7, 0x30, 0x32, 0xca, 0xa7, 0xb5, 0xac, 0x44, 0xb0, 0xcd,
+    0x9a, 0xfc, 0xac, 0x94, 0x28, 0x49, 0x2a, 0x7a, 0xad, 0x8e, 0x2a, 0x7a,
+    0xad, 0x63, 0xaf, 0x8f, 0x2e, 0xcb, 0xaa, 0xf0, 0x1e, 0x9e, 0x2a, 0x17,
+    0x2c, 0xb9, 0xa9, 0xdb, 0xac, 0xbe, 0xa4, 0xe4, 0xac, 0xc2, 0xaf, 0xf9,
+    0x1d, 0xfd, 0xad, 0xc8, 0x15, 0xe0, 0x1e, 0x4e, 0x2e, 0xd8, 0x28, 0xfa,
+    0x20, 0x4b, 0xad, 0xb7, 0x31, 0xab, 0xa4, 0x73, 0x2c, 0xbb, 0xa2, 0x70,
+    0x20, 0xb3, 0x2c, 0xc2, 0x9c, 0x46, 0xa8, 0x3b, 0xad, 0x28, 0xab, 0x25,
+    0xa1, 0x7b, 0xb2, 0x1e, 0x2a, 0x25, 0xb0, 0x8d, 0xb1, 0x94, 0x2b, 0x5a,
+    0xa5, 0x68, 0xae, 0x32, 0xaf, 0xb9, 0x26, 0x55, 0xae, 0x0a, 0x1c, 0x3a,
+    0xac, 0x60, 0x2e, 0xc5, 0x9d, 0x2b, 0x2c, 0x86, 0xb0, 0xf9, 0xab, 0x51,
+    0xac, 0x05, 0x23, 0x5e, 0xab, 0x0d, 0x29, 0x79, 0xa8, 0xed, 0x2a, 0xe4,
+    0x2c, 0x3b, 0x2b, 0xbd, 0x20, 0xc4, 0xae, 0xb4, 0x25, 0xad, 0xaa, 0x2b,
+    0xb0, 0xdf, 0x28, 0x6e, 0xb3, 0xc2, 0x2a, 0xd1, 0xb1, 0xa0, 0xae, 0x3d,
+    0x28, 0x49, 0xa6, 0xb5, 0xae, 0x75, 0x2f, 0x78, 0xa9, 0xda, 0xad, 0xed,
+    0xa5, 0xca, 0xac, 0xf0, 0x2e, 0x68, 0xb0, 0xcc, 0x20, 0xae, 0xac, 0x2b,
+    0x2f, 0x23, 0xac, 0xb7, 0x28, 0x8e, 0x2b, 0xc3, 0x27, 0x21, 0xb0, 0x99,
+    0x9a, 0x9b, 0x2b, 0x5f, 0xa9, 0x4c, 0x29, 0x98, 0x25, 0x3a, 0x9d, 0x06,
+    0xac, 0xa9, 0x2a, 0xbc, 0x9a, 0xd0, 0xad, 0x7e, 0x2e, 0xc2, 0x24, 0x98,
+    0x28, 0x40, 0x27, 0x02, 0xa9, 0xc1, 0x9b, 0x29, 0xa5, 0x6b, 0xae, 0x0a,
+    0xae, 0x33, 0x2b, 0xdd, 0xae, 0x1e, 0xad, 0x84, 0x1d, 0xf5, 0xad, 0x9e,
+    0x29, 0x6d, 0x31, 0x54, 0xaa, 0x88, 0xae, 0xd5, 0xac, 0xd8, 0xad, 0x31,
+    0xab, 0xf8, 0x22, 0xaf, 0x97, 0xc3, 0x2c, 0x9e, 0x29, 0x6c, 0x2c, 0x84,
+    0xb0, 0x61, 0xac, 0xb6, 0xab, 0x65, 0x2a, 0x2f, 0xb1, 0xde, 0x9a, 0x4b,
+    0xb2, 0x3c, 0x30, 0xd2, 0xaf, 0xa3, 0x2a, 0xa3, 0x2d, 0x08, 0xa4, 0xf5,
+    0xa9, 0x88, 0xa4, 0x1e, 0xa4, 0xa6, 0xae, 0xc5, 0xae, 0x4c, 0x1f, 0x89,
+    0xae, 0x25, 0xb0, 0xb2, 0xa7, 0x95, 0x23, 0xb6, 0x26, 0xfb, 0xac, 0xfe,
+    0x2c, 0x8f, 0xa2, 0xbd, 0xaf, 0x74, 0xb0, 0xd2, 0x2c, 0xbc, 0xa9, 0x5a,
+    0x2c, 0x30, 0xac, 0xe7, 0x9b, 0x37, 0x9f, 0x39, 0x2c, 0xf3, 0xa1, 0x18,
+    0xae, 0xab, 0xb0, 0x54, 0xa6, 0xc8, 0xb3, 0x76, 0x2f, 0xd1, 0xb0, 0x54,
+    0x29, 0x11, 0xb1, 0x13, 0x23, 0x68, 0xb1, 0xfa, 0xa8, 0xcb, 0x2c, 0x9a,
+    0xb1, 0xa9, 0x27, 0x7b, 0x24, 0xc6, 0x2c, 0xff, 0xad, 0xa0, 0xa6, 0xcb,
+    0xaa, 0x29, 0xac, 0x11, 0xa8, 0x69, 0xaa, 0x33, 0x2a, 0x28, 0x28, 0x01,
+    0xa8, 0xa4, 0x2c, 0xc4, 0xa8, 0xed, 0x30, 0x17, 0x9c, 0x70, 0xa5, 0x9f,
+    0xad, 0x89, 0xae, 0x84, 0x23, 0x5b, 0x2f, 0x0f, 0xaf, 0x01, 0x30, 0xa8,
+    0xaf, 0xa9, 0xac, 0x52, 0x2c, 0xcb, 0xa6, 0x96, 0xa8, 0x72, 0x2e, 0x23,
+    0xaf, 0x39, 0x24, 0x98, 0xa1, 0xe0, 0xb5, 0xf9, 0xb3, 0xc7, 0xb0, 0x80,
+    0x2c, 0x09, 0x24, 0xb8, 0xae, 0x62, 0xac, 0xce, 0xaf, 0x84, 0xad, 0x78,
+    0x2f, 0x45, 0x31, 0x1a, 0xb0, 0x44, 0xaf, 0x30, 0xab, 0xc4, 0x18, 0x93,
+    0xa8, 0x76, 0x2e, 0x38, 0xb0, 0x03, 0xad, 0x88, 0x32, 0x51, 0x32, 0x55,
+    0x25, 0x80, 0xa2, 0x45, 0xaa, 0x68, 0x2e, 0x5c, 0x30, 0xb7, 0x2b, 0xfc,
+    0x30, 0x4b, 0xa4, 0xb6, 0xac, 0x63, 0xb0, 0xc6, 0xa6, 0x26, 0x30, 0x0a,
+    0xa8, 0x80, 0x9e, 0xc2, 0xad, 0x1c, 0x29, 0xa4, 0xa9, 0x30, 0x25, 0x75,
+    0xaf, 0xb0, 0xb1, 0xa3, 0xaa, 0x34, 0x27, 0x49, 0x2e, 0xc4, 0x22, 0xc6,
+    0xb1, 0xdd, 0xb0, 0xe5, 0xa7, 0x68, 0x20, 0xf5, 0xad, 0x0e, 0xb2, 0x36,
+    0x33, 0x06, 0xaf, 0x40, 0x2e, 0x75, 0xaa, 0xc6, 0xa4, 0x2b, 0x20, 0x7c,
+    0xa3, 0x1c, 0x2c, 0xc5, 0x1e, 0x70, 0x2c, 0x66, 0xb2, 0x5c, 0xa6, 0x7a,
+    0x27, 0x16, 0xa6, 0x23, 0x2f, 0x32, 0xb1, 0x06, 0xa9, 0x18, 0x2f, 0x93,
+    0xa8, 0x0f, 0xb0, 0xc1, 0xb0, 0x48, 0xac, 0x0f, 0xa8, 0x33, 0x30, 0xd0,
+    0xac, 0x52, 0xb0, 0xa1, 0x23, 0x0c, 0x24, 0xce, 0xa8, 0x78, 0x30, 0x2b,
+    0xa9, 0x94, 0xab, 0x77, 0x2b, 0x65, 0xa9, 0xb7, 0x28, 0xd5, 0xa6, 0xfb,
+    0x98, 0x32, 0x29, 0x31, 0x22, 0x26, 0x2f, 0x36, 0x32, 0x99, 0x9f, 0xdb,
+    0xac, 0xf0, 0xb0, 0xfd, 0x23, 0x5b, 0xae, 0x5d, 0xb1, 0x2f, 0x2a, 0x2a,
+    0xad, 0x02, 0x2d, 0x9f, 0xa1, 0xea, 0x28, 0xd3, 0x2c, 0x3f, 0x30, 0x5b,
+    0xa6, 0x8c, 0x29, 0x65, 0x28, 0x85, 0xa6, 0xee, 0x23, 0x74, 0xae, 0x9d,
+    0xad, 0xee, 0x28, 0xa0, 0xb1, 0xfb, 0xae, 0x8d, 0x29, 0x38, 0xb2, 0xea,
+    0x1d, 0xb1, 0xa9, 0xbe, 0x20, 0xb8, 0x2c, 0x87, 0xaa, 0xfb, 0x2d, 0x17,
+    0xa6, 0xe5, 0xad, 0xdd, 0xb1, 0x4e, 0x30, 0x04, 0x2b, 0x81, 0x98, 0x8a,
+    0x2f, 0xc1, 0xae, 0x64, 0xad, 0xec, 0x25, 0xce, 0xa1, 0x28, 0xb0, 0xdd,
+    0xaf, 0xc5, 0x30, 0x79, 0x25, 0xb8, 0xac, 0x50, 0xa9, 0x24, 0xaa, 0xe4,
+    0xb1, 0x49, 0x2e, 0x8a, 0x2a, 0x80, 0x32, 0x27, 0xac, 0xdc, 0x2c, 0xfd,
+    0x2e, 0x44, 0x30, 0x6e, 0xac, 0x3e, 0x1e, 0xab, 0x1d, 0x6a, 0x28, 0xe3,
+    0xa2, 0x3d, 0xa7, 0x3f, 0x2d, 0x65, 0x2a, 0xd1, 0x17, 0xa0, 0xa8, 0x6c,
+    0xac, 0x30, 0xa9, 0xaa, 0x1f, 0x8f, 0xa0, 0x97, 0xaa, 0x36, 0x24, 0x13,
+    0x2d, 0x77, 0x22, 0x1d, 0x9a, 0xeb, 0xad, 0xdb, 0xb0, 0x47, 0x2c, 0xd3,
+    0x2e, 0x65, 0xab, 0xf3, 0xb0, 0x87, 0xa6, 0x5a, 0xac, 0x70, 0xad, 0x7f,
+    0xaa, 0x21, 0xae, 0x11, 0x2c, 0x53, 0xb2, 0x3a, 0x30, 0x1c, 0x25, 0x66,
+    0xa7, 0xe5, 0x2a, 0x0e, 0x9e, 0x60, 0xaf, 0xbc, 0x2a, 0x17, 0xb0, 0x50,
+    0xb0, 0x13, 0x2a, 0xa1, 0x2b, 0xa0, 0x1e, 0x4f, 0x2e, 0xf1, 0x8e, 0xd5,
+    0xac, 0x8d, 0x25, 0xa4, 0xab, 0xaa, 0xad, 0xb6, 0xac, 0xbe, 0xaa, 0x52,
+    0x28, 0x09, 0x2a, 0x25, 0xac, 0x07, 0x30, 0x6d, 0x30, 0x8d, 0x32, 0xac,
+    0x31, 0x2b, 0x34, 0x1a, 0xb0, 0xf8, 0x2c, 0x67, 0x2e, 0x05, 0xb1, 0x98,
+    0xa8, 0x1a, 0xad, 0x77, 0x1e, 0xdc, 0x2c, 0x70, 0x2b, 0x1a, 0x1c, 0xac,
+    0x26, 0x8f, 0x28, 0x2f, 0x20, 0xf0, 0xa9, 0x37, 0xaa, 0x12, 0xa4, 0x1c,
+    0x31, 0xb7, 0xaf, 0x08, 0xb0, 0xbc, 0x94, 0xd8, 0x9e, 0xd2, 0x2f, 0xff,
+    0x2d, 0x7c, 0x2c, 0x0b, 0x29, 0xca, 0x22, 0x4e, 0x30, 0x27, 0xaf, 0x7b,
+    0xad, 0xa4, 0xa4, 0x23, 0xb1, 0x8f, 0x30, 0xa0, 0xb0, 0x2a, 0xac, 0xed,
+    0x32, 0x56, 0xb4, 0xad, 0xa2, 0x11, 0x1b, 0xd2, 0x27, 0xb2, 0x2e, 0x09,
+    0xad, 0xc0, 0xad, 0x72, 0x25, 0x5a, 0x20, 0xaa, 0xad, 0x21, 0x2e, 0x87,
+    0x34, 0xce, 0xa9, 0xdd, 0xa9, 0x8b, 0xb0, 0x9f, 0xac, 0x3f, 0x27, 0x31,
+    0xae, 0x64, 0xb0, 0x55, 0xad, 0xa7, 0x2b, 0x28, 0x9f, 0x2e, 0x2e, 0x7e,
+    0xad, 0x43, 0x29, 0x91, 0x2b, 0x0b, 0x2b, 0x91, 0x2c, 0x49, 0x2f, 0x79,
+    0x28, 0x34, 0x2d, 0xf6, 0x25, 0x56, 0xaf, 0x32, 0xac, 0x90, 0xa9, 0xb8,
+    0x2b, 0x68, 0xac, 0x38, 0x2e, 0xac, 0xaa, 0xfa, 0x2e, 0x84, 0xa1, 0xa4,
+    0xac, 0x61, 0x28, 0x23, 0xa9, 0x13, 0xaf, 0x97, 0x30, 0xfa, 0xad, 0xa7,
+    0xac, 0x22, 0x9c, 0x5f, 0x27, 0x0c, 0x1c, 0x9c, 0x30, 0xe9, 0xad, 0x25,
+    0x21, 0x52, 0x2d, 0x93, 0x26, 0x0c, 0xa9, 0xd9, 0xb2, 0x4e, 0xac, 0xd4,
+    0xad, 0x15, 0xa4, 0x80, 0xae, 0xbf, 0xae, 0x89, 0x2c, 0x66, 0xb1, 0xbb,
+    0x24, 0x57, 0x1f, 0x9f, 0xad, 0xd7, 0x2d, 0x6f, 0x23, 0x34, 0xaa, 0x1c,
+    0xa6, 0x16, 0xb1, 0x07, 0xaf, 0x55, 0x28, 0x69, 0x2d, 0x15, 0xa8, 0x0c,
+    0xa8, 0x3c, 0xaf, 0xb0, 0xb0, 0xbc, 0x30, 0x69, 0xa6, 0x73, 0xae, 0xb7,
+    0xaa, 0x5b, 0xa5, 0x0a, 0x29, 0x10, 0x27, 0x37, 0xaf, 0xf0, 0x2c, 0xb4,
+    0xa9, 0x6d, 0x2e, 0x76, 0xa8, 0xfa, 0x31, 0x1b, 0xac, 0x8c, 0xa7, 0x28,
+    0x30, 0xc9, 0xa9, 0xe6, 0x28, 0x28, 0xa5, 0x63, 0x25, 0x8a, 0x2d, 0xbe,
+    0x2f, 0x88, 0xa9, 0xfb, 0xa8, 0xc0, 0xa0, 0x92, 0x28, 0x95, 0xb1, 0x1c,
+    0xb0, 0xa3, 0x2b, 0x4f, 0x2c, 0xd8, 0xae, 0x0f, 0xaf, 0x9f, 0x2b, 0xdc,
+    0xa5, 0xcb, 0x2c, 0x5f, 0x2b, 0x8b, 0x2d, 0xfb, 0x2d, 0x80, 0x2a, 0xe5,
+    0x28, 0x46, 0xa8, 0x97, 0xae, 0xda, 0x20, 0xef, 0xab, 0x72, 0xac, 0xcc,
+    0xa8, 0x04, 0xa9, 0xd5, 0x2b, 0x07, 0xb2, 0xfa, 0x2c, 0xaf, 0x2d, 0xbd,
+    0xac, 0x6a, 0x27, 0x2c, 0xae, 0xfc, 0x2a, 0x77, 0x2c, 0x5e, 0xb0, 0xf9,
+    0xab, 0xe6, 0x2f, 0x9a, 0x30, 0x73, 0xa9, 0x84, 0x9f, 0x37, 0xad, 0x30,
+    0xad, 0xcb, 0xb2, 0x56, 0x28, 0x1c, 0x2d, 0x7d, 0xab, 0x58, 0x32, 0x88,
+    0x31, 0xd4, 0xa9, 0xe6, 0x30, 0xc9, 0xa6, 0x55, 0x31, 0x90, 0xaf, 0x9e,
+    0x30, 0x1d, 0x29, 0x4e, 0x25, 0xb6, 0xa1, 0x15, 0xb0, 0xef, 0x28, 0x8d,
+    0x9c, 0x70, 0x33, 0x72, 0xb1, 0xba, 0xab, 0x2f, 0xac, 0xd9, 0xad, 0x60,
+    0xb1, 0x40, 0x28, 0x48, 0x2e, 0x23, 0xa8, 0xb9, 0x9a, 0x7c, 0xa9, 0xca,
+    0x2f, 0x15, 0x31, 0xd0, 0xa2, 0xea, 0xa3, 0x8d, 0x27, 0xb8, 0x2c, 0x71,
+    0xac, 0x2b, 0x2d, 0x59, 0x28, 0xf1, 0xac, 0x04, 0x26, 0xe6, 0x28, 0x2f,
+    0x2e, 0xab, 0xa4, 0x69, 0x22, 0x59, 0xb0, 0x4a, 0xb0, 0x2a, 0x2a, 0x31,
+    0xad, 0xaa, 0xb0, 0x51, 0xaa, 0xa6, 0xb0, 0x5b, 0x29, 0xf9, 0x2c, 0xcf,
+    0x2b, 0xae, 0x22, 0x09, 0x33, 0x57, 0x22, 0x06, 0xb1, 0x2d, 0xb1, 0x6d,
+    0x27, 0x79, 0x35, 0x80, 0x30, 0x04, 0x2c, 0xe4, 0x30, 0x1b, 0xb1, 0x51,
+    0x2f, 0x83, 0x2c, 0x35, 0xb0, 0xbf, 0x30, 0x6b, 0x30, 0xc9, 0xb4, 0x68,
+    0x31, 0x92, 0x2c, 0xa6, 0x32, 0x5b, 0xae, 0xfa, 0x28, 0x4d, 0x28, 0x2b,
+    0x2a, 0x56, 0xa4, 0x0c, 0xb1, 0xe1, 0x26, 0x6a, 0x1c, 0xf6, 0x2d, 0x82,
+    0xad, 0x00, 0xb1, 0x54, 0xb0, 0x4c, 0xad, 0x0f, 0xb0, 0x59, 0x29, 0x3f,
+    0x28, 0xe5, 0x2e, 0x40, 0x28, 0x9d, 0x1b, 0x5b, 0x2f, 0x09, 0x2f, 0x23,
+    0xb2, 0x26, 0xa9, 0xd3, 0x2d, 0x78, 0x2e, 0x0b, 0xb1, 0x51, 0x34, 0x89,
+    0xac, 0xf3, 0xa8, 0x22, 0x2a, 0xb1, 0x2c, 0x3f, 0x2d, 0x3b, 0xb0, 0xfc,
+    0x30, 0x93, 0xae, 0xc7, 0xad, 0xec, 0x2a, 0xeb, 0xb0, 0x24, 0xb0, 0x87,
+    0xaf, 0xec, 0xae, 0xdc, 0x26, 0x50, 0x2a, 0xf2, 0x2d, 0x5d, 0xa7, 0x8f,
+    0x2d, 0x94, 0x2e, 0xb0, 0xab, 0xf4, 0xb0, 0x5f, 0x28, 0xec, 0x30, 0xcc,
+    0x2a, 0x49, 0x31, 0x5e, 0x2b, 0x87, 0xb0, 0xdc, 0x9a, 0x69, 0x24, 0x5d,
+    0xac, 0x2d, 0x34, 0x13, 0x2c, 0xfb, 0x2c, 0x75, 0x2f, 0x97, 0xa3, 0x98,
+    0x29, 0xe3, 0xb2, 0xbd, 0x31, 0x5e, 0x96, 0x5c, 0x28, 0xa6, 0x23, 0x0a,
+    0xad, 0xa1, 0xad, 0x65, 0xaa, 0x7d, 0x2d, 0xdb, 0xaf, 0x9b, 0xb2, 0x0e,
+    0xa1, 0x45, 0xb2, 0x6c, 0xb0, 0x3f, 0x2f, 0x53, 0x2d, 0x79, 0x33, 0x59,
+    0x26, 0x9a, 0x08, 0x45, 0x2e, 0xcf, 0x2d, 0x91, 0xa0, 0xdd, 0xa8, 0x4d,
+    0x2f, 0x40, 0x2a, 0x8c, 0xa8, 0x8b, 0x2c, 0xf0, 0x2c, 0xa4, 0x24, 0x77,
+    0x2d, 0x7b, 0x2e, 0xba, 0x31, 0xb1, 0xa7, 0x03, 0xad, 0xb2, 0x97, 0xda,
+    0x28, 0xee, 0x1a, 0x4e, 0xa7, 0x90, 0xb0, 0xe1, 0xaa, 0x80, 0xaa, 0x31,
+    0x2c, 0x28, 0x2f, 0x2b, 0x31, 0x1d, 0x27, 0xec, 0x2c, 0x9b, 0x2a, 0xec,
+    0x27, 0x88, 0xb4, 0xf3, 0xaa, 0x59, 0x31, 0x63, 0x2c, 0x01, 0x2b, 0x9a,
+    0x8c, 0x96, 0xb1, 0xdf, 0xac, 0x7c, 0x2e, 0x58, 0xb0, 0x95, 0x2c, 0x08,
+    0x2d, 0x5e, 0xb4, 0x0b, 0x34, 0x3b, 0xac, 0x3e, 0x34, 0xe1, 0xa8, 0x85,
+    0x31, 0x82, 0xa4, 0x62, 0x30, 0x72, 0x2e, 0x88, 0xab, 0x92, 0xab, 0x3a,
+    0xa1, 0xf2, 0x2b, 0xa8, 0x14, 0x6f, 0xae, 0x13, 0x26, 0x41, 0xae, 0x0a,
+    0xad, 0x9b, 0x28, 0x51, 0x95, 0xa1, 0x1e, 0xfc, 0x2c, 0xcb, 0x22, 0x20,
+    0x2a, 0x58, 0x8c, 0x35, 0xad, 0x16, 0xaa, 0x21, 0x2b, 0x22, 0x30, 0x07,
+    0xb2, 0x0a, 0x23, 0xc7, 0x2a, 0xac, 0xa8, 0xc7, 0x28, 0x84, 0x2d, 0x90,
+    0x32, 0xa1, 0xaf, 0x0d, 0x2e, 0x13, 0xae, 0xe4, 0x1b, 0x15, 0xa4, 0x77,
+    0xb0, 0x40, 0xa8, 0x25, 0xad, 0xbc, 0xad, 0xa5, 0x2e, 0xdd, 0x8c, 0x7c,
+    0x30, 0x6c, 0x2f, 0xbc, 0x2e, 0x2a, 0x30, 0xf7, 0xa9, 0x63, 0xb3, 0x85,
+    0xa9, 0xc5, 0xa6, 0xed, 0x31, 0x36, 0x30, 0x27, 0x29, 0x7e, 0xb2, 0x80,
+    0xa8, 0xba, 0xa5, 0x87, 0xa9, 0x33, 0x2c, 0x31, 0x2e, 0x52, 0xb2, 0xcc,
+    0x2d, 0x7e, 0x23, 0x1a, 0x29, 0xd4, 0xa4, 0x64, 0x2f, 0x9e, 0xa5, 0x7f,
+    0x28, 0x17, 0x25, 0x3b, 0xb3, 0x4e, 0x1c, 0xc2, 0xa4, 0xde, 0x32, 0x45,
+    0xb0, 0x5d, 0xab, 0x8d, 0xb0, 0x91, 0xb4, 0x62, 0xb1, 0x0b, 0x2c, 0xa4,
+    0x21, 0x53, 0x30, 0xc6, 0x29, 0xdb, 0x1f, 0x9e, 0x29, 0xa5, 0x1b, 0xb3,
+    0x2d, 0xdc, 0xad, 0xbe, 0x2f, 0x33, 0x31, 0x70, 0xaa, 0xbe, 0x31, 0x0b,
+    0xa0, 0x93, 0x28, 0x2b, 0x2d, 0x3a, 0x2e, 0x37, 0xa5, 0x68, 0xb0, 0x36,
+    0xab, 0x23, 0xb5, 0x63, 0x2c, 0x44, 0x2e, 0x6e, 0xb0, 0x95, 0x28, 0x6c,
+    0xae, 0x66, 0xad, 0xf1, 0x30, 0x96, 0x29, 0xa1, 0x30, 0xef, 0x30, 0x81,
+    0x29, 0x8d, 0x2c, 0xd5, 0xa9, 0xc4, 0xad, 0xe1, 0xa9, 0xbb, 0x32, 0x01,
+    0x30, 0x86, 0x2f, 0x82, 0x2d, 0x62, 0xb3, 0x20, 0x29, 0x8f, 0x2a, 0x85,
+    0x26, 0x09, 0x2d, 0x39, 0x2a, 0x42, 0xae, 0xd0, 0xa9, 0x3c, 0x2e, 0x68,
+    0x2c, 0xb0, 0xaa, 0x96, 0x31, 0x09, 0x30, 0x4a, 0x2d, 0x27, 0x23, 0xd6,
+    0xb3, 0xf7, 0x2a, 0xa8, 0xb0, 0x89, 0x31, 0x51, 0xb0, 0x04, 0xb2, 0xfe,
+    0xa7, 0x68, 0xb2, 0x4c, 0x9c, 0x88, 0x30, 0x6f, 0xa5, 0xc2, 0xb0, 0x11,
+    0x2d, 0x66, 0xa8, 0x59, 0x2f, 0x03, 0x2d, 0x6d, 0x2e, 0xd5, 0xa7, 0x84,
+    0x2f, 0x29, 0x30, 0xf0, 0x2f, 0xf6, 0x2d, 0x10, 0x30, 0x3b, 0xa6, 0x56,
+    0x9f, 0xc9, 0xae, 0xce, 0x2a, 0x26, 0xad, 0x64, 0x2b, 0x19, 0xb2, 0x60,
+    0xab, 0x2d, 0xab, 0x0f, 0xb5, 0xae, 0x2f, 0x01, 0xb0, 0x64, 0xa8, 0x18,
+    0x24, 0x22, 0x98, 0x4b, 0x2d, 0x9f, 0x2c, 0x0c, 0x2e, 0x75, 0x25, 0x64,
+    0xae, 0x91, 0xad, 0xd2, 0xa0, 0x2e, 0xa6, 0xae, 0x24, 0x4b, 0x30, 0x5d,
+    0x2e, 0x31, 0xb2, 0xfe, 0x34, 0x64, 0x2b, 0x64, 0xa9, 0xf5, 0x33, 0x51,
+    0x27, 0xc6, 0xaf, 0x98, 0x31, 0x1d, 0xa7, 0x26, 0xa6, 0x8f, 0xb4, 0x9f,
+    0x2d, 0xde, 0x2f, 0x35, 0x21, 0xa6, 0xab, 0xc2, 0xb0, 0x6c, 0x90, 0xcc,
+    0x29, 0xe6, 0xa7, 0xa1, 0x1a, 0x94, 0xac, 0xe9, 0xb2, 0x46, 0xaf, 0x67,
+    0xab, 0x8b, 0xae, 0xca, 0x28, 0xa0, 0x2b, 0x53, 0xa7, 0x71, 0x21, 0x5b,
+    0x1c, 0xe1, 0x2f, 0xe7, 0xa8, 0xd2, 0x20, 0xe7, 0xb0, 0x7b, 0x29, 0x69,
+    0xb0, 0x90, 0x30, 0x14, 0xaa, 0x86, 0x31, 0xf2, 0xac, 0x66, 0x34, 0x8b,
+    0x2d, 0x3b, 0x2e, 0x34, 0xa9, 0x92, 0xac, 0x8c, 0x2c, 0x68, 0x28, 0x43,
+    0xaa, 0x45, 0x95, 0x28, 0xb1, 0x5a, 0x29, 0xc1, 0x17, 0x77, 0xb0, 0x76,
+    0x32, 0xc0, 0xa7, 0x77, 0xa0, 0x0c, 0x29, 0x8a, 0xa2, 0x03, 0xad, 0x0c,
+    0xb0, 0xbb, 0xab, 0x22, 0xad, 0xfe, 0x9c, 0xe5, 0xa5, 0xb3, 0xad, 0x3f,
+    0x21, 0xe6, 0x2a, 0x07, 0xaa, 0x11, 0x31, 0x78, 0x2a, 0x9e, 0xad, 0xf8,
+    0xa9, 0x15, 0xa8, 0xaf, 0x28, 0x1c, 0xa8, 0x39, 0x2d, 0xaf, 0x28, 0xd1,
+    0x31, 0x2b, 0x96, 0x1a, 0xb0, 0x71, 0xa8, 0x9f, 0xac, 0xdf, 0x2d, 0xd4,
+    0xa5, 0xc1, 0xb0, 0x12, 0xad, 0x91, 0xb1, 0x97, 0xaf, 0x11, 0x2f, 0x4d,
+    0xad, 0x31, 0x20, 0xeb, 0xac, 0xb7, 0x97, 0x1c, 0x21, 0x2b, 0x30, 0x02,
+    0xa4, 0x64, 0x25, 0x6c, 0xa9, 0x4c, 0xad, 0x89, 0xaf, 0xff, 0x31, 0x52,
+    0xac, 0xac, 0x30, 0xfc, 0xa2, 0xa5, 0x28, 0x44, 0x32, 0xc5, 0x07, 0x85,
+    0xa5, 0x25, 0xaf, 0x0d, 0xa6, 0xc6, 0x26, 0x26, 0xad, 0xd4, 0x23, 0x0e,
+    0x12, 0xa0, 0xa3, 0x36, 0xad, 0xdb, 0xa8, 0xb7, 0x31, 0x85, 0xaa, 0x7f,
+    0x29, 0x79, 0x9c, 0x4d, 0xa9, 0xfb, 0xb1, 0x7a, 0xab, 0x0e, 0xb0, 0x1f,
+    0x15, 0x73, 0xb0, 0x14, 0x9b, 0x25, 0xb3, 0x57, 0x2d, 0xf7, 0x9e, 0x02,
+    0xa5, 0x98, 0x29, 0x65, 0x97, 0xb6, 0xa8, 0x0b, 0x2f, 0x69, 0xaf, 0x33,
+    0x9f, 0x3e, 0xab, 0x5a, 0x31, 0x34, 0x30, 0x97, 0xa8, 0x95, 0x2d, 0x09,
+    0xaf, 0x10, 0xac, 0xf5, 0xad, 0x44, 0x25, 0x72, 0xac, 0x14, 0xad, 0xea,
+    0xaf, 0x9f, 0xa7, 0xbe, 0xa5, 0x9c, 0x2d, 0xc5, 0x2e, 0x64, 0x2d, 0x21,
+    0xae, 0x0f, 0xb0, 0xb1, 0xa7, 0x48, 0x30, 0xbc, 0x2d, 0x9f, 0x1a, 0x32,
+    0x21, 0x5d, 0x2c, 0xe9, 0xa8, 0x68, 0x30, 0x60, 0x2c, 0x24, 0x33, 0x17,
+    0xa3, 0x9e, 0x30, 0x21, 0x32, 0x9a, 0x29, 0x9a, 0x28, 0x87, 0xaf, 0x9a,
+    0x98, 0xb4, 0xaa, 0xfa, 0xaa, 0x1d, 0xaa, 0x00, 0xb1, 0x26, 0xa2, 0x97,
+    0x2a, 0xc6, 0x2a, 0xe5, 0x32, 0x32, 0x24, 0x02, 0xab, 0xb8, 0xa8, 0x4f,
+    0xb5, 0x11, 0xb2, 0x29, 0xaf, 0x7f, 0x28, 0x6f, 0x9c, 0xff, 0xac, 0x91,
+    0xa9, 0x49, 0xb0, 0x9a, 0x30, 0xf1, 0x9b, 0x9b, 0xa6, 0x53, 0x2a, 0x77,
+    0x29, 0x20, 0xb0, 0x2d, 0x31, 0x57, 0xae, 0x23, 0xaf, 0xec, 0xb0, 0x26,
+    0x2c, 0xd8, 0x32, 0x38, 0x30, 0xab, 0x27, 0xcf, 0xb3, 0x72, 0xa4, 0xb5,
+    0xae, 0x0c, 0x26, 0x09, 0xad, 0x25, 0xae, 0x7c, 0xae, 0xb8, 0xab, 0x12,
+    0xb0, 0xfe, 0xa1, 0x33, 0x28, 0xd6, 0x29, 0x0d, 0xae, 0xe3, 0xa6, 0x56,
+    0xa3, 0x7a, 0x31, 0x13, 0xaa, 0xc9, 0xa4, 0xd2, 0x2c, 0xa1, 0xa3, 0xdc,
+    0xa3, 0x49, 0x32, 0xf5, 0x2e, 0xf3, 0x2d, 0x15, 0x2d, 0xb6, 0x33, 0x94,
+    0x2e, 0xf1, 0xa6, 0xd0, 0xaf, 0xfd, 0xab, 0x71, 0xb1, 0x51, 0x27, 0x72,
+    0xa5, 0x8e, 0x24, 0x2c, 0xb1, 0x92, 0x26, 0xe3, 0xac, 0xd5, 0x2a, 0x29,
+    0xa9, 0x1c, 0x28, 0x3a, 0x2f, 0x1e, 0x98, 0xd8, 0xb2, 0x8f, 0xb0, 0x8d,
+    0xaa, 0xf7, 0xa4, 0x31, 0x1c, 0xca, 0xac, 0xde, 0xa1, 0x37, 0xae, 0x99,
+    0x2e, 0x9a, 0x9e, 0x0a, 0xac, 0x00, 0x2f, 0x40, 0x29, 0xac, 0xb1, 0x72,
+    0xa7, 0xd7, 0xa8, 0xbe, 0x2b, 0xd2, 0xb1, 0x54, 0x31, 0xb0, 0x32, 0xbc,
+    0x2b, 0x61, 0xac, 0x21, 0xb0, 0xe8, 0x28, 0x14, 0xa9, 0xba, 0x2c, 0x2d,
+    0xac, 0x10, 0x21, 0xee, 0xaf, 0x25, 0xac, 0xaf, 0xb0, 0xde, 0x9f, 0xf5,
+    0xa6, 0x25, 0x2c, 0xd4, 0xaf, 0xdd, 0x9c, 0x0f, 0x32, 0x89, 0xaa, 0x0d,
+    0xa9, 0xd8, 0xa9, 0x4c, 0x2d, 0xff, 0x2b, 0xb6, 0xa7, 0x07, 0x2c, 0x33,
+    0xaf, 0xe0, 0x31, 0x01, 0x29, 0x8e, 0x2e, 0xb0, 0x2e, 0x78, 0xa9, 0x31,
+    0x29, 0xb2, 0x29, 0x1a, 0xae, 0x0d, 0xb0, 0xe9, 0xb1, 0x58, 0xab, 0xa4,
+    0xaf, 0x02, 0xa6, 0x46, 0x25, 0x01, 0x2f, 0xb0, 0xa8, 0x81, 0xaf, 0x91,
+    0xa8, 0x76, 0xa8, 0xf5, 0xb4, 0x94, 0xb3, 0x51, 0xa7, 0x09, 0x28, 0x7c,
+    0x21, 0xea, 0xa6, 0xc8, 0x28, 0xb9, 0xae, 0x5c, 0x2c, 0xce, 0xab, 0x8e,
+    0x21, 0xfe, 0x30, 0x78, 0x31, 0x1d, 0xb2, 0xee, 0x28, 0x41, 0xad, 0x75,
+    0xa8, 0xdb, 0x24, 0x7f, 0x31, 0x0c, 0x2c, 0x91, 0x20, 0x28, 0xad, 0xbb,
+    0xb0, 0xec, 0x2a, 0x6a, 0xa9, 0x5c, 0x2d, 0xc2, 0xaf, 0xc0, 0xb3, 0xf1,
+    0xaa, 0x2f, 0xa1, 0x23, 0xb2, 0x72, 0x28, 0x89, 0xad, 0xf0, 0x26, 0x72,
+    0xac, 0x47, 0xaa, 0xef, 0x2d, 0x43, 0xac, 0x9d, 0xa9, 0x98, 0x2a, 0x82,
+    0x2f, 0xc8, 0x32, 0xd3, 0xa9, 0xe4, 0x9a, 0x1f, 0x2c, 0xdf, 0x31, 0x84,
+    0x28, 0x4e, 0x32, 0x6e, 0xa6, 0xaa, 0xa8, 0x21, 0x2c, 0x58, 0xb1, 0xe2,
+    0xaf, 0xf1, 0x29, 0x25, 0xaa, 0xbd, 0xac, 0x37, 0xb0, 0x85, 0xaa, 0x32,
+    0x29, 0x0a, 0x2e, 0x74, 0xac, 0x63, 0xb1, 0x76, 0x2a, 0xcf, 0x27, 0x5e,
+    0xb4, 0xbf, 0xa6, 0x7f, 0xa3, 0x02, 0x2a, 0xe8, 0x2c, 0x7d, 0x24, 0x2a,
+    0x22, 0x48, 0xaf, 0xd8, 0xa4, 0x1e, 0x28, 0xcb, 0xa9, 0x8a, 0xa3, 0x50,
+    0xad, 0xa4, 0xa9, 0xc4, 0x25, 0x96, 0xaa, 0x53, 0xa6, 0xa1, 0xa7, 0x3c,
+    0x32, 0xd5, 0x30, 0xe2, 0x30, 0x91, 0x20, 0x1e, 0xb1, 0xdc, 0xb2, 0x8d,
+    0xab, 0xa3, 0x31, 0x74, 0xac, 0x0e, 0xa9, 0x3d, 0x20, 0x68, 0xaa, 0x0a,
+    0xaa, 0x52, 0x30, 0x75, 0x2f, 0xc2, 0x24, 0x4c, 0x2f, 0x13, 0x1a, 0x3b,
+    0x9e, 0x8e, 0x1d, 0x42, 0x2f, 0x19, 0xa5, 0x90, 0x32, 0xd1, 0xa4, 0x29,
+    0x2f, 0x5f, 0x2b, 0x5d, 0x2c, 0x4c, 0xae, 0x51, 0x22, 0xa0, 0xac, 0x66,
+    0x22, 0x17, 0x32, 0x44, 0x2e, 0x05, 0xac, 0x96, 0x2c, 0xd6, 0x29, 0x78,
+    0xa8, 0xe3, 0xa4, 0x22, 0xac, 0x2e, 0xa5, 0x60, 0xad, 0x6c, 0x2a, 0x18,
+    0x2a, 0xdf, 0xad, 0xd6, 0xac, 0x4a, 0xab, 0xe3, 0x29, 0x46, 0xaf, 0x8e,
+    0x24, 0xac, 0x26, 0xb8, 0xae, 0x37, 0x30, 0x9e, 0x31, 0x3d, 0xa8, 0x88,
+    0xac, 0x27, 0xa9, 0x69, 0xad, 0xf3, 0xab, 0xeb, 0xaf, 0xd7, 0xb0, 0xaa,
+    0x22, 0xbc, 0x29, 0xe8, 0x27, 0xb2, 0xad, 0x2e, 0x30, 0xca, 0xa2, 0x8c,
+    0x20, 0xc9, 0xa8, 0x6a, 0xac, 0x09, 0xad, 0x94, 0xa8, 0xbd, 0x30, 0x87,
+    0x9e, 0x23, 0xaf, 0xae, 0x2d, 0xae, 0x2b, 0xde, 0xb0, 0x32, 0x22, 0xd8,
+    0x2d, 0xcc, 0x30, 0x10, 0x30, 0xcf, 0xab, 0xf9, 0xa5, 0x4d, 0x2b, 0x2f,
+    0x1f, 0xea, 0xad, 0xf5, 0x2d, 0x5e, 0x29, 0xd3, 0x99, 0x91, 0xad, 0x8b,
+    0x29, 0xdf, 0xac, 0x2d, 0x2a, 0xbf, 0x21, 0xa4, 0x2f, 0x82, 0xa1, 0x33,
+    0xaa, 0xa9, 0xb1, 0xc3, 0x2f, 0xcb, 0xa9, 0xf5, 0xa0, 0x56, 0xb0, 0xe9,
+    0xac, 0xaf, 0xad, 0x58, 0x2d, 0x47, 0x2e, 0x5c, 0x31, 0x9e, 0x29, 0x24,
+    0xb0, 0xc1, 0x25, 0x83, 0x29, 0xc7, 0x28, 0x5c, 0x30, 0x25, 0x2d, 0x4e,
+    0x29, 0x68, 0x30, 0xb5, 0x2c, 0xfa, 0x2c, 0xa5, 0xa8, 0x4f, 0xb0, 0x0f,
+    0x24, 0x4a, 0x30, 0xd5, 0xb1, 0x32, 0xaf, 0xc6, 0x31, 0x39, 0xa3, 0x55,
+    0x90, 0xd2, 0xac, 0xf8, 0xa9, 0xd7, 0x20, 0xf4, 0x85, 0x7a, 0xa9, 0x97,
+    0x9b, 0x7a, 0xac, 0x52, 0xab, 0x3f, 0x24, 0x4b, 0xa6, 0x92, 0xb0, 0x38,
+    0xae, 0x3a, 0xa8, 0x99, 0xad, 0x5c, 0xa1, 0x10, 0x2f, 0x92, 0xab, 0x9b,
+    0xaf, 0x82, 0xb0, 0xa2, 0x18, 0x69, 0xac, 0x11, 0xa4, 0x6d, 0xac, 0x5d,
+    0x2a, 0xf1, 0x2e, 0xc3, 0x2b, 0x72, 0xab, 0xb7, 0x2c, 0xce, 0xa2, 0xbb,
+    0x1f, 0x07, 0x2c, 0xa8, 0x30, 0xaf, 0x29, 0xf3, 0x30, 0x18, 0xad, 0x3e,
+    0x20, 0x3c, 0x2a, 0xbf, 0xa2, 0x93, 0x2c, 0xde, 0x1c, 0x88, 0xa8, 0x06,
+    0x2e, 0x5a, 0x9a, 0x56, 0x28, 0xf8, 0x2f, 0x16, 0xaf, 0xd8, 0xad, 0x06,
+    0x29, 0xd7, 0xa9, 0xa8, 0xa7, 0x83, 0x2e, 0x3c, 0xaf, 0x3d, 0x2d, 0xf3,
+    0xad, 0x70, 0xab, 0x7a, 0xa0, 0x1e, 0xa8, 0xca, 0xa3, 0x96, 0x2e, 0xcc,
+    0xb2, 0xc8, 0xa7, 0x63, 0x28, 0x15, 0xa5, 0x2e, 0x2c, 0x11, 0xb2, 0xd7,
+    0x2e, 0x34, 0x2b, 0xa7, 0x2f, 0xae, 0x9c, 0x57, 0xb0, 0x60, 0xb5, 0x26,
+    0xaa, 0x91, 0xa0, 0x00, 0x2d, 0xc8, 0xad, 0x3e, 0x25, 0xad, 0xae, 0x41,
+    0x1a, 0x03, 0x23, 0x92, 0x8a, 0xa5, 0x30, 0x9b, 0xb2, 0x56, 0x28, 0x3b,
+    0xab, 0x3c, 0xab, 0x4d, 0x27, 0x1a, 0xad, 0x15, 0x30, 0x36, 0xad, 0x24,
+    0x29, 0xfa, 0xa0, 0xac, 0xac, 0x79, 0xac, 0x04, 0x2c, 0xb1, 0x1e, 0xb5,
+    0x2c, 0x63, 0x9f, 0x41, 0xa8, 0x53, 0x9c, 0x37, 0x28, 0x3f, 0x1e, 0x20,
+    0xa4, 0x7f, 0x19, 0x4e, 0xb0, 0x1f, 0x20, 0x85, 0xa1, 0x68, 0x1f, 0x30,
+    0x2d, 0x67, 0xb1, 0x0a, 0xb2, 0xcf, 0x28, 0x22, 0x2a, 0x05, 0x24, 0x4d,
+    0x2e, 0x52, 0xac, 0x34, 0xa8, 0x04, 0x2c, 0xaa, 0xb2, 0xad, 0x9d, 0x0d,
+    0x1f, 0x94, 0x2e, 0xe8, 0x24, 0xce, 0x2f, 0x77, 0xb1, 0x51, 0xa8, 0xc4,
+    0xa7, 0xd5, 0xac, 0x99, 0x2a, 0x76, 0xa9, 0x06, 0x2d, 0x9b, 0x2a, 0x15,
+    0x2f, 0x02, 0x2c, 0x19, 0xae, 0x11, 0xac, 0xf6, 0x29, 0xa7, 0x2d, 0xb2,
+    0xa7, 0x25, 0xaf, 0xad, 0xac, 0x3d, 0xaa, 0x1b, 0xab, 0x26, 0x21, 0x9f,
+    0x2a, 0xa9, 0x32, 0x8b, 0x2c, 0x19, 0x23, 0x41, 0x24, 0x65, 0x2a, 0x50,
+    0x2d, 0x9e, 0xb0, 0x99, 0xac, 0x95, 0x2e, 0xe5, 0xa8, 0xb8, 0x28, 0x08,
+    0x30, 0xb7, 0x24, 0x7b, 0x24, 0xc8, 0xa6, 0x7e, 0x31, 0x58, 0xa8, 0x07,
+    0x31, 0x3f, 0xad, 0x47, 0x1e, 0x6f, 0xa8, 0xf0, 0x28, 0x53, 0xa8, 0x59,
+    0xaa, 0x41, 0xa6, 0x3c, 0xad, 0x90, 0x27, 0x63, 0x29, 0x0d, 0xa5, 0x83,
+    0xaa, 0x71, 0x25, 0x85, 0xab, 0xb1, 0xae, 0xa4, 0x2c, 0xa5, 0xa9, 0x89,
+    0xb1, 0xd3, 0xac, 0xd3, 0xae, 0xff, 0xaa, 0xd7, 0x29, 0x02, 0xae, 0xa7,
+    0x20, 0xd4, 0x31, 0x27, 0xac, 0x67, 0xac, 0x76, 0x2d, 0x9a, 0xae, 0x13,
+    0xa9, 0xc9, 0xb2, 0xc9, 0x30, 0xe5, 0x2c, 0x6a, 0x2f, 0x9b, 0xa8, 0x1a,
+    0x2c, 0x2a, 0xb4, 0x8a, 0xa7, 0x34, 0xae, 0xaf, 0xaa, 0xf3, 0x96, 0x15,
+    0xac, 0xd9, 0x2b, 0xdf, 0xb3, 0x80, 0xab, 0xfb, 0xac, 0x10, 0xac, 0x60,
+    0xb2, 0x0b, 0xa9, 0xfd, 0x26, 0xad, 0x2d, 0xec, 0x30, 0x57, 0x2b, 0x47,
+    0xae, 0xf4, 0xa8, 0xc8, 0xaf, 0x3a, 0xa4, 0x2e, 0xa6, 0x8f, 0x2f, 0xd3,
+    0xa8, 0x54, 0x2f, 0xd0, 0x2e, 0x02, 0x30, 0x09, 0x30, 0x12, 0x21, 0x52,
+    0xac, 0xc6, 0xad, 0x2d, 0xac, 0x1f, 0x29, 0x3f, 0xad, 0x77, 0x2e, 0x2d,
+    0xae, 0x1f, 0xab, 0x93, 0xa3, 0xa7, 0x95, 0x70, 0xb0, 0x2a, 0x2f, 0x81,
+    0xb0, 0xec, 0x25, 0x64, 0xa7, 0x31, 0xae, 0x24, 0x28, 0xb1, 0xac, 0x45,
+    0xb0, 0x59, 0xae, 0x99, 0x1b, 0xc3, 0xa9, 0x39, 0x25, 0x03, 0x2c, 0x33,
+    0x31, 0xe0, 0xaa, 0x47, 0x29, 0x38, 0x2e, 0x4c, 0xad, 0x86, 0xad, 0xae,
+    0xad, 0xb0, 0xab, 0x14, 0xaf, 0x73, 0x30, 0x33, 0xb0, 0x39, 0xb1, 0xee,
+    0xaa, 0x8e, 0xa0, 0x9f, 0x2c, 0x3e, 0x21, 0x96, 0x9e, 0x0f, 0x90, 0xd6,
+    0xa7, 0x1c, 0xa3, 0x2a, 0xa6, 0xb5, 0x2f, 0x1f, 0x99, 0xc4, 0x27, 0x95,
+    0x30, 0x35, 0x2a, 0xe0, 0x2a, 0x47, 0xa8, 0x64, 0xad, 0xae, 0x2a, 0x74,
+    0x30, 0xd1, 0x2d, 0x64, 0xaa, 0x7c, 0x27, 0x3f, 0x2c, 0x55, 0x26, 0xb4,
+    0x27, 0x17, 0xa9, 0x4a, 0xa4, 0x2b, 0xa1, 0xbc, 0xb2, 0x23, 0xb0, 0x16,
+    0x29, 0xa9, 0xac, 0x18, 0xac, 0x9d, 0xa9, 0x21, 0x29, 0x0e, 0x2f, 0x0d,
+    0x2e, 0xfd, 0x29, 0x78, 0x31, 0x09, 0xac, 0x1b, 0xa9, 0x03, 0x9e, 0xa4,
+    0x35, 0x36, 0x28, 0x19, 0x28, 0xf7, 0xac, 0xff, 0xaf, 0xcb, 0x2d, 0xa2,
+    0xab, 0x34, 0xb0, 0x9f, 0xa4, 0xe8, 0x32, 0x45, 0x28, 0xe0, 0x27, 0x0f,
+    0xaf, 0x84, 0x31, 0x74, 0xb0, 0x40, 0x2d, 0x06, 0x30, 0x24, 0x23, 0x47,
+    0x26, 0xe9, 0x30, 0x36, 0x2b, 0x0b, 0xb0, 0x28, 0x2c, 0x41, 0xa9, 0x91,
+    0xa4, 0xf0, 0xac, 0x99, 0xb0, 0x5b, 0xab, 0x28, 0xac, 0xf8, 0x18, 0x20,
+    0xaa, 0x9b, 0xa5, 0x45, 0xaa, 0xff, 0xad, 0x3e, 0x2a, 0x2f, 0xad, 0x8c,
+    0xab, 0xea, 0xae, 0xf8, 0xad, 0x8a, 0x29, 0x2c, 0x2c, 0x8a, 0x2f, 0x3b,
+    0x30, 0x8f, 0x2f, 0x52, 0x2b, 0xb4, 0xa8, 0xbe, 0x23, 0xc0, 0xac, 0x9e,
+    0xb0, 0x1e, 0xae, 0x70, 0xaf, 0xab, 0xaa, 0xcd, 0xa9, 0xd3, 0xa4, 0xa0,
+    0xab, 0x84, 0xac, 0xeb, 0xac, 0x48, 0x2e, 0xe0, 0xaa, 0x23, 0xa4, 0xd5,
+    0x2f, 0xd7, 0xab, 0x1a, 0xac, 0x49, 0xa8, 0x45, 0x34, 0x46, 0x1d, 0xd2,
+    0xa9, 0xaa, 0xad, 0x88, 0xab, 0x78, 0x21, 0x8b, 0xab, 0xc1, 0xb2, 0x04,
+    0xad, 0xc7, 0x31, 0xc8, 0xac, 0x26, 0xad, 0x61, 0x2d, 0x06, 0xb1, 0xa4,
+    0x9b, 0x7d, 0xad, 0xba, 0x2d, 0xb7, 0x1c, 0x6b, 0xae, 0xf7, 0x31, 0xcc,
+    0x2a, 0xac, 0xb2, 0x16, 0x29, 0x9e, 0xab, 0x9d, 0x1b, 0xfb, 0xb0, 0xe0,
+    0xa4, 0x70, 0x2b, 0xea, 0x28, 0x84, 0x26, 0xcd, 0xa9, 0x8a, 0xa4, 0x26,
+    0xad, 0xb1, 0xa0, 0x7a, 0x2e, 0x70, 0xa6, 0x1f, 0x1f, 0xae, 0xae, 0xe0,
+    0xa9, 0x8e, 0xa5, 0xa4, 0x28, 0x2b, 0x26, 0x39, 0x2e, 0xbe, 0x9f, 0x00,
+    0x2d, 0xa8, 0xac, 0x87, 0x2a, 0x99, 0xad, 0x6f, 0xae, 0x0e, 0xb1, 0x44,
+    0xae, 0x33, 0xad, 0xd0, 0xad, 0xfc, 0xa2, 0x80, 0xae, 0x17, 0xa8, 0x05,
+    0xa7, 0x57, 0x2e, 0x81, 0xab, 0x8e, 0xac, 0x8f, 0x2d, 0x1e, 0x1a, 0x0f,
+    0xa7, 0x62, 0xaf, 0x79, 0x36, 0x16, 0xad, 0x2e, 0xa4, 0x68, 0xae, 0x46,
+    0xb2, 0x1d, 0x2c, 0x9a, 0xa8, 0x4d, 0xb0, 0xa7, 0xa4, 0x12, 0xad, 0x6f,
+    0x25, 0xbb, 0xad, 0x20, 0x21, 0x53, 0xa0, 0x01, 0x25, 0xeb, 0xb1, 0x1c,
+    0x30, 0x50, 0x9e, 0xf3, 0xaa, 0xb9, 0x25, 0x42, 0xa9, 0x96, 0x28, 0xb3,
+    0xad, 0xae, 0xae, 0xfa, 0xaa, 0xc4, 0x25, 0xf0, 0xac, 0xc5, 0xb0, 0x9c,
+    0xad, 0xb9, 0x2a, 0x58, 0xa6, 0x63, 0xb0, 0x0f, 0xaf, 0x2d, 0xb1, 0x0b,
+    0xac, 0x86, 0x0e, 0x13, 0xb0, 0x58, 0xa8, 0xd4, 0x2f, 0xbe, 0xa8, 0xa8,
+    0x9c, 0xba, 0x2c, 0x0c, 0xa1, 0x72, 0xa6, 0x05, 0x2a, 0x61, 0xa8, 0x2c,
+    0xac, 0xbb, 0xac, 0xa5, 0xab, 0xb2, 0xab, 0x0a, 0xac, 0x30, 0x29, 0xdd,
+    0xa7, 0x72, 0xac, 0xc2, 0xb0, 0x1a, 0xa8, 0x67, 0xad, 0xc9, 0x2d, 0xf4,
+    0xac, 0xe3, 0xad, 0xe9, 0x2b, 0x7c, 0x2c, 0xe5, 0xa9, 0x9f, 0xb3, 0x94,
+    0x31, 0x8c, 0xa8, 0xac, 0xac, 0xe7, 0xb0, 0x05, 0xb1, 0xb7, 0xb2, 0xb9,
+    0xa2, 0x76, 0xac, 0xbb, 0xa2, 0x3b, 0x28, 0xec, 0xaa, 0xf4, 0x96, 0x16,
+    0xaa, 0xf8, 0xac, 0x7d, 0xb0, 0x5a, 0xb3, 0x10, 0xa5, 0x38, 0x22, 0x8f,
+    0x2c, 0x7f, 0x32, 0xbe, 0xb0, 0x13, 0xaf, 0x2b, 0xa0, 0x8e, 0xad, 0x91,
+    0x28, 0x58, 0xa9, 0x60, 0xad, 0xbc, 0xaa, 0x38, 0x29, 0x66, 0x25, 0x91,
+    0xac, 0xbd, 0x1e, 0x5a, 0x21, 0x14, 0xac, 0x80, 0x2e, 0x74, 0x28, 0x63,
+    0xac, 0x19, 0x27, 0x69, 0x2c, 0x60, 0x2e, 0x88, 0x2a, 0xfc, 0x2d, 0x69,
+    0x2e, 0x47, 0x2e, 0x7b, 0x9c, 0x38, 0x28, 0x13, 0xaf, 0x94, 0xb0, 0xe1,
+    0xb0, 0x76, 0x20, 0xb3, 0xa9, 0xb8, 0x9d, 0x78, 0x31, 0xa7, 0xa2, 0xf0,
+    0x29, 0xc3, 0x25, 0x65, 0xac, 0xea, 0x9a, 0x73, 0xa9, 0x51, 0x2b, 0x22,
+    0xa9, 0x25, 0x28, 0x3c, 0xa6, 0x07, 0x25, 0xbb, 0x32, 0xc8, 0xa4, 0x8d,
+    0xad, 0x9e, 0xa8, 0xd1, 0xac, 0x4b, 0x26, 0xca, 0xa8, 0x2f, 0xb0, 0xa9,
+    0xae, 0x2c, 0x8f, 0x7f, 0xa1, 0x37, 0xae, 0x01, 0x9a, 0x34, 0x2e, 0x04,
+    0x28, 0xf5, 0xae, 0x16, 0x29, 0x70, 0x2b, 0x87, 0x20, 0xc8, 0xa1, 0xb4,
+    0xaf, 0x09, 0xa5, 0x41, 0xad, 0x12, 0xb0, 0x4a, 0xa4, 0xa4, 0xad, 0xa3,
+    0xa4, 0xaa, 0xab, 0x28, 0x24, 0xb6, 0x1e, 0x12, 0xab, 0x34, 0x2f, 0x25,
+    0x23, 0x4c, 0x29, 0x4f, 0xa8, 0xac, 0x25, 0xdd, 0xa9, 0x43, 0x21, 0x9e,
+    0x2e, 0x1c, 0x2f, 0x98, 0x2f, 0x5b, 0xa3, 0x9c, 0x19, 0xf7, 0x2b, 0x71,
+    0x2b, 0x98, 0x29, 0x10, 0xaf, 0xcb, 0xa8, 0xaf, 0xa9, 0xf8, 0xb3, 0x50,
+    0xaa, 0x22, 0xaa, 0xb3, 0x9c, 0xe9, 0x23, 0x5a, 0xa3, 0x00, 0x26, 0x56,
+    0xaa, 0x31, 0x2a, 0x89, 0xa5, 0x36, 0xb0, 0xcc, 0x24, 0x12, 0xa8, 0xa7,
+    0xa1, 0xa8, 0xb0, 0xe6, 0x32, 0x1f, 0xab, 0x23, 0x24, 0x79, 0xac, 0xc5,
+    0xa8, 0xfc, 0xac, 0xdd, 0x2a, 0x70, 0x24, 0x25, 0x2a, 0x92, 0x32, 0xb1,
+    0x2c, 0xc8, 0x22, 0xa5, 0xa0, 0x36, 0xa9, 0x11, 0xa3, 0x90, 0xac, 0xe1,
+    0xac, 0x39, 0xa0, 0x44, 0xa2, 0xbc, 0xaf, 0x83, 0x1b, 0x9e, 0x31, 0xc6,
+    0x30, 0x8a, 0x28, 0xfc, 0x21, 0xbb, 0xa1, 0xe7, 0xa7, 0xa5, 0xac, 0xe8,
+    0x2d, 0x0e, 0xb2, 0x9b, 0x30, 0xa1, 0x2d, 0x60, 0x2a, 0x9a, 0x26, 0x89,
+    0x24, 0xc4, 0x2e, 0x8b, 0x2d, 0x95, 0x12, 0x3c, 0xaa, 0x14, 0xab, 0x36,
+    0x24, 0x17, 0x2c, 0x07, 0x2d, 0x5f, 0x2c, 0x31, 0xa8, 0x73, 0xac, 0x3c,
+    0x24, 0x07, 0x23, 0xd2, 0x2a, 0xd6, 0x28, 0xea, 0x23, 0xf3, 0xac, 0x83,
+    0x2a, 0x2d, 0xa6, 0xa8, 0x28, 0x4f, 0xad, 0x3f, 0x32, 0x1b, 0xb0, 0xbd,
+    0xa3, 0x3d, 0x16, 0xb6, 0xa6, 0xc1, 0x2c, 0x3d, 0x24, 0x83, 0x28, 0x4c,
+    0x2d, 0xda, 0x16, 0xe9, 0x30, 0x08, 0x2c, 0x5f, 0x2f, 0x53, 0x29, 0x01,
+    0x2c, 0x02, 0xb1, 0xf6, 0x19, 0x77, 0xa9, 0xb1, 0x28, 0x33, 0xab, 0x73,
+    0xb0, 0x0d, 0x30, 0x2b, 0x2c, 0x84, 0x2a, 0x22, 0x2c, 0xa7, 0x30, 0xc9,
+    0x9e, 0xcc, 0x2d, 0x70, 0xa3, 0x3d, 0x30, 0x5a, 0x24, 0x38, 0x9f, 0x17,
+    0x20, 0x72, 0xa4, 0x63, 0x2c, 0x1b, 0xad, 0x4e, 0x32, 0x53, 0xac, 0x48,
+    0x30, 0x07, 0xa9, 0x2a, 0x2c, 0x76, 0xa4, 0xb0, 0x95, 0x15, 0xae, 0xd2,
+    0xa6, 0x4f, 0x29, 0x2f, 0x30, 0x50, 0x2d, 0x03, 0xad, 0x9d, 0x31, 0xe3,
+    0x28, 0x31, 0x22, 0x4c, 0x29, 0xe9, 0xac, 0xc6, 0x2f, 0x39, 0x1d, 0x9b,
+    0x2e, 0xd3, 0xac, 0xf2, 0x2e, 0x9d, 0x2a, 0x76, 0x2d, 0x5b, 0xa8, 0x38,
+    0x26, 0x35, 0xa9, 0xd8, 0x2e, 0x5d, 0xad, 0x82, 0xab, 0x3f, 0xad, 0xa9,
+    0x29, 0x8e, 0x2d, 0x1f, 0x30, 0xf7, 0x24, 0x4c, 0x24, 0xc5, 0xa3, 0xac,
+    0x2d, 0x79, 0x30, 0x81, 0x30, 0x27, 0xae, 0xa2, 0x28, 0xa7, 0xa9, 0x93,
+    0xaa, 0x4c, 0x2a, 0xfa, 0xa5, 0x36, 0x2c, 0x7e, 0xaf, 0xba, 0xa4, 0x4a,
+    0x2e, 0x9a, 0x25, 0xd3, 0x28, 0x4d, 0x2e, 0x36, 0x2c, 0x67, 0xad, 0xd0,
+    0xb0, 0x39, 0x2d, 0xf5, 0x29, 0x40, 0xac, 0x90, 0x25, 0x4f, 0x9d, 0x5f,
+    0x2d, 0xa1, 0x31, 0xd3, 0x29, 0x27, 0x30, 0xde, 0x2b, 0x39, 0x2e, 0xeb,
+    0x30, 0xb7, 0x2d, 0x26, 0xa6, 0xdb, 0xac, 0x42, 0xab, 0x36, 0x2f, 0x29,
+    0xa5, 0x76, 0xae, 0x1c, 0x30, 0x6a, 0x2a, 0xde, 0x28, 0x05, 0xa4, 0xac,
+    0x2d, 0x90, 0x2a, 0xc2, 0x29, 0xf0, 0x2c, 0x15, 0x2e, 0xfe, 0x31, 0x91,
+    0x2d, 0x2d, 0x2e, 0x43, 0x2a, 0x1b, 0x91, 0x49, 0xaf, 0x92, 0x2f, 0xae,
+    0xaa, 0x4c, 0x22, 0xfe, 0x2f, 0xa8, 0x28, 0x69, 0x1c, 0x33, 0xad, 0xac,
+    0x2d, 0x6e, 0x9d, 0xa8, 0x2a, 0x34, 0xac, 0x29, 0xa8, 0xf6, 0xa4, 0x17,
+    0x1e, 0x06, 0x23, 0xb3, 0xa4, 0x35, 0xb1, 0xf3, 0x2f, 0x42, 0xa3, 0x0a,
+    0xaf, 0xc0, 0x30, 0x32, 0x2e, 0x76, 0x2d, 0x1b, 0x2e, 0x11, 0xa2, 0x0d,
+    0xa5, 0x6c, 0x24, 0x5e, 0x28, 0xa6, 0x25, 0x89, 0x24, 0xa1, 0x2e, 0x4d,
+    0xa9, 0x4b, 0xac, 0x2c, 0x30, 0x29, 0xaf, 0x10, 0x25, 0x7c, 0x97, 0x92,
+    0xb1, 0xd5, 0xae, 0xd0, 0xaf, 0xce, 0xa1, 0xc5, 0x30, 0x37, 0xa8, 0x63,
+    0xb0, 0x4d, 0x24, 0x10, 0xa9, 0x14, 0xad, 0xff, 0x31, 0x51, 0x2a, 0xa8,
+    0x2d, 0xdc, 0xaf, 0xde, 0x90, 0x72, 0x2b, 0x77, 0x26, 0x15, 0xad, 0xc1,
+    0xaf, 0x31, 0x30, 0xa4, 0x98, 0x0a, 0x2b, 0xbe, 0xa2, 0xfb, 0x2c, 0x1f,
+    0x2b, 0x43, 0x28, 0x6c, 0xae, 0x3e, 0xaa, 0x94, 0xa7, 0x1c, 0x26, 0x19,
+    0xb0, 0x30, 0xa6, 0x78, 0xb1, 0xc1, 0x28, 0x16, 0x25, 0x04, 0xac, 0x74,
+    0x30, 0x3c, 0x24, 0xc5, 0xae, 0x83, 0x24, 0x4c, 0xa9, 0x8b, 0xa8, 0x49,
+    0x2a, 0x3e, 0xae, 0xd7, 0x2b, 0x05, 0x9f, 0x33, 0xb2, 0x47, 0x8c, 0xe6,
+    0xa8, 0x02, 0x26, 0x94, 0xaf, 0x3b, 0x2b, 0xba, 0xa1, 0xf3, 0x27, 0x72,
+    0x9c, 0x49, 0x2d, 0x47, 0x2f, 0xbb, 0x30, 0xfd, 0xae, 0x8f, 0xb1, 0x26,
+    0x21, 0x96, 0xa9, 0x64, 0x2e, 0x02, 0x30, 0x7e, 0x2d, 0x02, 0x32, 0xfe,
+    0xa9, 0xd4, 0x30, 0x0e, 0x31, 0x65, 0x2d, 0x10, 0xb0, 0x5b, 0x20, 0x54,
+    0x2e, 0xff, 0xae, 0x7a, 0x26, 0xcb, 0x26, 0x75, 0x22, 0x85, 0xb0, 0x93,
+    0x9b, 0xc4, 0xaa, 0xb9, 0x2f, 0xb2, 0xa2, 0xff, 0x29, 0x79, 0xac, 0xda,
+    0x32, 0xbc, 0x9a, 0xb1, 0x2b, 0x4a, 0xa8, 0x13, 0x2f, 0x56, 0xab, 0xc5,
+    0x2c, 0x6c, 0xa8, 0x25, 0xa9, 0x9a, 0xa1, 0xea, 0x9e, 0xde, 0xa1, 0xb3,
+    0xb0, 0x75, 0xaa, 0x76, 0x2b, 0x7c, 0x27, 0x92, 0x31, 0xcf, 0xab, 0x50,
+    0x21, 0x01, 0x9c, 0x4a, 0xb1, 0xa8, 0x24, 0x7b, 0xa6, 0xc9, 0xa2, 0xc5,
+    0x2e, 0x96, 0x25, 0x4c, 0x2c, 0xc2, 0x30, 0x1e, 0xa0, 0x63, 0x2c, 0x2b,
+    0x20, 0x6e, 0x2c, 0xd6, 0xae, 0xa9, 0xa5, 0x2f, 0xac, 0x13, 0x34, 0xe9,
+    0x24, 0x23, 0xae, 0x9a, 0x24, 0x87, 0xad, 0xd6, 0x2e, 0x7d, 0xa9, 0x42,
+    0x2f, 0xf5, 0xac, 0x46, 0x28, 0xbf, 0x27, 0x2e, 0xa4, 0x66, 0x24, 0xd7,
+    0x30, 0x26, 0x2d, 0x59, 0xb1, 0x40, 0x2b, 0xc6, 0x30, 0x4b, 0x9f, 0xdb,
+    0xa7, 0x30, 0xa5, 0x16, 0xab, 0x42, 0xad, 0x1a, 0x99, 0xad, 0x2d, 0x07,
+    0x29, 0xbf, 0xa8, 0x09, 0x30, 0x10, 0xac, 0x65, 0x2d, 0xdb, 0xaa, 0x6b,
+    0xb0, 0x66, 0xaa, 0x7e, 0x2c, 0x7a, 0x34, 0x5b, 0xa2, 0xba, 0xa7, 0xc3,
+    0x23, 0x02, 0xa9, 0xfd, 0x25, 0xd0, 0xa1, 0x3c, 0xaf, 0xb8, 0xa5, 0x84,
+    0x2d, 0xdf, 0x28, 0xe2, 0x30, 0x5e, 0xac, 0x4f, 0x99, 0x0d, 0xb0, 0x3b,
+    0xb1, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4e, 0xde, 0xff, 0xff, 0x04, 0x00,
+    0x00, 0x00, 0x40, 0x02, 0x43, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x9a, 0xde, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x01, 0x00, 0x20, 0x00, 0x00, 0xf6, 0x32, 0x27, 0x29, 0x4c, 0x23,
+    0x30, 0xb3, 0x9f, 0xa4, 0x51, 0x2f, 0xa2, 0x19, 0x2d, 0xa3, 0xfa, 0xb0,
+    0x0f, 0xa2, 0x5c, 0x31, 0x9e, 0x34, 0x70, 0xb4, 0x6e, 0xac, 0x3f, 0xb4,
+    0x4c, 0xa7, 0xe2, 0xae, 0xb4, 0xb1, 0xc8, 0xae, 0x9d, 0x33, 0x6e, 0xb4,
+    0x3d, 0xae, 0x7a, 0xb3, 0x6e, 0x30, 0xcf, 0xa0, 0xdc, 0xb2, 0x2c, 0x2b,
+    0x1c, 0xb1, 0xb9, 0xae, 0xb5, 0x2e, 0x78, 0x34, 0x04, 0x26, 0x57, 0x24,
+    0x7f, 0xa9, 0xb7, 0xb4, 0x96, 0x30, 0xbe, 0x30, 0x80, 0xab, 0xe8, 0x2d,
+    0x8a, 0x9f, 0x40, 0xb0, 0xe8, 0x2c, 0x13, 0xa9, 0xa5, 0x34, 0x18, 0x2c,
+    0x46, 0xb3, 0x9b, 0x0f, 0xe6, 0x2f, 0x1a, 0xb1, 0x4e, 0xb0, 0x36, 0xaf,
+    0xfb, 0xa9, 0x17, 0xb6, 0xf9, 0xb5, 0x9e, 0xb0, 0xab, 0xb0, 0xcc, 0xaa,
+    0xee, 0x1d, 0x21, 0x30, 0x0c, 0xb1, 0xb2, 0xae, 0xee, 0x31, 0xdc, 0x32,
+    0x9a, 0x31, 0xb0, 0x26, 0xbc, 0x2f, 0xd4, 0xb1, 0xb7, 0x31, 0x19, 0x1a,
+    0xc1, 0x96, 0x8b, 0x2b, 0x53, 0x2b, 0x61, 0xaa, 0x5f, 0x2c, 0x84, 0x2d,
+    0xff, 0x34, 0x5a, 0xb3, 0xf8, 0xb3, 0xbe, 0xac, 0x07, 0x31, 0xcb, 0x2f,
+    0x66, 0xaf, 0x5b, 0x2f, 0x4e, 0x32, 0x2c, 0xb1, 0xc8, 0xb4, 0xb8, 0xb3,
+    0x57, 0xa1, 0x2c, 0xab, 0x77, 0x2e, 0xba, 0xa3, 0x98, 0xb0, 0xc8, 0xa4,
+    0xe8, 0x30, 0xac, 0x2b, 0x28, 0xaf, 0x64, 0xa9, 0xd0, 0x33, 0xce, 0xae,
+    0x3d, 0xb0, 0x85, 0x2d, 0x1f, 0x2c, 0x5e, 0x31, 0xab, 0xae, 0x4a, 0x30,
+    0x6a, 0x34, 0x5f, 0x30, 0xc9, 0x32, 0x24, 0xb5, 0xc3, 0xa9, 0x4a, 0xb2,
+    0x6e, 0xa5, 0xd5, 0x28, 0xdf, 0xa4, 0x60, 0x30, 0x0a, 0x2f, 0xba, 0xb5,
+    0x73, 0xa2, 0xb3, 0xb3, 0x4b, 0x32, 0x38, 0xb3, 0x88, 0x26, 0xa6, 0xb0,
+    0x17, 0x28, 0x62, 0xb1, 0x92, 0x32, 0xfe, 0x2a, 0x22, 0x34, 0xb3, 0xac,
+    0x11, 0xaa, 0xb9, 0x11, 0x23, 0xb4, 0xec, 0xa8, 0x98, 0x2b, 0xfd, 0xb3,
+    0xc7, 0xb0, 0x22, 0x2c, 0xa7, 0xad, 0x34, 0xa4, 0x67, 0xb2, 0xcb, 0xad,
+    0x1d, 0xb5, 0xfb, 0x32, 0x70, 0x31, 0xc9, 0x29, 0x28, 0xb4, 0xa3, 0x1b,
+    0x3f, 0xae, 0x71, 0xaa, 0x63, 0xb3, 0xd3, 0xb0, 0xc0, 0xb3, 0xf6, 0xac,
+    0xc3, 0xaf, 0x3a, 0xab, 0x23, 0xa9, 0x08, 0xb0, 0x83, 0xb0, 0xca, 0xac,
+    0x88, 0xb1, 0xf8, 0x2d, 0x64, 0x18, 0x6d, 0xb0, 0x74, 0xb2, 0x1a, 0xb2,
+    0x70, 0xb4, 0x5b, 0xb6, 0xa8, 0xb0, 0x14, 0xa3, 0x36, 0xa7, 0xe4, 0xaa,
+    0xf7, 0xb4, 0xbb, 0xa9, 0x8b, 0xb3, 0x4c, 0x34, 0xcd, 0x2a, 0xdf, 0x30,
+    0xc3, 0xb1, 0xc5, 0xb0, 0x2c, 0x26, 0x6d, 0xb0, 0xeb, 0x22, 0x70, 0xa9,
+    0x2d, 0xb5, 0x60, 0x2b, 0x09, 0xac, 0x22, 0x1f, 0xb4, 0xaf, 0xe1, 0x18,
+    0x7c, 0xb4, 0xa9, 0x2c, 0x2b, 0xb5, 0xa4, 0xb5, 0xf5, 0x2f, 0x30, 0x29,
+    0x6d, 0xb8, 0x20, 0xac, 0x60, 0x25, 0xf8, 0xac, 0x11, 0xb0, 0x6e, 0xb4,
+    0x9b, 0xb2, 0x53, 0x34, 0x2a, 0xaf, 0x83, 0xb4, 0xeb, 0x2c, 0x38, 0xa9,
+    0xd1, 0x2a, 0x4e, 0x9f, 0x06, 0xb3, 0x8c, 0xb4, 0x5a, 0x2a, 0xd1, 0xb2,
+    0x67, 0xb1, 0x45, 0xb4, 0xea, 0xb1, 0xf1, 0xb0, 0xea, 0x1a, 0x5b, 0x32,
+    0xb0, 0xb3, 0x3d, 0x2c, 0x13, 0xa8, 0xdc, 0x19, 0x0e, 0xb1, 0x34, 0xb4,
+    0xcd, 0x30, 0x7a, 0xa0, 0x65, 0xb6, 0xa8, 0x30, 0xec, 0xb0, 0x30, 0x2e,
+    0xbd, 0x34, 0x62, 0xb4, 0x3e, 0xb4, 0xbf, 0x31, 0xe4, 0xad, 0xb5, 0xb1,
+    0x7e, 0xb4, 0x60, 0xb8, 0xd2, 0xb3, 0x83, 0x2e, 0x37, 0xb4, 0x22, 0xae,
+    0x99, 0x36, 0xfb, 0xb2, 0x8c, 0xb4, 0x56, 0xb5, 0x4f, 0xb2, 0x10, 0x27,
+    0xb0, 0xaf, 0x28, 0x37, 0xf6, 0xb2, 0x27, 0x31, 0xdb, 0x28, 0xdc, 0x2d,
+    0x50, 0xb2, 0x63, 0x36, 0xf9, 0x35, 0x94, 0x2a, 0xe3, 0x2f, 0x32, 0xb1,
+    0x20, 0x35, 0x95, 0xa2, 0xca, 0x32, 0x21, 0x33, 0xea, 0xb3, 0xb2, 0xb3,
+    0xa1, 0xb3, 0xbe, 0x32, 0x8b, 0xae, 0xf4, 0x35, 0x95, 0xaa, 0x3c, 0x30,
+    0x13, 0xa9, 0xe5, 0xb1, 0x8a, 0x2e, 0x86, 0x34, 0x14, 0x2f, 0x23, 0x2d,
+    0x36, 0xac, 0x51, 0xa1, 0xcf, 0x33, 0x85, 0xb1, 0x95, 0xac, 0xb0, 0xb0,
+    0x9f, 0xaf, 0x87, 0xac, 0xeb, 0xaf, 0x1b, 0x36, 0xd0, 0x31, 0x6f, 0x20,
+    0xae, 0xad, 0xa8, 0xa8, 0x14, 0x32, 0xfc, 0xab, 0x0e, 0x2f, 0x86, 0x31,
+    0xd4, 0x9f, 0x57, 0xb1, 0xde, 0xb1, 0x43, 0xaa, 0x2b, 0xb2, 0xf3, 0x29,
+    0xdd, 0xac, 0x19, 0xb0, 0x87, 0xaf, 0x00, 0xb3, 0x8f, 0x2e, 0x0f, 0x34,
+    0xce, 0x34, 0xb1, 0xb0, 0x10, 0xaf, 0x44, 0xad, 0x26, 0x2f, 0xca, 0x26,
+    0x27, 0x33, 0xf5, 0x28, 0x2d, 0xac, 0xcc, 0xb1, 0x67, 0xaf, 0x8c, 0x30,
+    0xb4, 0x2e, 0x43, 0x30, 0xb4, 0xae, 0x0e, 0x30, 0xe8, 0x33, 0xd1, 0x2c,
+    0x17, 0xa0, 0xb7, 0x97, 0x9a, 0x31, 0xe0, 0xb2, 0x32, 0xad, 0xe4, 0x25,
+    0x81, 0x14, 0xbd, 0xa6, 0xbd, 0xb5, 0x63, 0x30, 0x49, 0x26, 0x6f, 0x25,
+    0xb1, 0x2c, 0x2d, 0x32, 0x88, 0x33, 0x47, 0xb3, 0xee, 0x28, 0xd9, 0xb4,
+    0x84, 0x2c, 0x95, 0xb1, 0xb8, 0x2c, 0x69, 0x2f, 0x93, 0x29, 0x6b, 0xa5,
+    0x61, 0x33, 0xaf, 0x31, 0xfc, 0xae, 0x89, 0x32, 0x1b, 0xb4, 0x54, 0x32,
+    0x7d, 0x31, 0x51, 0xa4, 0x5e, 0x30, 0x96, 0xa7, 0xe2, 0x32, 0x38, 0xb2,
+    0x00, 0xb0, 0x64, 0x29, 0x32, 0x24, 0xbc, 0xb6, 0x0d, 0xb8, 0x42, 0x33,
+    0xeb, 0x30, 0xda, 0xb3, 0x03, 0x32, 0x03, 0x2c, 0xfb, 0x31, 0x11, 0xb3,
+    0xbd, 0xac, 0xb8, 0xb4, 0x9c, 0x28, 0x64, 0xa0, 0x23, 0xae, 0x3c, 0x33,
+    0x1b, 0xa2, 0x6a, 0xad, 0x86, 0x33, 0xcd, 0xb7, 0x55, 0xb1, 0x66, 0xb4,
+    0xd0, 0x36, 0xa7, 0x2e, 0x9c, 0xb2, 0xbd, 0xa9, 0x02, 0xb2, 0xa1, 0x24,
+    0x08, 0xac, 0xbe, 0x33, 0xc7, 0x2d, 0xa8, 0x31, 0xa2, 0x35, 0xa0, 0x34,
+    0x47, 0x34, 0x64, 0xa6, 0x75, 0x34, 0xc8, 0xb6, 0xa9, 0xac, 0x4c, 0xa2,
+    0x4e, 0x33, 0xcc, 0x31, 0x45, 0xb0, 0xc4, 0x26, 0x55, 0x33, 0xec, 0xa6,
+    0x1f, 0xb3, 0xea, 0xb6, 0xc3, 0xab, 0xdf, 0x36, 0xa2, 0x2c, 0xf4, 0xb7,
+    0x8e, 0xb6, 0xc9, 0xb5, 0xe2, 0x34, 0x9e, 0xaf, 0x1d, 0xb4, 0xa6, 0x32,
+    0x3b, 0xb1, 0xd7, 0x2c, 0xdc, 0xb0, 0xb1, 0x32, 0xca, 0x23, 0x75, 0x35,
+    0x41, 0xa6, 0x8e, 0x35, 0x2e, 0x38, 0x5b, 0x2d, 0x00, 0x33, 0x30, 0xb5,
+    0xff, 0xa9, 0x62, 0x32, 0x5d, 0xb3, 0xad, 0x34, 0x38, 0x26, 0xdc, 0x2e,
+    0xbb, 0x32, 0xcf, 0xa0, 0x61, 0xb4, 0x5e, 0xb1, 0x8a, 0xac, 0xf4, 0x31,
+    0xd7, 0xa7, 0x8e, 0xb8, 0x1a, 0xb4, 0xe3, 0xb6, 0x12, 0x38, 0x4c, 0xad,
+    0xfc, 0xb1, 0x11, 0x36, 0x3f, 0xb0, 0x99, 0x35, 0x2e, 0xb2, 0x70, 0xa9,
+    0x4c, 0xaa, 0xc8, 0x31, 0x3c, 0xab, 0xe1, 0x2e, 0xf7, 0x34, 0x99, 0x34,
+    0x66, 0x34, 0x74, 0xae, 0x9c, 0x28, 0xba, 0x32, 0x1e, 0xb3, 0x8d, 0x34,
+    0xff, 0x28, 0xc2, 0x2d, 0xdd, 0x20, 0xb1, 0xb0, 0xc4, 0xb1, 0xfb, 0x2c,
+    0x89, 0x2a, 0x59, 0xb2, 0x0a, 0xaa, 0xc8, 0xb8, 0xf8, 0xb6, 0x2b, 0xb6,
+    0x25, 0x38, 0x0f, 0x2b, 0xb8, 0x2f, 0x25, 0x33, 0x6e, 0xa5, 0x9c, 0x31,
+    0xb7, 0xb0, 0x2b, 0xb3, 0x98, 0x31, 0xf9, 0x37, 0xc9, 0xb5, 0x7c, 0x2f,
+    0xf6, 0x2d, 0x67, 0x2b, 0x1e, 0x31, 0xba, 0xb0, 0x56, 0x2d, 0xe0, 0x35,
+    0x9b, 0xb7, 0x18, 0x37, 0x2a, 0xad, 0x4d, 0x34, 0x36, 0x34, 0x8f, 0x30,
+    0xff, 0xb6, 0x9f, 0x2e, 0x63, 0xaf, 0x17, 0xb6, 0x99, 0xb1, 0xdc, 0xa4,
+    0x7d, 0x30, 0xaf, 0xb3, 0xd5, 0x32, 0x34, 0xaf, 0xb1, 0x23, 0x2a, 0x34,
+    0x86, 0xb0, 0x5f, 0x2c, 0xc2, 0x34, 0xf7, 0xae, 0x82, 0xb3, 0x4e, 0x2e,
+    0x55, 0x36, 0x9c, 0x35, 0x86, 0x34, 0x46, 0x30, 0x79, 0x37, 0x99, 0x34,
+    0x92, 0xb3, 0xfe, 0x34, 0x9f, 0xa6, 0xdb, 0x9d, 0x3f, 0x36, 0xf9, 0x38,
+    0x0b, 0x26, 0x25, 0xa1, 0x8a, 0xad, 0xd5, 0x21, 0xfc, 0x14, 0x1b, 0x34,
+    0x34, 0x26, 0xb8, 0x96, 0xf2, 0x30, 0x15, 0xb4, 0xfa, 0x2e, 0x58, 0xb1,
+    0x0c, 0x2c, 0xb5, 0x2f, 0x18, 0x33, 0x07, 0x2f, 0x54, 0x34, 0x89, 0xac,
+    0x4e, 0xb2, 0xd4, 0xb3, 0x4d, 0x37, 0x93, 0x30, 0x40, 0xad, 0xc9, 0x31,
+    0x26, 0x35, 0x88, 0x36, 0x0b, 0x27, 0x40, 0xaa, 0x14, 0x31, 0x08, 0xb1,
+    0xdb, 0x36, 0x92, 0x37, 0xc9, 0xb0, 0xfa, 0x2b, 0x85, 0x29, 0xad, 0xb0,
+    0x4d, 0xaf, 0x54, 0x31, 0xe5, 0x30, 0xfa, 0xa6, 0x26, 0x32, 0x5e, 0x2e,
+    0xa9, 0x1c, 0x52, 0x30, 0x5a, 0xb0, 0xa2, 0xa3, 0xff, 0xb0, 0x6a, 0x2e,
+    0x42, 0x35, 0xfc, 0x2f, 0xca, 0xa8, 0x91, 0xab, 0x7b, 0x36, 0xac, 0x31,
+    0x26, 0x33, 0x57, 0x35, 0x14, 0x36, 0xb8, 0x34, 0x30, 0xa9, 0x05, 0xb1,
+    0xab, 0x34, 0x1e, 0xaa, 0x44, 0x37, 0x0b, 0x38, 0xd8, 0xb2, 0xcb, 0x32,
+    0xde, 0xae, 0x83, 0xb1, 0x3b, 0x2e, 0xd0, 0x34, 0xc4, 0xaa, 0xc6, 0x26,
+    0x06, 0x2e, 0x14, 0xb2, 0x7e, 0x30, 0x7d, 0x32, 0xaf, 0xb4, 0x14, 0x34,
+    0xae, 0xb4, 0x46, 0x32, 0x83, 0x34, 0x88, 0x2f, 0xb9, 0x15, 0xb3, 0x1e,
+    0xb4, 0x36, 0xa1, 0x33, 0xcb, 0x2f, 0x55, 0x33, 0x88, 0x38, 0x0c, 0x34,
+    0xc5, 0xb4, 0xef, 0xa8, 0xd3, 0x27, 0xce, 0x30, 0x1b, 0x38, 0x50, 0x35,
+    0x83, 0xae, 0x32, 0x33, 0x7d, 0x2f, 0xa0, 0xb5, 0x19, 0xb0, 0xa2, 0x30,
+    0x8f, 0x34, 0xa5, 0xb1, 0x27, 0x36, 0x65, 0xb2, 0x1f, 0x36, 0xf0, 0x22,
+    0x03, 0x2e, 0xfe, 0xa9, 0x68, 0xb2, 0xa4, 0x2a, 0x3d, 0xb4, 0xde, 0x30,
+    0x1f, 0xac, 0x85, 0x34, 0xd1, 0xb2, 0xfc, 0xac, 0x0e, 0x30, 0xcc, 0xb1,
+    0x02, 0x2d, 0xbd, 0x18, 0xf4, 0xb4, 0x6f, 0x30, 0x2c, 0x35, 0xa5, 0x34,
+    0xcd, 0xb5, 0x08, 0xac, 0xf1, 0x34, 0xd8, 0xa7, 0xf3, 0xac, 0x49, 0xaf,
+    0x22, 0xb5, 0xae, 0x33, 0x65, 0x1e, 0xc8, 0xb3, 0x1f, 0x32, 0x1d, 0xb4,
+    0xd3, 0x31, 0xfc, 0x2b, 0x36, 0x2d, 0xa5, 0xa9, 0xe0, 0xa6, 0x71, 0xaf,
+    0x5e, 0xb1, 0x6d, 0xb0, 0xe8, 0xb4, 0x7d, 0x35, 0xa3, 0x2e, 0x76, 0xab,
+    0x2d, 0x30, 0xc6, 0xb0, 0x82, 0xb4, 0x09, 0xb5, 0x81, 0xb2, 0x1f, 0x30,
+    0x8c, 0x30, 0xf9, 0x34, 0x4c, 0xb4, 0x4f, 0xb2, 0x8d, 0x34, 0xee, 0x2e,
+    0x00, 0xb5, 0x4a, 0xad, 0x69, 0xb0, 0x95, 0x2f, 0xa6, 0x27, 0xd5, 0xb0,
+    0x32, 0x2a, 0xef, 0x2d, 0xf4, 0x9f, 0xd0, 0x23, 0x2d, 0xa7, 0xb7, 0x2a,
+    0x35, 0xad, 0x49, 0xa8, 0x72, 0x34, 0x3e, 0x34, 0xbd, 0xb6, 0x5a, 0x27,
+    0x37, 0x2d, 0xc5, 0x19, 0xa7, 0x32, 0x4b, 0x2b, 0x6d, 0xb6, 0x8a, 0xaf,
+    0xa5, 0xac, 0xfe, 0xb0, 0xc1, 0x33, 0x53, 0x33, 0xd6, 0x2d, 0x71, 0xb2,
+    0xd2, 0xae, 0x4a, 0x29, 0x02, 0xac, 0x04, 0xb0, 0xe9, 0x24, 0x59, 0xa9,
+    0x6a, 0xb4, 0x20, 0xb2, 0xd9, 0x2d, 0x8f, 0x2e, 0xa7, 0x28, 0xdf, 0x31,
+    0x45, 0xa9, 0xf4, 0xb2, 0x08, 0xb2, 0x7c, 0xb0, 0x5a, 0x35, 0xe6, 0x30,
+    0xff, 0xb3, 0x49, 0xb4, 0x20, 0xb0, 0x7a, 0xb1, 0x6a, 0x9f, 0x30, 0xb6,
+    0xf0, 0xb3, 0x4f, 0xb5, 0xd7, 0xb0, 0x11, 0xa9, 0x26, 0xa4, 0x30, 0x2b,
+    0xc0, 0x2e, 0xef, 0xb1, 0x76, 0xb4, 0xc9, 0x2c, 0x4f, 0xa8, 0x98, 0xb4,
+    0x2d, 0x29, 0x76, 0x31, 0x5c, 0xb1, 0xc4, 0x2c, 0x71, 0xaf, 0x0b, 0x38,
+    0x4d, 0xa8, 0x73, 0xb3, 0xbc, 0xb0, 0xa6, 0xb4, 0x79, 0x29, 0x98, 0x2d,
+    0xc6, 0x32, 0x27, 0xb0, 0x67, 0xae, 0x13, 0x28, 0xf6, 0x1a, 0x2c, 0x29,
+    0x8c, 0xb1, 0xec, 0xb8, 0x9f, 0xa6, 0x16, 0xb1, 0x58, 0xb1, 0x8e, 0x32,
+    0x31, 0x37, 0x5c, 0x2c, 0xb0, 0xad, 0x8c, 0xb1, 0x2d, 0x31, 0xd4, 0xaf,
+    0x2c, 0x33, 0x7d, 0xb4, 0x7a, 0xae, 0x39, 0x32, 0xbd, 0xae, 0x9f, 0x32,
+    0x3b, 0x28, 0x5e, 0x35, 0x22, 0x31, 0x1d, 0xb2, 0xb2, 0xa9, 0xde, 0xb2,
+    0x33, 0xaa, 0x17, 0x32, 0x02, 0xb1, 0x89, 0xa0, 0xde, 0xb4, 0x1d, 0x33,
+    0x9a, 0xaf, 0x13, 0x31, 0x26, 0x30, 0xc6, 0xb6, 0x08, 0xb4, 0xaa, 0xb2,
+    0x1e, 0xb3, 0x87, 0x34, 0x5c, 0x35, 0x13, 0x31, 0x9a, 0xb1, 0xdb, 0xac,
+    0xa8, 0x32, 0x43, 0xb5, 0x15, 0x34, 0x0f, 0xb0, 0x47, 0xb1, 0x83, 0xb3,
+    0x7c, 0xb0, 0x9b, 0x31, 0x3a, 0xb4, 0x19, 0x30, 0x80, 0x34, 0xed, 0xb0,
+    0x26, 0x2c, 0x6d, 0xb0, 0xa1, 0xb5, 0x35, 0x33, 0x38, 0x23, 0x65, 0xb7,
+    0xab, 0xaa, 0xd2, 0x30, 0xa7, 0xb3, 0xaa, 0x30, 0xc7, 0xa8, 0x34, 0xb4,
+    0x7f, 0xa2, 0xa2, 0xb0, 0x12, 0xb6, 0x19, 0x2e, 0x45, 0x34, 0xbf, 0x2d,
+    0x92, 0xb3, 0xc5, 0x1f, 0x70, 0x34, 0xc5, 0xb7, 0xcb, 0x33, 0xb6, 0xb5,
+    0xd9, 0xb3, 0x09, 0xb6, 0x38, 0xb4, 0x53, 0x30, 0xd6, 0xb4, 0x84, 0xb2,
+    0x0f, 0x28, 0xc2, 0xb4, 0xa9, 0xa7, 0x6e, 0xb5, 0x49, 0xaa, 0x8f, 0x2e,
+    0x93, 0x2e, 0x17, 0xb8, 0xd6, 0x2d, 0x81, 0x2f, 0x53, 0xb5, 0x04, 0x2c,
+    0xee, 0x2d, 0xca, 0xb4, 0xf5, 0xac, 0xa6, 0x2e, 0x09, 0xb6, 0x69, 0x34,
+    0x62, 0x29, 0xe0, 0x33, 0x4e, 0xb3, 0x44, 0x2f, 0xb6, 0x31, 0x73, 0xb5,
+    0x3e, 0x33, 0xf6, 0x25, 0xea, 0xb1, 0x33, 0xb8, 0xd5, 0xa8, 0xe4, 0xb3,
+    0x49, 0xaf, 0x21, 0xad, 0x8f, 0xb4, 0x5e, 0x33, 0xbc, 0x1b, 0xcf, 0x23,
+    0x8a, 0x30, 0x02, 0xb6, 0x64, 0x2e, 0x41, 0xad, 0x05, 0xb0, 0xd0, 0xb6,
+    0xd1, 0xb3, 0xf6, 0xb4, 0xff, 0xad, 0xb7, 0xad, 0x2d, 0xb4, 0x6e, 0xb1,
+    0x55, 0x33, 0xe5, 0xb5, 0x52, 0xb5, 0x87, 0xb4, 0x90, 0x94, 0x76, 0x2b,
+    0xf1, 0xb6, 0xcc, 0xa0, 0x05, 0xb4, 0x5c, 0xac, 0xac, 0x33, 0x0e, 0x2e,
+    0x31, 0xaa, 0xef, 0xb0, 0x66, 0xaf, 0x32, 0xb1, 0x64, 0xb2, 0x99, 0xa8,
+    0x24, 0x29, 0x77, 0x9c, 0xc5, 0x24, 0x5b, 0xb3, 0x1a, 0xb0, 0x1a, 0xac,
+    0x65, 0x33, 0x91, 0xb0, 0x77, 0xa8, 0x90, 0xae, 0x03, 0xa8, 0xae, 0xa4,
+    0x16, 0x2a, 0x3b, 0xaf, 0x2a, 0xa3, 0x23, 0xb6, 0x52, 0xb4, 0xe0, 0xac,
+    0x6d, 0xa9, 0x15, 0x29, 0x9d, 0xb4, 0x01, 0xb1, 0xde, 0xb3, 0x95, 0xa7,
+    0x62, 0x31, 0x15, 0xaf, 0x80, 0xac, 0xa4, 0xb1, 0x8e, 0xb2, 0xaf, 0xb2,
+    0xd6, 0xa9, 0x7f, 0x31, 0x02, 0x20, 0x15, 0x30, 0x51, 0x25, 0x0d, 0xb4,
+    0x0f, 0xaa, 0xb7, 0xb2, 0x36, 0xac, 0x35, 0xb1, 0xd3, 0xad, 0xef, 0xb4,
+    0xb9, 0xb4, 0x8b, 0xab, 0x62, 0x1d, 0xb1, 0xb4, 0x17, 0x31, 0x36, 0xad,
+    0xff, 0xb4, 0xb7, 0xb2, 0x26, 0xb0, 0xf9, 0xad, 0x6b, 0xad, 0x03, 0x28,
+    0xfd, 0xb3, 0xb6, 0x23, 0xd8, 0x33, 0x6d, 0xb4, 0x5d, 0x29, 0xd8, 0xb1,
+    0x4f, 0xb5, 0x11, 0x23, 0xf2, 0xb3, 0x32, 0x30, 0x54, 0xaa, 0xab, 0x2d,
+    0xba, 0x2f, 0xa7, 0xb4, 0x66, 0xae, 0x73, 0xb0, 0xf6, 0x33, 0xa7, 0xb5,
+    0x3a, 0xb6, 0xd7, 0xae, 0x40, 0xb5, 0xb7, 0x34, 0xcd, 0xa8, 0x19, 0xb6,
+    0x57, 0x2e, 0x50, 0xb3, 0xb5, 0xb0, 0x97, 0xb4, 0x2c, 0xab, 0xbb, 0xb1,
+    0xfc, 0xb4, 0x08, 0x32, 0x2c, 0xb5, 0x0e, 0x32, 0x58, 0x28, 0x54, 0xb1,
+    0xaf, 0x2c, 0x8b, 0x23, 0x31, 0x2f, 0x63, 0xac, 0x8f, 0xb6, 0x3c, 0x29,
+    0xf7, 0x2b, 0x33, 0xa9, 0xb8, 0x24, 0x0e, 0xb0, 0xe8, 0xb0, 0xf0, 0x18,
+    0x09, 0xb0, 0xf5, 0xb4, 0x4b, 0xb3, 0x11, 0xb0, 0x97, 0x30, 0x97, 0xad,
+    0xed, 0x1d, 0x44, 0xb4, 0x10, 0x2c, 0x76, 0xab, 0x28, 0xab, 0xb1, 0xb6,
+    0xff, 0xb1, 0x76, 0xac, 0x0b, 0xb4, 0x6e, 0x20, 0x1c, 0xb8, 0x94, 0xb4,
+    0xd5, 0x2f, 0x5a, 0x35, 0x00, 0xab, 0x61, 0xaf, 0x68, 0xb5, 0x94, 0xb5,
+    0xab, 0xa4, 0x5e, 0x32, 0x82, 0xb5, 0x1f, 0xb4, 0xd8, 0xb3, 0x88, 0xb0,
+    0xdb, 0xb0, 0x58, 0x30, 0x42, 0xb1, 0x5b, 0xa4, 0xa1, 0xb1, 0xf4, 0x2c,
+    0xb7, 0xac, 0x8d, 0x9b, 0x5d, 0xad, 0x62, 0x28, 0x5f, 0xae, 0x51, 0x2f,
+    0x92, 0xb6, 0xf0, 0xb0, 0x7a, 0xb1, 0x9b, 0x24, 0x9b, 0xb0, 0x51, 0x20,
+    0x3c, 0xb3, 0x0a, 0xb5, 0xfd, 0x31, 0xfc, 0x26, 0x9c, 0xb4, 0x53, 0x28,
+    0x5a, 0xb4, 0x15, 0xb5, 0xe4, 0xb2, 0x1f, 0xa6, 0x81, 0xb4, 0xec, 0xb0,
+    0x18, 0x2c, 0x8e, 0x2c, 0x29, 0x20, 0x32, 0xaf, 0x53, 0xae, 0x45, 0xb5,
+    0x06, 0xa1, 0x2a, 0x30, 0xad, 0xaf, 0x80, 0x30, 0xb6, 0xb3, 0x3e, 0xb0,
+    0x3c, 0x35, 0xcf, 0xb2, 0xc6, 0xb6, 0xa6, 0xb5, 0xb7, 0xad, 0x69, 0x30,
+    0x50, 0xb5, 0xb7, 0x32, 0x96, 0xac, 0x87, 0x28, 0xc4, 0xb1, 0x86, 0xab,
+    0x17, 0xb4, 0x7c, 0x33, 0x1f, 0xb2, 0x20, 0xae, 0x47, 0xaf, 0xe9, 0xac,
+    0x9e, 0xa9, 0xca, 0xb2, 0xf9, 0x2f, 0xae, 0xb4, 0x75, 0x29, 0x22, 0xa9,
+    0xa3, 0xb0, 0x4f, 0xb8, 0xc7, 0xb2, 0xd3, 0x32, 0xe3, 0xb0, 0xa0, 0xad,
+    0x44, 0xb0, 0x28, 0xb0, 0x94, 0x2e, 0xd7, 0xb2, 0xc6, 0xb0, 0x54, 0xb5,
+    0x51, 0x26, 0x47, 0xa9, 0xe8, 0xb6, 0xc9, 0xab, 0xcc, 0xb4, 0xd7, 0xac,
+    0x72, 0xaa, 0xd8, 0xaf, 0x8f, 0x2a, 0x01, 0xb0, 0x52, 0xb4, 0xb9, 0x9a,
+    0x7e, 0x34, 0xbf, 0xb2, 0x20, 0xac, 0xc1, 0x33, 0x49, 0xaa, 0xcc, 0x92,
+    0x6a, 0xa5, 0x19, 0xb4, 0x70, 0x34, 0x5c, 0x24, 0x58, 0xa4, 0xbf, 0x27,
+    0xf2, 0x33, 0xb8, 0x2e, 0x11, 0xa4, 0x37, 0x2a, 0xa4, 0x2a, 0xb0, 0xaa,
+    0xfb, 0xa9, 0x01, 0x32, 0xd6, 0x2e, 0x24, 0xb1, 0x2f, 0x2e, 0x69, 0xb1,
+    0x8f, 0x35, 0x05, 0xb0, 0xfd, 0x2f, 0x2f, 0xb8, 0xbc, 0x33, 0xcb, 0x29,
+    0x09, 0xad, 0x0d, 0x2e, 0xe7, 0x34, 0x95, 0xb4, 0xeb, 0x31, 0x69, 0x2c,
+    0x60, 0xad, 0x5c, 0x35, 0x53, 0x2a, 0xc1, 0xb3, 0xe5, 0x24, 0x21, 0x2e,
+    0xf1, 0x31, 0xa6, 0xa8, 0x5a, 0xa7, 0x47, 0x35, 0x1d, 0x35, 0xe7, 0x32,
+    0x99, 0x25, 0x95, 0xa5, 0x98, 0x28, 0x92, 0x33, 0xfa, 0x28, 0xdb, 0xac,
+    0x92, 0x36, 0xeb, 0xb4, 0x3d, 0x31, 0xbd, 0x32, 0x0b, 0x30, 0x05, 0xb6,
+    0xb7, 0x2f, 0x19, 0x2d, 0x57, 0x34, 0x5f, 0x31, 0x65, 0x37, 0x9f, 0xae,
+    0x8f, 0x2e, 0xcd, 0x32, 0x4d, 0x31, 0xa2, 0x36, 0x93, 0x31, 0x13, 0x30,
+    0xbd, 0x1f, 0x40, 0x37, 0xd4, 0x31, 0x96, 0xb4, 0x08, 0xb4, 0x42, 0x35,
+    0x22, 0x37, 0x31, 0x35, 0x28, 0xae, 0xf2, 0x26, 0xbb, 0x36, 0xf0, 0x31,
+    0xc8, 0x2b, 0xde, 0xb1, 0xd8, 0x37, 0xcf, 0xb2, 0xa4, 0x30, 0x34, 0x34,
+    0x59, 0x31, 0xc4, 0xae, 0x57, 0x33, 0xd4, 0x33, 0x7e, 0x37, 0xb5, 0x35,
+    0x97, 0x31, 0x89, 0x33, 0x7f, 0x31, 0x6a, 0x34, 0xd6, 0x32, 0x48, 0x35,
+    0x46, 0x30, 0x4a, 0x30, 0x2a, 0x22, 0xec, 0x37, 0xb7, 0x32, 0x19, 0xb4,
+    0xb5, 0xb4, 0xe7, 0x28, 0xa9, 0x36, 0x14, 0x35, 0x09, 0xb0, 0xa1, 0x34,
+    0x1a, 0x37, 0x13, 0x35, 0x1a, 0x32, 0x12, 0xb4, 0xf1, 0x35, 0xfe, 0xb0,
+    0x7b, 0x35, 0x94, 0x34, 0x1c, 0x2e, 0x6e, 0x32, 0x9e, 0x36, 0x10, 0xa7,
+    0x06, 0xae, 0x3a, 0xb4, 0xbf, 0x34, 0x7f, 0x32, 0x4a, 0x36, 0x89, 0x2f,
+    0x33, 0xb5, 0xc7, 0xb1, 0x81, 0x37, 0xa5, 0xb4, 0xd9, 0xa8, 0xb9, 0x31,
+    0x0d, 0x29, 0x72, 0xb3, 0x6a, 0xb4, 0xd7, 0xa8, 0x8a, 0x2e, 0xfc, 0x30,
+    0x90, 0xab, 0x0f, 0x36, 0xec, 0xa5, 0x77, 0x32, 0x49, 0x34, 0x55, 0xad,
+    0x3e, 0x2d, 0x67, 0xb2, 0x26, 0xac, 0x7e, 0xb3, 0x1c, 0x34, 0xaa, 0xb0,
+    0xb5, 0x2f, 0xce, 0xb1, 0xde, 0xad, 0x77, 0xb1, 0x43, 0x34, 0xce, 0x25,
+    0x16, 0x30, 0xab, 0x28, 0x50, 0xb2, 0x48, 0x30, 0x97, 0x36, 0x6e, 0xb5,
+    0x51, 0xaf, 0x08, 0xa5, 0x92, 0x30, 0x0b, 0x28, 0xcb, 0x31, 0x64, 0x2b,
+    0x0e, 0x2b, 0x81, 0x35, 0x36, 0xb1, 0xd2, 0x2a, 0x68, 0x31, 0x38, 0xa8,
+    0xe1, 0x30, 0x7d, 0x2e, 0x8e, 0x2e, 0x44, 0xb5, 0x1e, 0x35, 0xbf, 0x2c,
+    0x85, 0x21, 0x6d, 0xa8, 0x47, 0xb1, 0x67, 0xb1, 0x93, 0xb3, 0x3e, 0x2b,
+    0x59, 0x34, 0x92, 0xaa, 0xb3, 0x2b, 0x0e, 0xb0, 0x16, 0xac, 0xad, 0x2e,
+    0x5e, 0x35, 0x4e, 0xb2, 0x23, 0xb0, 0xfa, 0x2d, 0x44, 0x28, 0x4f, 0xa7,
+    0x97, 0x32, 0x6e, 0xa6, 0x15, 0x1b, 0x3d, 0x2e, 0xe2, 0xb0, 0xd8, 0xac,
+    0x65, 0x31, 0xdf, 0xa9, 0x34, 0x34, 0x7e, 0x32, 0x46, 0xad, 0x54, 0xb5,
+    0x00, 0x37, 0xfb, 0xa7, 0xdb, 0x31, 0x5e, 0x9f, 0x78, 0x29, 0x1b, 0xb4,
+    0x34, 0xaf, 0x4a, 0x23, 0x37, 0xb1, 0x12, 0x34, 0xe0, 0xaa, 0x9b, 0x2a,
+    0xa6, 0xb5, 0x56, 0xb0, 0xda, 0x20, 0x13, 0x32, 0x92, 0x2c, 0x4b, 0xaf,
+    0xbe, 0xa2, 0xd9, 0x2c, 0x37, 0x33, 0x01, 0xb0, 0x9e, 0xb0, 0x47, 0x2d,
+    0x6a, 0xab, 0x26, 0xb2, 0x99, 0x1b, 0xe3, 0xb0, 0x24, 0x22, 0x56, 0xa2,
+    0x35, 0xa9, 0x26, 0xa8, 0x9c, 0x34, 0xda, 0xb1, 0x31, 0x34, 0xf6, 0x34,
+    0x96, 0x32, 0x73, 0x31, 0xf0, 0xb1, 0xb2, 0xb1, 0x41, 0xb4, 0x47, 0x30,
+    0xb0, 0xb2, 0x8e, 0x26, 0x54, 0x2e, 0x82, 0x20, 0xd1, 0xa8, 0xbb, 0xab,
+    0x16, 0x32, 0x06, 0xb4, 0x04, 0xb0, 0x1b, 0xb1, 0x38, 0x31, 0x72, 0xaf,
+    0x06, 0x13, 0x3b, 0xb1, 0x04, 0xad, 0xcb, 0xb5, 0x40, 0xb4, 0x32, 0xb4,
+    0xb1, 0xaf, 0xe6, 0x2a, 0x19, 0xb5, 0xbc, 0xab, 0x91, 0xb6, 0x79, 0xaa,
+    0xb2, 0xaa, 0x5e, 0x31, 0x56, 0xaa, 0xf4, 0x30, 0xb1, 0xb2, 0x07, 0xb5,
+    0xf1, 0xaf, 0x8f, 0x2f, 0x29, 0x20, 0x7e, 0xab, 0x5c, 0xb2, 0xc3, 0xb0,
+    0xc2, 0xad, 0x35, 0xac, 0xfa, 0x2c, 0x59, 0xb4, 0xe9, 0xaa, 0xec, 0xa8,
+    0xbf, 0x2b, 0xc5, 0x2d, 0xd2, 0x2b, 0x7b, 0xb3, 0x9b, 0x2e, 0x83, 0xb2,
+    0x5d, 0xab, 0xf5, 0xad, 0x3b, 0x26, 0x29, 0xaa, 0x35, 0xb4, 0xa1, 0x1c,
+    0x25, 0xb5, 0x46, 0xb3, 0x8c, 0x97, 0xe7, 0x2e, 0xcf, 0x1b, 0x1b, 0x2c,
+    0x3f, 0xa2, 0x4a, 0xb0, 0x78, 0xb2, 0xb4, 0x2c, 0xba, 0xae, 0x53, 0xae,
+    0xf2, 0x1a, 0x79, 0x2c, 0x24, 0xac, 0x82, 0xa9, 0x2c, 0x98, 0xbb, 0xb3,
+    0xe4, 0xab, 0x19, 0x2a, 0x99, 0x30, 0x39, 0x30, 0xf0, 0xac, 0x2d, 0x24,
+    0x64, 0xae, 0xae, 0xb0, 0xfc, 0xb4, 0x72, 0xb4, 0xb2, 0x30, 0x40, 0xa4,
+    0x6f, 0xaf, 0x3a, 0x2f, 0xf7, 0xb4, 0xde, 0x28, 0x67, 0x2f, 0x57, 0xb4,
+    0xcd, 0x2e, 0x2e, 0x34, 0x34, 0xb4, 0xa4, 0xb3, 0xf2, 0xb1, 0x61, 0xab,
+    0x7e, 0x29, 0x0a, 0x28, 0x24, 0x30, 0x03, 0xb3, 0x9d, 0xaa, 0x26, 0xad,
+    0x9d, 0x2c, 0x06, 0xb5, 0xf3, 0x31, 0x4c, 0x31, 0x75, 0x2c, 0x7e, 0x30,
+    0x5c, 0x20, 0x22, 0xb0, 0xce, 0x31, 0x90, 0xb4, 0x3f, 0x24, 0xce, 0xaf,
+    0xd2, 0x25, 0xf0, 0x2c, 0x2d, 0xb4, 0x47, 0x28, 0x60, 0xb2, 0x54, 0xb0,
+    0xd6, 0x16, 0x76, 0xaf, 0x4c, 0xad, 0x5b, 0x29, 0xa6, 0xaf, 0x26, 0xb0,
+    0xac, 0xa5, 0x04, 0xb3, 0x88, 0x31, 0x1c, 0xb3, 0x32, 0x29, 0xb6, 0x2e,
+    0x42, 0xaf, 0x5e, 0xb3, 0x82, 0xb0, 0xd5, 0x34, 0xf5, 0xa4, 0xdb, 0x30,
+    0xe1, 0x32, 0x38, 0x2f, 0x3d, 0x2c, 0x6b, 0x30, 0x80, 0xb3, 0x48, 0xa8,
+    0x9b, 0xb3, 0x83, 0x32, 0x78, 0xac, 0x37, 0xa7, 0x13, 0x2c, 0xbd, 0xae,
+    0x90, 0x2f, 0x97, 0xad, 0x87, 0xb5, 0x24, 0x2b, 0x43, 0xac, 0x91, 0x2e,
+    0x69, 0xa1, 0x18, 0xb5, 0xe0, 0xb1, 0xfc, 0xb5, 0xc7, 0xad, 0xad, 0xb1,
+    0xc9, 0xae, 0x56, 0x2e, 0x04, 0x2c, 0x57, 0xb1, 0x25, 0x32, 0x12, 0x30,
+    0x4c, 0xa8, 0x4e, 0x32, 0x7c, 0x26, 0x75, 0x31, 0x95, 0xa8, 0x60, 0x2e,
+    0x80, 0xb3, 0xce, 0xa8, 0x1c, 0xb4, 0x5d, 0x25, 0x6f, 0xaa, 0x9c, 0xac,
+    0x9c, 0x32, 0x97, 0xb4, 0x19, 0x29, 0xc3, 0x31, 0xe0, 0xb6, 0x17, 0x2b,
+    0x85, 0xac, 0x27, 0xb4, 0x02, 0x25, 0xe9, 0xb2, 0x91, 0xb5, 0x6e, 0xb4,
+    0x0c, 0xb0, 0xa0, 0x2a, 0x25, 0xb0, 0x88, 0x28, 0xf9, 0xb0, 0x53, 0xa5,
+    0xb6, 0x2f, 0x17, 0xa1, 0xf3, 0xb0, 0x38, 0x2f, 0x1a, 0x31, 0xea, 0x30,
+    0x4c, 0x30, 0x47, 0x33, 0xec, 0x24, 0x15, 0xb4, 0xde, 0xb4, 0x3c, 0xac,
+    0xf9, 0xb3, 0xd1, 0x2f, 0x31, 0x34, 0x15, 0xa6, 0x59, 0x2a, 0xbf, 0x35,
+    0xe3, 0xb4, 0x46, 0x25, 0x34, 0x2f, 0x34, 0xb0, 0x52, 0x2e, 0xc6, 0xb3,
+    0x2a, 0xb5, 0x32, 0xaf, 0x04, 0xb1, 0xc6, 0x2f, 0x37, 0x30, 0xd7, 0xb4,
+    0xb2, 0xb4, 0x15, 0x34, 0x80, 0x35, 0xdc, 0xac, 0x52, 0xac, 0x80, 0xaf,
+    0x5e, 0xa6, 0x65, 0x34, 0x05, 0xb2, 0x99, 0x2d, 0xad, 0x34, 0xd7, 0xb1,
+    0xbc, 0xb3, 0x7d, 0x2a, 0x09, 0xb4, 0x35, 0x2e, 0x81, 0x29, 0x81, 0x33,
+    0x3c, 0xa8, 0xad, 0x32, 0xb6, 0xae, 0x44, 0x32, 0xc1, 0x2e, 0x8a, 0x2f,
+    0x00, 0xb3, 0x7b, 0xa8, 0x84, 0xb4, 0x5e, 0xb5, 0x8f, 0xb6, 0x84, 0xb0,
+    0xb8, 0x33, 0x80, 0x33, 0x28, 0xb1, 0xe8, 0xb0, 0xae, 0xb1, 0x62, 0x33,
+    0x5b, 0x29, 0xc5, 0xaa, 0xcd, 0xad, 0x66, 0x28, 0x74, 0x30, 0x82, 0x30,
+    0x87, 0xb4, 0x07, 0x34, 0xe3, 0x33, 0xe3, 0x2d, 0x6a, 0xb1, 0x1d, 0x30,
+    0x2f, 0x35, 0x92, 0xb0, 0x5e, 0x33, 0xd6, 0x9c, 0xa9, 0xb1, 0x8a, 0xb0,
+    0x5f, 0x2e, 0xdc, 0xb0, 0x3e, 0xb6, 0xc3, 0xac, 0xb5, 0xb2, 0x54, 0xb4,
+    0xe0, 0xb6, 0xff, 0xb2, 0x9a, 0x34, 0xf2, 0x33, 0x8e, 0xab, 0x58, 0xb0,
+    0xce, 0xa0, 0x36, 0x2c, 0x95, 0x28, 0xda, 0xac, 0x15, 0x23, 0xc9, 0x92,
+    0xcc, 0x2f, 0x8e, 0x33, 0x5a, 0x29, 0x9e, 0x30, 0x5f, 0x31, 0x93, 0x24,
+    0x5c, 0x25, 0x84, 0xa0, 0x3d, 0x34, 0x77, 0x29, 0x26, 0x33, 0x47, 0x2e,
+    0xed, 0xb4, 0x29, 0xb4, 0x02, 0xb3, 0xa8, 0xae, 0x2f, 0xb4, 0x8e, 0xb3,
+    0x8a, 0xae, 0xe7, 0xb0, 0x44, 0xb5, 0xa6, 0xb2, 0xdd, 0x10, 0xad, 0x2a,
+    0x01, 0xb2, 0xa8, 0xb2, 0x78, 0xa8, 0x37, 0x28, 0x92, 0xb3, 0x36, 0xa8,
+    0x5d, 0x31, 0x47, 0xa4, 0xe9, 0xaa, 0xec, 0x33, 0x51, 0xa9, 0x45, 0x22,
+    0x54, 0x31, 0xdb, 0xa8, 0x7a, 0xb1, 0xb9, 0x31, 0x27, 0x30, 0x0c, 0x29,
+    0x16, 0x35, 0x49, 0x32, 0xea, 0xb3, 0x14, 0xb7, 0x4f, 0xb1, 0xf2, 0xb0,
+    0x2d, 0xb7, 0xf4, 0xb0, 0x17, 0x24, 0xaa, 0xb2, 0x69, 0xb4, 0x50, 0xb3,
+    0xed, 0xaa, 0x12, 0xb2, 0xd3, 0xb4, 0x42, 0xb6, 0x86, 0x34, 0xb1, 0x30,
+    0x42, 0xb4, 0x60, 0x31, 0x45, 0x35, 0xe9, 0x33, 0x57, 0xad, 0xf3, 0x2f,
+    0x72, 0xb3, 0xdd, 0xaa, 0x35, 0xb2, 0xf4, 0x31, 0xb1, 0xb4, 0x3d, 0x32,
+    0x2f, 0xae, 0x49, 0x9e, 0x00, 0x31, 0x3b, 0x31, 0x05, 0xb2, 0xc8, 0xb2,
+    0xcb, 0xb0, 0x1f, 0xaf, 0xc6, 0x34, 0x87, 0xae, 0x38, 0x30, 0x4a, 0xac,
+    0x8a, 0x2d, 0x31, 0xb3, 0x28, 0xae, 0x7f, 0xad, 0xe7, 0xb4, 0x66, 0xab,
+    0x70, 0xad, 0xae, 0x37, 0x49, 0xb3, 0x00, 0x2b, 0x90, 0xa8, 0xf3, 0x32,
+    0x5f, 0xb0, 0xdd, 0xa9, 0x2f, 0xac, 0x25, 0x38, 0x8c, 0xab, 0xeb, 0x2e,
+    0x33, 0x9d, 0xb1, 0xa9, 0x65, 0x38, 0x78, 0xaf, 0xdf, 0x31, 0x49, 0x2f,
+    0x64, 0xb5, 0x5b, 0x2d, 0x7e, 0xb2, 0x13, 0xb6, 0x81, 0x34, 0x61, 0xb4,
+    0x57, 0x31, 0x33, 0xb4, 0x03, 0x34, 0x44, 0xb2, 0xc5, 0xa4, 0x09, 0xa2,
+    0x06, 0xae, 0x2d, 0x26, 0xe6, 0xb4, 0xc2, 0x36, 0xc2, 0xb1, 0x51, 0xad,
+    0x4e, 0x30, 0x5b, 0x2c, 0x97, 0x26, 0x37, 0x34, 0x90, 0xb0, 0xdc, 0x33,
+    0x72, 0xb0, 0x27, 0x34, 0xc8, 0xaa, 0x2e, 0xab, 0x0d, 0x37, 0x04, 0xa5,
+    0xfa, 0x30, 0x98, 0x31, 0xcb, 0xaf, 0xad, 0xb4, 0x1e, 0xb4, 0xe8, 0xb2,
+    0xd4, 0x2f, 0x2e, 0xb2, 0xbc, 0x2a, 0x43, 0xb3, 0x0a, 0x33, 0xca, 0xaa,
+    0xd5, 0x31, 0x1f, 0x27, 0xa1, 0x2d, 0x47, 0x18, 0x2c, 0xb2, 0x95, 0x29,
+    0x61, 0xb1, 0xe4, 0xa7, 0x6c, 0x2a, 0x82, 0x9e, 0xc6, 0xb2, 0x9b, 0x2d,
+    0xf7, 0xa1, 0x4c, 0x34, 0xec, 0xac, 0x51, 0x34, 0xfb, 0xa6, 0x26, 0x31,
+    0x4f, 0x33, 0x3b, 0x2d, 0x33, 0x34, 0x3a, 0x29, 0x77, 0xb1, 0x43, 0xaf,
+    0xdb, 0xb3, 0xa3, 0xb6, 0xe7, 0x2d, 0x31, 0xab, 0x00, 0xb2, 0x5b, 0x9b,
+    0x8d, 0x2c, 0xa3, 0xb5, 0x83, 0x2e, 0x5d, 0xae, 0x9a, 0xb1, 0x9a, 0xb2,
+    0xb3, 0xa8, 0xbb, 0x2b, 0xe2, 0xb0, 0x92, 0xac, 0x8b, 0xae, 0xbf, 0xad,
+    0xe7, 0xb3, 0x40, 0x2d, 0x73, 0xb0, 0xce, 0xb0, 0x8d, 0x2c, 0x49, 0x2a,
+    0x99, 0xa6, 0x9c, 0x23, 0x40, 0x34, 0x21, 0xaf, 0xac, 0x31, 0x23, 0x35,
+    0xee, 0xb0, 0x55, 0xa3, 0x08, 0xae, 0x1e, 0xb4, 0x6b, 0x2d, 0xf2, 0xab,
+    0xb4, 0x34, 0x7e, 0xae, 0x0c, 0xad, 0x15, 0x98, 0x60, 0xb8, 0x5f, 0x30,
+    0x6b, 0xb2, 0x39, 0xa4, 0x35, 0xaa, 0xc2, 0xb1, 0xf6, 0x2e, 0x5e, 0x35,
+    0x81, 0x33, 0xeb, 0xb3, 0xcf, 0xb0, 0xa6, 0xb2, 0x71, 0xae, 0x2f, 0x30,
+    0x8f, 0x34, 0x47, 0x30, 0x05, 0x2c, 0xab, 0xab, 0xd2, 0xa2, 0x57, 0xa5,
+    0x22, 0x25, 0x7d, 0xb5, 0xf8, 0xb0, 0x3d, 0x35, 0x80, 0xae, 0x0b, 0x30,
+    0x83, 0x2f, 0xb8, 0xb0, 0xa5, 0x31, 0x51, 0xa8, 0x71, 0xad, 0x7a, 0xaf,
+    0x37, 0xb8, 0x13, 0x31, 0x55, 0xb5, 0xa9, 0x34, 0x1e, 0x2d, 0x63, 0xa9,
+    0xac, 0xab, 0x41, 0x36, 0xb2, 0x34, 0x30, 0xb0, 0x3e, 0xb4, 0x56, 0xb3,
+    0xc3, 0xaf, 0xfc, 0xa4, 0x2b, 0x37, 0x6d, 0x26, 0x7c, 0xb2, 0xd7, 0xb0,
+    0x16, 0xb2, 0xe2, 0xaf, 0x4d, 0xb4, 0xff, 0xb4, 0x16, 0xac, 0xa4, 0x30,
+    0x27, 0x2f, 0x0d, 0x0c, 0xd9, 0x25, 0xd7, 0xb1, 0xb6, 0x29, 0x31, 0x31,
+    0x48, 0xb0, 0x94, 0xab, 0x85, 0xb3, 0x92, 0x30, 0x45, 0xae, 0x38, 0x38,
+    0x23, 0xb1, 0x88, 0x20, 0x26, 0x28, 0x5e, 0x22, 0x24, 0x33, 0x6d, 0xb5,
+    0xe9, 0x27, 0x2b, 0xb2, 0x36, 0xb4, 0xa5, 0x2b, 0x8f, 0x31, 0x32, 0xa9,
+    0x4c, 0xb1, 0x59, 0x31, 0x8c, 0x2d, 0x80, 0x31, 0x6a, 0xac, 0xb6, 0xb4,
+    0xf4, 0x2a, 0x95, 0x34, 0x8b, 0xaf, 0xf8, 0xb6, 0x0d, 0x32, 0xe1, 0x30,
+    0xb5, 0x33, 0x18, 0x37, 0x3a, 0x20, 0x4c, 0x1c, 0x4b, 0xb4, 0x3f, 0x94,
+    0x55, 0x30, 0xce, 0x34, 0x94, 0x2f, 0x53, 0x33, 0xb9, 0x1d, 0x7f, 0x9d,
+    0x68, 0x30, 0x42, 0xb3, 0x68, 0xb2, 0x10, 0xb1, 0x1f, 0x34, 0x82, 0x30,
+    0x53, 0x32, 0x01, 0x30, 0x1b, 0x92, 0xd7, 0x2b, 0x2f, 0x33, 0xcf, 0x2a,
+    0xe5, 0x2c, 0x12, 0xb1, 0xfd, 0x33, 0x0e, 0x38, 0xa5, 0xa6, 0x00, 0x90,
+    0x20, 0x00, 0x00, 0xa6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xbe, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xd6, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xee, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x20, 0xe0, 0xff, 0xff, 0x24, 0xe0, 0xff, 0xff, 0x0f,
+    0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e, 0x76,
+    0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x08,
+    0x06, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d,
+    0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0xbc,
+    0x05, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0xdc,
+    0x04, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00, 0x24,
+    0x04, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0x98,
+    0x03, 0x00, 0x00, 0x58, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0xf8,
+    0x02, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00, 0x50,
+    0x02, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xc4,
+    0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x24,
+    0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16,
+    0xfb, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x1c,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x4e, 0xfb, 0xff, 0xff, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x38, 0xe1, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x82,
+    0xfb, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xee,
+    0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xba, 0xfb, 0xff, 0xff, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0xfc, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0xf2, 0xfb, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0xdc, 0xe1, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x31,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x22, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x8e, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2f,
+    0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x86, 0xfc, 0xff, 0xff, 0x0c,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7a, 0xfc, 0xff, 0xff, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0xfc, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5e, 0xfc, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x9c, 0xe2, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x2d,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x12, 0xfd, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x06, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xf0, 0xe2, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x2b,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x36, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x20, 0xe3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x2a,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x66, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x4e, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4e, 0xfd, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x8c, 0xe3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0xd2, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x36, 0xfe, 0xff, 0xff, 0x0c,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0xfe, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x4c, 0xe4, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0xc2, 0xfe, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0xb6, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xa0, 0xe4, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0xe6, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x15, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0xd0, 0xe4, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x16, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x05, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0e,
+    0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x0c,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4c, 0xe5, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x1c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08,
+    0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1d,
+    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a,
+    0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b,
+    0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4c,
+    0xe6, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x68,
+    0x18, 0x00, 0x00, 0x10, 0x18, 0x00, 0x00, 0xd0, 0x17, 0x00, 0x00, 0x90,
+    0x17, 0x00, 0x00, 0x50, 0x17, 0x00, 0x00, 0x08, 0x17, 0x00, 0x00, 0xb4,
+    0x16, 0x00, 0x00, 0x6c, 0x16, 0x00, 0x00, 0x30, 0x16, 0x00, 0x00, 0xe8,
+    0x15, 0x00, 0x00, 0xa8, 0x15, 0x00, 0x00, 0x64, 0x15, 0x00, 0x00, 0x20,
+    0x15, 0x00, 0x00, 0xdc, 0x14, 0x00, 0x00, 0x9c, 0x14, 0x00, 0x00, 0x5c,
+    0x14, 0x00, 0x00, 0x1c, 0x14, 0x00, 0x00, 0xdc, 0x13, 0x00, 0x00, 0x9c,
+    0x13, 0x00, 0x00, 0x3c, 0x13, 0x00, 0x00, 0xdc, 0x12, 0x00, 0x00, 0x7c,
+    0x12, 0x00, 0x00, 0x1c, 0x12, 0x00, 0x00, 0xc8, 0x11, 0x00, 0x00, 0x74,
+    0x11, 0x00, 0x00, 0x20, 0x11, 0x00, 0x00, 0xa0, 0x10, 0x00, 0x00, 0x2c,
+    0x10, 0x00, 0x00, 0xb8, 0x0f, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0xb8,
+    0x0e, 0x00, 0x00, 0x40, 0x0e, 0x00, 0x00, 0x5c, 0x0d, 0x00, 0x00, 0x14,
+    0x0c, 0x00, 0x00, 0xd4, 0x0a, 0x00, 0x00, 0x54, 0x0a, 0x00, 0x00, 0xe0,
+    0x09, 0x00, 0x00, 0x6c, 0x09, 0x00, 0x00, 0xec, 0x08, 0x00, 0x00, 0x68,
+    0x08, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0xac,
+    0x05, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x6c,
+    0x03, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x08,
+    0x02, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2e, 0xe8, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x78,
+    0xe7, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74, 0x65,
+    0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e,
+    0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x5f, 0x31, 0x3a, 0x30, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x86,
+    0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x54,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x06,
+    0x00, 0x00, 0x00, 0xd0, 0xe7, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x4d, 0x61,
+    0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f,
+    0x32, 0x5f, 0x31, 0x2f, 0x41, 0x64, 0x64, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfe,
+    0xe8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x48, 0xe8, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61,
+    0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f,
+    0x34, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65,
+    0x6e, 0x73, 0x65, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x41, 0x64, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x92, 0xe9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x20, 0x00, 0x00, 0x00, 0xdc, 0xe8, 0xff, 0xff, 0x50,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f,
+    0x4d, 0x61, 0x74, 0x4d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x5f, 0x6c,
+    0x75, 0x5f, 0x33, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x64, 0x65, 0x6e, 0x73, 0x65, 0x5f, 0x31, 0x2f, 0x41, 0x64, 0x64, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x22, 0xea, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x6c, 0xe9, 0xff, 0xff, 0x2c,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x61,
+    0x76, 0x65, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69,
+    0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x65, 0x61, 0x6e, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x8e, 0xea, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x31,
+    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xdc,
+    0xe9, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x5f, 0x6c,
+    0x75, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x61,
+    0x64, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0xeb, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x58, 0xea, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x63,
+    0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53,
+    0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x7a,
+    0xeb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xcc,
+    0xea, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f,
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0xea, 0xeb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2e,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x3c, 0xeb, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x32, 0x5f, 0x31, 0x2f, 0x63,
+    0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x45,
+    0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x66, 0xec, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xb4, 0xeb, 0xff, 0xff, 0x01, 0x01, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c,
+    0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f,
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x61, 0x64,
+    0x64, 0x5f, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f,
+    0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d,
+    0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75,
+    0x65, 0x65, 0x7a, 0x65, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e,
+    0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
+    0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69,
+    0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62,
+    0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
+    0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f,
+    0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x73, 0x75, 0x62, 0x31, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xae,
+    0xed, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x24,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0xed, 0xff, 0xff, 0x00, 0x01, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x61, 0x64, 0x64, 0x5f, 0x31, 0x3b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f,
+    0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
+    0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f,
+    0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68,
+    0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69,
+    0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68,
+    0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61,
+    0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61,
+    0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x73, 0x75, 0x62, 0x00,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xfe,
+    0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xbc,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50,
+    0xee, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f,
+    0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
+    0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f,
+    0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x6d, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xe6, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x2a,
+    0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x38, 0xef, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31,
+    0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f,
+    0x6c, 0x31, 0x64, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x5e, 0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xb0, 0xef, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31,
+    0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f,
+    0x6c, 0x31, 0x64, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x44, 0x69,
+    0x6d, 0x73, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xde,
+    0xf0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x54,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x32,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2c, 0xf0, 0xff, 0xff, 0x37,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x5f,
+    0x32, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x61, 0x64, 0x64, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x5a, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x27,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xa8,
+    0xf0, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f,
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75, 0x65, 0x65,
+    0x7a, 0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xca, 0xf1, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1c, 0xf1, 0xff, 0xff, 0x23,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31,
+    0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69,
+    0x6f, 0x6e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3a,
+    0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8c,
+    0xf1, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f,
+    0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x45, 0x78, 0x70, 0x61, 0x6e,
+    0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xb6, 0xf2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04,
+    0xf2, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e,
+    0x6f, 0x72, 0x6d, 0x2f, 0x61, 0x64, 0x64, 0x5f, 0x31, 0x3b, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d,
+    0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64,
+    0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64,
+    0x2f, 0x53, 0x71, 0x75, 0x65, 0x65, 0x7a, 0x65, 0x3b, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61,
+    0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31,
+    0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61,
+    0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62,
+    0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d,
+    0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f,
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x73, 0x75,
+    0x62, 0x31, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2, 0xf3, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x18, 0x01, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x44, 0xf3, 0xff, 0xff, 0xf6,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f,
+    0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x61, 0x64, 0x64, 0x5f, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+    0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d,
+    0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75,
+    0x65, 0x65, 0x7a, 0x65, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72,
+    0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74,
+    0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61,
+    0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68,
+    0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x3b, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61,
+    0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x36, 0xf5, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x88, 0xf4, 0xff, 0xff, 0x92,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f,
+    0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x6d, 0x75, 0x6c, 0x5f, 0x31, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f, 0x70,
+    0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x4d,
+    0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x53, 0x71, 0x75,
+    0x65, 0x65, 0x7a, 0x65, 0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f,
+    0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f,
+    0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72,
+    0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x16, 0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x68, 0xf5, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x6d, 0x61, 0x78, 0x5f, 0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31,
+    0x64, 0x5f, 0x31, 0x2f, 0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31,
+    0x64, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x8a,
+    0xf6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x54,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xdc,
+    0xf5, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x6d, 0x61, 0x78, 0x5f,
+    0x70, 0x6f, 0x6f, 0x6c, 0x69, 0x6e, 0x67, 0x31, 0x64, 0x5f, 0x31, 0x2f,
+    0x4d, 0x61, 0x78, 0x50, 0x6f, 0x6f, 0x6c, 0x31, 0x64, 0x2f, 0x45, 0x78,
+    0x70, 0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x0a, 0xf7, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x58, 0xf6, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x72, 0x65, 0x5f, 0x6c, 0x75, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x6c, 0x75,
+    0x3b, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f,
+    0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x61,
+    0x64, 0x64, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x82, 0xf7, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xd0, 0xf6, 0xff, 0xff, 0x29, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x53, 0x71, 0x75,
+    0x65, 0x65, 0x7a, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf2,
+    0xf7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x44,
+    0xf7, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x6f, 0x6c, 0x75,
+    0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x62, 0xf8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0xb4, 0xf7, 0xff, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e,
+    0x76, 0x6f, 0x6c, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x2f, 0x45, 0x78, 0x70,
+    0x61, 0x6e, 0x64, 0x44, 0x69, 0x6d, 0x73, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc8,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7e, 0xfa, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x18, 0xf8, 0xff, 0xff, 0x1f,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x32,
+    0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61, 0x70, 0x65, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0xce, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2c,
+    0x00, 0x00, 0x00, 0x68, 0xf8, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x63, 0x6f, 0x6e, 0x76, 0x31, 0x64, 0x5f, 0x31, 0x2f, 0x52, 0x65, 0x73,
+    0x68, 0x61, 0x70, 0x65, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1e,
+    0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0xb8,
+    0xf8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x63, 0x6f, 0x6e, 0x76,
+    0x31, 0x64, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x52, 0x65, 0x73, 0x68, 0x61,
+    0x70, 0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x6e, 0xfb, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x08, 0xf9, 0xff, 0xff, 0x30,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f,
+    0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+    0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f,
+    0x73, 0x75, 0x62, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xca, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x64, 0xf9, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f,
+    0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c,
+    0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x2f, 0x62, 0x61,
+    0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x26,
+    0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc0,
+    0xf9, 0xff, 0xff, 0x32, 0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x5f, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74,
+    0x69, 0x6f, 0x6e, 0x5f, 0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63,
+    0x68, 0x6e, 0x6f, 0x72, 0x6d, 0x2f, 0x73, 0x75, 0x62, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x82, 0xfc, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1c, 0xfa, 0xff, 0xff, 0x32,
+    0x00, 0x00, 0x00, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x61,
+    0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x5f, 0x6e, 0x6f,
+    0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+    0x31, 0x5f, 0x32, 0x2f, 0x62, 0x61, 0x74, 0x63, 0x68, 0x6e, 0x6f, 0x72,
+    0x6d, 0x2f, 0x6d, 0x75, 0x6c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x92, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x7c, 0xfa, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xce, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0xb8, 0xfa, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x56, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xf0, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x92, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x2c, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x31, 0x35, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xce, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x68, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x31, 0x34, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x0a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0xa4, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x31, 0x33, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xe4, 0xfb, 0xff, 0xff, 0x10,
+    0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8a,
+    0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x24,
+    0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x31, 0x00,
+    0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0xca, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x64, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0xa0, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x39, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4a,
+    0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xe4,
+    0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x38, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0xfd, 0xff, 0xff, 0x0f,
+    0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e,
+    0x73, 0x74, 0x61, 0x6e, 0x74, 0x37, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0xc6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x60, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61,
+    0x72, 0x69, 0x74, 0x68, 0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+    0x74, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x18, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0xb0,
+    0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x35, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0xf8,
+    0xfd, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x34, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x34,
+    0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x33, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x86, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x70,
+    0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x32, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0xac,
+    0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x31, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c,
+    0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x61, 0x72, 0x69, 0x74, 0x68,
+    0x2e, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c,
+    0x00, 0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x73,
+    0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75,
+    0x6c, 0x74, 0x5f, 0x6b, 0x65, 0x72, 0x61, 0x73, 0x5f, 0x74, 0x65, 0x6e,
+    0x73, 0x6f, 0x72, 0x3a, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x34,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x19, 0xb0, 0xff, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x09, 0xbc, 0xff, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0xc8, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x12, 0xd4, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0xe8,
+    0xff, 0xff, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf4,
+    0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c,
+    0x00, 0x0c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46};
+const unsigned int g_rep_mate_model_packed_len = 48095;
@@ -0,0 +1,33 @@
+#include "model_registry.h"
+#include "model.h"
+#include <string.h>
+
+#if MODEL_PACKED
+#define MODEL_SOURCE(symbol) symbol##_packed, symbol##_packed_len
+#else
+#define MODEL_SOURCE(symbol) symbol##_data, (unsigned int)symbol##_data_len
+#endif
+
+#define MODEL_HEADS(heads) heads, (int)(sizeof(heads) / sizeof(heads[0]))
+
+static const ModelHead form_only[] = {HEAD_FORM};
+
+// Only a bench press model has been trained (every recording under data/ is "bP"), curls and flys run it
+// until they have their own: pack it with model_pack.py --symbol, declare it in model.h and point the
+// lift's row at it. A multi-head model lists its heads in output order, e.g. {HEAD_LIFT, HEAD_FORM}.
+const ModelEntry model_registry[] = {
+    {"dC", MODEL_SOURCE(g_rep_mate_model), MODEL_HEADS(form_only)},
+    {"bP", MODEL_SOURCE(g_rep_mate_model), MODEL_HEADS(form_only)},
+    {"dF", MODEL_SOURCE(g_rep_mate_model), MODEL_HEADS(form_only)},
+};
+const int model_registry_count = sizeof(model_registry) / sizeof(model_registry[0]);
+
+const ModelEntry *modelRegistryFind(const char *lift)
+{
+  for (const ModelEntry &entry : model_registry)
+  {
+    if (strcmp(entry.lift, lift) == 0)
+      return &entry;
+  }
+  return nullptr;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+
+// Models by lift (lift_names in main.cpp). Only the active lift's model is resident: selectLiftModel()
+// (inference.h) decodes it into one shared buffer and rebuilds the interpreter in the shared
+// tensor_arena, the others stay packed in flash. Lifts can share a model, switching between them then
+// only changes the active lift.
+
+// What a model output predicts. A model can have several heads on one backbone, one Invoke() fills them all.
+enum ModelHead
+{
+  HEAD_FORM,  // Form class, labels[] in inference.cpp
+  HEAD_LIFT,  // Lift type, in lift_names order
+  HEAD_PHASE, // Rep phase
+  MODEL_HEAD_COUNT
+};
+
+const int HEAD_MAX_CLASSES = 6;
+
+struct ModelEntry
+{
+  const char *lift;
+  const unsigned char *data; // Packed container with MODEL_PACKED, else the flatbuffer itself
+  unsigned int length;
+  const ModelHead *heads;    // One per model output, in output order
+  int head_count;
+};
+
+extern const ModelEntry model_registry[];
+extern const int model_registry_count;
+
+// nullptr if no model is registered for lift
+const ModelEntry *modelRegistryFind(const char *lift);
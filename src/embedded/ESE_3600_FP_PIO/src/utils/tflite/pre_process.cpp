@@ -1,40 +1,48 @@
 #include "pre_process.h"
 #include <float.h>
+#include <string.h>
+#include "../log/log.h"
+#include "decimator.h"
 
-// Applies a moving average to the sensor data and tracks the range to feature_ranges
-static void window_avg(float *buffer, float *input_tensor_arr)
+static_assert(AVERAGING_WINDOW == DECIMATION_FACTOR, "The decimator must reduce GRAB_LEN to OUTPUT_SEQUENCE_LENGTH");
+static_assert(BUFFER_LEN / (1 + IMU_MODEL_RATE_DIVISOR) == OUTPUT_SEQUENCE_LENGTH,
+              "The model-rate profile must read exactly one sample per model step");
+
+// The window the sample task is streaming through the decimator, and the buffer it is stored in
+static Decimator<sample_t> window_decimator;
+static float window_decimated[OUTPUT_SEQUENCE_LENGTH * DECIMATOR_CHANNELS];
+static const sample_t *window_decimated_from = nullptr;
+
+Decimator<sample_t> *preprocess_stream_window(const SampleBuffer &buffer)
 {
-  const size_t window_size = AVERAGING_WINDOW;
+  window_decimated_from = nullptr;
+  if (imu_profile == IMU_PROFILE_MODEL_RATE)
+    return nullptr;
+  decimatorReset(&window_decimator, decimatorTaps(decimator_filter), window_decimated, OUTPUT_SEQUENCE_LENGTH,
+                 SAMPLE_TO_FLOAT);
+  window_decimated_from = buffer.data;
+  return &window_decimator;
+}
 
+// Decimates the window to the model's sequence length with the selected filter (decimator.h).
+// The default box-car filter gives the plain 5-sample means this always computed.
+static void window_avg(const SampleBuffer &buffer, float *input_tensor_arr)
+{
   // Validate buffer size
-  if (OUTPUT_SEQUENCE_LENGTH * window_size > GRAB_LEN)
+  if (OUTPUT_SEQUENCE_LENGTH * DECIMATION_FACTOR > GRAB_LEN)
   {
-    printf("Error: Required buffer size (%zu) exceeds GRAB_LEN (%zu)\n",
-           OUTPUT_SEQUENCE_LENGTH * window_size, GRAB_LEN);
+    LOG_ERROR("Required buffer size (%zu) exceeds GRAB_LEN (%zu)",
+              OUTPUT_SEQUENCE_LENGTH * DECIMATION_FACTOR, GRAB_LEN);
     return;
   }
 
-  // Process each time step
-  for (size_t i = 0; i < OUTPUT_SEQUENCE_LENGTH; i++)
-  {
-    // For each feature
-    for (size_t feature = 0; feature < NUM_FEATURES; feature++)
-    {
-      float sum = 0;
-      // Calculate start position for this window
-      size_t window_start = i * window_size * NUM_FEATURES;
-      
-      // Sum up window_size samples for this feature
-      for (size_t j = 0; j < window_size; j++)
-      {
-        // Access pattern: window_start + (sample_offset * NUM_FEATURES) + feature_idx
-        sum += buffer[window_start + (j * NUM_FEATURES) + feature];
-      }
-      
-      // Store averaged result
-      input_tensor_arr[i * NUM_FEATURES + feature] = sum / window_size;
-    }
-  }
+#if SAMPLE_LAYOUT == SAMPLE_LAYOUT_CHANNEL_MAJOR
+  decimateChannelMajor(decimatorTaps(decimator_filter), buffer.data, buffer.capacity, GRAB_LEN, input_tensor_arr,
+                       OUTPUT_SEQUENCE_LENGTH, SAMPLE_TO_FLOAT);
+#else
+  decimate(decimatorTaps(decimator_filter), buffer.data, GRAB_LEN, input_tensor_arr, OUTPUT_SEQUENCE_LENGTH,
+           SAMPLE_TO_FLOAT);
+#endif
 }
 
 static void inspect_output_buffer(float *input_tensor_arr)
@@ -52,18 +60,33 @@ static void inspect_output_buffer(float *input_tensor_arr)
 }
 
 // Preprocesses the buffer to the input
-void preprocess_buffer_to_input(float buffer[], float *input_tensor_arr)
+void preprocess_buffer_to_input(const SampleBuffer &buffer, float *input_tensor_arr)
 {
   // Allocate recent_data on heap
   float *recent_data = new float[GRAB_LEN];
   if (!recent_data)
   {
-    printf("Failed to allocate recent_data buffer\n");
+    LOG_ERROR("Failed to allocate recent_data buffer");
     return;
   }
 
-  printf("Window averaging\n");
-  window_avg(buffer, input_tensor_arr);
+  // imu_profile only changes between windows, so it is the profile this window was read with
+  if (imu_profile == IMU_PROFILE_MODEL_RATE)
+  {
+    // The chip already sampled at the model rate
+    storeToInput(buffer, OUTPUT_SEQUENCE_LENGTH, input_tensor_arr);
+  }
+  else if (buffer.data == window_decimated_from && decimatorDone(&window_decimator))
+  {
+    // Decimated while it was read, used once: the buffer may be filled another way next
+    memcpy(input_tensor_arr, window_decimated, sizeof(window_decimated));
+    window_decimated_from = nullptr;
+  }
+  else
+  {
+    LOG_DEBUG("Window averaging");
+    window_avg(buffer, input_tensor_arr);
+  }
 
   // DEBUG //
 
@@ -84,7 +107,62 @@ void preprocess_buffer_to_input(float buffer[], float *input_tensor_arr)
   // Cleanup
   delete[] recent_data;
 
-  printf("Preprocessing complete\n");
+  LOG_DEBUG("Preprocessing complete");
+}
+
+// Feature value of sample offset (from first) in the ring
+static inline float ring_value(const SampleBuffer &ring, size_t first, size_t offset, size_t feature)
+{
+  return ring.get((first + offset) % ring.capacity, feature) * SAMPLE_TO_FLOAT;
+}
+
+void resample_ring_to_input(const SampleBuffer &ring, size_t first, size_t count, float *input_tensor_arr)
+{
+  size_t ring_len = ring.capacity;
+  if (count == 0 || count > ring_len)
+  {
+    LOG_ERROR("Cannot resample %zu samples from a ring of %zu", count, ring_len);
+    return;
+  }
+
+  if (count < OUTPUT_SEQUENCE_LENGTH)
+  {
+    // Linear interpolation, the first and last output steps land on the first and last samples
+    float step = count > 1 ? (float)(count - 1) / (OUTPUT_SEQUENCE_LENGTH - 1) : 0.0f;
+    for (size_t i = 0; i < OUTPUT_SEQUENCE_LENGTH; i++)
+    {
+      float position = i * step;
+      size_t left = (size_t)position;
+      size_t right = left + 1 < count ? left + 1 : left;
+      float weight = position - left;
+      for (size_t feature = 0; feature < NUM_FEATURES; feature++)
+      {
+        float a = ring_value(ring, first, left, feature);
+        float b = ring_value(ring, first, right, feature);
+        input_tensor_arr[i * NUM_FEATURES + feature] = a + (b - a) * weight;
+      }
+    }
+    return;
+  }
+
+  // Box average over count / OUTPUT_SEQUENCE_LENGTH samples per step, samples cut by a box edge
+  // count towards both boxes by the fraction that falls in each
+  float box = (float)count / OUTPUT_SEQUENCE_LENGTH;
+  for (size_t i = 0; i < OUTPUT_SEQUENCE_LENGTH; i++)
+  {
+    float begin = i * box;
+    float end = begin + box;
+    for (size_t feature = 0; feature < NUM_FEATURES; feature++)
+    {
+      float sum = 0;
+      for (size_t j = (size_t)begin; j < count && j < end; j++)
+      {
+        float covered = fminf(end, j + 1.0f) - fmaxf(begin, (float)j);
+        sum += covered * ring_value(ring, first, j, feature);
+      }
+      input_tensor_arr[i * NUM_FEATURES + feature] = sum / box;
+    }
+  }
 }
 
 static void force_input_tensor_to_data(float *input_tensor_arr, float data_2d_array[OUTPUT_SEQUENCE_LENGTH][NUM_FEATURES])
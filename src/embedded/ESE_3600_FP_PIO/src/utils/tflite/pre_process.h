@@ -3,7 +3,9 @@
 #include <cmath>
 
 #include "data.h"
+#include "decimator.h"
 #include "imu_provider.h"
+#include "sample_store.h"
 
 // Constants for preprocessing
 constexpr size_t GRAB_LEN = 1000;
@@ -13,9 +15,20 @@ constexpr size_t AVERAGING_WINDOW = GRAB_LEN / OUTPUT_SEQUENCE_LENGTH;
 extern const int NUM_FEATURES;
 extern const int BUFFER_LEN;
 
-static void window_avg(float *recent_data, float *output_tensor_arr);
+static void window_avg(const SampleBuffer &buffer, float *output_tensor_arr);
 
 static void force_input_tensor_to_data(float *input_tensor_arr,
                                        float data_2d_array[OUTPUT_SEQUENCE_LENGTH][NUM_FEATURES]);
 
-void preprocess_buffer_to_input(float buffer[], float *input_tensor_arr);
+// Conversion from the stored samples (sample_t, in the build's SAMPLE_LAYOUT) to floats happens here,
+// at the model input
+void preprocess_buffer_to_input(const SampleBuffer &buffer, float *input_tensor_arr);
+
+// Decimator for the window about to be read into buffer, for resamplerReset(); nullptr in the model-rate
+// profile, which has nothing to decimate. Once the window is full, preprocess_buffer_to_input() copies
+// the streamed outputs instead of decimating the buffer again.
+Decimator<sample_t> *preprocess_stream_window(const SampleBuffer &buffer);
+
+// Stretches or squeezes count samples of a ring (the whole store), starting at sample first, to
+// OUTPUT_SEQUENCE_LENGTH. Longer spans are box-averaged, shorter ones linearly interpolated.
+void resample_ring_to_input(const SampleBuffer &ring, size_t first, size_t count, float *input_tensor_arr);
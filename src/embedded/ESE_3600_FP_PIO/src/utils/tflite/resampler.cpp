@@ -0,0 +1,105 @@
+#include "resampler.h"
+#include <math.h>
+#include <string.h>
+
+void jitterReset(SampleJitter *jitter)
+{
+  memset(jitter, 0, sizeof(*jitter));
+  jitter->min_us = UINT32_MAX;
+}
+
+void jitterAdd(SampleJitter *jitter, uint32_t interval_us, uint32_t period_us)
+{
+  jitter->intervals++;
+  if ((uint64_t)interval_us * 2 > (uint64_t)period_us * 3) // 64-bit, so a stall over 2^31 us does not wrap
+    jitter->late++;
+  if (interval_us < jitter->min_us)
+    jitter->min_us = interval_us;
+  if (interval_us > jitter->max_us)
+    jitter->max_us = interval_us;
+  float delta = interval_us - jitter->mean_us;
+  jitter->mean_us += delta / jitter->intervals;
+  jitter->m2 += delta * (interval_us - jitter->mean_us);
+}
+
+float jitterStddevUs(const SampleJitter *jitter)
+{
+  return jitter->intervals > 1 ? sqrtf(jitter->m2 / (jitter->intervals - 1)) : 0.0f;
+}
+
+void resamplerReset(SampleResampler *resampler, SampleBuffer out, int out_count, uint32_t period_us,
+                    Decimator<sample_t> *decimator)
+{
+  resampler->out = out;
+  resampler->out_count = out_count;
+  resampler->written = 0;
+  resampler->period_us = period_us;
+  resampler->start_us = 0;
+  resampler->previous_us = 0;
+  resampler->decimator = decimator;
+  jitterReset(&resampler->jitter);
+}
+
+// The next grid point: stored, and streamed through the decimator if there is one
+static void writeGridPoint(SampleResampler *resampler, const sample_t *sample)
+{
+  resampler->out.write(resampler->written, sample);
+  if (resampler->decimator != nullptr)
+  {
+    decimatorPush(resampler->decimator, sample);
+    if (resampler->written + 1 == resampler->out_count)
+      decimatorFinish(resampler->decimator);
+  }
+  resampler->written++;
+}
+
+static inline sample_t interpolate(sample_t a, sample_t b, float fraction)
+{
+#if SAMPLE_INT16
+  return (sample_t)lroundf(a + (b - a) * fraction);
+#else
+  return a + (b - a) * fraction;
+#endif
+}
+
+bool resamplerPush(SampleResampler *resampler, uint32_t t_us, const sample_t *sample)
+{
+  if (resamplerDone(resampler))
+    return true;
+
+  if (resampler->written == 0)
+  {
+    resampler->start_us = t_us;
+    writeGridPoint(resampler, sample);
+  }
+  else
+  {
+    // Times relative to the previous read, so micros() wrapping mid-window does not matter
+    uint32_t interval = t_us - resampler->previous_us;
+    jitterAdd(&resampler->jitter, interval, resampler->period_us);
+    float per_us = interval > 0 ? 1.0f / interval : 0.0f;
+    while (!resamplerDone(resampler))
+    {
+      uint32_t grid = resampler->start_us + (uint32_t)resampler->written * resampler->period_us;
+      uint32_t offset = grid - resampler->previous_us;
+      if (offset > interval)
+        break; // Past this read, waits for the next one
+      if (offset == interval)
+      {
+        writeGridPoint(resampler, sample);
+      }
+      else
+      {
+        sample_t point[NUM_FEATURES];
+        float fraction = offset * per_us;
+        for (int channel = 0; channel < NUM_FEATURES; channel++)
+          point[channel] = interpolate(resampler->previous[channel], sample[channel], fraction);
+        writeGridPoint(resampler, point);
+      }
+    }
+  }
+
+  resampler->previous_us = t_us;
+  memcpy(resampler->previous, sample, sizeof(sample_t) * NUM_FEATURES);
+  return resamplerDone(resampler);
+}
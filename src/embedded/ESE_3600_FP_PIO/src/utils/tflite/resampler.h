@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include "decimator.h"
+#include "imu_provider.h"
+#include "sample_store.h"
+
+// Streaming resampler from timestamped reads onto the uniform grid the decimator and model expect.
+//
+// Reads land wherever the task actually ran: a late task, a slow I2C read or a sensor stall all move
+// them. Each read carries its micros() timestamp, and every grid point (first read + k * period_us)
+// the new read has passed is linearly interpolated between it and the previous read. A grid point
+// that falls exactly on a read takes the read as it is, so on-time reads pass through unchanged.
+//
+// The window is therefore out_count grid points of real time, however many reads it took.
+//
+// A decimator given to resamplerReset() is pushed every grid point as it is written and finished with
+// the window, so an oversampled window is already decimated when its last read lands.
+
+// Spacing of the reads that made up a window, in microseconds
+struct SampleJitter
+{
+  uint32_t intervals; // Reads after the first
+  uint32_t late;      // Intervals longer than 1.5 periods, at least one grid point was interpolated across a gap
+  uint32_t min_us;
+  uint32_t max_us;
+  float mean_us;
+  float m2; // Sum of squared differences from the mean (Welford)
+};
+
+struct SampleResampler
+{
+  SampleBuffer out; // Grid point k goes to sample k
+  int out_count;
+  int written; // Grid points written so far
+  uint32_t period_us;
+  uint32_t start_us; // Time of grid point 0, the first read
+  uint32_t previous_us;
+  sample_t previous[NUM_FEATURES];
+  SampleJitter jitter;
+  Decimator<sample_t> *decimator; // nullptr if the grid points are only stored
+};
+
+void resamplerReset(SampleResampler *resampler, SampleBuffer out, int out_count, uint32_t period_us,
+                    Decimator<sample_t> *decimator = nullptr);
+
+// Adds one read taken at t_us. Returns true once all out_count grid points have been written.
+bool resamplerPush(SampleResampler *resampler, uint32_t t_us, const sample_t *sample);
+
+inline bool resamplerDone(const SampleResampler *resampler)
+{
+  return resampler->written >= resampler->out_count;
+}
+
+// Reads the window took, the first one included
+inline uint32_t resamplerReads(const SampleResampler *resampler)
+{
+  return resampler->written > 0 ? resampler->jitter.intervals + 1 : 0;
+}
+
+void jitterReset(SampleJitter *jitter);
+void jitterAdd(SampleJitter *jitter, uint32_t interval_us, uint32_t period_us);
+float jitterStddevUs(const SampleJitter *jitter);
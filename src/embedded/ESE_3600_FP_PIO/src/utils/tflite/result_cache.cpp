@@ -0,0 +1,107 @@
+#include "result_cache.h"
+#include "inference.h"
+#include <Arduino.h>
+#include <math.h>
+#include <stdlib.h>
+
+struct CacheEntry
+{
+  bool used;
+  uint32_t window; // Lookup number of the window that was classified
+  WindowSignature signature;
+  InferenceResult result;
+};
+
+static CacheEntry last_entry = {}; // The last window that ran the model
+
+ResultCacheStats result_cache_stats = {};
+
+static uint8_t quantize(float value, float full_scale)
+{
+  int level = (int)(value / full_scale * RESULT_CACHE_LEVELS);
+  return (uint8_t)(level < 0 ? 0 : (level >= RESULT_CACHE_LEVELS ? RESULT_CACHE_LEVELS - 1 : level));
+}
+
+void windowSignature(const float *input, size_t samples, WindowSignature *signature)
+{
+  float sum[NUM_FEATURES] = {}, sum_squares[NUM_FEATURES] = {};
+  for (size_t i = 0; i < samples; i++)
+  {
+    for (int c = 0; c < NUM_FEATURES; c++)
+    {
+      float value = input[i * NUM_FEATURES + c];
+      sum[c] += value;
+      sum_squares[c] += value * value;
+    }
+  }
+  for (int c = 0; c < NUM_FEATURES; c++)
+  {
+    float mean = sum[c] / samples;
+    float variance = sum_squares[c] / samples - mean * mean;
+    signature->mean[c] = quantize(mean, 1.0f);
+    signature->spread[c] = quantize(variance > 0 ? sqrtf(variance) : 0.0f, 0.5f);
+  }
+}
+
+bool resultCacheable(const WindowSignature &signature)
+{
+  for (int c = 0; c < NUM_FEATURES; c++)
+  {
+    if (signature.spread[c] >= RESULT_CACHE_MAX_SPREAD)
+      return false;
+  }
+  return true;
+}
+
+static bool matches(const WindowSignature &a, const WindowSignature &b)
+{
+  for (int c = 0; c < NUM_FEATURES; c++)
+  {
+    if (abs(a.mean[c] - b.mean[c]) > RESULT_CACHE_TOLERANCE || abs(a.spread[c] - b.spread[c]) > RESULT_CACHE_TOLERANCE)
+      return false;
+  }
+  return true;
+}
+
+const InferenceResult *resultCacheLookup(const WindowSignature &signature, uint32_t *stored_window)
+{
+  uint32_t window = result_cache_stats.windows++;
+  if (!resultCacheable(signature))
+    return nullptr;
+  result_cache_stats.lookups++;
+  if (!last_entry.used || last_entry.window + 1 != window || !matches(last_entry.signature, signature))
+    return nullptr;
+  result_cache_stats.hits++;
+  if (stored_window)
+    *stored_window = last_entry.window;
+  return &last_entry.result;
+}
+
+void resultCacheStore(const WindowSignature &signature, const InferenceResult &result)
+{
+  if (!result.valid || !resultCacheable(signature))
+    return;
+  last_entry.used = true;
+  last_entry.window = result_cache_stats.windows - 1; // Stored right after its own lookup
+  last_entry.signature = signature;
+  last_entry.result = result;
+}
+
+void resultCacheClear()
+{
+  last_entry.used = false;
+}
+
+void resultCacheReport(Print &out)
+{
+  const ResultCacheStats &stats = result_cache_stats;
+  if (!RESULT_CACHE)
+  {
+    out.println("Result cache is off (build with -DRESULT_CACHE=1)");
+    return;
+  }
+  out.printf("Result cache: %lu hits of %lu lookups (%.1f%%), %lu windows (%.1f%% without Invoke)\n",
+             (unsigned long)stats.hits, (unsigned long)stats.lookups,
+             stats.lookups ? 100.0 * stats.hits / stats.lookups : 0.0, (unsigned long)stats.windows,
+             stats.windows ? 100.0 * stats.hits / stats.windows : 0.0);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "imu_provider.h"
+
+// Reuses the previous result when a window looks like the one just before it, mostly the rest between
+// reps, where successive windows barely change but each would cost a full Invoke().
+// The signature is each channel's mean and standard deviation over the model input, quantized to
+// RESULT_CACHE_LEVELS steps of [0, 1] (deviation of [0, 0.5]); a window hits when every quantized value is
+// within RESULT_CACHE_TOLERANCE steps of the previous window's. Only windows whose channels all deviate
+// less than RESULT_CACHE_MAX_SPREAD steps are cached or looked up, so windows with real motion always run
+// the model. A result is reused for the next window only, never for a hit's successor, so it cannot drift
+// along a slow change; older results changed the predicted class on the replay corpus (cache_check.py).
+
+#ifndef RESULT_CACHE
+#define RESULT_CACHE 1
+#endif
+
+#ifndef RESULT_CACHE_TOLERANCE
+#define RESULT_CACHE_TOLERANCE 1
+#endif
+
+const int RESULT_CACHE_LEVELS = 64;
+const int RESULT_CACHE_MAX_SPREAD = 2;
+
+class Print;
+struct InferenceResult;
+
+struct WindowSignature
+{
+  uint8_t mean[NUM_FEATURES];
+  uint8_t spread[NUM_FEATURES]; // Standard deviation
+};
+
+struct ResultCacheStats
+{
+  uint32_t lookups; // Windows quiet enough to be looked up
+  uint32_t hits;
+  uint32_t windows; // Every window, looked up or not
+};
+
+extern ResultCacheStats result_cache_stats;
+
+// Signature of samples rows of NUM_FEATURES model inputs
+void windowSignature(const float *input, size_t samples, WindowSignature *signature);
+
+// Whether the window is quiet enough for the cache
+bool resultCacheable(const WindowSignature &signature);
+
+// The cached result for a matching window, nullptr on a miss. Counts the window either way. On a hit
+// stored_window, if given, is the number (0 based, in lookup order) of the window the result came from.
+const InferenceResult *resultCacheLookup(const WindowSignature &signature, uint32_t *stored_window = nullptr);
+
+// Keeps result for signature, for the next window's lookup
+void resultCacheStore(const WindowSignature &signature, const InferenceResult &result);
+
+// Forgets every entry, for when the model changes or a session starts after sleep (sleepUntilMotion())
+void resultCacheClear();
+
+void resultCacheReport(Print &out);
@@ -0,0 +1,86 @@
+#include "sample_store.h"
+
+static const char *const layout_names[2] = {"interleaved", "channel_major"};
+
+const char *sampleLayoutName(int layout)
+{
+  return layout >= 0 && layout < 2 ? layout_names[layout] : "unknown";
+}
+
+// Box sums in the decimator's types, converted the way its finish() does so the results are bit-exact
+#if SAMPLE_INT16
+typedef int32_t box_sum_t;
+static inline float boxMean(int32_t sum, float factor)
+{
+  return sum * (SAMPLE_TO_FLOAT / factor);
+}
+#else
+typedef float box_sum_t;
+static inline float boxMean(float sum, float factor)
+{
+  return sum / factor * SAMPLE_TO_FLOAT;
+}
+#endif
+
+template <int Layout>
+void storeToInput(const SampleStore<Layout> &store, size_t count, float *__restrict out)
+{
+  const sample_t *__restrict in = store.data;
+  if (Layout == SAMPLE_LAYOUT_INTERLEAVED)
+  {
+    // Already in model order, one unit-stride pass
+    for (size_t i = 0; i < count * NUM_FEATURES; i++)
+      out[i] = in[i] * SAMPLE_TO_FLOAT;
+    return;
+  }
+
+  // Transpose: each channel reads forward and writes every NUM_FEATURES-th float
+  for (int channel = 0; channel < NUM_FEATURES; channel++)
+  {
+    const sample_t *__restrict x = in + channel * store.capacity;
+    for (size_t i = 0; i < count; i++)
+      out[i * NUM_FEATURES + channel] = x[i] * SAMPLE_TO_FLOAT;
+  }
+}
+
+template <int Layout>
+void storeBoxcar(const SampleStore<Layout> &store, size_t count, size_t factor, float *__restrict out)
+{
+  const sample_t *__restrict in = store.data;
+  const size_t rows = count / factor;
+  if (Layout == SAMPLE_LAYOUT_INTERLEAVED)
+  {
+    // Each box is factor x NUM_FEATURES consecutive values, summed a row at a time
+    for (size_t i = 0; i < rows; i++)
+    {
+      box_sum_t sum[NUM_FEATURES] = {};
+      const sample_t *x = in + i * factor * NUM_FEATURES;
+      for (size_t j = 0; j < factor; j++, x += NUM_FEATURES)
+      {
+        for (int channel = 0; channel < NUM_FEATURES; channel++)
+          sum[channel] += x[channel];
+      }
+      for (int channel = 0; channel < NUM_FEATURES; channel++)
+        out[i * NUM_FEATURES + channel] = boxMean(sum[channel], (float)factor);
+    }
+    return;
+  }
+
+  // Each box is factor consecutive values of one channel, the results are scattered into rows
+  for (int channel = 0; channel < NUM_FEATURES; channel++)
+  {
+    const sample_t *__restrict x = in + channel * store.capacity;
+    for (size_t i = 0; i < rows; i++, x += factor)
+    {
+      box_sum_t sum = 0;
+      for (size_t j = 0; j < factor; j++)
+        sum += x[j];
+      out[i * NUM_FEATURES + channel] = boxMean(sum, (float)factor);
+    }
+  }
+}
+
+template void storeToInput(const SampleStore<SAMPLE_LAYOUT_INTERLEAVED> &, size_t, float *);
+template void storeToInput(const SampleStore<SAMPLE_LAYOUT_CHANNEL_MAJOR> &, size_t, float *);
+template void storeBoxcar(const SampleStore<SAMPLE_LAYOUT_INTERLEAVED> &, size_t, size_t, float *);
+template void storeBoxcar(const SampleStore<SAMPLE_LAYOUT_CHANNEL_MAJOR> &, size_t, size_t, float *);
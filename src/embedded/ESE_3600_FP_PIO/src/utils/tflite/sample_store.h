@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stddef.h>
+#include "imu_provider.h"
+
+// Layout of the sample buffer, picked at build time with -DSAMPLE_LAYOUT=...
+//
+// Interleaved (AoS) keeps the six channels of a read together: the order the sensor delivers them,
+// and the order of the model's [1, 200, 6] input, so filling and converting a window are both single
+// forward passes. Channel-major (SoA) keeps each channel contiguous, capacity samples apart; every
+// read then lands in six places and the model input has to be transposed back out of it.
+// The "store_*", "to_input_*" and "boxcar_*" bench stages time both layouts in every build.
+
+#define SAMPLE_LAYOUT_INTERLEAVED 0   // buffer[index * NUM_FEATURES + channel]
+#define SAMPLE_LAYOUT_CHANNEL_MAJOR 1 // buffer[channel * capacity + index]
+
+#ifndef SAMPLE_LAYOUT
+#define SAMPLE_LAYOUT SAMPLE_LAYOUT_INTERLEAVED
+#endif
+
+template <int Layout>
+struct SampleStore
+{
+  sample_t *data;
+  size_t capacity; // Samples per channel
+
+  size_t offset(size_t index, int channel) const
+  {
+    return Layout == SAMPLE_LAYOUT_INTERLEAVED ? index * NUM_FEATURES + channel : channel * capacity + index;
+  }
+
+  sample_t get(size_t index, int channel) const
+  {
+    return data[offset(index, channel)];
+  }
+
+  void write(size_t index, const sample_t *sample)
+  {
+    for (int channel = 0; channel < NUM_FEATURES; channel++)
+      data[offset(index, channel)] = sample[channel];
+  }
+
+  void read(size_t index, sample_t *sample) const
+  {
+    for (int channel = 0; channel < NUM_FEATURES; channel++)
+      sample[channel] = data[offset(index, channel)];
+  }
+};
+
+// The layout this build stores dataBuffer in
+typedef SampleStore<SAMPLE_LAYOUT> SampleBuffer;
+
+const char *sampleLayoutName(int layout);
+
+// Samples 0..count-1 as model input rows (count x NUM_FEATURES floats), scaled to 0..1
+template <int Layout>
+void storeToInput(const SampleStore<Layout> &store, size_t count, float *out);
+
+// Mean of every factor samples as model input rows (count / factor x NUM_FEATURES floats), scaled
+// to 0..1. The same sums in the same order as the box-car decimator.
+template <int Layout>
+void storeBoxcar(const SampleStore<Layout> &store, size_t count, size_t factor, float *out);
@@ -0,0 +1,204 @@
+#include "trace.h"
+#include <Arduino.h>
+#include <atomic>
+#include "../hal/hal.h"
+#include "../hardware/packet_transport.h"
+
+#if TRACE_ENABLED
+
+// Records come from both cores (bleStateChanged runs on the core 0 connect task), so the state shared
+// between traceRecord() and traceWake() is atomic and a sync pair takes its two slots at once.
+static TraceRecord ring[TRACE_CAPACITY];
+static std::atomic<uint32_t> head(0); // Total records written since the last clear
+static std::atomic<uint32_t> last_cycles(0);
+static std::atomic<bool> sync_pending(false);
+static std::atomic<uint32_t> slept_ms(0); // Light sleep since the last sync
+
+static void put(uint32_t slot, TraceEvent event, TracePhase phase, uint16_t arg, uint32_t timestamp)
+{
+  ring[slot & (TRACE_CAPACITY - 1)] = {timestamp, event, phase, arg};
+}
+
+void traceRecord(TraceEvent event, TracePhase phase, uint16_t arg)
+{
+  uint32_t cycles = halCycleCount();
+  if (sync_pending.load(std::memory_order_relaxed) || cycles < last_cycles.load(std::memory_order_relaxed))
+  {
+    // Slept, or the counter wrapped since the previous record
+    traceSync();
+    cycles = halCycleCount();
+  }
+  last_cycles.store(cycles, std::memory_order_relaxed);
+  put(head.fetch_add(1, std::memory_order_relaxed), event, phase, arg, cycles);
+}
+
+void traceSync()
+{
+  // Clear the flag first: a wakeup noted after the exchange below gets a sync of its own
+  sync_pending.store(false, std::memory_order_relaxed);
+  uint32_t slept = slept_ms.exchange(0, std::memory_order_relaxed);
+  uint32_t cycles = halCycleCount();
+  uint32_t us = halMicros();
+  last_cycles.store(cycles, std::memory_order_relaxed);
+  // Adjacent slots, trace_to_chrome.py pairs a SYNC with the SYNC_US right after it
+  uint32_t slot = head.fetch_add(2, std::memory_order_relaxed);
+  put(slot, TRACE_SYNC, TRACE_INSTANT, min(slept, (uint32_t)UINT16_MAX), cycles);
+  put(slot + 1, TRACE_SYNC_US, TRACE_INSTANT, 0, us);
+}
+
+void traceWake(uint32_t ms)
+{
+  slept_ms.fetch_add(ms, std::memory_order_relaxed);
+  sync_pending.store(true, std::memory_order_relaxed);
+}
+
+void traceClear()
+{
+  head.store(0);
+  slept_ms.store(0);
+  traceSync();
+}
+
+uint32_t traceTotal()
+{
+  return head.load();
+}
+
+uint32_t traceDropped()
+{
+  uint32_t total = head.load();
+  return total > TRACE_CAPACITY ? total - TRACE_CAPACITY : 0;
+}
+
+static void putU16(uint8_t *out, uint16_t value)
+{
+  out[0] = value;
+  out[1] = value >> 8;
+}
+
+static void putU32(uint8_t *out, uint32_t value)
+{
+  for (int i = 0; i < 4; i++)
+    out[i] = value >> (8 * i);
+}
+
+static void encodeRecord(const TraceRecord &record, uint8_t *out)
+{
+  putU32(out, record.timestamp);
+  out[4] = record.event;
+  out[5] = record.phase;
+  putU16(out + 6, record.arg);
+}
+
+// Streams the dump through emit() in chunks of up to chunk_size bytes
+template <typename Emit>
+static bool streamDump(size_t chunk_size, Emit emit)
+{
+  // A sync at the end lets records after the last wakeup be timed from it
+  traceSync();
+
+  uint32_t total = head.load();
+  uint32_t dropped = total > TRACE_CAPACITY ? total - TRACE_CAPACITY : 0;
+  uint32_t count = total - dropped;
+
+  uint8_t header[TRACE_HEADER_BYTES] = {'R', 'M', 'T', TRACE_VERSION};
+  putU16(header + 4, halCpuMhz());
+  putU16(header + 6, sizeof(TraceRecord));
+  putU32(header + 8, dropped);
+  putU32(header + 12, count);
+  if (!emit(header, sizeof(header)))
+    return false;
+
+  uint8_t chunk[64 * sizeof(TraceRecord)];
+  size_t per_chunk = min(chunk_size, sizeof(chunk)) / sizeof(TraceRecord);
+  for (uint32_t i = 0; i < count; i += per_chunk)
+  {
+    uint32_t n = min((uint32_t)per_chunk, count - i);
+    for (uint32_t j = 0; j < n; j++)
+      encodeRecord(ring[(dropped + i + j) & (TRACE_CAPACITY - 1)], chunk + j * sizeof(TraceRecord));
+    if (!emit(chunk, n * sizeof(TraceRecord)))
+      return false;
+  }
+  return true;
+}
+
+size_t traceSnapshot(uint8_t *out, size_t capacity)
+{
+  size_t length = 0;
+  streamDump(capacity, [&](const uint8_t *bytes, size_t n) {
+    if (length + n > capacity)
+      return false;
+    memcpy(out + length, bytes, n);
+    length += n;
+    return true;
+  });
+  return length;
+}
+
+void traceDump(Print &out)
+{
+  traceBegin(TRACE_DUMP);
+  out.println("START_TRACE");
+  streamDump(32, [&](const uint8_t *bytes, size_t n) {
+    for (size_t i = 0; i < n; i++)
+      out.printf("%02x", bytes[i]);
+    out.println();
+    return true;
+  });
+  out.println("END_TRACE");
+  out.flush();
+  traceEnd(TRACE_DUMP);
+}
+
+bool traceDumpPackets(PacketTransport &transport)
+{
+  if (!transport.ready() || transport.maxPayload() <= TRACE_PACKET_HEADER_BYTES + TRACE_HEADER_BYTES)
+    return false;
+
+  uint8_t packet[512];
+  size_t room = min(transport.maxPayload(), sizeof(packet)) - TRACE_PACKET_HEADER_BYTES;
+  uint16_t seq = 0;
+  return streamDump(room, [&](const uint8_t *bytes, size_t n) {
+    packet[0] = TRACE_PACKET_TYPE;
+    packet[1] = TRACE_VERSION;
+    putU16(packet + 2, seq++);
+    memcpy(packet + TRACE_PACKET_HEADER_BYTES, bytes, n);
+    return transport.send(packet, TRACE_PACKET_HEADER_BYTES + n);
+  });
+}
+
+#else
+
+// Compiled out: no ring, the dumps say so
+
+void traceRecord(TraceEvent, TracePhase, uint16_t) {}
+void traceSync() {}
+void traceWake(uint32_t) {}
+void traceClear() {}
+
+uint32_t traceTotal()
+{
+  return 0;
+}
+
+uint32_t traceDropped()
+{
+  return 0;
+}
+
+size_t traceSnapshot(uint8_t *, size_t)
+{
+  return 0;
+}
+
+void traceDump(Print &out)
+{
+  out.println("Tracing compiled out (TRACE_ENABLED=0)");
+}
+
+bool traceDumpPackets(PacketTransport &)
+{
+  return false;
+}
+
+#endif
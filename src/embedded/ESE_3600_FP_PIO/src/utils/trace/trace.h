@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Low-overhead binary tracing into a fixed RAM ring.
+// Each record is 8 bytes: a cycle-counter timestamp, an event id, a phase and a 16-bit argument.
+// The ring keeps the most recent TRACE_CAPACITY records; dump it with the "trace" console command
+// (or over BLE) and turn the dump into Chrome/Perfetto JSON with trace_to_chrome.py.
+//
+// Dump stream: "RMT" | version (u8) | cpu_mhz (u16) | record_bytes (u16) | dropped (u32) | count (u32)
+//              | records, oldest first. All multi-byte fields little-endian.
+// Over Serial the stream is hex encoded between START_TRACE / END_TRACE lines, over BLE it is
+// split into packets of 'T' (u8) | version (u8) | chunk_seq (u16) | bytes.
+//
+// Build with -DTRACE_ENABLED=0 to compile every trace point and the ring out.
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+class Print;
+class PacketTransport;
+
+// Event ids, trace_to_chrome.py has the matching names
+enum TraceEvent : uint8_t
+{
+  TRACE_SYNC = 0,     // timestamp is the cycle counter at a sync point, arg = ms slept since the last one
+  TRACE_SYNC_US,      // timestamp is halMicros() at the same sync point
+  TRACE_SAMPLING,     // Span: collecting one window
+  TRACE_INFERENCE,    // Span: doInference()
+  TRACE_PREPROCESS,   // Span: window averaging into the input tensor
+  TRACE_INVOKE,       // Span: interpreter Invoke()
+  TRACE_FEEDBACK,     // Span: LEDs and BLE result for one classification
+  TRACE_TASK_OVERRUN, // Instant: a timed task missed at least one period, arg = task id
+  TRACE_CUE_FINISHED, // Instant: the countdown cue sequence ended
+  TRACE_BLE_STATE,    // Instant: arg = new BleState
+  TRACE_BLE_SEND,     // Instant: arg = bytes handed to the radio
+  TRACE_DUMP,         // Span: dumping the trace itself
+  TRACE_REP,          // Instant: the segmenter finished a rep, arg = its length in ms
+  TRACE_POWER,        // Instant: arg = new PowerState
+  TRACE_EVENT_COUNT
+};
+
+enum TracePhase : uint8_t
+{
+  TRACE_INSTANT = 0,
+  TRACE_BEGIN = 1,
+  TRACE_END = 2
+};
+
+struct TraceRecord
+{
+  uint32_t timestamp;
+  uint8_t event;
+  uint8_t phase;
+  uint16_t arg;
+};
+
+const uint8_t TRACE_VERSION = 1;
+const size_t TRACE_CAPACITY = 1024; // Power of two, 8 KB of RAM
+const size_t TRACE_HEADER_BYTES = 16;
+const uint8_t TRACE_PACKET_TYPE = 'T';
+const size_t TRACE_PACKET_HEADER_BYTES = 4;
+
+void traceRecord(TraceEvent event, TracePhase phase, uint16_t arg);
+
+inline void traceBegin(TraceEvent event, uint16_t arg = 0)
+{
+  if (TRACE_ENABLED)
+    traceRecord(event, TRACE_BEGIN, arg);
+}
+
+inline void traceEnd(TraceEvent event, uint16_t arg = 0)
+{
+  if (TRACE_ENABLED)
+    traceRecord(event, TRACE_END, arg);
+}
+
+inline void traceInstant(TraceEvent event, uint16_t arg = 0)
+{
+  if (TRACE_ENABLED)
+    traceRecord(event, TRACE_INSTANT, arg);
+}
+
+// Pairs the cycle counter with the microsecond clock. The cycle counter wraps every ~18 s at
+// 240 MHz; wraps between records are caught, longer silences need a sync of their own.
+void traceSync();
+
+// Call after light sleep, which stops the cycle counter. The sync is written lazily before the next
+// record, so back-to-back idle periods cost nothing and only add up their ms.
+void traceWake(uint32_t slept_ms);
+
+void traceClear();
+
+// Records written since the last clear, and how many of them were overwritten
+uint32_t traceTotal();
+uint32_t traceDropped();
+
+// Copies out the dump stream, returns the bytes written (at most capacity)
+size_t traceSnapshot(uint8_t *out, size_t capacity);
+
+// Hex dump between START_TRACE / END_TRACE markers
+void traceDump(Print &out);
+
+// Sends the dump as 'T' packets, false if the transport is not ready or a send failed
+bool traceDumpPackets(PacketTransport &transport);
@@ -0,0 +1,222 @@
+import argparse
+import json
+import os
+import struct
+import sys
+from datetime import datetime
+
+# Host receiver for the BLE IMU stream (see src/utils/data_ops/imu_stream.h).
+# Reassembles sessions, accounts for lost packets/frames and writes a columnar binary dataset.
+
+VERSION = 1
+START, DATA, END = 1, 2, 3
+CHANNELS = ["aX", "aY", "aZ", "gX", "gY", "gZ"]
+
+HEADER = struct.Struct("<BBH")
+START_SCALES = struct.Struct("<ff")
+DATA_HEADER = struct.Struct("<IIB")
+FRAME = struct.Struct("<B6h")
+END_COUNTS = struct.Struct("<II")
+
+# Same sensitivities the device uses (+-8 g, +-500 deg/s)
+ACCEL_LSB = 4096.0 / 9.80665
+GYRO_LSB = 65.5 * 180.0 / 3.14159265
+MAX_PAYLOAD = 514  # 517 byte MTU minus the ATT header
+
+
+class Session:
+    def __init__(self, lift_name="?", lift_classification="?", accel_lsb=ACCEL_LSB, gyro_lsb=GYRO_LSB):
+        self.lift_name = lift_name
+        self.lift_classification = lift_classification
+        self.accel_lsb = accel_lsb
+        self.gyro_lsb = gyro_lsb
+        self.t = []
+        self.columns = [[] for _ in CHANNELS]
+        self.next_sample = 0
+        self.expected_seq = None
+        self.lost_packets = 0
+        self.lost_frames = 0
+        self.device_total = None
+        self.device_dropped = None
+
+
+class StreamReceiver:
+    """Feed it raw packets in arrival order, finished sessions are passed to on_session"""
+
+    def __init__(self, on_session):
+        self.on_session = on_session
+        self.session = None
+
+    def _check_seq(self, seq):
+        if self.session.expected_seq is not None:
+            self.session.lost_packets += (seq - self.session.expected_seq) & 0xFFFF
+        self.session.expected_seq = (seq + 1) & 0xFFFF
+
+    def feed(self, packet):
+        packet_type, version, seq = HEADER.unpack_from(packet)
+        if version != VERSION:
+            raise ValueError(f"Unsupported stream version {version}")
+        body = packet[HEADER.size :]
+
+        if packet_type == START:
+            if self.session is not None:
+                self.finish()
+            accel_lsb, gyro_lsb = START_SCALES.unpack_from(body)
+            pos = START_SCALES.size
+            strings = []
+            for _ in range(2):
+                length = body[pos]
+                strings.append(body[pos + 1 : pos + 1 + length].decode())
+                pos += 1 + length
+            self.session = Session(strings[0], strings[1], accel_lsb, gyro_lsb)
+            self._check_seq(seq)
+            return
+
+        if self.session is None:
+            # START was lost, keep the data with an unknown label
+            self.session = Session()
+        self._check_seq(seq)
+
+        if packet_type == DATA:
+            first_sample, t, count = DATA_HEADER.unpack_from(body)
+            if first_sample > self.session.next_sample:
+                self.session.lost_frames += first_sample - self.session.next_sample
+            for i in range(count):
+                dt, *values = FRAME.unpack_from(body, DATA_HEADER.size + i * FRAME.size)
+                if i > 0:
+                    t += dt
+                self.session.t.append(t)
+                for column, value in zip(self.session.columns, values):
+                    column.append(value)
+            self.session.next_sample = first_sample + count
+        elif packet_type == END:
+            total, dropped = END_COUNTS.unpack_from(body)
+            self.session.device_total = total
+            self.session.device_dropped = dropped
+            if total > self.session.next_sample:
+                self.session.lost_frames += total - self.session.next_sample
+            self.finish()
+
+    def finish(self):
+        if self.session is not None:
+            self.on_session(self.session)
+            self.session = None
+
+
+def write_session(base_path, index, session):
+    """Write t (u32) then each channel (i16) as contiguous little-endian columns, plus a metadata sidecar"""
+    folder = os.path.join(base_path, session.lift_classification)
+    os.makedirs(folder, exist_ok=True)
+    name = f"s{index}"
+    n = len(session.t)
+
+    columns = []
+    offset = 0
+    with open(os.path.join(folder, name + ".bin"), "wb") as f:
+        f.write(struct.pack(f"<{n}I", *session.t))
+        columns.append({"name": "t", "dtype": "<u4", "offset": offset, "unit": "ms"})
+        offset += 4 * n
+        for channel, values in zip(CHANNELS, session.columns):
+            f.write(struct.pack(f"<{n}h", *values))
+            lsb = session.accel_lsb if channel.startswith("a") else session.gyro_lsb
+            columns.append({"name": channel, "dtype": "<i2", "offset": offset, "scale": 1.0 / lsb})
+            offset += 2 * n
+
+    meta = {
+        "lN": session.lift_name,
+        "lC": session.lift_classification,
+        "frames": n,
+        "columns": columns,
+        "lost_packets": session.lost_packets,
+        "lost_frames": session.lost_frames,
+        "device_total_frames": session.device_total,
+        "device_dropped_frames": session.device_dropped,
+    }
+    with open(os.path.join(folder, name + ".json"), "w") as f:
+        json.dump(meta, f, indent=2)
+
+    print(
+        f"✓ {session.lift_name}/{session.lift_classification}: {n} frames, "
+        f"{session.lost_frames} lost ({session.lost_packets} packets), "
+        f"device dropped {session.device_dropped}"
+    )
+
+
+def read_packet_log(path):
+    """Packets captured by the BLE server, each prefixed with its u16 length"""
+    with open(path, "rb") as f:
+        data = f.read()
+    pos = 0
+    while pos + 2 <= len(data):
+        (length,) = struct.unpack_from("<H", data, pos)
+        yield data[pos + 2 : pos + 2 + length]
+        pos += 2 + length
+
+
+class LoopbackTransport:
+    """Stand-in for the radio: packs a recorded JSON session exactly like imu_stream.cpp does"""
+
+    def __init__(self, max_payload=MAX_PAYLOAD, drop_every=0):
+        self.max_frames = min(255, (max_payload - HEADER.size - DATA_HEADER.size) // FRAME.size)
+        self.drop_every = drop_every
+
+    def packets(self, json_path):
+        with open(json_path) as f:
+            recording = json.load(f)
+        seq = 0
+        sent = 0
+
+        def packet(packet_type, body):
+            nonlocal seq, sent
+            data = HEADER.pack(packet_type, VERSION, seq) + body
+            seq = (seq + 1) & 0xFFFF
+            sent += 1
+            if self.drop_every and packet_type == DATA and sent % self.drop_every == 0:
+                return None
+            return data
+
+        names = b"".join(bytes([len(s)]) + s.encode() for s in (recording["lN"], recording["lC"]))
+        yield packet(START, START_SCALES.pack(ACCEL_LSB, GYRO_LSB) + names)
+
+        samples = recording["tSD"]
+        for first in range(0, len(samples), self.max_frames):
+            chunk = samples[first : first + self.max_frames]
+            body = DATA_HEADER.pack(first, int(chunk[0]["t"]), len(chunk))
+            last_t = int(chunk[0]["t"])
+            for s in chunk:
+                dt = min(255, int(s["t"]) - last_t)
+                last_t = int(s["t"])
+                raw = [round(s[c] * (ACCEL_LSB if c.startswith("a") else GYRO_LSB)) for c in CHANNELS]
+                body += FRAME.pack(dt, *[max(-32768, min(32767, v)) for v in raw])
+            yield packet(DATA, body)
+
+        yield packet(END, END_COUNTS.pack(len(samples), 0))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Receive BLE IMU streams into a columnar dataset")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--log", help="length-prefixed packet capture from the BLE server")
+    source.add_argument("--replay", nargs="+", help="JSON recordings to push through the loopback transport")
+    parser.add_argument("--drop-every", type=int, default=0, help="loopback: drop every Nth packet")
+    parser.add_argument("--out", default=os.path.join("data", "stream_" + datetime.now().strftime("%Y_%m_%d_%H_%M_%S")))
+    args = parser.parse_args()
+
+    counter = [0]
+
+    def on_session(session):
+        write_session(args.out, counter[0], session)
+        counter[0] += 1
+
+    receiver = StreamReceiver(on_session)
+    if args.log:
+        packets = read_packet_log(args.log)
+    else:
+        loopback = LoopbackTransport(drop_every=args.drop_every)
+        packets = (p for path in args.replay for p in loopback.packets(path))
+
+    for packet in packets:
+        if packet is not None:
+            receiver.feed(packet)
+    receiver.finish()
+    print(f"\nWrote {counter[0]} sessions to {args.out}", file=sys.stderr)
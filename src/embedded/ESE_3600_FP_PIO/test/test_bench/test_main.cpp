@@ -0,0 +1,138 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <host_runtime.h>
+#include "utils/bench/bench.h"
+#include "utils/tflite/inference.h"
+
+// The bench stages (src/utils/bench/bench.h) on the host: every stage runs, the kernels are not
+// slower than their portable references, and no stage is more than BENCH_TEST_MARGIN times its
+// bench_baseline.json figure, both taken relative to the calibrate stage. bench_gate.py is the tight
+// gate (25%); this margin only catches gross regressions on whatever machine runs the tests.
+
+const float BENCH_TEST_MARGIN = 3.0f;
+const int MAX_STAGES = 32;
+
+static BenchResult results[MAX_STAGES];
+static int result_count = 0;
+
+static const BenchResult *stage(const char *name)
+{
+  for (int i = 0; i < result_count; i++)
+  {
+    if (strcmp(results[i].stage, name) == 0)
+      return &results[i];
+  }
+  return nullptr;
+}
+
+// {stage: min_us} of the host baseline's "stages" object, parsed by hand: one "name": value per line
+static int readBaseline(const char *path, std::string names[], float values[], int max)
+{
+  FILE *file = fopen(path, "r");
+  if (file == nullptr)
+    return -1;
+  char line[256];
+  int count = 0;
+  bool in_host = false, in_stages = false;
+  while (fgets(line, sizeof(line), file) && count < max)
+  {
+    if (strstr(line, "\"host\""))
+      in_host = true;
+    else if (in_host && strstr(line, "\"stages\""))
+      in_stages = true;
+    else if (in_stages && strchr(line, '}'))
+      break;
+    else if (in_stages)
+    {
+      char name[64];
+      float value;
+      if (sscanf(line, " \"%63[^\"]\": %f", name, &value) == 2)
+      {
+        names[count] = name;
+        values[count++] = value;
+      }
+    }
+  }
+  fclose(file);
+  return count;
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_every_stage_runs()
+{
+  TEST_ASSERT_NOT_NULL(stage("calibrate"));
+  for (int i = 0; i < result_count; i++)
+  {
+    const BenchResult &result = results[i];
+    // The host skips invoke (stand-in scorer) and record_write without a mounted LittleFS
+    if (strcmp(result.stage, "invoke") == 0 || strcmp(result.stage, "record_write") == 0)
+      continue;
+    TEST_ASSERT_GREATER_THAN_UINT32_MESSAGE(0, result.calls, result.stage);
+    TEST_ASSERT_TRUE_MESSAGE(result.min_us > 0 && result.min_us <= result.median_us, result.stage);
+  }
+}
+
+void test_kernels_not_slower_than_reference()
+{
+  const char *pairs[][2] = {{"normalize_kernel", "normalize_ref"}, {"fir6_kernel", "fir6_ref"}, {"softmax", "softmax_ref"}};
+  for (const auto &pair : pairs)
+  {
+    const BenchResult *kernel = stage(pair[0]), *reference = stage(pair[1]);
+    TEST_ASSERT_NOT_NULL(kernel);
+    TEST_ASSERT_NOT_NULL(reference);
+    TEST_ASSERT_TRUE_MESSAGE(kernel->min_us <= reference->min_us, pair[0]);
+  }
+}
+
+void test_stages_within_baseline_margin()
+{
+  std::string names[MAX_STAGES];
+  float baseline_us[MAX_STAGES];
+  int count = readBaseline("bench_baseline.json", names, baseline_us, MAX_STAGES);
+  if (count < 0)
+    TEST_IGNORE_MESSAGE("bench_baseline.json not found, run from the project directory");
+
+  float calibrate_us = 0;
+  for (int i = 0; i < count; i++)
+  {
+    if (names[i] == "calibrate")
+      calibrate_us = baseline_us[i];
+  }
+  TEST_ASSERT_TRUE_MESSAGE(calibrate_us > 0, "No calibrate stage in the host baseline");
+  float scale = stage("calibrate")->min_us / calibrate_us;
+
+  for (int i = 0; i < count; i++)
+  {
+    const BenchResult *result = stage(names[i].c_str());
+    if (result == nullptr || result->calls == 0)
+      continue;
+    // Two timer ticks over the batch is noise, as in bench_gate.py
+    float limit = baseline_us[i] * scale * BENCH_TEST_MARGIN + 2.0f / result->calls;
+    char message[96];
+    snprintf(message, sizeof(message), "%s: %.3f us, limit %.3f us", names[i].c_str(), result->min_us, limit);
+    TEST_ASSERT_TRUE_MESSAGE(result->min_us <= limit, message);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  setupModel(false); // model_reload switches the resident model
+  result_count = benchRun(results, MAX_STAGES);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_every_stage_runs);
+  RUN_TEST(test_kernels_not_slower_than_reference);
+  RUN_TEST(test_stages_within_baseline_margin);
+  return UNITY_END();
+}
@@ -0,0 +1,129 @@
+#include <unity.h>
+#include <host_runtime.h>
+#include "utils/hardware/cues.h"
+#include "utils/hal/hal_host.h"
+
+// The cue queues (src/utils/hardware/cues.h) against the host HAL fake: tones and LED patterns
+// overlap, play back on schedule however late they are polled, and end with the buzzer silent.
+
+static const uint8_t buzzer_pin = 9;
+static const uint8_t led_pins[CUE_LED_COUNT] = {1, 2, 3, 4, 5};
+static int finished_calls = 0;
+
+static void onFinished()
+{
+  finished_calls++;
+}
+
+// LED levels as a mask in led_pins order
+static uint8_t ledMask()
+{
+  uint8_t mask = 0;
+  for (int i = 0; i < CUE_LED_COUNT; i++)
+  {
+    if (halHostPinState(led_pins[i]))
+      mask |= 1 << i;
+  }
+  return mask;
+}
+
+static void pollAt(uint32_t ms)
+{
+  halHostSetMillis(ms);
+  cuesUpdate();
+}
+
+void setUp()
+{
+  halHostSetMillis(0);
+  cuesSetup(buzzer_pin, led_pins);
+  cueSetFinishedCallback(onFinished);
+  finished_calls = 0;
+}
+
+void tearDown()
+{
+  cuesClear();
+  cueSetFinishedCallback(nullptr);
+}
+
+void test_tones_and_leds_overlap()
+{
+  TEST_ASSERT_TRUE(cueTone(1000, 100));
+  TEST_ASSERT_TRUE(cueTone(0, 50));
+  TEST_ASSERT_TRUE(cueTone(2000, 100, true));
+  TEST_ASSERT_TRUE(cueLeds(0x01, 120));
+  TEST_ASSERT_TRUE(cueLeds(0x12)); // Held
+
+  pollAt(0);
+  TEST_ASSERT_EQUAL_UINT32(1000, halHostToneFrequency());
+  TEST_ASSERT_EQUAL_HEX32(0x01, ledMask());
+  TEST_ASSERT_TRUE(cuesToneBusy());
+
+  pollAt(99);
+  TEST_ASSERT_EQUAL_UINT32(1000, halHostToneFrequency());
+  pollAt(100);
+  TEST_ASSERT_EQUAL_UINT32(0, halHostToneFrequency());
+  TEST_ASSERT_EQUAL_HEX32(0x01, ledMask()); // The LED pattern runs on its own clock
+  pollAt(120);
+  TEST_ASSERT_EQUAL_HEX32(0x12, ledMask());
+  pollAt(150);
+  TEST_ASSERT_EQUAL_UINT32(2000, halHostToneFrequency());
+  TEST_ASSERT_EQUAL_INT(0, finished_calls);
+
+  pollAt(250);
+  TEST_ASSERT_EQUAL_UINT32(0, halHostToneFrequency());
+  TEST_ASSERT_FALSE(cuesToneBusy());
+  TEST_ASSERT_EQUAL_INT(1, finished_calls);
+  pollAt(5000);
+  TEST_ASSERT_EQUAL_HEX32(0x12, ledMask()); // Held until the next pattern
+
+  TEST_ASSERT_TRUE(cueLeds(0x00));
+  pollAt(5001);
+  TEST_ASSERT_EQUAL_HEX32(0x00, ledMask());
+}
+
+void test_late_poll_keeps_the_schedule()
+{
+  uint32_t changes = halHostToneChanges();
+  cueTone(1000, 100);
+  cueTone(1500, 100, true);
+  cueTone(2000, 100);
+  pollAt(0);
+  // One poll long after the second tone ended: it notifies and the third still ends at 300 ms
+  pollAt(210);
+  TEST_ASSERT_EQUAL_INT(1, finished_calls);
+  TEST_ASSERT_EQUAL_UINT32(2000, halHostToneFrequency());
+  pollAt(299);
+  TEST_ASSERT_EQUAL_UINT32(2000, halHostToneFrequency());
+  pollAt(300);
+  TEST_ASSERT_EQUAL_UINT32(0, halHostToneFrequency());
+  // 1000, 1500, 2000, silence: the skipped tone is still applied, in order
+  TEST_ASSERT_EQUAL_UINT32(changes + 4, halHostToneChanges());
+}
+
+void test_queue_full_and_clear()
+{
+  for (int i = 0; i < CUE_QUEUE_LEN; i++)
+    TEST_ASSERT_TRUE(cueTone(1000 + i, 10));
+  TEST_ASSERT_FALSE(cueTone(440, 10));
+  TEST_ASSERT_TRUE(cueLeds(0x04, 10)); // The LED queue is separate
+
+  pollAt(0);
+  TEST_ASSERT_EQUAL_UINT32(1000, halHostToneFrequency());
+  cuesClear();
+  TEST_ASSERT_EQUAL_UINT32(0, halHostToneFrequency());
+  TEST_ASSERT_FALSE(cuesToneBusy());
+  pollAt(1000);
+  TEST_ASSERT_EQUAL_UINT32(0, halHostToneFrequency());
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  UNITY_BEGIN();
+  RUN_TEST(test_tones_and_leds_overlap);
+  RUN_TEST(test_late_poll_keeps_the_schedule);
+  RUN_TEST(test_queue_full_and_clear);
+  return UNITY_END();
+}
@@ -0,0 +1,188 @@
+#include <unity.h>
+#include <math.h>
+#include <string.h>
+#include "utils/tflite/decimator.h"
+#include "utils/tflite/sample_store.h"
+
+// The decimator (src/utils/tflite/decimator.h) for every filter: decimate() matches a direct
+// convolution with the ends clamped, the channel-major, interleaved and streaming paths agree bit for
+// bit, DC comes through unchanged and the box-car is bit-exact with storeBoxcar().
+
+const int INPUTS = 1000;
+const int OUTPUTS = INPUTS / DECIMATION_FACTOR;
+
+static float input[INPUTS * DECIMATOR_CHANNELS];
+static float input_channel_major[INPUTS * DECIMATOR_CHANNELS];
+static int16_t input_int16[INPUTS * DECIMATOR_CHANNELS];
+
+// Deterministic IMU-like signal: a slow swing, a tone near the output Nyquist and noise
+static void fillInput()
+{
+  uint32_t state = 12345;
+  for (int n = 0; n < INPUTS; n++)
+  {
+    for (int c = 0; c < DECIMATOR_CHANNELS; c++)
+    {
+      state = state * 1664525u + 1013904223u;
+      float noise = (float)(state >> 8) / (1 << 24) - 0.5f;
+      float value = 0.5f + 0.3f * sinf(0.01f * n * (c + 1)) + 0.1f * sinf(0.6f * n) + 0.05f * noise;
+      input[n * DECIMATOR_CHANNELS + c] = value;
+      input_channel_major[c * INPUTS + n] = value;
+      input_int16[n * DECIMATOR_CHANNELS + c] = (int16_t)lroundf(value * 16384.0f);
+    }
+  }
+}
+
+// Output i of the filter straight from its definition, in double
+static double reference(const DecimatorTaps *taps, const float *x, int i, int c)
+{
+  double sum = 0;
+  for (int k = 0; k < taps->length; k++)
+  {
+    long n = (long)i * DECIMATION_FACTOR + taps->delay - k;
+    n = n < 0 ? 0 : (n >= INPUTS ? INPUTS - 1 : n);
+    sum += (double)taps->taps[k] * x[n * DECIMATOR_CHANNELS + c];
+  }
+  return sum / taps->gain;
+}
+
+static void checkFilter(int filter)
+{
+  const DecimatorTaps *taps = decimatorTaps(filter);
+  TEST_ASSERT_EQUAL_INT(filter, taps->filter);
+
+  static float out[OUTPUTS * DECIMATOR_CHANNELS], out_channel_major[OUTPUTS * DECIMATOR_CHANNELS],
+      out_int16[OUTPUTS * DECIMATOR_CHANNELS];
+  decimate(taps, input, INPUTS, out, OUTPUTS);
+  decimateChannelMajor(taps, input_channel_major, INPUTS, INPUTS, out_channel_major, OUTPUTS);
+  decimate(taps, input_int16, INPUTS, out_int16, OUTPUTS, 1.0f / 16384.0f);
+
+  TEST_ASSERT_EQUAL_MEMORY(out, out_channel_major, sizeof(out));
+  for (int i = 0; i < OUTPUTS; i++)
+  {
+    for (int c = 0; c < DECIMATOR_CHANNELS; c++)
+    {
+      float expected = (float)reference(taps, input, i, c);
+      TEST_ASSERT_FLOAT_WITHIN(1e-5f, expected, out[i * DECIMATOR_CHANNELS + c]);
+      // Quantized input and, for the sinc, Q12 taps
+      TEST_ASSERT_FLOAT_WITHIN(2e-3f, expected, out_int16[i * DECIMATOR_CHANNELS + c]);
+    }
+  }
+}
+
+// Pushed one sample at a time, float and int16: the same sums as the whole-window pass
+static void checkStreaming(int filter)
+{
+  const DecimatorTaps *taps = decimatorTaps(filter);
+  static float whole[OUTPUTS * DECIMATOR_CHANNELS], streamed[OUTPUTS * DECIMATOR_CHANNELS];
+
+  Decimator<float> decimator;
+  decimate(taps, input, INPUTS, whole, OUTPUTS, 0.5f);
+  memset(streamed, 0, sizeof(streamed));
+  decimatorReset(&decimator, taps, streamed, OUTPUTS, 0.5f);
+  for (int n = 0; n < INPUTS; n++)
+  {
+    TEST_ASSERT_FALSE(decimatorDone(&decimator));
+    decimatorPush(&decimator, input + n * DECIMATOR_CHANNELS);
+  }
+  decimatorFinish(&decimator);
+  TEST_ASSERT_TRUE(decimatorDone(&decimator));
+  TEST_ASSERT_EQUAL_MEMORY(whole, streamed, sizeof(whole));
+
+  Decimator<int16_t> int_decimator;
+  decimate(taps, input_int16, INPUTS, whole, OUTPUTS, 1.0f / 16384.0f);
+  memset(streamed, 0, sizeof(streamed));
+  decimatorReset(&int_decimator, taps, streamed, OUTPUTS, 1.0f / 16384.0f);
+  for (int n = 0; n < INPUTS; n++)
+    decimatorPush(&int_decimator, input_int16 + n * DECIMATOR_CHANNELS);
+  decimatorFinish(&int_decimator);
+  TEST_ASSERT_EQUAL_MEMORY(whole, streamed, sizeof(whole));
+}
+
+static void checkDc(int filter)
+{
+  const DecimatorTaps *taps = decimatorTaps(filter);
+  static float dc[INPUTS * DECIMATOR_CHANNELS];
+  static int16_t dc_int16[INPUTS * DECIMATOR_CHANNELS];
+  for (int i = 0; i < INPUTS * DECIMATOR_CHANNELS; i++)
+  {
+    dc[i] = 0.75f;
+    dc_int16[i] = 12288;
+  }
+  float out[OUTPUTS * DECIMATOR_CHANNELS], out_int16[OUTPUTS * DECIMATOR_CHANNELS];
+  decimate(taps, dc, INPUTS, out, OUTPUTS);
+  decimate(taps, dc_int16, INPUTS, out_int16, OUTPUTS, 1.0f / 16384.0f);
+  for (int i = 0; i < OUTPUTS * DECIMATOR_CHANNELS; i++)
+  {
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.75f, out[i]);
+    TEST_ASSERT_FLOAT_WITHIN(1e-6f, 0.75f, out_int16[i]);
+  }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_boxcar_matches_reference()
+{
+  checkFilter(DECIMATOR_BOXCAR);
+}
+
+void test_sinc_matches_reference()
+{
+  checkFilter(DECIMATOR_SINC);
+}
+
+void test_cic_matches_reference()
+{
+  checkFilter(DECIMATOR_CIC);
+}
+
+void test_streaming_matches_whole_window()
+{
+  for (int filter = 0; filter < DECIMATOR_FILTER_COUNT; filter++)
+    checkStreaming(filter);
+}
+
+void test_dc_passes_unchanged()
+{
+  for (int filter = 0; filter < DECIMATOR_FILTER_COUNT; filter++)
+    checkDc(filter);
+}
+
+void test_boxcar_bit_exact_with_box_means()
+{
+  // The same sums storeBoxcar() makes over this build's sample type
+  static sample_t samples[INPUTS * NUM_FEATURES];
+  for (int i = 0; i < INPUTS * NUM_FEATURES; i++)
+    samples[i] = (sample_t)(input[i] * SAMPLE_ONE);
+  static float boxes[OUTPUTS * NUM_FEATURES], decimated[OUTPUTS * NUM_FEATURES];
+  storeBoxcar(SampleStore<SAMPLE_LAYOUT_INTERLEAVED>{samples, INPUTS}, INPUTS, DECIMATION_FACTOR, boxes);
+  decimate(decimatorTaps(DECIMATOR_BOXCAR), samples, INPUTS, decimated, OUTPUTS, SAMPLE_TO_FLOAT);
+  TEST_ASSERT_EQUAL_MEMORY(boxes, decimated, sizeof(boxes));
+}
+
+void test_names_round_trip()
+{
+  for (int filter = 0; filter < DECIMATOR_FILTER_COUNT; filter++)
+    TEST_ASSERT_EQUAL_INT(filter, decimatorFromName(decimatorName(filter)));
+  TEST_ASSERT_EQUAL_INT(-1, decimatorFromName("median"));
+}
+
+int main(int argc, char **argv)
+{
+  fillInput();
+  UNITY_BEGIN();
+  RUN_TEST(test_boxcar_matches_reference);
+  RUN_TEST(test_sinc_matches_reference);
+  RUN_TEST(test_cic_matches_reference);
+  RUN_TEST(test_streaming_matches_whole_window);
+  RUN_TEST(test_dc_passes_unchanged);
+  RUN_TEST(test_boxcar_bit_exact_with_box_means);
+  RUN_TEST(test_names_round_trip);
+  return UNITY_END();
+}
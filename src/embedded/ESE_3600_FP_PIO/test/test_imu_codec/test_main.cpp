@@ -0,0 +1,164 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include <host_runtime.h>
+#include "utils/data_ops/imu_codec.h"
+
+// The compressed recording codec (src/utils/data_ops/imu_codec.h) encoded and decoded on the device side:
+// a replayed session round-trips to its 3 decimal places, the first sample and the largest deltas need no
+// special case, and truncated input is rejected without moving the decoder on.
+
+static const char *const session_path = "data/2024_11_24_20_36_44/p_f/d0.json";
+
+static ImuEncoder encoder;
+static ImuDecoder decoder;
+
+static void assertSameSample(uint32_t expected_t, const float *expected, uint32_t t, const float *values)
+{
+  TEST_ASSERT_EQUAL_UINT32(expected_t, t);
+  for (int c = 0; c < IMU_CODEC_CHANNELS; c++)
+  {
+    // Quantized to 1 / IMU_CODEC_SCALE, rounded to the nearest step
+    TEST_ASSERT_FLOAT_WITHIN(0.5f / IMU_CODEC_SCALE + 1e-6f, expected[c], values[c]);
+  }
+}
+
+void setUp()
+{
+  imuEncoderReset(&encoder);
+  imuDecoderReset(&decoder);
+}
+
+void tearDown()
+{
+}
+
+void test_replay_session_round_trips()
+{
+  if (!hostReplayLoad(session_path))
+    TEST_IGNORE_MESSAGE("Recording not found, run from the project directory");
+  const HostReplaySession &session = hostReplaySession(0);
+
+  // The session as the recorder sees it: one sample each time the replay moves on
+  std::vector<uint8_t> file(IMU_CODEC_MAX_HEADER_BYTES);
+  file.resize(imuEncodeHeader(session.lift.c_str(), session.lift_class.c_str(), file.data()));
+  std::vector<uint32_t> times;
+  std::vector<float> samples;
+  float previous[IMU_CODEC_CHANNELS] = {};
+  for (uint32_t ms = session.start_ms; ms <= session.end_ms; ms++)
+  {
+    float sample[IMU_CODEC_CHANNELS];
+    hostImuPeek(ms, sample, sample + 3);
+    if (!times.empty() && memcmp(sample, previous, sizeof(sample)) == 0)
+      continue;
+    memcpy(previous, sample, sizeof(sample));
+    times.push_back(ms);
+    samples.insert(samples.end(), sample, sample + IMU_CODEC_CHANNELS);
+    size_t length = file.size();
+    file.resize(length + IMU_CODEC_MAX_SAMPLE_BYTES);
+    file.resize(length + imuEncodeSample(&encoder, ms, sample, file.data() + length));
+  }
+  TEST_ASSERT_GREATER_THAN(100, times.size());
+
+  char lift[IMU_CODEC_MAX_NAME_LEN + 1], lift_class[IMU_CODEC_MAX_NAME_LEN + 1];
+  size_t offset = imuDecodeHeader(file.data(), file.size(), lift, sizeof(lift), lift_class, sizeof(lift_class));
+  TEST_ASSERT_GREATER_THAN(0, offset);
+  TEST_ASSERT_EQUAL_STRING(session.lift.c_str(), lift);
+  TEST_ASSERT_EQUAL_STRING(session.lift_class.c_str(), lift_class);
+
+  for (size_t i = 0; i < times.size(); i++)
+  {
+    uint32_t t;
+    float values[IMU_CODEC_CHANNELS];
+    size_t used = imuDecodeSample(&decoder, file.data() + offset, file.size() - offset, &t, values);
+    TEST_ASSERT_GREATER_THAN(0, used);
+    assertSameSample(times[i], &samples[i * IMU_CODEC_CHANNELS], t, values);
+    offset += used;
+  }
+  TEST_ASSERT_EQUAL_UINT32(file.size(), offset);
+}
+
+void test_first_sample_and_extreme_deltas()
+{
+  // Largest steps either way that keep the quantized values in int32, and a timestamp that wraps
+  const float top = 2147483.0f;
+  const float rows[][IMU_CODEC_CHANNELS] = {
+      {top, -top, 0.001f, -0.001f, 0.0f, 9.81f},
+      {-0.0f, 0.0f, -top, top, top, -9.81f},
+      {0.0f, 0.0f, 0.0f, 0.0f, -0.001f, 0.0f},
+  };
+  const uint32_t times[] = {4000000000u, 4294967295u, 5};
+
+  uint8_t encoded[3 * IMU_CODEC_MAX_SAMPLE_BYTES];
+  size_t length = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    size_t used = imuEncodeSample(&encoder, times[i], rows[i], encoded + length);
+    TEST_ASSERT_LESS_OR_EQUAL(IMU_CODEC_MAX_SAMPLE_BYTES, used);
+    length += used;
+  }
+
+  size_t offset = 0;
+  for (int i = 0; i < 3; i++)
+  {
+    uint32_t t;
+    float values[IMU_CODEC_CHANNELS];
+    size_t used = imuDecodeSample(&decoder, encoded + offset, length - offset, &t, values);
+    TEST_ASSERT_GREATER_THAN(0, used);
+    assertSameSample(times[i], rows[i], t, values);
+    offset += used;
+  }
+  TEST_ASSERT_EQUAL_UINT32(length, offset);
+}
+
+void test_header_names_and_rejections()
+{
+  const char *long_name = "a lift name longer than thirty-two characters";
+  uint8_t header[IMU_CODEC_MAX_HEADER_BYTES];
+  size_t length = imuEncodeHeader(long_name, "p_f", header);
+  TEST_ASSERT_LESS_OR_EQUAL(IMU_CODEC_MAX_HEADER_BYTES, length);
+
+  char lift[8], lift_class[8];
+  TEST_ASSERT_EQUAL_UINT32(length, imuDecodeHeader(header, length, lift, sizeof(lift), lift_class, sizeof(lift_class)));
+  TEST_ASSERT_EQUAL_STRING("a lift ", lift); // Cut to the caller's buffer
+  TEST_ASSERT_EQUAL_STRING("p_f", lift_class);
+
+  for (size_t cut = 0; cut < length; cut++)
+    TEST_ASSERT_EQUAL_UINT32(0, imuDecodeHeader(header, cut, lift, sizeof(lift), lift_class, sizeof(lift_class)));
+  header[3] = IMU_CODEC_VERSION + 1;
+  TEST_ASSERT_EQUAL_UINT32(0, imuDecodeHeader(header, length, lift, sizeof(lift), lift_class, sizeof(lift_class)));
+  header[3] = IMU_CODEC_VERSION;
+  header[4]++; // Scale
+  TEST_ASSERT_EQUAL_UINT32(0, imuDecodeHeader(header, length, lift, sizeof(lift), lift_class, sizeof(lift_class)));
+}
+
+void test_truncated_sample_leaves_the_decoder()
+{
+  const float first[IMU_CODEC_CHANNELS] = {1.0f, 2.0f, 3.0f, 0.1f, 0.2f, 0.3f};
+  const float second[IMU_CODEC_CHANNELS] = {-500.0f, 2.0f, 3.5f, 0.1f, -0.2f, 1000.0f};
+  uint8_t encoded[2 * IMU_CODEC_MAX_SAMPLE_BYTES];
+  size_t first_length = imuEncodeSample(&encoder, 10, first, encoded);
+  size_t length = first_length + imuEncodeSample(&encoder, 15, second, encoded + first_length);
+
+  uint32_t t;
+  float values[IMU_CODEC_CHANNELS];
+  TEST_ASSERT_EQUAL_UINT32(first_length, imuDecodeSample(&decoder, encoded, length, &t, values));
+  for (size_t cut = 0; cut < length - first_length; cut++)
+    TEST_ASSERT_EQUAL_UINT32(0, imuDecodeSample(&decoder, encoded + first_length, cut, &t, values));
+
+  // Still decodes the second sample against the first
+  TEST_ASSERT_EQUAL_UINT32(length - first_length,
+                           imuDecodeSample(&decoder, encoded + first_length, length - first_length, &t, values));
+  assertSameSample(15, second, t, values);
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_session_round_trips);
+  RUN_TEST(test_first_sample_and_extreme_deltas);
+  RUN_TEST(test_header_names_and_rejections);
+  RUN_TEST(test_truncated_sample_leaves_the_decoder);
+  return UNITY_END();
+}
@@ -0,0 +1,61 @@
+#include <unity.h>
+#include <host_runtime.h>
+#include "utils/tflite/imu_provider.h"
+#include "utils/hardware/mpu.h"
+
+// IMU profile switches (src/utils/tflite/imu_provider.h): a request mid-window changes neither the
+// window length, the read period nor the chip's sample rate until the next window boundary.
+
+void setUp()
+{
+  imuRequestProfile(IMU_PROFILE_OVERSAMPLE);
+  imuBeginWindow();
+}
+
+void tearDown()
+{
+}
+
+void test_request_waits_for_the_window_boundary()
+{
+  imuRequestProfile(IMU_PROFILE_MODEL_RATE);
+  TEST_ASSERT_EQUAL_INT(IMU_PROFILE_OVERSAMPLE, imu_profile);
+  TEST_ASSERT_EQUAL_INT(IMU_PROFILE_MODEL_RATE, imuPendingProfile());
+  TEST_ASSERT_EQUAL_INT(BUFFER_LEN, imuWindowSamples());
+  TEST_ASSERT_EQUAL_UINT32(1, imuSampleIntervalMs());
+  TEST_ASSERT_EQUAL_UINT8(0, mpu.getSampleRateDivisor());
+
+  TEST_ASSERT_TRUE(imuBeginWindow());
+  TEST_ASSERT_EQUAL_INT(IMU_PROFILE_MODEL_RATE, imu_profile);
+  TEST_ASSERT_EQUAL_INT(BUFFER_LEN / (1 + IMU_MODEL_RATE_DIVISOR), imuWindowSamples());
+  TEST_ASSERT_EQUAL_UINT32(1 + IMU_MODEL_RATE_DIVISOR, imuSampleIntervalMs());
+  TEST_ASSERT_EQUAL_UINT8(IMU_MODEL_RATE_DIVISOR, mpu.getSampleRateDivisor());
+  TEST_ASSERT_FALSE(imuBeginWindow()); // Nothing pending
+}
+
+void test_request_reverted_before_the_boundary()
+{
+  imuRequestProfile(IMU_PROFILE_MODEL_RATE);
+  imuRequestProfile(IMU_PROFILE_OVERSAMPLE);
+  TEST_ASSERT_FALSE(imuBeginWindow());
+  TEST_ASSERT_EQUAL_INT(IMU_PROFILE_OVERSAMPLE, imu_profile);
+  TEST_ASSERT_EQUAL_UINT8(0, mpu.getSampleRateDivisor());
+}
+
+void test_profile_names()
+{
+  for (int profile = 0; profile < IMU_PROFILE_COUNT; profile++)
+    TEST_ASSERT_EQUAL_INT(profile, imuProfileFromName(imuProfileName((ImuProfile)profile)));
+  TEST_ASSERT_EQUAL_INT(-1, imuProfileFromName("fast"));
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  imuSetup();
+  UNITY_BEGIN();
+  RUN_TEST(test_request_waits_for_the_window_boundary);
+  RUN_TEST(test_request_reverted_before_the_boundary);
+  RUN_TEST(test_profile_names);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+#include <unity.h>
+#include <string.h>
+#include "utils/data_ops/imu_stream.h"
+
+// The IMU stream (src/utils/data_ops/imu_stream.h) through LoopbackTransport: a session started before
+// the link is up or before the MTU is negotiated drops frames only until then, and every packet is sized
+// for the payload at the time it is started.
+
+static ImuStream stream;
+
+static const int16_t frame[IMU_STREAM_CHANNELS] = {1, -2, 3, -4, 5, -6};
+
+static uint32_t get_u32(const uint8_t *in)
+{
+  return in[0] | in[1] << 8 | in[2] << 16 | (uint32_t)in[3] << 24;
+}
+
+static uint8_t packetType(const LoopbackTransport &transport, int index)
+{
+  return transport.packet(index)[0];
+}
+
+static uint16_t packetSeq(const LoopbackTransport &transport, int index)
+{
+  return transport.packet(index)[2] | transport.packet(index)[3] << 8;
+}
+
+// first_sample and frame_count of a DATA packet
+static void dataCounts(const LoopbackTransport &transport, int index, uint32_t *first_sample, int *frames)
+{
+  *first_sample = get_u32(transport.packet(index) + 4);
+  *frames = transport.packet(index)[IMU_STREAM_DATA_HEADER_BYTES - 1];
+}
+
+static void addFrames(int count)
+{
+  for (int i = 0; i < count; i++)
+    imuStreamAdd(&stream, stream.next_sample * 10, frame);
+}
+
+void setUp()
+{
+  memset(&stream, 0, sizeof(stream));
+}
+
+void tearDown()
+{
+}
+
+void test_full_session_round_trip()
+{
+  LoopbackTransport transport;
+  TEST_ASSERT_TRUE(imuStreamBegin(&stream, transport, "dC", "good"));
+  addFrames(40); // 38 frames fit 512 bytes
+  TEST_ASSERT_TRUE(imuStreamEnd(&stream));
+
+  TEST_ASSERT_EQUAL_INT(4, transport.packetCount());
+  TEST_ASSERT_EQUAL_UINT8(IMU_STREAM_START, packetType(transport, 0));
+  uint32_t first_sample;
+  int frames;
+  dataCounts(transport, 1, &first_sample, &frames);
+  TEST_ASSERT_EQUAL_UINT32(0, first_sample);
+  TEST_ASSERT_EQUAL_INT(38, frames);
+  dataCounts(transport, 2, &first_sample, &frames);
+  TEST_ASSERT_EQUAL_UINT32(38, first_sample);
+  TEST_ASSERT_EQUAL_INT(2, frames);
+  TEST_ASSERT_EQUAL_UINT8(IMU_STREAM_END, packetType(transport, 3));
+  TEST_ASSERT_EQUAL_UINT32(40, get_u32(transport.packet(3) + 4));
+  TEST_ASSERT_EQUAL_UINT32(0, get_u32(transport.packet(3) + 8));
+  for (int i = 0; i < transport.packetCount(); i++)
+    TEST_ASSERT_EQUAL_UINT16(i, packetSeq(transport, i));
+}
+
+void test_session_before_mtu_negotiation()
+{
+  // Default 23 byte MTU: 20 bytes of payload hold the DATA header but no frame
+  LoopbackTransport transport(20);
+  TEST_ASSERT_FALSE(imuStreamBegin(&stream, transport, "bP", "good"));
+  addFrames(5);
+  TEST_ASSERT_EQUAL_INT(0, transport.packetCount());
+  TEST_ASSERT_EQUAL_UINT32(5, stream.dropped_frames);
+
+  transport.setMaxPayload(IMU_STREAM_DATA_HEADER_BYTES + 4 * IMU_STREAM_FRAME_BYTES);
+  addFrames(6);
+  TEST_ASSERT_TRUE(imuStreamEnd(&stream));
+
+  // START, DATA 5..8, DATA 9..10, END
+  TEST_ASSERT_EQUAL_INT(4, transport.packetCount());
+  TEST_ASSERT_EQUAL_UINT8(IMU_STREAM_START, packetType(transport, 0));
+  TEST_ASSERT_EQUAL_UINT16(0, packetSeq(transport, 0));
+  uint32_t first_sample;
+  int frames;
+  dataCounts(transport, 1, &first_sample, &frames);
+  TEST_ASSERT_EQUAL_UINT32(5, first_sample);
+  TEST_ASSERT_EQUAL_INT(4, frames);
+  dataCounts(transport, 2, &first_sample, &frames);
+  TEST_ASSERT_EQUAL_UINT32(9, first_sample);
+  TEST_ASSERT_EQUAL_INT(2, frames);
+  TEST_ASSERT_EQUAL_UINT32(11, get_u32(transport.packet(3) + 4));
+  TEST_ASSERT_EQUAL_UINT32(5, get_u32(transport.packet(3) + 8));
+}
+
+void test_session_before_the_link_is_ready()
+{
+  LoopbackTransport transport;
+  transport.setReady(false);
+  TEST_ASSERT_FALSE(imuStreamBegin(&stream, transport, "dF", "bad"));
+  addFrames(3);
+  transport.setReady(true);
+  addFrames(2);
+  TEST_ASSERT_TRUE(imuStreamEnd(&stream));
+
+  TEST_ASSERT_EQUAL_INT(3, transport.packetCount());
+  TEST_ASSERT_EQUAL_UINT8(IMU_STREAM_START, packetType(transport, 0));
+  // The lift names were kept for the late START
+  const uint8_t *start = transport.packet(0) + 4 + 8;
+  TEST_ASSERT_EQUAL_UINT8(2, start[0]);
+  TEST_ASSERT_EQUAL_MEMORY("dF", start + 1, 2);
+  uint32_t first_sample;
+  int frames;
+  dataCounts(transport, 1, &first_sample, &frames);
+  TEST_ASSERT_EQUAL_UINT32(3, first_sample);
+  TEST_ASSERT_EQUAL_INT(2, frames);
+  TEST_ASSERT_EQUAL_UINT32(3, get_u32(transport.packet(2) + 8));
+}
+
+void test_mtu_shrink_between_packets()
+{
+  LoopbackTransport transport;
+  TEST_ASSERT_TRUE(imuStreamBegin(&stream, transport, "dC", "good"));
+  addFrames(38); // One full packet
+  transport.setMaxPayload(IMU_STREAM_DATA_HEADER_BYTES + IMU_STREAM_FRAME_BYTES); // Reconnected at a small MTU
+  addFrames(2);
+  TEST_ASSERT_TRUE(imuStreamEnd(&stream));
+
+  TEST_ASSERT_EQUAL_INT(5, transport.packetCount());
+  for (int i = 2; i < 4; i++)
+  {
+    TEST_ASSERT_TRUE(transport.packetLength(i) <= IMU_STREAM_DATA_HEADER_BYTES + IMU_STREAM_FRAME_BYTES);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, stream.dropped_frames);
+}
+
+void test_session_never_connects()
+{
+  LoopbackTransport transport;
+  transport.setReady(false);
+  TEST_ASSERT_FALSE(imuStreamBegin(&stream, transport, "dC", "good"));
+  addFrames(4);
+  TEST_ASSERT_FALSE(imuStreamEnd(&stream));
+  TEST_ASSERT_EQUAL_INT(0, transport.packetCount());
+  TEST_ASSERT_EQUAL_UINT32(4, stream.dropped_frames);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_full_session_round_trip);
+  RUN_TEST(test_session_before_mtu_negotiation);
+  RUN_TEST(test_session_before_the_link_is_ready);
+  RUN_TEST(test_mtu_shrink_between_packets);
+  RUN_TEST(test_session_never_connects);
+  return UNITY_END();
+}
@@ -0,0 +1,86 @@
+#include <unity.h>
+#include <string.h>
+#include "utils/kernels/kernel_check.h"
+#include "utils/kernels/kernels.h"
+
+// The build's float kernels (src/utils/kernels/kernels.h) against the portable reference on the
+// "kernels" command's fixed inputs: bit for bit (0 ULP), tails included, and the exp polynomial within
+// KERNEL_EXP_MAX_ULP of libm. kernel_check.py is the same check on a device capture.
+
+const uint32_t KERNEL_EXP_MAX_ULP = 2;
+
+static KernelCheck checks[KERNEL_CHECK_COUNT];
+static int check_count = 0;
+
+static const KernelCheck *check(const char *kernel)
+{
+  for (int i = 0; i < check_count; i++)
+  {
+    if (strcmp(checks[i].kernel, kernel) == 0)
+      return &checks[i];
+  }
+  return nullptr;
+}
+
+static void assertBitExact(const char *kernel)
+{
+  const KernelCheck *result = check(kernel);
+  TEST_ASSERT_NOT_NULL(result);
+  TEST_ASSERT_EQUAL_STRING("reference", result->against);
+  TEST_ASSERT_GREATER_THAN_UINT32_MESSAGE(0, result->values, kernel);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, result->max_ulp, kernel);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_normalize_bit_exact()
+{
+  assertBitExact("normalize");
+}
+
+void test_fir6_bit_exact()
+{
+  assertBitExact("fir6");
+}
+
+void test_softmax_bit_exact()
+{
+  assertBitExact("softmax");
+}
+
+void test_exp_close_to_libm()
+{
+  const KernelCheck *result = check("exp");
+  TEST_ASSERT_NOT_NULL(result);
+  TEST_ASSERT_LESS_OR_EQUAL(KERNEL_EXP_MAX_ULP, result->max_ulp);
+}
+
+void test_normalize_edges()
+{
+  // Bounds land exactly on 0 and 1, NaN gives 0, in the vector body and the tail alike
+  const float min[KERNEL_CHANNELS] = {-2, -2, -2, -1, -1, -1};
+  const float inv_range[KERNEL_CHANNELS] = {0.25f, 0.25f, 0.25f, 0.5f, 0.5f, 0.5f};
+  const float in[KERNEL_CHANNELS + 3] = {-2, 2, -3, 1, 5, NAN, NAN, 2, 0};
+  const float expected[KERNEL_CHANNELS + 3] = {0, 1, 0, 1, 1, 0, 0, 1, 0.5f};
+  float out[KERNEL_CHANNELS + 3];
+  kernelNormalize(in, out, KERNEL_CHANNELS + 3, min, inv_range);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, sizeof(out));
+}
+
+int main(int argc, char **argv)
+{
+  check_count = kernelCheckRun(checks, KERNEL_CHECK_COUNT);
+  UNITY_BEGIN();
+  RUN_TEST(test_normalize_bit_exact);
+  RUN_TEST(test_fir6_bit_exact);
+  RUN_TEST(test_softmax_bit_exact);
+  RUN_TEST(test_exp_close_to_libm);
+  RUN_TEST(test_normalize_edges);
+  return UNITY_END();
+}
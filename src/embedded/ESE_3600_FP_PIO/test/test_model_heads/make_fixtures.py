@@ -0,0 +1,104 @@
+import os
+import struct
+import sys
+
+# Writes fixtures.h for test_model_heads: TFLite flatbuffers with only what the host interpreter
+# stand-in (lib/host_runtime/src/tflite_host.cpp) reads, the schema version and the first subgraph's
+# float32 input and output tensors. No operators or weights, the device cannot run them.
+# Run from the project directory: python3 test/test_model_heads/make_fixtures.py
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", ".."))
+from model_pack import COPY, pack, unpack  # noqa: E402
+
+SCHEMA_VERSION = 3
+INPUT_SHAPE = [1, 200, 6]  # OUTPUT_SEQUENCE_LENGTH x NUM_FEATURES
+
+# Name: output shapes, in output order
+FIXTURES = {
+    "two_heads": [[1, 6], [1, 3]],  # Form and lift
+    "scalar_head": [[]],            # Rank 0, no class dimension
+}
+
+
+class Builder:
+    """Front-to-back flatbuffer writer: every offset points forward, children follow their parent"""
+
+    def __init__(self):
+        self.buf = bytearray(struct.pack("<I", 0) + b"TFL3")
+
+    def align(self):
+        while len(self.buf) % 4:
+            self.buf.append(0)
+
+    def table(self, fields):
+        """Fields in schema order, None for absent ones, each in a 4-byte slot. Returns the slot positions."""
+        self.align()
+        vtable = len(self.buf)
+        self.buf += struct.pack("<HH", 4 + 2 * len(fields), 4 + 4 * len(fields))
+        self.buf += b"".join(struct.pack("<H", 0 if f is None else 4 + 4 * i) for i, f in enumerate(fields))
+        self.align()
+        table = len(self.buf)
+        self.buf += struct.pack("<i", table - vtable)
+        slots = []
+        for value in fields:
+            slots.append(len(self.buf))
+            self.buf += struct.pack("<I", value or 0)
+        return table, slots
+
+    def vector(self, values):
+        self.align()
+        position = len(self.buf)
+        self.buf += struct.pack(f"<I{len(values)}i", len(values), *values)
+        return position, [position + 4 + 4 * i for i in range(len(values))]
+
+    def point(self, slot, target):
+        struct.pack_into("<I", self.buf, slot, target - slot)
+
+
+def model(output_shapes):
+    b = Builder()
+    shapes = [INPUT_SHAPE] + output_shapes
+    root, (_, _, subgraphs_slot) = b.table([SCHEMA_VERSION, None, 0])
+    b.point(0, root)
+    subgraphs, (subgraph_slot,) = b.vector([0])
+    b.point(subgraphs_slot, subgraphs)
+    subgraph, (tensors_slot, inputs_slot, outputs_slot) = b.table([0, 0, 0])
+    b.point(subgraph_slot, subgraph)
+    tensors, tensor_slots = b.vector([0] * len(shapes))
+    b.point(tensors_slot, tensors)
+    b.point(inputs_slot, b.vector([0])[0])
+    b.point(outputs_slot, b.vector(list(range(1, len(shapes))))[0])
+    for slot, shape in zip(tensor_slots, shapes):
+        tensor, (shape_slot, _) = b.table([0, 0])  # Type 0: float32
+        b.point(slot, tensor)
+        b.point(shape_slot, b.vector(shape)[0])
+    return bytes(b.buf)
+
+
+def array(name, data):
+    lines = [f"alignas(4) const unsigned char {name}[] = {{"]
+    for i in range(0, len(data), 12):
+        row = ", ".join(f"0x{v:02x}" for v in data[i : i + 12])
+        lines.append(f"    {row}{',' if i + 12 < len(data) else '};'}")
+    lines.append(f"const unsigned int {name}_len = {len(data)};")
+    return lines
+
+
+if __name__ == "__main__":
+    lines = [
+        "// Generated by make_fixtures.py, do not edit.",
+        "// <name>_data is the flatbuffer, <name>_packed the same in a single-chunk model_pack.h container.",
+        "#pragma once",
+        "",
+    ]
+    for name, output_shapes in FIXTURES.items():
+        data = model(output_shapes)
+        packed = pack(data, [(COPY, 0, len(data))])
+        assert unpack(packed) == data
+        lines += [f"// Input {INPUT_SHAPE}, outputs {output_shapes}"]
+        lines += array(f"{name}_data", data) + array(f"{name}_packed", packed) + [""]
+    path = os.path.join(HERE, "fixtures.h")
+    with open(path, "w") as f:
+        f.write("\n".join(lines))
+    print(f"Wrote {path}")
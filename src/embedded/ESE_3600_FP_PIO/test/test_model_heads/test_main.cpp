@@ -0,0 +1,129 @@
+#include <unity.h>
+#include <string.h>
+#include <host_runtime.h>
+#include "utils/tflite/inference.h"
+#include "utils/tflite/model_pack.h"
+#include "fixtures.h"
+
+// Multi-head models through selectModel() and doInference() (src/utils/tflite/inference.h) with the
+// fixtures of make_fixtures.py: every registered head gets its softmax from one Invoke(), and entries
+// whose heads do not match the model are rejected with the previous model left resident.
+
+#if MODEL_PACKED
+#define FIXTURE(name) name##_packed, name##_packed_len
+#else
+#define FIXTURE(name) name##_data, name##_data_len
+#endif
+
+#define HEADS(heads) heads, (int)(sizeof(heads) / sizeof(heads[0]))
+
+static const char *const previous_lift = "bP";
+
+static const ModelHead form_and_lift[] = {HEAD_FORM, HEAD_LIFT};
+static const ModelHead lift_and_form[] = {HEAD_LIFT, HEAD_FORM};
+static const ModelHead form_twice[] = {HEAD_FORM, HEAD_FORM};
+static const ModelHead form_only[] = {HEAD_FORM};
+
+static const ModelEntry two_heads = {"fixture", FIXTURE(two_heads), HEADS(form_and_lift)};
+
+static void assertSoftmax(const HeadResult &head, int classes)
+{
+  TEST_ASSERT_TRUE(head.present);
+  TEST_ASSERT_EQUAL_INT(classes, head.class_count);
+  TEST_ASSERT_TRUE(head.class_idx >= 0 && head.class_idx < classes);
+  float sum = 0;
+  for (int c = 0; c < classes; c++)
+  {
+    TEST_ASSERT_TRUE(head.probabilities[c] <= head.probabilities[head.class_idx]);
+    sum += head.probabilities[c];
+  }
+  TEST_ASSERT_FLOAT_WITHIN(1e-5f, 1.0f, sum);
+}
+
+// The registry model is resident and classifies, with its form head only
+static void assertPreviousModelResident()
+{
+  TEST_ASSERT_NOT_NULL(model_load_stats.lift);
+  TEST_ASSERT_EQUAL_STRING(previous_lift, model_load_stats.lift);
+  const InferenceResult &result = doInference();
+  TEST_ASSERT_TRUE(result.valid);
+  assertSoftmax(result.heads[HEAD_FORM], label_count);
+  TEST_ASSERT_FALSE(result.heads[HEAD_LIFT].present);
+}
+
+void setUp()
+{
+  memset(dataBuffer, 0, NUM_FEATURES * BUFFER_LEN * sizeof(sample_t));
+  TEST_ASSERT_TRUE(selectLiftModel(previous_lift, false));
+}
+
+void tearDown()
+{
+}
+
+void test_two_heads_from_one_invoke()
+{
+  TEST_ASSERT_TRUE(selectModel(two_heads, false));
+  TEST_ASSERT_EQUAL_STRING("fixture", model_load_stats.lift);
+
+  const InferenceResult &result = doInference();
+  TEST_ASSERT_TRUE(result.valid);
+  assertSoftmax(result.heads[HEAD_FORM], label_count);
+  assertSoftmax(result.heads[HEAD_LIFT], 3);
+  TEST_ASSERT_FALSE(result.heads[HEAD_PHASE].present);
+  TEST_ASSERT_EQUAL_INT(result.heads[HEAD_FORM].class_idx, current_lift_idx);
+}
+
+void test_mismatched_heads_keep_the_previous_model()
+{
+  uint32_t switches = model_load_stats.switches;
+  const ModelEntry swapped = {"fixture", FIXTURE(two_heads), HEADS(lift_and_form)};
+  const ModelEntry too_few = {"fixture", FIXTURE(two_heads), HEADS(form_only)};
+  TEST_ASSERT_FALSE(selectModel(swapped, false));
+  assertPreviousModelResident();
+  TEST_ASSERT_FALSE(selectModel(too_few, false));
+  assertPreviousModelResident();
+  TEST_ASSERT_EQUAL_UINT32(switches, model_load_stats.switches); // Only loads that succeed switch
+}
+
+void test_duplicate_heads_rejected_before_loading()
+{
+  uint32_t loads = model_load_stats.loads;
+  const ModelEntry duplicate = {"fixture", FIXTURE(two_heads), HEADS(form_twice)};
+  TEST_ASSERT_FALSE(selectModel(duplicate, false));
+  TEST_ASSERT_EQUAL_UINT32(loads, model_load_stats.loads); // The resident model was never torn down
+  assertPreviousModelResident();
+}
+
+void test_scalar_output_rejected()
+{
+  const ModelEntry scalar = {"fixture", FIXTURE(scalar_head), HEADS(form_only)};
+  TEST_ASSERT_FALSE(selectModel(scalar, false));
+  assertPreviousModelResident();
+}
+
+void test_corrupt_container_keeps_the_previous_model()
+{
+#if MODEL_PACKED
+  // The header still gives the decoded size, the last chunk is cut short
+  const ModelEntry truncated = {"fixture", two_heads_packed, two_heads_packed_len - 1, HEADS(form_and_lift)};
+  TEST_ASSERT_FALSE(selectModel(truncated, false));
+  assertPreviousModelResident();
+#else
+  TEST_IGNORE_MESSAGE("Needs MODEL_PACKED");
+#endif
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  setupModel(false);
+
+  UNITY_BEGIN();
+  RUN_TEST(test_two_heads_from_one_invoke);
+  RUN_TEST(test_mismatched_heads_keep_the_previous_model);
+  RUN_TEST(test_duplicate_heads_rejected_before_loading);
+  RUN_TEST(test_scalar_output_rejected);
+  RUN_TEST(test_corrupt_container_keeps_the_previous_model);
+  return UNITY_END();
+}
@@ -0,0 +1,120 @@
+#include <unity.h>
+#include <math.h>
+#include "utils/reps/rep_metrics.h"
+
+// Rep tempo and sets (src/utils/reps/rep_metrics.h) on synthetic gyro traces at the 5 ms sample rate:
+// the turning point splits a rep into eccentric and concentric in the order eccentric_first gives,
+// the range of motion is the rotation about the lift's axis, and a 30 s rest starts a new set.
+
+static const uint32_t SAMPLE_MS = 5;
+static const float PI = 3.14159265f;
+static const float DEGREES_PER_RADIAN = 57.29578f;
+
+// A rep about the y axis: out_ms turning one way, then back_ms turning back to the start angle
+static const uint32_t OUT_MS = 1200;
+static const uint32_t BACK_MS = 600;
+static const float OUT_RADS = 1.5f;
+
+static RepMetrics metrics;
+static uint32_t now_ms;
+static int finished;
+
+static void add(float gy)
+{
+  const float gyro[3] = {0.05f * gy, gy, 0.0f};
+  RepSpan rep;
+  if (repMetricsAdd(&metrics, now_ms, gyro, &rep))
+    finished++;
+  now_ms += SAMPLE_MS;
+}
+
+static void rest(uint32_t ms)
+{
+  for (uint32_t t = 0; t < ms; t += SAMPLE_MS)
+    add(0.0f);
+}
+
+// Half sine each way; the way back is faster with the same area, so it ends at the start angle
+static void rep()
+{
+  for (uint32_t t = 0; t < OUT_MS; t += SAMPLE_MS)
+    add(-OUT_RADS * sinf(PI * t / OUT_MS));
+  for (uint32_t t = 0; t < BACK_MS; t += SAMPLE_MS)
+    add(OUT_RADS * OUT_MS / BACK_MS * sinf(PI * t / BACK_MS));
+}
+
+static void start(bool eccentric_first)
+{
+  repMetricsReset(&metrics, eccentric_first);
+  now_ms = 0;
+  finished = 0;
+  rest(2000);
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+void test_eccentric_first_lift()
+{
+  start(true); // Bench press: lowered first
+  rep();
+  rest(1000);
+  TEST_ASSERT_EQUAL_INT(1, finished);
+  TEST_ASSERT_UINT32_WITHIN(120, OUT_MS, metrics.last.eccentric_ms);
+  TEST_ASSERT_UINT32_WITHIN(120, BACK_MS, metrics.last.concentric_ms);
+
+  float rom_deg = OUT_RADS * OUT_MS / 1000.0f * 2 / PI * DEGREES_PER_RADIAN;
+  TEST_ASSERT_FLOAT_WITHIN(0.05f * rom_deg, rom_deg, metrics.last.rom_deg);
+}
+
+void test_concentric_first_lift()
+{
+  start(false); // Curl: lifted first
+  rep();
+  rest(1000);
+  TEST_ASSERT_EQUAL_INT(1, finished);
+  TEST_ASSERT_UINT32_WITHIN(120, OUT_MS, metrics.last.concentric_ms);
+  TEST_ASSERT_UINT32_WITHIN(120, BACK_MS, metrics.last.eccentric_ms);
+}
+
+void test_long_rest_starts_a_new_set()
+{
+  start(true);
+  for (int i = 0; i < 3; i++)
+  {
+    rep();
+    rest(1000);
+  }
+  TEST_ASSERT_EQUAL_UINT32(1, metrics.set_count);
+  TEST_ASSERT_EQUAL_UINT16(3, metrics.set_reps);
+  RepTempo average = repMetricsSetAverage(&metrics);
+  TEST_ASSERT_UINT32_WITHIN(120, OUT_MS, average.eccentric_ms);
+
+  // Under SET_REST_MS is still the same set
+  rest(SET_REST_MS - 5000);
+  rep();
+  rest(1000);
+  TEST_ASSERT_EQUAL_UINT32(1, metrics.set_count);
+  TEST_ASSERT_EQUAL_UINT16(4, metrics.set_reps);
+
+  rest(SET_REST_MS + 1000);
+  rep();
+  rest(1000);
+  TEST_ASSERT_EQUAL_INT(5, finished);
+  TEST_ASSERT_EQUAL_UINT32(2, metrics.set_count);
+  TEST_ASSERT_EQUAL_UINT16(1, metrics.set_reps);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_eccentric_first_lift);
+  RUN_TEST(test_concentric_first_lift);
+  RUN_TEST(test_long_rest_starts_a_new_set);
+  return UNITY_END();
+}
@@ -0,0 +1,118 @@
+#include <unity.h>
+#include <math.h>
+#include "utils/reps/rep_segmenter.h"
+
+// The rep segmenter (src/utils/reps/rep_segmenter.h) on synthetic gyro traces at the 5 ms sample rate:
+// a rep between rests fires once with its span, reps too long or too short are discarded, and the
+// segmenter picks up the next rep after either.
+
+static const uint32_t SAMPLE_MS = 5;
+static const float PI = 3.14159265f;
+
+static RepSegmenter segmenter;
+static uint32_t now_ms;
+static int finished;
+static RepSpan last_rep;
+
+static void add(float gx)
+{
+  const float gyro[3] = {gx, 0.1f * gx, 0.0f};
+  RepSpan rep;
+  if (repSegmenterAdd(&segmenter, now_ms, gyro, &rep))
+  {
+    finished++;
+    last_rep = rep;
+  }
+  now_ms += SAMPLE_MS;
+}
+
+static void rest(uint32_t ms)
+{
+  for (uint32_t t = 0; t < ms; t += SAMPLE_MS)
+    add(0.0f);
+}
+
+// Out and back about one axis, peak_rads at the middle of each half
+static void rep(uint32_t ms, float peak_rads)
+{
+  for (uint32_t t = 0; t < ms; t += SAMPLE_MS)
+    add(peak_rads * sinf(2 * PI * t / ms));
+}
+
+void setUp()
+{
+  repSegmenterReset(&segmenter);
+  now_ms = 0;
+  finished = 0;
+}
+
+void tearDown()
+{
+}
+
+void test_one_rep_fires_once()
+{
+  rest(2000);
+  uint32_t start_ms = now_ms;
+  rep(2000, 2.0f);
+  uint32_t end_ms = now_ms;
+  rest(3000);
+
+  TEST_ASSERT_EQUAL_INT(1, finished);
+  TEST_ASSERT_EQUAL_UINT32(1, segmenter.reps);
+  TEST_ASSERT_EQUAL_UINT32(0, segmenter.discarded);
+  // Starts at the last quiet sample before the lift, ends where the final rest began
+  TEST_ASSERT_UINT32_WITHIN(100, start_ms, last_rep.start_ms);
+  TEST_ASSERT_UINT32_WITHIN(150, end_ms, last_rep.end_ms);
+  TEST_ASSERT_EQUAL_UINT32(last_rep.start_ms / SAMPLE_MS, last_rep.first_sample);
+  TEST_ASSERT_EQUAL_UINT32(last_rep.end_ms / SAMPLE_MS, last_rep.last_sample);
+  TEST_ASSERT_TRUE(last_rep.peak > 1.0f && last_rep.peak <= 2.1f);
+}
+
+void test_reps_between_short_rests_each_fire()
+{
+  rest(2000);
+  for (int i = 0; i < 5; i++)
+  {
+    rep(1500, 2.0f);
+    rest(800);
+  }
+  TEST_ASSERT_EQUAL_INT(5, finished);
+  TEST_ASSERT_EQUAL_UINT32(0, segmenter.discarded);
+}
+
+void test_rep_over_max_is_discarded()
+{
+  rest(2000);
+  // Turning steadily (walking off with the weight): discarded at REP_MAX_MS, and the rest of the
+  // turn does not start another candidate
+  for (uint32_t t = 0; t < REP_MAX_MS + 1500; t += SAMPLE_MS)
+    add(1.5f);
+  rest(3000);
+  TEST_ASSERT_EQUAL_INT(0, finished);
+  TEST_ASSERT_EQUAL_UINT32(1, segmenter.discarded);
+
+  // The next ordinary rep still counts
+  rep(2000, 2.0f);
+  rest(3000);
+  TEST_ASSERT_EQUAL_INT(1, finished);
+}
+
+void test_rep_under_min_is_discarded()
+{
+  rest(2000);
+  rep(150, 2.0f);
+  rest(3000);
+  TEST_ASSERT_EQUAL_INT(0, finished);
+  TEST_ASSERT_EQUAL_UINT32(1, segmenter.discarded);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_one_rep_fires_once);
+  RUN_TEST(test_reps_between_short_rests_each_fire);
+  RUN_TEST(test_rep_over_max_is_discarded);
+  RUN_TEST(test_rep_under_min_is_discarded);
+  return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include <unity.h>
+#include <math.h>
+#include "utils/tflite/resampler.h"
+
+// The resampler (src/utils/tflite/resampler.h) on hand-timed reads of a signal that is linear in time:
+// reads on the grid pass through unchanged, grid points a late read skipped over are interpolated on
+// the line, micros() wrapping mid-window changes nothing, the jitter stats count what happened, and a
+// decimator fed the grid points ends up with what decimating the stored window gives.
+
+static const uint32_t PERIOD_US = 5000;
+static const int OUT_COUNT = 8;
+
+static sample_t out_data[OUT_COUNT * NUM_FEATURES];
+static SampleResampler resampler;
+
+// Channel c rises by 1 every 100 us from c * 100, whole numbers at every grid point
+static void signalAt(uint32_t since_start_us, sample_t *sample)
+{
+  for (int c = 0; c < NUM_FEATURES; c++)
+    sample[c] = (sample_t)(c * 100 + since_start_us / 100.0f);
+}
+
+static bool push(uint32_t start_us, uint32_t since_start_us)
+{
+  sample_t sample[NUM_FEATURES];
+  signalAt(since_start_us, sample);
+  return resamplerPush(&resampler, start_us + since_start_us, sample);
+}
+
+static void assertOnTheLine()
+{
+  SampleBuffer out = {out_data, OUT_COUNT};
+  for (int k = 0; k < OUT_COUNT; k++)
+  {
+    sample_t expected[NUM_FEATURES];
+    signalAt(k * PERIOD_US, expected);
+    for (int c = 0; c < NUM_FEATURES; c++)
+      TEST_ASSERT_FLOAT_WITHIN(0.01f, (float)expected[c], (float)out.get(k, c));
+  }
+}
+
+void setUp()
+{
+  SampleBuffer out = {out_data, OUT_COUNT};
+  resamplerReset(&resampler, out, OUT_COUNT, PERIOD_US);
+}
+
+void tearDown()
+{
+}
+
+void test_on_time_reads_pass_through()
+{
+  for (int k = 0; k < OUT_COUNT; k++)
+    TEST_ASSERT_EQUAL(k == OUT_COUNT - 1, push(1000, k * PERIOD_US));
+  assertOnTheLine();
+  TEST_ASSERT_EQUAL_UINT32(OUT_COUNT, resamplerReads(&resampler));
+  TEST_ASSERT_EQUAL_UINT32(0, resampler.jitter.late);
+  TEST_ASSERT_EQUAL_UINT32(PERIOD_US, resampler.jitter.min_us);
+  TEST_ASSERT_EQUAL_UINT32(PERIOD_US, resampler.jitter.max_us);
+  TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, jitterStddevUs(&resampler.jitter));
+
+  // Reads past the window are ignored
+  TEST_ASSERT_TRUE(push(1000, OUT_COUNT * PERIOD_US));
+  TEST_ASSERT_EQUAL_UINT32(OUT_COUNT, resamplerReads(&resampler));
+}
+
+void test_late_read_interpolated_across()
+{
+  // Grid points 2 and 3 fall in the 12 ms gap, 4 between the late read and an early one
+  const uint32_t reads[] = {0, 5000, 17000, 20000, 25000, 30000};
+  for (uint32_t t : reads)
+    TEST_ASSERT_FALSE(push(1000, t));
+  TEST_ASSERT_TRUE(push(1000, 7 * PERIOD_US));
+  assertOnTheLine();
+
+  // Intervals 5000, 12000, 3000 and three more of 5000: mean 35000 / 6, sample stddev by two passes
+  const float intervals[] = {5000, 12000, 3000, 5000, 5000, 5000};
+  float mean = 35000.0f / 6, m2 = 0;
+  for (float interval : intervals)
+    m2 += (interval - mean) * (interval - mean);
+  const SampleJitter &jitter = resampler.jitter;
+  TEST_ASSERT_EQUAL_UINT32(6, jitter.intervals);
+  TEST_ASSERT_EQUAL_UINT32(1, jitter.late);
+  TEST_ASSERT_EQUAL_UINT32(3000, jitter.min_us);
+  TEST_ASSERT_EQUAL_UINT32(12000, jitter.max_us);
+  TEST_ASSERT_FLOAT_WITHIN(0.5f, mean, jitter.mean_us);
+  TEST_ASSERT_FLOAT_WITHIN(1.0f, sqrtf(m2 / 5), jitterStddevUs(&jitter));
+}
+
+void test_micros_wrap_mid_window()
+{
+  // micros() wraps between grid points 1 and 2, inside a late interval
+  const uint32_t start_us = UINT32_MAX - 7000;
+  const uint32_t reads[] = {0, 5000, 13000, 15000, 20000, 25000, 30000};
+  for (uint32_t t : reads)
+    TEST_ASSERT_FALSE(push(start_us, t));
+  TEST_ASSERT_TRUE(push(start_us, 7 * PERIOD_US));
+  assertOnTheLine();
+  TEST_ASSERT_EQUAL_UINT32(1, resampler.jitter.late);
+  TEST_ASSERT_EQUAL_UINT32(8000, resampler.jitter.max_us);
+}
+
+void test_late_threshold()
+{
+  SampleJitter jitter;
+  jitterReset(&jitter);
+  jitterAdd(&jitter, PERIOD_US * 3 / 2, PERIOD_US); // Exactly 1.5 periods is on time
+  TEST_ASSERT_EQUAL_UINT32(0, jitter.late);
+  jitterAdd(&jitter, PERIOD_US * 3 / 2 + 1, PERIOD_US);
+  TEST_ASSERT_EQUAL_UINT32(1, jitter.late);
+
+  // A stall long enough that doubling it wraps in 32 bits
+  jitterAdd(&jitter, 0x80000000u + 1000, PERIOD_US);
+  TEST_ASSERT_EQUAL_UINT32(2, jitter.late);
+  TEST_ASSERT_EQUAL_UINT32(0x80000000u + 1000, jitter.max_us);
+}
+
+void test_grid_points_streamed_through_the_decimator()
+{
+  const int grid = 10 * DECIMATION_FACTOR, outputs = 10;
+  static sample_t stored[grid * NUM_FEATURES];
+  float streamed[outputs * DECIMATOR_CHANNELS], whole[outputs * DECIMATOR_CHANNELS];
+  const DecimatorTaps *taps = decimatorTaps(DECIMATOR_SINC);
+  Decimator<sample_t> decimator;
+  decimatorReset(&decimator, taps, streamed, outputs, SAMPLE_TO_FLOAT);
+  resamplerReset(&resampler, SampleBuffer{stored, grid}, grid, PERIOD_US, &decimator);
+
+  // Every seventh read is a period and a half late
+  uint32_t t = 0;
+  for (int read = 0; !push(1000, t); read++)
+  {
+    TEST_ASSERT_FALSE(decimatorDone(&decimator));
+    t += read % 7 == 6 ? PERIOD_US * 5 / 2 : PERIOD_US;
+  }
+  TEST_ASSERT_TRUE(decimatorDone(&decimator));
+#if SAMPLE_LAYOUT == SAMPLE_LAYOUT_CHANNEL_MAJOR
+  decimateChannelMajor(taps, stored, grid, grid, whole, outputs, SAMPLE_TO_FLOAT);
+#else
+  decimate(taps, stored, grid, whole, outputs, SAMPLE_TO_FLOAT);
+#endif
+  TEST_ASSERT_EQUAL_MEMORY(whole, streamed, sizeof(whole));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_on_time_reads_pass_through);
+  RUN_TEST(test_late_read_interpolated_across);
+  RUN_TEST(test_micros_wrap_mid_window);
+  RUN_TEST(test_late_threshold);
+  RUN_TEST(test_grid_points_streamed_through_the_decimator);
+  return UNITY_END();
+}
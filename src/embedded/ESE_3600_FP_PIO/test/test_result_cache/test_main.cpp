@@ -0,0 +1,116 @@
+#include <unity.h>
+#include <host_runtime.h>
+#include "main.h"
+
+// The result cache (src/utils/tflite/result_cache.h): a quiet window reuses the result of the window just
+// before it and no other, moving windows always run the model, and waking from sleep (main.cpp) starts
+// the next session with nothing to reuse although the window count carries on.
+
+static float input[OUTPUT_SEQUENCE_LENGTH * NUM_FEATURES];
+
+// Every sample at level, plus an alternating step on each channel: 0 for a quiet window
+static WindowSignature signature(float level, float step)
+{
+  for (size_t i = 0; i < OUTPUT_SEQUENCE_LENGTH; i++)
+  {
+    for (int c = 0; c < NUM_FEATURES; c++)
+      input[i * NUM_FEATURES + c] = level + (i % 2 ? step : -step);
+  }
+  WindowSignature result;
+  windowSignature(input, OUTPUT_SEQUENCE_LENGTH, &result);
+  return result;
+}
+
+static InferenceResult formResult(int class_idx, bool valid = true)
+{
+  InferenceResult result = {};
+  result.valid = valid;
+  result.heads[HEAD_FORM].present = true;
+  result.heads[HEAD_FORM].class_idx = class_idx;
+  return result;
+}
+
+static bool motion()
+{
+  return true;
+}
+
+void setUp()
+{
+  resultCacheClear();
+  result_cache_stats = {};
+}
+
+void tearDown()
+{
+}
+
+void test_next_quiet_window_reuses_the_result()
+{
+  WindowSignature quiet = signature(0.5f, 0.0f);
+  TEST_ASSERT_TRUE(resultCacheable(quiet));
+  TEST_ASSERT_NULL(resultCacheLookup(quiet));
+  resultCacheStore(quiet, formResult(3));
+
+  uint32_t stored_window = 99;
+  const InferenceResult *cached = resultCacheLookup(signature(0.5f, 0.001f), &stored_window);
+  TEST_ASSERT_NOT_NULL(cached);
+  TEST_ASSERT_EQUAL_INT(3, cached->heads[HEAD_FORM].class_idx);
+  TEST_ASSERT_EQUAL_UINT32(0, stored_window);
+  TEST_ASSERT_EQUAL_UINT32(1, result_cache_stats.hits);
+}
+
+void test_only_the_window_just_before()
+{
+  WindowSignature quiet = signature(0.5f, 0.0f);
+  resultCacheLookup(quiet);
+  resultCacheStore(quiet, formResult(3));
+  TEST_ASSERT_NULL(resultCacheLookup(signature(0.8f, 0.0f))); // Another level, and not stored
+  TEST_ASSERT_NULL(resultCacheLookup(quiet));                  // Matches, but two windows back
+  TEST_ASSERT_EQUAL_UINT32(3, result_cache_stats.lookups);
+}
+
+void test_moving_and_invalid_results_are_not_cached()
+{
+  WindowSignature moving = signature(0.5f, 0.2f);
+  TEST_ASSERT_FALSE(resultCacheable(moving));
+  TEST_ASSERT_NULL(resultCacheLookup(moving));
+  resultCacheStore(moving, formResult(1));
+  TEST_ASSERT_NULL(resultCacheLookup(moving));
+  TEST_ASSERT_EQUAL_UINT32(0, result_cache_stats.lookups);
+
+  WindowSignature quiet = signature(0.5f, 0.0f);
+  resultCacheLookup(quiet);
+  resultCacheStore(quiet, formResult(1, false));
+  TEST_ASSERT_NULL(resultCacheLookup(quiet));
+}
+
+void test_sleep_starts_a_session_without_cached_results()
+{
+  WindowSignature quiet = signature(0.5f, 0.0f);
+  resultCacheLookup(quiet);
+  resultCacheStore(quiet, formResult(3));
+
+  // The lifter rests, the device sleeps and motion wakes it: the next window is the window count's next
+  hostSetPinSource(IMU_INT_PIN, motion);
+  sleepUntilMotion();
+  TEST_ASSERT_NULL(resultCacheLookup(quiet));
+  TEST_ASSERT_EQUAL_UINT32(2, result_cache_stats.windows);
+
+  // The session's own windows are reused again
+  resultCacheStore(quiet, formResult(4));
+  const InferenceResult *cached = resultCacheLookup(quiet);
+  TEST_ASSERT_NOT_NULL(cached);
+  TEST_ASSERT_EQUAL_INT(4, cached->heads[HEAD_FORM].class_idx);
+}
+
+int main(int argc, char **argv)
+{
+  hostRuntimeInit(argc, argv);
+  UNITY_BEGIN();
+  RUN_TEST(test_next_quiet_window_reuses_the_result);
+  RUN_TEST(test_only_the_window_just_before);
+  RUN_TEST(test_moving_and_invalid_results_are_not_cached);
+  RUN_TEST(test_sleep_starts_a_session_without_cached_results);
+  return UNITY_END();
+}
@@ -0,0 +1,131 @@
+#include <unity.h>
+#include "utils/hardware/result_packet.h"
+
+// Result batches (src/utils/hardware/result_packet.h) through LoopbackTransport and back through
+// decodeResultBatch(): every field survives, batches split at the payload size, a forced flush sends a
+// single result at once and the age limit only backs that up.
+
+static const int CLASSES = 6;
+static ResultBatcher batcher;
+
+static ResultRecord record(uint16_t seq)
+{
+  float softmax[CLASSES] = {0.05f, 0.6f, 0.1f, 0.0f, 0.25f, 1.0f};
+  softmax[seq % CLASSES] = 0.5f;
+  ResultRecord result;
+  makeResultRecord(&result, seq, softmax, CLASSES, seq % CLASSES, 70000 + seq);
+  result.rep_count = seq;
+  result.concentric_ms = 900 + seq;
+  result.eccentric_ms = 1400 + seq;
+  result.rom_deg = 85;
+  result.lift_idx = seq % 3; // A multi-head model's lift head, phase_idx stays RESULT_NO_HEAD
+  return result;
+}
+
+static void assertSameRecord(const ResultRecord &expected, const ResultRecord &actual)
+{
+  TEST_ASSERT_EQUAL_UINT16(expected.seq, actual.seq);
+  TEST_ASSERT_EQUAL_UINT8(expected.class_idx, actual.class_idx);
+  TEST_ASSERT_EQUAL_UINT8(expected.class_count, actual.class_count);
+  TEST_ASSERT_EQUAL_MEMORY(expected.probabilities, actual.probabilities, expected.class_count);
+  TEST_ASSERT_EQUAL_UINT32(expected.inference_us, actual.inference_us);
+  TEST_ASSERT_EQUAL_UINT16(expected.rep_count, actual.rep_count);
+  TEST_ASSERT_EQUAL_UINT16(expected.concentric_ms, actual.concentric_ms);
+  TEST_ASSERT_EQUAL_UINT16(expected.eccentric_ms, actual.eccentric_ms);
+  TEST_ASSERT_EQUAL_UINT16(expected.rom_deg, actual.rom_deg);
+  TEST_ASSERT_EQUAL_UINT8(expected.lift_idx, actual.lift_idx);
+  TEST_ASSERT_EQUAL_UINT8(expected.phase_idx, actual.phase_idx);
+}
+
+void setUp()
+{
+  resultBatcherReset(&batcher);
+}
+
+void tearDown()
+{
+}
+
+void test_batch_round_trips_split_at_the_payload()
+{
+  // Room for three records a packet, seven records make packets of 3, 3 and 1
+  LoopbackTransport transport(RESULT_BATCH_HEADER_BYTES + 3 * resultRecordBytes(CLASSES));
+  for (uint16_t seq = 0; seq < 7; seq++)
+    resultBatcherAdd(&batcher, record(seq), 0);
+  TEST_ASSERT_EQUAL_INT(7, resultBatcherFlush(&batcher, transport, 0));
+  TEST_ASSERT_EQUAL_INT(0, batcher.count);
+  TEST_ASSERT_EQUAL_INT(3, transport.packetCount());
+
+  uint16_t seq = 0;
+  const int sizes[] = {3, 3, 1};
+  for (int p = 0; p < transport.packetCount(); p++)
+  {
+    ResultRecord decoded[RESULT_BATCH_CAPACITY];
+    int count = decodeResultBatch(transport.packet(p), transport.packetLength(p), decoded, RESULT_BATCH_CAPACITY);
+    TEST_ASSERT_EQUAL_INT(sizes[p], count);
+    for (int r = 0; r < count; r++)
+      assertSameRecord(record(seq++), decoded[r]);
+  }
+}
+
+void test_forced_flush_sends_one_result_now()
+{
+  LoopbackTransport transport;
+  TEST_ASSERT_EQUAL_UINT8(RESULT_NO_HEAD, record(1).phase_idx);
+  resultBatcherAdd(&batcher, record(1), 1000);
+  TEST_ASSERT_EQUAL_INT(0, resultBatcherFlush(&batcher, transport, 1000)); // Partial and fresh
+  TEST_ASSERT_EQUAL_INT(1, resultBatcherFlush(&batcher, transport, 1000, true));
+
+  ResultRecord decoded[1];
+  TEST_ASSERT_EQUAL_INT(1, decodeResultBatch(transport.packet(0), transport.packetLength(0), decoded, 1));
+  assertSameRecord(record(1), decoded[0]);
+}
+
+void test_results_wait_for_the_link_then_age_out()
+{
+  LoopbackTransport transport;
+  transport.setReady(false);
+  resultBatcherAdd(&batcher, record(1), 0);
+  resultBatcherAdd(&batcher, record(2), 500);
+  TEST_ASSERT_EQUAL_INT(0, resultBatcherFlush(&batcher, transport, 500, true));
+  TEST_ASSERT_EQUAL_INT(2, batcher.count);
+
+  transport.setReady(true);
+  TEST_ASSERT_EQUAL_INT(0, resultBatcherFlush(&batcher, transport, RESULT_BATCH_MAX_AGE_MS - 1));
+  TEST_ASSERT_EQUAL_INT(2, resultBatcherFlush(&batcher, transport, RESULT_BATCH_MAX_AGE_MS));
+  TEST_ASSERT_EQUAL_INT(1, transport.packetCount());
+}
+
+void test_full_batcher_drops_the_oldest()
+{
+  for (uint16_t seq = 0; seq < RESULT_BATCH_CAPACITY + 2; seq++)
+    resultBatcherAdd(&batcher, record(seq), 0);
+  TEST_ASSERT_EQUAL_INT(RESULT_BATCH_CAPACITY, batcher.count);
+  TEST_ASSERT_EQUAL_UINT32(2, batcher.dropped);
+  TEST_ASSERT_EQUAL_UINT16(2, batcher.records[0].seq);
+}
+
+void test_malformed_batches_are_rejected()
+{
+  ResultRecord records[2] = {record(1), record(2)};
+  uint8_t packet[128];
+  size_t length = encodeResultBatch(records, 2, packet, sizeof(packet));
+  TEST_ASSERT_GREATER_THAN(0, length);
+
+  ResultRecord decoded[2];
+  TEST_ASSERT_EQUAL_INT(-1, decodeResultBatch(packet, length - 1, decoded, 2)); // Truncated
+  TEST_ASSERT_EQUAL_INT(-1, decodeResultBatch(packet, length, decoded, 1));     // More than fits
+  packet[0] = RESULT_PACKET_VERSION + 1;
+  TEST_ASSERT_EQUAL_INT(-1, decodeResultBatch(packet, length, decoded, 2));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_batch_round_trips_split_at_the_payload);
+  RUN_TEST(test_forced_flush_sends_one_result_now);
+  RUN_TEST(test_results_wait_for_the_link_then_age_out);
+  RUN_TEST(test_full_batcher_drops_the_oldest);
+  RUN_TEST(test_malformed_batches_are_rejected);
+  return UNITY_END();
+}
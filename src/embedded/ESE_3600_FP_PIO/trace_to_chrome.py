@@ -0,0 +1,157 @@
+import argparse
+import json
+import struct
+import sys
+
+from stream_receiver import read_packet_log
+
+# Converts a trace ring dump (see src/utils/trace/trace.h) into Chrome trace JSON,
+# open it in chrome://tracing or https://ui.perfetto.dev.
+
+VERSION = 1
+MAGIC = b"RMT"
+HEADER = struct.Struct("<3sBHHII")
+RECORD = struct.Struct("<IBBH")
+PACKET_HEADER = struct.Struct("<BBH")
+PACKET_TYPE = ord("T")
+
+INSTANT, BEGIN, END = 0, 1, 2
+SYNC, SYNC_US = 0, 1
+
+# Event id -> (name, track), same order as TraceEvent
+EVENTS = [
+    ("sync", "scheduler"),
+    ("sync_us", "scheduler"),
+    ("sampling", "sampling"),
+    ("inference", "inference"),
+    ("preprocess", "inference"),
+    ("invoke", "inference"),
+    ("feedback", "feedback"),
+    ("task overrun", "scheduler"),
+    ("cue finished", "scheduler"),
+    ("ble state", "ble"),
+    ("ble send", "ble"),
+    ("trace dump", "scheduler"),
+    ("rep", "sampling"),
+    ("power state", "scheduler"),
+]
+TRACKS = ["sampling", "inference", "feedback", "ble", "scheduler"]
+BLE_STATES = ["idle", "scanning", "connecting", "discovering", "ready", "backoff"]
+POWER_STATES = ["active", "idle", "sleep"]
+
+
+def parse_dump(data):
+    magic, version, cpu_mhz, record_bytes, dropped, count = HEADER.unpack_from(data)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError(f"Not a version {VERSION} trace dump")
+    body = data[HEADER.size :]
+    count = min(count, len(body) // record_bytes)
+    records = [RECORD.unpack_from(body, i * record_bytes) for i in range(count)]
+    return cpu_mhz, dropped, records
+
+
+def dumps_from_serial(path):
+    """Hex dumps between START_TRACE / END_TRACE lines of a serial capture"""
+    dumps, current = [], None
+    with open(path, errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            if line == "START_TRACE":
+                current = bytearray()
+            elif line == "END_TRACE" and current is not None:
+                dumps.append(bytes(current))
+                current = None
+            elif current is not None:
+                current += bytes.fromhex(line)
+    return dumps
+
+
+def dumps_from_ble_log(path):
+    """'T' packets from a length-prefixed BLE capture, chunk 0 starts a new dump"""
+    dumps, current, expected = [], None, 0
+    for packet in read_packet_log(path):
+        if len(packet) < PACKET_HEADER.size or packet[0] != PACKET_TYPE:
+            continue
+        _, version, seq = PACKET_HEADER.unpack_from(packet)
+        if version != VERSION:
+            continue
+        if seq == 0:
+            current, expected = bytearray(), 0
+            dumps.append(current)
+        if current is None or seq != expected:
+            print(f"Lost trace chunk {expected}, dump truncated", file=sys.stderr)
+            current = None
+            continue
+        current += packet[PACKET_HEADER.size :]
+        expected += 1
+    return [bytes(d) for d in dumps]
+
+
+def to_microseconds(cpu_mhz, records):
+    """Cycle timestamps -> microseconds, using the nearest preceding sync pair"""
+    anchors = [
+        (i, records[i][0], records[i + 1][0])
+        for i in range(len(records) - 1)
+        if records[i][1] == SYNC and records[i + 1][1] == SYNC_US
+    ]
+    if not anchors:
+        raise ValueError("Dump has no sync records, cannot place it in time")
+
+    times = []
+    anchor = 0
+    for i, record in enumerate(records):
+        while anchor + 1 < len(anchors) and anchors[anchor + 1][0] <= i:
+            anchor += 1
+        index, cycles, us = anchors[anchor]
+        if i >= index:
+            times.append(us + ((record[0] - cycles) & 0xFFFFFFFF) / cpu_mhz)
+        else:  # Before the first sync, count backwards from it
+            times.append(us - ((cycles - record[0]) & 0xFFFFFFFF) / cpu_mhz)
+    return times
+
+
+def chrome_events(cpu_mhz, records):
+    events = [
+        {"name": "thread_name", "ph": "M", "pid": 1, "tid": tid, "args": {"name": track}}
+        for tid, track in enumerate(TRACKS, 1)
+    ]
+    times = to_microseconds(cpu_mhz, records)
+    for (_, event, phase, arg), ts in zip(records, times):
+        if event == SYNC_US:
+            continue
+        if event == SYNC:
+            if arg:
+                events.append({"name": "light sleep", "ph": "i", "s": "t", "ts": ts, "pid": 1,
+                               "tid": TRACKS.index("scheduler") + 1, "args": {"slept_ms": arg}})
+            continue
+        name, track = EVENTS[event] if event < len(EVENTS) else (f"event {event}", "scheduler")
+        args = {"arg": arg}
+        if name == "ble state" and arg < len(BLE_STATES):
+            args = {"state": BLE_STATES[arg]}
+        if name == "power state" and arg < len(POWER_STATES):
+            args = {"state": POWER_STATES[arg]}
+        ph = {INSTANT: "i", BEGIN: "B", END: "E"}[phase]
+        entry = {"name": name, "ph": ph, "ts": ts, "pid": 1, "tid": TRACKS.index(track) + 1, "args": args}
+        if ph == "i":
+            entry["s"] = "t"
+        events.append(entry)
+    return events
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Convert RepMate trace dumps to Chrome trace JSON")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--serial", help="serial capture containing START_TRACE / END_TRACE blocks")
+    source.add_argument("--ble-log", help="length-prefixed packet capture from the BLE server")
+    parser.add_argument("--index", type=int, default=-1, help="which dump to convert (default: the last)")
+    parser.add_argument("--out", default="trace.json")
+    args = parser.parse_args()
+
+    dumps = dumps_from_serial(args.serial) if args.serial else dumps_from_ble_log(args.ble_log)
+    if not dumps:
+        sys.exit("No trace dump found")
+
+    cpu_mhz, dropped, records = parse_dump(dumps[args.index])
+    with open(args.out, "w") as f:
+        json.dump({"traceEvents": chrome_events(cpu_mhz, records), "displayTimeUnit": "ms"}, f)
+    print(f"Wrote {len(records)} records to {args.out} ({dropped} older records were overwritten)", file=sys.stderr)